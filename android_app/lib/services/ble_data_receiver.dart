@@ -2,9 +2,13 @@ import 'dart:ffi' as ffi; // Core FFI library
 import 'dart:io' show Platform; // For checking OS Platform
 import 'package:ffi/ffi.dart'; // For calloc (memory allocation)
 
-import 'dart:convert'; // for utf8.decode
+import 'dart:convert';
+
 import 'package:flutter_blue_plus/flutter_blue_plus.dart';
 import 'file_storage.dart'; // Assuming this file exists and provides necessary storage functions
+import 'result_frame.dart'; // Binary result frame sent by the firmware
+import 'sweep_transfer.dart'; // Full sweep curves sent in "SWEEP DUMP ON" mode
+import 'journal_sync.dart'; // Readings the firmware journaled while disconnected
 
 // --- FFI Setup ---
 
@@ -40,10 +44,20 @@ final ScoreFunction score = _nativeLib
 class BLEDataReceiver {
   final String targetServiceUUID;
   final String targetCharacteristicUUID;
+  final String? sweepCharacteristicUUID;
+  final String? journalCharacteristicUUID;
+
+  // Reassembles sweep curve notifications; the last complete curve is kept here.
+  final SweepTransferAssembler _sweepAssembler = SweepTransferAssembler();
+  SweepCurve? lastSweepCurve;
+
+  final JournalSyncAssembler _journalAssembler = JournalSyncAssembler();
 
   BLEDataReceiver({
     required this.targetServiceUUID,
     required this.targetCharacteristicUUID,
+    this.sweepCharacteristicUUID,
+    this.journalCharacteristicUUID,
   });
 
   /// Discovers device services, subscribes to notifications on the target characteristic,
@@ -79,78 +93,137 @@ class BLEDataReceiver {
 
       // Listen to incoming data stream
       targetCharacteristic.lastValueStream.listen((data) async {
-        // Pointer variable, declared outside try block for finally access
-        ffi.Pointer<ffi.Double>? inputPointer;
-
-        try {
-          // Ensure data is not empty
-          if (data.isEmpty) {
-            print("Received empty data packet.");
-            return;
-          }
-
-          // Convert the received List<int> to a string.
-          String receivedData = utf8.decode(data);
-          print("Received BLE data: $receivedData");
-
-          // Parse the comma-separated values.
-          List<String> values = receivedData.split(',');
-
-          // Check if we have at least two values
-          if (values.length >= 2) {
-            // Extract the first two values. Use tryParse for safety.
-            double? value1 = double.tryParse(values[0].trim());
-            double? value2 = double.tryParse(values[1].trim());
+        // Ensure data is not empty
+        if (data.isEmpty) {
+          print("Received empty data packet.");
+          return;
+        }
 
-            // Ensure parsing was successful for both values
-            if (value1 != null && value2 != null) {
+        // Decode the binary result frame.
+        final ResultFrame? frame = ResultFrame.decode(data);
+        if (frame == null) {
+          print("Invalid result frame (${data.length} bytes): $data");
+          return;
+        }
+        print("Received BLE data: $frame");
+        await _handleFrame(frame);
+      }); // End of listen callback
 
-              // --- Prepare Input for C function ---
-              // 1. Allocate memory on the native heap for an array of 2 doubles.
-              //    `calloc` initializes the memory to zero bytes.
-              inputPointer = calloc<ffi.Double>(2);
+      print("Successfully subscribed to BLE data notifications from ${targetCharacteristic.uuid}.");
 
-              // 2. Store the Dart double values into the allocated native memory.
-              inputPointer[0] = value1; // First double
-              inputPointer[1] = value2; // Second double
+      await _subscribeToSweeps(services);
+      await _syncJournal(services, targetCharacteristic);
 
-              print("Calling native 'score' function with inputs: ${inputPointer[0]}, ${inputPointer[1]}");
+    } catch (e) {
+      print("Error during service discovery or subscription: $e");
+    }
+  } // End of subscribeToData method
 
-              // --- Call the C Function ---
-              // Pass the pointer to the allocated memory to the native function.
-              // 'score' is the Dart function reference we got from lookup earlier.
-              final double scoreResult = score(inputPointer);
+  /// Scores a decoded result frame (live or journaled) and saves the result.
+  Future<void> _handleFrame(ResultFrame frame) async {
+    // Pointer variable, declared outside try block for finally access
+    ffi.Pointer<ffi.Double>? inputPointer;
 
-              print("Native function returned score: $scoreResult");
+    try {
+      if (!frame.isValid) {
+        print("Sensor reported no reading (flags: 0x${frame.flags.toRadixString(16)}).");
+        return;
+      }
 
-              await FileStorage.writeValue(scoreResult);
+      // Firmware with on-device inference sends the model output; no native call needed.
+      if (frame.modelOutput != null) {
+        print("Using on-device model output: ${frame.modelOutput}");
+        await FileStorage.writeValue(frame.modelOutput!);
+        return;
+      }
 
-            } else {
-              print("Failed to parse one or both double values from: $receivedData");
+      // --- Prepare Input for C function ---
+      // 1. Allocate memory on the native heap for an array of 2 doubles.
+      //    `calloc` initializes the memory to zero bytes.
+      inputPointer = calloc<ffi.Double>(2);
+
+      // 2. Store the resonance (GHz) and S11 depth (dB) into the allocated native memory.
+      inputPointer[0] = frame.resonanceGHz; // First double
+      inputPointer[1] = frame.s11Db; // Second double
+
+      print("Calling native 'score' function with inputs: ${inputPointer[0]}, ${inputPointer[1]}");
+
+      // --- Call the C Function ---
+      // Pass the pointer to the allocated memory to the native function.
+      // 'score' is the Dart function reference we got from lookup earlier.
+      final double scoreResult = score(inputPointer);
+
+      print("Native function returned score: $scoreResult");
+
+      await FileStorage.writeValue(scoreResult);
+    } catch (e, stacktrace) {
+      // Catch potential errors during processing or FFI call
+      print("Error processing BLE data or calling native function: $e");
+      print("Stacktrace: $stacktrace");
+    } finally {
+      // --- CRITICAL: Clean Up Native Memory ---
+      // Always free the allocated memory to prevent memory leaks.
+      // This happens even if errors occurred within the try block.
+      if (inputPointer != null) {
+        calloc.free(inputPointer);
+         print("Freed native memory.");
+      }
+    }
+  }
+
+  /// Subscribes to the optional sweep data characteristic, if the firmware provides it.
+  Future<void> _subscribeToSweeps(List<BluetoothService> services) async {
+    if (sweepCharacteristicUUID == null) return;
+    for (BluetoothService service in services) {
+      if (service.uuid.toString().toLowerCase() != targetServiceUUID.toLowerCase()) continue;
+      for (BluetoothCharacteristic characteristic in service.characteristics) {
+        if (characteristic.uuid.toString().toLowerCase() == sweepCharacteristicUUID!.toLowerCase() &&
+            characteristic.properties.notify) {
+          await characteristic.setNotifyValue(true);
+          characteristic.lastValueStream.listen((packet) {
+            final SweepCurve? curve = _sweepAssembler.add(packet);
+            if (curve != null) {
+              lastSweepCurve = curve;
+              print("Received sweep curve: $curve");
             }
-          } else {
-            print("Invalid data format: expected 2 comma-separated values, received: $receivedData");
-          }
-        } catch (e, stacktrace) {
-          // Catch potential errors during processing or FFI call
-          print("Error processing BLE data or calling native function: $e");
-          print("Stacktrace: $stacktrace");
-        } finally {
-          // --- CRITICAL: Clean Up Native Memory ---
-          // Always free the allocated memory to prevent memory leaks.
-          // This happens even if errors occurred within the try block.
-          if (inputPointer != null) {
-            calloc.free(inputPointer);
-             print("Freed native memory.");
-          }
+          });
+          print("Subscribed to sweep curves from ${characteristic.uuid}.");
+          return;
         }
-      }); // End of listen callback
-
-      print("Successfully subscribed to BLE data notifications from ${targetCharacteristic.uuid}.");
-
-    } catch (e) {
-      print("Error during service discovery or subscription: $e");
+      }
     }
-  } // End of subscribeToData method
+    print("Sweep data characteristic not found; full sweeps unavailable.");
+  }
+
+  /// Fetches the readings the firmware journaled while no phone was connected, saves
+  /// them like live readings and acknowledges them so the device can reuse the space.
+  Future<void> _syncJournal(List<BluetoothService> services, BluetoothCharacteristic commandCharacteristic) async {
+    if (journalCharacteristicUUID == null) return;
+    for (BluetoothService service in services) {
+      if (service.uuid.toString().toLowerCase() != targetServiceUUID.toLowerCase()) continue;
+      for (BluetoothCharacteristic characteristic in service.characteristics) {
+        if (characteristic.uuid.toString().toLowerCase() == journalCharacteristicUUID!.toLowerCase() &&
+            characteristic.properties.notify) {
+          await characteristic.setNotifyValue(true);
+          characteristic.lastValueStream.listen((packet) async {
+            final List<JournalRecord>? records = _journalAssembler.add(packet);
+            if (records == null) return;
+            print("Journal sync: ${records.length} readings.");
+            if (records.isEmpty) return;
+            for (final JournalRecord record in records) {
+              if (record.frame != null) {
+                await _handleFrame(record.frame!);
+              }
+            }
+            await commandCharacteristic.write(utf8.encode("JOURNAL ACK ${records.last.seq}"), withoutResponse: false);
+          });
+          await commandCharacteristic.write(utf8.encode("JOURNAL SYNC"), withoutResponse: false);
+          print("Requested journal sync on ${characteristic.uuid}.");
+          return;
+        }
+      }
+    }
+    print("Journal characteristic not found; readings taken while disconnected are unavailable.");
+  }
 
 } // End of BLEDataReceiver class
\ No newline at end of file
@@ -18,6 +18,8 @@ class BluetoothManager {
   final BLEDataReceiver bleDataReceiver = BLEDataReceiver(
     targetServiceUUID: '4b9131c3-c9c5-cc8f-9e45-b51f01c2af4f', // Service UUID
     targetCharacteristicUUID: 'a8261b36-07ea-f5b7-8846-e1363e48b5be', // Characteristic UUID
+    sweepCharacteristicUUID: 'a8261b36-07ea-f5b7-8846-e1363e48b5bf', // Sweep curve characteristic UUID
+    journalCharacteristicUUID: 'a8261b36-07ea-f5b7-8846-e1363e48b5c3', // Offline result journal UUID
   );
 
   // Writeable characteristic for sending data to the board.
@@ -0,0 +1,52 @@
+import 'dart:typed_data';
+
+import 'result_frame.dart';
+import 'sweep_transfer.dart';
+
+/// One reading the firmware journaled while no client was connected.
+class JournalRecord {
+  /// Journal sequence number; acknowledge the last one received with "JOURNAL ACK <seq>".
+  final int seq;
+  final ResultFrame? frame;
+
+  JournalRecord({required this.seq, required this.frame});
+
+  @override
+  String toString() => 'JournalRecord($seq: $frame)';
+}
+
+/// Reassembles a "JOURNAL SYNC" stream (see result_journal.h in the firmware).
+///
+/// The packet payloads concatenate into a format byte followed by records of
+/// u32 seq, u8 length and that many bytes of result frame, little-endian. A lost or
+/// out-of-order packet drops the sync; records are only acknowledged once received,
+/// so the next sync sends them again.
+class JournalSyncAssembler extends PacketReassembler<List<JournalRecord>> {
+  static const int format = 1;
+  static const int recordHeaderLength = 5;
+
+  JournalSyncAssembler() : super('Journal sync', _decodeStream);
+
+  static List<JournalRecord>? _decodeStream(int transferId, Uint8List stream) {
+    if (stream.isEmpty || stream[0] != format) {
+      return null;
+    }
+    final bytes = ByteData.sublistView(stream);
+    final List<JournalRecord> records = [];
+    int offset = 1;
+    while (offset + recordHeaderLength <= stream.length) {
+      final int seq = bytes.getUint32(offset, Endian.little);
+      final int length = bytes.getUint8(offset + 4);
+      final int end = offset + recordHeaderLength + length;
+      if (end > stream.length) {
+        break;
+      }
+      records.add(JournalRecord(
+        seq: seq,
+        frame: ResultFrame.decode(stream.sublist(offset + recordHeaderLength, end)),
+      ));
+      offset = end;
+    }
+    return records;
+  }
+}
@@ -0,0 +1,172 @@
+import 'dart:typed_data';
+
+/// Decoder for the binary result frame notified by the sensor firmware.
+///
+/// Layout (little-endian), mirroring result_frame.h in the firmware:
+///   0  u8   version
+///   1  u8   flags
+///   2  u16  sequence number
+///   4  u32  device timestamp (ms since boot)
+///   8  u32  resonance frequency (Hz)
+///   12 i16  S11 depth (centi-dB)
+///   14 u16  points acquired
+///   16 u16  request id (version 2; 0 for streamed readings)
+///   18 u8   sweeps averaged (version 3; 1 = single sweep)
+///   19 u8   dip count (version 4; 0 before)
+///   20 i16  single-sweep noise (centi-dB, version 3; only when sweeps averaged >= 2)
+///   22 f32  model output (only when [ResultFrame.flagHasModel] is set)
+///   22/26   dips, 10 bytes each after the model output (version 4, see [ResultDip])
+///
+/// Version 2 frames end at the request id (model output at offset 18); version 1
+/// frames also lack the request id (model output at offset 16).
+class ResultFrame {
+  static const int version = 4;
+  static const int baseLength = 22;
+  static const int dipLength = 10;
+  static const int _v2BaseLength = 18;
+  static const int _v1BaseLength = 16;
+
+  static const int flagValid = 1 << 0;
+  static const int flagReadError = 1 << 1;
+  static const int flagNoMinimum = 1 << 2;
+  static const int flagHasModel = 1 << 3;
+  static const int flagStreamed = 1 << 4;
+  static const int flagSkipped = 1 << 5;
+  static const int flagCoalesced = 1 << 6;
+  static const int flagRejected = 1 << 7;
+
+  final int flags;
+  final int sequence;
+  final int timestampMs;
+  final int resonanceHz;
+  final int s11CentiDb;
+  final int pointsAcquired;
+
+  /// Id of the request this frame answers ("DATA REQUESTED <id>" write); 0 when streamed
+  /// or when the sweep answered another client's request.
+  final int requestId;
+
+  /// Sweeps averaged into this result ("AVERAGE <n>"); 1 for a single sweep.
+  final int sweepsAveraged;
+
+  /// Single-sweep S11 noise in centi-dB; null unless two or more sweeps were averaged.
+  final int? noiseCentiDb;
+  final double? modelOutput;
+
+  /// Most prominent dips of the sweep, most prominent first (version 4; empty before).
+  /// The resonance above is the deepest point, which need not be the first dip.
+  final List<ResultDip> dips;
+
+  ResultFrame({
+    required this.flags,
+    required this.sequence,
+    required this.timestampMs,
+    required this.resonanceHz,
+    required this.s11CentiDb,
+    required this.pointsAcquired,
+    this.requestId = 0,
+    this.sweepsAveraged = 1,
+    this.noiseCentiDb,
+    this.modelOutput,
+    this.dips = const [],
+  });
+
+  bool get isValid => (flags & flagValid) != 0;
+  bool get isStreamed => (flags & flagStreamed) != 0;
+  bool get isRejected => (flags & flagRejected) != 0;
+
+  /// Resonance frequency in GHz, the unit the scoring model expects.
+  double get resonanceGHz => resonanceHz / 1e9;
+
+  /// S11 depth in dB.
+  double get s11Db => s11CentiDb / 100.0;
+
+  /// Decodes [data] into a frame, or returns null if it is too short or of an unknown version.
+  static ResultFrame? decode(List<int> data) {
+    if (data.length < _v1BaseLength) {
+      return null;
+    }
+    final bytes = ByteData.sublistView(Uint8List.fromList(data));
+    final int frameVersion = bytes.getUint8(0);
+    if (frameVersion < 1 || frameVersion > version) {
+      return null;
+    }
+    final int base = (frameVersion == 1) ? _v1BaseLength : (frameVersion == 2) ? _v2BaseLength : baseLength;
+    if (data.length < base) {
+      return null;
+    }
+    final int flags = bytes.getUint8(1);
+    double? modelOutput;
+    int dipsAt = base;
+    if ((flags & flagHasModel) != 0) {
+      if (data.length < base + 4) {
+        return null;
+      }
+      modelOutput = bytes.getFloat32(base, Endian.little);
+      dipsAt += 4;
+    }
+    final int dipCount = (frameVersion >= 4) ? bytes.getUint8(19) : 0;
+    if (data.length < dipsAt + dipCount * dipLength) {
+      return null;
+    }
+    final dips = [
+      for (int i = 0; i < dipCount; i++) ResultDip._decode(bytes, dipsAt + i * dipLength),
+    ];
+    final int sweeps = (frameVersion >= 3) ? bytes.getUint8(18) : 1;
+    return ResultFrame(
+      flags: flags,
+      sequence: bytes.getUint16(2, Endian.little),
+      timestampMs: bytes.getUint32(4, Endian.little),
+      resonanceHz: bytes.getUint32(8, Endian.little),
+      s11CentiDb: bytes.getInt16(12, Endian.little),
+      pointsAcquired: bytes.getUint16(14, Endian.little),
+      requestId: (frameVersion == 1) ? 0 : bytes.getUint16(16, Endian.little),
+      sweepsAveraged: sweeps,
+      noiseCentiDb: (sweeps >= 2) ? bytes.getInt16(20, Endian.little) : null,
+      modelOutput: modelOutput,
+      dips: dips,
+    );
+  }
+
+  @override
+  String toString() =>
+      'ResultFrame(seq: $sequence, request: $requestId, flags: 0x${flags.toRadixString(16)}, '
+      'f: ${resonanceGHz.toStringAsFixed(6)} GHz, s11: ${s11Db.toStringAsFixed(2)} dB, '
+      'points: $pointsAcquired, sweeps: $sweepsAveraged, noise: $noiseCentiDb, model: $modelOutput, '
+      'dips: ${dips.length})';
+}
+
+/// One dip of the swept S11 curve, as listed in a version 4 result frame:
+///   0 u32 frequency of the dip's minimum (Hz)
+///   4 i16 S11 at the minimum (centi-dB)
+///   6 u16 prominence (centi-dB): rise from the minimum to the lower of its two sides
+///   8 u16 width at half prominence (kHz, saturating)
+class ResultDip {
+  final int resonanceHz;
+  final int s11CentiDb;
+  final int prominenceCentiDb;
+  final int widthKHz;
+
+  const ResultDip({
+    required this.resonanceHz,
+    required this.s11CentiDb,
+    required this.prominenceCentiDb,
+    required this.widthKHz,
+  });
+
+  static ResultDip _decode(ByteData bytes, int offset) => ResultDip(
+        resonanceHz: bytes.getUint32(offset, Endian.little),
+        s11CentiDb: bytes.getInt16(offset + 4, Endian.little),
+        prominenceCentiDb: bytes.getUint16(offset + 6, Endian.little),
+        widthKHz: bytes.getUint16(offset + 8, Endian.little),
+      );
+
+  double get resonanceGHz => resonanceHz / 1e9;
+  double get s11Db => s11CentiDb / 100.0;
+  double get prominenceDb => prominenceCentiDb / 100.0;
+
+  @override
+  String toString() =>
+      'ResultDip(f: ${resonanceGHz.toStringAsFixed(6)} GHz, s11: ${s11Db.toStringAsFixed(2)} dB, '
+      'prominence: ${prominenceDb.toStringAsFixed(2)} dB, width: $widthKHz kHz)';
+}
@@ -0,0 +1,111 @@
+import 'dart:typed_data';
+
+/// One full S11 sweep sent by the firmware on the sweep data characteristic.
+class SweepCurve {
+  /// Low byte of the result frame sequence number this curve belongs to.
+  final int transferId;
+  final int startHz;
+  final int stepHz;
+
+  /// S11 magnitude per point, in dB.
+  final List<double> s11Db;
+
+  SweepCurve({
+    required this.transferId,
+    required this.startHz,
+    required this.stepHz,
+    required this.s11Db,
+  });
+
+  /// Frequency of point [index] in GHz.
+  double frequencyGHz(int index) => (startHz + index * stepHz) / 1e9;
+
+  @override
+  String toString() =>
+      'SweepCurve(id: $transferId, ${s11Db.length} points from ${frequencyGHz(0).toStringAsFixed(6)} GHz)';
+}
+
+/// Reassembles a stream sent as sweep_transfer packets (see sweep_transfer.h in the
+/// firmware) and decodes it with [decode] once its last packet arrives.
+///
+/// Each packet is a 4-byte header (flags, transfer id, u16 packet index) followed by
+/// a slice of the stream. Sweep curves and journal syncs are sent this way.
+class PacketReassembler<T> {
+  static const int flagFirst = 1 << 0;
+  static const int flagLast = 1 << 1;
+  static const int packetHeaderLength = 4;
+
+  /// Names the stream in the log when a transfer is dropped.
+  final String name;
+  final T? Function(int transferId, Uint8List stream) decode;
+
+  final BytesBuilder _stream = BytesBuilder(copy: false);
+  int? _transferId;
+  int _nextPacketIndex = 0;
+
+  PacketReassembler(this.name, this.decode);
+
+  /// Adds one notification. Returns the decoded stream once its last packet arrives,
+  /// otherwise null. A lost or out-of-order packet drops the transfer.
+  T? add(List<int> packet) {
+    if (packet.length < packetHeaderLength) {
+      return null;
+    }
+    final int flags = packet[0];
+    final int transferId = packet[1];
+    final int packetIndex = packet[2] | (packet[3] << 8);
+
+    if ((flags & flagFirst) != 0) {
+      _stream.clear();
+      _transferId = transferId;
+      _nextPacketIndex = 0;
+    }
+    if (_transferId != transferId || packetIndex != _nextPacketIndex) {
+      print("$name $transferId: expected packet $_nextPacketIndex, got $packetIndex. Dropping transfer.");
+      _stream.clear();
+      _transferId = null;
+      return null;
+    }
+    _stream.add(packet.sublist(packetHeaderLength));
+    _nextPacketIndex++;
+
+    if ((flags & flagLast) == 0) {
+      return null;
+    }
+    _transferId = null;
+    return decode(transferId, _stream.takeBytes());
+  }
+}
+
+/// Reassembles sweep curve packets. The stream is u32 start Hz, u32 step Hz,
+/// u16 points, i16 first value, then i16 deltas, all little-endian and in centi-dB.
+class SweepTransferAssembler extends PacketReassembler<SweepCurve> {
+  static const int streamHeaderLength = 12;
+
+  SweepTransferAssembler() : super('Sweep transfer', _decodeStream);
+
+  static SweepCurve? _decodeStream(int transferId, Uint8List stream) {
+    if (stream.length < streamHeaderLength) {
+      return null;
+    }
+    final bytes = ByteData.sublistView(stream);
+    final int points = bytes.getUint16(8, Endian.little);
+    if (points == 0 || stream.length < streamHeaderLength + 2 * (points - 1)) {
+      return null;
+    }
+
+    final List<double> s11Db = List<double>.filled(points, 0);
+    int value = bytes.getInt16(10, Endian.little);
+    s11Db[0] = value / 100.0;
+    for (int i = 1; i < points; i++) {
+      value += bytes.getInt16(streamHeaderLength + 2 * (i - 1), Endian.little);
+      s11Db[i] = value / 100.0;
+    }
+    return SweepCurve(
+      transferId: transferId,
+      startHz: bytes.getUint32(0, Endian.little),
+      stepHz: bytes.getUint32(4, Endian.little),
+      s11Db: s11Db,
+    );
+  }
+}
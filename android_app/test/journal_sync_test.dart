@@ -0,0 +1,74 @@
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:android_app/services/journal_sync.dart';
+import 'package:android_app/services/result_frame.dart';
+
+import 'test_frames.dart';
+
+/// Journal stream: format byte, then u32 seq, u8 length and the frame per record.
+Uint8List journalStream(Map<int, Uint8List> records) {
+  final builder = BytesBuilder()..addByte(JournalSyncAssembler.format);
+  records.forEach((seq, frame) {
+    final header = ByteData(JournalSyncAssembler.recordHeaderLength)
+      ..setUint32(0, seq, Endian.little)
+      ..setUint8(4, frame.length);
+    builder
+      ..add(header.buffer.asUint8List())
+      ..add(frame);
+  });
+  return builder.takeBytes();
+}
+
+void main() {
+  group('JournalSyncAssembler', () {
+    test('reassembles journaled frames in order', () {
+      final assembler = JournalSyncAssembler();
+      final stream = journalStream({
+        100: encodeFrame(4, model: 56.5),
+        101: encodeFrame(3, sweeps: 2, noiseCentiDb: 12),
+      });
+      List<JournalRecord>? records;
+      for (final packet in packetize(1, stream, 16)) {
+        expect(records, isNull);
+        records = assembler.add(packet);
+      }
+      expect(records, hasLength(2));
+      expect(records![0].seq, 100);
+      expect(records[0].frame?.modelOutput, 56.5);
+      expect(records[1].seq, 101);
+      expect(records[1].frame?.noiseCentiDb, 12);
+    });
+
+    test('an undecodable frame keeps its seq so it can still be acknowledged', () {
+      final assembler = JournalSyncAssembler();
+      final unknown = encodeFrame(4)..[0] = ResultFrame.version + 1;
+      final records = assembler.add(packetize(2, journalStream({7: unknown}), 64).single);
+      expect(records, hasLength(1));
+      expect(records![0].seq, 7);
+      expect(records[0].frame, isNull);
+    });
+
+    test('a record cut short ends the sync at the last whole record', () {
+      final assembler = JournalSyncAssembler();
+      final stream = journalStream({1: encodeFrame(4), 2: encodeFrame(4)});
+      final records = assembler.add(packetize(3, stream.sublist(0, stream.length - 1), 128).single);
+      expect(records?.map((r) => r.seq).toList(), [1]);
+    });
+
+    test('an unknown stream format is rejected', () {
+      final assembler = JournalSyncAssembler();
+      final stream = journalStream({1: encodeFrame(4)})..[0] = JournalSyncAssembler.format + 1;
+      expect(assembler.add(packetize(4, stream, 128).single), isNull);
+    });
+
+    test('an out-of-order packet drops the sync', () {
+      final assembler = JournalSyncAssembler();
+      final packets = packetize(5, journalStream({1: encodeFrame(4), 2: encodeFrame(4)}), 8);
+      expect(assembler.add(packets[0]), isNull);
+      expect(assembler.add(packets[2]), isNull);
+      expect(assembler.add(packets.last), isNull);
+    });
+  });
+}
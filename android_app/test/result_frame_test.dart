@@ -0,0 +1,100 @@
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:android_app/services/result_frame.dart';
+
+import 'test_frames.dart';
+
+void expectBaseFields(ResultFrame frame) {
+  expect(frame.isValid, isTrue);
+  expect(frame.sequence, 0x1234);
+  expect(frame.timestampMs, 987654);
+  expect(frame.resonanceHz, 2300125000);
+  expect(frame.s11CentiDb, -2512);
+  expect(frame.pointsAcquired, 1024);
+}
+
+void main() {
+  const dips = [
+    ResultDip(resonanceHz: 2300125000, s11CentiDb: -2512, prominenceCentiDb: 1712, widthKHz: 3000),
+    ResultDip(resonanceHz: 2210000000, s11CentiDb: -1600, prominenceCentiDb: 800, widthKHz: 750),
+  ];
+
+  group('ResultFrame.decode', () {
+    test('version 1 has no request id, averaging or dips', () {
+      final frame = ResultFrame.decode(encodeFrame(1))!;
+      expectBaseFields(frame);
+      expect(frame.requestId, 0);
+      expect(frame.sweepsAveraged, 1);
+      expect(frame.noiseCentiDb, isNull);
+      expect(frame.modelOutput, isNull);
+      expect(frame.dips, isEmpty);
+    });
+
+    test('version 1 model output follows the 16-byte base', () {
+      final frame = ResultFrame.decode(encodeFrame(1, model: 56.5))!;
+      expectBaseFields(frame);
+      expect(frame.modelOutput, 56.5);
+    });
+
+    test('version 2 carries the request id', () {
+      final frame = ResultFrame.decode(encodeFrame(2, requestId: 42, model: 61.25))!;
+      expectBaseFields(frame);
+      expect(frame.requestId, 42);
+      expect(frame.sweepsAveraged, 1);
+      expect(frame.modelOutput, 61.25);
+    });
+
+    test('version 3 carries averaging and noise', () {
+      final frame = ResultFrame.decode(encodeFrame(3, requestId: 7, sweeps: 4, noiseCentiDb: 35))!;
+      expectBaseFields(frame);
+      expect(frame.requestId, 7);
+      expect(frame.sweepsAveraged, 4);
+      expect(frame.noiseCentiDb, 35);
+      expect(frame.modelOutput, isNull);
+      expect(frame.dips, isEmpty);
+    });
+
+    test('version 3 single sweep reports no noise', () {
+      final frame = ResultFrame.decode(encodeFrame(3, sweeps: 1, noiseCentiDb: 35))!;
+      expect(frame.noiseCentiDb, isNull);
+    });
+
+    test('version 4 lists dips after the model output', () {
+      final frame = ResultFrame.decode(encodeFrame(4,
+          flags: ResultFrame.flagValid | ResultFrame.flagStreamed, model: 56.5, dips: dips))!;
+      expectBaseFields(frame);
+      expect(frame.isStreamed, isTrue);
+      expect(frame.modelOutput, 56.5);
+      expect(frame.dips, hasLength(2));
+      expect(frame.dips[0].resonanceHz, 2300125000);
+      expect(frame.dips[0].s11CentiDb, -2512);
+      expect(frame.dips[0].prominenceCentiDb, 1712);
+      expect(frame.dips[0].widthKHz, 3000);
+      expect(frame.dips[1].resonanceHz, 2210000000);
+      expect(frame.dips[1].widthKHz, 750);
+    });
+
+    test('version 4 without a model output has dips at the base length', () {
+      final frame = ResultFrame.decode(encodeFrame(4, dips: dips))!;
+      expect(frame.modelOutput, isNull);
+      expect(frame.dips[1].s11CentiDb, -1600);
+    });
+
+    test('truncated frames are rejected', () {
+      final full = encodeFrame(4, model: 56.5, dips: dips);
+      expect(ResultFrame.decode(full.sublist(0, full.length - 1)), isNull); // Last dip cut
+      expect(ResultFrame.decode(full.sublist(0, ResultFrame.baseLength + 2)), isNull); // Model cut
+      expect(ResultFrame.decode(encodeFrame(3).sublist(0, 20)), isNull); // Short of the v3 base
+      expect(ResultFrame.decode(encodeFrame(1).sublist(0, 15)), isNull); // Short of any base
+      expect(ResultFrame.decode(const []), isNull);
+    });
+
+    test('unknown versions are rejected', () {
+      final frame = encodeFrame(4);
+      frame[0] = 0;
+      expect(ResultFrame.decode(frame), isNull);
+      frame[0] = ResultFrame.version + 1;
+      expect(ResultFrame.decode(frame), isNull);
+    });
+  });
+}
@@ -0,0 +1,63 @@
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:android_app/services/sweep_transfer.dart';
+
+import 'test_frames.dart';
+
+/// Curve stream: u32 start Hz, u32 step Hz, u16 points, i16 first value, i16 deltas (centi-dB).
+Uint8List curveStream(int startHz, int stepHz, List<int> centiDb) {
+  final bytes = ByteData(SweepTransferAssembler.streamHeaderLength + 2 * (centiDb.length - 1));
+  bytes.setUint32(0, startHz, Endian.little);
+  bytes.setUint32(4, stepHz, Endian.little);
+  bytes.setUint16(8, centiDb.length, Endian.little);
+  bytes.setInt16(10, centiDb[0], Endian.little);
+  for (int i = 1; i < centiDb.length; i++) {
+    bytes.setInt16(SweepTransferAssembler.streamHeaderLength + 2 * (i - 1), centiDb[i] - centiDb[i - 1], Endian.little);
+  }
+  return bytes.buffer.asUint8List();
+}
+
+void main() {
+  const values = [-1000, -1520, -2512, -1700, -990];
+  final stream = curveStream(2200000000, 195503, values);
+
+  group('SweepTransferAssembler', () {
+    test('reassembles a curve split across packets', () {
+      final assembler = SweepTransferAssembler();
+      final packets = packetize(9, stream, 5);
+      SweepCurve? curve;
+      for (final packet in packets) {
+        expect(curve, isNull);
+        curve = assembler.add(packet);
+      }
+      expect(curve, isNotNull);
+      expect(curve!.transferId, 9);
+      expect(curve.startHz, 2200000000);
+      expect(curve.stepHz, 195503);
+      expect(curve.s11Db, [-10.0, -15.2, -25.12, -17.0, -9.9]);
+    });
+
+    test('a lost packet drops the transfer until the next first packet', () {
+      final assembler = SweepTransferAssembler();
+      final packets = packetize(3, stream, 5);
+      expect(assembler.add(packets[0]), isNull);
+      for (final packet in packets.skip(2)) {
+        expect(assembler.add(packet), isNull);
+      }
+      SweepCurve? curve;
+      for (final packet in packetize(4, stream, 8)) {
+        curve = assembler.add(packet);
+      }
+      expect(curve?.transferId, 4);
+      expect(curve?.s11Db, hasLength(values.length));
+    });
+
+    test('a stream shorter than its point count is rejected', () {
+      final assembler = SweepTransferAssembler();
+      final packets = packetize(5, stream.sublist(0, stream.length - 2), 64);
+      expect(assembler.add(packets.single), isNull);
+    });
+  });
+}
@@ -0,0 +1,60 @@
+// Encoders for the firmware's wire formats, shared by the decoder tests.
+import 'dart:typed_data';
+
+import 'package:android_app/services/result_frame.dart';
+import 'package:android_app/services/sweep_transfer.dart';
+
+/// Builds a frame of [version] the way result_frame.c in the firmware encodes it.
+Uint8List encodeFrame(
+  int version, {
+  int flags = ResultFrame.flagValid,
+  int requestId = 0,
+  int sweeps = 1,
+  int noiseCentiDb = 0,
+  double? model,
+  List<ResultDip> dips = const [],
+}) {
+  final int base = (version == 1) ? 16 : (version == 2) ? 18 : 22;
+  final int length = base + (model != null ? 4 : 0) + dips.length * ResultFrame.dipLength;
+  final bytes = ByteData(length);
+  bytes.setUint8(0, version);
+  bytes.setUint8(1, flags | (model != null ? ResultFrame.flagHasModel : 0));
+  bytes.setUint16(2, 0x1234, Endian.little);
+  bytes.setUint32(4, 987654, Endian.little);
+  bytes.setUint32(8, 2300125000, Endian.little);
+  bytes.setInt16(12, -2512, Endian.little);
+  bytes.setUint16(14, 1024, Endian.little);
+  if (version >= 2) {
+    bytes.setUint16(16, requestId, Endian.little);
+  }
+  if (version >= 3) {
+    bytes.setUint8(18, sweeps);
+    bytes.setUint8(19, (version >= 4) ? dips.length : 0);
+    bytes.setInt16(20, noiseCentiDb, Endian.little);
+  }
+  int offset = base;
+  if (model != null) {
+    bytes.setFloat32(offset, model, Endian.little);
+    offset += 4;
+  }
+  for (final dip in dips) {
+    bytes.setUint32(offset, dip.resonanceHz, Endian.little);
+    bytes.setInt16(offset + 4, dip.s11CentiDb, Endian.little);
+    bytes.setUint16(offset + 6, dip.prominenceCentiDb, Endian.little);
+    bytes.setUint16(offset + 8, dip.widthKHz, Endian.little);
+    offset += ResultFrame.dipLength;
+  }
+  return bytes.buffer.asUint8List();
+}
+
+/// Splits [stream] into sweep_transfer packets of at most [chunk] payload bytes.
+List<Uint8List> packetize(int transferId, List<int> stream, int chunk) {
+  final packets = <Uint8List>[];
+  for (int offset = 0, index = 0; offset < stream.length; offset += chunk, index++) {
+    final int end = (offset + chunk < stream.length) ? offset + chunk : stream.length;
+    final int flags = (offset == 0 ? PacketReassembler.flagFirst : 0) |
+        (end == stream.length ? PacketReassembler.flagLast : 0);
+    packets.add(Uint8List.fromList([flags, transferId, index & 0xFF, index >> 8, ...stream.sublist(offset, end)]));
+  }
+  return packets;
+}
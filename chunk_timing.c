@@ -0,0 +1,98 @@
+#include <math.h>
+#include <string.h>
+#include "chunk_timing.h"
+#include "le_bytes.h"
+
+#define EWMA_WEIGHT  (1.0f / 8.0f)
+
+static uint32_t clamp_us(float us)
+{
+    return (us <= 0.0f) ? 0 : (us >= (float)UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+}
+
+/**
+ * @brief What one learned unit of `kind` is worth in a chunk of `records` records.
+ */
+static float kind_scale(chunk_timing_kind_t kind, uint16_t records)
+{
+    if (kind != CHUNK_TIMING_FIRST_POINT) {
+        return 1.0f;
+    }
+    return (float)((records < CHUNK_TIMING_MIN_RECORDS) ? CHUNK_TIMING_MIN_RECORDS : records);
+}
+
+void chunk_timing_init(chunk_timing_t *timing, const uint32_t default_us[CHUNK_TIMING_COUNT], uint32_t floor_us)
+{
+    memset(timing, 0, sizeof(*timing));
+    for (unsigned k = 0; k < CHUNK_TIMING_COUNT; ++k) {
+        timing->kinds[k].default_us = default_us[k];
+        timing->kinds[k].floor_us = (floor_us < default_us[k]) ? floor_us : default_us[k];
+    }
+}
+
+void chunk_timing_reset_counters(chunk_timing_t *timing)
+{
+    timing->timeouts = 0;
+    timing->retries_ok = 0;
+    timing->stalls = 0;
+}
+
+void chunk_timing_add(chunk_timing_t *timing, chunk_timing_kind_t kind, int64_t duration_us, uint16_t records)
+{
+    if (kind >= CHUNK_TIMING_COUNT || (kind == CHUNK_TIMING_FIRST_POINT && records < CHUNK_TIMING_MIN_RECORDS)) {
+        return;
+    }
+    chunk_timing_estimator_t *e = &timing->kinds[kind];
+    const float x = ((duration_us < 0) ? 0.0f : (float)duration_us) / kind_scale(kind, records);
+    if (e->samples == 0) {
+        e->mean_us = x;
+        e->var_us2 = (x / 2.0f) * (x / 2.0f);
+    } else {
+        // Exponentially weighted mean and variance (West 1979 form)
+        const float diff = x - e->mean_us;
+        e->mean_us += EWMA_WEIGHT * diff;
+        e->var_us2 = (1.0f - EWMA_WEIGHT) * (e->var_us2 + EWMA_WEIGHT * diff * diff);
+    }
+    if (e->samples < UINT32_MAX) {
+        e->samples++;
+    }
+}
+
+uint32_t chunk_timing_deadline_us(const chunk_timing_t *timing, chunk_timing_kind_t kind, uint16_t records)
+{
+    if (kind >= CHUNK_TIMING_COUNT) {
+        return 0;
+    }
+    const chunk_timing_estimator_t *e = &timing->kinds[kind];
+    if (e->samples < CHUNK_TIMING_WARMUP) {
+        return e->default_us;
+    }
+    const uint32_t deadline = clamp_us((e->mean_us + CHUNK_TIMING_DEVIATIONS * sqrtf(e->var_us2)) * kind_scale(kind, records));
+    return (deadline < e->floor_us) ? e->floor_us : (deadline > e->default_us) ? e->default_us : deadline;
+}
+
+size_t chunk_timing_encode(const chunk_timing_t *timing, uint16_t records, uint8_t *out, size_t max_len)
+{
+    if (max_len < CHUNK_TIMING_ENCODED_LEN) {
+        return 0;
+    }
+    out[0] = CHUNK_TIMING_FORMAT;
+    out[1] = CHUNK_TIMING_COUNT;
+    out[2] = 0;
+    out[3] = 0;
+    le_put_u32(out + 4, timing->timeouts);
+    le_put_u32(out + 8, timing->retries_ok);
+    le_put_u32(out + 12, timing->stalls);
+
+    uint8_t *p = out + CHUNK_TIMING_HEADER_LEN;
+    for (unsigned k = 0; k < CHUNK_TIMING_COUNT; ++k) {
+        const chunk_timing_estimator_t *e = &timing->kinds[k];
+        const float scale = kind_scale((chunk_timing_kind_t)k, records);
+        le_put_u32(p + 0, e->samples);
+        le_put_u32(p + 4, clamp_us(e->mean_us * scale));
+        le_put_u32(p + 8, clamp_us(sqrtf(e->var_us2) * scale));
+        le_put_u32(p + 12, chunk_timing_deadline_us(timing, (chunk_timing_kind_t)k, records));
+        p += CHUNK_TIMING_KIND_LEN;
+    }
+    return CHUNK_TIMING_ENCODED_LEN;
+}
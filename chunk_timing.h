@@ -0,0 +1,100 @@
+// chunk_timing.h
+// Learned READFIFO timing, for deadlines that track the link instead of a fixed
+// worst case. Two quantities are learned per chunk: the latency from READFIFO sent
+// to the first point, and the longest gap between USB packets once points flow.
+// The NanoVNA answers once it has swept the records asked for, so the first-point
+// latency is learned per record requested and scaled by the size of each chunk;
+// the packet gap is not scaled. Chunks under CHUNK_TIMING_MIN_RECORDS (re-reads of a
+// few points) are dominated by fixed latency: they are not learned from, and their
+// deadline is that of a CHUNK_TIMING_MIN_RECORDS chunk.
+// Each is an exponentially weighted mean and variance (weight 1/8 per chunk, started
+// at mean = sample, deviation = sample / 2 as for TCP's RTO). The deadline is
+// CHUNK_TIMING_DEVIATIONS standard deviations above the mean, clamped between the
+// floor and the fixed default; the default applies until CHUNK_TIMING_WARMUP chunks
+// have been measured.
+//
+// Encoded layout (little-endian), appended to the diagnostics characteristic after
+// the latency statistics. Means, deviations and deadlines are for a chunk of the
+// `records` given to chunk_timing_encode():
+//
+//  Offset  Size  Field
+//  0       1     format           (CHUNK_TIMING_FORMAT)
+//  1       1     kind_count       (CHUNK_TIMING_COUNT, order of chunk_timing_kind_t)
+//  2       2     reserved         (0)
+//  4       4     timeouts         (chunks whose first point missed its deadline)
+//  8       4     retries_ok       (of those, chunks the retry delivered)
+//  12      4     stalls           (chunks whose points stopped part way)
+//  16      16*N  per kind: u32 samples, u32 mean_us, u32 stddev_us, u32 deadline_us
+#ifndef CHUNK_TIMING_H
+#define CHUNK_TIMING_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CHUNK_TIMING_FORMAT       (1)
+#define CHUNK_TIMING_DEVIATIONS   (4)
+#define CHUNK_TIMING_WARMUP       (8)
+#define CHUNK_TIMING_MIN_RECORDS  (16)
+#define CHUNK_TIMING_HEADER_LEN   (16)
+#define CHUNK_TIMING_KIND_LEN     (16)
+
+typedef enum {
+    CHUNK_TIMING_FIRST_POINT = 0,   // READFIFO sent -> first point handed over (per record requested)
+    CHUNK_TIMING_PACKET_GAP,        // Longest wait between points within a chunk
+    CHUNK_TIMING_COUNT
+} chunk_timing_kind_t;
+
+#define CHUNK_TIMING_ENCODED_LEN  (CHUNK_TIMING_HEADER_LEN + CHUNK_TIMING_COUNT * CHUNK_TIMING_KIND_LEN)
+
+typedef struct {
+    uint32_t samples;
+    float mean_us;           // Per record for CHUNK_TIMING_FIRST_POINT
+    float var_us2;
+    uint32_t default_us;     // Deadline before warm-up, and its ceiling after
+    uint32_t floor_us;       // Deadlines never drop below this (scheduling and tick granularity)
+} chunk_timing_estimator_t;
+
+typedef struct {
+    chunk_timing_estimator_t kinds[CHUNK_TIMING_COUNT];
+    uint32_t timeouts;
+    uint32_t retries_ok;
+    uint32_t stalls;
+} chunk_timing_t;
+
+/**
+ * @brief Forgets everything learned and sets each kind's default deadline and floor.
+ */
+void chunk_timing_init(chunk_timing_t *timing, const uint32_t default_us[CHUNK_TIMING_COUNT], uint32_t floor_us);
+
+/**
+ * @brief Clears the timeout, retry and stall counters; the learned timing is kept.
+ */
+void chunk_timing_reset_counters(chunk_timing_t *timing);
+
+/**
+ * @brief Adds the measurement of `kind` for one chunk of `records` records. Negative
+ * durations are recorded as 0.
+ */
+void chunk_timing_add(chunk_timing_t *timing, chunk_timing_kind_t kind, int64_t duration_us, uint16_t records);
+
+/**
+ * @brief Current deadline for `kind` in a chunk of `records` records: mean + CHUNK_TIMING_DEVIATIONS
+ * standard deviations, clamped to [floor, default], or the default during warm-up.
+ */
+uint32_t chunk_timing_deadline_us(const chunk_timing_t *timing, chunk_timing_kind_t kind, uint16_t records);
+
+/**
+ * @brief Writes the encoded layout above into `out`, for chunks of `records` records.
+ * @return bytes written (CHUNK_TIMING_ENCODED_LEN), or 0 if `max_len` is too small
+ */
+size_t chunk_timing_encode(const chunk_timing_t *timing, uint16_t records, uint8_t *out, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CHUNK_TIMING_H
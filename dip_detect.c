@@ -0,0 +1,160 @@
+#include <stdbool.h>
+#include <string.h>
+#include "dip_detect.h"
+
+#define NO_HEIGHT  (INT32_MIN)   // No point on that side (yet)
+
+typedef struct {
+    uint16_t index;
+    int32_t value;
+    int32_t left_max;            // Highest point between the nearest lower point on the left and the minimum
+    int32_t right_max;           // Highest point after the minimum so far
+} open_dip_t;
+
+typedef struct {
+    const int16_t *cdb;
+    uint16_t points;
+    uint16_t min_prominence_cdb;
+    dip_t *dips;                 // Most prominent first
+    size_t max_dips;
+    size_t count;
+} dip_search_t;
+
+static int32_t max_height(int32_t a, int32_t b)
+{
+    return (a > b) ? a : b;
+}
+
+/**
+ * @brief Position where the curve first reaches `level` walking from `index` in direction
+ * `dir`, interpolated between points; the end of the sweep if it never does.
+ */
+static float level_crossing(const int16_t *cdb, uint16_t points, uint16_t index, int dir, float level)
+{
+    int j = index;
+    while (true) {
+        const int next = j + dir;
+        if (next < 0 || next >= points) {
+            return (float)j;
+        }
+        if ((float)cdb[next] >= level) {
+            const float rise = (float)cdb[next] - (float)cdb[j];
+            const float fraction = (rise > 0.0f) ? (level - (float)cdb[j]) / rise : 0.0f;
+            return (float)j + (float)dir * fraction;
+        }
+        j = next;
+    }
+}
+
+/**
+ * @brief Scores a dip whose right side is complete and keeps it if it is among the most prominent.
+ */
+static void close_dip(dip_search_t *search, const open_dip_t *open)
+{
+    const int32_t base = (open->left_max < open->right_max) ? open->left_max : open->right_max;
+    if (base == NO_HEIGHT || base - open->value <= 0 || base - open->value < search->min_prominence_cdb) {
+        return;
+    }
+    const int32_t prominence = base - open->value;
+    size_t pos = search->count;
+    while (pos > 0 && search->dips[pos - 1].prominence_cdb < prominence) {
+        pos--;
+    }
+    if (pos >= search->max_dips) {
+        return;
+    }
+    const float level = (float)open->value + (float)prominence / 2.0f;
+    const float left = level_crossing(search->cdb, search->points, open->index, -1, level);
+    const float right = level_crossing(search->cdb, search->points, open->index, +1, level);
+    const size_t last = (search->count < search->max_dips) ? search->count : search->max_dips - 1;
+    memmove(&search->dips[pos + 1], &search->dips[pos], (last - pos) * sizeof(dip_t));
+    search->dips[pos] = (dip_t){
+        .index = open->index,
+        .s11_cdb = (int16_t)open->value,
+        .prominence_cdb = (prominence > UINT16_MAX) ? UINT16_MAX : (uint16_t)prominence,
+        .width_points = right - left,
+    };
+    if (search->count < search->max_dips) {
+        search->count++;
+    }
+}
+
+/**
+ * @brief Folds a closed (or dropped) dip's side into the open dip below it on the stack.
+ */
+static void fold_into(open_dip_t *below, const open_dip_t *gone)
+{
+    below->right_max = max_height(below->right_max, max_height(gone->value, gone->right_max));
+}
+
+/**
+ * @brief Makes room on a full stack by dropping the open dip with the least possible prominence.
+ */
+static void drop_least_prominent(open_dip_t *stack, size_t *depth)
+{
+    size_t least = 0;
+    for (size_t k = 1; k < *depth; ++k) {
+        if (stack[k].left_max - stack[k].value < stack[least].left_max - stack[least].value) {
+            least = k;
+        }
+    }
+    if (least > 0) {
+        fold_into(&stack[least - 1], &stack[least]);
+    }
+    memmove(&stack[least], &stack[least + 1], (*depth - least - 1) * sizeof(open_dip_t));
+    (*depth)--;
+}
+
+size_t dip_detect_find(const int16_t *cdb, uint16_t points, uint16_t min_prominence_cdb, dip_t *dips, size_t max_dips)
+{
+    dip_search_t search = {
+        .cdb = cdb,
+        .points = points,
+        .min_prominence_cdb = min_prominence_cdb,
+        .dips = dips,
+        .max_dips = (max_dips < DIP_DETECT_MAX) ? max_dips : DIP_DETECT_MAX,
+    };
+    if (search.max_dips == 0) {
+        return 0;
+    }
+    open_dip_t stack[DIP_DETECT_STACK_MAX];
+    size_t depth = 0;
+    int32_t seen_max = NO_HEIGHT;
+
+    for (uint16_t i = 0; i < points; ++i) {
+        const int32_t y = cdb[i];
+        // A lower point completes the right side of every open dip above it
+        while (depth > 0 && y < stack[depth - 1].value) {
+            const open_dip_t closed = stack[--depth];
+            close_dip(&search, &closed);
+            if (depth > 0) {
+                fold_into(&stack[depth - 1], &closed);
+            }
+        }
+        int32_t left_max = seen_max;
+        if (depth > 0) {
+            // An equally low dip does not bound the left side; it extends past it
+            const open_dip_t *top = &stack[depth - 1];
+            left_max = (top->value == y) ? max_height(top->left_max, top->right_max) : top->right_max;
+        }
+        const bool descending = (i > 0 && y < cdb[i - 1]);
+        if (descending && left_max != NO_HEIGHT && left_max - y > 0 && left_max - y >= min_prominence_cdb) {
+            if (depth == DIP_DETECT_STACK_MAX) {
+                drop_least_prominent(stack, &depth);
+            }
+            stack[depth++] = (open_dip_t){ .index = i, .value = y, .left_max = left_max, .right_max = NO_HEIGHT };
+        } else if (depth > 0) {
+            stack[depth - 1].right_max = max_height(stack[depth - 1].right_max, y);
+        }
+        seen_max = max_height(seen_max, y);
+    }
+    // Dips still open rise to the end of the sweep on their right
+    while (depth > 0) {
+        const open_dip_t closed = stack[--depth];
+        close_dip(&search, &closed);
+        if (depth > 0) {
+            fold_into(&stack[depth - 1], &closed);
+        }
+    }
+    return search.count;
+}
@@ -0,0 +1,49 @@
+// dip_detect.h
+// Finds the most prominent dips of a swept S11 curve in one pass. The sensor's ring
+// resonator shows its working dip next to higher-order and spurious ones, and the
+// deepest point of the sweep is not always the right one; reporting several dips lets
+// the app or the model pick the mode instead of asking for another sweep.
+//
+// A dip is a local minimum. Its prominence is how far S11 rises from it before the
+// curve reaches a lower point (or the end of the sweep), on the side where that rise is
+// smaller; dips at either end of the sweep have no prominence. Its width is measured at
+// half the prominence above the minimum, interpolated between points.
+//
+// The pass keeps a short stack of dips still open on their right side (nested dips,
+// each higher than the one below it) and no copy of the curve; widths are read back
+// from the curve once a dip closes. Minima that cannot reach the minimum prominence
+// on their left side are never opened, so noise on a slope costs nothing.
+#ifndef DIP_DETECT_H
+#define DIP_DETECT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DIP_DETECT_MAX        (3)     // Dips reported per sweep at most
+#define DIP_DETECT_STACK_MAX  (16)    // Open dips tracked; the least prominent is merged away beyond this
+
+typedef struct {
+    uint16_t index;               // Point of the minimum
+    int16_t s11_cdb;              // S11 at the minimum, centi-dB
+    uint16_t prominence_cdb;
+    float width_points;           // Width at half prominence
+} dip_t;
+
+/**
+ * @brief Finds the `max_dips` (up to DIP_DETECT_MAX) most prominent dips of `cdb` with at
+ * least `min_prominence_cdb` prominence.
+ * @param cdb    S11 per point in centi-dB, in frequency order
+ * @param dips   Set to the dips found, most prominent first
+ * @return number of dips written
+ */
+size_t dip_detect_find(const int16_t *cdb, uint16_t points, uint16_t min_prominence_cdb, dip_t *dips, size_t max_dips);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIP_DETECT_H
@@ -0,0 +1,154 @@
+#include <string.h>
+#include "fifo_framer.h"
+
+#define RECORD_LEN  NANOVNA_FIFO_RECORD_SIZE
+
+static uint16_t record_index(const uint8_t *record)
+{
+    return (uint16_t)(record[NANOVNA_FIFO_INDEX_OFFSET] | (record[NANOVNA_FIFO_INDEX_OFFSET + 1] << 8));
+}
+
+static void emit_record(fifo_framer_t *framer, const uint8_t *record, fifo_framer_emit_cb_t emit, void *arg)
+{
+    nanovna_fifo_point_t point;
+    nanovna_parse_fifo_record(record, &point);
+    framer->expected_index = (uint16_t)(point.freq_index + 1);
+    emit(&point, arg);
+}
+
+static void consume(fifo_framer_t *framer, size_t len)
+{
+    memmove(framer->buf, framer->buf + len, framer->len - len);
+    framer->len -= len;
+}
+
+/**
+ * @brief Looks for the first consistent record in buf: an index ahead in the window,
+ * followed by its successor.
+ * @return its offset, -1 if no offset in the scan range has one, or -2 if more bytes are
+ *         needed to decide
+ */
+static int find_record(const fifo_framer_t *framer)
+{
+    for (size_t p = 0; p < FIFO_FRAMER_SCAN_LEN; ++p) {
+        if (p + 2 * RECORD_LEN > framer->len) {
+            return -2;
+        }
+        const uint16_t index = record_index(framer->buf + p);
+        if (index >= framer->expected_index && index < framer->points &&
+            record_index(framer->buf + p + RECORD_LEN) == index + 1) {
+            return (int)p;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Emits the records held in buf, resynchronising where they stop following on.
+ */
+static size_t drain(fifo_framer_t *framer, fifo_framer_emit_cb_t emit, void *arg)
+{
+    size_t emitted = 0;
+    while (framer->len >= RECORD_LEN) {
+        if (framer->synced) {
+            if (record_index(framer->buf) == framer->expected_index) {
+                emit_record(framer, framer->buf, emit, arg);
+                consume(framer, RECORD_LEN);
+                emitted++;
+                continue;
+            }
+            framer->synced = false;
+        }
+        const int offset = find_record(framer);
+        if (offset == -2) {
+            break;
+        }
+        if (offset < 0) {
+            // Nothing consistent this far ahead: give up on a record's worth and keep looking
+            framer->discarded_bytes += RECORD_LEN;
+            consume(framer, RECORD_LEN);
+            continue;
+        }
+        framer->discarded_bytes += (uint32_t)offset;
+        consume(framer, (size_t)offset);
+        framer->expected_index = record_index(framer->buf);
+        framer->synced = true;
+        framer->resyncs++;
+    }
+    return emitted;
+}
+
+void fifo_framer_init(fifo_framer_t *framer)
+{
+    memset(framer, 0, sizeof(*framer));
+    framer->synced = true;
+}
+
+void fifo_framer_reset(fifo_framer_t *framer, uint16_t points)
+{
+    framer->points = points;
+    framer->expected_index = 0;
+    framer->synced = true;
+    framer->len = 0;
+}
+
+void fifo_framer_begin_read(fifo_framer_t *framer, uint16_t end_index)
+{
+    framer->end_index = end_index;
+    framer->synced = true;
+    framer->len = 0;
+}
+
+bool fifo_framer_reply_done(const fifo_framer_t *framer)
+{
+    return framer->expected_index >= framer->end_index;
+}
+
+size_t fifo_framer_feed(fifo_framer_t *framer, const uint8_t *data, size_t len,
+                        fifo_framer_emit_cb_t emit, void *arg)
+{
+    size_t emitted = 0;
+    while (len > 0) {
+        // Fast path: in-order records straight from the USB packet, no copy
+        if (framer->len == 0 && framer->synced) {
+            while (len >= RECORD_LEN && record_index(data) == framer->expected_index) {
+                emit_record(framer, data, emit, arg);
+                data += RECORD_LEN;
+                len -= RECORD_LEN;
+                emitted++;
+            }
+            if (len == 0) {
+                break;
+            }
+        }
+        size_t take = sizeof(framer->buf) - framer->len;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(framer->buf + framer->len, data, take);
+        framer->len += take;
+        data += take;
+        len -= take;
+        emitted += drain(framer, emit, arg); // Always leaves room in buf
+    }
+    return emitted;
+}
+
+size_t fifo_framer_finish(fifo_framer_t *framer, fifo_framer_emit_cb_t emit, void *arg)
+{
+    size_t emitted = 0;
+    if (!framer->synced && framer->len >= RECORD_LEN && framer->len - RECORD_LEN < FIFO_FRAMER_SCAN_LEN) {
+        const uint8_t *last = framer->buf + framer->len - RECORD_LEN;
+        const uint16_t index = record_index(last);
+        if (index >= framer->expected_index && index < framer->points) {
+            framer->discarded_bytes += (uint32_t)(framer->len - RECORD_LEN);
+            framer->resyncs++;
+            emit_record(framer, last, emit, arg);
+            framer->len = 0;
+            emitted = 1;
+        }
+    }
+    framer->discarded_bytes += (uint32_t)framer->len;
+    framer->len = 0;
+    return emitted;
+}
@@ -0,0 +1,84 @@
+// fifo_framer.h
+// Frames READFIFO reply bytes into records, checking every record's freqIndex
+// against sweep order and recovering alignment after a lost or extra byte.
+//
+// After a FIFO clear the NanoVNA sends a sweep's records in freqIndex order from 0,
+// so a record is accepted only if it carries the next expected index. A mismatch
+// means the byte stream slipped (a USB byte lost or duplicated) or the record is
+// corrupt. The framer then tries each of the next FIFO_FRAMER_SCAN_LEN byte offsets
+// for a record whose index lies ahead in the window and is followed by its successor,
+// and resumes there. Skipped indices are never emitted; the caller sees them as gaps
+// in the points it received and re-reads only those.
+#ifndef FIFO_FRAMER_H
+#define FIFO_FRAMER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "nanovna_proto.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Offsets tried when resynchronising: slips of up to a record in either direction
+#define FIFO_FRAMER_SCAN_LEN  (2 * NANOVNA_FIFO_RECORD_SIZE)
+// A candidate at the last offset is confirmed by the record after it
+#define FIFO_FRAMER_BUF_LEN   (FIFO_FRAMER_SCAN_LEN + 2 * NANOVNA_FIFO_RECORD_SIZE)
+
+typedef struct {
+    uint16_t points;           // freqIndex range of the programmed window
+    uint16_t expected_index;   // freqIndex the next record should carry
+    uint16_t end_index;        // freqIndex after the last record of the reply being read
+    bool synced;               // False from a mismatch until a consistent record is found
+    size_t len;                // Bytes held in buf
+    uint8_t buf[FIFO_FRAMER_BUF_LEN]; // Partial record, or the bytes being scanned
+    uint32_t resyncs;          // Alignment recoveries since init
+    uint32_t discarded_bytes;  // Bytes skipped while resynchronising since init
+} fifo_framer_t;
+
+typedef void (*fifo_framer_emit_cb_t)(const nanovna_fifo_point_t *point, void *arg);
+
+/**
+ * @brief Clears the framer and its counters.
+ */
+void fifo_framer_init(fifo_framer_t *framer);
+
+/**
+ * @brief The FIFO was cleared with a `points` window programmed: the next record is index 0.
+ */
+void fifo_framer_reset(fifo_framer_t *framer, uint16_t points);
+
+/**
+ * @brief A READFIFO is about to be sent: bytes left from an earlier reply are dropped and
+ * the reply is taken to start on a record boundary. The expected index carries over.
+ * @param end_index freqIndex after the last record the reply carries
+ */
+void fifo_framer_begin_read(fifo_framer_t *framer, uint16_t end_index);
+
+/**
+ * @brief True once the reply's last record has been emitted. A reply that lost a byte
+ * is done here, one byte short of its length (the caller checks that no more than a
+ * partial record is still due).
+ */
+bool fifo_framer_reply_done(const fifo_framer_t *framer);
+
+/**
+ * @brief Frames `len` reply bytes, calling `emit` for every record accepted, in order.
+ * @return number of points emitted
+ */
+size_t fifo_framer_feed(fifo_framer_t *framer, const uint8_t *data, size_t len,
+                        fifo_framer_emit_cb_t emit, void *arg);
+
+/**
+ * @brief The reply is complete. While resynchronising, a record ending exactly at the end
+ * of the reply is accepted without a successor to confirm it; anything else held is dropped.
+ * @return number of points emitted (0 or 1)
+ */
+size_t fifo_framer_finish(fifo_framer_t *framer, fifo_framer_emit_cb_t emit, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FIFO_FRAMER_H
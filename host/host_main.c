@@ -0,0 +1,180 @@
+// host_main.c
+// Runs the firmware (usb_cdc.c) as a Linux process: the NanoVNA is simulated by
+// sim/nanovna_sim.c and BLE clients connect over TCP (port/nimble_sock.c).
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+#include "host_port.h"
+#include "nanovna_sim.h"
+
+void app_main(void);
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --port N               TCP port for BLE clients (default 7878)\n"
+            "  --conn-interval-ms N   BLE connection interval (default 30)\n"
+            "  --pkts-per-interval N  notifications per connection event (default 4)\n"
+            "  --mbufs N              notification mbuf pool size (default 12)\n"
+            "  --max-mtu N            largest MTU a client may negotiate (default 527)\n"
+            "  --usb-packet-size N    bytes per CDC data callback (default 64)\n"
+            "  --usb-glitch-ms N      unplug the NanoVNA briefly every N ms (default: never)\n"
+            "  --usb-byte-errors N    drop or repeat a byte in every Nth FIFO reply (default: never)\n"
+            "  --usb-lost-replies N   lose every Nth FIFO reply (default: never)\n"
+            "  --usb-transfer-us N    host turnaround per USB IN transfer (default 0)\n"
+            "  --flash-file PATH      keep the flash partitions in PATH across runs (default: in memory)\n"
+            "  --curve PATH           S11 curve CSV (default V2_Perm_Processed.csv)\n"
+            "  --synthetic            use a synthetic dip instead of a curve file\n"
+            "  --perm X               permittivity column of the curve (default 56)\n"
+            "  --shift-ghz X          frequency shift applied to the curve (default 0.75)\n"
+            "  --noise-db X           S11 noise std deviation in dB at 10 values per point (default 0.05)\n"
+            "  --spur-ghz X           add a narrow spurious dip at X GHz (with --spur-db)\n"
+            "  --spur-db X            depth of the spurious dip in dB (default -20)\n"
+            "  --latency-us N         NanoVNA reply latency (default 1000)\n"
+            "  --point-us N           NanoVNA time per FIFO record at 10 values per point (default 50)\n"
+            "  --seed N               noise seed (default 1)\n"
+            "  --fixture              add fixture error terms (directivity, source match, tracking);\n"
+            "                         SIGUSR1 cycles the load: sensor, open, short, match\n"
+            "  --log-level L          none|error|warn|info|debug|verbose (default info)\n"
+            "  --duration-s N         exit after N seconds (default: run until killed)\n",
+            prog);
+}
+
+static void cycle_load(int sig)
+{
+    static const char *const names[NANOVNA_SIM_LOAD_COUNT] = {
+        "nanovna_sim: sensor attached\n", "nanovna_sim: open attached\n",
+        "nanovna_sim: short attached\n", "nanovna_sim: match attached\n",
+    };
+    (void)sig;
+    const nanovna_sim_load_t load = (nanovna_sim_load_t)((nanovna_sim_get_load() + 1) % NANOVNA_SIM_LOAD_COUNT);
+    nanovna_sim_set_load(load);
+    ssize_t written = write(STDERR_FILENO, names[load], strlen(names[load]));
+    (void)written;
+}
+
+static esp_log_level_t parse_log_level(const char *name)
+{
+    static const char *const names[] = { "none", "error", "warn", "info", "debug", "verbose" };
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+        if (strcmp(name, names[i]) == 0) {
+            return (esp_log_level_t)i;
+        }
+    }
+    return ESP_LOG_INFO;
+}
+
+int main(int argc, char **argv)
+{
+    enum {
+        OPT_PORT = 256, OPT_INTERVAL, OPT_PKTS, OPT_MBUFS, OPT_MAX_MTU, OPT_USB_PACKET, OPT_USB_GLITCH,
+        OPT_USB_BYTE_ERRORS, OPT_USB_LOST_REPLIES, OPT_USB_TRANSFER, OPT_FLASH_FILE, OPT_CURVE, OPT_SYNTHETIC, OPT_PERM,
+        OPT_SHIFT, OPT_NOISE, OPT_SPUR_GHZ, OPT_SPUR_DB, OPT_LATENCY, OPT_POINT, OPT_SEED, OPT_FIXTURE, OPT_LOG_LEVEL, OPT_DURATION,
+    };
+    static const struct option options[] = {
+        { "port",              required_argument, NULL, OPT_PORT },
+        { "conn-interval-ms",  required_argument, NULL, OPT_INTERVAL },
+        { "pkts-per-interval", required_argument, NULL, OPT_PKTS },
+        { "mbufs",             required_argument, NULL, OPT_MBUFS },
+        { "max-mtu",           required_argument, NULL, OPT_MAX_MTU },
+        { "usb-packet-size",   required_argument, NULL, OPT_USB_PACKET },
+        { "usb-glitch-ms",     required_argument, NULL, OPT_USB_GLITCH },
+        { "usb-byte-errors",   required_argument, NULL, OPT_USB_BYTE_ERRORS },
+        { "usb-lost-replies",  required_argument, NULL, OPT_USB_LOST_REPLIES },
+        { "usb-transfer-us",   required_argument, NULL, OPT_USB_TRANSFER },
+        { "flash-file",        required_argument, NULL, OPT_FLASH_FILE },
+        { "curve",             required_argument, NULL, OPT_CURVE },
+        { "synthetic",         no_argument,       NULL, OPT_SYNTHETIC },
+        { "perm",              required_argument, NULL, OPT_PERM },
+        { "shift-ghz",         required_argument, NULL, OPT_SHIFT },
+        { "noise-db",          required_argument, NULL, OPT_NOISE },
+        { "spur-ghz",          required_argument, NULL, OPT_SPUR_GHZ },
+        { "spur-db",           required_argument, NULL, OPT_SPUR_DB },
+        { "latency-us",        required_argument, NULL, OPT_LATENCY },
+        { "point-us",          required_argument, NULL, OPT_POINT },
+        { "seed",              required_argument, NULL, OPT_SEED },
+        { "fixture",           no_argument,       NULL, OPT_FIXTURE },
+        { "log-level",         required_argument, NULL, OPT_LOG_LEVEL },
+        { "duration-s",        required_argument, NULL, OPT_DURATION },
+        { "help",              no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    nimble_sock_config_t ble_config;
+    nimble_sock_default_config(&ble_config);
+    nanovna_sim_config_t vna_config;
+    nanovna_sim_default_config(&vna_config);
+    size_t usb_packet_size = 64;
+    uint32_t usb_glitch_ms = 0;
+    uint32_t usb_byte_errors = 0;
+    uint32_t usb_lost_replies = 0;
+    uint32_t usb_transfer_us = 0;
+    const char *flash_path = NULL;
+    unsigned duration_s = 0;
+    bool spur_set = false;
+    double spur_db = -20.0;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+        switch (opt) {
+        case OPT_PORT:        ble_config.tcp_port = (uint16_t)atoi(optarg); break;
+        case OPT_INTERVAL:    ble_config.conn_interval_ms = (uint32_t)atoi(optarg); break;
+        case OPT_PKTS:        ble_config.pkts_per_interval = (uint32_t)atoi(optarg); break;
+        case OPT_MBUFS:       ble_config.msys_mbufs = (uint32_t)atoi(optarg); break;
+        case OPT_MAX_MTU:     ble_config.max_client_mtu = (uint16_t)atoi(optarg); break;
+        case OPT_USB_PACKET:  usb_packet_size = (size_t)atoi(optarg); break;
+        case OPT_USB_GLITCH:  usb_glitch_ms = (uint32_t)atoi(optarg); break;
+        case OPT_USB_BYTE_ERRORS: usb_byte_errors = (uint32_t)atoi(optarg); break;
+        case OPT_USB_LOST_REPLIES: usb_lost_replies = (uint32_t)atoi(optarg); break;
+        case OPT_USB_TRANSFER: usb_transfer_us = (uint32_t)atoi(optarg); break;
+        case OPT_FLASH_FILE:  flash_path = optarg; break;
+        case OPT_CURVE:       vna_config.curve_path = optarg; break;
+        case OPT_SYNTHETIC:   vna_config.curve_path = NULL; break;
+        case OPT_PERM:        vna_config.permittivity = atof(optarg); break;
+        case OPT_SHIFT:       vna_config.shift_ghz = atof(optarg); break;
+        case OPT_NOISE:       vna_config.noise_db = atof(optarg); break;
+        case OPT_SPUR_GHZ:    vna_config.spur_ghz = atof(optarg); spur_set = true; break;
+        case OPT_SPUR_DB:     spur_db = atof(optarg); break;
+        case OPT_LATENCY:     vna_config.latency_us = (uint32_t)atoi(optarg); break;
+        case OPT_POINT:       vna_config.point_us = (uint32_t)atoi(optarg); break;
+        case OPT_SEED:        vna_config.seed = (uint32_t)atoi(optarg); break;
+        case OPT_FIXTURE:     vna_config.fixture = true; break;
+        case OPT_LOG_LEVEL:   esp_log_level_set("*", parse_log_level(optarg)); break;
+        case OPT_DURATION:    duration_s = (unsigned)atoi(optarg); break;
+        default:
+            usage(argv[0]);
+            return (opt == 'h') ? 0 : 2;
+        }
+    }
+    if (ble_config.conn_interval_ms == 0 || ble_config.pkts_per_interval == 0) {
+        fprintf(stderr, "Connection interval and packets per interval must be non-zero\n");
+        return 2;
+    }
+    if (spur_set) {
+        vna_config.spur_db = spur_db;
+    }
+
+    nanovna_sim_init(&vna_config);
+    signal(SIGUSR1, cycle_load);
+    usb_cdc_sim_configure(usb_packet_size, usb_glitch_ms, usb_byte_errors, usb_lost_replies, usb_transfer_us);
+    nimble_sock_configure(&ble_config);
+    esp_partition_sim_configure(flash_path);
+
+    app_main();
+
+    if (duration_s) {
+        while ((duration_s = sleep(duration_s)) > 0) {
+            // Interrupted by SIGUSR1: sleep out the rest
+        }
+        return 0;
+    }
+    while (true) {
+        pause();
+    }
+}
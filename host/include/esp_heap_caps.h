@@ -0,0 +1,11 @@
+// Host build: capability-based allocation from the process heap (see port/esp_port.c).
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT     (1u << 2)
+#define MALLOC_CAP_SPIRAM   (1u << 10)
+#define MALLOC_CAP_INTERNAL (1u << 11)
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
@@ -0,0 +1,6 @@
+// Host build: minimal stand-in for the ESP-IDF header of the same name.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
@@ -0,0 +1,5 @@
+// Host build: microseconds since process start (CLOCK_MONOTONIC).
+#pragma once
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
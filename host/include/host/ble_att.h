@@ -0,0 +1,9 @@
+#pragma once
+#include <stdint.h>
+
+#define BLE_ATT_MTU_DFLT 23
+#define BLE_ATT_MTU_MAX  527
+
+int ble_att_set_preferred_mtu(uint16_t mtu);
+uint16_t ble_att_preferred_mtu(void);
+uint16_t ble_att_mtu(uint16_t conn_handle);
@@ -0,0 +1,170 @@
+// Host build: the subset of the NimBLE host API used by the firmware.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+#include "os/os_mbuf.h"
+#include "host/ble_att.h"
+
+// --- UUIDs ---
+#define BLE_UUID_TYPE_16  16
+#define BLE_UUID_TYPE_128 128
+
+typedef struct { uint8_t type; } ble_uuid_t;
+typedef struct { ble_uuid_t u; uint16_t value; } ble_uuid16_t;
+typedef struct { ble_uuid_t u; uint8_t value[16]; } ble_uuid128_t;
+
+#define BLE_UUID128_INIT(uuid128...) { .u = { .type = BLE_UUID_TYPE_128 }, .value = { uuid128 } }
+
+// --- Error codes ---
+#define BLE_HS_EAGAIN       1
+#define BLE_HS_EALREADY     2
+#define BLE_HS_EINVAL       3
+#define BLE_HS_EMSGSIZE     4
+#define BLE_HS_ENOENT       5
+#define BLE_HS_ENOMEM       6
+#define BLE_HS_ENOTCONN     7
+#define BLE_HS_EBUSY        15
+#define BLE_HS_ERR_HCI_BASE 0x200
+#define BLE_ERR_REM_USER_CONN_TERM  0x13
+#define BLE_ERR_CONN_TERM_LOCAL     0x16
+
+#define BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN 0x0d
+#define BLE_ATT_ERR_UNLIKELY               0x0e
+#define BLE_ATT_ERR_INSUFFICIENT_RES       0x11
+#define BLE_ATT_ERR_VALUE_NOT_ALLOWED      0x13
+
+#define BLE_HS_CONN_HANDLE_NONE 0xffff
+#define BLE_HS_FOREVER          INT32_MAX
+#define BLE_HS_IO_NO_INPUT_OUTPUT 3
+
+// --- GATT server ---
+#define BLE_GATT_ACCESS_OP_READ_CHR   0
+#define BLE_GATT_ACCESS_OP_WRITE_CHR  1
+
+#define BLE_GATT_CHR_F_READ          0x0002
+#define BLE_GATT_CHR_F_WRITE_NO_RSP  0x0004
+#define BLE_GATT_CHR_F_WRITE         0x0008
+#define BLE_GATT_CHR_F_NOTIFY        0x0010
+
+#define BLE_GATT_SVC_TYPE_PRIMARY    1
+
+struct ble_gatt_access_ctxt {
+    uint8_t op;
+    struct os_mbuf *om;
+};
+
+typedef int ble_gatt_access_fn(uint16_t conn_handle, uint16_t attr_handle,
+                               struct ble_gatt_access_ctxt *ctxt, void *arg);
+
+struct ble_gatt_chr_def {
+    const ble_uuid_t *uuid;
+    ble_gatt_access_fn *access_cb;
+    void *arg;
+    uint16_t flags;
+    uint16_t *val_handle;
+};
+
+struct ble_gatt_svc_def {
+    uint8_t type;
+    const ble_uuid_t *uuid;
+    const struct ble_gatt_chr_def *characteristics;
+};
+
+struct ble_gatt_error {
+    uint16_t status;
+    uint16_t att_handle;
+};
+
+int ble_gatts_count_cfg(const struct ble_gatt_svc_def *defs);
+int ble_gatts_add_svcs(const struct ble_gatt_svc_def *svcs);
+int ble_gatts_notify_custom(uint16_t conn_handle, uint16_t chr_val_handle, struct os_mbuf *om);
+int ble_gattc_exchange_mtu(uint16_t conn_handle,
+                           int (*cb)(uint16_t conn_handle, const struct ble_gatt_error *error,
+                                     uint16_t mtu, void *arg),
+                           void *cb_arg);
+
+// --- GAP ---
+#define BLE_GAP_EVENT_CONNECT        0
+#define BLE_GAP_EVENT_DISCONNECT     1
+#define BLE_GAP_EVENT_CONN_UPDATE    3
+#define BLE_GAP_EVENT_ADV_COMPLETE   9
+#define BLE_GAP_EVENT_NOTIFY_TX      13
+#define BLE_GAP_EVENT_SUBSCRIBE      14
+#define BLE_GAP_EVENT_MTU            15
+
+#define BLE_GAP_CONN_MODE_UND        2
+#define BLE_GAP_DISC_MODE_GEN        2
+#define BLE_OWN_ADDR_PUBLIC          0
+
+struct ble_gap_conn_desc {
+    uint16_t conn_handle;
+    uint16_t conn_itvl;
+    uint16_t conn_latency;
+    uint16_t supervision_timeout;
+};
+
+struct ble_gap_upd_params {
+    uint16_t itvl_min;
+    uint16_t itvl_max;
+    uint16_t latency;
+    uint16_t supervision_timeout;
+    uint16_t min_ce_len;
+    uint16_t max_ce_len;
+};
+
+struct ble_gap_adv_params {
+    uint8_t conn_mode;
+    uint8_t disc_mode;
+    uint16_t itvl_min;
+    uint16_t itvl_max;
+    uint8_t channel_map;
+    uint8_t filter_policy;
+    uint8_t high_duty_cycle;
+};
+
+struct ble_gap_event {
+    uint8_t type;
+    union {
+        struct { int status; uint16_t conn_handle; } connect;
+        struct { int reason; struct ble_gap_conn_desc conn; } disconnect;
+        struct { int status; uint16_t conn_handle; } conn_update;
+        struct { int reason; } adv_complete;
+        struct { int status; uint16_t conn_handle; uint16_t attr_handle; uint8_t indication:1; } notify_tx;
+        struct {
+            uint16_t conn_handle;
+            uint16_t attr_handle;
+            uint8_t reason;
+            uint8_t prev_notify:1;
+            uint8_t cur_notify:1;
+            uint8_t prev_indicate:1;
+            uint8_t cur_indicate:1;
+        } subscribe;
+        struct { uint16_t conn_handle; uint16_t channel_id; uint16_t value; } mtu;
+    };
+};
+
+typedef int ble_gap_event_fn(struct ble_gap_event *event, void *arg);
+
+int ble_gap_adv_start(uint8_t own_addr_type, const void *direct_addr, int32_t duration_ms,
+                      const struct ble_gap_adv_params *adv_params, ble_gap_event_fn *cb, void *cb_arg);
+int ble_gap_adv_stop(void);
+int ble_gap_adv_active(void);
+int ble_gap_conn_find(uint16_t handle, struct ble_gap_conn_desc *out_desc);
+int ble_gap_update_params(uint16_t conn_handle, const struct ble_gap_upd_params *params);
+int ble_gap_terminate(uint16_t conn_handle, uint8_t hci_reason);
+
+// --- Host configuration ---
+struct ble_hs_cfg {
+    void (*sync_cb)(void);
+    void (*reset_cb)(int reason);
+    uint8_t sm_io_cap;
+    unsigned sm_bonding:1;
+    unsigned sm_mitm:1;
+    unsigned sm_sc:1;
+};
+extern struct ble_hs_cfg ble_hs_cfg;
+
+// --- mbuf helpers ---
+struct os_mbuf *ble_hs_mbuf_from_flat(const void *buf, uint16_t len);
+int ble_hs_mbuf_to_flat(const struct os_mbuf *om, void *flat, uint16_t max_len, uint16_t *out_copy_len);
@@ -0,0 +1,7 @@
+// Host build: NimBLE port entry points; the "controller" is a local TCP socket (port/nimble_sock.c).
+#pragma once
+#include "esp_err.h"
+
+esp_err_t nimble_port_init(void);
+void nimble_port_run(void);
+int nimble_port_stop(void);
@@ -0,0 +1,4 @@
+#pragma once
+
+void nimble_port_freertos_init(void (*host_task_fn)(void *));
+void nimble_port_freertos_deinit(void);
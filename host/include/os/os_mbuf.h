@@ -0,0 +1,17 @@
+// Host build: mbufs are single flat buffers drawn from a fixed-size "msys" pool,
+// so notification backpressure behaves like the real stack.
+#pragma once
+#include <stdint.h>
+
+struct os_mbuf {
+    uint16_t om_len;
+    uint16_t om_cap;
+    uint8_t *om_data;
+    uint8_t om_from_msys;   // Counts against os_msys_num_free() until freed
+};
+
+#define OS_MBUF_PKTLEN(om) ((om)->om_len)
+
+int os_mbuf_append(struct os_mbuf *om, const void *data, uint16_t len);
+int os_mbuf_free_chain(struct os_mbuf *om);
+int os_msys_num_free(void);
@@ -0,0 +1,50 @@
+// Host build: CDC-ACM host driver API, backed by the simulated NanoVNA V2 (port/usb_cdc_sim.c).
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef struct cdc_dev_s *cdc_acm_dev_hdl_t;
+
+typedef enum {
+    CDC_ACM_HOST_ERROR,
+    CDC_ACM_HOST_SERIAL_STATE,
+    CDC_ACM_HOST_NETWORK_CONNECTION,
+    CDC_ACM_HOST_DEVICE_DISCONNECTED,
+} cdc_acm_host_dev_event_t;
+
+typedef struct {
+    cdc_acm_host_dev_event_t type;
+    union {
+        int error;
+        cdc_acm_dev_hdl_t cdc_hdl;
+    } data;
+} cdc_acm_host_dev_event_data_t;
+
+typedef bool (*cdc_acm_data_callback_t)(const uint8_t *data, size_t data_len, void *user_arg);
+typedef void (*cdc_acm_host_dev_callback_t)(const cdc_acm_host_dev_event_data_t *event, void *user_ctx);
+
+typedef struct {
+    uint32_t connection_timeout_ms;
+    size_t out_buffer_size;
+    size_t in_buffer_size;
+    cdc_acm_host_dev_callback_t event_cb;
+    cdc_acm_data_callback_t data_cb;
+    void *user_arg;
+} cdc_acm_host_device_config_t;
+
+typedef struct {
+    size_t driver_task_stack_size;
+    unsigned driver_task_priority;
+    int xCoreID;                 // Core of the driver task, which runs the data and event callbacks
+    void (*new_dev_cb)(void *usb_dev);
+} cdc_acm_host_driver_config_t;
+
+esp_err_t cdc_acm_host_install(const cdc_acm_host_driver_config_t *driver_config);
+esp_err_t cdc_acm_host_open(uint16_t vid, uint16_t pid, uint8_t interface_idx,
+                            const cdc_acm_host_device_config_t *dev_config, cdc_acm_dev_hdl_t *cdc_hdl_ret);
+esp_err_t cdc_acm_host_close(cdc_acm_dev_hdl_t cdc_hdl);
+esp_err_t cdc_acm_host_data_tx_blocking(cdc_acm_dev_hdl_t cdc_hdl, const uint8_t *data, size_t data_len,
+                                        uint32_t timeout_ms);
+esp_err_t cdc_acm_host_set_control_line_state(cdc_acm_dev_hdl_t cdc_hdl, bool dtr, bool rts);
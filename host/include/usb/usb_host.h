@@ -0,0 +1,16 @@
+// Host build: USB Host Library entry points; there is no real bus.
+#pragma once
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct {
+    bool skip_phy_setup;
+    int intr_flags;
+} usb_host_config_t;
+
+#define USB_HOST_LIB_EVENT_FLAGS_NO_CLIENTS  0x01
+#define USB_HOST_LIB_EVENT_FLAGS_ALL_FREE    0x02
+
+esp_err_t usb_host_install(const usb_host_config_t *config);
+esp_err_t usb_host_lib_handle_events(uint32_t timeout_ticks, uint32_t *event_flags_ret);
+esp_err_t usb_host_device_free_all(void);
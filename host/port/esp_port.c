@@ -0,0 +1,496 @@
+// ESP-IDF logging, error names, an in-memory NVS and flash partitions for the host build.
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+#include "esp_partition.h"
+#include "esp_pm.h"
+#include "esp_heap_caps.h"
+
+// =========================================================================
+// == Logging                                                             ==
+// =========================================================================
+
+#define LOG_MAX_TAG_LEVELS 16
+
+typedef struct {
+    char tag[32];
+    esp_log_level_t level;
+} tag_level_t;
+
+static pthread_mutex_t log_mutex = PTHREAD_MUTEX_INITIALIZER;
+static esp_log_level_t default_log_level = ESP_LOG_INFO;
+static tag_level_t tag_levels[LOG_MAX_TAG_LEVELS];
+static int tag_level_count = 0;
+
+void esp_log_level_set(const char *tag, esp_log_level_t level)
+{
+    pthread_mutex_lock(&log_mutex);
+    if (strcmp(tag, "*") == 0) {
+        default_log_level = level;
+        tag_level_count = 0;
+    } else {
+        int i;
+        for (i = 0; i < tag_level_count && strcmp(tag_levels[i].tag, tag) != 0; i++) {
+        }
+        if (i < LOG_MAX_TAG_LEVELS) {
+            snprintf(tag_levels[i].tag, sizeof(tag_levels[i].tag), "%s", tag);
+            tag_levels[i].level = level;
+            if (i == tag_level_count) {
+                tag_level_count++;
+            }
+        }
+    }
+    pthread_mutex_unlock(&log_mutex);
+}
+
+static esp_log_level_t level_for_tag(const char *tag)
+{
+    for (int i = 0; i < tag_level_count; i++) {
+        if (strcmp(tag_levels[i].tag, tag) == 0) {
+            return tag_levels[i].level;
+        }
+    }
+    return default_log_level;
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    static const char letters[] = "-EWIDV";
+
+    pthread_mutex_lock(&log_mutex);
+    if (level <= level_for_tag(tag)) {
+        fprintf(stdout, "%c (%lld) %s: ", letters[level], (long long)(esp_timer_get_time() / 1000), tag);
+        va_list args;
+        va_start(args, format);
+        vfprintf(stdout, format, args);
+        va_end(args);
+        fputc('\n', stdout);
+        fflush(stdout);
+    }
+    pthread_mutex_unlock(&log_mutex);
+}
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK:                        return "ESP_OK";
+    case ESP_FAIL:                      return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:                return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:           return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:         return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:          return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:             return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:         return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:               return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_INVALID_RESPONSE:      return "ESP_ERR_INVALID_RESPONSE";
+    case ESP_ERR_INVALID_CRC:           return "ESP_ERR_INVALID_CRC";
+    case ESP_ERR_INVALID_VERSION:       return "ESP_ERR_INVALID_VERSION";
+    case ESP_ERR_NVS_NOT_INITIALIZED:   return "ESP_ERR_NVS_NOT_INITIALIZED";
+    case ESP_ERR_NVS_NOT_FOUND:         return "ESP_ERR_NVS_NOT_FOUND";
+    case ESP_ERR_NVS_NO_FREE_PAGES:     return "ESP_ERR_NVS_NO_FREE_PAGES";
+    case ESP_ERR_NVS_NEW_VERSION_FOUND: return "ESP_ERR_NVS_NEW_VERSION_FOUND";
+    default:                            return "UNKNOWN ERROR";
+    }
+}
+
+// =========================================================================
+// == NVS                                                                 ==
+// =========================================================================
+// Entries live for the lifetime of the process, keyed by namespace + key.
+// Typed getters only match values stored with the same type, as on the device.
+
+#define NVS_MAX_NAMESPACES 8
+#define NVS_KEY_NAME_MAX   16
+
+typedef enum {
+    NVS_ENTRY_U8,
+    NVS_ENTRY_U32,
+    NVS_ENTRY_BLOB,
+} nvs_entry_type_t;
+
+typedef struct nvs_entry {
+    struct nvs_entry *next;
+    nvs_handle_t ns;
+    nvs_entry_type_t type;
+    char key[NVS_KEY_NAME_MAX];
+    size_t length;
+    uint8_t data[];
+} nvs_entry_t;
+
+static pthread_mutex_t nvs_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool nvs_initialised = false;
+static char nvs_namespaces[NVS_MAX_NAMESPACES][NVS_KEY_NAME_MAX];
+static int nvs_namespace_count = 0;
+static nvs_entry_t *nvs_entries = NULL;
+
+esp_err_t nvs_flash_init(void)
+{
+    nvs_initialised = true;
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void)
+{
+    pthread_mutex_lock(&nvs_mutex);
+    while (nvs_entries) {
+        nvs_entry_t *next = nvs_entries->next;
+        free(nvs_entries);
+        nvs_entries = next;
+    }
+    pthread_mutex_unlock(&nvs_mutex);
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char *namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    (void)open_mode;
+    if (!nvs_initialised) {
+        return ESP_ERR_NVS_NOT_INITIALIZED;
+    }
+    if (strlen(namespace_name) >= NVS_KEY_NAME_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&nvs_mutex);
+    int i;
+    for (i = 0; i < nvs_namespace_count && strcmp(nvs_namespaces[i], namespace_name) != 0; i++) {
+    }
+    if (i == nvs_namespace_count) {
+        if (i == NVS_MAX_NAMESPACES) {
+            err = ESP_ERR_NVS_NO_FREE_PAGES;
+        } else {
+            strcpy(nvs_namespaces[i], namespace_name);
+            nvs_namespace_count++;
+        }
+    }
+    pthread_mutex_unlock(&nvs_mutex);
+    *out_handle = (nvs_handle_t)(i + 1);
+    return err;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    (void)handle;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    (void)handle;
+    return ESP_OK;
+}
+
+static nvs_entry_t **find_entry(nvs_handle_t handle, const char *key)
+{
+    nvs_entry_t **link = &nvs_entries;
+    while (*link && ((*link)->ns != handle || strcmp((*link)->key, key) != 0)) {
+        link = &(*link)->next;
+    }
+    return link;
+}
+
+static esp_err_t set_entry(nvs_handle_t handle, const char *key, nvs_entry_type_t type,
+                           const void *value, size_t length)
+{
+    if (strlen(key) >= NVS_KEY_NAME_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    nvs_entry_t *entry = malloc(sizeof(*entry) + length);
+    if (entry == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    entry->ns = handle;
+    entry->type = type;
+    strcpy(entry->key, key);
+    entry->length = length;
+    memcpy(entry->data, value, length);
+
+    pthread_mutex_lock(&nvs_mutex);
+    nvs_entry_t **link = find_entry(handle, key);
+    if (*link) {
+        nvs_entry_t *old = *link;
+        *link = old->next;
+        free(old);
+    }
+    entry->next = nvs_entries;
+    nvs_entries = entry;
+    pthread_mutex_unlock(&nvs_mutex);
+    return ESP_OK;
+}
+
+/**
+ * @brief Copies a stored value out. With `out_value` NULL only the length is reported.
+ */
+static esp_err_t get_entry(nvs_handle_t handle, const char *key, nvs_entry_type_t type,
+                           void *out_value, size_t *length)
+{
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&nvs_mutex);
+    nvs_entry_t *entry = *find_entry(handle, key);
+    if (entry == NULL || entry->type != type) {
+        err = ESP_ERR_NVS_NOT_FOUND;
+    } else if (out_value == NULL) {
+        *length = entry->length;
+    } else if (*length < entry->length) {
+        err = ESP_ERR_INVALID_SIZE;
+    } else {
+        memcpy(out_value, entry->data, entry->length);
+        *length = entry->length;
+    }
+    pthread_mutex_unlock(&nvs_mutex);
+    return err;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key)
+{
+    esp_err_t err = ESP_ERR_NVS_NOT_FOUND;
+    pthread_mutex_lock(&nvs_mutex);
+    nvs_entry_t **link = find_entry(handle, key);
+    if (*link) {
+        nvs_entry_t *old = *link;
+        *link = old->next;
+        free(old);
+        err = ESP_OK;
+    }
+    pthread_mutex_unlock(&nvs_mutex);
+    return err;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    return set_entry(handle, key, NVS_ENTRY_BLOB, value, length);
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    return get_entry(handle, key, NVS_ENTRY_BLOB, out_value, length);
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char *key, uint8_t value)
+{
+    return set_entry(handle, key, NVS_ENTRY_U8, &value, sizeof(value));
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char *key, uint8_t *out_value)
+{
+    size_t length = sizeof(*out_value);
+    return get_entry(handle, key, NVS_ENTRY_U8, out_value, &length);
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value)
+{
+    return set_entry(handle, key, NVS_ENTRY_U32, &value, sizeof(value));
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out_value)
+{
+    size_t length = sizeof(*out_value);
+    return get_entry(handle, key, NVS_ENTRY_U32, out_value, &length);
+}
+
+// =========================================================================
+// == Flash Partitions                                                    ==
+// =========================================================================
+// One data partition, "journal", as in the device partition table. Writes can only
+// clear bits and erases set whole sectors to 0xFF, as on NOR flash. With a backing
+// file (--flash-file) its contents survive restarts.
+
+#define FLASH_SECTOR_SIZE      4096
+#define JOURNAL_PARTITION_SIZE (256 * 1024)
+
+static const esp_partition_t journal_partition = {
+    .type = ESP_PARTITION_TYPE_DATA,
+    .subtype = (esp_partition_subtype_t)0x40,
+    .address = 0x110000,
+    .size = JOURNAL_PARTITION_SIZE,
+    .erase_size = FLASH_SECTOR_SIZE,
+    .label = "journal",
+};
+
+static pthread_mutex_t flash_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t journal_flash[JOURNAL_PARTITION_SIZE];
+static FILE *journal_flash_file = NULL;
+
+void esp_partition_sim_configure(const char *flash_path)
+{
+    memset(journal_flash, 0xFF, sizeof(journal_flash));
+    if (flash_path == NULL) {
+        return;
+    }
+    journal_flash_file = fopen(flash_path, "r+b");
+    if (journal_flash_file == NULL) {
+        journal_flash_file = fopen(flash_path, "w+b");
+    }
+    if (journal_flash_file == NULL) {
+        fprintf(stderr, "Cannot open flash file %s; the journal is not kept\n", flash_path);
+        return;
+    }
+    size_t n = fread(journal_flash, 1, sizeof(journal_flash), journal_flash_file);
+    if (n < sizeof(journal_flash)) {
+        memset(journal_flash + n, 0xFF, sizeof(journal_flash) - n); // New or short file: rest is erased
+    }
+}
+
+/**
+ * @brief Writes [offset, offset + size) of the partition through to the backing file.
+ */
+static void flash_file_sync(size_t offset, size_t size)
+{
+    if (journal_flash_file == NULL) {
+        return;
+    }
+    fseek(journal_flash_file, (long)offset, SEEK_SET);
+    fwrite(journal_flash + offset, 1, size, journal_flash_file);
+    fflush(journal_flash_file);
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label)
+{
+    if (type != journal_partition.type ||
+        (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != journal_partition.subtype) ||
+        (label != NULL && strcmp(label, journal_partition.label) != 0)) {
+        return NULL;
+    }
+    return &journal_partition;
+}
+
+static bool flash_range_ok(const esp_partition_t *partition, size_t offset, size_t size)
+{
+    return partition == &journal_partition && offset <= partition->size && size <= partition->size - offset;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size)
+{
+    if (!flash_range_ok(partition, src_offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    pthread_mutex_lock(&flash_mutex);
+    memcpy(dst, journal_flash + src_offset, size);
+    pthread_mutex_unlock(&flash_mutex);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size)
+{
+    if (!flash_range_ok(partition, dst_offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const uint8_t *bytes = src;
+    pthread_mutex_lock(&flash_mutex);
+    for (size_t i = 0; i < size; i++) {
+        journal_flash[dst_offset + i] &= bytes[i];
+    }
+    flash_file_sync(dst_offset, size);
+    pthread_mutex_unlock(&flash_mutex);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size)
+{
+    if (!flash_range_ok(partition, offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (offset % FLASH_SECTOR_SIZE != 0 || size % FLASH_SECTOR_SIZE != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&flash_mutex);
+    memset(journal_flash + offset, 0xFF, size);
+    flash_file_sync(offset, size);
+    pthread_mutex_unlock(&flash_mutex);
+    return ESP_OK;
+}
+
+// =========================================================================
+// == Power Management                                                    ==
+// =========================================================================
+// Nothing sleeps on the host. Locks are counted so the log shows when the firmware
+// would let the chip enter automatic light sleep, and for how long it did.
+
+struct esp_pm_lock {
+    const char *name;
+    int count;
+};
+
+static const char *TAG_PM = "pm";
+static pthread_mutex_t pm_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool pm_light_sleep_enabled = false;
+static int pm_locks_held = 0;
+static int64_t pm_sleep_allowed_since_us = 0;
+
+esp_err_t esp_pm_configure(const void *config)
+{
+    const esp_pm_config_t *pm_config = config;
+    if (pm_config == NULL || pm_config->min_freq_mhz > pm_config->max_freq_mhz) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&pm_mutex);
+    pm_light_sleep_enabled = pm_config->light_sleep_enable;
+    pm_sleep_allowed_since_us = esp_timer_get_time();
+    pthread_mutex_unlock(&pm_mutex);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_create(esp_pm_lock_type_t lock_type, int arg, const char *name, esp_pm_lock_handle_t *out_handle)
+{
+    (void)lock_type;
+    (void)arg;
+    struct esp_pm_lock *lock = calloc(1, sizeof(*lock));
+    if (lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    lock->name = name ? name : "";
+    *out_handle = lock;
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_acquire(esp_pm_lock_handle_t handle)
+{
+    pthread_mutex_lock(&pm_mutex);
+    handle->count++;
+    if (pm_locks_held++ == 0 && pm_light_sleep_enabled) {
+        ESP_LOGI(TAG_PM, "Light sleep blocked by \"%s\" after %lld ms allowed.", handle->name,
+                 (long long)((esp_timer_get_time() - pm_sleep_allowed_since_us) / 1000));
+    }
+    pthread_mutex_unlock(&pm_mutex);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle)
+{
+    pthread_mutex_lock(&pm_mutex);
+    if (handle->count == 0) {
+        pthread_mutex_unlock(&pm_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    handle->count--;
+    if (--pm_locks_held == 0 && pm_light_sleep_enabled) {
+        pm_sleep_allowed_since_us = esp_timer_get_time();
+        ESP_LOGI(TAG_PM, "No locks held; automatic light sleep allowed.");
+    }
+    pthread_mutex_unlock(&pm_mutex);
+    return ESP_OK;
+}
+
+// =========================================================================
+// == Heap Capabilities                                                   ==
+// =========================================================================
+// The host has one heap; PSRAM allocations come from it like any other.
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
@@ -0,0 +1,332 @@
+// FreeRTOS primitives mapped onto pthreads for the host build.
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+
+// =========================================================================
+// == Time                                                                ==
+// =========================================================================
+
+static struct timespec start_time;
+static pthread_once_t start_time_once = PTHREAD_ONCE_INIT;
+
+static void record_start_time(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+}
+
+static uint64_t elapsed_us(void)
+{
+    pthread_once(&start_time_once, record_start_time);
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - start_time.tv_sec) * 1000000u +
+           (uint64_t)((now.tv_nsec - start_time.tv_nsec) / 1000);
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (int64_t)elapsed_us();
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(elapsed_us() / (1000000u / configTICK_RATE_HZ));
+}
+
+/**
+ * @brief Absolute CLOCK_MONOTONIC deadline `ticks` from now, for timed condvar waits.
+ */
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t ns = (uint64_t)ts.tv_nsec + (uint64_t)ticks * (1000000000u / configTICK_RATE_HZ);
+    ts.tv_sec += (time_t)(ns / 1000000000u);
+    ts.tv_nsec = (long)(ns % 1000000000u);
+    return ts;
+}
+
+static void cond_init_monotonic(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/**
+ * @brief Waits on `cond` until `done()` holds or `ticks` elapse. Caller holds `mutex`.
+ */
+static bool cond_wait_ticks(pthread_cond_t *cond, pthread_mutex_t *mutex, TickType_t ticks,
+                            bool (*done)(void *), void *ctx)
+{
+    if (ticks == portMAX_DELAY) {
+        while (!done(ctx)) {
+            pthread_cond_wait(cond, mutex);
+        }
+        return true;
+    }
+    const struct timespec deadline = deadline_after(ticks);
+    while (!done(ctx)) {
+        if (pthread_cond_timedwait(cond, mutex, &deadline) == ETIMEDOUT) {
+            return done(ctx);
+        }
+    }
+    return true;
+}
+
+// =========================================================================
+// == Tasks                                                               ==
+// =========================================================================
+
+typedef struct {
+    TaskFunction_t fn;
+    void *arg;
+    BaseType_t core_id;
+} task_start_t;
+
+static __thread BaseType_t current_core_id = 0;
+
+static void *task_trampoline(void *p)
+{
+    task_start_t start = *(task_start_t *)p;
+    free(p);
+    current_core_id = (start.core_id == tskNO_AFFINITY) ? 0 : start.core_id;
+    start.fn(start.arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task_code, const char *name, uint32_t stack_depth,
+                                   void *parameters, UBaseType_t priority, TaskHandle_t *created_task,
+                                   BaseType_t core_id)
+{
+    (void)stack_depth;
+    (void)priority;
+    task_start_t *start = malloc(sizeof(*start));
+    if (start == NULL) {
+        return pdFAIL;
+    }
+    start->fn = task_code;
+    start->arg = parameters;
+    start->core_id = core_id;
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, task_trampoline, start) != 0) {
+        free(start);
+        return pdFAIL;
+    }
+    pthread_setname_np(thread, name);
+    pthread_detach(thread);
+    if (created_task) {
+        *created_task = (TaskHandle_t)thread;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name, uint32_t stack_depth,
+                       void *parameters, UBaseType_t priority, TaskHandle_t *created_task)
+{
+    return xTaskCreatePinnedToCore(task_code, name, stack_depth, parameters, priority, created_task, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL) {
+        pthread_exit(NULL);
+    }
+    pthread_cancel((pthread_t)task);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec ts = {
+        .tv_sec = ticks / configTICK_RATE_HZ,
+        .tv_nsec = (long)(ticks % configTICK_RATE_HZ) * (1000000000L / configTICK_RATE_HZ),
+    };
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {
+    }
+}
+
+BaseType_t xPortGetCoreID(void)
+{
+    return current_core_id;
+}
+
+// =========================================================================
+// == Semaphores                                                          ==
+// =========================================================================
+
+struct host_semaphore {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max_count;
+};
+
+static bool semaphore_available(void *p)
+{
+    return ((struct host_semaphore *)p)->count > 0;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    struct host_semaphore *sem = calloc(1, sizeof(*sem));
+    if (sem == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->mutex, NULL);
+    cond_init_monotonic(&sem->cond);
+    sem->count = initial_count;
+    sem->max_count = max_count;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return xSemaphoreCreateCounting(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return xSemaphoreCreateCounting(1, 1);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks_to_wait)
+{
+    pthread_mutex_lock(&sem->mutex);
+    bool taken = cond_wait_ticks(&sem->cond, &sem->mutex, ticks_to_wait, semaphore_available, sem);
+    if (taken) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->mutex);
+    return taken ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    BaseType_t given = pdFALSE;
+    pthread_mutex_lock(&sem->mutex);
+    if (sem->count < sem->max_count) {
+        sem->count++;
+        given = pdTRUE;
+        pthread_cond_signal(&sem->cond);
+    }
+    pthread_mutex_unlock(&sem->mutex);
+    return given;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *higher_priority_task_woken)
+{
+    if (higher_priority_task_woken) {
+        *higher_priority_task_woken = pdFALSE;
+    }
+    return xSemaphoreGive(sem);
+}
+
+// =========================================================================
+// == Queues                                                              ==
+// =========================================================================
+
+struct host_queue {
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+    uint8_t *storage;
+};
+
+static bool queue_has_item(void *p)
+{
+    return ((struct host_queue *)p)->count > 0;
+}
+
+static bool queue_has_space(void *p)
+{
+    struct host_queue *q = p;
+    return q->count < q->length;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct host_queue *q = calloc(1, sizeof(*q));
+    if (q == NULL) {
+        return NULL;
+    }
+    q->storage = calloc(length, item_size);
+    if (q->storage == NULL) {
+        free(q);
+        return NULL;
+    }
+    pthread_mutex_init(&q->mutex, NULL);
+    cond_init_monotonic(&q->not_empty);
+    cond_init_monotonic(&q->not_full);
+    q->length = length;
+    q->item_size = item_size;
+    return q;
+}
+
+static BaseType_t queue_send(QueueHandle_t q, const void *item, TickType_t ticks_to_wait, bool to_front)
+{
+    pthread_mutex_lock(&q->mutex);
+    if (!cond_wait_ticks(&q->not_full, &q->mutex, ticks_to_wait, queue_has_space, q)) {
+        pthread_mutex_unlock(&q->mutex);
+        return pdFALSE;
+    }
+    UBaseType_t slot;
+    if (to_front) {
+        q->head = (q->head + q->length - 1) % q->length;
+        slot = q->head;
+    } else {
+        slot = (q->head + q->count) % q->length;
+    }
+    memcpy(q->storage + (size_t)slot * q->item_size, item, q->item_size);
+    q->count++;
+    pthread_cond_signal(&q->not_empty);
+    pthread_mutex_unlock(&q->mutex);
+    return pdTRUE;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait)
+{
+    return queue_send(queue, item, ticks_to_wait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait)
+{
+    return queue_send(queue, item, ticks_to_wait, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks_to_wait)
+{
+    pthread_mutex_lock(&q->mutex);
+    if (!cond_wait_ticks(&q->not_empty, &q->mutex, ticks_to_wait, queue_has_item, q)) {
+        pthread_mutex_unlock(&q->mutex);
+        return pdFALSE;
+    }
+    memcpy(item, q->storage + (size_t)q->head * q->item_size, q->item_size);
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    pthread_cond_signal(&q->not_full);
+    pthread_mutex_unlock(&q->mutex);
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->mutex);
+    UBaseType_t count = q->count;
+    pthread_mutex_unlock(&q->mutex);
+    return count;
+}
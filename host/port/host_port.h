@@ -0,0 +1,40 @@
+// host_port.h
+// Configuration hooks of the host build's port layer, set from host_main.c
+// before app_main() runs.
+#ifndef HOST_PORT_H
+#define HOST_PORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+    uint16_t tcp_port;            // 127.0.0.1 port the GATT socket listens on
+    uint32_t conn_interval_ms;    // Initial connection interval: notifications go out once per interval
+    uint32_t pkts_per_interval;   // Notifications per connection event
+    uint32_t msys_mbufs;          // Size of the mbuf pool notifications are queued in
+    uint16_t max_client_mtu;      // Upper bound on the MTU a client may negotiate
+} nimble_sock_config_t;
+
+void nimble_sock_default_config(nimble_sock_config_t *config);
+void nimble_sock_configure(const nimble_sock_config_t *config);
+
+/**
+ * @brief Sets the size of the slices replies are handed to the CDC data callback in
+ * (the bulk IN packet size; 64 for a full-speed device), and how often the cable
+ * "glitches": every `glitch_period_ms` (0 = never) the device disconnects for a moment.
+ * NanoVNA registers survive a glitch, as they do on a NanoVNA that stays powered.
+ * Every `byte_error_period`-th FIFO reply (0 = none) loses or repeats one byte, alternately,
+ * and every `lost_reply_period`-th one (0 = none) is lost altogether.
+ * Each IN transfer (the handle's in_buffer_size, rounded down to whole packets) costs
+ * `transfer_us` of turnaround on top of the device's own time, as host scheduling does.
+ */
+void usb_cdc_sim_configure(size_t usb_packet_size, uint32_t glitch_period_ms, uint32_t byte_error_period,
+                           uint32_t lost_reply_period, uint32_t transfer_us);
+
+/**
+ * @brief Erases the simulated flash partitions, then loads them from `flash_path` if given
+ * (NULL = in memory only). Writes go through to the file, so the journal survives a restart.
+ */
+void esp_partition_sim_configure(const char *flash_path);
+
+#endif // HOST_PORT_H
@@ -0,0 +1,909 @@
+// NimBLE host API for the host build. The "radio" is a TCP socket on
+// 127.0.0.1: each accepted client is one BLE connection. Notifications wait in
+// a bounded mbuf pool and leave once per connection interval, so throughput and
+// backpressure follow the link parameters instead of the loopback's speed.
+//
+// Every message in both directions is [u8 op][u16 handle][u16 len][payload],
+// little-endian:
+//   server -> client  'C' characteristic: payload = uuid128 (NimBLE byte order) + u16 flags
+//                     'M' ATT MTU in effect: payload = u16 mtu
+//                     'N' notification
+//                     'r' read response: payload = u8 ATT status + value
+//                     'w' write response: payload = u8 ATT status
+//   client -> server  'M' client MTU (starts/answers the MTU exchange): payload = u16 mtu
+//                     'R' read, 'W' write: payload = value
+//                     'S' CCCD write: payload = u16 (bit 0 notify, bit 1 indicate)
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "nimble/nimble_port.h"
+#include "nimble/nimble_port_freertos.h"
+#include "host/ble_hs.h"
+#include "host/util/util.h"
+#include "services/gap/ble_svc_gap.h"
+#include "services/gatt/ble_svc_gatt.h"
+
+#include "host_port.h"
+
+#define MAX_CONNECTIONS     3     // CONFIG_BT_NIMBLE_MAX_CONNECTIONS default
+#define MAX_CHARACTERISTICS 16
+#define MSG_HEADER_LEN      5
+#define MAX_MSG_PAYLOAD     (BLE_ATT_MTU_MAX + 2)
+#define ATT_MAX_ATTR_LEN    512
+#define IDLE_POLL_MS        50
+
+typedef struct notify_item {
+    struct notify_item *next;
+    uint16_t attr_handle;
+    struct os_mbuf *om;
+} notify_item_t;
+
+typedef struct {
+    bool in_use;
+    bool closing;                 // ble_gap_terminate() called
+    int fd;
+    uint16_t handle;
+    uint16_t mtu;
+    uint16_t peer_mtu;            // 0 until the client reports it
+    uint16_t itvl;                // 1.25 ms units
+    uint16_t latency;
+    uint16_t supervision_timeout;
+    bool conn_update_pending;
+    bool mtu_event_pending;
+    int (*mtu_cb)(uint16_t conn_handle, const struct ble_gatt_error *error, uint16_t mtu, void *arg);
+    void *mtu_cb_arg;
+    int64_t next_event_us;
+    notify_item_t *tx_head;
+    notify_item_t *tx_tail;
+    uint16_t cccd[MAX_CHARACTERISTICS];
+    uint8_t rx_buf[MSG_HEADER_LEN + MAX_MSG_PAYLOAD];
+    size_t rx_len;
+    ble_gap_event_fn *gap_cb;
+    void *gap_cb_arg;
+} sock_conn_t;
+
+typedef struct {
+    const struct ble_gatt_chr_def *def;
+    uint16_t val_handle;
+} sock_chr_t;
+
+struct ble_hs_cfg ble_hs_cfg;
+
+static nimble_sock_config_t sock_config;
+static bool sock_configured = false;
+static pthread_mutex_t sock_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int wake_pipe[2] = { -1, -1 };
+static volatile bool stop_requested = false;
+
+static sock_chr_t chrs[MAX_CHARACTERISTICS];
+static int num_chrs = 0;
+static uint16_t next_attr_handle = 1;
+
+static sock_conn_t conns[MAX_CONNECTIONS];
+static uint16_t next_conn_handle = 1;
+
+static bool adv_active = false;
+static ble_gap_event_fn *adv_cb = NULL;
+static void *adv_cb_arg = NULL;
+
+static int msys_free = 0;
+static uint16_t preferred_mtu = BLE_ATT_MTU_DFLT;
+static char device_name[32] = "nimble";
+
+void nimble_sock_default_config(nimble_sock_config_t *config)
+{
+    *config = (nimble_sock_config_t){
+        .tcp_port = 7878,
+        .conn_interval_ms = 30,
+        .pkts_per_interval = 4,
+        .msys_mbufs = 12,
+        .max_client_mtu = BLE_ATT_MTU_MAX,
+    };
+}
+
+void nimble_sock_configure(const nimble_sock_config_t *config)
+{
+    sock_config = *config;
+    sock_configured = true;
+}
+
+static void wake_run_loop(void)
+{
+    if (wake_pipe[1] >= 0) {
+        const uint8_t b = 0;
+        ssize_t unused = write(wake_pipe[1], &b, 1);
+        (void)unused;
+    }
+}
+
+// =========================================================================
+// == mbufs                                                               ==
+// =========================================================================
+
+static struct os_mbuf *mbuf_alloc(uint16_t cap, bool from_msys)
+{
+    if (from_msys) {
+        pthread_mutex_lock(&sock_mutex);
+        if (msys_free == 0) {
+            pthread_mutex_unlock(&sock_mutex);
+            return NULL;
+        }
+        msys_free--;
+        pthread_mutex_unlock(&sock_mutex);
+    }
+    struct os_mbuf *om = calloc(1, sizeof(*om) + cap);
+    if (om == NULL) {
+        return NULL;
+    }
+    om->om_cap = cap;
+    om->om_data = (uint8_t *)(om + 1);
+    om->om_from_msys = from_msys;
+    return om;
+}
+
+int os_mbuf_free_chain(struct os_mbuf *om)
+{
+    if (om == NULL) {
+        return 0;
+    }
+    if (om->om_from_msys) {
+        pthread_mutex_lock(&sock_mutex);
+        msys_free++;
+        pthread_mutex_unlock(&sock_mutex);
+    }
+    free(om);
+    return 0;
+}
+
+int os_mbuf_append(struct os_mbuf *om, const void *data, uint16_t len)
+{
+    if ((uint32_t)om->om_len + len > om->om_cap) {
+        return BLE_HS_ENOMEM;
+    }
+    memcpy(om->om_data + om->om_len, data, len);
+    om->om_len += len;
+    return 0;
+}
+
+int os_msys_num_free(void)
+{
+    pthread_mutex_lock(&sock_mutex);
+    int n = msys_free;
+    pthread_mutex_unlock(&sock_mutex);
+    return n;
+}
+
+struct os_mbuf *ble_hs_mbuf_from_flat(const void *buf, uint16_t len)
+{
+    struct os_mbuf *om = mbuf_alloc(len, true);
+    if (om) {
+        os_mbuf_append(om, buf, len);
+    }
+    return om;
+}
+
+int ble_hs_mbuf_to_flat(const struct os_mbuf *om, void *flat, uint16_t max_len, uint16_t *out_copy_len)
+{
+    uint16_t n = (om->om_len < max_len) ? om->om_len : max_len;
+    memcpy(flat, om->om_data, n);
+    if (out_copy_len) {
+        *out_copy_len = n;
+    }
+    return (n < om->om_len) ? BLE_HS_EMSGSIZE : 0;
+}
+
+// =========================================================================
+// == Lookup helpers (sock_mutex held)                                    ==
+// =========================================================================
+
+static sock_conn_t *find_conn(uint16_t conn_handle)
+{
+    for (int i = 0; i < MAX_CONNECTIONS; i++) {
+        if (conns[i].in_use && conns[i].handle == conn_handle) {
+            return &conns[i];
+        }
+    }
+    return NULL;
+}
+
+static int find_chr(uint16_t val_handle)
+{
+    for (int i = 0; i < num_chrs; i++) {
+        if (chrs[i].val_handle == val_handle) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void fill_conn_desc(const sock_conn_t *conn, struct ble_gap_conn_desc *desc)
+{
+    memset(desc, 0, sizeof(*desc));
+    desc->conn_handle = conn->handle;
+    desc->conn_itvl = conn->itvl;
+    desc->conn_latency = conn->latency;
+    desc->supervision_timeout = conn->supervision_timeout;
+}
+
+// =========================================================================
+// == Socket I/O (run loop thread)                                        ==
+// =========================================================================
+
+static void send_msg(sock_conn_t *conn, uint8_t op, uint16_t handle, const void *payload, uint16_t len)
+{
+    uint8_t header[MSG_HEADER_LEN] = { op, (uint8_t)handle, (uint8_t)(handle >> 8), (uint8_t)len, (uint8_t)(len >> 8) };
+    if (send(conn->fd, header, sizeof(header), MSG_NOSIGNAL) < 0 ||
+        (len && send(conn->fd, payload, len, MSG_NOSIGNAL) < 0)) {
+        conn->closing = true;
+    }
+}
+
+static void emit_gap_event(const sock_conn_t *conn, struct ble_gap_event *event)
+{
+    if (conn->gap_cb) {
+        conn->gap_cb(event, conn->gap_cb_arg);
+    }
+}
+
+static void accept_connection(int listen_fd)
+{
+    int fd = accept(listen_fd, NULL, NULL);
+    if (fd < 0) {
+        return;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    pthread_mutex_lock(&sock_mutex);
+    sock_conn_t *conn = NULL;
+    for (int i = 0; i < MAX_CONNECTIONS && conn == NULL; i++) {
+        if (!conns[i].in_use) {
+            conn = &conns[i];
+        }
+    }
+    if (conn == NULL || !adv_active) {
+        pthread_mutex_unlock(&sock_mutex);
+        close(fd);
+        return;
+    }
+    memset(conn, 0, sizeof(*conn));
+    conn->in_use = true;
+    conn->fd = fd;
+    conn->handle = next_conn_handle++;
+    conn->mtu = BLE_ATT_MTU_DFLT;
+    conn->itvl = (uint16_t)((sock_config.conn_interval_ms * 1000u + 1249u) / 1250u);
+    conn->supervision_timeout = 400;
+    conn->next_event_us = esp_timer_get_time();
+    conn->gap_cb = adv_cb;
+    conn->gap_cb_arg = adv_cb_arg;
+    adv_active = false; // A connectable advertiser stops once a central connects
+    pthread_mutex_unlock(&sock_mutex);
+
+    for (int i = 0; i < num_chrs; i++) {
+        uint8_t payload[18];
+        memcpy(payload, ((const ble_uuid128_t *)chrs[i].def->uuid)->value, 16);
+        payload[16] = (uint8_t)chrs[i].def->flags;
+        payload[17] = (uint8_t)(chrs[i].def->flags >> 8);
+        send_msg(conn, 'C', chrs[i].val_handle, payload, sizeof(payload));
+    }
+    fprintf(stderr, "nimble_sock: client connected as conn_handle %u\n", conn->handle);
+
+    struct ble_gap_event event = { .type = BLE_GAP_EVENT_CONNECT };
+    event.connect.status = 0;
+    event.connect.conn_handle = conn->handle;
+    emit_gap_event(conn, &event);
+}
+
+static void close_connection(sock_conn_t *conn, int reason)
+{
+    pthread_mutex_lock(&sock_mutex);
+    notify_item_t *item = conn->tx_head;
+    conn->tx_head = conn->tx_tail = NULL;
+    struct ble_gap_event event = { .type = BLE_GAP_EVENT_DISCONNECT };
+    event.disconnect.reason = reason;
+    fill_conn_desc(conn, &event.disconnect.conn);
+    ble_gap_event_fn *cb = conn->gap_cb;
+    void *cb_arg = conn->gap_cb_arg;
+    close(conn->fd);
+    conn->in_use = false;
+    pthread_mutex_unlock(&sock_mutex);
+
+    while (item) {
+        notify_item_t *next = item->next;
+        os_mbuf_free_chain(item->om);
+        free(item);
+        item = next;
+    }
+    fprintf(stderr, "nimble_sock: conn_handle %u disconnected (reason 0x%x)\n", event.disconnect.conn.conn_handle, reason);
+    if (cb) {
+        cb(&event, cb_arg);
+    }
+}
+
+static void handle_read(sock_conn_t *conn, uint16_t attr_handle)
+{
+    uint8_t response[1 + ATT_MAX_ATTR_LEN];
+    uint16_t len = 0;
+    int idx = find_chr(attr_handle);
+
+    response[0] = 0;
+    if (idx < 0 || !(chrs[idx].def->flags & BLE_GATT_CHR_F_READ)) {
+        response[0] = 0x02; // Read Not Permitted
+    } else {
+        struct os_mbuf *om = mbuf_alloc(ATT_MAX_ATTR_LEN, false);
+        struct ble_gatt_access_ctxt ctxt = { .op = BLE_GATT_ACCESS_OP_READ_CHR, .om = om };
+        int rc = om ? chrs[idx].def->access_cb(conn->handle, attr_handle, &ctxt, chrs[idx].def->arg)
+                    : BLE_ATT_ERR_INSUFFICIENT_RES;
+        if (rc != 0) {
+            response[0] = (uint8_t)rc;
+        } else {
+            // Whole value, as a client gets it with Read + Read Blob when it exceeds MTU - 1
+            len = (om->om_len > ATT_MAX_ATTR_LEN) ? ATT_MAX_ATTR_LEN : om->om_len;
+            memcpy(response + 1, om->om_data, len);
+        }
+        os_mbuf_free_chain(om);
+    }
+    send_msg(conn, 'r', attr_handle, response, 1 + len);
+}
+
+static void handle_write(sock_conn_t *conn, uint16_t attr_handle, const uint8_t *value, uint16_t len)
+{
+    uint8_t status = 0;
+    int idx = find_chr(attr_handle);
+
+    if (idx < 0 || !(chrs[idx].def->flags & BLE_GATT_CHR_F_WRITE)) {
+        status = 0x03; // Write Not Permitted
+    } else if (len > conn->mtu - 3) {
+        status = BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    } else {
+        struct os_mbuf *om = mbuf_alloc(len, false);
+        if (om == NULL) {
+            status = BLE_ATT_ERR_INSUFFICIENT_RES;
+        } else {
+            os_mbuf_append(om, value, len);
+            struct ble_gatt_access_ctxt ctxt = { .op = BLE_GATT_ACCESS_OP_WRITE_CHR, .om = om };
+            status = (uint8_t)chrs[idx].def->access_cb(conn->handle, attr_handle, &ctxt, chrs[idx].def->arg);
+            os_mbuf_free_chain(om);
+        }
+    }
+    send_msg(conn, 'w', attr_handle, &status, 1);
+}
+
+static void handle_subscribe(sock_conn_t *conn, uint16_t attr_handle, uint16_t cccd)
+{
+    int idx = find_chr(attr_handle);
+    if (idx < 0 || !(chrs[idx].def->flags & BLE_GATT_CHR_F_NOTIFY)) {
+        return;
+    }
+    uint16_t prev = conn->cccd[idx];
+    conn->cccd[idx] = cccd;
+
+    struct ble_gap_event event = { .type = BLE_GAP_EVENT_SUBSCRIBE };
+    event.subscribe.conn_handle = conn->handle;
+    event.subscribe.attr_handle = attr_handle;
+    event.subscribe.reason = 1; // BLE_GAP_SUBSCRIBE_REASON_WRITE
+    event.subscribe.prev_notify = prev & 1;
+    event.subscribe.cur_notify = cccd & 1;
+    event.subscribe.prev_indicate = (prev >> 1) & 1;
+    event.subscribe.cur_indicate = (cccd >> 1) & 1;
+    emit_gap_event(conn, &event);
+}
+
+/**
+ * @brief Applies a client MTU report: completes a pending exchange and reports the new MTU.
+ */
+static void handle_client_mtu(sock_conn_t *conn, uint16_t client_mtu)
+{
+    if (client_mtu < BLE_ATT_MTU_DFLT) {
+        client_mtu = BLE_ATT_MTU_DFLT;
+    }
+    if (client_mtu > sock_config.max_client_mtu) {
+        client_mtu = sock_config.max_client_mtu;
+    }
+    pthread_mutex_lock(&sock_mutex);
+    conn->peer_mtu = client_mtu;
+    conn->mtu = (client_mtu < preferred_mtu) ? client_mtu : preferred_mtu;
+    conn->mtu_event_pending = true;
+    pthread_mutex_unlock(&sock_mutex);
+}
+
+static void dispatch_message(sock_conn_t *conn, uint8_t op, uint16_t handle, const uint8_t *payload, uint16_t len)
+{
+    switch (op) {
+    case 'M':
+        if (len >= 2) {
+            handle_client_mtu(conn, (uint16_t)(payload[0] | (payload[1] << 8)));
+        }
+        break;
+    case 'R':
+        handle_read(conn, handle);
+        break;
+    case 'W':
+        handle_write(conn, handle, payload, len);
+        break;
+    case 'S':
+        if (len >= 2) {
+            handle_subscribe(conn, handle, (uint16_t)(payload[0] | (payload[1] << 8)));
+        }
+        break;
+    default:
+        fprintf(stderr, "nimble_sock: unknown message '%c' from conn_handle %u\n", op, conn->handle);
+        break;
+    }
+}
+
+static void receive_from(sock_conn_t *conn)
+{
+    ssize_t n = recv(conn->fd, conn->rx_buf + conn->rx_len, sizeof(conn->rx_buf) - conn->rx_len, 0);
+    if (n <= 0) {
+        conn->closing = true;
+        return;
+    }
+    conn->rx_len += (size_t)n;
+
+    size_t off = 0;
+    while (conn->rx_len - off >= MSG_HEADER_LEN) {
+        const uint8_t *msg = conn->rx_buf + off;
+        uint16_t handle = (uint16_t)(msg[1] | (msg[2] << 8));
+        uint16_t len = (uint16_t)(msg[3] | (msg[4] << 8));
+        if (len > MAX_MSG_PAYLOAD) {
+            conn->closing = true; // Framing lost
+            return;
+        }
+        if (conn->rx_len - off < MSG_HEADER_LEN + (size_t)len) {
+            break;
+        }
+        dispatch_message(conn, msg[0], handle, msg + MSG_HEADER_LEN, len);
+        off += MSG_HEADER_LEN + len;
+    }
+    memmove(conn->rx_buf, conn->rx_buf + off, conn->rx_len - off);
+    conn->rx_len -= off;
+}
+
+/**
+ * @brief Runs the deferred GAP/GATT events of a connection (MTU exchange, connection update).
+ */
+static void run_pending_events(sock_conn_t *conn)
+{
+    pthread_mutex_lock(&sock_mutex);
+    bool mtu_event = conn->mtu_event_pending;
+    bool update_event = conn->conn_update_pending;
+    int (*mtu_cb)(uint16_t, const struct ble_gatt_error *, uint16_t, void *) = NULL;
+    void *mtu_cb_arg = conn->mtu_cb_arg;
+    if (mtu_event) {
+        mtu_cb = conn->mtu_cb;
+        conn->mtu_cb = NULL;
+    }
+    conn->mtu_event_pending = false;
+    conn->conn_update_pending = false;
+    uint16_t mtu = conn->mtu;
+    pthread_mutex_unlock(&sock_mutex);
+
+    if (mtu_event) {
+        uint8_t payload[2] = { (uint8_t)mtu, (uint8_t)(mtu >> 8) };
+        send_msg(conn, 'M', 0, payload, sizeof(payload));
+        if (mtu_cb) {
+            struct ble_gatt_error error = { .status = 0 };
+            mtu_cb(conn->handle, &error, mtu, mtu_cb_arg);
+        }
+        struct ble_gap_event event = { .type = BLE_GAP_EVENT_MTU };
+        event.mtu.conn_handle = conn->handle;
+        event.mtu.channel_id = 4; // ATT
+        event.mtu.value = mtu;
+        emit_gap_event(conn, &event);
+    }
+    if (update_event) {
+        struct ble_gap_event event = { .type = BLE_GAP_EVENT_CONN_UPDATE };
+        event.conn_update.status = 0;
+        event.conn_update.conn_handle = conn->handle;
+        emit_gap_event(conn, &event);
+    }
+}
+
+/**
+ * @brief Sends what one connection event allows if the event is due.
+ * @return microseconds until this connection next needs the loop, or -1 if idle
+ */
+static int64_t run_connection_event(sock_conn_t *conn, int64_t now_us)
+{
+    const int64_t itvl_us = (int64_t)conn->itvl * 1250;
+
+    pthread_mutex_lock(&sock_mutex);
+    if (conn->tx_head == NULL) {
+        pthread_mutex_unlock(&sock_mutex);
+        return -1;
+    }
+    if (now_us < conn->next_event_us) {
+        pthread_mutex_unlock(&sock_mutex);
+        return conn->next_event_us - now_us;
+    }
+    // Connection events keep ticking while idle: align to the next one on the grid
+    conn->next_event_us += ((now_us - conn->next_event_us) / itvl_us + 1) * itvl_us;
+
+    notify_item_t *batch = NULL;
+    notify_item_t **tail = &batch;
+    for (uint32_t i = 0; i < sock_config.pkts_per_interval && conn->tx_head; i++) {
+        notify_item_t *item = conn->tx_head;
+        conn->tx_head = item->next;
+        item->next = NULL;
+        *tail = item;
+        tail = &item->next;
+    }
+    if (conn->tx_head == NULL) {
+        conn->tx_tail = NULL;
+    }
+    bool more = conn->tx_head != NULL;
+    uint16_t max_len = conn->mtu - 3;
+    pthread_mutex_unlock(&sock_mutex);
+
+    while (batch) {
+        notify_item_t *next = batch->next;
+        uint16_t len = batch->om->om_len < max_len ? batch->om->om_len : max_len;
+        send_msg(conn, 'N', batch->attr_handle, batch->om->om_data, len);
+
+        struct ble_gap_event event = { .type = BLE_GAP_EVENT_NOTIFY_TX };
+        event.notify_tx.status = 0;
+        event.notify_tx.conn_handle = conn->handle;
+        event.notify_tx.attr_handle = batch->attr_handle;
+        os_mbuf_free_chain(batch->om);
+        free(batch);
+        emit_gap_event(conn, &event);
+        batch = next;
+    }
+    return more ? itvl_us : -1;
+}
+
+static int open_listen_socket(uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = { .sin_family = AF_INET, .sin_port = htons(port) };
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 4) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// =========================================================================
+// == Port entry points                                                   ==
+// =========================================================================
+
+esp_err_t nimble_port_init(void)
+{
+    if (!sock_configured) {
+        nimble_sock_default_config(&sock_config);
+    }
+    msys_free = (int)sock_config.msys_mbufs;
+    if (pipe(wake_pipe) < 0) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+void nimble_port_run(void)
+{
+    int listen_fd = open_listen_socket(sock_config.tcp_port);
+    if (listen_fd < 0) {
+        fprintf(stderr, "nimble_sock: cannot listen on 127.0.0.1:%u: %s\n", sock_config.tcp_port, strerror(errno));
+        return;
+    }
+    fprintf(stderr, "nimble_sock: \"%s\" listening on 127.0.0.1:%u\n", device_name, sock_config.tcp_port);
+
+    if (ble_hs_cfg.sync_cb) {
+        ble_hs_cfg.sync_cb();
+    }
+
+    while (!stop_requested) {
+        struct pollfd fds[2 + MAX_CONNECTIONS];
+        sock_conn_t *fd_conn[2 + MAX_CONNECTIONS];
+        int nfds = 0;
+
+        fds[nfds] = (struct pollfd){ .fd = wake_pipe[0], .events = POLLIN };
+        fd_conn[nfds++] = NULL;
+        pthread_mutex_lock(&sock_mutex);
+        bool accepting = adv_active;
+        pthread_mutex_unlock(&sock_mutex);
+        if (accepting) {
+            fds[nfds] = (struct pollfd){ .fd = listen_fd, .events = POLLIN };
+            fd_conn[nfds++] = NULL;
+        }
+
+        int64_t now_us = esp_timer_get_time();
+        int64_t timeout_us = (int64_t)IDLE_POLL_MS * 1000;
+        for (int i = 0; i < MAX_CONNECTIONS; i++) {
+            sock_conn_t *conn = &conns[i];
+            if (!conn->in_use) {
+                continue;
+            }
+            run_pending_events(conn);
+            int64_t due = run_connection_event(conn, now_us);
+            if (due >= 0 && due < timeout_us) {
+                timeout_us = due;
+            }
+            if (conn->closing) {
+                close_connection(conn, BLE_HS_ERR_HCI_BASE + BLE_ERR_CONN_TERM_LOCAL);
+                continue;
+            }
+            fds[nfds] = (struct pollfd){ .fd = conn->fd, .events = POLLIN };
+            fd_conn[nfds++] = conn;
+        }
+
+        if (poll(fds, (nfds_t)nfds, (int)((timeout_us + 999) / 1000)) <= 0) {
+            continue;
+        }
+        for (int i = 0; i < nfds; i++) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) {
+                continue;
+            }
+            if (fds[i].fd == wake_pipe[0]) {
+                uint8_t drain[64];
+                ssize_t unused = read(wake_pipe[0], drain, sizeof(drain));
+                (void)unused;
+            } else if (fd_conn[i] == NULL) {
+                accept_connection(listen_fd);
+            } else {
+                receive_from(fd_conn[i]);
+                if (fd_conn[i]->closing) {
+                    close_connection(fd_conn[i], BLE_HS_ERR_HCI_BASE + BLE_ERR_REM_USER_CONN_TERM);
+                }
+            }
+        }
+    }
+    close(listen_fd);
+}
+
+int nimble_port_stop(void)
+{
+    stop_requested = true;
+    wake_run_loop();
+    return 0;
+}
+
+void nimble_port_freertos_init(void (*host_task_fn)(void *))
+{
+    xTaskCreate(host_task_fn, "nimble_host", 4096, NULL, 0, NULL);
+}
+
+void nimble_port_freertos_deinit(void)
+{
+}
+
+// =========================================================================
+// == GATT                                                                ==
+// =========================================================================
+
+int ble_gatts_count_cfg(const struct ble_gatt_svc_def *defs)
+{
+    int count = num_chrs;
+    for (const struct ble_gatt_svc_def *svc = defs; svc->type != 0; svc++) {
+        for (const struct ble_gatt_chr_def *chr = svc->characteristics; chr && chr->uuid; chr++) {
+            if (chr->uuid->type != BLE_UUID_TYPE_128) {
+                return BLE_HS_EINVAL; // Only 128-bit UUIDs are announced to clients
+            }
+            count++;
+        }
+    }
+    return (count <= MAX_CHARACTERISTICS) ? 0 : BLE_HS_ENOMEM;
+}
+
+int ble_gatts_add_svcs(const struct ble_gatt_svc_def *svcs)
+{
+    for (const struct ble_gatt_svc_def *svc = svcs; svc->type != 0; svc++) {
+        next_attr_handle++; // Service declaration
+        for (const struct ble_gatt_chr_def *chr = svc->characteristics; chr && chr->uuid; chr++) {
+            if (num_chrs == MAX_CHARACTERISTICS) {
+                return BLE_HS_ENOMEM;
+            }
+            next_attr_handle++; // Characteristic declaration
+            uint16_t val_handle = next_attr_handle++;
+            if (chr->flags & BLE_GATT_CHR_F_NOTIFY) {
+                next_attr_handle++; // CCCD
+            }
+            if (chr->val_handle) {
+                *chr->val_handle = val_handle;
+            }
+            chrs[num_chrs++] = (sock_chr_t){ .def = chr, .val_handle = val_handle };
+        }
+    }
+    return 0;
+}
+
+int ble_gatts_notify_custom(uint16_t conn_handle, uint16_t chr_val_handle, struct os_mbuf *om)
+{
+    if (om == NULL) {
+        return BLE_HS_EINVAL;
+    }
+    notify_item_t *item = malloc(sizeof(*item));
+    if (item == NULL) {
+        os_mbuf_free_chain(om);
+        return BLE_HS_ENOMEM;
+    }
+    item->next = NULL;
+    item->attr_handle = chr_val_handle;
+    item->om = om;
+
+    pthread_mutex_lock(&sock_mutex);
+    sock_conn_t *conn = find_conn(conn_handle);
+    if (conn == NULL || conn->closing) {
+        pthread_mutex_unlock(&sock_mutex);
+        free(item);
+        os_mbuf_free_chain(om);
+        return BLE_HS_ENOTCONN;
+    }
+    if (conn->tx_tail) {
+        conn->tx_tail->next = item;
+    } else {
+        conn->tx_head = item;
+    }
+    conn->tx_tail = item;
+    pthread_mutex_unlock(&sock_mutex);
+    wake_run_loop();
+    return 0;
+}
+
+int ble_gattc_exchange_mtu(uint16_t conn_handle,
+                           int (*cb)(uint16_t conn_handle, const struct ble_gatt_error *error,
+                                     uint16_t mtu, void *arg),
+                           void *cb_arg)
+{
+    int rc = 0;
+    pthread_mutex_lock(&sock_mutex);
+    sock_conn_t *conn = find_conn(conn_handle);
+    if (conn == NULL) {
+        rc = BLE_HS_ENOTCONN;
+    } else if (conn->mtu_cb) {
+        rc = BLE_HS_EALREADY;
+    } else {
+        conn->mtu_cb = cb;
+        conn->mtu_cb_arg = cb_arg;
+        // Completes once the client has reported its MTU (possibly already)
+        conn->mtu_event_pending = conn->peer_mtu != 0;
+    }
+    pthread_mutex_unlock(&sock_mutex);
+    wake_run_loop();
+    return rc;
+}
+
+int ble_att_set_preferred_mtu(uint16_t mtu)
+{
+    if (mtu < BLE_ATT_MTU_DFLT || mtu > BLE_ATT_MTU_MAX) {
+        return BLE_HS_EINVAL;
+    }
+    preferred_mtu = mtu;
+    return 0;
+}
+
+uint16_t ble_att_preferred_mtu(void)
+{
+    return preferred_mtu;
+}
+
+uint16_t ble_att_mtu(uint16_t conn_handle)
+{
+    pthread_mutex_lock(&sock_mutex);
+    sock_conn_t *conn = find_conn(conn_handle);
+    uint16_t mtu = conn ? conn->mtu : 0;
+    pthread_mutex_unlock(&sock_mutex);
+    return mtu;
+}
+
+// =========================================================================
+// == GAP                                                                 ==
+// =========================================================================
+
+int ble_gap_adv_start(uint8_t own_addr_type, const void *direct_addr, int32_t duration_ms,
+                      const struct ble_gap_adv_params *adv_params, ble_gap_event_fn *cb, void *cb_arg)
+{
+    (void)own_addr_type;
+    (void)direct_addr;
+    (void)duration_ms;
+    (void)adv_params;
+    pthread_mutex_lock(&sock_mutex);
+    int rc = adv_active ? BLE_HS_EALREADY : 0;
+    adv_active = true;
+    adv_cb = cb;
+    adv_cb_arg = cb_arg;
+    pthread_mutex_unlock(&sock_mutex);
+    wake_run_loop();
+    return rc;
+}
+
+int ble_gap_adv_stop(void)
+{
+    pthread_mutex_lock(&sock_mutex);
+    int rc = adv_active ? 0 : BLE_HS_EALREADY;
+    adv_active = false;
+    pthread_mutex_unlock(&sock_mutex);
+    return rc;
+}
+
+int ble_gap_adv_active(void)
+{
+    pthread_mutex_lock(&sock_mutex);
+    int active = adv_active;
+    pthread_mutex_unlock(&sock_mutex);
+    return active;
+}
+
+int ble_gap_conn_find(uint16_t handle, struct ble_gap_conn_desc *out_desc)
+{
+    pthread_mutex_lock(&sock_mutex);
+    sock_conn_t *conn = find_conn(handle);
+    if (conn && out_desc) {
+        fill_conn_desc(conn, out_desc);
+    }
+    pthread_mutex_unlock(&sock_mutex);
+    return conn ? 0 : BLE_HS_ENOTCONN;
+}
+
+int ble_gap_update_params(uint16_t conn_handle, const struct ble_gap_upd_params *params)
+{
+    pthread_mutex_lock(&sock_mutex);
+    sock_conn_t *conn = find_conn(conn_handle);
+    if (conn) {
+        conn->itvl = params->itvl_min ? params->itvl_min : 1;
+        conn->latency = params->latency;
+        conn->supervision_timeout = params->supervision_timeout;
+        conn->conn_update_pending = true;
+    }
+    pthread_mutex_unlock(&sock_mutex);
+    wake_run_loop();
+    return conn ? 0 : BLE_HS_ENOTCONN;
+}
+
+int ble_gap_terminate(uint16_t conn_handle, uint8_t hci_reason)
+{
+    (void)hci_reason;
+    pthread_mutex_lock(&sock_mutex);
+    sock_conn_t *conn = find_conn(conn_handle);
+    if (conn) {
+        conn->closing = true;
+    }
+    pthread_mutex_unlock(&sock_mutex);
+    wake_run_loop();
+    return conn ? 0 : BLE_HS_ENOTCONN;
+}
+
+int ble_hs_util_ensure_addr(int prefer_random)
+{
+    (void)prefer_random;
+    return 0;
+}
+
+void ble_svc_gap_init(void)
+{
+}
+
+void ble_svc_gatt_init(void)
+{
+}
+
+int ble_svc_gap_device_name_set(const char *name)
+{
+    snprintf(device_name, sizeof(device_name), "%s", name);
+    return 0;
+}
+
+const char *ble_svc_gap_device_name(void)
+{
+    return device_name;
+}
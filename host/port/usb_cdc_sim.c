@@ -0,0 +1,322 @@
+// USB Host and CDC-ACM host driver for the host build. The only device on the
+// "bus" is the NanoVNA V2 model in sim/nanovna_sim.c.
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "usb/usb_host.h"
+#include "usb/cdc_acm_host.h"
+#include "driver/gpio.h"
+
+#include "host_port.h"
+#include "nanovna_sim.h"
+
+#define SIM_NANOVNA_VID     0x04B4
+#define SIM_NANOVNA_PID     0x0008
+#define REPLY_BUFFER_SIZE   (16 * 1024)
+#define GLITCH_DOWN_MS      300
+#define OPEN_POLL_MS        10
+#define VBUS_ENUMERATE_MS   150     // Power-up to the device enumerating again
+#define FIFO_RECORD_SIZE    32
+
+typedef struct pending_reply {
+    struct pending_reply *next;
+    int64_t due_us;
+    size_t len;
+    uint8_t data[];
+} pending_reply_t;
+
+struct cdc_dev_s {
+    cdc_acm_host_device_config_t config;
+    bool open;
+};
+
+static size_t usb_packet_size = 64;
+static uint32_t glitch_period_ms = 0;
+static uint32_t byte_error_period = 0;
+static uint32_t lost_reply_period = 0;
+static uint32_t transfer_us = 0;
+static uint32_t fifo_reply_count = 0;
+static struct cdc_dev_s sim_dev;
+static volatile bool device_present = true;    // Cable plugged in (see glitch_task)
+static volatile bool vbus_on = true;            // Port powered (see gpio_set_level)
+static volatile int64_t vbus_ready_us = 0;      // When the device has enumerated after power-up
+
+static pthread_mutex_t reply_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t reply_cond = PTHREAD_COND_INITIALIZER;
+static pending_reply_t *reply_head = NULL;
+static pending_reply_t *reply_tail = NULL;
+static int64_t last_due_us = 0;
+
+void usb_cdc_sim_configure(size_t packet_size, uint32_t glitch_ms, uint32_t byte_errors, uint32_t lost_replies,
+                           uint32_t transfer_turnaround_us)
+{
+    usb_packet_size = packet_size ? packet_size : 64;
+    glitch_period_ms = glitch_ms;
+    byte_error_period = byte_errors;
+    lost_reply_period = lost_replies;
+    transfer_us = transfer_turnaround_us;
+}
+
+/**
+ * @brief Host turnaround for a `len`-byte reply: one per IN transfer the open handle's
+ * buffer splits it into.
+ */
+static uint32_t transfer_turnaround_us(size_t len)
+{
+    size_t transfer_size = sim_dev.config.in_buffer_size / usb_packet_size * usb_packet_size;
+    if (transfer_size == 0) {
+        transfer_size = usb_packet_size;
+    }
+    return (uint32_t)((len + transfer_size - 1) / transfer_size) * transfer_us;
+}
+
+/**
+ * @brief Damages FIFO replies (whole records, more than one) as a flaky link would: every
+ * lost_reply_period-th is lost, every byte_error_period-th loses or repeats one byte,
+ * alternately.
+ * @return the new reply length (reply->data has room for one extra byte)
+ */
+static size_t inject_link_errors(pending_reply_t *reply)
+{
+    if (reply->len <= FIFO_RECORD_SIZE || reply->len % FIFO_RECORD_SIZE != 0) {
+        return reply->len;
+    }
+    ++fifo_reply_count;
+    if (lost_reply_period > 0 && fifo_reply_count % lost_reply_period == 0) {
+        fprintf(stderr, "usb_cdc_sim: losing a %zu-byte FIFO reply\n", reply->len);
+        return 0;
+    }
+    if (byte_error_period == 0 || fifo_reply_count % byte_error_period != 0) {
+        return reply->len;
+    }
+    // Somewhere in the first half, so records are left to resynchronise on
+    const size_t pos = (size_t)rand() % (reply->len / 2);
+    const bool drop = ((fifo_reply_count / byte_error_period) % 2) != 0;
+    fprintf(stderr, "usb_cdc_sim: %s byte %zu of a %zu-byte FIFO reply\n", drop ? "dropping" : "repeating", pos, reply->len);
+    if (drop) {
+        memmove(reply->data + pos, reply->data + pos + 1, reply->len - pos - 1);
+        return reply->len - 1;
+    }
+    memmove(reply->data + pos + 1, reply->data + pos, reply->len - pos);
+    return reply->len + 1;
+}
+
+/**
+ * @brief True if the device is on the bus: plugged in, powered and enumerated.
+ */
+static bool device_attached(void)
+{
+    return device_present && vbus_on && esp_timer_get_time() >= vbus_ready_us;
+}
+
+/**
+ * @brief Reports the device gone to the open handle's event callback, as the CDC driver does.
+ */
+static void report_disconnect(void)
+{
+    if (sim_dev.open && sim_dev.config.event_cb) {
+        cdc_acm_host_dev_event_data_t event = {
+            .type = CDC_ACM_HOST_DEVICE_DISCONNECTED,
+            .data.cdc_hdl = &sim_dev,
+        };
+        sim_dev.config.event_cb(&event, sim_dev.config.user_arg);
+    }
+}
+
+/**
+ * @brief Periodically unplugs the device for GLITCH_DOWN_MS, reporting it like the CDC driver does.
+ */
+static void glitch_task(void *arg)
+{
+    (void)arg;
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(glitch_period_ms));
+        device_present = false;
+        if (sim_dev.open) {
+            fprintf(stderr, "usb_cdc_sim: cable glitch, device gone for %d ms\n", GLITCH_DOWN_MS);
+        }
+        report_disconnect();
+        vTaskDelay(pdMS_TO_TICKS(GLITCH_DOWN_MS));
+        device_present = true;
+    }
+}
+
+/**
+ * @brief Hands queued replies to the data callback in bulk-packet sized slices once they are due.
+ */
+static void reply_delivery_task(void *arg)
+{
+    (void)arg;
+    while (true) {
+        pthread_mutex_lock(&reply_mutex);
+        while (reply_head == NULL) {
+            pthread_cond_wait(&reply_cond, &reply_mutex);
+        }
+        pending_reply_t *reply = reply_head;
+        pthread_mutex_unlock(&reply_mutex);
+
+        int64_t wait_us = reply->due_us - esp_timer_get_time();
+        if (wait_us > 0) {
+            vTaskDelay((TickType_t)((wait_us + 999) / 1000));
+        }
+
+        pthread_mutex_lock(&reply_mutex);
+        reply_head = reply->next;
+        if (reply_head == NULL) {
+            reply_tail = NULL;
+        }
+        pthread_mutex_unlock(&reply_mutex);
+
+        reply->len = inject_link_errors(reply);
+        for (size_t off = 0; off < reply->len && sim_dev.open; off += usb_packet_size) {
+            size_t n = reply->len - off;
+            if (n > usb_packet_size) {
+                n = usb_packet_size;
+            }
+            if (sim_dev.config.data_cb) {
+                sim_dev.config.data_cb(reply->data + off, n, sim_dev.config.user_arg);
+            }
+        }
+        free(reply);
+    }
+}
+
+esp_err_t usb_host_install(const usb_host_config_t *config)
+{
+    (void)config;
+    return ESP_OK;
+}
+
+esp_err_t usb_host_lib_handle_events(uint32_t timeout_ticks, uint32_t *event_flags_ret)
+{
+    // Nothing is ever enumerated or freed on the simulated bus
+    vTaskDelay(timeout_ticks == portMAX_DELAY ? pdMS_TO_TICKS(1000) : timeout_ticks);
+    *event_flags_ret = 0;
+    return ESP_ERR_TIMEOUT;
+}
+
+esp_err_t usb_host_device_free_all(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t cdc_acm_host_install(const cdc_acm_host_driver_config_t *driver_config)
+{
+    // Replies are delivered from the driver task, on its configured core as on the device
+    const BaseType_t core_id = (driver_config != NULL) ? driver_config->xCoreID : tskNO_AFFINITY;
+    BaseType_t created = xTaskCreatePinnedToCore(reply_delivery_task, "usb_sim_rx", 4096, NULL, 0, NULL, core_id);
+    if (created == pdTRUE && glitch_period_ms > 0) {
+        created = xTaskCreate(glitch_task, "usb_sim_glitch", 4096, NULL, 0, NULL);
+    }
+    return created == pdTRUE ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t cdc_acm_host_open(uint16_t vid, uint16_t pid, uint8_t interface_idx,
+                            const cdc_acm_host_device_config_t *dev_config, cdc_acm_dev_hdl_t *cdc_hdl_ret)
+{
+    (void)interface_idx;
+    if (vid != SIM_NANOVNA_VID || pid != SIM_NANOVNA_PID) {
+        vTaskDelay(pdMS_TO_TICKS(dev_config->connection_timeout_ms));
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (sim_dev.open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // Like the real driver, wait up to the connection timeout for the device to appear
+    for (uint32_t waited_ms = 0; !device_attached(); waited_ms += OPEN_POLL_MS) {
+        if (waited_ms >= dev_config->connection_timeout_ms) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        vTaskDelay(pdMS_TO_TICKS(OPEN_POLL_MS));
+    }
+    sim_dev.config = *dev_config;
+    sim_dev.open = true;
+    *cdc_hdl_ret = &sim_dev;
+    return ESP_OK;
+}
+
+esp_err_t cdc_acm_host_close(cdc_acm_dev_hdl_t cdc_hdl)
+{
+    if (cdc_hdl != &sim_dev || !sim_dev.open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    sim_dev.open = false;
+    return ESP_OK;
+}
+
+esp_err_t cdc_acm_host_data_tx_blocking(cdc_acm_dev_hdl_t cdc_hdl, const uint8_t *data, size_t data_len,
+                                        uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+    if (cdc_hdl != &sim_dev || !sim_dev.open || !device_attached()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    pending_reply_t *reply = malloc(sizeof(*reply) + REPLY_BUFFER_SIZE + 1); // + a repeated byte
+    if (reply == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    uint32_t delay_us = 0;
+    reply->len = nanovna_sim_handle_tx(data, data_len, reply->data, REPLY_BUFFER_SIZE, &delay_us);
+    if (reply->len == 0) {
+        free(reply);
+        return ESP_OK;
+    }
+    reply->next = NULL;
+    delay_us += transfer_turnaround_us(reply->len);
+
+    pthread_mutex_lock(&reply_mutex);
+    // Replies leave the device in order: one cannot overtake a slower one queued before it
+    int64_t due_us = esp_timer_get_time() + delay_us;
+    reply->due_us = (due_us > last_due_us) ? due_us : last_due_us;
+    last_due_us = reply->due_us;
+    if (reply_tail) {
+        reply_tail->next = reply;
+    } else {
+        reply_head = reply;
+    }
+    reply_tail = reply;
+    pthread_cond_signal(&reply_cond);
+    pthread_mutex_unlock(&reply_mutex);
+    return ESP_OK;
+}
+
+esp_err_t cdc_acm_host_set_control_line_state(cdc_acm_dev_hdl_t cdc_hdl, bool dtr, bool rts)
+{
+    (void)dtr;
+    (void)rts;
+    return (cdc_hdl == &sim_dev && sim_dev.open) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+// =========================================================================
+// == GPIO                                                                ==
+// =========================================================================
+// Any output is taken to be the NanoVNA port's VBUS switch. Switching it off detaches the
+// device; the NanoVNA model keeps its registers, as a V2 on its own battery does.
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    return (config && config->pin_bit_mask != 0) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    (void)gpio_num;
+    const bool on = (level != 0);
+    if (on == vbus_on) {
+        return ESP_OK;
+    }
+    if (on) {
+        vbus_ready_us = esp_timer_get_time() + VBUS_ENUMERATE_MS * 1000;
+        vbus_on = true;
+        return ESP_OK;
+    }
+    vbus_on = false;
+    report_disconnect();
+    return ESP_OK;
+}
@@ -0,0 +1,173 @@
+// replay_main.c
+// Runs the replay and load-generator server (replay_server.c) as a Linux process: clients
+// connect over TCP (port/nimble_sock.c) and get result frames in the firmware's format at
+// the configured rate, jitter, burst size, MTU and loss.
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+#include "host_port.h"
+#include "replay_server.h"
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --port N               TCP port for BLE clients (default 7878)\n"
+            "  --conn-interval-ms N   BLE connection interval (default 30)\n"
+            "  --pkts-per-interval N  notifications per connection event (default 4)\n"
+            "  --mbufs N              notification mbuf pool size (default 12)\n"
+            "  --mtu N                ATT MTU the server offers (default 527)\n"
+            "  --rate-hz X            bursts per second (default 0: frames only on request)\n"
+            "  --burst N              frames per burst (default 1)\n"
+            "  --jitter-pct N         vary each burst period by up to N %% (default 0)\n"
+            "  --loss N               lose N permille of frames at random\n"
+            "  --loss-burst E,X       lose frames in bursts: start with E, end with X permille per frame\n"
+            "  --seed N               frame, jitter and loss seed (default 1)\n"
+            "  --reply-delay-ms N     time a DATA REQUESTED takes to answer (default 70)\n"
+            "  --replay PATH          replay the frames recorded by sim_client.py --record (default: synthetic)\n"
+            "  --log-level L          none|error|warn|info|debug|verbose (default info)\n"
+            "  --duration-s N         exit after N seconds (default: run until killed)\n",
+            prog);
+}
+
+static esp_log_level_t parse_log_level(const char *name)
+{
+    static const char *const names[] = { "none", "error", "warn", "info", "debug", "verbose" };
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+        if (strcmp(name, names[i]) == 0) {
+            return (esp_log_level_t)i;
+        }
+    }
+    return ESP_LOG_INFO;
+}
+
+/**
+ * @brief Reads the whole of `path` into a new buffer.
+ * @return NULL on failure
+ */
+static uint8_t *read_file(const char *path, size_t *len)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    uint8_t *data = NULL;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        const long size = ftell(file);
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0 && (data = malloc((size_t)size)) != NULL &&
+            fread(data, 1, (size_t)size, file) != (size_t)size) {
+            free(data);
+            data = NULL;
+        }
+        *len = (size > 0) ? (size_t)size : 0;
+    }
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    enum {
+        OPT_PORT = 256, OPT_INTERVAL, OPT_PKTS, OPT_MBUFS, OPT_MTU, OPT_RATE, OPT_BURST, OPT_JITTER, OPT_LOSS,
+        OPT_LOSS_BURST, OPT_SEED, OPT_REPLY_DELAY, OPT_REPLAY, OPT_LOG_LEVEL, OPT_DURATION,
+    };
+    static const struct option options[] = {
+        { "port",              required_argument, NULL, OPT_PORT },
+        { "conn-interval-ms",  required_argument, NULL, OPT_INTERVAL },
+        { "pkts-per-interval", required_argument, NULL, OPT_PKTS },
+        { "mbufs",             required_argument, NULL, OPT_MBUFS },
+        { "mtu",               required_argument, NULL, OPT_MTU },
+        { "rate-hz",           required_argument, NULL, OPT_RATE },
+        { "burst",             required_argument, NULL, OPT_BURST },
+        { "jitter-pct",        required_argument, NULL, OPT_JITTER },
+        { "loss",              required_argument, NULL, OPT_LOSS },
+        { "loss-burst",        required_argument, NULL, OPT_LOSS_BURST },
+        { "seed",              required_argument, NULL, OPT_SEED },
+        { "reply-delay-ms",    required_argument, NULL, OPT_REPLY_DELAY },
+        { "replay",            required_argument, NULL, OPT_REPLAY },
+        { "log-level",         required_argument, NULL, OPT_LOG_LEVEL },
+        { "duration-s",        required_argument, NULL, OPT_DURATION },
+        { "help",              no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    nimble_sock_config_t ble_config;
+    nimble_sock_default_config(&ble_config);
+    replay_server_config_t config;
+    replay_server_default_config(&config);
+    const char *replay_path = NULL;
+    unsigned duration_s = 0;
+    unsigned loss_enter = 0, loss_exit = 0;
+    double rate_hz = 0.0;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+        switch (opt) {
+        case OPT_PORT:        ble_config.tcp_port = (uint16_t)atoi(optarg); break;
+        case OPT_INTERVAL:    ble_config.conn_interval_ms = (uint32_t)atoi(optarg); break;
+        case OPT_PKTS:        ble_config.pkts_per_interval = (uint32_t)atoi(optarg); break;
+        case OPT_MBUFS:       ble_config.msys_mbufs = (uint32_t)atoi(optarg); break;
+        case OPT_MTU:         config.mtu = (uint16_t)atoi(optarg); break;
+        case OPT_RATE:        rate_hz = atof(optarg); break;
+        case OPT_BURST:       config.load.burst = (uint16_t)atoi(optarg); break;
+        case OPT_JITTER:      config.load.jitter_pct = (uint8_t)atoi(optarg); break;
+        case OPT_LOSS:
+            config.load.loss = REPLAY_LOSS_RANDOM;
+            config.load.loss_permille = (uint16_t)atoi(optarg);
+            break;
+        case OPT_LOSS_BURST:
+            if (sscanf(optarg, "%u,%u", &loss_enter, &loss_exit) != 2) {
+                fprintf(stderr, "--loss-burst takes ENTER,EXIT in permille\n");
+                return 2;
+            }
+            config.load.loss = REPLAY_LOSS_BURSTY;
+            config.load.loss_permille = (uint16_t)loss_enter;
+            config.load.exit_permille = (uint16_t)loss_exit;
+            break;
+        case OPT_SEED:        config.load.seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case OPT_REPLY_DELAY: config.reply_delay_ms = (uint32_t)atoi(optarg); break;
+        case OPT_REPLAY:      replay_path = optarg; break;
+        case OPT_LOG_LEVEL:   esp_log_level_set("*", parse_log_level(optarg)); break;
+        case OPT_DURATION:    duration_s = (unsigned)atoi(optarg); break;
+        default:
+            usage(argv[0]);
+            return (opt == 'h') ? 0 : 2;
+        }
+    }
+    if (ble_config.conn_interval_ms == 0 || ble_config.pkts_per_interval == 0) {
+        fprintf(stderr, "Connection interval and packets per interval must be non-zero\n");
+        return 2;
+    }
+    config.load.period_us = (rate_hz > 0.0) ? (uint32_t)(1e6 / rate_hz) : 0;
+    if (!replay_load_config_valid(&config.load)) {
+        fprintf(stderr, "Invalid load: burst 1-%d, jitter 0-100 %%, loss 0-1000 permille, up to %d bursts a second\n",
+                REPLAY_LOAD_BURST_MAX, 1000000 / REPLAY_LOAD_PERIOD_MIN_US);
+        return 2;
+    }
+    uint8_t *recording = NULL;
+    if (replay_path != NULL) {
+        recording = read_file(replay_path, &config.recording_len);
+        if (recording == NULL || replay_load_recording_count(recording, config.recording_len) == 0) {
+            fprintf(stderr, "Cannot replay %s: missing, empty or not a frame recording\n", replay_path);
+            return 2;
+        }
+        config.recording = recording;
+        fprintf(stderr, "replay: %zu frames from %s\n", replay_load_recording_count(recording, config.recording_len),
+                replay_path);
+    }
+    nimble_sock_configure(&ble_config);
+
+    replay_server_start(&config);
+
+    if (duration_s) {
+        sleep(duration_s);
+        return 0;
+    }
+    while (true) {
+        pause();
+    }
+}
@@ -0,0 +1,447 @@
+// nanovna_sim.c
+// See nanovna_sim.h. Only the parts of the V2 protocol the firmware uses are
+// modelled: register reads/writes, FIFO reads and the sweep position counter.
+#include <math.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nanovna_sim.h"
+
+#define OP_NOP        0x00
+#define OP_INDICATE   0x0d
+#define OP_READ       0x10
+#define OP_READ2      0x11
+#define OP_READ4      0x12
+#define OP_READFIFO   0x18
+#define OP_WRITE      0x20
+#define OP_WRITE2     0x21
+#define OP_WRITE4     0x22
+#define OP_WRITE8     0x23
+#define OP_WRITEFIFO  0x28
+
+#define REG_SWEEP_START_HZ    0x00
+#define REG_SWEEP_STEP_HZ     0x10
+#define REG_SWEEP_POINTS      0x20
+#define REG_VALUES_PER_FREQ   0x22
+#define REG_FIFO              0x30
+#define REG_DEVICE_VARIANT    0xf0
+#define REG_PROTOCOL_VERSION  0xf1
+#define REG_HARDWARE_REV      0xf2
+#define REG_FIRMWARE_MAJOR    0xf3
+#define REG_FIRMWARE_MINOR    0xf4
+
+#define INDICATE_REPLY        0x32  // '2': protocol V2
+#define RECORD_SIZE           32
+#define MAX_COMMAND_LEN       (3 + 255)
+#define FWD_AMPLITUDE         1.0e6
+
+#define SYNTHETIC_DIP_HZ      2.3e9
+#define SYNTHETIC_DIP_DB      (-35.0)
+#define SYNTHETIC_WIDTH_HZ    15e6
+#define SPUR_WIDTH_HZ         3e6
+#define REFERENCE_VALUES_PER_FREQ 10  // point_us and noise_db are for this much averaging per point
+
+// Fixture error terms (--fixture): magnitude and delay of e00, e11 and e10e01
+#define FIXTURE_DIRECTIVITY       0.08
+#define FIXTURE_DIRECTIVITY_NS    0.3
+#define FIXTURE_SOURCE_MATCH      0.12
+#define FIXTURE_SOURCE_MATCH_NS   0.7
+#define FIXTURE_TRACKING          0.85
+#define FIXTURE_TRACKING_NS       2.0   // Round trip through the fixture
+
+typedef struct {
+    double ghz;
+    double db;
+} curve_point_t;
+
+static nanovna_sim_config_t sim_config;
+static pthread_mutex_t sim_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static curve_point_t *curve = NULL;
+static size_t curve_len = 0;
+
+static uint8_t regs[256];
+static uint16_t sweep_position = 0;   // freqIndex of the next FIFO record
+
+static uint8_t cmd_buf[MAX_COMMAND_LEN];
+static size_t cmd_len = 0;
+
+static uint32_t rng_state;
+static volatile sig_atomic_t attached_load = NANOVNA_SIM_LOAD_SENSOR;
+
+// =========================================================================
+// == Curve                                                               ==
+// =========================================================================
+
+static int compare_curve_points(const void *a, const void *b)
+{
+    double fa = ((const curve_point_t *)a)->ghz;
+    double fb = ((const curve_point_t *)b)->ghz;
+    return (fa > fb) - (fa < fb);
+}
+
+/**
+ * @brief Reads the rows of the CSV whose permittivity is closest to the requested one.
+ */
+static bool load_curve(const char *path, double permittivity)
+{
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        return false;
+    }
+
+    // First pass: the nearest permittivity present in the file
+    char line[256];
+    double best_perm = NAN;
+    while (fgets(line, sizeof(line), f)) {
+        double ghz, db, perm;
+        if (sscanf(line, "%lf,%lf,%lf", &ghz, &db, &perm) == 3 &&
+            (isnan(best_perm) || fabs(perm - permittivity) < fabs(best_perm - permittivity))) {
+            best_perm = perm;
+        }
+    }
+    if (isnan(best_perm)) {
+        fclose(f);
+        return false;
+    }
+
+    rewind(f);
+    size_t cap = 1024;
+    curve = malloc(cap * sizeof(*curve));
+    curve_len = 0;
+    while (curve && fgets(line, sizeof(line), f)) {
+        double ghz, db, perm;
+        if (sscanf(line, "%lf,%lf,%lf", &ghz, &db, &perm) != 3 || perm != best_perm) {
+            continue;
+        }
+        if (curve_len == cap) {
+            cap *= 2;
+            curve_point_t *grown = realloc(curve, cap * sizeof(*curve));
+            if (grown == NULL) {
+                break;
+            }
+            curve = grown;
+        }
+        curve[curve_len++] = (curve_point_t){ .ghz = ghz, .db = db };
+    }
+    fclose(f);
+
+    if (curve_len < 2) {
+        free(curve);
+        curve = NULL;
+        curve_len = 0;
+        return false;
+    }
+    qsort(curve, curve_len, sizeof(*curve), compare_curve_points);
+    fprintf(stderr, "nanovna_sim: %zu points for permittivity %.1f from %s\n", curve_len, best_perm, path);
+    return true;
+}
+
+static double sensor_s11_db(double freq_hz)
+{
+    if (curve == NULL) {
+        // Lorentzian dip on a -1 dB baseline
+        double x = (freq_hz - SYNTHETIC_DIP_HZ) / SYNTHETIC_WIDTH_HZ;
+        return -1.0 + (SYNTHETIC_DIP_DB + 1.0) / (1.0 + x * x);
+    }
+
+    double ghz = freq_hz / 1e9 - sim_config.shift_ghz;
+    if (ghz <= curve[0].ghz) {
+        return curve[0].db;
+    }
+    if (ghz >= curve[curve_len - 1].ghz) {
+        return curve[curve_len - 1].db;
+    }
+    size_t lo = 0, hi = curve_len - 1;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (curve[mid].ghz <= ghz) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    double t = (ghz - curve[lo].ghz) / (curve[hi].ghz - curve[lo].ghz);
+    return curve[lo].db + t * (curve[hi].db - curve[lo].db);
+}
+
+double nanovna_sim_s11_db(double freq_hz)
+{
+    double db = sensor_s11_db(freq_hz);
+    if (sim_config.spur_db != 0.0) {
+        // Narrow spurious dip added on top of the sensor's
+        double x = (freq_hz - sim_config.spur_ghz * 1e9) / SPUR_WIDTH_HZ;
+        db += sim_config.spur_db / (1.0 + x * x);
+    }
+    return db;
+}
+
+// =========================================================================
+// == Registers and FIFO                                                  ==
+// =========================================================================
+
+static uint64_t reg_read(uint8_t addr, size_t len)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < len; i++) {
+        value |= (uint64_t)regs[(uint8_t)(addr + i)] << (8 * i);
+    }
+    return value;
+}
+
+static void reg_write(uint8_t addr, const uint8_t *value, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        regs[(uint8_t)(addr + i)] = value[i];
+    }
+    if (addr == REG_FIFO) {
+        sweep_position = 0; // Any write to the FIFO register clears it
+    } else if (addr < REG_FIFO) {
+        sweep_position = 0; // Sweep parameters changed: the sweep restarts
+    }
+}
+
+static double gaussian(void)
+{
+    // Box-Muller on a xorshift32 stream
+    double u1, u2;
+    do {
+        rng_state ^= rng_state << 13; rng_state ^= rng_state >> 17; rng_state ^= rng_state << 5;
+        u1 = rng_state / 4294967296.0;
+        rng_state ^= rng_state << 13; rng_state ^= rng_state >> 17; rng_state ^= rng_state << 5;
+        u2 = rng_state / 4294967296.0;
+    } while (u1 <= 0.0);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+void nanovna_sim_set_load(nanovna_sim_load_t load)
+{
+    attached_load = load;
+}
+
+nanovna_sim_load_t nanovna_sim_get_load(void)
+{
+    return (nanovna_sim_load_t)attached_load;
+}
+
+/**
+ * @brief Reflection the port sees through the fixture: e00 + e10e01 G / (1 - e11 G).
+ */
+static void fixture_reflection(double freq_hz, double *re, double *im)
+{
+    const double w = 2.0 * M_PI * freq_hz * 1e-9; // Phase per ns of delay
+    const double e00_re = FIXTURE_DIRECTIVITY * cos(w * FIXTURE_DIRECTIVITY_NS);
+    const double e00_im = -FIXTURE_DIRECTIVITY * sin(w * FIXTURE_DIRECTIVITY_NS);
+    const double e11_re = FIXTURE_SOURCE_MATCH * cos(w * FIXTURE_SOURCE_MATCH_NS);
+    const double e11_im = -FIXTURE_SOURCE_MATCH * sin(w * FIXTURE_SOURCE_MATCH_NS);
+    const double t_re = FIXTURE_TRACKING * cos(w * FIXTURE_TRACKING_NS);
+    const double t_im = -FIXTURE_TRACKING * sin(w * FIXTURE_TRACKING_NS);
+
+    // num = e10e01 G, den = 1 - e11 G
+    const double num_re = t_re * *re - t_im * *im, num_im = t_re * *im + t_im * *re;
+    const double den_re = 1.0 - (e11_re * *re - e11_im * *im), den_im = -(e11_re * *im + e11_im * *re);
+    const double den_sq = den_re * den_re + den_im * den_im;
+    *re = e00_re + (num_re * den_re + num_im * den_im) / den_sq;
+    *im = e00_im + (num_im * den_re - num_re * den_im) / den_sq;
+}
+
+static void put_i32(uint8_t *out, int32_t v)
+{
+    memcpy(out, &v, sizeof(v)); // Host is little-endian like the device
+}
+
+/**
+ * @brief Values averaged per point, as programmed (at least 1).
+ */
+static double values_per_freq(void)
+{
+    const uint16_t values = (uint16_t)reg_read(REG_VALUES_PER_FREQ, 2);
+    return (values > 0) ? (double)values : 1.0;
+}
+
+/**
+ * @brief Emits one 32-byte FIFO record for the current sweep position and advances it.
+ */
+static void emit_record(uint8_t *out)
+{
+    uint16_t points = (uint16_t)reg_read(REG_SWEEP_POINTS, 2);
+    if (points == 0) {
+        points = 1;
+    }
+    if (sweep_position >= points) {
+        sweep_position = 0;
+    }
+    double freq_hz = (double)reg_read(REG_SWEEP_START_HZ, 8) + (double)sweep_position * (double)reg_read(REG_SWEEP_STEP_HZ, 8);
+    double re, im;
+    switch (attached_load) {
+    case NANOVNA_SIM_LOAD_OPEN:  re = 1.0;  im = 0.0; break;
+    case NANOVNA_SIM_LOAD_SHORT: re = -1.0; im = 0.0; break;
+    case NANOVNA_SIM_LOAD_MATCH: re = 0.0;  im = 0.0; break;
+    default: {
+        double db = nanovna_sim_s11_db(freq_hz);
+        if (sim_config.noise_db > 0.0) {
+            db += sim_config.noise_db * sqrt(REFERENCE_VALUES_PER_FREQ / values_per_freq()) * gaussian();
+        }
+        double mag = pow(10.0, db / 20.0);
+        double phase = fmod(freq_hz / 1e9, 1.0) * 2.0 * M_PI; // Arbitrary but smooth
+        re = mag * cos(phase);
+        im = mag * sin(phase);
+        break;
+    }
+    }
+    if (sim_config.fixture) {
+        fixture_reflection(freq_hz, &re, &im);
+    }
+
+    memset(out, 0, RECORD_SIZE);
+    put_i32(out + 0, (int32_t)FWD_AMPLITUDE);                   // fwd0Re
+    put_i32(out + 4, 0);                                        // fwd0Im
+    put_i32(out + 8, (int32_t)lround(re * FWD_AMPLITUDE));      // rev0Re
+    put_i32(out + 12, (int32_t)lround(im * FWD_AMPLITUDE));     // rev0Im
+    memcpy(out + 24, &sweep_position, sizeof(sweep_position));  // freqIndex
+    sweep_position = (uint16_t)((sweep_position + 1) % points);
+}
+
+// =========================================================================
+// == Command Parser                                                      ==
+// =========================================================================
+
+/**
+ * @brief Total length of the command starting in cmd_buf, or 0 if not yet known.
+ */
+static size_t command_length(void)
+{
+    switch (cmd_buf[0]) {
+    case OP_NOP:
+    case OP_INDICATE:   return 1;
+    case OP_READ:
+    case OP_READ2:
+    case OP_READ4:      return 2;
+    case OP_READFIFO:
+    case OP_WRITE:      return 3;
+    case OP_WRITE2:     return 4;
+    case OP_WRITE4:     return 6;
+    case OP_WRITE8:     return 10;
+    case OP_WRITEFIFO:  return (cmd_len >= 3) ? 3 + (size_t)cmd_buf[2] : 0;
+    default:            return 1; // Unknown opcodes are skipped byte by byte
+    }
+}
+
+/**
+ * @brief Executes the complete command in cmd_buf.
+ * @return number of reply bytes written
+ */
+static size_t execute_command(uint8_t *reply, size_t reply_cap, uint32_t *delay_us)
+{
+    const uint8_t addr = cmd_buf[1];
+    size_t out = 0;
+
+    switch (cmd_buf[0]) {
+    case OP_INDICATE:
+        if (reply_cap >= 1) {
+            reply[out++] = INDICATE_REPLY;
+        }
+        break;
+    case OP_READ:
+    case OP_READ2:
+    case OP_READ4: {
+        size_t len = (cmd_buf[0] == OP_READ) ? 1 : (cmd_buf[0] == OP_READ2) ? 2 : 4;
+        for (size_t i = 0; i < len && out < reply_cap; i++) {
+            reply[out++] = regs[(uint8_t)(addr + i)];
+        }
+        break;
+    }
+    case OP_READFIFO: {
+        size_t count = cmd_buf[2];
+        if (addr != REG_FIFO) {
+            break;
+        }
+        for (size_t i = 0; i < count && out + RECORD_SIZE <= reply_cap; i++) {
+            emit_record(reply + out);
+            out += RECORD_SIZE;
+        }
+        *delay_us += (uint32_t)(count * sim_config.point_us * values_per_freq() / REFERENCE_VALUES_PER_FREQ);
+        break;
+    }
+    case OP_WRITE:
+        reg_write(addr, cmd_buf + 2, 1);
+        break;
+    case OP_WRITE2:
+        reg_write(addr, cmd_buf + 2, 2);
+        break;
+    case OP_WRITE4:
+        reg_write(addr, cmd_buf + 2, 4);
+        break;
+    case OP_WRITE8:
+        reg_write(addr, cmd_buf + 2, 8);
+        break;
+    case OP_WRITEFIFO:
+        if (addr != REG_FIFO) {
+            reg_write(addr, cmd_buf + 3, cmd_buf[2]);
+        }
+        break;
+    default:
+        break;
+    }
+    return out;
+}
+
+size_t nanovna_sim_handle_tx(const uint8_t *data, size_t len, uint8_t *reply, size_t reply_cap, uint32_t *delay_us)
+{
+    size_t out = 0;
+    *delay_us = sim_config.latency_us;
+
+    pthread_mutex_lock(&sim_mutex);
+    for (size_t i = 0; i < len; i++) {
+        cmd_buf[cmd_len++] = data[i];
+        size_t needed = command_length();
+        if (needed != 0 && cmd_len >= needed) {
+            out += execute_command(reply + out, reply_cap - out, delay_us);
+            cmd_len = 0;
+        }
+    }
+    pthread_mutex_unlock(&sim_mutex);
+    return out;
+}
+
+void nanovna_sim_default_config(nanovna_sim_config_t *config)
+{
+    *config = (nanovna_sim_config_t){
+        .curve_path = "V2_Perm_Processed.csv",
+        .permittivity = 56.0,
+        .shift_ghz = 0.75,   // Moves the 1.55 GHz dip of the 56 curve into the 2.2-2.4 GHz sweep
+        .noise_db = 0.05,
+        .latency_us = 1000,
+        .point_us = 50,
+        .seed = 1,
+    };
+}
+
+bool nanovna_sim_init(const nanovna_sim_config_t *config)
+{
+    sim_config = *config;
+    rng_state = config->seed ? config->seed : 1;
+
+    memset(regs, 0, sizeof(regs));
+    regs[REG_DEVICE_VARIANT] = 0x02;
+    regs[REG_PROTOCOL_VERSION] = 0x01;
+    regs[REG_HARDWARE_REV] = 0x03;
+    regs[REG_FIRMWARE_MAJOR] = 0x01;
+    regs[REG_FIRMWARE_MINOR] = 0x00;
+    regs[REG_SWEEP_POINTS] = 101; // Power-on default sweep; the firmware reprograms it
+    sweep_position = 0;
+    cmd_len = 0;
+
+    if (config->curve_path == NULL) {
+        return true;
+    }
+    if (!load_curve(config->curve_path, config->permittivity)) {
+        fprintf(stderr, "nanovna_sim: cannot use curve %s, using a synthetic dip at %.3f GHz\n",
+                config->curve_path, SYNTHETIC_DIP_HZ / 1e9);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,74 @@
+// nanovna_sim.h
+// Register-level model of a NanoVNA V2 for the host build. Bytes written to
+// the simulated CDC-ACM device are parsed as V2 protocol commands; replies are
+// produced as a byte stream with a modelled delay.
+#ifndef NANOVNA_SIM_H
+#define NANOVNA_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const char *curve_path;   // V2_Perm_Processed.csv style file; NULL or unreadable -> synthetic dip
+    double permittivity;      // Tested_Perm column to use (nearest available)
+    double shift_ghz;         // Added to the curve's frequency axis
+    double noise_db;          // Std deviation of Gaussian noise on |S11| in dB (at 10 values per point)
+    double spur_ghz;          // Centre of a spurious dip
+    double spur_db;           // Its depth in dB (negative; 0 = none)
+    uint32_t latency_us;      // Delay before the first byte of any reply
+    uint32_t point_us;        // Extra delay per FIFO record read (sweep time per point, at 10 values per point)
+    uint32_t seed;            // Noise RNG seed
+    bool fixture;             // Put a lossy, mismatched fixture between the port and the load
+} nanovna_sim_config_t;
+
+typedef enum {
+    NANOVNA_SIM_LOAD_SENSOR = 0,  // The S11 curve
+    NANOVNA_SIM_LOAD_OPEN,        // Ideal calibration standards
+    NANOVNA_SIM_LOAD_SHORT,
+    NANOVNA_SIM_LOAD_MATCH,
+    NANOVNA_SIM_LOAD_COUNT,
+} nanovna_sim_load_t;
+
+/**
+ * @brief Fills `config` with the defaults used when no options are given.
+ */
+void nanovna_sim_default_config(nanovna_sim_config_t *config);
+
+/**
+ * @brief Loads the S11 curve and resets the register file. Call once before use.
+ * @return false if the curve file was given but could not be used (a synthetic dip is used instead)
+ */
+bool nanovna_sim_init(const nanovna_sim_config_t *config);
+
+/**
+ * @brief Parses host-to-device bytes. Any reply bytes are appended to `reply`
+ * (capacity `reply_cap`); `*delay_us` receives the modelled time before the reply is available.
+ * @return number of reply bytes written
+ */
+size_t nanovna_sim_handle_tx(const uint8_t *data, size_t len, uint8_t *reply, size_t reply_cap, uint32_t *delay_us);
+
+/**
+ * @brief Selects what is connected at the far side of the fixture. Async-signal-safe.
+ */
+void nanovna_sim_set_load(nanovna_sim_load_t load);
+
+/**
+ * @brief What is connected now.
+ */
+nanovna_sim_load_t nanovna_sim_get_load(void);
+
+/**
+ * @brief Simulated S11 in dB at `freq_hz`, without noise. Exposed for logging/tests of the curve.
+ */
+double nanovna_sim_s11_db(double freq_hz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NANOVNA_SIM_H
@@ -0,0 +1,552 @@
+"""
+Minimal BLE-over-TCP client for the host build (khealth_host). Connects like the
+Android app would, sends text commands to the result characteristic and decodes
+the result frames and sweep curves that come back.
+
+Usage:
+  python host/sim_client.py                         # one "DATA REQUESTED" reading
+  python host/sim_client.py --count 20              # 20 readings, latency summary
+  python host/sim_client.py --count 12 --burst      # 12 requests at once: queued, coalesced, some rejected
+  python host/sim_client.py --command "STREAM 200" --listen-s 5
+  python host/sim_client.py --command "SWEEP DUMP ON" --command "DATA REQUESTED"
+  python host/sim_client.py --count 50 --stats      # then print the firmware's latency histograms
+  python host/sim_client.py --trace 20              # one reading, then dump the trace buffer
+  python host/sim_client.py --command "STREAM 200"  # start streaming and disconnect: readings are journaled
+  python host/sim_client.py --count 0 --sync        # fetch and acknowledge the journaled readings
+  python host/sim_client.py --count 5 --history "LAST 500 40"  # 5 readings, then points 500-539 of the last sweep
+  python host/sim_client.py --profile fast --count 5   # switch to the "fast" sweep profile, then 5 readings
+  python host/sim_client.py --tune 4                # benchmark USB chunk/buffer sizes, print the report, then a reading
+  python host/sim_client.py --command "STREAM 200" --listen-s 10 --record frames.bin  # for khealth_replay --replay
+  python host/sim_client.py --port 7879 --command "LOAD 200 4 20" --listen-s 10 --quiet  # against khealth_replay
+"""
+import argparse
+import socket
+import struct
+import sys
+import time
+
+RESULT_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5be'
+SWEEP_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5bf'
+MODEL_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5c0'
+DIAG_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5c1'
+TRACE_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5c2'
+JOURNAL_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5c3'
+HISTORY_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5c4'
+HISTORY_STATUS = ['OK', 'NOT_HELD', 'BAD_RANGE']
+HISTORY_NOT_MEASURED = -32768
+PROFILE_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5c5'
+USB_TUNE_CHR_UUID = 'a8261b36-07ea-f5b7-8846-e1363e48b5c6'
+USB_TUNE_STATES = ['IDLE', 'RUNNING', 'DONE', 'FAILED']
+
+FLAG_NOTIFY = 0x0010
+RESULT_FLAGS = ['VALID', 'READ_ERROR', 'NO_MINIMUM', 'HAS_MODEL', 'STREAMED', 'SKIPPED', 'COALESCED', 'REJECTED']
+SWEEP_FIRST, SWEEP_LAST = 1, 2
+LATENCY_STAGES = ['trigger_wait', 'program', 'chunk_tx', 'chunk_rx', 'chunk_process',
+                  'sweep', 'model', 'notify', 'total', 'wake']
+CHUNK_TIMING_KINDS = ['first_point', 'packet_gap']
+TRACE_EVENTS = ['lost', 'sweep_start', 'sweep_end', 'chunk', 'point', 'bad_index',
+                'usb_event', 'ble_cmd', 'notify_fail', 'request', 'served', 'point_dropped',
+                'fifo_resync', 'fifo_reread', 'power_state']
+POWER_STATES = ['active', 'idle', 'suspended']
+
+
+def print_latency_stats(data):
+    """Prints the diagnostics characteristic (layouts in latency_stats.h, chunk_timing.h and power_idle.h)."""
+    fmt, stage_count, _, window_ms = struct.unpack_from('<BBHI', data, 0)
+    print(f'latency stats: format {fmt}, {window_ms / 1000:.1f} s since reset')
+    print(f'  {"stage":<14} {"count":>7} {"min us":>9} {"avg us":>9} {"max us":>9} {"p99 us":>9}')
+    for i in range(stage_count):
+        count, lo, avg, hi, p99 = struct.unpack_from('<5I', data, 8 + 20 * i)
+        name = LATENCY_STAGES[i] if i < len(LATENCY_STAGES) else f'stage {i}'
+        print(f'  {name:<14} {count:>7} {lo:>9} {avg:>9} {hi:>9} {p99:>9}')
+    timing = data[8 + 20 * stage_count:]
+    if len(timing) >= 16:
+        fmt, kind_count, _, timeouts, retries_ok, stalls = struct.unpack_from('<BBHIII', timing, 0)
+        print(f'chunk timing (full chunk): format {fmt}, {timeouts} first-point timeouts '
+              f'({retries_ok} recovered by the retry), {stalls} stalls')
+        print(f'  {"kind":<14} {"samples":>7} {"mean us":>9} {"sd us":>9} {"deadline":>9}')
+        for i in range(kind_count):
+            samples, mean, sd, deadline = struct.unpack_from('<4I', timing, 16 + 16 * i)
+            name = CHUNK_TIMING_KINDS[i] if i < len(CHUNK_TIMING_KINDS) else f'kind {i}'
+            print(f'  {name:<14} {samples:>7} {mean:>9} {sd:>9} {deadline:>9}')
+        power = timing[16 + 16 * kind_count:]
+        if len(power) >= 16 + 4 * len(POWER_STATES):
+            fmt, state, _, idles, suspends, wakes = struct.unpack_from('<BBHIII', power, 0)
+            times = struct.unpack_from(f'<{len(POWER_STATES)}I', power, 16)
+            state_name = POWER_STATES[state] if state < len(POWER_STATES) else str(state)
+            spent = ', '.join(f'{name} {ms / 1000:.1f} s' for name, ms in zip(POWER_STATES, times))
+            print(f'power: format {fmt}, {state_name} now, {idles} idle entries, {suspends} suspends, '
+                  f'{wakes} wakes; {spent}')
+
+
+def uuid_from_nimble(raw):
+    """NimBLE stores 128-bit UUIDs little-endian; return the usual string form."""
+    h = raw[::-1].hex()
+    return f'{h[0:8]}-{h[8:12]}-{h[12:16]}-{h[16:20]}-{h[20:32]}'
+
+
+def decode_result_frame(data):
+    """Decodes a version 3 or 4 result frame (layout in result_frame.h)."""
+    if len(data) < 22 or data[0] not in (3, 4):
+        return None
+    (version, flags, seq, ts_ms, res_hz, s11_cdb, points, request_id,
+     sweeps, dip_count, noise_cdb) = struct.unpack_from('<BBHIIhHHBBh', data)
+    frame = {
+        'seq': seq, 'request': request_id, 'timestamp_ms': ts_ms, 'resonance_ghz': res_hz / 1e9,
+        's11_db': s11_cdb / 100.0, 'points': points,
+        'flags': [name for bit, name in enumerate(RESULT_FLAGS) if flags & (1 << bit)],
+    }
+    if sweeps >= 2:
+        frame['sweeps'] = sweeps
+        frame['noise_db'] = noise_cdb / 100.0
+    offset = 22
+    if flags & (1 << 3) and len(data) >= 26:
+        frame['model'] = struct.unpack_from('<f', data, 22)[0]
+        offset = 26
+    if version >= 4 and dip_count and len(data) >= offset + 10 * dip_count:
+        frame['dips'] = [(hz / 1e9, cdb / 100.0, prom / 100.0, width_khz)
+                         for hz, cdb, prom, width_khz in struct.iter_unpack('<IhHH', data[offset:offset + 10 * dip_count])]
+    return frame
+
+
+class PacketAssembler:
+    """Reassembles sweep_transfer.h packets into their payload stream, like
+    SweepTransferAssembler in the Android app. Trace dumps use the same packets."""
+
+    def __init__(self):
+        self.stream = bytearray()
+        self.transfer_id = None
+        self.next_index = 0
+
+    def add(self, packet):
+        flags, transfer_id, index = struct.unpack_from('<BBH', packet)
+        if flags & SWEEP_FIRST:
+            self.stream = bytearray()
+            self.transfer_id = transfer_id
+            self.next_index = 0
+        if transfer_id != self.transfer_id or index != self.next_index:
+            print(f'transfer {transfer_id}: expected packet {self.next_index}, got {index}')
+            self.transfer_id = None
+            return None
+        self.stream += packet[4:]
+        self.next_index += 1
+        if not flags & SWEEP_LAST:
+            return None
+        self.transfer_id = None
+        return bytes(self.stream)
+
+
+def decode_sweep_curve(stream):
+    start, step, points, value = struct.unpack_from('<IIHh', stream)
+    deltas = struct.unpack_from(f'<{points - 1}h', stream, 12)
+    curve = [value]
+    for d in deltas:
+        value += d
+        curve.append(value)
+    return start, step, [v / 100.0 for v in curve]
+
+
+def print_trace_dump(stream, tail):
+    """Summarises a trace dump (layout in trace_buffer.h) and prints its last `tail` records."""
+    fmt, record_len, count = struct.unpack_from('<BBH', stream)
+    records = [struct.unpack_from('<IIBBHi', stream, 4 + record_len * i) for i in range(count)]
+    by_event = {}
+    for r in records:
+        name = TRACE_EVENTS[r[2]] if r[2] < len(TRACE_EVENTS) else str(r[2])
+        by_event[name] = by_event.get(name, 0) + 1
+    print(f'trace dump: format {fmt}, {count} records: ' +
+          ', '.join(f'{n} {name}' for name, n in sorted(by_event.items())))
+    for seq, time_us, event, flags, index, value in records[-tail:] if tail else []:
+        name = TRACE_EVENTS[event] if event < len(TRACE_EVENTS) else str(event)
+        print(f'  {seq:>7} {time_us:>11} us {name:<12} flags=0x{flags:02x} index={index} value={value}')
+
+
+def decode_journal_sync(stream):
+    """Splits a journal sync stream (layout in result_journal.h) into (seq, frame) pairs."""
+    records = []
+    offset = 1  # Format byte
+    while offset + 5 <= len(stream):
+        seq, length = struct.unpack_from('<IB', stream, offset)
+        records.append((seq, decode_result_frame(stream[offset + 5:offset + 5 + length])))
+        offset += 5 + length
+    return stream[0], records
+
+
+def print_journal_status(data):
+    """Prints the journal characteristic's read value (layout in usb_cdc.c)."""
+    fmt, acked, newest, pending, dropped, capacity = struct.unpack_from('<B5I', data)
+    print(f'journal: format {fmt}, acked {acked}, newest {newest}, {pending} pending, '
+          f'{dropped} dropped, capacity {capacity}')
+
+
+def print_history_status(data):
+    """Prints the history characteristic's read value (layout in usb_cdc.c)."""
+    fmt, slots, max_points, held, oldest, newest = struct.unpack_from('<B3H2I', data)
+    print(f'history: format {fmt}, {held}/{slots} sweeps of up to {max_points} points, seq {oldest}-{newest}')
+
+
+def print_history_transfer(stream, quiet):
+    """Prints a history transfer (layout in sweep_history.h)."""
+    (fmt, status, first, count, points, seq, timestamp_ms, start_hz, step_hz,
+     flags, averaged) = struct.unpack_from('<BBHHHIIIIBB', stream)
+    status_name = HISTORY_STATUS[status] if status < len(HISTORY_STATUS) else str(status)
+    values = struct.unpack_from(f'<{2 * count}h', stream, 28)
+    measured = [(first + i, values[2 * i] / 100, values[2 * i + 1] * 360 / 65536)
+                for i in range(count) if values[2 * i] != HISTORY_NOT_MEASURED]
+    span = f'points {first}-{first + count - 1}' if count else f'no points from {first}'
+    print(f'history sweep {seq}: {status_name}, {span} of {points} '
+          f'({len(measured)} measured), taken at {timestamp_ms} ms, flags 0x{flags:02x}, {averaged} averaged')
+    if measured:
+        i, s11, phase = min(measured, key=lambda m: m[1])
+        print(f'  min {s11:.2f} dB / {phase:.1f} deg at {(start_hz + i * step_hz) / 1e9:.6f} GHz (point {i})')
+    if not quiet:
+        for i, s11, phase in measured[:5]:
+            print(f'  {i:>5} {(start_hz + i * step_hz) / 1e9:.6f} GHz {s11:8.2f} dB {phase:7.1f} deg')
+
+
+def decode_profiles(data):
+    """Decodes the profile characteristic's read value (layout in sweep_profile.h)."""
+    fmt, active, count = struct.unpack_from('<BBB', data)
+    profiles = []
+    for i in range(count):
+        name, start_hz, step_hz, points, vpf, chunk = struct.unpack_from('<12sQIHHB', data, 3 + 29 * i)
+        profiles.append({'name': name.rstrip(b'\0').decode(), 'start_hz': start_hz, 'step_hz': step_hz,
+                         'points': points, 'vpf': vpf, 'chunk': chunk})
+    return fmt, active, profiles
+
+
+def print_profiles(fmt, active, profiles):
+    print(f'profiles: format {fmt}, {len(profiles)} defined, active {active}')
+    for i, p in enumerate(profiles):
+        stop_hz = p['start_hz'] + (p['points'] - 1) * p['step_hz']
+        print(f'  {"*" if i == active else " "}{i} {p["name"]:<11} {p["points"]:>5} points '
+              f'{p["start_hz"] / 1e9:.6f}-{stop_hz / 1e9:.6f} GHz, {p["vpf"]} values/point, {p["chunk"]}-point chunks')
+
+
+def decode_usb_tune(data):
+    """Decodes the USB tuning characteristic's read value (layout in usb_tune.h)."""
+    fmt, state, count, sweeps, best_rx, best_chunk, _, best_us = struct.unpack_from('<BBBBHBBI', data)
+    candidates = [struct.unpack_from('<HBBII', data, 12 + 12 * i) for i in range(count)]
+    return {'format': fmt, 'state': USB_TUNE_STATES[state] if state < len(USB_TUNE_STATES) else state,
+            'sweeps': sweeps, 'best': (best_rx, best_chunk, best_us), 'candidates': candidates}
+
+
+def print_usb_tune(report):
+    best_rx, best_chunk, best_us = report['best']
+    print(f'usb tune: format {report["format"]}, {report["state"]}, {len(report["candidates"])} candidates '
+          f'x {report["sweeps"]} sweeps' + (f', best {best_rx}-byte buffer, {best_chunk}-point chunks, '
+                                            f'{best_us / 1000:.1f} ms' if best_rx else ''))
+    for rx, chunk, failures, mean_us, max_us in report['candidates']:
+        mark = '*' if (rx, chunk) == (best_rx, best_chunk) else ' '
+        timing = f'mean {mean_us / 1000:7.1f} ms, max {max_us / 1000:7.1f} ms' if mean_us else 'not measured'
+        print(f'  {mark}{rx:>5} B {chunk:>4} pts  {timing}' + (f', {failures} failed' if failures else ''))
+
+
+class Link:
+    def __init__(self, host, port):
+        self.sock = socket.create_connection((host, port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.buf = b''
+        self.chrs = {}  # uuid -> (handle, flags)
+        self.mtu = 23
+
+    def send(self, op, handle, payload=b''):
+        self.sock.sendall(struct.pack('<cHH', op.encode(), handle, len(payload)) + payload)
+
+    def recv(self, timeout):
+        """Returns (op, handle, payload) or None on timeout."""
+        deadline = time.monotonic() + timeout
+        while len(self.buf) < 5 or len(self.buf) < 5 + struct.unpack_from('<H', self.buf, 3)[0]:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0:
+                return None
+            self.sock.settimeout(remaining)
+            try:
+                chunk = self.sock.recv(4096)
+            except socket.timeout:
+                return None
+            if not chunk:
+                raise ConnectionError('server closed the connection')
+            self.buf += chunk
+        op, handle, length = struct.unpack_from('<cHH', self.buf)
+        payload, self.buf = self.buf[5:5 + length], self.buf[5 + length:]
+        return op.decode(), handle, payload
+
+    def handle_of(self, uuid):
+        return self.chrs[uuid][0]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--port', type=int, default=7878)
+    parser.add_argument('--mtu', type=int, default=247, help='client MTU to offer')
+    parser.add_argument('--command', action='append', help='command to write (repeatable)')
+    parser.add_argument('--count', type=int, default=1, help='times to repeat the last command')
+    parser.add_argument('--listen-s', type=float, default=0, help='keep listening after the last reply')
+    parser.add_argument('--interval-s', type=float, default=0,
+                        help='wait between requests (long enough and the sensor idles or suspends)')
+    parser.add_argument('--timeout-s', type=float, default=30)
+    parser.add_argument('--quiet', action='store_true', help='only print the summary')
+    parser.add_argument('--burst', action='store_true', help='write all requests before waiting for results')
+    parser.add_argument('--priority', type=int, default=0, help='priority sent with each request (0-3)')
+    parser.add_argument('--stats', action='store_true', help='read the latency diagnostics at the end')
+    parser.add_argument('--trace', type=int, metavar='N', help='dump the trace buffer at the end, printing its last N records')
+    parser.add_argument('--sync', action='store_true', help='sync and acknowledge the result journal at the end')
+    parser.add_argument('--history', metavar='SPEC',
+                        help='fetch a sweep from the history at the end: "LAST" or "<seq>", optionally "<first> <n>"')
+    parser.add_argument('--profile', metavar='NAME',
+                        help='select a sweep profile (name or index) on the profile characteristic first')
+    parser.add_argument('--tune', type=int, nargs='?', const=4, metavar='SWEEPS',
+                        help='run "USB TUNE" with SWEEPS sweeps per candidate (default 4) before the commands')
+    parser.add_argument('--record', metavar='PATH',
+                        help='append every result frame to PATH (u8 length + frame) for khealth_replay --replay')
+    args = parser.parse_args()
+    commands = args.command or ['DATA REQUESTED']
+    commands = commands[:-1] + commands[-1:] * args.count
+
+    link = Link(args.host, args.port)
+    link.send('M', 0, struct.pack('<H', args.mtu))
+
+    # Characteristic table arrives first; the MTU answer follows the exchange
+    deadline = time.monotonic() + 2
+    while time.monotonic() < deadline and (RESULT_CHR_UUID not in link.chrs or link.mtu == 23):
+        msg = link.recv(deadline - time.monotonic())
+        if msg is None:
+            break
+        op, handle, payload = msg
+        if op == 'C':
+            link.chrs[uuid_from_nimble(payload[:16])] = (handle, struct.unpack_from('<H', payload, 16)[0])
+        elif op == 'M':
+            link.mtu = struct.unpack('<H', payload)[0]
+    if RESULT_CHR_UUID not in link.chrs:
+        sys.exit('result characteristic not announced')
+    print(f'connected: {len(link.chrs)} characteristics, MTU {link.mtu}')
+
+    for uuid, (handle, flags) in link.chrs.items():
+        if flags & FLAG_NOTIFY:
+            link.send('S', handle, struct.pack('<H', 1))
+    if MODEL_CHR_UUID in link.chrs:
+        link.send('R', link.handle_of(MODEL_CHR_UUID))
+
+    result_handle = link.handle_of(RESULT_CHR_UUID)
+    model_handle = link.chrs.get(MODEL_CHR_UUID, (None,))[0]
+    diag_handle = link.chrs.get(DIAG_CHR_UUID, (None,))[0]
+    sweep_handle = link.chrs.get(SWEEP_CHR_UUID, (None,))[0]
+    trace_handle = link.chrs.get(TRACE_CHR_UUID, (None,))[0]
+    journal_handle = link.chrs.get(JOURNAL_CHR_UUID, (None,))[0]
+    history_handle = link.chrs.get(HISTORY_CHR_UUID, (None,))[0]
+    profile_handle = link.chrs.get(PROFILE_CHR_UUID, (None,))[0]
+    usb_tune_handle = link.chrs.get(USB_TUNE_CHR_UUID, (None,))[0]
+    usb_tune_report = {}
+    profile_table = []  # (fmt, active, profiles) from the last read
+    profile_status = []  # ATT status of the last write
+    assembler = PacketAssembler()
+    history_assembler = PacketAssembler()
+    trace_assembler = PacketAssembler()
+    journal_assembler = PacketAssembler()
+    synced = []  # (seq, frame) from the last journal sync
+    latencies = []
+    frames = 0
+    rejected = 0
+    unrequested = 0  # Streamed, or fanned out from another client's request
+    waiting = {}  # request id -> time the request was written
+    record = open(args.record, 'ab') if args.record else None
+    seq_state = {'last': None, 'missing': 0, 'first_at': None}
+
+    def pump(until, stop_on_frame):
+        """Handles messages until `until`; with stop_on_frame, until no request is waiting."""
+        nonlocal frames, rejected, unrequested
+        while True:
+            if stop_on_frame and not waiting:
+                return True
+            msg = link.recv(max(0.0, until - time.monotonic()))
+            if msg is None:
+                return None
+            op, handle, payload = msg
+            if op == 'N' and handle == result_handle:
+                frame = decode_result_frame(payload)
+                frames += 1
+                if record:
+                    record.write(bytes([len(payload)]) + payload)
+                if frame:
+                    # Every frame a client gets carries the next seq; a gap is frames lost on the way
+                    gap = (frame['seq'] - seq_state['last'] - 1) & 0xFFFF if seq_state['last'] is not None else 0
+                    seq_state['missing'] += gap if gap < 0x8000 else 0
+                    seq_state['last'] = frame['seq']
+                    seq_state['first_at'] = seq_state['first_at'] or time.monotonic()
+                if not args.quiet:
+                    print('frame', frame)
+                if frame and 'REJECTED' in frame['flags']:
+                    rejected += 1
+                if frame and frame['request'] == 0:
+                    unrequested += 1
+                if frame and frame['request'] in waiting:
+                    sent = waiting.pop(frame['request'])
+                    if 'REJECTED' not in frame['flags']:
+                        latencies.append((time.monotonic() - sent) * 1000)
+            elif op == 'N' and handle == sweep_handle:
+                stream = assembler.add(payload)
+                if stream and not args.quiet:
+                    start, step, s11 = decode_sweep_curve(stream)
+                    i = min(range(len(s11)), key=s11.__getitem__)
+                    print(f'curve: {len(s11)} points from {start / 1e9:.6f} GHz, '
+                          f'min {s11[i]:.2f} dB at {(start + i * step) / 1e9:.6f} GHz')
+            elif op == 'N' and handle == trace_handle:
+                stream = trace_assembler.add(payload)
+                if stream:
+                    print_trace_dump(stream, args.trace)
+                    return handle
+            elif op == 'N' and handle == journal_handle:
+                stream = journal_assembler.add(payload)
+                if stream:
+                    _, synced[:] = decode_journal_sync(stream)
+                    return handle
+            elif op == 'r' and handle == journal_handle:
+                if payload[0] == 0 and len(payload) >= 22:
+                    print_journal_status(payload[1:])
+                return handle
+            elif op == 'N' and handle == history_handle:
+                stream = history_assembler.add(payload)
+                if stream:
+                    print_history_transfer(stream, args.quiet)
+                    return handle
+            elif op == 'r' and handle == history_handle:
+                if payload[0] == 0 and len(payload) >= 16:
+                    print_history_status(payload[1:])
+                return handle
+            elif op == 'r' and handle == profile_handle:
+                if payload[0] == 0 and len(payload) >= 4:
+                    profile_table[:] = decode_profiles(payload[1:])
+                return handle
+            elif op == 'w' and handle == profile_handle:
+                profile_status[:] = payload[:1]
+                return handle
+            elif op == 'r' and handle == usb_tune_handle:
+                if payload[0] == 0 and len(payload) >= 13:
+                    usb_tune_report.update(decode_usb_tune(payload[1:]))
+                return handle
+            elif op == 'r' and handle == model_handle:
+                if payload[0] == 0 and len(payload) >= 10 and not args.quiet:
+                    fmt, model_id, trees, nodes = struct.unpack_from('<BIHH', payload, 1)
+                    print(f'model info: format {fmt}, id 0x{model_id:08X}, {trees} trees, {nodes} nodes')
+            elif op == 'r' and handle == diag_handle:
+                if payload[0] == 0 and len(payload) >= 9:
+                    print_latency_stats(payload[1:])
+                return handle
+            elif op == 'M':
+                link.mtu = struct.unpack('<H', payload)[0]
+
+    if args.profile:
+        if profile_handle is None:
+            sys.exit('profile characteristic not announced')
+        link.send('R', profile_handle)
+        if pump(time.monotonic() + 2, False) != profile_handle or not profile_table:
+            sys.exit('profile table not read')
+        names = [p['name'] for p in profile_table[2]]
+        index = names.index(args.profile) if args.profile in names else int(args.profile) if args.profile.isdigit() else None
+        if index is None:
+            sys.exit(f'no profile "{args.profile}" (have {", ".join(names)})')
+        link.send('W', profile_handle, bytes([index]))
+        if pump(time.monotonic() + 2, False) != profile_handle or profile_status != [0]:
+            sys.exit(f'profile {index} not selected (ATT status {profile_status})')
+        link.send('R', profile_handle)
+        pump(time.monotonic() + 2, False)
+        print_profiles(*profile_table)
+
+    if args.tune is not None:
+        if usb_tune_handle is None:
+            sys.exit('USB tuning characteristic not announced')
+        start = time.monotonic()
+        link.send('W', result_handle, f'USB TUNE {args.tune}'.encode())
+        pump(time.monotonic() + 0.2, False)
+        deadline = time.monotonic() + args.timeout_s
+        # The run blocks the NanoVNA task; poll the report until it finishes
+        while usb_tune_report.get('state') not in ('DONE', 'FAILED'):
+            if time.monotonic() > deadline:
+                sys.exit(f'USB tuning did not finish within {args.timeout_s} s')
+            pump(time.monotonic() + 0.5, False)
+            link.send('R', usb_tune_handle)
+            pump(time.monotonic() + 2, False)
+        print_usb_tune(usb_tune_report)
+        print(f'usb tune: {time.monotonic() - start:.1f} s')
+
+    next_id = 1
+    for command in commands:
+        if command == 'DATA REQUESTED':
+            if args.interval_s > 0 and next_id > 1:
+                pump(time.monotonic() + args.interval_s, False)
+            # Tag each request so its result frame can be matched (see sweep_request.h)
+            command = f'DATA REQUESTED {next_id} {args.priority}'
+            waiting[next_id] = time.monotonic()
+            next_id += 1
+            link.send('W', result_handle, command.encode())
+            if not args.burst and pump(time.monotonic() + args.timeout_s, True) is None:
+                sys.exit(f'no result frame within {args.timeout_s} s')
+        else:
+            link.send('W', result_handle, command.encode())
+            pump(time.monotonic() + 0.2, False)  # Let write responses and side effects arrive
+    if waiting and pump(time.monotonic() + args.timeout_s, True) is None:
+        sys.exit(f'no result frame for requests {sorted(waiting)} within {args.timeout_s} s')
+    if args.listen_s > 0:
+        pump(time.monotonic() + args.listen_s, False)
+    if args.trace is not None:
+        if trace_handle is None:
+            sys.exit('trace characteristic not announced')
+        link.send('W', result_handle, b'TRACE DUMP')
+        pump(time.monotonic() + args.timeout_s, False)
+    if args.sync:
+        if journal_handle is None:
+            sys.exit('journal characteristic not announced')
+        link.send('R', journal_handle)
+        pump(time.monotonic() + 2, False)
+        start = time.monotonic()
+        link.send('W', result_handle, b'JOURNAL SYNC')
+        if pump(time.monotonic() + args.timeout_s, False) != journal_handle:
+            sys.exit(f'journal sync did not complete within {args.timeout_s} s')
+        elapsed = time.monotonic() - start
+        valid = sum(1 for _, frame in synced if frame and 'VALID' in frame['flags'])
+        if not args.quiet:
+            for seq, frame in synced[-3:]:
+                print('journal record', seq, frame)
+        if synced:
+            print(f'journal sync: {len(synced)} records ({valid} valid), seq {synced[0][0]}-{synced[-1][0]}, '
+                  f'{elapsed * 1000:.0f} ms')
+            link.send('W', result_handle, f'JOURNAL ACK {synced[-1][0]}'.encode())
+            pump(time.monotonic() + 0.2, False)
+        else:
+            print(f'journal sync: no records, {elapsed * 1000:.0f} ms')
+        link.send('R', journal_handle)
+        pump(time.monotonic() + 2, False)
+    if args.history:
+        if history_handle is None:
+            sys.exit('history characteristic not announced')
+        link.send('R', history_handle)
+        pump(time.monotonic() + 2, False)
+        start = time.monotonic()
+        link.send('W', result_handle, f'HISTORY {args.history}'.encode())
+        if pump(time.monotonic() + args.timeout_s, False) != history_handle:
+            sys.exit(f'history transfer did not complete within {args.timeout_s} s')
+        print(f'history transfer: {(time.monotonic() - start) * 1000:.0f} ms')
+    if args.stats:
+        if diag_handle is None:
+            sys.exit('diagnostics characteristic not announced')
+        link.send('R', diag_handle)
+        pump(time.monotonic() + 2, False)
+
+    if latencies:
+        latencies.sort()
+        print(f'{len(latencies)} requests: latency min {latencies[0]:.1f} ms, '
+              f'avg {sum(latencies) / len(latencies):.1f} ms, max {latencies[-1]:.1f} ms')
+    print(f'{frames} result frames received' + (f' ({unrequested} not requested by this client)' if unrequested else ''))
+    if frames > 1 and seq_state['first_at'] and time.monotonic() > seq_state['first_at']:
+        print(f'{frames / (time.monotonic() - seq_state["first_at"]):.1f} frames/s, {seq_state["missing"]} missing by seq')
+    if record:
+        record.close()
+        print(f'{frames} frames recorded to {args.record}')
+    if rejected:
+        print(f'{rejected} requests rejected (queue or client budget full)')
+
+
+if __name__ == '__main__':
+    main()
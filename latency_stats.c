@@ -0,0 +1,104 @@
+#include <string.h>
+#include "latency_stats.h"
+#include "le_bytes.h"
+
+/**
+ * @brief Bucket of `v`: values below 4 get their own bucket, above that each
+ * power of two [2^e, 2^(e+1)) is split into LATENCY_STATS_SUB_BUCKETS equal parts.
+ */
+static unsigned bucket_index(uint32_t v)
+{
+    if (v < LATENCY_STATS_SUB_BUCKETS) {
+        return v;
+    }
+    unsigned e = 31 - (unsigned)__builtin_clz(v); // floor(log2(v)), >= 2
+    unsigned sub = (v >> (e - 2)) & (LATENCY_STATS_SUB_BUCKETS - 1);
+    unsigned index = LATENCY_STATS_SUB_BUCKETS * (e - 1) + sub;
+    return (index < LATENCY_STATS_BUCKETS) ? index : LATENCY_STATS_BUCKETS - 1;
+}
+
+/**
+ * @brief Largest value that maps to bucket `index`.
+ */
+static uint32_t bucket_upper_us(unsigned index)
+{
+    if (index < LATENCY_STATS_SUB_BUCKETS) {
+        return index;
+    }
+    unsigned e = index / LATENCY_STATS_SUB_BUCKETS + 1;
+    unsigned sub = index % LATENCY_STATS_SUB_BUCKETS;
+    uint64_t upper = ((uint64_t)(LATENCY_STATS_SUB_BUCKETS + sub + 1) << (e - 2)) - 1;
+    return (upper > UINT32_MAX) ? UINT32_MAX : (uint32_t)upper;
+}
+
+void latency_stats_reset(latency_stats_t *stats, int64_t now_us)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->reset_time_us = now_us;
+}
+
+void latency_stats_record(latency_stats_t *stats, latency_stage_t stage, int64_t duration_us)
+{
+    if ((unsigned)stage >= LATENCY_STAGE_COUNT) {
+        return;
+    }
+    latency_histogram_t *h = &stats->stages[stage];
+    uint32_t v = (duration_us < 0) ? 0 : (duration_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)duration_us;
+
+    if (h->count == 0 || v < h->min_us) {
+        h->min_us = v;
+    }
+    if (v > h->max_us) {
+        h->max_us = v;
+    }
+    h->count++;
+    h->sum_us += v;
+    h->buckets[bucket_index(v)]++;
+}
+
+uint32_t latency_stats_p99_us(const latency_histogram_t *histogram)
+{
+    if (histogram->count == 0) {
+        return 0;
+    }
+    // Rank of the 99th percentile sample, rounded up
+    const uint64_t rank = ((uint64_t)histogram->count * 99 + 99) / 100;
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < LATENCY_STATS_BUCKETS; ++i) {
+        seen += histogram->buckets[i];
+        if (seen >= rank) {
+            uint32_t upper = bucket_upper_us(i);
+            if (upper > histogram->max_us) {
+                return histogram->max_us;
+            }
+            return (upper < histogram->min_us) ? histogram->min_us : upper;
+        }
+    }
+    return histogram->max_us;
+}
+
+size_t latency_stats_encode(const latency_stats_t *stats, int64_t now_us, uint8_t *out, size_t max_len)
+{
+    if (max_len < LATENCY_STATS_ENCODED_LEN) {
+        return 0;
+    }
+    const int64_t window_ms = (now_us - stats->reset_time_us) / 1000;
+
+    out[0] = LATENCY_STATS_FORMAT;
+    out[1] = LATENCY_STAGE_COUNT;
+    out[2] = 0;
+    out[3] = 0;
+    le_put_u32(out + 4, (window_ms < 0) ? 0 : (window_ms > UINT32_MAX) ? UINT32_MAX : (uint32_t)window_ms);
+
+    uint8_t *p = out + LATENCY_STATS_HEADER_LEN;
+    for (unsigned s = 0; s < LATENCY_STAGE_COUNT; ++s) {
+        const latency_histogram_t *h = &stats->stages[s];
+        le_put_u32(p + 0, h->count);
+        le_put_u32(p + 4, h->min_us);
+        le_put_u32(p + 8, h->count ? (uint32_t)(h->sum_us / h->count) : 0);
+        le_put_u32(p + 12, h->max_us);
+        le_put_u32(p + 16, latency_stats_p99_us(h));
+        p += LATENCY_STATS_STAGE_LEN;
+    }
+    return LATENCY_STATS_ENCODED_LEN;
+}
@@ -0,0 +1,84 @@
+// latency_stats.h
+// Per-stage latency histograms for the trigger-to-notification path.
+// Durations are bucketed log-linearly (4 buckets per power of two), so p99 is
+// reported to within 25% in a fixed amount of RAM; min, max and mean are exact.
+//
+// Encoded layout (little-endian), as read from the diagnostics characteristic:
+//
+//  Offset  Size  Field
+//  0       1     format           (LATENCY_STATS_FORMAT)
+//  1       1     stage_count      (LATENCY_STAGE_COUNT, order of latency_stage_t)
+//  2       2     reserved         (0)
+//  4       4     window_ms        (uint32, time since the last reset)
+//  8       20*N  per stage: u32 count, u32 min_us, u32 avg_us, u32 max_us, u32 p99_us
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LATENCY_STATS_FORMAT         (1)
+#define LATENCY_STATS_SUB_BUCKETS    (4)
+#define LATENCY_STATS_BUCKETS        (96)  // Exact below 4 us; last bucket collects >= ~28 s
+#define LATENCY_STATS_HEADER_LEN     (8)
+#define LATENCY_STATS_STAGE_LEN      (20)
+
+typedef enum {
+    LATENCY_STAGE_TRIGGER_WAIT = 0, // Trigger (BLE write or stream period) -> sweep starts
+    LATENCY_STAGE_PROGRAM,          // Window registers + FIFO clear transfer
+    LATENCY_STAGE_CHUNK_TX,         // READFIFO command transfer
+    LATENCY_STAGE_CHUNK_RX,         // READFIFO sent -> last point of the chunk handed over
+    LATENCY_STAGE_CHUNK_PROCESS,    // Last point handed over -> chunk processed (processing overlaps reception)
+    LATENCY_STAGE_SWEEP,            // Sweep start -> all stages of the selected mode done
+    LATENCY_STAGE_MODEL,            // Tree ensemble evaluation
+    LATENCY_STAGE_NOTIFY,           // Frame encode + notification queued
+    LATENCY_STAGE_TOTAL,            // Trigger -> notification queued
+    LATENCY_STAGE_WAKE,             // First reading after a wake from suspend: trigger -> notification queued
+    LATENCY_STAGE_COUNT
+} latency_stage_t;
+
+#define LATENCY_STATS_ENCODED_LEN    (LATENCY_STATS_HEADER_LEN + LATENCY_STAGE_COUNT * LATENCY_STATS_STAGE_LEN)
+
+typedef struct {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t buckets[LATENCY_STATS_BUCKETS];
+} latency_histogram_t;
+
+typedef struct {
+    int64_t reset_time_us;
+    latency_histogram_t stages[LATENCY_STAGE_COUNT];
+} latency_stats_t;
+
+/**
+ * @brief Clears every histogram; `now_us` starts the reporting window.
+ */
+void latency_stats_reset(latency_stats_t *stats, int64_t now_us);
+
+/**
+ * @brief Adds one duration to `stage`. Negative durations are recorded as 0.
+ */
+void latency_stats_record(latency_stats_t *stats, latency_stage_t stage, int64_t duration_us);
+
+/**
+ * @brief The duration below which 99% of the stage's samples fall (0 if empty).
+ */
+uint32_t latency_stats_p99_us(const latency_histogram_t *histogram);
+
+/**
+ * @brief Writes the encoded layout above into `out`.
+ * @return bytes written (LATENCY_STATS_ENCODED_LEN), or 0 if `max_len` is too small
+ */
+size_t latency_stats_encode(const latency_stats_t *stats, int64_t now_us, uint8_t *out, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LATENCY_STATS_H
@@ -0,0 +1,47 @@
+// le_bytes.h
+// Little-endian field access for the wire and storage formats (result frames, transfer
+// streams, status characteristics, journal slots), independent of the host's byte order.
+#ifndef LE_BYTES_H
+#define LE_BYTES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline void le_put_u16(uint8_t *out, uint16_t v)
+{
+    out[0] = (uint8_t)v;
+    out[1] = (uint8_t)(v >> 8);
+}
+
+static inline void le_put_u32(uint8_t *out, uint32_t v)
+{
+    out[0] = (uint8_t)v;
+    out[1] = (uint8_t)(v >> 8);
+    out[2] = (uint8_t)(v >> 16);
+    out[3] = (uint8_t)(v >> 24);
+}
+
+static inline void le_put_u64(uint8_t *out, uint64_t v)
+{
+    le_put_u32(out, (uint32_t)v);
+    le_put_u32(out + 4, (uint32_t)(v >> 32));
+}
+
+static inline uint16_t le_get_u16(const uint8_t *in)
+{
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static inline uint32_t le_get_u32(const uint8_t *in)
+{
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LE_BYTES_H
@@ -0,0 +1,158 @@
+#include <string.h>
+#include "nanovna_proto.h"
+#include "le_bytes.h"
+
+static void batch_append(nanovna_batch_t *batch, const uint8_t *cmd, size_t len, size_t reply_len)
+{
+    if (batch->overflow || batch->len + len > sizeof(batch->data)) {
+        batch->overflow = true;
+        return;
+    }
+    memcpy(batch->data + batch->len, cmd, len);
+    batch->len += len;
+    batch->reply_len += reply_len;
+}
+
+static uint64_t get_le(const uint8_t *p, size_t width)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < width; ++i) {
+        value |= (uint64_t)p[i] << (8 * i);
+    }
+    return value;
+}
+
+void nanovna_batch_init(nanovna_batch_t *batch)
+{
+    batch->len = 0;
+    batch->reply_len = 0;
+    batch->overflow = false;
+}
+
+void nanovna_batch_sync(nanovna_batch_t *batch)
+{
+    uint8_t cmd[NANOVNA_SYNC_NOPS + 1] = { 0 };
+    cmd[NANOVNA_SYNC_NOPS] = NANOVNA_OP_INDICATE;
+    batch_append(batch, cmd, sizeof(cmd), 1);
+}
+
+void nanovna_batch_write(nanovna_batch_t *batch, uint8_t addr, uint64_t value, size_t width)
+{
+    uint8_t cmd[2 + 8];
+    switch (width) {
+    case 1: cmd[0] = NANOVNA_OP_WRITE;  break;
+    case 2: cmd[0] = NANOVNA_OP_WRITE2; break;
+    case 4: cmd[0] = NANOVNA_OP_WRITE4; break;
+    case 8: cmd[0] = NANOVNA_OP_WRITE8; break;
+    default:
+        batch->overflow = true; // No such command; poison the batch rather than send garbage
+        return;
+    }
+    cmd[1] = addr;
+    for (size_t i = 0; i < width; ++i) {
+        cmd[2 + i] = (uint8_t)(value >> (8 * i));
+    }
+    batch_append(batch, cmd, 2 + width, 0);
+}
+
+void nanovna_batch_read(nanovna_batch_t *batch, uint8_t addr, size_t width)
+{
+    uint8_t cmd[2] = { 0, addr };
+    switch (width) {
+    case 1: cmd[0] = NANOVNA_OP_READ;  break;
+    case 2: cmd[0] = NANOVNA_OP_READ2; break;
+    case 4: cmd[0] = NANOVNA_OP_READ4; break;
+    default:
+        batch->overflow = true;
+        return;
+    }
+    batch_append(batch, cmd, sizeof(cmd), width);
+}
+
+void nanovna_batch_read_fifo(nanovna_batch_t *batch, uint16_t count)
+{
+    if (count == 0 || count > NANOVNA_READFIFO_MAX_RECORDS) {
+        batch->overflow = true;
+        return;
+    }
+    const uint8_t cmd[3] = { NANOVNA_OP_READFIFO, NANOVNA_REG_FIFO, (uint8_t)count };
+    batch_append(batch, cmd, sizeof(cmd), (size_t)count * NANOVNA_FIFO_RECORD_SIZE);
+}
+
+void nanovna_batch_clear_fifo(nanovna_batch_t *batch)
+{
+    nanovna_batch_write(batch, NANOVNA_REG_FIFO, 0, 1);
+}
+
+int nanovna_batch_sweep_config(nanovna_batch_t *batch, const nanovna_sweep_config_t *config,
+                               const nanovna_sweep_config_t *current)
+{
+    int written = 0;
+    if (!current || current->start_hz != config->start_hz) {
+        nanovna_batch_write(batch, NANOVNA_REG_SWEEP_START_HZ, config->start_hz, 8);
+        written++;
+    }
+    if (!current || current->step_hz != config->step_hz) {
+        nanovna_batch_write(batch, NANOVNA_REG_SWEEP_STEP_HZ, config->step_hz, 8);
+        written++;
+    }
+    if (!current || current->points != config->points) {
+        nanovna_batch_write(batch, NANOVNA_REG_SWEEP_POINTS, config->points, 2);
+        written++;
+    }
+    if (!current || current->values_per_freq != config->values_per_freq) {
+        nanovna_batch_write(batch, NANOVNA_REG_VALUES_PER_FREQ, config->values_per_freq, 2);
+        written++;
+    }
+    return written;
+}
+
+void nanovna_batch_sweep_readback(nanovna_batch_t *batch)
+{
+    // There is no READ8: 64-bit registers are read as two halves
+    nanovna_batch_read(batch, NANOVNA_REG_SWEEP_START_HZ, 4);
+    nanovna_batch_read(batch, NANOVNA_REG_SWEEP_START_HZ + 4, 4);
+    nanovna_batch_read(batch, NANOVNA_REG_SWEEP_STEP_HZ, 4);
+    nanovna_batch_read(batch, NANOVNA_REG_SWEEP_STEP_HZ + 4, 4);
+    nanovna_batch_read(batch, NANOVNA_REG_SWEEP_POINTS, 2);
+    nanovna_batch_read(batch, NANOVNA_REG_VALUES_PER_FREQ, 2);
+}
+
+void nanovna_parse_sweep_readback(const uint8_t reply[NANOVNA_SWEEP_READBACK_LEN], nanovna_sweep_config_t *config)
+{
+    config->start_hz = get_le(reply + 0, 8);
+    config->step_hz = get_le(reply + 8, 8);
+    config->points = (uint16_t)get_le(reply + 16, 2);
+    config->values_per_freq = (uint16_t)get_le(reply + 18, 2);
+}
+
+void nanovna_parse_fifo_record(const uint8_t record[NANOVNA_FIFO_RECORD_SIZE], nanovna_fifo_point_t *point)
+{
+    point->fwd_re = (int32_t)(uint32_t)get_le(record + 0, 4);
+    point->fwd_im = (int32_t)(uint32_t)get_le(record + 4, 4);
+    point->rev_re = (int32_t)(uint32_t)get_le(record + 8, 4);
+    point->rev_im = (int32_t)(uint32_t)get_le(record + 12, 4);
+    point->freq_index = (uint16_t)get_le(record + NANOVNA_FIFO_INDEX_OFFSET, 2);
+}
+
+bool nanovna_sweep_config_equal(const nanovna_sweep_config_t *a, const nanovna_sweep_config_t *b)
+{
+    return a->start_hz == b->start_hz && a->step_hz == b->step_hz &&
+           a->points == b->points && a->values_per_freq == b->values_per_freq;
+}
+
+uint32_t nanovna_sweep_config_hash(const nanovna_sweep_config_t *config)
+{
+    // Hash the little-endian register image so the value is the same on every host
+    uint8_t image[NANOVNA_SWEEP_READBACK_LEN];
+    le_put_u64(image, config->start_hz);
+    le_put_u64(image + 8, config->step_hz);
+    le_put_u16(image + 16, config->points);
+    le_put_u16(image + 18, config->values_per_freq);
+
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(image); ++i) {
+        hash = (hash ^ image[i]) * 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,135 @@
+// nanovna_proto.h
+// NanoVNA V2 USB register protocol: command encoding and reply decoding.
+// Commands are appended to a batch so that several can go out in one USB
+// transfer; the device executes them in order and replies to reads in order.
+// All register values are little-endian.
+//
+//  Opcode  Command     Operands                   Reply
+//  0x00    NOP         -                          -
+//  0x0d    INDICATE    -                          1 byte (NANOVNA_INDICATE_REPLY)
+//  0x10    READ        addr                       1 byte
+//  0x11    READ2       addr                       2 bytes
+//  0x12    READ4       addr                       4 bytes
+//  0x18    READFIFO    addr, count (records)      count * 32 bytes
+//  0x20    WRITE       addr, u8                   -
+//  0x21    WRITE2      addr, u16                  -
+//  0x22    WRITE4      addr, u32                  -
+//  0x23    WRITE8      addr, u64                  -
+#ifndef NANOVNA_PROTO_H
+#define NANOVNA_PROTO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NANOVNA_OP_NOP              (0x00)
+#define NANOVNA_OP_INDICATE         (0x0d)
+#define NANOVNA_OP_READ             (0x10)
+#define NANOVNA_OP_READ2            (0x11)
+#define NANOVNA_OP_READ4            (0x12)
+#define NANOVNA_OP_READFIFO         (0x18)
+#define NANOVNA_OP_WRITE            (0x20)
+#define NANOVNA_OP_WRITE2           (0x21)
+#define NANOVNA_OP_WRITE4           (0x22)
+#define NANOVNA_OP_WRITE8           (0x23)
+
+#define NANOVNA_REG_SWEEP_START_HZ  (0x00) // uint64
+#define NANOVNA_REG_SWEEP_STEP_HZ   (0x10) // uint64
+#define NANOVNA_REG_SWEEP_POINTS    (0x20) // uint16
+#define NANOVNA_REG_VALUES_PER_FREQ (0x22) // uint16
+#define NANOVNA_REG_FIFO            (0x30) // FIFO of sweep records; any write clears it
+
+#define NANOVNA_INDICATE_REPLY      (0x32) // '2': V2 protocol
+#define NANOVNA_SYNC_NOPS           (8)    // Longest command; flushes a half-received one
+#define NANOVNA_FIFO_RECORD_SIZE    (32)   // fwd0, rev0, rev1 (i32 re/im each), u16 freqIndex @24, reserved
+#define NANOVNA_FIFO_INDEX_OFFSET   (24)   // u16 freqIndex within a record
+#define NANOVNA_READFIFO_MAX_RECORDS (255) // READFIFO count is a single byte
+#define NANOVNA_BATCH_MAX_LEN       (64)   // One full-speed bulk OUT packet
+#define NANOVNA_SWEEP_READBACK_LEN  (20)   // Reply to nanovna_batch_sweep_readback()
+
+typedef struct {
+    uint64_t start_hz;
+    uint64_t step_hz;
+    uint16_t points;
+    uint16_t values_per_freq;
+} nanovna_sweep_config_t;
+
+// One FIFO record, reduced to what S11 needs (rev1 is the transmission port)
+typedef struct {
+    int32_t fwd_re, fwd_im;   // fwd0: incident wave
+    int32_t rev_re, rev_im;   // rev0: reflected wave
+    uint16_t freq_index;      // Point index within the programmed window
+} nanovna_fifo_point_t;
+
+typedef struct {
+    uint8_t data[NANOVNA_BATCH_MAX_LEN];
+    size_t len;         // Command bytes queued
+    size_t reply_len;   // Bytes the device will send back for the queued commands
+    bool overflow;      // A command did not fit; the batch must not be sent
+} nanovna_batch_t;
+
+void nanovna_batch_init(nanovna_batch_t *batch);
+
+/**
+ * @brief Appends NOPs and an INDICATE: resynchronises the device's command parser
+ * and, once the 1-byte reply arrives, proves the device is answering.
+ */
+void nanovna_batch_sync(nanovna_batch_t *batch);
+
+/**
+ * @brief Appends WRITE/WRITE2/WRITE4/WRITE8 of `value` to register `addr`; `width` is 1, 2, 4 or 8.
+ */
+void nanovna_batch_write(nanovna_batch_t *batch, uint8_t addr, uint64_t value, size_t width);
+
+/**
+ * @brief Appends READ/READ2/READ4 of register `addr`; `width` is 1, 2 or 4.
+ */
+void nanovna_batch_read(nanovna_batch_t *batch, uint8_t addr, size_t width);
+
+/**
+ * @brief Appends a READFIFO of `count` records (1..NANOVNA_READFIFO_MAX_RECORDS) from NANOVNA_REG_FIFO.
+ */
+void nanovna_batch_read_fifo(nanovna_batch_t *batch, uint16_t count);
+
+void nanovna_batch_clear_fifo(nanovna_batch_t *batch);
+
+/**
+ * @brief Appends writes for the sweep registers of `config`. When `current` is
+ * non-NULL only registers whose value differs from it are written.
+ * @return number of registers written
+ */
+int nanovna_batch_sweep_config(nanovna_batch_t *batch, const nanovna_sweep_config_t *config,
+                               const nanovna_sweep_config_t *current);
+
+/**
+ * @brief Appends reads of all sweep registers (NANOVNA_SWEEP_READBACK_LEN reply bytes).
+ */
+void nanovna_batch_sweep_readback(nanovna_batch_t *batch);
+
+/**
+ * @brief Decodes the reply to nanovna_batch_sweep_readback().
+ */
+void nanovna_parse_sweep_readback(const uint8_t reply[NANOVNA_SWEEP_READBACK_LEN], nanovna_sweep_config_t *config);
+
+/**
+ * @brief Decodes one FIFO record (layout above NANOVNA_FIFO_RECORD_SIZE).
+ */
+void nanovna_parse_fifo_record(const uint8_t record[NANOVNA_FIFO_RECORD_SIZE], nanovna_fifo_point_t *point);
+
+bool nanovna_sweep_config_equal(const nanovna_sweep_config_t *a, const nanovna_sweep_config_t *b);
+
+/**
+ * @brief 32-bit FNV-1a hash of the register image of `config`, for cheap
+ * "is this the configuration we applied" checks and for storing in NVS.
+ */
+uint32_t nanovna_sweep_config_hash(const nanovna_sweep_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NANOVNA_PROTO_H
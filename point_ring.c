@@ -0,0 +1,38 @@
+#include "point_ring.h"
+
+#define POINT_RING_MASK (POINT_RING_CAPACITY - 1)
+
+void point_ring_init(point_ring_t *ring)
+{
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+}
+
+bool point_ring_push(point_ring_t *ring, const nanovna_fifo_point_t *point)
+{
+    const uint32_t head = ring->head; // Only this side writes head
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= POINT_RING_CAPACITY) {
+        __atomic_store_n(&ring->dropped, ring->dropped + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    ring->points[head & POINT_RING_MASK] = *point;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE); // Publishes the point
+    return true;
+}
+
+bool point_ring_pop(point_ring_t *ring, nanovna_fifo_point_t *point)
+{
+    const uint32_t tail = ring->tail; // Only this side writes tail
+    if (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail) {
+        return false;
+    }
+    *point = ring->points[tail & POINT_RING_MASK];
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE); // Hands the slot back
+    return true;
+}
+
+void point_ring_discard(point_ring_t *ring)
+{
+    __atomic_store_n(&ring->tail, __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
@@ -0,0 +1,56 @@
+// point_ring.h
+// Lock-free single-producer / single-consumer ring of parsed FIFO points.
+//
+// The USB side frames READFIFO replies into records and pushes one point per
+// record; the sweep processing task pops them on the other core. Neither side
+// ever blocks the other: the producer owns `head`, the consumer owns `tail`, and
+// each publishes its index with a release store that the other reads with acquire.
+// Waking the consumer is left to the caller (one semaphore give per USB packet).
+#ifndef POINT_RING_H
+#define POINT_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "nanovna_proto.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define POINT_RING_CAPACITY (256)  // Power of two; must hold the largest READFIFO in flight
+
+#if (POINT_RING_CAPACITY & (POINT_RING_CAPACITY - 1)) != 0
+#error "POINT_RING_CAPACITY must be a power of two"
+#endif
+
+typedef struct {
+    uint32_t head;     // Points pushed (producer only writes)
+    uint32_t tail;     // Points popped (consumer only writes)
+    uint32_t dropped;  // Points refused because the ring was full (producer only writes)
+    nanovna_fifo_point_t points[POINT_RING_CAPACITY];
+} point_ring_t;
+
+void point_ring_init(point_ring_t *ring);
+
+/**
+ * @brief Producer: appends `point`.
+ * @return false (and counts a drop) if the ring is full
+ */
+bool point_ring_push(point_ring_t *ring, const nanovna_fifo_point_t *point);
+
+/**
+ * @brief Consumer: removes the oldest point into `point`.
+ * @return false if the ring is empty
+ */
+bool point_ring_pop(point_ring_t *ring, nanovna_fifo_point_t *point);
+
+/**
+ * @brief Consumer: discards every point pushed so far, e.g. leftovers of an aborted read.
+ */
+void point_ring_discard(point_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POINT_RING_H
@@ -0,0 +1,148 @@
+#include <string.h>
+#include "power_idle.h"
+#include "le_bytes.h"
+
+static bool interval_ok(uint16_t ms, uint16_t min_ms, uint16_t max_ms)
+{
+    return ms >= min_ms && ms <= max_ms;
+}
+
+static void enter_state(power_idle_t *power, power_state_t state, int64_t now_us)
+{
+    if (now_us > power->state_since_us) {
+        power->state_us[power->state] += (uint64_t)(now_us - power->state_since_us);
+        power->state_since_us = now_us;
+    }
+    power->state = state;
+}
+
+bool power_idle_config_valid(const power_idle_config_t *config)
+{
+    for (int i = 0; i < 2; ++i) {
+        if (!interval_ok(config->adv_itvl_ms[i], POWER_ADV_ITVL_MIN_MS, POWER_ADV_ITVL_MAX_MS) ||
+            !interval_ok(config->conn_itvl_ms[i], POWER_CONN_ITVL_MIN_MS, POWER_CONN_ITVL_MAX_MS)) {
+            return false;
+        }
+    }
+    return config->suspend_after_ms == 0 || config->suspend_after_ms >= config->idle_after_ms;
+}
+
+void power_idle_init(power_idle_t *power, const power_idle_config_t *config, int64_t now_us)
+{
+    memset(power, 0, sizeof(*power));
+    power->config = *config;
+    power->state = POWER_STATE_ACTIVE;
+    power->last_activity_us = now_us;
+    power->state_since_us = now_us;
+}
+
+bool power_idle_set_config(power_idle_t *power, const power_idle_config_t *config)
+{
+    if (!power_idle_config_valid(config)) {
+        return false;
+    }
+    power->config = *config;
+    return true;
+}
+
+power_state_t power_idle_activity(power_idle_t *power, int64_t now_us)
+{
+    const power_state_t left = power->state;
+    if (now_us > power->last_activity_us) {
+        power->last_activity_us = now_us;
+    }
+    if (left == POWER_STATE_SUSPENDED) {
+        power->wakes++;
+    }
+    if (left != POWER_STATE_ACTIVE) {
+        enter_state(power, POWER_STATE_ACTIVE, now_us);
+    }
+    return left;
+}
+
+/**
+ * @brief State due after `inactive_us` without activity.
+ */
+static power_state_t due_state(const power_idle_config_t *config, int64_t inactive_us)
+{
+    if (config->suspend_after_ms > 0 && inactive_us >= (int64_t)config->suspend_after_ms * 1000) {
+        return POWER_STATE_SUSPENDED;
+    }
+    if (config->idle_after_ms > 0 && inactive_us >= (int64_t)config->idle_after_ms * 1000) {
+        return POWER_STATE_IDLE;
+    }
+    return POWER_STATE_ACTIVE;
+}
+
+power_state_t power_idle_update(power_idle_t *power, int64_t now_us)
+{
+    const power_state_t left = power->state;
+    const power_state_t due = due_state(&power->config, now_us - power->last_activity_us);
+    if (due <= left) {
+        return left; // Only activity brings the state back up
+    }
+    if (left == POWER_STATE_ACTIVE) {
+        power->idle_entries++;
+    }
+    if (due == POWER_STATE_SUSPENDED) {
+        power->suspends++;
+    }
+    enter_state(power, due, now_us);
+    return left;
+}
+
+int64_t power_idle_next_us(const power_idle_t *power, int64_t now_us)
+{
+    uint32_t after_ms = 0;
+    if (power->state == POWER_STATE_ACTIVE && power->config.idle_after_ms > 0) {
+        after_ms = power->config.idle_after_ms;
+    } else if (power->state != POWER_STATE_SUSPENDED && power->config.suspend_after_ms > 0) {
+        after_ms = power->config.suspend_after_ms;
+    } else {
+        return -1;
+    }
+    const int64_t remaining_us = power->last_activity_us + (int64_t)after_ms * 1000 - now_us;
+    return (remaining_us > 0) ? remaining_us : 0;
+}
+
+uint16_t power_idle_adv_itvl_ms(const power_idle_t *power)
+{
+    return power->config.adv_itvl_ms[power->state == POWER_STATE_ACTIVE ? 0 : 1];
+}
+
+uint16_t power_idle_conn_itvl_ms(const power_idle_t *power)
+{
+    return power->config.conn_itvl_ms[power->state == POWER_STATE_ACTIVE ? 0 : 1];
+}
+
+void power_idle_reset_counters(power_idle_t *power, int64_t now_us)
+{
+    memset(power->state_us, 0, sizeof(power->state_us));
+    power->state_since_us = now_us;
+    power->idle_entries = 0;
+    power->suspends = 0;
+    power->wakes = 0;
+}
+
+size_t power_idle_encode(const power_idle_t *power, int64_t now_us, uint8_t *out, size_t max_len)
+{
+    if (max_len < POWER_IDLE_ENCODED_LEN) {
+        return 0;
+    }
+    out[0] = POWER_IDLE_FORMAT;
+    out[1] = (uint8_t)power->state;
+    out[2] = 0;
+    out[3] = 0;
+    le_put_u32(out + 4, power->idle_entries);
+    le_put_u32(out + 8, power->suspends);
+    le_put_u32(out + 12, power->wakes);
+    for (int s = 0; s < POWER_STATE_COUNT; ++s) {
+        uint64_t us = power->state_us[s];
+        if (s == (int)power->state && now_us > power->state_since_us) {
+            us += (uint64_t)(now_us - power->state_since_us);
+        }
+        const uint64_t ms = us / 1000;
+        le_put_u32(out + 16 + 4 * s, (ms > UINT32_MAX) ? UINT32_MAX : (uint32_t)ms);
+    }
+    return POWER_IDLE_ENCODED_LEN;
+}
@@ -0,0 +1,128 @@
+// power_idle.h
+// Power state of the sensor between readings. Patients measure a few times a day,
+// so most of the battery goes on the time in between:
+//
+//  ACTIVE     Readings are being taken or expected. BLE advertises and runs its
+//             connections at the active intervals; the NanoVNA is powered.
+//  IDLE       No activity for idle_after_ms. Advertising and connection events
+//             slow down to the idle intervals; the NanoVNA stays up, so a reading
+//             costs no more than in ACTIVE.
+//  SUSPENDED  No activity for suspend_after_ms. The NanoVNA's USB port is switched
+//             off and the chip may enter automatic light sleep between BLE events.
+//
+// Activity (a reading, a client connecting, a command that needs the NanoVNA)
+// returns to ACTIVE from either state; leaving SUSPENDED is a wake. Transitions are
+// evaluated by the caller's task only; this module keeps no time of its own.
+//
+// Encoded layout (little-endian), appended to the diagnostics characteristic after
+// the READFIFO timing. Times are since the counters were last reset:
+//
+//  Offset  Size  Field
+//  0       1     format           (POWER_IDLE_FORMAT)
+//  1       1     state            (power_state_t)
+//  2       2     reserved         (0)
+//  4       4     idle_entries     (ACTIVE -> IDLE)
+//  8       4     suspends         (-> SUSPENDED)
+//  12      4     wakes            (SUSPENDED -> ACTIVE)
+//  16      4*3   ms in ACTIVE, IDLE, SUSPENDED
+#ifndef POWER_IDLE_H
+#define POWER_IDLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define POWER_IDLE_FORMAT         (1)
+#define POWER_IDLE_ENCODED_LEN    (16 + 4 * POWER_STATE_COUNT)
+#define POWER_ADV_ITVL_MIN_MS     (20)     // BLE advertising interval limits
+#define POWER_ADV_ITVL_MAX_MS     (10240)
+#define POWER_CONN_ITVL_MIN_MS    (8)      // BLE connection interval limits (7.5 ms rounded up)
+#define POWER_CONN_ITVL_MAX_MS    (4000)
+
+typedef enum {
+    POWER_STATE_ACTIVE = 0,
+    POWER_STATE_IDLE,
+    POWER_STATE_SUSPENDED,
+    POWER_STATE_COUNT
+} power_state_t;
+
+typedef struct {
+    uint32_t idle_after_ms;       // Inactivity before IDLE; 0 = never
+    uint32_t suspend_after_ms;    // Inactivity before SUSPENDED; 0 = never, else at least idle_after_ms
+    uint16_t adv_itvl_ms[2];      // Advertising interval in ACTIVE, and in IDLE and SUSPENDED
+    uint16_t conn_itvl_ms[2];     // Connection interval requested likewise
+} power_idle_config_t;
+
+typedef struct {
+    power_idle_config_t config;
+    power_state_t state;
+    int64_t last_activity_us;
+    int64_t state_since_us;       // Start of the current state, or of the counters if later
+    uint64_t state_us[POWER_STATE_COUNT]; // Time spent in each state before state_since_us
+    uint32_t idle_entries;
+    uint32_t suspends;
+    uint32_t wakes;
+} power_idle_t;
+
+/**
+ * @brief True if `config` is usable: intervals within the BLE limits, and suspending
+ * (if enabled) no earlier than idling.
+ */
+bool power_idle_config_valid(const power_idle_config_t *config);
+
+/**
+ * @brief Starts in ACTIVE at `now_us` with a valid `config`, counters cleared.
+ */
+void power_idle_init(power_idle_t *power, const power_idle_config_t *config, int64_t now_us);
+
+/**
+ * @brief Replaces the configuration; the state is left to the next activity or update.
+ * @return false (and nothing changed) if `config` is not valid
+ */
+bool power_idle_set_config(power_idle_t *power, const power_idle_config_t *config);
+
+/**
+ * @brief Records activity at `now_us` and returns to ACTIVE.
+ * @return the state left (POWER_STATE_SUSPENDED means this was a wake)
+ */
+power_state_t power_idle_activity(power_idle_t *power, int64_t now_us);
+
+/**
+ * @brief Moves to the state due at `now_us` after the last activity. Only ever moves
+ * towards SUSPENDED, skipping IDLE if both are due.
+ * @return the state left, or the current state if nothing changed
+ */
+power_state_t power_idle_update(power_idle_t *power, int64_t now_us);
+
+/**
+ * @brief Microseconds from `now_us` until power_idle_update() next changes state, 0 if
+ * overdue, or -1 if no further transition is configured.
+ */
+int64_t power_idle_next_us(const power_idle_t *power, int64_t now_us);
+
+/**
+ * @brief Advertising and connection intervals of the current state, in ms.
+ */
+uint16_t power_idle_adv_itvl_ms(const power_idle_t *power);
+uint16_t power_idle_conn_itvl_ms(const power_idle_t *power);
+
+/**
+ * @brief Clears the transition counters and times; the state and configuration are kept.
+ */
+void power_idle_reset_counters(power_idle_t *power, int64_t now_us);
+
+/**
+ * @brief Writes the encoded layout above into `out`.
+ * @return bytes written (POWER_IDLE_ENCODED_LEN), or 0 if `max_len` is too small
+ */
+size_t power_idle_encode(const power_idle_t *power, int64_t now_us, uint8_t *out, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POWER_IDLE_H
@@ -0,0 +1,224 @@
+#include <math.h>
+#include <string.h>
+#include "result_frame.h"
+#include "replay_load.h"
+#include "le_bytes.h"
+
+// Synthetic frames: a sensor dip drifting slowly around the band centre, with a shallow
+// fixed feature next to it, as a 1024-point sweep of the standard profile would report
+#define SYNTH_CENTER_HZ      (2300000000.0f)
+#define SYNTH_DRIFT_HZ       (20000000.0f)
+#define SYNTH_DRIFT_FRAMES   (600)         // One drift cycle
+#define SYNTH_NOISE_HZ       (200000.0f)
+#define SYNTH_DEPTH_DB       (-25.0f)
+#define SYNTH_DEPTH_SWING_DB (3.0f)
+#define SYNTH_NOISE_DB       (0.2f)
+#define SYNTH_POINTS         (1024)
+#define SYNTH_WIDTH_KHZ      (3000)
+#define SYNTH_FEATURE_HZ     (2210000000u)
+#define SYNTH_FEATURE_CDB    (-800)
+#define SYNTH_PERMITTIVITY   (56.0f)
+#define SYNTH_PERM_SWING     (4.0f)
+
+#define RECORDED_REQUEST_ID_OFFSET (16)    // Frame versions 2 and later
+
+static uint32_t rng_seed(uint32_t seed, uint32_t stream)
+{
+    // Spread nearby seeds apart; xorshift needs a non-zero state
+    uint32_t x = (seed ^ stream) * 0x9E3779B1u;
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    return x ? x : 1;
+}
+
+static uint32_t rng_next(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/**
+ * @brief Uniform in [-1, 1).
+ */
+static float rng_signed(uint32_t *state)
+{
+    return (float)(rng_next(state) >> 8) / (float)(1u << 23) - 1.0f;
+}
+
+static uint32_t jittered_period_us(replay_load_t *load)
+{
+    const uint32_t period_us = load->config.period_us;
+    const uint32_t span_us = (uint32_t)((uint64_t)period_us * load->config.jitter_pct / 100);
+    if (span_us == 0) {
+        return period_us;
+    }
+    const int64_t offset_us = (int64_t)(rng_next(&load->timing_rng) % (2 * span_us + 1)) - span_us;
+    return (period_us + offset_us > 0) ? (uint32_t)(period_us + offset_us) : 1;
+}
+
+bool replay_load_config_valid(const replay_load_config_t *config)
+{
+    return config->burst >= 1 && config->burst <= REPLAY_LOAD_BURST_MAX && config->jitter_pct <= 100 &&
+           config->loss <= REPLAY_LOSS_BURSTY && config->loss_permille <= 1000 && config->exit_permille <= 1000 &&
+           (config->loss != REPLAY_LOSS_BURSTY || config->exit_permille > 0) &&
+           (config->period_us == 0 || config->period_us >= REPLAY_LOAD_PERIOD_MIN_US);
+}
+
+size_t replay_load_recording_count(const uint8_t *recording, size_t len)
+{
+    size_t count = 0;
+    size_t pos = 0;
+    while (pos < len) {
+        const size_t frame_len = recording[pos];
+        if (frame_len == 0 || frame_len > RESULT_FRAME_MAX_LEN || pos + 1 + frame_len > len) {
+            return 0;
+        }
+        pos += 1 + frame_len;
+        count++;
+    }
+    return count;
+}
+
+void replay_load_init(replay_load_t *load, const replay_load_config_t *config,
+                      const uint8_t *recording, size_t recording_len, int64_t now_us)
+{
+    memset(load, 0, sizeof(*load));
+    load->config = *config;
+    if (recording != NULL && replay_load_recording_count(recording, recording_len) > 0) {
+        load->recording = recording;
+        load->recording_len = recording_len;
+    }
+    load->content_rng = rng_seed(config->seed, 0x68E31DA4u);
+    load->timing_rng = rng_seed(config->seed, 0xB5297A4Du);
+    load->loss_rng = rng_seed(config->seed, 0x1B56C4E9u);
+    load->next_burst_us = now_us;
+}
+
+void replay_load_reconfigure(replay_load_t *load, const replay_load_config_t *config, int64_t now_us)
+{
+    if (config->loss != load->config.loss) {
+        load->in_loss_burst = false;
+    }
+    load->config = *config;
+    load->next_burst_us = now_us;
+}
+
+uint32_t replay_load_due(replay_load_t *load, int64_t now_us, int64_t *next_us)
+{
+    if (load->config.period_us == 0) {
+        *next_us = -1;
+        return 0;
+    }
+    uint32_t bursts = 0;
+    while (load->next_burst_us <= now_us) {
+        if (bursts == REPLAY_LOAD_CATCH_UP_MAX) {
+            // Too far behind to catch up: skip the rest and start over from now
+            load->late_bursts += (uint32_t)((now_us - load->next_burst_us) / load->config.period_us) + 1;
+            load->next_burst_us = now_us + jittered_period_us(load);
+            break;
+        }
+        bursts++;
+        load->next_burst_us += jittered_period_us(load);
+    }
+    *next_us = load->next_burst_us;
+    return bursts * load->config.burst;
+}
+
+/**
+ * @brief Next frame of the recording (wrapping), with this stream's seq, time and request.
+ */
+static size_t replay_recorded(replay_load_t *load, uint32_t timestamp_ms, uint16_t request_id,
+                              uint8_t *out, size_t max_len)
+{
+    if (load->recording_pos >= load->recording_len) {
+        load->recording_pos = 0;
+    }
+    const size_t len = load->recording[load->recording_pos];
+    if (len > max_len) {
+        return 0;
+    }
+    memcpy(out, &load->recording[load->recording_pos + 1], len);
+    load->recording_pos += 1 + len;
+    if (len >= 8) {
+        le_put_u16(out + 2, load->seq);
+        le_put_u32(out + 4, timestamp_ms);
+    }
+    if (len >= RECORDED_REQUEST_ID_OFFSET + 2 && out[0] >= 2) {
+        le_put_u16(out + RECORDED_REQUEST_ID_OFFSET, request_id);
+    }
+    if (len >= 2) {
+        out[1] = (uint8_t)((out[1] & ~RESULT_FLAG_STREAMED) | (request_id == 0 ? RESULT_FLAG_STREAMED : 0));
+    }
+    return len;
+}
+
+static size_t replay_synthetic(replay_load_t *load, uint32_t timestamp_ms, uint16_t request_id,
+                               uint8_t *out, size_t max_len)
+{
+    const float drift = sinf(2.0f * (float)M_PI * (float)(load->step % SYNTH_DRIFT_FRAMES) / SYNTH_DRIFT_FRAMES);
+    const float resonance_hz = SYNTH_CENTER_HZ + drift * SYNTH_DRIFT_HZ + rng_signed(&load->content_rng) * SYNTH_NOISE_HZ;
+    const float s11_db = SYNTH_DEPTH_DB + drift * SYNTH_DEPTH_SWING_DB + rng_signed(&load->content_rng) * SYNTH_NOISE_DB;
+    const int16_t s11_cdb = result_frame_db_to_cdb(s11_db);
+    result_frame_t frame = {
+        .flags = RESULT_FLAG_VALID | RESULT_FLAG_HAS_MODEL | (request_id == 0 ? RESULT_FLAG_STREAMED : 0),
+        .seq = load->seq,
+        .timestamp_ms = timestamp_ms,
+        .resonance_hz = (uint32_t)resonance_hz,
+        .s11_cdb = s11_cdb,
+        .points_acquired = SYNTH_POINTS,
+        .request_id = request_id,
+        .sweeps_averaged = 1,
+        .model_output = SYNTH_PERMITTIVITY + drift * SYNTH_PERM_SWING,
+        .dip_count = 2,
+        .dips = {
+            { .resonance_hz = (uint32_t)resonance_hz, .s11_cdb = s11_cdb,
+              .prominence_cdb = (uint16_t)(SYNTH_FEATURE_CDB - s11_cdb), .width_khz = SYNTH_WIDTH_KHZ },
+            { .resonance_hz = SYNTH_FEATURE_HZ, .s11_cdb = SYNTH_FEATURE_CDB * 2,
+              .prominence_cdb = -SYNTH_FEATURE_CDB, .width_khz = SYNTH_WIDTH_KHZ / 4 },
+        },
+    };
+    return result_frame_encode(&frame, out, max_len);
+}
+
+size_t replay_load_next_frame(replay_load_t *load, uint32_t timestamp_ms, uint16_t request_id,
+                              uint8_t *out, size_t max_len)
+{
+    const size_t len = load->recording ? replay_recorded(load, timestamp_ms, request_id, out, max_len)
+                                       : replay_synthetic(load, timestamp_ms, request_id, out, max_len);
+    if (len > 0) {
+        load->seq++;
+        load->step++;
+        load->frames++;
+    }
+    return len;
+}
+
+bool replay_load_lose(replay_load_t *load)
+{
+    const uint32_t r = rng_next(&load->loss_rng) % 1000;
+    bool lost = false;
+    switch (load->config.loss) {
+    case REPLAY_LOSS_RANDOM:
+        lost = r < load->config.loss_permille;
+        break;
+    case REPLAY_LOSS_BURSTY:
+        if (load->in_loss_burst) {
+            lost = true;
+            load->in_loss_burst = (r >= load->config.exit_permille);
+        } else {
+            lost = load->in_loss_burst = (r < load->config.loss_permille);
+        }
+        break;
+    default:
+        break;
+    }
+    if (lost) {
+        load->lost++;
+    }
+    return lost;
+}
@@ -0,0 +1,108 @@
+// replay_load.h
+// Deterministic load generator for result frames (result_frame.h), used by the replay
+// server (replay_server.c) to exercise a client's ingest path without a sensor. Frames are
+// either synthetic (a slowly drifting resonance with noise, in the current frame version)
+// or taken in turn from a recording, with seq and timestamp rewritten so the stream stays
+// consistent. Bursts of frames go out every period with optional jitter, and a loss model
+// drops some of them on purpose, as a poor link would.
+//
+// Frame content, jitter and losses each come from their own PRNG stream derived from the
+// seed, so the same seed gives the same frames and the same losses at any rate or timing.
+//
+// Recording layout (as sim_client.py --record writes it):
+//  per frame: u8 length (1-RESULT_FRAME_MAX_LEN), then the frame as received
+#ifndef REPLAY_LOAD_H
+#define REPLAY_LOAD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define REPLAY_LOAD_BURST_MAX       (64)
+#define REPLAY_LOAD_PERIOD_MIN_US   (100)     // 10 kHz of bursts
+#define REPLAY_LOAD_CATCH_UP_MAX    (16)      // Overdue bursts sent at once before the schedule restarts
+
+typedef enum {
+    REPLAY_LOSS_NONE = 0,
+    REPLAY_LOSS_RANDOM,      // Each frame lost with loss_permille
+    REPLAY_LOSS_BURSTY,      // Gilbert model: a loss burst starts with loss_permille, ends with exit_permille per frame
+} replay_loss_model_t;
+
+typedef struct {
+    uint32_t period_us;      // Between bursts; 0 = frames only on request
+    uint16_t burst;          // Frames per burst, back to back
+    uint8_t jitter_pct;      // Each period varies uniformly by up to this much either way
+    replay_loss_model_t loss;
+    uint16_t loss_permille;
+    uint16_t exit_permille;  // BURSTY only; the mean burst is 1000 / exit_permille frames
+    uint32_t seed;
+} replay_load_config_t;
+
+typedef struct {
+    replay_load_config_t config;
+    const uint8_t *recording;     // NULL: synthetic frames
+    size_t recording_len;
+    size_t recording_pos;
+    uint32_t content_rng;
+    uint32_t timing_rng;
+    uint32_t loss_rng;
+    bool in_loss_burst;
+    uint16_t seq;
+    uint32_t step;                // Frames generated since the seed was applied
+    int64_t next_burst_us;
+    uint32_t frames;              // Counters since replay_load_init()
+    uint32_t lost;
+    uint32_t late_bursts;         // Skipped when the caller fell too far behind
+} replay_load_t;
+
+/**
+ * @brief True if `config` is usable: burst 1-REPLAY_LOAD_BURST_MAX, jitter up to 100 %,
+ * probabilities up to 1000 permille, period 0 or at least REPLAY_LOAD_PERIOD_MIN_US.
+ */
+bool replay_load_config_valid(const replay_load_config_t *config);
+
+/**
+ * @brief Number of frames in `recording`, or 0 if it is empty or malformed.
+ */
+size_t replay_load_recording_count(const uint8_t *recording, size_t len);
+
+/**
+ * @brief Starts generating with `config` from `now_us`; `recording` (NULL = synthetic) must
+ * outlive the generator. Counters and the PRNG streams restart.
+ */
+void replay_load_init(replay_load_t *load, const replay_load_config_t *config,
+                      const uint8_t *recording, size_t recording_len, int64_t now_us);
+
+/**
+ * @brief Changes the rate, burst or loss settings without restarting the frame sequence.
+ * The next burst is due now.
+ */
+void replay_load_reconfigure(replay_load_t *load, const replay_load_config_t *config, int64_t now_us);
+
+/**
+ * @brief Frames of every burst due by `now_us` (at most REPLAY_LOAD_CATCH_UP_MAX bursts;
+ * older ones count as late). `next_us` is set to when the next burst is due, or -1.
+ */
+uint32_t replay_load_due(replay_load_t *load, int64_t now_us, int64_t *next_us);
+
+/**
+ * @brief Writes the next frame into `out`: streamed unless `request_id` is non-zero.
+ * @return Its length, or 0 if `max_len` is too small
+ */
+size_t replay_load_next_frame(replay_load_t *load, uint32_t timestamp_ms, uint16_t request_id,
+                              uint8_t *out, size_t max_len);
+
+/**
+ * @brief Loss model's verdict on the frame about to be sent.
+ */
+bool replay_load_lose(replay_load_t *load);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REPLAY_LOAD_H
@@ -0,0 +1,586 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "nvs_flash.h"
+
+// --- FreeRTOS ---
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+// --- NimBLE ---
+#include "nimble/nimble_port.h"
+#include "nimble/nimble_port_freertos.h"
+#include "host/ble_hs.h"
+#include "host/util/util.h"
+#include "services/gap/ble_svc_gap.h"
+#include "services/gatt/ble_svc_gatt.h"
+
+#include "result_frame.h"
+#include "replay_load.h"
+#include "replay_server.h"
+
+static const char *TAG = "REPLAY";
+
+// --- Configuration ---
+#define BLE_DEVICE_NAME              "ESP32_NanoVNA_Stream" // The sensor's, so the app connects unchanged
+#define BLE_TRIGGER_STRING           "DATA REQUESTED"
+#define REPLAY_MAX_CLIENTS           (3)     // Keep <= CONFIG_BT_NIMBLE_MAX_CONNECTIONS
+#define REPLAY_PENDING_MAX           (8)     // Requests waiting out their reply delay
+#define REPLAY_TASK_PRIORITY         (tskIDLE_PRIORITY + 4)
+#define REPLAY_ADV_ITVL_MS           (100)
+#define REPLAY_STATS_PERIOD_MS       (5000)
+#define REPLAY_REPLY_DELAY_MS_DEFAULT (70)   // About one 1024-point sweep of the sensor
+#define REPLAY_IDLE_WAIT_MS          (1000)  // Longest sleep with nothing due, so the counters still get logged
+#define REPLAY_NOTIFY_RETRIES        (50)    // Waits of REPLAY_RETRY_DELAY_MS for mbufs per answer, as the firmware
+#define REPLAY_RETRY_DELAY_MS        (5)
+
+// Same service and result characteristic as the sensor firmware (usb_cdc.c)
+static const ble_uuid128_t SERVICE_UUID = BLE_UUID128_INIT(
+    0x4f, 0xaf, 0xc2, 0x01, 0x1f, 0xb5, 0x45, 0x9e,
+    0x8f, 0xcc, 0xc5, 0xc9, 0xc3, 0x31, 0x91, 0x4b
+);
+static const ble_uuid128_t CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xbe, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+
+// --- State ---
+typedef struct {
+    uint16_t conn_handle;         // BLE_HS_CONN_HANDLE_NONE: free slot
+    bool subscribed;
+} replay_client_t;
+
+typedef struct {
+    uint16_t conn_handle;
+    uint16_t request_id;
+    int64_t due_us;
+} replay_request_t;
+
+static replay_server_config_t server_config;
+static SemaphoreHandle_t state_mutex;                 // Guards everything below
+static SemaphoreHandle_t wake_sem;                    // Wakes the generator task after a command
+static replay_load_t replay_load;
+static replay_client_t replay_clients[REPLAY_MAX_CLIENTS];
+static replay_request_t pending_requests[REPLAY_PENDING_MAX];
+static size_t pending_count = 0;
+static uint8_t last_frame[RESULT_FRAME_MAX_LEN];      // Read value of the result characteristic
+static size_t last_frame_len = 0;
+static uint32_t notified_count = 0;                   // Frames handed to the stack, per client
+static uint32_t backpressured_count = 0;              // Frames the stack had no room for
+static uint16_t result_chr_handle;
+static uint16_t next_auto_request_id = 0x8000;        // As the firmware numbers untagged requests
+static int64_t stats_start_us = 0;                    // Window of the rate logged with the counters
+static uint32_t stats_start_frames = 0;
+
+static int gatt_chr_access_cb(uint16_t conn_handle, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static void ble_app_on_sync(void);
+
+static const struct ble_gatt_svc_def gatt_svr_svcs[] = {
+    {
+        .type = BLE_GATT_SVC_TYPE_PRIMARY,
+        .uuid = &SERVICE_UUID.u,
+        .characteristics = (struct ble_gatt_chr_def[]) {
+            {
+                .uuid = &CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_NOTIFY,
+                .val_handle = &result_chr_handle,
+            },
+            { 0 } // End of characteristics
+        }
+    },
+    { 0 } // End of services
+};
+
+void replay_server_default_config(replay_server_config_t *config)
+{
+    *config = (replay_server_config_t){
+        .load = {
+            .period_us = 0,
+            .burst = 1,
+            .jitter_pct = 0,
+            .loss = REPLAY_LOSS_NONE,
+            .seed = 1,
+        },
+        .mtu = BLE_ATT_MTU_MAX,
+        .reply_delay_ms = REPLAY_REPLY_DELAY_MS_DEFAULT,
+        .recording = NULL,
+        .recording_len = 0,
+    };
+}
+
+// =========================================================================
+// == Frame Generation                                                    ==
+// =========================================================================
+
+/**
+ * @brief Queues one frame to `conn_handle`. Without `wait` a full stack drops it, as a client
+ * that cannot keep up would see; with it (request answers) it waits briefly for mbufs, as the
+ * firmware's ble_notify_result() does. Do not hold state_mutex when waiting.
+ * @return 0 on success, otherwise a NimBLE error code (BLE_HS_ENOTCONN if the client is gone)
+ */
+static int notify_frame(uint16_t conn_handle, const uint8_t *frame, size_t len, bool wait)
+{
+    int rc;
+    int retries = 0;
+    while (true) {
+        struct os_mbuf *om = ble_hs_mbuf_from_flat(frame, (uint16_t)len);
+        rc = (om != NULL) ? ble_gatts_notify_custom(conn_handle, result_chr_handle, om) : BLE_HS_ENOMEM;
+        if (rc != BLE_HS_ENOMEM || !wait || retries++ >= REPLAY_NOTIFY_RETRIES) {
+            return rc;
+        }
+        vTaskDelay(pdMS_TO_TICKS(REPLAY_RETRY_DELAY_MS));
+    }
+}
+
+/**
+ * @brief Counts the outcome `rc` of notify_frame(). Caller holds state_mutex.
+ */
+static void count_notify(int rc)
+{
+    if (rc == 0) {
+        notified_count++;
+    } else if (rc != BLE_HS_ENOTCONN) {
+        backpressured_count++;
+    }
+}
+
+/**
+ * @brief Generates one frame into `frame` and makes it the read value.
+ * Caller holds state_mutex.
+ * @return Its length, or 0 if there is none or the loss model drops it
+ */
+static size_t next_frame(uint16_t request_id, int64_t now_us, uint8_t *frame)
+{
+    const size_t len = replay_load_next_frame(&replay_load, (uint32_t)(now_us / 1000), request_id, frame, RESULT_FRAME_MAX_LEN);
+    if (len == 0) {
+        return 0;
+    }
+    memcpy(last_frame, frame, len);
+    last_frame_len = len;
+    if (replay_load_lose(&replay_load)) {
+        return 0; // Lost for every client, as if the sensor's radio dropped it
+    }
+    return len;
+}
+
+/**
+ * @brief Generates one unsolicited frame and sends it to every subscribed client without
+ * waiting. Caller holds state_mutex.
+ */
+static void send_next_frame(int64_t now_us)
+{
+    uint8_t frame[RESULT_FRAME_MAX_LEN];
+    const size_t len = next_frame(0, now_us, frame);
+    if (len == 0) {
+        return;
+    }
+    for (size_t i = 0; i < REPLAY_MAX_CLIENTS; ++i) {
+        const replay_client_t *client = &replay_clients[i];
+        if (client->conn_handle != BLE_HS_CONN_HANDLE_NONE && client->subscribed) {
+            count_notify(notify_frame(client->conn_handle, frame, len, false));
+        }
+    }
+}
+
+/**
+ * @brief Answers `request` with one frame, waiting for mbufs so a load of unsolicited frames
+ * cannot crowd the answer out. Takes state_mutex itself, but not across the wait.
+ */
+static void answer_request(const replay_request_t *request)
+{
+    uint8_t frame[RESULT_FRAME_MAX_LEN];
+    xSemaphoreTake(state_mutex, portMAX_DELAY);
+    const size_t len = next_frame(request->request_id, esp_timer_get_time(), frame);
+    xSemaphoreGive(state_mutex);
+    if (len == 0) {
+        return;
+    }
+    const int rc = notify_frame(request->conn_handle, frame, len, true);
+    xSemaphoreTake(state_mutex, portMAX_DELAY);
+    count_notify(rc);
+    xSemaphoreGive(state_mutex);
+}
+
+/**
+ * @brief Logs the counters, with the rate of the `frames` generated over the last `elapsed_us`.
+ * Caller holds state_mutex.
+ */
+static void log_stats(int64_t elapsed_us, uint32_t frames)
+{
+    ESP_LOGI(TAG, "%" PRIu32 " frames (%.1f/s lately), %" PRIu32 " notified, %" PRIu32 " lost, %" PRIu32 " backpressured, "
+             "%" PRIu32 " late bursts", replay_load.frames, elapsed_us > 0 ? frames * 1e6 / elapsed_us : 0.0,
+             notified_count, replay_load.lost, backpressured_count, replay_load.late_bursts);
+}
+
+/**
+ * @brief Sends due bursts and request replies, then sleeps until the next is due or a
+ * command changes the load.
+ */
+static void replay_task(void *param)
+{
+    while (true) {
+        const int64_t now_us = esp_timer_get_time();
+        xSemaphoreTake(state_mutex, portMAX_DELAY);
+        int64_t next_us = -1;
+        const uint32_t due = replay_load_due(&replay_load, now_us, &next_us);
+        for (uint32_t i = 0; i < due; ++i) {
+            send_next_frame(now_us);
+        }
+        replay_request_t answering[REPLAY_PENDING_MAX];
+        size_t answer_count = 0;
+        size_t kept = 0;
+        for (size_t i = 0; i < pending_count; ++i) {
+            const replay_request_t request = pending_requests[i];
+            if (request.due_us <= now_us) {
+                answering[answer_count++] = request;
+                continue;
+            }
+            if (next_us < 0 || request.due_us < next_us) {
+                next_us = request.due_us;
+            }
+            pending_requests[kept++] = request;
+        }
+        pending_count = kept;
+        if (now_us - stats_start_us >= (int64_t)REPLAY_STATS_PERIOD_MS * 1000) {
+            if (replay_load.frames != stats_start_frames) {
+                log_stats(now_us - stats_start_us, replay_load.frames - stats_start_frames);
+            }
+            stats_start_us = now_us;
+            stats_start_frames = replay_load.frames;
+        }
+        xSemaphoreGive(state_mutex);
+        for (size_t i = 0; i < answer_count; ++i) {
+            answer_request(&answering[i]); // Outside the lock: it may wait for mbufs
+        }
+
+        int64_t wait_us = (int64_t)REPLAY_IDLE_WAIT_MS * 1000;
+        if (next_us >= 0 && next_us - now_us < wait_us) {
+            wait_us = next_us - now_us;
+        }
+        if (wait_us > 0) {
+            xSemaphoreTake(wake_sem, (TickType_t)((wait_us + portTICK_PERIOD_MS * 1000 - 1) / (portTICK_PERIOD_MS * 1000)));
+        }
+    }
+}
+
+// =========================================================================
+// == Commands                                                            ==
+// =========================================================================
+
+/**
+ * @brief Applies a changed load (rate, burst, jitter or loss) from now on.
+ */
+static void apply_load(const replay_load_config_t *config)
+{
+    if (!replay_load_config_valid(config)) {
+        ESP_LOGW(TAG, "Rejecting load: burst 1-%d, jitter up to 100 %%, loss up to 1000 permille, "
+                 "at most %d bursts a second.", REPLAY_LOAD_BURST_MAX, 1000000 / REPLAY_LOAD_PERIOD_MIN_US);
+        return;
+    }
+    xSemaphoreTake(state_mutex, portMAX_DELAY);
+    replay_load_reconfigure(&replay_load, config, esp_timer_get_time());
+    xSemaphoreGive(state_mutex);
+    xSemaphoreGive(wake_sem);
+}
+
+/**
+ * @brief Dispatches a null-terminated command string written by the client (see replay_server.h).
+ */
+static void handle_command(uint16_t conn_handle, const char *cmd)
+{
+    unsigned int request_id = 0, priority = 0, period_ms = 0, rate_hz = 0, burst = 1, jitter_pct = 0;
+    unsigned int loss_permille = 0, exit_permille = 0;
+    unsigned long seed = 0;
+    int fields = 0;
+
+    xSemaphoreTake(state_mutex, portMAX_DELAY);
+    replay_load_config_t config = replay_load.config;
+    xSemaphoreGive(state_mutex);
+
+    if (strcmp(cmd, BLE_TRIGGER_STRING) == 0 || sscanf(cmd, BLE_TRIGGER_STRING " %u %u", &request_id, &priority) >= 1) {
+        if (request_id == 0) {
+            request_id = next_auto_request_id;
+            next_auto_request_id = (next_auto_request_id == UINT16_MAX) ? 0x8000 : next_auto_request_id + 1;
+        }
+        xSemaphoreTake(state_mutex, portMAX_DELAY);
+        const bool queued = (pending_count < REPLAY_PENDING_MAX);
+        if (queued) {
+            pending_requests[pending_count++] = (replay_request_t){
+                .conn_handle = conn_handle,
+                .request_id = (uint16_t)request_id,
+                .due_us = esp_timer_get_time() + (int64_t)server_config.reply_delay_ms * 1000,
+            };
+        }
+        xSemaphoreGive(state_mutex);
+        if (!queued) {
+            ESP_LOGW(TAG, "Request %u dropped: %d already pending.", request_id, REPLAY_PENDING_MAX);
+            return;
+        }
+        xSemaphoreGive(wake_sem);
+    } else if (strcmp(cmd, "STREAM OFF") == 0 || strcmp(cmd, "LOAD OFF") == 0) {
+        config.period_us = 0;
+        apply_load(&config);
+        ESP_LOGI(TAG, "Load stopped.");
+    } else if (sscanf(cmd, "STREAM %u", &period_ms) == 1) {
+        config.period_us = period_ms * 1000;
+        config.burst = 1;
+        apply_load(&config);
+        ESP_LOGI(TAG, "Streaming a frame every %u ms.", period_ms);
+    } else if ((fields = sscanf(cmd, "LOAD %u %u %u", &rate_hz, &burst, &jitter_pct)) >= 1) {
+        config.period_us = (rate_hz > 0) ? 1000000 / rate_hz : 0;
+        config.burst = (burst > UINT16_MAX) ? 0 : (uint16_t)burst;
+        config.jitter_pct = (fields == 3) ? ((jitter_pct > UINT8_MAX) ? UINT8_MAX : (uint8_t)jitter_pct) : config.jitter_pct;
+        apply_load(&config);
+        ESP_LOGI(TAG, "Load: %u bursts of %u frames a second, %u %% jitter.", rate_hz, config.burst, config.jitter_pct);
+    } else if (strcmp(cmd, "LOSS OFF") == 0) {
+        config.loss = REPLAY_LOSS_NONE;
+        apply_load(&config);
+        ESP_LOGI(TAG, "Loss off.");
+    } else if (sscanf(cmd, "LOSS BURST %u %u", &loss_permille, &exit_permille) == 2) {
+        config.loss = REPLAY_LOSS_BURSTY;
+        config.loss_permille = (loss_permille > 1000) ? UINT16_MAX : (uint16_t)loss_permille;
+        config.exit_permille = (exit_permille > 1000) ? UINT16_MAX : (uint16_t)exit_permille;
+        apply_load(&config);
+        ESP_LOGI(TAG, "Loss bursts start with %u and end with %u permille per frame.", loss_permille, exit_permille);
+    } else if (sscanf(cmd, "LOSS %u", &loss_permille) == 1) {
+        config.loss = REPLAY_LOSS_RANDOM;
+        config.loss_permille = (loss_permille > 1000) ? UINT16_MAX : (uint16_t)loss_permille;
+        apply_load(&config);
+        ESP_LOGI(TAG, "Losing %u permille of frames.", loss_permille);
+    } else if (sscanf(cmd, "SEED %lu", &seed) == 1) {
+        config.seed = (uint32_t)seed;
+        xSemaphoreTake(state_mutex, portMAX_DELAY);
+        replay_load_init(&replay_load, &config, server_config.recording, server_config.recording_len, esp_timer_get_time());
+        notified_count = 0;
+        backpressured_count = 0;
+        stats_start_frames = 0;
+        xSemaphoreGive(state_mutex);
+        xSemaphoreGive(wake_sem);
+        ESP_LOGI(TAG, "Sequences restarted from seed %lu.", seed);
+    } else if (strcmp(cmd, "STATS") == 0) {
+        xSemaphoreTake(state_mutex, portMAX_DELAY);
+        log_stats(esp_timer_get_time() - stats_start_us, replay_load.frames - stats_start_frames);
+        xSemaphoreGive(state_mutex);
+    } else {
+        ESP_LOGW(TAG, "Unknown command \"%s\".", cmd);
+    }
+}
+
+// =========================================================================
+// == NimBLE GATT Server Logic                                            ==
+// =========================================================================
+
+/**
+ * @brief Result characteristic: writes are commands, a read returns the last frame generated.
+ */
+static int gatt_chr_access_cb(uint16_t conn_handle, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg)
+{
+    if (ctxt->op == BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        char buf[48];
+        uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+        if (len == 0 || len >= sizeof(buf) || ble_hs_mbuf_to_flat(ctxt->om, buf, sizeof(buf) - 1, NULL) != 0) {
+            return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+        }
+        buf[len] = '\0';
+        handle_command(conn_handle, buf);
+        return 0;
+    }
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t frame[RESULT_FRAME_MAX_LEN];
+    xSemaphoreTake(state_mutex, portMAX_DELAY);
+    const size_t len = last_frame_len;
+    memcpy(frame, last_frame, len);
+    xSemaphoreGive(state_mutex);
+    int rc = os_mbuf_append(ctxt->om, frame, len);
+    return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/**
+ * @brief Takes or frees the client slot of `conn_handle`.
+ * @return false if there is no free slot
+ */
+static bool client_set(uint16_t conn_handle, bool connected)
+{
+    bool ok = !connected;
+    xSemaphoreTake(state_mutex, portMAX_DELAY);
+    for (size_t i = 0; i < REPLAY_MAX_CLIENTS; ++i) {
+        replay_client_t *client = &replay_clients[i];
+        if (connected && !ok && client->conn_handle == BLE_HS_CONN_HANDLE_NONE) {
+            *client = (replay_client_t){ .conn_handle = conn_handle, .subscribed = false };
+            ok = true;
+        } else if (!connected && client->conn_handle == conn_handle) {
+            client->conn_handle = BLE_HS_CONN_HANDLE_NONE;
+        }
+    }
+    if (!connected) {
+        // Replies still waiting for the client are dropped
+        size_t kept = 0;
+        for (size_t i = 0; i < pending_count; ++i) {
+            if (pending_requests[i].conn_handle != conn_handle) {
+                pending_requests[kept++] = pending_requests[i];
+            }
+        }
+        pending_count = kept;
+    }
+    xSemaphoreGive(state_mutex);
+    return ok;
+}
+
+static int ble_on_mtu_exchanged(uint16_t conn_handle, const struct ble_gatt_error *error, uint16_t mtu, void *arg)
+{
+    if (error->status == 0) {
+        ESP_LOGI(TAG, "MTU exchange complete; conn=0x%x, mtu=%u", conn_handle, mtu);
+    }
+    return 0;
+}
+
+static int gap_event_handler(struct ble_gap_event *event, void *arg)
+{
+    switch (event->type) {
+    case BLE_GAP_EVENT_CONNECT:
+        if (event->connect.status == 0) {
+            ESP_LOGI(TAG, "Client connected; conn_handle=0x%x", event->connect.conn_handle);
+            if (!client_set(event->connect.conn_handle, true)) {
+                ble_gap_terminate(event->connect.conn_handle, BLE_ERR_REM_USER_CONN_TERM);
+                return 0;
+            }
+            ble_gattc_exchange_mtu(event->connect.conn_handle, ble_on_mtu_exchanged, NULL);
+        }
+        ble_app_on_sync(); // Keep advertising for further clients
+        return 0;
+
+    case BLE_GAP_EVENT_DISCONNECT:
+        ESP_LOGI(TAG, "Client disconnected; reason=0x%x", event->disconnect.reason);
+        client_set(event->disconnect.conn.conn_handle, false);
+        ble_app_on_sync();
+        return 0;
+
+    case BLE_GAP_EVENT_ADV_COMPLETE:
+        ble_app_on_sync();
+        return 0;
+
+    case BLE_GAP_EVENT_SUBSCRIBE:
+        if (event->subscribe.attr_handle == result_chr_handle) {
+            xSemaphoreTake(state_mutex, portMAX_DELAY);
+            for (size_t i = 0; i < REPLAY_MAX_CLIENTS; ++i) {
+                if (replay_clients[i].conn_handle == event->subscribe.conn_handle) {
+                    replay_clients[i].subscribed = event->subscribe.cur_notify;
+                }
+            }
+            xSemaphoreGive(state_mutex);
+        }
+        return 0;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Advertises while a client slot is free.
+ */
+static void ble_app_on_sync(void)
+{
+    size_t free_slots = 0;
+    xSemaphoreTake(state_mutex, portMAX_DELAY);
+    for (size_t i = 0; i < REPLAY_MAX_CLIENTS; ++i) {
+        free_slots += (replay_clients[i].conn_handle == BLE_HS_CONN_HANDLE_NONE);
+    }
+    xSemaphoreGive(state_mutex);
+    if (free_slots == 0 || ble_gap_adv_active()) {
+        return;
+    }
+    int rc = ble_hs_util_ensure_addr(0);
+    assert(rc == 0);
+    struct ble_gap_adv_params adv_params;
+    memset(&adv_params, 0, sizeof(adv_params));
+    adv_params.conn_mode = BLE_GAP_CONN_MODE_UND;
+    adv_params.disc_mode = BLE_GAP_DISC_MODE_GEN;
+    adv_params.itvl_min = (uint16_t)(REPLAY_ADV_ITVL_MS * 8 / 5); // 0.625 ms units
+    adv_params.itvl_max = adv_params.itvl_min;
+    rc = ble_gap_adv_start(BLE_OWN_ADDR_PUBLIC, NULL, BLE_HS_FOREVER, &adv_params, gap_event_handler, NULL);
+    if (rc != 0) {
+        ESP_LOGE(TAG, "Error starting advertising; rc=%d", rc);
+    }
+}
+
+static void ble_app_on_reset(int reason)
+{
+    ESP_LOGE(TAG, "Resetting BLE stack; reason=%d", reason);
+}
+
+static void nimble_host_task(void *param)
+{
+    nimble_port_run(); // Returns only when nimble_port_stop() is called
+    nimble_port_freertos_deinit();
+    vTaskDelete(NULL);
+}
+
+void replay_server_start(const replay_server_config_t *config)
+{
+    server_config = *config;
+    esp_err_t ret = nvs_flash_init(); // The BLE controller keeps its calibration there
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        ret = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(ret);
+
+    state_mutex = xSemaphoreCreateMutex();
+    assert(state_mutex != NULL);
+    wake_sem = xSemaphoreCreateBinary();
+    assert(wake_sem != NULL);
+    for (size_t i = 0; i < REPLAY_MAX_CLIENTS; ++i) {
+        replay_clients[i].conn_handle = BLE_HS_CONN_HANDLE_NONE;
+    }
+    replay_load_config_t load_config = config->load;
+    if (!replay_load_config_valid(&load_config)) {
+        ESP_LOGW(TAG, "Invalid initial load; frames on request only.");
+        replay_server_default_config(&server_config);
+        server_config.recording = config->recording;
+        server_config.recording_len = config->recording_len;
+        load_config = server_config.load;
+    }
+    replay_load_init(&replay_load, &load_config, server_config.recording, server_config.recording_len, esp_timer_get_time());
+    stats_start_us = esp_timer_get_time();
+    if (server_config.recording != NULL && replay_load.recording == NULL) {
+        ESP_LOGW(TAG, "Recording malformed; replaying synthetic frames.");
+    }
+    ESP_LOGI(TAG, "Replaying %s frames: %" PRIu32 " us between bursts of %u, %u %% jitter, loss model %d, seed %" PRIu32 ".",
+             replay_load.recording ? "recorded" : "synthetic", load_config.period_us, load_config.burst,
+             load_config.jitter_pct, (int)load_config.loss, load_config.seed);
+
+    nimble_port_init();
+    if (ble_att_set_preferred_mtu(server_config.mtu) != 0) {
+        ESP_LOGW(TAG, "MTU %u out of range; offering %u.", server_config.mtu, ble_att_preferred_mtu());
+    }
+    ble_hs_cfg.sync_cb = ble_app_on_sync;
+    ble_hs_cfg.reset_cb = ble_app_on_reset;
+    ble_svc_gap_init();
+    ble_svc_gatt_init();
+    ret = ble_gatts_count_cfg(gatt_svr_svcs);
+    if (ret == 0) {
+        ret = ble_gatts_add_svcs(gatt_svr_svcs);
+    }
+    if (ret != 0) { ESP_LOGE(TAG, "Registering the GATT service failed rc=%d", ret); }
+    ble_svc_gap_device_name_set(BLE_DEVICE_NAME);
+    nimble_port_freertos_init(nimble_host_task);
+
+    BaseType_t task_created = xTaskCreate(replay_task, "replay", 4096, NULL, REPLAY_TASK_PRIORITY, NULL);
+    assert(task_created == pdTRUE);
+}
+
+void app_main(void)
+{
+    replay_server_config_t config;
+    replay_server_default_config(&config);
+    replay_server_start(&config);
+}
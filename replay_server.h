@@ -0,0 +1,48 @@
+// replay_server.h
+// BLE replay and load-generator server: advertises the sensor firmware's service and
+// result characteristic (usb_cdc.c) and answers its commands with result frames from
+// replay_load.h instead of NanoVNA sweeps. Built on its own in place of usb_cdc.c to give
+// the app a stand-in sensor, or on Linux as khealth_replay (host/replay_main.c).
+//
+// Commands written to the result characteristic:
+//   "DATA REQUESTED [<id> [<p>]]"  - one frame answering <id>, after the reply delay; unlike
+//                                    unsolicited frames it waits for the link rather than being dropped
+//   "STREAM <period_ms>" / "STREAM OFF" - one frame every period, as the firmware streams
+//   "LOAD <rate_hz> [<burst> [<jitter_pct>]]" / "LOAD OFF" - <burst> frames <rate_hz> times a second
+//   "LOSS OFF" / "LOSS <permille>" / "LOSS BURST <enter_permille> <exit_permille>" - drop frames on purpose
+//   "SEED <n>"                     - restart the frame, jitter and loss sequences from seed <n>
+//   "STATS"                        - log the counters now (they are logged periodically while loaded)
+#ifndef REPLAY_SERVER_H
+#define REPLAY_SERVER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "replay_load.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    replay_load_config_t load;     // Initial load; commands change it at run time
+    uint16_t mtu;                  // ATT MTU offered to clients (23-527, BLE_ATT_MTU_MAX); frames longer than MTU - 3 are cut
+    uint32_t reply_delay_ms;       // Time a "DATA REQUESTED" takes to answer, like a sweep
+    const uint8_t *recording;      // Frames to replay (layout in replay_load.h), or NULL for synthetic ones
+    size_t recording_len;
+} replay_server_config_t;
+
+/**
+ * @brief Fills `config` with the defaults: synthetic frames on request only, no loss, largest MTU.
+ */
+void replay_server_default_config(replay_server_config_t *config);
+
+/**
+ * @brief Starts NimBLE and the generator task with `config` (copied; the recording is not).
+ */
+void replay_server_start(const replay_server_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REPLAY_SERVER_H
@@ -0,0 +1,55 @@
+#include <string.h>
+#include <math.h>
+#include "result_frame.h"
+#include "le_bytes.h"
+
+int16_t result_frame_db_to_cdb(double s11_db)
+{
+    if (isnan(s11_db)) {
+        return 0;
+    }
+    double cdb = round(s11_db * 100.0);
+    if (cdb > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (cdb < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)cdb;
+}
+
+size_t result_frame_encode(const result_frame_t *frame, uint8_t *out, size_t out_len)
+{
+    const uint8_t dip_count = (frame->dip_count < RESULT_FRAME_MAX_DIPS) ? frame->dip_count : RESULT_FRAME_MAX_DIPS;
+    const size_t dips_at = (frame->flags & RESULT_FLAG_HAS_MODEL) ? RESULT_FRAME_BASE_LEN + 4 : RESULT_FRAME_BASE_LEN;
+    const size_t len = dips_at + (size_t)dip_count * RESULT_FRAME_DIP_LEN;
+    if (out_len < len) {
+        return 0;
+    }
+
+    out[0] = RESULT_FRAME_VERSION;
+    out[1] = frame->flags;
+    le_put_u16(out + 2, frame->seq);
+    le_put_u32(out + 4, frame->timestamp_ms);
+    le_put_u32(out + 8, frame->resonance_hz);
+    le_put_u16(out + 12, (uint16_t)frame->s11_cdb);
+    le_put_u16(out + 14, frame->points_acquired);
+    le_put_u16(out + 16, frame->request_id);
+    out[18] = frame->sweeps_averaged;
+    out[19] = dip_count;
+    le_put_u16(out + 20, (uint16_t)frame->noise_cdb);
+    if (frame->flags & RESULT_FLAG_HAS_MODEL) {
+        uint32_t bits;
+        memcpy(&bits, &frame->model_output, sizeof(bits)); // IEEE-754 single, sent little-endian
+        le_put_u32(out + RESULT_FRAME_BASE_LEN, bits);
+    }
+    for (uint8_t i = 0; i < dip_count; ++i) {
+        const result_frame_dip_t *dip = &frame->dips[i];
+        uint8_t *p = out + dips_at + (size_t)i * RESULT_FRAME_DIP_LEN;
+        le_put_u32(p, dip->resonance_hz);
+        le_put_u16(p + 4, (uint16_t)dip->s11_cdb);
+        le_put_u16(p + 6, dip->prominence_cdb);
+        le_put_u16(p + 8, dip->width_khz);
+    }
+    return len;
+}
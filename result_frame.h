@@ -0,0 +1,89 @@
+// result_frame.h
+// Fixed-layout binary result frame sent as the BLE notification/read value.
+// All multi-byte fields are little-endian.
+//
+//  Offset  Size  Field
+//  0       1     version          (RESULT_FRAME_VERSION)
+//  1       1     flags            (RESULT_FLAG_*)
+//  2       2     seq              (uint16, increments per frame, wraps)
+//  4       4     timestamp_ms     (uint32, device uptime)
+//  8       4     resonance_hz     (uint32)
+//  12      2     s11_cdb          (int16, S11 depth in centi-dB)
+//  14      2     points_acquired  (uint16, points read for this result)
+//  16      2     request_id       (uint16, id of the request answered; 0 for streamed readings
+//                                    and for copies sent to clients that did not request the sweep)
+//  18      1     sweeps_averaged  (uint8, sweeps combined into this result; 1 = single sweep)
+//  19      1     dip_count        (uint8, dips listed at the end, 0-RESULT_FRAME_MAX_DIPS)
+//  20      2     noise_cdb        (int16, single-sweep S11 noise of the averaged window in centi-dB,
+//                                    see sweep_average_noise_db(); only when sweeps_averaged >= 2)
+//  22      4     model_output     (float32, only when RESULT_FLAG_HAS_MODEL is set)
+//  22/26   10*n  dips             (after model_output if present), most prominent first:
+//                  u32 resonance_hz, int16 s11_cdb, u16 prominence_cdb, u16 width_khz
+//                  (at half prominence, saturating); see dip_detect.h
+//
+// Older firmware: version 3 frames have no dips (byte 19 reserved, 0);
+// version 2 frames end at request_id (model_output at offset 18);
+// version 1 frames also lack request_id (model_output at offset 16).
+#ifndef RESULT_FRAME_H
+#define RESULT_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RESULT_FRAME_VERSION      (4)
+#define RESULT_FRAME_BASE_LEN     (22)
+#define RESULT_FRAME_DIP_LEN      (10)
+#define RESULT_FRAME_MAX_DIPS     (3)
+#define RESULT_FRAME_MAX_LEN      (RESULT_FRAME_BASE_LEN + 4 + RESULT_FRAME_MAX_DIPS * RESULT_FRAME_DIP_LEN)
+
+#define RESULT_FLAG_VALID         (1u << 0) // resonance_hz / s11_cdb hold a measured minimum
+#define RESULT_FLAG_READ_ERROR    (1u << 1) // Sweep did not complete
+#define RESULT_FLAG_NO_MINIMUM    (1u << 2) // Sweep completed but no finite minimum was found
+#define RESULT_FLAG_HAS_MODEL     (1u << 3) // model_output is present
+#define RESULT_FLAG_STREAMED      (1u << 4) // Produced by streaming mode rather than a trigger
+#define RESULT_FLAG_SKIPPED       (1u << 5) // Readings were skipped for this client before this one (backpressure)
+#define RESULT_FLAG_COALESCED     (1u << 6) // The same sweep also answered other pending requests
+#define RESULT_FLAG_REJECTED      (1u << 7) // Request queue (or the client's request budget) was full; no sweep was taken
+
+typedef struct {
+    uint32_t resonance_hz;
+    int16_t s11_cdb;
+    uint16_t prominence_cdb;
+    uint16_t width_khz;
+} result_frame_dip_t;
+
+typedef struct {
+    uint8_t flags;
+    uint16_t seq;
+    uint32_t timestamp_ms;
+    uint32_t resonance_hz;
+    int16_t s11_cdb;
+    uint16_t points_acquired;
+    uint16_t request_id;
+    uint8_t sweeps_averaged;
+    int16_t noise_cdb;
+    float model_output;
+    uint8_t dip_count;
+    result_frame_dip_t dips[RESULT_FRAME_MAX_DIPS];
+} result_frame_t;
+
+/**
+ * @brief Converts an S11 magnitude in dB to the frame's centi-dB field, saturating at int16 limits.
+ */
+int16_t result_frame_db_to_cdb(double s11_db);
+
+/**
+ * @brief Encodes `frame` into `out`.
+ * @return Number of bytes written, or 0 if `out_len` is too small
+ */
+size_t result_frame_encode(const result_frame_t *frame, uint8_t *out, size_t out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RESULT_FRAME_H
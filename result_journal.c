@@ -0,0 +1,294 @@
+#include "result_journal.h"
+#include "sweep_transfer.h"
+#include "le_bytes.h"
+
+#include <string.h>
+
+#define SLOT_ERASED_SEQ   (0xFFFFFFFFu)
+#define SCAN_BLOCK_SLOTS  (8)   // Slots read per flash access while opening
+
+typedef enum {
+    SLOT_ERASED = 0,
+    SLOT_VALID,
+    SLOT_CORRUPT,    // Written, but the CRC does not match (torn write)
+} slot_state_t;
+
+static uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint16_t slot_crc(const uint8_t *slot, uint8_t len)
+{
+    return crc16_ccitt(crc16_ccitt(0xFFFF, slot, 6), slot + RESULT_JOURNAL_HEADER_LEN, len);
+}
+
+static slot_state_t slot_decode(const uint8_t *slot, uint32_t *seq)
+{
+    *seq = le_get_u32(slot);
+    const uint8_t len = slot[4];
+    if (*seq == SLOT_ERASED_SEQ && len == 0xFF) {
+        return SLOT_ERASED;
+    }
+    if (len == 0 || len > RESULT_JOURNAL_FRAME_MAX) {
+        return SLOT_CORRUPT;
+    }
+    return (le_get_u16(slot + 6) == slot_crc(slot, len)) ? SLOT_VALID : SLOT_CORRUPT;
+}
+
+static esp_err_t read_slot(const result_journal_t *journal, uint32_t slot, uint8_t *out)
+{
+    return esp_partition_read(journal->partition, (size_t)slot * RESULT_JOURNAL_SLOT_LEN, out, RESULT_JOURNAL_SLOT_LEN);
+}
+
+esp_err_t result_journal_open(result_journal_t *journal, const esp_partition_t *partition, uint32_t acked_seq)
+{
+    memset(journal, 0, sizeof(*journal));
+    journal->partition = partition;
+    const uint32_t sectors = partition->size / RESULT_JOURNAL_SECTOR_LEN;
+    if (sectors < RESULT_JOURNAL_MIN_SECTORS) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    journal->slots = sectors * RESULT_JOURNAL_SLOTS_PER_SECTOR;
+
+    // The newest record marks the head, the oldest the start of the ring
+    bool found = false;
+    uint32_t max_seq = 0, max_slot = 0, min_seq = 0, min_slot = 0;
+    uint8_t block[SCAN_BLOCK_SLOTS * RESULT_JOURNAL_SLOT_LEN];
+    for (uint32_t first = 0; first < journal->slots; first += SCAN_BLOCK_SLOTS) {
+        esp_err_t err = esp_partition_read(partition, (size_t)first * RESULT_JOURNAL_SLOT_LEN, block, sizeof(block));
+        if (err != ESP_OK) {
+            return err;
+        }
+        for (uint32_t i = 0; i < SCAN_BLOCK_SLOTS; ++i) {
+            uint32_t seq;
+            if (slot_decode(block + i * RESULT_JOURNAL_SLOT_LEN, &seq) != SLOT_VALID) {
+                continue;
+            }
+            if (!found || seq > max_seq) {
+                max_seq = seq;
+                max_slot = first + i;
+            }
+            if (!found || seq < min_seq) {
+                min_seq = seq;
+                min_slot = first + i;
+            }
+            found = true;
+        }
+    }
+
+    journal->acked_seq = acked_seq;
+    if (!found) {
+        journal->next_seq = acked_seq + 1; // Sequence numbers never repeat, even after an erase
+        journal->oldest_seq = journal->next_seq;
+        return ESP_OK;
+    }
+    journal->next_seq = ((max_seq > acked_seq) ? max_seq : acked_seq) + 1;
+    journal->oldest_seq = min_seq;
+    journal->oldest_slot = min_slot;
+    journal->head_slot = (max_slot + 1) % journal->slots;
+
+    // Step over slots a lost write left dirty; the next sector boundary erases anyway
+    while (journal->head_slot % RESULT_JOURNAL_SLOTS_PER_SECTOR != 0) {
+        uint8_t slot[RESULT_JOURNAL_SLOT_LEN];
+        uint32_t seq;
+        esp_err_t err = read_slot(journal, journal->head_slot, slot);
+        if (err != ESP_OK) {
+            return err;
+        }
+        if (slot_decode(slot, &seq) == SLOT_ERASED) {
+            break;
+        }
+        journal->head_slot = (journal->head_slot + 1) % journal->slots;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Erases the sector the head is entering. If it holds the oldest records, counts the
+ * unacknowledged ones as dropped and moves the oldest record to the following sectors.
+ */
+static esp_err_t erase_head_sector(result_journal_t *journal)
+{
+    const uint32_t sector = journal->head_slot / RESULT_JOURNAL_SLOTS_PER_SECTOR;
+    const uint32_t sector_first = sector * RESULT_JOURNAL_SLOTS_PER_SECTOR;
+    const bool holds_oldest = (journal->oldest_seq != journal->next_seq) &&
+                              (journal->oldest_slot / RESULT_JOURNAL_SLOTS_PER_SECTOR == sector);
+    uint8_t slot[RESULT_JOURNAL_SLOT_LEN];
+    uint32_t seq;
+
+    if (holds_oldest) {
+        for (uint32_t i = 0; i < RESULT_JOURNAL_SLOTS_PER_SECTOR; ++i) {
+            if (read_slot(journal, sector_first + i, slot) == ESP_OK &&
+                slot_decode(slot, &seq) == SLOT_VALID && seq > journal->acked_seq) {
+                journal->dropped++;
+            }
+        }
+    }
+    esp_err_t err = esp_partition_erase_range(journal->partition, (size_t)sector * RESULT_JOURNAL_SECTOR_LEN,
+                                              RESULT_JOURNAL_SECTOR_LEN);
+    if (err != ESP_OK || !holds_oldest) {
+        return err;
+    }
+
+    journal->oldest_seq = journal->next_seq;
+    journal->oldest_slot = journal->head_slot;
+    const uint32_t others = journal->slots - RESULT_JOURNAL_SLOTS_PER_SECTOR;
+    for (uint32_t i = 0; i < others; ++i) {
+        const uint32_t s = (sector_first + RESULT_JOURNAL_SLOTS_PER_SECTOR + i) % journal->slots;
+        if (read_slot(journal, s, slot) == ESP_OK && slot_decode(slot, &seq) == SLOT_VALID) {
+            journal->oldest_seq = seq;
+            journal->oldest_slot = s;
+            break;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t result_journal_append(result_journal_t *journal, const uint8_t *frame, size_t len, uint32_t *seq_out)
+{
+    if (len == 0 || len > RESULT_JOURNAL_FRAME_MAX) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (journal->head_slot % RESULT_JOURNAL_SLOTS_PER_SECTOR == 0) {
+        esp_err_t err = erase_head_sector(journal);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    const uint32_t seq = journal->next_seq;
+    uint8_t slot[RESULT_JOURNAL_SLOT_LEN];
+    le_put_u32(slot, seq);
+    slot[4] = (uint8_t)len;
+    slot[5] = 0xFF;
+    memcpy(slot + RESULT_JOURNAL_HEADER_LEN, frame, len);
+    const uint16_t crc = slot_crc(slot, (uint8_t)len);
+    le_put_u16(slot + 6, crc);
+
+    const uint32_t slot_index = journal->head_slot;
+    // A failed write may have left the slot dirty: it is not reused until the next lap
+    journal->head_slot = (journal->head_slot + 1) % journal->slots;
+    esp_err_t err = esp_partition_write(journal->partition, (size_t)slot_index * RESULT_JOURNAL_SLOT_LEN,
+                                        slot, RESULT_JOURNAL_HEADER_LEN + len);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (journal->oldest_seq == journal->next_seq) {
+        journal->oldest_slot = slot_index;
+    }
+    journal->next_seq++;
+    if (seq_out != NULL) {
+        *seq_out = seq;
+    }
+    return ESP_OK;
+}
+
+bool result_journal_ack(result_journal_t *journal, uint32_t seq)
+{
+    if (seq <= journal->acked_seq || seq >= journal->next_seq) {
+        return false;
+    }
+    journal->acked_seq = seq;
+    return true;
+}
+
+uint32_t result_journal_pending(const result_journal_t *journal)
+{
+    const uint32_t first = (journal->acked_seq >= journal->oldest_seq) ? journal->acked_seq + 1 : journal->oldest_seq;
+    return (journal->next_seq > first) ? journal->next_seq - first : 0;
+}
+
+uint32_t result_journal_capacity(const result_journal_t *journal)
+{
+    return journal->slots;
+}
+
+void result_journal_sync_begin(const result_journal_t *journal, result_journal_sync_t *sync,
+                               uint32_t after_seq, uint8_t transfer_id)
+{
+    memset(sync, 0, sizeof(*sync));
+    sync->slot = journal->oldest_slot;
+    sync->after_seq = after_seq;
+    sync->end_seq = journal->next_seq;
+    sync->last_seq = after_seq;
+    sync->transfer_id = transfer_id;
+    sync->done = (journal->oldest_seq == journal->next_seq);
+    sync->pending[0] = RESULT_JOURNAL_SYNC_FORMAT;
+    sync->pending_len = 1;
+}
+
+/**
+ * @brief Loads the next record to send into sync->pending.
+ * @return false once the records held at the start of the sync are exhausted
+ */
+static bool sync_load_next(const result_journal_t *journal, result_journal_sync_t *sync)
+{
+    uint8_t slot[RESULT_JOURNAL_SLOT_LEN];
+    while (sync->visited < journal->slots) {
+        const uint32_t s = sync->slot;
+        sync->slot = (sync->slot + 1) % journal->slots;
+        sync->visited++;
+
+        uint32_t seq;
+        if (read_slot(journal, s, slot) != ESP_OK) {
+            continue;
+        }
+        const slot_state_t state = slot_decode(slot, &seq);
+        if (state == SLOT_ERASED || (state == SLOT_VALID && seq >= sync->end_seq)) {
+            return false; // Reached the head (or appends made since the sync began)
+        }
+        if (state != SLOT_VALID || seq <= sync->last_seq) {
+            continue;
+        }
+        const uint8_t len = slot[4];
+        memcpy(sync->pending, slot, 4);
+        sync->pending[4] = len;
+        memcpy(sync->pending + RESULT_JOURNAL_SYNC_RECORD_HEADER_LEN, slot + RESULT_JOURNAL_HEADER_LEN, len);
+        sync->pending_len = RESULT_JOURNAL_SYNC_RECORD_HEADER_LEN + len;
+        sync->pending_offset = 0;
+        sync->last_seq = seq;
+        sync->records++;
+        return true;
+    }
+    return false;
+}
+
+size_t result_journal_sync_next(const result_journal_t *journal, result_journal_sync_t *sync,
+                                uint8_t *out, size_t max_len)
+{
+    if ((sync->done && sync->pending_offset == sync->pending_len) || max_len <= SWEEP_PKT_HEADER_LEN) {
+        return 0;
+    }
+    size_t len = SWEEP_PKT_HEADER_LEN;
+    while (len < max_len) {
+        if (sync->pending_offset == sync->pending_len) {
+            if (sync->done || !sync_load_next(journal, sync)) {
+                sync->done = true;
+                break;
+            }
+        }
+        size_t n = sync->pending_len - sync->pending_offset;
+        if (n > max_len - len) {
+            n = max_len - len;
+        }
+        memcpy(out + len, sync->pending + sync->pending_offset, n);
+        sync->pending_offset += n;
+        len += n;
+    }
+    // Look ahead so the packet carrying the last byte is flagged
+    if (sync->pending_offset == sync->pending_len && !sync->done && !sync_load_next(journal, sync)) {
+        sync->done = true;
+    }
+
+    sweep_transfer_put_header(out, sync->packet_index == 0, sync->done && sync->pending_offset == sync->pending_len,
+                              sync->transfer_id, sync->packet_index);
+    sync->packet_index++;
+    return len;
+}
@@ -0,0 +1,124 @@
+// result_journal.h
+// Append-only journal of result frames in a dedicated flash partition, for
+// readings taken while no client could receive them.
+//
+// The partition is a ring of fixed-size slots written in order; a sector is
+// erased just before the head enters it, so every sector is erased once per lap
+// of the ring (wear levelling by rotation). A full journal overwrites its oldest
+// sector. Slot layout (little-endian):
+//  Offset  Size  Field
+//  0       4     seq              (uint32, journal sequence number, from 1; 0xFFFFFFFF = erased)
+//  4       1     len              (frame length)
+//  5       1     reserved         (0xFF)
+//  6       2     crc              (CRC-16/CCITT of bytes 0-5 and the frame)
+//  8       len   frame            (result_frame.h encoding, as it would have been notified)
+// A slot whose CRC does not match (power lost mid-write) is skipped.
+//
+// Records up to `acked_seq` have been received by a client and may be overwritten
+// freely; the caller persists acked_seq (the journal itself is never rewritten).
+//
+// Sync stream, sent in packets with the sweep_transfer.h header:
+//  0       1     format           (RESULT_JOURNAL_SYNC_FORMAT)
+//  1       5+N   records: u32 seq, u8 len, len bytes of frame
+// The packet carrying the last stream byte has SWEEP_PKT_LAST set; an empty journal
+// sends the format byte alone. Sequence numbers increase through the stream, with gaps
+// where records were overwritten, so a client acknowledges the last record it decoded.
+#ifndef RESULT_JOURNAL_H
+#define RESULT_JOURNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RESULT_JOURNAL_SLOT_LEN         (64)
+#define RESULT_JOURNAL_HEADER_LEN       (8)
+#define RESULT_JOURNAL_FRAME_MAX        (RESULT_JOURNAL_SLOT_LEN - RESULT_JOURNAL_HEADER_LEN)
+#define RESULT_JOURNAL_SECTOR_LEN       (4096)  // Flash erase unit
+#define RESULT_JOURNAL_SLOTS_PER_SECTOR (RESULT_JOURNAL_SECTOR_LEN / RESULT_JOURNAL_SLOT_LEN)
+#define RESULT_JOURNAL_MIN_SECTORS      (2)     // The sector being erased is never the only one
+#define RESULT_JOURNAL_SYNC_FORMAT      (1)
+#define RESULT_JOURNAL_SYNC_RECORD_HEADER_LEN (5)
+
+typedef struct {
+    const esp_partition_t *partition;
+    uint32_t slots;          // Slots in the ring (whole sectors of the partition)
+    uint32_t head_slot;      // Next slot to write
+    uint32_t next_seq;       // Sequence number of the next record
+    uint32_t oldest_slot;    // Slot of the oldest record still held (head_slot when empty)
+    uint32_t oldest_seq;     // Its sequence number (next_seq when empty)
+    uint32_t acked_seq;      // Records up to here have been received by a client
+    uint32_t dropped;        // Unacknowledged records overwritten since open
+} result_journal_t;
+
+typedef struct {
+    uint32_t slot;           // Next slot to look at
+    uint32_t visited;        // Slots looked at; the sync stops after one lap
+    uint32_t after_seq;      // Records up to here are not sent
+    uint32_t end_seq;        // next_seq when the sync started; later records wait for the next sync
+    uint32_t last_seq;       // Last record sent
+    uint32_t records;        // Records sent so far
+    uint8_t transfer_id;
+    uint16_t packet_index;
+    bool done;               // No records left to load
+    uint8_t pending[1 + RESULT_JOURNAL_SYNC_RECORD_HEADER_LEN + RESULT_JOURNAL_FRAME_MAX]; // Stream bytes not yet sent
+    size_t pending_len;
+    size_t pending_offset;
+} result_journal_sync_t;
+
+/**
+ * @brief Scans `partition` and positions the head after the newest valid record.
+ * @param acked_seq Last acknowledged sequence number, as persisted by the caller
+ * @return ESP_ERR_INVALID_SIZE if the partition holds fewer than RESULT_JOURNAL_MIN_SECTORS
+ *         sectors, or the flash read error
+ */
+esp_err_t result_journal_open(result_journal_t *journal, const esp_partition_t *partition, uint32_t acked_seq);
+
+/**
+ * @brief Appends one encoded result frame. Entering a new sector erases it first; the
+ * unacknowledged records it held are counted in `dropped`.
+ * @param seq_out Set to the record's sequence number (may be NULL)
+ */
+esp_err_t result_journal_append(result_journal_t *journal, const uint8_t *frame, size_t len, uint32_t *seq_out);
+
+/**
+ * @brief Records that a client holds every record up to `seq`.
+ * @return false if `seq` is beyond the newest record or not newer than acked_seq
+ */
+bool result_journal_ack(result_journal_t *journal, uint32_t seq);
+
+/**
+ * @brief Records held and not yet acknowledged.
+ */
+uint32_t result_journal_pending(const result_journal_t *journal);
+
+/**
+ * @brief Largest number of records the journal holds before overwriting.
+ */
+uint32_t result_journal_capacity(const result_journal_t *journal);
+
+/**
+ * @brief Starts a sync of the records after `after_seq` held now.
+ */
+void result_journal_sync_begin(const result_journal_t *journal, result_journal_sync_t *sync,
+                               uint32_t after_seq, uint8_t transfer_id);
+
+/**
+ * @brief Encodes the next sync packet (sweep_transfer.h header + stream slice) into `out`.
+ * Records overwritten since the sync began are skipped. Reads flash; the caller keeps
+ * appends out while this runs.
+ * @return Packet length, or 0 once the sync is complete (or max_len is too small)
+ */
+size_t result_journal_sync_next(const result_journal_t *journal, result_journal_sync_t *sync,
+                                uint8_t *out, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RESULT_JOURNAL_H
@@ -0,0 +1,227 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "nvs.h"
+#include "sol_cal.h"
+
+#define SOL_CAL_NVS_GRID_KEY      "grid"
+#define SOL_CAL_NVS_TERMS_KEY     "terms%u"
+
+static const sol_cal_terms_t identity_terms = { .k_re = 1.0f };
+
+void sol_cal_clear(sol_cal_t *cal)
+{
+    cal->points = 0;
+    cal->generation++;
+}
+
+void sol_cal_capture_set(sol_cal_capture_t *capture, sol_cal_standard_t standard,
+                         const float *re, const float *im, const uint8_t *count, uint16_t points)
+{
+    if (standard >= SOL_CAL_STANDARD_COUNT) {
+        return;
+    }
+    if (points > SOL_CAL_MAX_POINTS) {
+        points = SOL_CAL_MAX_POINTS;
+    }
+    for (uint16_t i = 0; i < points; ++i) {
+        capture->re[standard][i] = (count[i] > 0) ? re[i] : NAN;
+        capture->im[standard][i] = (count[i] > 0) ? im[i] : NAN;
+    }
+    capture->measured |= (uint8_t)(1u << standard);
+}
+
+/**
+ * @brief Solves one point's terms from the measured open, short and load.
+ * @return false if they cannot be solved (identity terms are written instead)
+ */
+static bool solve_point(const sol_cal_capture_t *capture, uint16_t i, sol_cal_terms_t *terms)
+{
+    const double open_re = capture->re[SOL_CAL_OPEN][i], open_im = capture->im[SOL_CAL_OPEN][i];
+    const double short_re = capture->re[SOL_CAL_SHORT][i], short_im = capture->im[SOL_CAL_SHORT][i];
+    const double e00_re = capture->re[SOL_CAL_LOAD][i], e00_im = capture->im[SOL_CAL_LOAD][i];
+
+    // With the load giving e00 directly: a = Mo - e00 = e10e01 / (1 - e11),
+    // b = Ms - e00 = -e10e01 / (1 + e11), so e11 = (a + b) / (a - b) and e10e01 = a (1 - e11)
+    const double a_re = open_re - e00_re, a_im = open_im - e00_im;
+    const double b_re = short_re - e00_re, b_im = short_im - e00_im;
+    const double diff_re = a_re - b_re, diff_im = a_im - b_im;
+    const double diff_sq = diff_re * diff_re + diff_im * diff_im;
+    if (!(diff_sq > 1e-12) || !isfinite(diff_sq) || !isfinite(e00_re) || !isfinite(e00_im)) {
+        *terms = identity_terms;
+        return false;
+    }
+    const double sum_re = a_re + b_re, sum_im = a_im + b_im;
+    const double e11_re = (sum_re * diff_re + sum_im * diff_im) / diff_sq;
+    const double e11_im = (sum_im * diff_re - sum_re * diff_im) / diff_sq;
+    const double e01_re = a_re * (1.0 - e11_re) + a_im * e11_im;
+    const double e01_im = a_im * (1.0 - e11_re) - a_re * e11_im;
+
+    terms->e00_re = (float)e00_re;
+    terms->e00_im = (float)e00_im;
+    terms->e11_re = (float)e11_re;
+    terms->e11_im = (float)e11_im;
+    terms->k_re = (float)(e01_re - (e00_re * e11_re - e00_im * e11_im));
+    terms->k_im = (float)(e01_im - (e00_re * e11_im + e00_im * e11_re));
+    return true;
+}
+
+bool sol_cal_compute(sol_cal_t *cal, const sol_cal_capture_t *capture,
+                     uint64_t start_hz, uint64_t step_hz, uint16_t points, uint16_t *degenerate_out)
+{
+    const uint8_t all = (1u << SOL_CAL_STANDARD_COUNT) - 1;
+    if ((capture->measured & all) != all || points == 0 || points > SOL_CAL_MAX_POINTS) {
+        return false;
+    }
+    uint16_t degenerate = 0;
+    for (uint16_t i = 0; i < points; ++i) {
+        degenerate += !solve_point(capture, i, &cal->terms[i]);
+    }
+    cal->start_hz = start_hz;
+    cal->step_hz = step_hz;
+    cal->points = points;
+    cal->generation++;
+    if (degenerate_out) {
+        *degenerate_out = degenerate;
+    }
+    return true;
+}
+
+bool sol_cal_window_prepare(const sol_cal_t *cal, sol_cal_window_t *window,
+                            uint64_t start_hz, uint64_t step_hz, uint16_t points)
+{
+    if (cal->points == 0 || points == 0 || points > SOL_CAL_MAX_POINTS) {
+        return false;
+    }
+    if (window->points == points && window->start_hz == start_hz && window->step_hz == step_hz &&
+        window->generation == cal->generation) {
+        return true;
+    }
+    // Up to half a calibration step past either end still uses the end terms
+    const double first = ((double)start_hz - (double)cal->start_hz) / (double)cal->step_hz;
+    const double last = first + (double)(points - 1) * (double)step_hz / (double)cal->step_hz;
+    if (first < -0.5 || last > (double)cal->points - 0.5) {
+        window->points = 0;
+        return false;
+    }
+
+    for (uint16_t i = 0; i < points; ++i) {
+        const double position = first + (double)i * (double)step_hz / (double)cal->step_hz;
+        if (cal->points == 1 || position <= 0.0) {
+            window->terms[i] = cal->terms[0];
+            continue;
+        }
+        if (position >= (double)(cal->points - 1)) {
+            window->terms[i] = cal->terms[cal->points - 1];
+            continue;
+        }
+        const uint16_t j = (uint16_t)position;
+        const float t = (float)(position - j);
+        const sol_cal_terms_t *lo = &cal->terms[j];
+        const sol_cal_terms_t *hi = &cal->terms[j + 1];
+        sol_cal_terms_t *out = &window->terms[i];
+        out->e00_re = lo->e00_re + t * (hi->e00_re - lo->e00_re);
+        out->e00_im = lo->e00_im + t * (hi->e00_im - lo->e00_im);
+        out->e11_re = lo->e11_re + t * (hi->e11_re - lo->e11_re);
+        out->e11_im = lo->e11_im + t * (hi->e11_im - lo->e11_im);
+        out->k_re = lo->k_re + t * (hi->k_re - lo->k_re);
+        out->k_im = lo->k_im + t * (hi->k_im - lo->k_im);
+    }
+    window->start_hz = start_hz;
+    window->step_hz = step_hz;
+    window->points = points;
+    window->generation = cal->generation;
+    return true;
+}
+
+bool sol_cal_correct(const sol_cal_terms_t *terms, double a, double b, double c, double d,
+                     double *s11_re, double *s11_im)
+{
+    // num = rev - e00 * fwd
+    const double num_re = a - (terms->e00_re * c - terms->e00_im * d);
+    const double num_im = b - (terms->e00_re * d + terms->e00_im * c);
+    // den = e11 * rev + k * fwd
+    const double den_re = terms->e11_re * a - terms->e11_im * b + terms->k_re * c - terms->k_im * d;
+    const double den_im = terms->e11_re * b + terms->e11_im * a + terms->k_re * d + terms->k_im * c;
+    const double den_sq = den_re * den_re + den_im * den_im;
+    if (!(den_sq > 1e-12)) {
+        return false;
+    }
+    *s11_re = (num_re * den_re + num_im * den_im) / den_sq;
+    *s11_im = (num_im * den_re - num_re * den_im) / den_sq;
+    return true;
+}
+
+esp_err_t sol_cal_nvs_load(sol_cal_t *cal, const char *nvs_namespace)
+{
+    sol_cal_clear(cal);
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(nvs_namespace, NVS_READONLY, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    sol_cal_nvs_grid_t grid;
+    size_t len = sizeof(grid);
+    err = nvs_get_blob(handle, SOL_CAL_NVS_GRID_KEY, &grid, &len);
+    if (err == ESP_OK && (len != sizeof(grid) || grid.format != SOL_CAL_NVS_FORMAT ||
+                          grid.points == 0 || grid.points > SOL_CAL_MAX_POINTS)) {
+        err = ESP_ERR_INVALID_VERSION;
+    }
+    for (uint16_t first = 0; err == ESP_OK && first < grid.points; first += SOL_CAL_NVS_CHUNK_POINTS) {
+        const uint16_t count = (grid.points - first < SOL_CAL_NVS_CHUNK_POINTS) ? grid.points - first : SOL_CAL_NVS_CHUNK_POINTS;
+        char key[16];
+        snprintf(key, sizeof(key), SOL_CAL_NVS_TERMS_KEY, (unsigned)(first / SOL_CAL_NVS_CHUNK_POINTS));
+        len = count * sizeof(sol_cal_terms_t);
+        err = nvs_get_blob(handle, key, &cal->terms[first], &len);
+        if (err == ESP_OK && len != count * sizeof(sol_cal_terms_t)) {
+            err = ESP_ERR_INVALID_SIZE;
+        }
+    }
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    cal->start_hz = grid.start_hz;
+    cal->step_hz = grid.step_hz;
+    cal->points = grid.points;
+    cal->generation++;
+    return ESP_OK;
+}
+
+esp_err_t sol_cal_nvs_store(const sol_cal_t *cal, const char *nvs_namespace)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(nvs_namespace, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    // Without the grid entry nothing loads, so it goes first and is written back last:
+    // a save cut short leaves no calibration rather than a mix of old and new chunks.
+    // Stale chunks of a cleared calibration are overwritten by the next save.
+    err = nvs_erase_key(handle, SOL_CAL_NVS_GRID_KEY);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        err = ESP_OK;
+    }
+    if (err == ESP_OK && cal->points > 0) {
+        for (uint16_t first = 0; err == ESP_OK && first < cal->points; first += SOL_CAL_NVS_CHUNK_POINTS) {
+            const uint16_t count = (cal->points - first < SOL_CAL_NVS_CHUNK_POINTS) ? cal->points - first : SOL_CAL_NVS_CHUNK_POINTS;
+            char key[16];
+            snprintf(key, sizeof(key), SOL_CAL_NVS_TERMS_KEY, (unsigned)(first / SOL_CAL_NVS_CHUNK_POINTS));
+            err = nvs_set_blob(handle, key, &cal->terms[first], count * sizeof(sol_cal_terms_t));
+        }
+        if (err == ESP_OK) {
+            const sol_cal_nvs_grid_t grid = {
+                .format = SOL_CAL_NVS_FORMAT,
+                .points = cal->points,
+                .start_hz = cal->start_hz,
+                .step_hz = cal->step_hz,
+            };
+            err = nvs_set_blob(handle, SOL_CAL_NVS_GRID_KEY, &grid, sizeof(grid));
+        }
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return err;
+}
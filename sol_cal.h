@@ -0,0 +1,136 @@
+// sol_cal.h
+// One-port open/short/load (SOL) calibration of the S11 measurement.
+//
+// The fixture between the NanoVNA port and the sensor is described by the
+// three-term error model
+//   Gm = e00 + e10e01 * G / (1 - e11 * G)
+// with e00 the directivity, e11 the source match and e10e01 the reflection
+// tracking. Measuring ideal open (+1), short (-1) and load (0) standards at every
+// point of the configured band gives the three terms per point. They are solved
+// once, when the calibration is saved, and kept in NVS.
+//
+// Correction works on the raw receiver values and replaces the rev/fwd division
+// instead of adding a second one:
+//   G = (rev - e00 * fwd) / (e11 * rev + k * fwd),   k = e10e01 - e00 * e11
+// so each point costs three complex multiply-adds on top of the raw S11.
+// Windows other than the calibrated band (coarse, fine, tracking) get their terms
+// interpolated onto their own points once per window, not per sweep.
+//
+// NVS layout (namespace chosen by the caller):
+//  "grid"        blob  sol_cal_nvs_grid_t (format, band the terms were measured on)
+//  "terms0".."N" blob  SOL_CAL_NVS_CHUNK_POINTS sol_cal_terms_t each; chunks keep every
+//                      blob within one NVS page
+#ifndef SOL_CAL_H
+#define SOL_CAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SOL_CAL_MAX_POINTS        (1024)
+#define SOL_CAL_NVS_FORMAT        (1)
+#define SOL_CAL_NVS_CHUNK_POINTS  (128)
+
+typedef enum {
+    SOL_CAL_OPEN = 0,
+    SOL_CAL_SHORT,
+    SOL_CAL_LOAD,
+    SOL_CAL_STANDARD_COUNT,
+} sol_cal_standard_t;
+
+typedef struct {
+    float e00_re, e00_im;    // Directivity
+    float e11_re, e11_im;    // Source match
+    float k_re, k_im;        // e10e01 - e00 * e11
+} sol_cal_terms_t;
+
+typedef struct {
+    uint64_t start_hz;       // Band the terms were measured on; points == 0 when uncalibrated
+    uint64_t step_hz;
+    uint16_t points;
+    uint32_t generation;     // Changes with every new set of terms (invalidates prepared windows)
+    sol_cal_terms_t terms[SOL_CAL_MAX_POINTS];
+} sol_cal_t;
+
+typedef struct {
+    uint64_t start_hz;       // Window the terms below were prepared for; points == 0 when none
+    uint64_t step_hz;
+    uint16_t points;
+    uint32_t generation;     // sol_cal_t::generation they were prepared from
+    sol_cal_terms_t terms[SOL_CAL_MAX_POINTS];
+} sol_cal_window_t;
+
+typedef struct {
+    uint8_t measured;        // Bit per sol_cal_standard_t
+    float re[SOL_CAL_STANDARD_COUNT][SOL_CAL_MAX_POINTS]; // Mean raw S11 of each standard (NAN: no sample)
+    float im[SOL_CAL_STANDARD_COUNT][SOL_CAL_MAX_POINTS];
+} sol_cal_capture_t;
+
+typedef struct {
+    uint8_t format;          // SOL_CAL_NVS_FORMAT
+    uint8_t reserved;
+    uint16_t points;
+    uint32_t reserved2;
+    uint64_t start_hz;
+    uint64_t step_hz;
+} sol_cal_nvs_grid_t;
+
+/**
+ * @brief Drops the terms; sol_cal_window_prepare() then reports every window uncalibrated.
+ */
+void sol_cal_clear(sol_cal_t *cal);
+
+/**
+ * @brief Stores the mean raw S11 of one standard over `points` band points. Points with
+ * count[i] == 0 were not measured.
+ */
+void sol_cal_capture_set(sol_cal_capture_t *capture, sol_cal_standard_t standard,
+                         const float *re, const float *im, const uint8_t *count, uint16_t points);
+
+/**
+ * @brief Solves the error terms of every point from the three captured standards.
+ * Points where the standards are missing or indistinguishable get identity terms
+ * (raw S11 passes through).
+ * @param degenerate_out Set to the number of such points (may be NULL)
+ * @return false (cal unchanged) unless all three standards were captured
+ */
+bool sol_cal_compute(sol_cal_t *cal, const sol_cal_capture_t *capture,
+                     uint64_t start_hz, uint64_t step_hz, uint16_t points, uint16_t *degenerate_out);
+
+/**
+ * @brief Makes `window` hold the terms of the given sweep window, interpolated from the
+ * calibrated band. Returns at once if it already does.
+ * @return false if there is no calibration or the window lies outside the calibrated band
+ */
+bool sol_cal_window_prepare(const sol_cal_t *cal, sol_cal_window_t *window,
+                            uint64_t start_hz, uint64_t step_hz, uint16_t points);
+
+/**
+ * @brief Error-corrected S11 of one point from its raw receiver values (rev = a + jb,
+ * fwd = c + jd).
+ * @return false if the corrected denominator is zero (S11 unbounded)
+ */
+bool sol_cal_correct(const sol_cal_terms_t *terms, double a, double b, double c, double d,
+                     double *s11_re, double *s11_im);
+
+/**
+ * @brief Loads the terms stored under `nvs_namespace`. Leaves `cal` cleared on any error.
+ * @return ESP_ERR_NVS_NOT_FOUND if nothing is stored, ESP_ERR_INVALID_VERSION for another
+ *         format, or the NVS error
+ */
+esp_err_t sol_cal_nvs_load(sol_cal_t *cal, const char *nvs_namespace);
+
+/**
+ * @brief Stores the terms under `nvs_namespace`, or erases them when `cal` is cleared.
+ */
+esp_err_t sol_cal_nvs_store(const sol_cal_t *cal, const char *nvs_namespace);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SOL_CAL_H
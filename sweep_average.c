@@ -0,0 +1,71 @@
+#include <string.h>
+#include <math.h>
+#include "sweep_average.h"
+
+void sweep_average_reset(sweep_average_t *avg)
+{
+    avg->points = 0;
+    avg->sweeps = 0;
+}
+
+void sweep_average_begin(sweep_average_t *avg, uint64_t start_hz, uint64_t step_hz, uint16_t points)
+{
+    if (points > SWEEP_AVERAGE_MAX_POINTS) {
+        points = SWEEP_AVERAGE_MAX_POINTS;
+    }
+    if (avg->points != points || avg->start_hz != start_hz || avg->step_hz != step_hz) {
+        avg->start_hz = start_hz;
+        avg->step_hz = step_hz;
+        avg->points = points;
+        avg->sweeps = 0;
+        memset(avg->count, 0, points * sizeof(avg->count[0]));
+        memset(avg->mean_re, 0, points * sizeof(avg->mean_re[0]));
+        memset(avg->mean_im, 0, points * sizeof(avg->mean_im[0]));
+        memset(avg->m2, 0, points * sizeof(avg->m2[0]));
+    }
+    if (avg->sweeps < UINT8_MAX) {
+        avg->sweeps++;
+    }
+}
+
+void sweep_average_add(sweep_average_t *avg, uint16_t index, double s11_re, double s11_im)
+{
+    if (index >= avg->points || avg->count[index] == UINT8_MAX || !isfinite(s11_re) || !isfinite(s11_im)) {
+        return;
+    }
+    const float n = (float)++avg->count[index];
+    const float d_re = (float)s11_re - avg->mean_re[index];
+    const float d_im = (float)s11_im - avg->mean_im[index];
+    avg->mean_re[index] += d_re / n;
+    avg->mean_im[index] += d_im / n;
+    // Re(conj(x - old mean) * (x - new mean)), the complex form of Welford's update
+    avg->m2[index] += d_re * ((float)s11_re - avg->mean_re[index]) + d_im * ((float)s11_im - avg->mean_im[index]);
+}
+
+double sweep_average_db(const sweep_average_t *avg, uint16_t index)
+{
+    if (index >= avg->points || avg->count[index] == 0) {
+        return NAN;
+    }
+    const double re = avg->mean_re[index];
+    const double im = avg->mean_im[index];
+    const double mag_sq = re * re + im * im;
+    return (mag_sq > 1e-18) ? 10.0 * log10(mag_sq) : -INFINITY;
+}
+
+double sweep_average_noise_db(const sweep_average_t *avg)
+{
+    double variance_sum = 0.0;
+    uint32_t variance_points = 0;
+    for (uint16_t i = 0; i < avg->points; ++i) {
+        if (avg->count[i] >= 2) {
+            variance_sum += avg->m2[i] / (avg->count[i] - 1);
+            variance_points++;
+        }
+    }
+    if (variance_points == 0) {
+        return NAN;
+    }
+    const double mean_variance = variance_sum / variance_points;
+    return (mean_variance > 1e-18) ? 10.0 * log10(mean_variance) : -INFINITY;
+}
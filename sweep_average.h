@@ -0,0 +1,67 @@
+// sweep_average.h
+// Per-point averaging of complex S11 over back-to-back sweeps of one window.
+//
+// Each point keeps a running mean and the Welford sum of squared deviations
+// (complex: |x - mean|^2), updated as points arrive, so no per-sweep buffer is
+// needed and the spread is available without a second pass. Storage is three
+// floats and a count per point.
+//
+// A sweep of a different window (coarse stage, tracking widening) restarts the
+// average, so only repeated sweeps of the final window are combined.
+#ifndef SWEEP_AVERAGE_H
+#define SWEEP_AVERAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SWEEP_AVERAGE_MAX_POINTS  (1024)
+#define SWEEP_AVERAGE_MAX_SWEEPS  (32)   // "AVERAGE <n>" limit; counts fit a uint8_t
+
+typedef struct {
+    uint64_t start_hz;   // Window being averaged; points == 0 when none
+    uint64_t step_hz;
+    uint16_t points;
+    uint8_t sweeps;      // Sweeps of this window begun so far
+    uint8_t count[SWEEP_AVERAGE_MAX_POINTS];   // Samples per point (a sweep may miss a point)
+    float mean_re[SWEEP_AVERAGE_MAX_POINTS];
+    float mean_im[SWEEP_AVERAGE_MAX_POINTS];
+    float m2[SWEEP_AVERAGE_MAX_POINTS];        // Sum of |x - mean|^2 (Welford)
+} sweep_average_t;
+
+/**
+ * @brief Forgets the current window; the next sweep_average_begin() starts afresh.
+ */
+void sweep_average_reset(sweep_average_t *avg);
+
+/**
+ * @brief Starts accumulating one sweep of the given window. A window different from the
+ * one being averaged clears the accumulators first.
+ */
+void sweep_average_begin(sweep_average_t *avg, uint64_t start_hz, uint64_t step_hz, uint16_t points);
+
+/**
+ * @brief Adds one S11 sample of point `index` (ignored if outside the window).
+ */
+void sweep_average_add(sweep_average_t *avg, uint16_t index, double s11_re, double s11_im);
+
+/**
+ * @brief Magnitude of the mean S11 of point `index` in dB (10*log10|mean|^2):
+ * -INFINITY for a zero mean, NAN if the point has no samples.
+ */
+double sweep_average_db(const sweep_average_t *avg, uint16_t index);
+
+/**
+ * @brief Single-sweep noise estimate over the window: 20*log10 of the RMS (over points)
+ * of each point's sample standard deviation of complex S11. NAN with fewer than two sweeps.
+ */
+double sweep_average_noise_db(const sweep_average_t *avg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SWEEP_AVERAGE_H
@@ -0,0 +1,180 @@
+#include <math.h>
+#include <string.h>
+#include "sweep_history.h"
+#include "sweep_transfer.h"
+#include "le_bytes.h"
+
+/**
+ * @brief Binary angle of re + j*im: 65536 per turn, wrapping at +/-180 degrees.
+ */
+static int16_t phase_of(float re, float im)
+{
+    if (!isfinite(re) || !isfinite(im)) {
+        return 0;
+    }
+    int32_t angle = (int32_t)lrintf(atan2f(im, re) * (32768.0f / (float)M_PI));
+    if (angle >= 32768) {
+        angle -= 65536;
+    }
+    return (int16_t)angle;
+}
+
+size_t sweep_history_storage_size(uint16_t slots, uint16_t max_points)
+{
+    return (size_t)slots * (sizeof(sweep_history_info_t) + (size_t)max_points * sizeof(sweep_history_point_t));
+}
+
+void sweep_history_init(sweep_history_t *history, void *storage, uint16_t slots, uint16_t max_points)
+{
+    memset(history, 0, sizeof(*history));
+    memset(storage, 0, sweep_history_storage_size(slots, max_points));
+    history->infos = storage;
+    history->points = (sweep_history_point_t *)(history->infos + slots);
+    history->slots = slots;
+    history->max_points = max_points;
+    history->next_seq = 1;
+}
+
+uint32_t sweep_history_add(sweep_history_t *history, const sweep_history_info_t *info, const int16_t *s11_cdb,
+                           const float *s11_re, const float *s11_im, const uint8_t *measured)
+{
+    const uint16_t slot = history->head;
+    sweep_history_info_t *dst_info = &history->infos[slot];
+    sweep_history_point_t *dst = history->points + (size_t)slot * history->max_points;
+    const uint16_t points = (info->points < history->max_points) ? info->points : history->max_points;
+
+    *dst_info = *info;
+    dst_info->points = points;
+    dst_info->seq = history->next_seq++;
+    if (history->next_seq == 0) {
+        history->next_seq = 1; // 0 marks a free slot
+    }
+    for (uint16_t i = 0; i < points; ++i) {
+        if (measured != NULL && !(measured[i / 8] & (1u << (i % 8)))) {
+            dst[i].s11_cdb = SWEEP_HISTORY_NOT_MEASURED;
+            dst[i].phase = 0;
+            continue;
+        }
+        dst[i].s11_cdb = s11_cdb[i];
+        dst[i].phase = (s11_re != NULL && s11_im != NULL) ? phase_of(s11_re[i], s11_im[i]) : 0;
+    }
+
+    history->head = (uint16_t)((slot + 1) % history->slots);
+    if (history->held < history->slots) {
+        history->held++;
+    }
+    return dst_info->seq;
+}
+
+void sweep_history_range(const sweep_history_t *history, uint32_t *oldest_seq, uint32_t *newest_seq)
+{
+    if (history->held == 0) {
+        *oldest_seq = 0;
+        *newest_seq = 0;
+        return;
+    }
+    const uint16_t newest = (uint16_t)((history->head + history->slots - 1) % history->slots);
+    const uint16_t oldest = (uint16_t)((history->head + history->slots - history->held) % history->slots);
+    *oldest_seq = history->infos[oldest].seq;
+    *newest_seq = history->infos[newest].seq;
+}
+
+/**
+ * @brief Slot holding sweep `seq` (0 = newest), or -1.
+ */
+static int find_slot(const sweep_history_t *history, uint32_t seq)
+{
+    if (history->held == 0) {
+        return -1;
+    }
+    if (seq == 0) {
+        return (history->head + history->slots - 1) % history->slots;
+    }
+    for (uint16_t s = 0; s < history->slots; ++s) {
+        if (history->infos[s].seq == seq) {
+            return s;
+        }
+    }
+    return -1;
+}
+
+void sweep_history_transfer_begin(const sweep_history_t *history, sweep_history_transfer_t *transfer,
+                                  uint32_t seq, uint16_t first, uint16_t count, uint8_t transfer_id)
+{
+    memset(transfer, 0, sizeof(*transfer));
+    transfer->transfer_id = transfer_id;
+    transfer->seq = seq;
+    transfer->first = first;
+
+    sweep_history_status_t status = SWEEP_HISTORY_NOT_HELD;
+    sweep_history_info_t info = { 0 };
+    const int slot = find_slot(history, seq);
+    if (slot >= 0) {
+        info = history->infos[slot];
+        transfer->slot = (uint16_t)slot;
+        transfer->seq = info.seq;
+        status = (first < info.points) ? SWEEP_HISTORY_OK : SWEEP_HISTORY_BAD_RANGE;
+    }
+    if (status == SWEEP_HISTORY_OK) {
+        transfer->count = (count > info.points - first) ? (uint16_t)(info.points - first) : count;
+    }
+
+    uint8_t *h = transfer->header;
+    h[0] = SWEEP_HISTORY_FORMAT;
+    h[1] = (uint8_t)status;
+    le_put_u16(h + 2, first);
+    le_put_u16(h + 4, transfer->count);
+    le_put_u16(h + 6, info.points);
+    le_put_u32(h + 8, transfer->seq);
+    le_put_u32(h + 12, info.timestamp_ms);
+    le_put_u32(h + 16, info.start_hz);
+    le_put_u32(h + 20, info.step_hz);
+    h[24] = info.flags;
+    h[25] = info.sweeps_averaged;
+    h[26] = 0;
+    h[27] = 0;
+    transfer->stream_len = SWEEP_HISTORY_STREAM_HEADER_LEN + (size_t)transfer->count * SWEEP_HISTORY_POINT_LEN;
+}
+
+size_t sweep_history_transfer_next(const sweep_history_t *history, sweep_history_transfer_t *transfer,
+                                   uint8_t *out, size_t max_len)
+{
+    if (transfer->stream_offset >= transfer->stream_len || max_len <= SWEEP_PKT_HEADER_LEN) {
+        return 0;
+    }
+    const bool still_held = (history->infos[transfer->slot].seq == transfer->seq);
+    const sweep_history_point_t *points = history->points + (size_t)transfer->slot * history->max_points + transfer->first;
+    size_t len = SWEEP_PKT_HEADER_LEN;
+    while (len < max_len && transfer->stream_offset < transfer->stream_len) {
+        const size_t offset = transfer->stream_offset;
+        if (offset < SWEEP_HISTORY_STREAM_HEADER_LEN) {
+            size_t n = SWEEP_HISTORY_STREAM_HEADER_LEN - offset;
+            if (n > max_len - len) {
+                n = max_len - len;
+            }
+            memcpy(out + len, transfer->header + offset, n);
+            transfer->stream_offset += n;
+            len += n;
+            continue;
+        }
+        const size_t index = (offset - SWEEP_HISTORY_STREAM_HEADER_LEN) / SWEEP_HISTORY_POINT_LEN;
+        const size_t byte = (offset - SWEEP_HISTORY_STREAM_HEADER_LEN) % SWEEP_HISTORY_POINT_LEN;
+        const sweep_history_point_t point = still_held ? points[index]
+                                                       : (sweep_history_point_t){ SWEEP_HISTORY_NOT_MEASURED, 0 };
+        uint8_t encoded[SWEEP_HISTORY_POINT_LEN];
+        le_put_u16(encoded, (uint16_t)point.s11_cdb);
+        le_put_u16(encoded + 2, (uint16_t)point.phase);
+        size_t n = SWEEP_HISTORY_POINT_LEN - byte;
+        if (n > max_len - len) {
+            n = max_len - len;
+        }
+        memcpy(out + len, encoded + byte, n);
+        transfer->stream_offset += n;
+        len += n;
+    }
+
+    sweep_transfer_put_header(out, transfer->packet_index == 0, transfer->stream_offset >= transfer->stream_len,
+                              transfer->transfer_id, transfer->packet_index);
+    transfer->packet_index++;
+    return len;
+}
@@ -0,0 +1,131 @@
+// sweep_history.h
+// Ring of the last sweeps taken, kept after their reading so an odd result can be
+// looked into later without measuring again. Storage is provided by the caller and
+// preallocated once (PSRAM on the device); a full ring overwrites its oldest sweep.
+//
+// Each sweep keeps its window, when it was taken and the flags of its reading, and
+// per point S11 as int16 centi-dB (SWEEP_HISTORY_NOT_MEASURED where the sweep got no
+// point) and int16 phase as a binary angle (65536 = 360 degrees), 4 bytes a point.
+// Sweeps are numbered from 1 in the order they are added.
+//
+// Transfer stream, sent in packets with the sweep_transfer.h header:
+//  Offset  Size  Field
+//  0       1     format           (SWEEP_HISTORY_FORMAT)
+//  1       1     status           (sweep_history_status_t)
+//  2       2     first            (index of the first point sent)
+//  4       2     count            (points sent; 0 unless status is OK)
+//  6       2     points           (points in the sweep)
+//  8       4     seq              (sweep number asked for, or found)
+//  12      4     timestamp_ms     (as in the reading's result frame)
+//  16      4     start_hz         (of point 0)
+//  20      4     step_hz
+//  24      1     flags            (result frame flags of the reading)
+//  25      1     sweeps_averaged
+//  26      2     reserved         (0)
+//  28      4*N   per point: int16 s11_cdb, int16 phase
+// Points of a sweep overwritten while it is being sent go out as NOT_MEASURED.
+#ifndef SWEEP_HISTORY_H
+#define SWEEP_HISTORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SWEEP_HISTORY_FORMAT          (1)
+#define SWEEP_HISTORY_STREAM_HEADER_LEN (28)
+#define SWEEP_HISTORY_POINT_LEN       (4)
+#define SWEEP_HISTORY_NOT_MEASURED    (INT16_MIN)
+
+typedef enum {
+    SWEEP_HISTORY_OK = 0,
+    SWEEP_HISTORY_NOT_HELD,       // Never taken, or already overwritten
+    SWEEP_HISTORY_BAD_RANGE,      // First point beyond the sweep
+} sweep_history_status_t;
+
+typedef struct {
+    uint32_t seq;                 // 0 = free slot
+    uint32_t timestamp_ms;
+    uint32_t start_hz;
+    uint32_t step_hz;
+    uint16_t points;
+    uint8_t flags;
+    uint8_t sweeps_averaged;
+} sweep_history_info_t;
+
+typedef struct {
+    int16_t s11_cdb;
+    int16_t phase;
+} sweep_history_point_t;
+
+typedef struct {
+    sweep_history_info_t *infos;          // One per slot
+    sweep_history_point_t *points;        // max_points per slot
+    uint16_t slots;
+    uint16_t max_points;
+    uint16_t head;                        // Slot the next sweep goes into
+    uint16_t held;                        // Slots in use
+    uint32_t next_seq;
+} sweep_history_t;
+
+typedef struct {
+    uint8_t header[SWEEP_HISTORY_STREAM_HEADER_LEN];
+    uint32_t seq;
+    uint16_t slot;
+    uint16_t first;
+    uint16_t count;
+    size_t stream_len;
+    size_t stream_offset;                 // Next stream byte to send
+    uint8_t transfer_id;
+    uint16_t packet_index;
+} sweep_history_transfer_t;
+
+/**
+ * @brief Bytes of storage for `slots` sweeps of up to `max_points` points.
+ */
+size_t sweep_history_storage_size(uint16_t slots, uint16_t max_points);
+
+/**
+ * @brief Sets up an empty ring in `storage` (sweep_history_storage_size() bytes, suitably aligned).
+ */
+void sweep_history_init(sweep_history_t *history, void *storage, uint16_t slots, uint16_t max_points);
+
+/**
+ * @brief Adds a sweep, overwriting the oldest when full. `info->seq` is ignored.
+ * @param s11_cdb  per-point S11 in centi-dB
+ * @param s11_re   per-point complex S11 for the phase (NULL: phase 0)
+ * @param s11_im
+ * @param measured per-point bitmap of points the sweep got (NULL: all of them)
+ * @return the sweep's number
+ */
+uint32_t sweep_history_add(sweep_history_t *history, const sweep_history_info_t *info, const int16_t *s11_cdb,
+                           const float *s11_re, const float *s11_im, const uint8_t *measured);
+
+/**
+ * @brief Numbers of the oldest and newest sweeps held (both 0 when empty).
+ */
+void sweep_history_range(const sweep_history_t *history, uint32_t *oldest_seq, uint32_t *newest_seq);
+
+/**
+ * @brief Starts a transfer of `count` points from `first` of sweep `seq` (0 = newest); the
+ * range is clipped to the sweep. The stream carries the status if the sweep is not held.
+ */
+void sweep_history_transfer_begin(const sweep_history_t *history, sweep_history_transfer_t *transfer,
+                                  uint32_t seq, uint16_t first, uint16_t count, uint8_t transfer_id);
+
+/**
+ * @brief Encodes the next packet (sweep_transfer.h header + stream slice) into `out`.
+ * The caller keeps sweep_history_add() out while this runs.
+ * @return Packet length, or 0 once the transfer is complete (or max_len is too small)
+ */
+size_t sweep_history_transfer_next(const sweep_history_t *history, sweep_history_transfer_t *transfer,
+                                   uint8_t *out, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SWEEP_HISTORY_H
@@ -0,0 +1,141 @@
+#include <string.h>
+#include "nvs.h"
+#include "sweep_profile.h"
+#include "le_bytes.h"
+
+#define SWEEP_PROFILE_NVS_TABLE_KEY   "table"
+#define SWEEP_PROFILE_NVS_ACTIVE_KEY  "active"
+
+bool sweep_profile_valid(const sweep_profile_t *profile, const sweep_profile_limits_t *limits)
+{
+    const size_t name_len = strnlen(profile->name, SWEEP_PROFILE_NAME_LEN);
+    if (name_len == 0 || name_len == SWEEP_PROFILE_NAME_LEN) {
+        return false;
+    }
+    if (profile->points < 2 || profile->points > limits->max_points ||
+        profile->chunk_points == 0 || profile->chunk_points > limits->max_chunk_points ||
+        profile->values_per_freq == 0 || profile->values_per_freq > limits->max_values_per_freq ||
+        profile->step_hz == 0 || profile->start_hz < limits->min_hz || profile->start_hz > limits->max_hz) {
+        return false;
+    }
+    // Stop frequency, without overflowing on a silly step
+    return profile->step_hz <= (limits->max_hz - profile->start_hz) / (profile->points - 1);
+}
+
+int sweep_profile_find(const sweep_profile_table_t *table, const char *name)
+{
+    for (uint8_t i = 0; i < table->count; ++i) {
+        if (strncmp(table->entries[i].name, name, SWEEP_PROFILE_NAME_LEN) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool sweep_profile_set(sweep_profile_table_t *table, uint8_t index, const sweep_profile_t *profile,
+                       const sweep_profile_limits_t *limits)
+{
+    if (index > table->count || index >= SWEEP_PROFILE_MAX || !sweep_profile_valid(profile, limits)) {
+        return false;
+    }
+    // Names pick profiles in commands, so they stay unique
+    const int same_name = sweep_profile_find(table, profile->name);
+    if (same_name >= 0 && same_name != index) {
+        return false;
+    }
+    sweep_profile_t *entry = &table->entries[index];
+    *entry = *profile;
+    memset(entry->name + strlen(entry->name), 0, SWEEP_PROFILE_NAME_LEN - strlen(entry->name));
+    memset(entry->reserved, 0, sizeof(entry->reserved));
+    if (index == table->count) {
+        table->count++;
+    }
+    return true;
+}
+
+esp_err_t sweep_profile_nvs_load(sweep_profile_table_t *table, uint8_t *active, const char *nvs_namespace,
+                                 const sweep_profile_limits_t *limits)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(nvs_namespace, NVS_READONLY, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    struct {
+        sweep_profile_nvs_header_t header;
+        sweep_profile_t entries[SWEEP_PROFILE_MAX];
+    } blob;
+    size_t len = sizeof(blob);
+    uint8_t stored_active = 0;
+    err = nvs_get_blob(handle, SWEEP_PROFILE_NVS_TABLE_KEY, &blob, &len);
+    if (err == ESP_OK) {
+        err = nvs_get_u8(handle, SWEEP_PROFILE_NVS_ACTIVE_KEY, &stored_active);
+    }
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (len < sizeof(blob.header) || blob.header.format != SWEEP_PROFILE_NVS_FORMAT ||
+        blob.header.count == 0 || blob.header.count > SWEEP_PROFILE_MAX ||
+        len != sizeof(blob.header) + blob.header.count * sizeof(sweep_profile_t) || stored_active >= blob.header.count) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+    for (uint8_t i = 0; i < blob.header.count; ++i) {
+        if (!sweep_profile_valid(&blob.entries[i], limits)) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    table->count = blob.header.count;
+    memcpy(table->entries, blob.entries, blob.header.count * sizeof(sweep_profile_t));
+    *active = stored_active;
+    return ESP_OK;
+}
+
+esp_err_t sweep_profile_nvs_store(const sweep_profile_table_t *table, uint8_t active, const char *nvs_namespace)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(nvs_namespace, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (table != NULL) {
+        struct {
+            sweep_profile_nvs_header_t header;
+            sweep_profile_t entries[SWEEP_PROFILE_MAX];
+        } blob = { .header = { .format = SWEEP_PROFILE_NVS_FORMAT, .count = table->count } };
+        memcpy(blob.entries, table->entries, table->count * sizeof(sweep_profile_t));
+        err = nvs_set_blob(handle, SWEEP_PROFILE_NVS_TABLE_KEY, &blob,
+                           sizeof(blob.header) + table->count * sizeof(sweep_profile_t));
+    }
+    if (err == ESP_OK) {
+        err = nvs_set_u8(handle, SWEEP_PROFILE_NVS_ACTIVE_KEY, active);
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return err;
+}
+
+size_t sweep_profile_encode(const sweep_profile_table_t *table, uint8_t active, uint8_t *out, size_t max_len)
+{
+    const size_t len = 3 + (size_t)table->count * SWEEP_PROFILE_ENCODED_LEN;
+    if (max_len < len) {
+        return 0;
+    }
+    out[0] = SWEEP_PROFILE_FORMAT;
+    out[1] = active;
+    out[2] = table->count;
+    uint8_t *p = out + 3;
+    for (uint8_t i = 0; i < table->count; ++i, p += SWEEP_PROFILE_ENCODED_LEN) {
+        const sweep_profile_t *profile = &table->entries[i];
+        memset(p, 0, SWEEP_PROFILE_NAME_LEN);
+        memcpy(p, profile->name, strnlen(profile->name, SWEEP_PROFILE_NAME_LEN - 1));
+        le_put_u64(p + 12, profile->start_hz);
+        le_put_u32(p + 20, (uint32_t)profile->step_hz);
+        le_put_u16(p + 24, profile->points);
+        le_put_u16(p + 26, profile->values_per_freq);
+        p[28] = profile->chunk_points;
+    }
+    return len;
+}
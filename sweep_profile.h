@@ -0,0 +1,109 @@
+// sweep_profile.h
+// Named sweep profiles: the band, resolution, NanoVNA averaging and READFIFO chunk size
+// a reading is taken with. A small table of them is kept in NVS with the index of the
+// active one, so switching between a quick look and a careful measurement is a single
+// write rather than a firmware rebuild. A sweep request records the profile selected
+// when it arrived (sweep_request.h) and is served with that one.
+//
+// Buffers sized by the sweep (curve, averaging, calibration, history, chunk) are sized
+// once for the largest profile allowed (sweep_profile_limits_t); every profile must fit.
+//
+// NVS layout (namespace chosen by the caller):
+//  "table"   blob  sweep_profile_nvs_header_t, then `count` sweep_profile_t
+//  "active"  u8    index of the active profile
+//
+// Encoded table (sweep_profile_encode, little-endian):
+//  Offset  Size  Field
+//  0       1     format           (SWEEP_PROFILE_FORMAT)
+//  1       1     active           (index)
+//  2       1     count
+//  3       29*N  per profile: name[12] (NUL padded), u64 start_hz, u32 step_hz,
+//                u16 points, u16 values_per_freq, u8 chunk_points
+#ifndef SWEEP_PROFILE_H
+#define SWEEP_PROFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SWEEP_PROFILE_MAX          (8)
+#define SWEEP_PROFILE_NAME_LEN     (12)    // Including the terminating NUL
+#define SWEEP_PROFILE_FORMAT       (1)
+#define SWEEP_PROFILE_NVS_FORMAT   (1)
+#define SWEEP_PROFILE_ENCODED_LEN  (29)
+#define SWEEP_PROFILE_TABLE_MAX_LEN (3 + SWEEP_PROFILE_MAX * SWEEP_PROFILE_ENCODED_LEN)
+
+typedef struct {
+    char name[SWEEP_PROFILE_NAME_LEN];
+    uint16_t points;
+    uint16_t values_per_freq;  // Values the NanoVNA averages into each point
+    uint8_t chunk_points;      // Points per READFIFO
+    uint8_t reserved[7];
+    uint64_t start_hz;
+    uint64_t step_hz;
+} sweep_profile_t;
+
+typedef struct {
+    uint8_t count;
+    sweep_profile_t entries[SWEEP_PROFILE_MAX];
+} sweep_profile_table_t;
+
+typedef struct {
+    uint16_t max_points;       // Per-sweep buffers
+    uint8_t max_chunk_points;  // USB receive buffer and point ring
+    uint16_t max_values_per_freq;
+    uint64_t min_hz;           // Band the NanoVNA covers
+    uint64_t max_hz;
+} sweep_profile_limits_t;
+
+typedef struct {
+    uint8_t format;
+    uint8_t count;
+    uint8_t reserved[2];
+} sweep_profile_nvs_header_t;
+
+/**
+ * @brief True if `profile` is named and fits `limits`.
+ */
+bool sweep_profile_valid(const sweep_profile_t *profile, const sweep_profile_limits_t *limits);
+
+/**
+ * @brief Index of the profile called `name`, or -1.
+ */
+int sweep_profile_find(const sweep_profile_table_t *table, const char *name);
+
+/**
+ * @brief Replaces profile `index`, or appends it when `index` is the table's count.
+ * @return false if `profile` is invalid or `index` is out of range
+ */
+bool sweep_profile_set(sweep_profile_table_t *table, uint8_t index, const sweep_profile_t *profile,
+                       const sweep_profile_limits_t *limits);
+
+/**
+ * @brief Loads the table and the active index stored under `nvs_namespace`. Leaves both
+ * untouched on any error, including a stored profile that no longer fits `limits`.
+ */
+esp_err_t sweep_profile_nvs_load(sweep_profile_table_t *table, uint8_t *active, const char *nvs_namespace,
+                                 const sweep_profile_limits_t *limits);
+
+/**
+ * @brief Stores the table (NULL: keep the stored one) and the active index under `nvs_namespace`.
+ */
+esp_err_t sweep_profile_nvs_store(const sweep_profile_table_t *table, uint8_t active, const char *nvs_namespace);
+
+/**
+ * @brief Encodes the table and the active index (layout above).
+ * @return Length written, or 0 if `max_len` is too small
+ */
+size_t sweep_profile_encode(const sweep_profile_table_t *table, uint8_t active, uint8_t *out, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SWEEP_PROFILE_H
@@ -0,0 +1,64 @@
+#include "sweep_request.h"
+
+void sweep_request_set_init(sweep_request_set_t *set)
+{
+    set->count = 0;
+}
+
+bool sweep_request_set_full(const sweep_request_set_t *set)
+{
+    return set->count >= SWEEP_REQUEST_PENDING_MAX;
+}
+
+sweep_request_add_result_t sweep_request_set_add(sweep_request_set_t *set, const sweep_request_t *request)
+{
+    for (size_t i = 0; i < set->count; ++i) {
+        sweep_request_t *pending = &set->items[i];
+        if (pending->id == request->id && pending->conn_handle == request->conn_handle) {
+            if (request->priority > pending->priority) {
+                pending->priority = request->priority;
+            }
+            return SWEEP_REQUEST_DUPLICATE;
+        }
+    }
+    if (sweep_request_set_full(set)) {
+        return SWEEP_REQUEST_FULL;
+    }
+    set->items[set->count++] = *request;
+    return SWEEP_REQUEST_ADDED;
+}
+
+size_t sweep_request_set_take(sweep_request_set_t *set, sweep_request_t *out, size_t max_out)
+{
+    if (set->count == 0 || max_out == 0) {
+        return 0;
+    }
+
+    // Highest priority wins; strict comparison keeps the oldest among equals
+    size_t lead = 0;
+    for (size_t i = 1; i < set->count; ++i) {
+        if (set->items[i].priority > set->items[lead].priority) {
+            lead = i;
+        }
+    }
+    const uint8_t mode = set->items[lead].mode;
+    const uint8_t profile = set->items[lead].profile;
+    const uint8_t averages = set->items[lead].averages;
+
+    size_t taken = 0;
+    size_t kept = 0;
+    out[taken++] = set->items[lead];
+    for (size_t i = 0; i < set->count; ++i) {
+        if (i == lead) {
+            continue;
+        }
+        const sweep_request_t *item = &set->items[i];
+        if (item->mode == mode && item->profile == profile && item->averages == averages && taken < max_out) {
+            out[taken++] = set->items[i];
+        } else {
+            set->items[kept++] = set->items[i];
+        }
+    }
+    set->count = kept;
+    return taken;
+}
@@ -0,0 +1,79 @@
+// sweep_request.h
+// Pending sweep requests and the rule for serving them.
+//
+// Every "DATA REQUESTED" write becomes one request descriptor, and every request
+// is answered by exactly one result frame carrying its id. The next sweep is taken
+// for the highest-priority request (oldest first among equal priorities), and every
+// other pending request with the same sweep mode, sweep profile and averaging is
+// answered by that same sweep (coalesced). A request whose id and connection match one already
+// pending is a duplicate (e.g. a retried write): it is dropped, raising the pending
+// one's priority if it asked for more.
+#ifndef SWEEP_REQUEST_H
+#define SWEEP_REQUEST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SWEEP_REQUEST_PENDING_MAX   (8)
+#define SWEEP_REQUEST_PRIORITY_MAX  (3)
+#define SWEEP_REQUEST_AUTO_ID_BASE  (0x8000u) // Ids the firmware assigns to untagged requests start here
+
+typedef enum {
+    SWEEP_REQUEST_READ = 0,   // Take a reading and answer it
+    SWEEP_REQUEST_WAKE,       // No reading; the control task re-checks its state (disconnect, stream start)
+} sweep_request_kind_t;
+
+typedef enum {
+    SWEEP_REQUEST_ADDED = 0,
+    SWEEP_REQUEST_DUPLICATE,  // Same id and connection already pending
+    SWEEP_REQUEST_FULL,
+} sweep_request_add_result_t;
+
+typedef struct {
+    uint16_t id;              // Echoed in the result frame; 0 is reserved for streamed readings
+    uint16_t conn_handle;     // Connection the request was written on
+    uint8_t kind;             // sweep_request_kind_t
+    uint8_t mode;             // Sweep mode in effect when the request arrived
+    uint8_t profile;          // Named sweep profile (sweep_profile.h) selected when the request arrived
+    uint8_t averages;         // Sweeps to average ("AVERAGE <n>") in effect when the request arrived
+    uint8_t priority;         // 0 (default) to SWEEP_REQUEST_PRIORITY_MAX; higher is served first
+    int64_t received_us;      // esp_timer time of the write
+} sweep_request_t;
+
+typedef struct {
+    sweep_request_t items[SWEEP_REQUEST_PENDING_MAX]; // Arrival order
+    size_t count;
+} sweep_request_set_t;
+
+/**
+ * @brief Empties the set.
+ */
+void sweep_request_set_init(sweep_request_set_t *set);
+
+/**
+ * @brief True when no further request fits.
+ */
+bool sweep_request_set_full(const sweep_request_set_t *set);
+
+/**
+ * @brief Adds `request` unless it duplicates a pending one or the set is full.
+ */
+sweep_request_add_result_t sweep_request_set_add(sweep_request_set_t *set, const sweep_request_t *request);
+
+/**
+ * @brief Removes the requests the next sweep serves: the highest-priority one first,
+ * then every other pending request with the same mode, profile and averaging, in arrival order.
+ * @return number of requests written to `out` (0 if the set is empty)
+ */
+size_t sweep_request_set_take(sweep_request_set_t *set, sweep_request_t *out, size_t max_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SWEEP_REQUEST_H
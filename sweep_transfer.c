@@ -0,0 +1,91 @@
+#include <math.h>
+#include "sweep_transfer.h"
+#include "le_bytes.h"
+
+int16_t sweep_transfer_db_to_cdb(double s11_db)
+{
+    if (isnan(s11_db)) {
+        return 0;
+    }
+    double cdb = round(s11_db * 100.0);
+    if (cdb > SWEEP_CURVE_CDB_LIMIT) {
+        return SWEEP_CURVE_CDB_LIMIT;
+    }
+    if (cdb < -SWEEP_CURVE_CDB_LIMIT) {
+        return -SWEEP_CURVE_CDB_LIMIT;
+    }
+    return (int16_t)cdb;
+}
+
+size_t sweep_transfer_stream_len(uint16_t points)
+{
+    return (points == 0) ? SWEEP_STREAM_HEADER_LEN - 2 : SWEEP_STREAM_HEADER_LEN + 2 * (size_t)(points - 1);
+}
+
+void sweep_transfer_begin(sweep_transfer_t *transfer, uint8_t transfer_id,
+                          uint32_t start_hz, uint32_t step_hz,
+                          const int16_t *curve_cdb, uint16_t points)
+{
+    transfer->curve_cdb = curve_cdb;
+    transfer->points = points;
+    transfer->start_hz = start_hz;
+    transfer->step_hz = step_hz;
+    transfer->transfer_id = transfer_id;
+    transfer->stream_offset = 0;
+    transfer->packet_index = 0;
+}
+
+/**
+ * @brief Returns byte `offset` of the payload stream without materialising it.
+ */
+static uint8_t stream_byte(const sweep_transfer_t *transfer, size_t offset)
+{
+    uint32_t word;
+    if (offset < 4) {
+        word = transfer->start_hz;
+        return (uint8_t)(word >> (8 * offset));
+    }
+    if (offset < 8) {
+        word = transfer->step_hz;
+        return (uint8_t)(word >> (8 * (offset - 4)));
+    }
+    if (offset < 10) {
+        return (uint8_t)(transfer->points >> (8 * (offset - 8)));
+    }
+    if (offset < 12) {
+        return (uint8_t)((uint16_t)transfer->curve_cdb[0] >> (8 * (offset - 10)));
+    }
+    const size_t value_index = 1 + (offset - SWEEP_STREAM_HEADER_LEN) / 2;
+    const int16_t delta = (int16_t)(transfer->curve_cdb[value_index] - transfer->curve_cdb[value_index - 1]);
+    return (uint8_t)((uint16_t)delta >> (8 * ((offset - SWEEP_STREAM_HEADER_LEN) % 2)));
+}
+
+size_t sweep_transfer_next(sweep_transfer_t *transfer, uint8_t *out, size_t max_len)
+{
+    const size_t stream_len = sweep_transfer_stream_len(transfer->points);
+    if (transfer->stream_offset >= stream_len || max_len <= SWEEP_PKT_HEADER_LEN) {
+        return 0;
+    }
+
+    size_t payload_len = max_len - SWEEP_PKT_HEADER_LEN;
+    if (payload_len > stream_len - transfer->stream_offset) {
+        payload_len = stream_len - transfer->stream_offset;
+    }
+
+    sweep_transfer_put_header(out, transfer->stream_offset == 0, transfer->stream_offset + payload_len == stream_len,
+                              transfer->transfer_id, transfer->packet_index);
+    for (size_t i = 0; i < payload_len; ++i) {
+        out[SWEEP_PKT_HEADER_LEN + i] = stream_byte(transfer, transfer->stream_offset + i);
+    }
+
+    transfer->stream_offset += payload_len;
+    transfer->packet_index++;
+    return SWEEP_PKT_HEADER_LEN + payload_len;
+}
+
+void sweep_transfer_put_header(uint8_t *out, bool first, bool last, uint8_t transfer_id, uint16_t packet_index)
+{
+    out[0] = (uint8_t)((first ? SWEEP_PKT_FIRST : 0) | (last ? SWEEP_PKT_LAST : 0));
+    out[1] = transfer_id;
+    le_put_u16(out + 2, packet_index);
+}
@@ -0,0 +1,78 @@
+// sweep_transfer.h
+// Splits one sweep's S11 curve into MTU-sized BLE notifications.
+//
+// Every packet starts with a 4-byte header:
+//  Offset  Size  Field
+//  0       1     flags            (SWEEP_PKT_FIRST / SWEEP_PKT_LAST)
+//  1       1     transfer_id      (low byte of the matching result frame seq)
+//  2       2     packet_index     (uint16 LE, 0 for the first packet)
+//
+// Packet payloads concatenate into one little-endian stream:
+//  0       4     start_hz         (uint32)
+//  4       4     step_hz          (uint32)
+//  8       2     points           (uint16)
+//  10      2     first_cdb        (int16, S11 of point 0 in centi-dB)
+//  12      2*(points-1)           (int16 deltas, point[i] - point[i-1] in centi-dB)
+// The packet carrying the last stream byte has SWEEP_PKT_LAST set.
+#ifndef SWEEP_TRANSFER_H
+#define SWEEP_TRANSFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SWEEP_PKT_FIRST           (1u << 0)
+#define SWEEP_PKT_LAST            (1u << 1)
+#define SWEEP_PKT_HEADER_LEN      (4)
+#define SWEEP_STREAM_HEADER_LEN   (12)
+// Curve values are clamped to this magnitude so every delta fits in an int16
+#define SWEEP_CURVE_CDB_LIMIT     (16000)
+
+typedef struct {
+    const int16_t *curve_cdb;
+    uint16_t points;
+    uint32_t start_hz;
+    uint32_t step_hz;
+    uint8_t transfer_id;
+    size_t stream_offset;    // Next payload stream byte to send
+    uint16_t packet_index;
+} sweep_transfer_t;
+
+/**
+ * @brief Clamps an S11 value in dB to the centi-dB range used by curve transfers.
+ */
+int16_t sweep_transfer_db_to_cdb(double s11_db);
+
+/**
+ * @brief Starts a transfer of `points` curve values. `curve_cdb` must stay valid until done.
+ */
+void sweep_transfer_begin(sweep_transfer_t *transfer, uint8_t transfer_id,
+                          uint32_t start_hz, uint32_t step_hz,
+                          const int16_t *curve_cdb, uint16_t points);
+
+/**
+ * @brief Encodes the next packet into `out` (at most `max_len` bytes, i.e. MTU - 3).
+ * @return Packet length, or 0 once the transfer is complete (or max_len is too small)
+ */
+size_t sweep_transfer_next(sweep_transfer_t *transfer, uint8_t *out, size_t max_len);
+
+/**
+ * @brief Total number of payload stream bytes for `points` values.
+ */
+size_t sweep_transfer_stream_len(uint16_t points);
+
+/**
+ * @brief Writes the SWEEP_PKT_HEADER_LEN-byte packet header into `out`. Every stream sent
+ * as these packets (curves, trace dumps, journal syncs, sweep history) uses it.
+ */
+void sweep_transfer_put_header(uint8_t *out, bool first, bool last, uint8_t transfer_id, uint16_t packet_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SWEEP_TRANSFER_H
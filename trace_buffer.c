@@ -0,0 +1,134 @@
+#include <string.h>
+#include "trace_buffer.h"
+#include "sweep_transfer.h"
+#include "le_bytes.h"
+
+#define TRACE_INDEX_MASK (TRACE_BUFFER_RECORDS - 1)
+
+void trace_buffer_init(trace_buffer_t *tb, trace_level_t level)
+{
+    memset(tb->records, 0, sizeof(tb->records));
+    tb->head = 0;
+    memset(tb->levels, level, sizeof(tb->levels));
+}
+
+void trace_buffer_set_level(trace_buffer_t *tb, trace_tag_t tag, trace_level_t level)
+{
+    if ((unsigned)tag < TRACE_TAG_COUNT) {
+        tb->levels[tag] = (uint8_t)level;
+    }
+}
+
+void trace_buffer_write(trace_buffer_t *tb, uint32_t time_us, uint8_t event, uint8_t flags, uint16_t index, int32_t value)
+{
+    const uint32_t seq = __atomic_fetch_add(&tb->head, 1, __ATOMIC_RELAXED);
+    trace_record_t *r = &tb->records[seq & TRACE_INDEX_MASK];
+
+    // seq = 0 marks the slot as being rewritten; the final store publishes it
+    __atomic_store_n(&r->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    r->time_us = time_us;
+    r->event = event;
+    r->flags = flags;
+    r->index = index;
+    r->value = value;
+    __atomic_store_n(&r->seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+bool trace_buffer_read(const trace_buffer_t *tb, uint32_t seq, trace_record_t *out)
+{
+    const trace_record_t *r = &tb->records[seq & TRACE_INDEX_MASK];
+
+    if (__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE) != seq + 1) {
+        return false;
+    }
+    out->time_us = r->time_us;
+    out->event = r->event;
+    out->flags = r->flags;
+    out->index = r->index;
+    out->value = r->value;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    // A writer that lapped the buffer during the copy has changed seq by now
+    if (__atomic_load_n(&r->seq, __ATOMIC_RELAXED) != seq + 1) {
+        return false;
+    }
+    out->seq = seq;
+    return true;
+}
+
+void trace_dump_begin(trace_dump_t *dump, const trace_buffer_t *tb, uint8_t transfer_id)
+{
+    const uint32_t head = __atomic_load_n(&tb->head, __ATOMIC_ACQUIRE);
+    const uint32_t held = (head < TRACE_BUFFER_RECORDS) ? head : TRACE_BUFFER_RECORDS;
+
+    dump->buffer = tb;
+    dump->first_seq = head - held;
+    dump->count = (uint16_t)held;
+    dump->transfer_id = transfer_id;
+    dump->stream_offset = 0;
+    dump->packet_index = 0;
+    dump->loaded = UINT32_MAX;
+}
+
+uint16_t trace_dump_record_count(const trace_dump_t *dump)
+{
+    return dump->count;
+}
+
+/**
+ * @brief Encodes record `i` of the dump into dump->record (TRACE_EV_LOST if it was overwritten).
+ */
+static void load_record(trace_dump_t *dump, uint32_t i)
+{
+    const uint32_t seq = dump->first_seq + i;
+    trace_record_t r;
+    if (!trace_buffer_read(dump->buffer, seq, &r)) {
+        memset(&r, 0, sizeof(r));
+        r.event = TRACE_EV_LOST;
+    }
+    le_put_u32(dump->record + 0, seq);
+    le_put_u32(dump->record + 4, r.time_us);
+    dump->record[8] = r.event;
+    dump->record[9] = r.flags;
+    le_put_u16(dump->record + 10, r.index);
+    le_put_u32(dump->record + 12, (uint32_t)r.value);
+    dump->loaded = i;
+}
+
+static uint8_t stream_byte(trace_dump_t *dump, size_t offset)
+{
+    if (offset < TRACE_DUMP_HEADER_LEN) {
+        const uint8_t header[TRACE_DUMP_HEADER_LEN] = {
+            TRACE_DUMP_FORMAT, TRACE_DUMP_RECORD_LEN, (uint8_t)dump->count, (uint8_t)(dump->count >> 8),
+        };
+        return header[offset];
+    }
+    const uint32_t i = (uint32_t)((offset - TRACE_DUMP_HEADER_LEN) / TRACE_DUMP_RECORD_LEN);
+    if (i != dump->loaded) {
+        load_record(dump, i);
+    }
+    return dump->record[(offset - TRACE_DUMP_HEADER_LEN) % TRACE_DUMP_RECORD_LEN];
+}
+
+size_t trace_dump_next(trace_dump_t *dump, uint8_t *out, size_t max_len)
+{
+    const size_t stream_len = TRACE_DUMP_HEADER_LEN + (size_t)dump->count * TRACE_DUMP_RECORD_LEN;
+    if (dump->stream_offset >= stream_len || max_len <= SWEEP_PKT_HEADER_LEN) {
+        return 0;
+    }
+
+    size_t payload_len = max_len - SWEEP_PKT_HEADER_LEN;
+    if (payload_len > stream_len - dump->stream_offset) {
+        payload_len = stream_len - dump->stream_offset;
+    }
+
+    sweep_transfer_put_header(out, dump->stream_offset == 0, dump->stream_offset + payload_len == stream_len,
+                              dump->transfer_id, dump->packet_index);
+    for (size_t i = 0; i < payload_len; ++i) {
+        out[SWEEP_PKT_HEADER_LEN + i] = stream_byte(dump, dump->stream_offset + i);
+    }
+
+    dump->stream_offset += payload_len;
+    dump->packet_index++;
+    return SWEEP_PKT_HEADER_LEN + payload_len;
+}
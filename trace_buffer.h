@@ -0,0 +1,155 @@
+// trace_buffer.h
+// Fixed-size binary ring of trace records for hot paths where formatted logging
+// is too slow (one record per sweep point). A record costs a level check, an
+// atomic slot reservation and five stores; nothing is formatted until a dump.
+//
+// Writers may run in any task. Readers never block writers: each slot carries the
+// sequence number of the record it holds, written last, so a reader can tell a
+// record that was overwritten while it was being copied.
+//
+// Dump stream (little-endian), sent in packets with the sweep_transfer.h header:
+//  Offset  Size  Field
+//  0       1     format           (TRACE_DUMP_FORMAT)
+//  1       1     record_len       (TRACE_DUMP_RECORD_LEN)
+//  2       2     record_count     (uint16)
+//  4       16*N  records: u32 seq, u32 time_us, u8 event, u8 flags, u16 index, i32 value
+// A record overwritten during the dump is sent with event TRACE_EV_LOST.
+#ifndef TRACE_BUFFER_H
+#define TRACE_BUFFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACE_BUFFER_RECORDS      (1024)  // Power of two; one full-band sweep of point records
+#define TRACE_DUMP_FORMAT         (1)
+#define TRACE_DUMP_HEADER_LEN     (4)
+#define TRACE_DUMP_RECORD_LEN     (16)
+
+#if (TRACE_BUFFER_RECORDS & (TRACE_BUFFER_RECORDS - 1)) != 0
+#error "TRACE_BUFFER_RECORDS must be a power of two"
+#endif
+
+// Same numbering as esp_log_level_t, so one level value serves both
+typedef enum {
+    TRACE_LEVEL_NONE = 0,
+    TRACE_LEVEL_ERROR,
+    TRACE_LEVEL_WARN,
+    TRACE_LEVEL_INFO,
+    TRACE_LEVEL_DEBUG,
+    TRACE_LEVEL_VERBOSE,
+} trace_level_t;
+
+typedef enum {
+    TRACE_TAG_NANO = 0,   // Sweep / chunk / point processing
+    TRACE_TAG_USB,        // CDC-ACM events
+    TRACE_TAG_BLE,        // Commands and notifications
+    TRACE_TAG_COUNT
+} trace_tag_t;
+
+typedef enum {
+    TRACE_EV_LOST = 0,        // Overwritten while being dumped
+    TRACE_EV_SWEEP_START,     // index = points, value = start frequency (kHz)
+    TRACE_EV_SWEEP_END,       // flags = TRACE_SWEEP_OK, index = points processed, value = minimum (centi-dB)
+    TRACE_EV_CHUNK,           // index = chunk, value = bytes received
+    TRACE_EV_POINT,           // flags = TRACE_POINT_*, index = freqIndex, value = S11 (centi-dB)
+    TRACE_EV_POINT_BAD_INDEX, // index = freqIndex, value = record position in the chunk
+    TRACE_EV_USB_EVENT,       // index = cdc_acm_host event type, value = error code if any
+    TRACE_EV_BLE_COMMAND,     // index = command length, value = first four bytes (LE)
+    TRACE_EV_BLE_NOTIFY_FAIL, // index = characteristic handle, value = NimBLE rc
+    TRACE_EV_REQUEST,         // flags = TRACE_REQUEST_REJECTED, index = request id, value = connection handle
+    TRACE_EV_REQUEST_SERVED,  // flags = TRACE_REQUEST_COALESCED, index = request id, value = queue wait (us)
+    TRACE_EV_POINT_DROPPED,   // index = freqIndex, value = points dropped so far (point ring full)
+    TRACE_EV_FIFO_RESYNC,     // index = freqIndex resumed after, value = bytes skipped so far (FIFO stream realigned)
+    TRACE_EV_FIFO_REREAD,     // index = first missing freqIndex, value = points re-read
+    TRACE_EV_POWER_STATE,     // index = power_state_t left, value = power_state_t entered
+} trace_event_t;
+
+#define TRACE_SWEEP_OK            (1u << 0)
+#define TRACE_POINT_NEW_MIN       (1u << 0)  // Point became the running minimum
+#define TRACE_POINT_NOT_FINITE    (1u << 1)  // S11 was +/-inf (degenerate forward wave)
+#define TRACE_REQUEST_REJECTED    (1u << 0)  // Request queue was full
+#define TRACE_REQUEST_COALESCED   (1u << 0)  // Answered by a sweep taken for another request
+
+typedef struct {
+    uint32_t seq;      // Sequence number + 1 of the record in this slot; 0 while being written
+    uint32_t time_us;  // Low 32 bits of esp_timer_get_time()
+    uint8_t event;     // trace_event_t
+    uint8_t flags;
+    uint16_t index;
+    int32_t value;
+} trace_record_t;
+
+typedef struct {
+    trace_record_t records[TRACE_BUFFER_RECORDS];
+    uint32_t head;                      // Sequence number of the next record
+    uint8_t levels[TRACE_TAG_COUNT];    // Records above a tag's level are dropped
+} trace_buffer_t;
+
+typedef struct {
+    const trace_buffer_t *buffer;
+    uint32_t first_seq;      // Oldest record held when the dump started
+    uint16_t count;          // Records in the dump
+    uint8_t transfer_id;
+    size_t stream_offset;    // Next stream byte to send
+    uint16_t packet_index;
+    uint32_t loaded;         // Index (within the dump) of the record in `record`, or UINT32_MAX
+    uint8_t record[TRACE_DUMP_RECORD_LEN]; // Encoded copy of the record being sent
+} trace_dump_t;
+
+/**
+ * @brief Records an event if `tag` is enabled at `level`. Cheap enough for per-point use.
+ */
+#define TRACE_EVENT(tb, tag, level, time_us, event, flags, index, value)              \
+    do {                                                                                \
+        if ((tb)->levels[(tag)] >= (level)) {                                           \
+            trace_buffer_write((tb), (uint32_t)(time_us), (event), (flags), (index), (value)); \
+        }                                                                               \
+    } while (0)
+
+/**
+ * @brief Empties the buffer and sets every tag to `level`.
+ */
+void trace_buffer_init(trace_buffer_t *tb, trace_level_t level);
+
+/**
+ * @brief Sets the level of `tag`.
+ */
+void trace_buffer_set_level(trace_buffer_t *tb, trace_tag_t tag, trace_level_t level);
+
+/**
+ * @brief Appends one record, overwriting the oldest once the buffer is full.
+ */
+void trace_buffer_write(trace_buffer_t *tb, uint32_t time_us, uint8_t event, uint8_t flags, uint16_t index, int32_t value);
+
+/**
+ * @brief Copies record `seq` into `out`.
+ * @return false if it is not in the buffer (not yet written or already overwritten)
+ */
+bool trace_buffer_read(const trace_buffer_t *tb, uint32_t seq, trace_record_t *out);
+
+/**
+ * @brief Starts a dump of the records currently held. Records written afterwards are not included.
+ */
+void trace_dump_begin(trace_dump_t *dump, const trace_buffer_t *tb, uint8_t transfer_id);
+
+/**
+ * @brief Number of records the dump will carry.
+ */
+uint16_t trace_dump_record_count(const trace_dump_t *dump);
+
+/**
+ * @brief Encodes the next packet (sweep_transfer.h header + stream slice) into `out`.
+ * @return Packet length, or 0 once the dump is complete (or max_len is too small)
+ */
+size_t trace_dump_next(trace_dump_t *dump, uint8_t *out, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_BUFFER_H
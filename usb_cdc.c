@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <inttypes.h> // For PRIu32 etc.
 #include <math.h>     // For sqrt, log10, atan2, INFINITY, M_PI, isfinite
@@ -6,12 +7,20 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "nvs_flash.h"
-#include "esp_timer.h" // For timing measurements if needed
+#include "nvs.h"
+#include "esp_timer.h" // esp_timer_get_time(): latency probes, deadlines, power timing
+#include "esp_partition.h"
+#include "esp_heap_caps.h"
+#include "driver/gpio.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
 
 // --- FreeRTOS ---
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 
 // --- USB Host ---
 #include "usb/usb_host.h"
@@ -26,6 +35,37 @@
 #include "services/gap/ble_svc_gap.h"
 #include "services/gatt/ble_svc_gatt.h"
 
+// --- Result Notification Format ---
+#include "le_bytes.h"
+#include "result_frame.h"
+#include "sweep_transfer.h"
+#include "result_journal.h"
+#include "sweep_history.h"
+#include "sweep_profile.h"
+#include "usb_tune.h"
+
+// --- NanoVNA V2 Protocol ---
+#include "nanovna_proto.h"
+#include "point_ring.h"
+#include "fifo_framer.h"
+
+// --- Sweep Requests ---
+#include "sweep_request.h"
+#include "sweep_average.h"
+#include "sol_cal.h"
+#include "dip_detect.h"
+
+// --- On-Device Model ---
+#include "xgb_model_table.h"
+
+// --- Diagnostics ---
+#include "latency_stats.h"
+#include "chunk_timing.h"
+#include "trace_buffer.h"
+
+// --- Power Management ---
+#include "power_idle.h"
+
 
 // --- Configuration ---
 #define APP_MAIN_TASK_PRIORITY    (tskIDLE_PRIORITY + 3)
@@ -33,46 +73,141 @@
 #define USB_HOST_TASK_PRIORITY    (NANOVNA_TASK_PRIORITY + 1) // USB library background task
 #define NIMBLE_HOST_TASK_PRIORITY (USB_HOST_TASK_PRIORITY) // NimBLE background task priority
 
+// --- Core Assignment ---
+// USB and BLE stacks share one core; sweep processing and inference run on the other, fed
+// through fifo_point_ring, so a slow sweep never delays USB servicing. The NimBLE host task
+// is pinned by nimble_port_freertos_init() to CONFIG_BT_NIMBLE_PINNED_TO_CORE.
+#if CONFIG_FREERTOS_UNICORE
+#define USB_BLE_CORE              (0)
+#define PROCESSING_CORE           (0)
+#else
+#define USB_BLE_CORE              (0) // PRO_CPU, where the BT controller also runs
+#define PROCESSING_CORE           (1) // APP_CPU
+#endif
+#if defined(CONFIG_BT_NIMBLE_PINNED_TO_CORE) && (CONFIG_BT_NIMBLE_PINNED_TO_CORE != USB_BLE_CORE)
+#warning "NimBLE host is not on USB_BLE_CORE; set CONFIG_BT_NIMBLE_PINNED_TO_CORE to match"
+#endif
+
 // TODO: Confirm VID/PID for the mode where 0x18 command works!
 #define NANOVNA_VID           (0x04B4) // <<< YOUR OBSERVED VID
 #define NANOVNA_PID           (0x0008) // <<< YOUR OBSERVED PID
 #define NANOVNA_INTERFACE     (0)
 
 // --- Sweep Configuration (VALUES TO BE WRITTEN TO NANOVNA) ---
+// The "standard" sweep profile; its point count is also the most any profile may sweep.
 #define CONFIGURED_SWEEP_START_HZ     (2200000000ULL) // 2.2 GHz (Use ULL suffix for uint64_t)
-#define CONFIGURED_SWEEP_STEP_HZ      (195312ULL)     // 1.955 MHz step (Use ULL suffix for uint64_t)
+#define CONFIGURED_SWEEP_STEP_HZ      (195312ULL)     // 195.312 kHz step: ~200 MHz over 1024 points (Use ULL suffix for uint64_t)
 #define CONFIGURED_SWEEP_POINTS       (1024)          // Number of points
 #define CONFIGURED_VALUES_PER_FREQ    (10)            // Values per frequency
 
-// --- Sweep Configuration (MATCHES VALUES WRITTEN ABOVE) ---
-// Use the configured values below for ESP32 internal calculations
-#define TOTAL_SWEEP_POINTS    (CONFIGURED_SWEEP_POINTS) // Use the configured value (1024)
-#define SWEEP_START_HZ        ((double)CONFIGURED_SWEEP_START_HZ) // Use for calculations if needed
-#define SWEEP_STEP_HZ         ((double)CONFIGURED_SWEEP_STEP_HZ)  // Use for calculations
-// SWEEP_STOP_HZ is calculated if needed: Start + (Points - 1) * Step
-
 // --- FIFO Read Configuration ---
-#define DFU_CMD_READFIFO      (0x18)
-#define FIFO_ADDR_VALUES      (0x30)
-#define VALUE_SIZE            (32)      // Size of each point's data block from FIFO
-
-#define CHUNK_NUM_VALUES      (128)     // Points to read per USB transaction (KEEP THIS OR ADJUST AS NEEDED)
-// *** UPDATED NUM_CHUNKS based on 1024 points / 128 points/chunk ***
-#define NUM_CHUNKS            (TOTAL_SWEEP_POINTS / CHUNK_NUM_VALUES) // Should be 8 for 1024/128
+// Windows need not be a multiple of the chunk size; the last chunk of a sweep is short.
+#define CHUNK_NUM_VALUES      (128)     // Most points read per USB transaction; a sweep profile may use fewer
 
-// Check for divisibility
-#if (TOTAL_SWEEP_POINTS % CHUNK_NUM_VALUES != 0)
-#error "TOTAL_SWEEP_POINTS must be divisible by CHUNK_NUM_VALUES"
+#if (CHUNK_NUM_VALUES > NANOVNA_READFIFO_MAX_RECORDS)
+#error "CHUNK_NUM_VALUES must fit in the single-byte READFIFO count"
 #endif
 
-#define CHUNK_EXPECTED_BYTES  (CHUNK_NUM_VALUES * VALUE_SIZE) // Bytes expected PER CHUNK
+#define CHUNK_EXPECTED_BYTES  (CHUNK_NUM_VALUES * NANOVNA_FIFO_RECORD_SIZE) // Bytes expected PER CHUNK
+#define REPLY_BUFFER_SIZE     (64)      // Register replies; FIFO records go through fifo_point_ring instead
+
+#if (CHUNK_NUM_VALUES > POINT_RING_CAPACITY)
+#error "A whole chunk must fit in the point ring (one READFIFO is in flight at a time)"
+#endif
 
 #define TX_BUFFER_SIZE        (64)      // Buffer for sending commands (in cdc_acm_host_device_config_t)
-// Adjust RX buffer size for ONE chunk + overhead
+// RX buffer size for ONE chunk + overhead, until "USB TUNE" finds a better one
 #define RX_BUFFER_SIZE        (CHUNK_EXPECTED_BYTES + 256)
-#define TX_CMD_BUFFER_SIZE    (10)      // Local buffer for constructing commands
+#define RX_BUFFER_SIZE_MIN    (64)      // One full-speed bulk packet
 #define TX_TIMEOUT_MS         (1000)    // Timeout for sending command
-#define RX_CHUNK_TIMEOUT_MS   (10000)   // Timeout for receiving ONE chunk (e.g., 10 seconds)
+#define RX_CHUNK_TIMEOUT_MS   (10000)   // Longest wait for the first point of ONE chunk, attempt and retry together
+#define RX_CHUNK_RETRY_BACKOFF (2)      // A READFIFO retried after a first-point timeout waits this many times longer
+// First-point deadline until the timing is learned (chunk_timing.h), and its ceiling after
+#define RX_CHUNK_FIRST_POINT_TIMEOUT_MS (RX_CHUNK_TIMEOUT_MS / (1 + RX_CHUNK_RETRY_BACKOFF))
+#define RX_CHUNK_IDLE_TIMEOUT_MS (200)  // Once points flow, a gap this long ends the chunk (missing points are re-read); learned likewise
+#define RX_CHUNK_TIMEOUT_FLOOR_MS (10)  // Learned deadlines never go below this (a tick at 100 Hz, plus scheduling)
+#define FIFO_MAX_REREADS (4)            // Range re-reads per sweep; needing more means the link is too bad and the sweep fails
+
+#if (TX_BUFFER_SIZE < NANOVNA_BATCH_MAX_LEN)
+#error "A NanoVNA command batch must fit in one CDC transfer"
+#endif
+
+// --- NanoVNA Register Access (see nanovna_proto.h) ---
+#define NANOVNA_REPLY_TIMEOUT_MS    (500)   // Register reads answer within a few ms once the device is up
+#define NANOVNA_SYNC_ATTEMPTS       (3)     // Connect-time handshake tries before giving up on the device
+#define CONFIG_CACHE_NVS_NAMESPACE  "nanovna"
+#define CONFIG_CACHE_NVS_KEY        "cfg_hash"  // u32 nanovna_sweep_config_hash() of the last applied config
+
+// --- USB Transfer Tuning ---
+// "USB TUNE [<sweeps>]" times sweeps of the active profile's band with every pair of the
+// chunk and receive buffer sizes below (see usb_tune.h) and keeps the fastest: the buffer
+// size in NVS, used whenever the NanoVNA is opened, and the chunk size in the profile.
+#define USB_TUNE_NVS_NAMESPACE      "usb_tune"
+#define USB_TUNE_SWEEPS_DEFAULT     (4)
+#define USB_TUNE_SWEEPS_MAX         (32)
+#define USB_TUNE_CHUNK_SIZES        { 16, 32, 64, 96, CHUNK_NUM_VALUES }
+#define USB_TUNE_BUFFER_SIZES       { 512, 1024, 2048, RX_BUFFER_SIZE }
+
+// --- Two-Stage (Coarse-to-Fine) Sweep Configuration ---
+// Coarse stage spreads its points over the whole band of the active profile; fine stage
+// sweeps at that profile's step (full resolution) centred on the coarse dip.
+#define COARSE_SWEEP_POINTS_DEFAULT (64)
+#define FINE_SWEEP_POINTS_DEFAULT   (128)
+
+// --- Resonance Tracking Configuration ---
+// Tracking sweeps a narrow full-resolution window centred on the previous resonance.
+#define TRACKING_WINDOW_POINTS_DEFAULT (64)
+#define TRACKING_WINDOW_POINTS_MAX     (256)  // Widening stops here; beyond it lock is declared lost
+#define TRACKING_EDGE_POINTS           (2)    // Minimum this close to a window edge triggers widening
+#define TRACKING_MIN_DIP_DB            (3.0)  // Window max - min below this means the dip left the window
+
+// --- Multi-Sweep Averaging ---
+// "AVERAGE <n>" repeats the final window of each reading n times and reports the
+// minimum of the per-point complex mean, plus a noise estimate (see sweep_average.h).
+#if (CONFIGURED_SWEEP_POINTS > SWEEP_AVERAGE_MAX_POINTS)
+#error "The averaging accumulators must cover a full-band sweep"
+#endif
+
+// --- Dip Detection ---
+// Each reading also lists the most prominent dips of its final window (see dip_detect.h),
+// so a spurious dip deeper than the sensor's own is reported next to it rather than
+// instead of it. "DIPS <n> [<min_cdb>]" sets how many (0 = none) and the prominence a
+// dip needs, in centi-dB.
+#define DIP_COUNT_DEFAULT           (RESULT_FRAME_MAX_DIPS)
+#define DIP_MIN_PROMINENCE_CDB_DEFAULT (100)  // 1 dB; well above the single-sweep noise
+
+#if (RESULT_FRAME_MAX_DIPS > DIP_DETECT_MAX)
+#error "Every dip a result frame carries must be detectable"
+#endif
+
+// --- SOL Calibration ---
+// "CAL OPEN" / "CAL SHORT" / "CAL LOAD" measure a standard fitted in place of the sensor
+// over the full band, averaging CAL_MEASURE_SWEEPS sweeps; "CAL SAVE" solves the per-point
+// error terms (see sol_cal.h), stores them in NVS and corrects every later sweep.
+// The terms take 24 bytes per point, so the nvs partition needs room for them, e.g.
+//   nvs,      data, nvs,   ,  64K
+#define CAL_MEASURE_SWEEPS          (8)
+#define CAL_NVS_NAMESPACE           "sol_cal"
+
+#if (CONFIGURED_SWEEP_POINTS > SOL_CAL_MAX_POINTS)
+#error "The calibration must cover a full-band sweep"
+#endif
+
+// --- Sweep Profiles ---
+// Named sweep settings kept in NVS (see sweep_profile.h); the defaults below are stored on
+// first boot. A one-byte write to the profile characteristic (or "PROFILE <name>") selects
+// one, applied before the next reading; "PROFILE SET ..." edits the table. Every profile
+// fits the buffers sized above: CONFIGURED_SWEEP_POINTS points, CHUNK_NUM_VALUES per chunk.
+#define SWEEP_PROFILE_NVS_NAMESPACE "profiles"
+#define SWEEP_PROFILE_DEFAULT_ACTIVE (1)              // "standard"
+#define SWEEP_PROFILE_MIN_HZ        (50000ULL)        // NanoVNA V2 lower limit
+#define SWEEP_PROFILE_MAX_HZ        (4000000000ULL)   // Below 2^32: result frames carry Hz as u32
+#define SWEEP_PROFILE_MAX_VALUES_PER_FREQ (100)       // Keeps a chunk within its first-point deadline
+#define SWEEP_PROFILE_NONE          (0xFF)            // No switch pending
+
+// Same band as "standard" in a quarter of the points, with light averaging
+#define SWEEP_PROFILE_FAST_POINTS   (256)
+#define SWEEP_PROFILE_FAST_STEP_HZ  ((uint64_t)(CONFIGURED_SWEEP_POINTS - 1) * CONFIGURED_SWEEP_STEP_HZ / (SWEEP_PROFILE_FAST_POINTS - 1))
 
 
 // --- BLE Configuration ---
@@ -86,47 +221,377 @@ static const ble_uuid128_t CHARACTERISTIC_UUID = BLE_UUID128_INIT(
     0xbe, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
     0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8 // Same UUIDs okay
 );
+// Notify-only characteristic carrying full sweep curves ("SWEEP DUMP ON")
+static const ble_uuid128_t SWEEP_DATA_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xbf, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+// Read-only characteristic reporting the on-device model:
+// u8 format (1), u32 model id (LE), u16 tree count (LE), u16 node count (LE)
+static const ble_uuid128_t MODEL_INFO_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xc0, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+#define MODEL_INFO_FORMAT   (1)
+// Notify-only characteristic carrying trace buffer dumps ("TRACE DUMP"; layout in trace_buffer.h)
+static const ble_uuid128_t TRACE_DATA_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xc2, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+// Read/notify characteristic of the offline result journal. Notifications carry "JOURNAL SYNC"
+// streams (layout in result_journal.h); a read returns the journal status, little-endian:
+// u8 format (1), u32 acked seq, u32 newest seq (0 = none), u32 pending, u32 dropped, u32 capacity
+static const ble_uuid128_t JOURNAL_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xc3, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+#define JOURNAL_STATUS_FORMAT   (1)
+#define JOURNAL_STATUS_LEN      (21)
+// Read/notify characteristic of the sweep history. Notifications carry "HISTORY" transfers
+// (layout in sweep_history.h); a read returns the history status, little-endian:
+// u8 format (1), u16 slots (0 = no history), u16 max points, u16 held, u32 oldest seq, u32 newest seq
+static const ble_uuid128_t HISTORY_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xc4, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+#define HISTORY_STATUS_FORMAT   (1)
+#define HISTORY_STATUS_LEN      (15)
+// Read/write characteristic of the sweep profiles. A read returns the table and the active
+// profile (layout in sweep_profile.h); writing one byte, a profile index, selects that profile.
+static const ble_uuid128_t PROFILE_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xc5, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+// Read-only characteristic reporting the last "USB TUNE" run (layout in usb_tune.h); a
+// long read with every candidate measured.
+static const ble_uuid128_t USB_TUNE_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xc6, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
+// Read-only characteristic with per-stage sweep latency statistics (layout in latency_stats.h),
+// followed by the learned READFIFO timing (layout in chunk_timing.h) and the power state
+// counters (layout in power_idle.h).
+// Longer than a default-MTU read; clients fetch it with a long read. "STATS RESET" clears it.
+static const ble_uuid128_t DIAGNOSTICS_CHARACTERISTIC_UUID = BLE_UUID128_INIT(
+    0xc1, 0xb5, 0x48, 0x3e, 0x36, 0xe1, 0x46, 0x88,
+    0xb7, 0xf5, 0xea, 0x07, 0x36, 0x1b, 0x26, 0xa8
+);
 #define BLE_TRIGGER_STRING "DATA REQUESTED"
-#define BLE_NOTIFY_BUF_SIZE 100 // Max size for notification string
+#define SWEEP_DUMP_NOTIFY_RETRIES   (50)    // Waits of SWEEP_DUMP_RETRY_DELAY_MS for mbufs per packet
+#define SWEEP_DUMP_RETRY_DELAY_MS   (5)
+
+// --- BLE Client Configuration ---
+// Each connected central has its own MTU, CCCD subscriptions and request count.
+// Every result-subscribed client gets a frame of every sweep (see ble_fan_out_result()).
+#define BLE_MAX_CLIENTS             (3)     // Keep <= CONFIG_BT_NIMBLE_MAX_CONNECTIONS
+#define BLE_CLIENT_MAX_PENDING      (4)     // Requests one client may have outstanding; more are rejected
+#define BLE_CLIENT_SUB_RESULT       (1u << 0) // CCCD bits in ble_client_t.subscribed
+#define BLE_CLIENT_SUB_SWEEP        (1u << 1)
+#define BLE_CLIENT_SUB_TRACE        (1u << 2)
+#define BLE_CLIENT_SUB_JOURNAL      (1u << 3)
+#define BLE_CLIENT_SUB_HISTORY      (1u << 4)
+
+// --- Request Queue Configuration ---
+// "DATA REQUESTED [<id> [<priority>]]" queues a request descriptor (see sweep_request.h).
+// The queue carries requests from the BLE host task; the control task drains it into
+// its pending set, so at most REQUEST_QUEUE_LEN + SWEEP_REQUEST_PENDING_MAX are held.
+#define REQUEST_QUEUE_LEN           (8)
+
+// --- Streaming Configuration ---
+// "STREAM <period_ms>" sweeps periodically and notifies each result without a trigger write.
+#define STREAM_PERIOD_MIN_MS        (100)   // Shortest accepted streaming period
+#define STREAM_MIN_FREE_MBUFS       (4)     // Fewer free mbufs than this means the link is backed up
+
+// --- Result Journal Configuration ---
+// Readings no client received are appended to a journal in the "journal" flash partition
+// (see result_journal.h), so they survive until a client syncs. partitions.csv entry:
+//   journal,  data, 0x40,  ,  256K
+// Streaming continues after the last client disconnects while the journal is available.
+// Without the partition the firmware runs as before and readings nobody receives are lost.
+#define JOURNAL_PARTITION_LABEL     "journal"
+#define JOURNAL_PARTITION_SUBTYPE   (0x40)
+#define JOURNAL_NVS_NAMESPACE       "journal"
+#define JOURNAL_NVS_ACKED_KEY       "acked"    // u32 last record a client acknowledged
+#define JOURNAL_SYNC_TASK_PRIORITY  (tskIDLE_PRIORITY + 1) // Below sweeps, like trace dumps
+
+#if (RESULT_FRAME_MAX_LEN > RESULT_JOURNAL_FRAME_MAX)
+#error "A result frame must fit in one journal slot"
+#endif
+
+// --- Sweep History Configuration ---
+// The last SWEEP_HISTORY_SLOTS sweeps (S11 and phase per point, see sweep_history.h) are kept
+// in PSRAM, allocated once at boot: 64 sweeps of 1024 points take about 257 KB. A sweep is
+// added after its reading has gone out, so the history costs the reading nothing.
+// Without PSRAM (CONFIG_SPIRAM) the firmware runs without a history.
+#define SWEEP_HISTORY_SLOTS         (64)
+#define HISTORY_SEND_TASK_PRIORITY  (tskIDLE_PRIORITY + 1) // Below sweeps, like journal syncs
+
+// --- Trace Configuration ---
+// Binary trace records replace per-point console logging (see trace_buffer.h).
+// "LOG <tag> <level>" changes console levels at runtime, up to CONFIG_LOG_MAXIMUM_LEVEL.
+#define TRACE_DEFAULT_LEVEL         (TRACE_LEVEL_VERBOSE) // Keep every point of the latest sweep
+#define TRACE_DUMP_TASK_PRIORITY    (tskIDLE_PRIORITY + 1) // Below sweeps; a dump never delays a reading
+
+// --- Power Management ---
+// Between readings the sensor idles, then suspends (see power_idle.h); "POWER ..." sets the
+// timeouts and idle intervals at runtime. Suspending switches off the NanoVNA's VBUS through
+// NANOVNA_VBUS_EN_GPIO (active high). The V2 protocol has no sleep command, so without the
+// switch (-1) the sensor idles but never suspends. A NanoVNA V2 running on its own battery
+// keeps its registers meanwhile: the readback after a wake finds the window it was left
+// with, and the first sweep goes ahead without reprogramming it.
+// Automatic light sleep also needs CONFIG_FREERTOS_USE_TICKLESS_IDLE and a BT controller
+// sleep clock that runs in light sleep (CONFIG_BT_CTRL_LPCLK_SEL_*). The NanoVNA task holds
+// a CPU_FREQ_MAX lock while the NanoVNA is powered, since the USB host does not survive
+// light sleep; while suspended the CPU also drops to POWER_MIN_CPU_FREQ_MHZ.
+#ifndef NANOVNA_VBUS_EN_GPIO
+#define NANOVNA_VBUS_EN_GPIO        (-1)
+#endif
+#define POWER_IDLE_AFTER_MS_DEFAULT    (30 * 1000)
+#if NANOVNA_VBUS_EN_GPIO >= 0
+#define POWER_SUSPEND_AFTER_MS_DEFAULT (5 * 60 * 1000)
+#else
+#define POWER_SUSPEND_AFTER_MS_DEFAULT (0)
+#endif
+#define POWER_TIMEOUT_MAX_S         (24 * 60 * 60) // Longest idle / suspend timeout "POWER" accepts
+#define POWER_ADV_ITVL_ACTIVE_MS    (100)
+#define POWER_ADV_ITVL_IDLE_MS      (1000)
+#define POWER_CONN_ITVL_ACTIVE_MS   (30)
+#define POWER_CONN_ITVL_IDLE_MS     (500)
+#define POWER_SUPERVISION_MIN_MS    (4000)  // Supervision timeout asked for with an interval; at least 6 intervals
+#ifdef CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#define POWER_MAX_CPU_FREQ_MHZ      (CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ)
+#else
+#define POWER_MAX_CPU_FREQ_MHZ      (240)
+#endif
+#define POWER_MIN_CPU_FREQ_MHZ      (40)    // XTAL
+
+// --- BLE Clients ---
+typedef struct {
+    uint16_t conn_handle;      // BLE_HS_CONN_HANDLE_NONE when the slot is free
+    uint16_t mtu;              // Negotiated ATT MTU
+    uint8_t subscribed;        // BLE_CLIENT_SUB_* bits from the client's CCCD writes
+    uint8_t pending_requests;  // Requests queued or pending, not yet answered
+    bool notify_backlogged;    // Last result notify was refused for lack of buffers
+    bool skipped_pending;      // Readings were skipped for this client; flag its next frame
+} ble_client_t;
+
+// --- Sweep Windows and Modes ---
+typedef struct {
+    uint64_t start_hz;
+    uint64_t step_hz;
+    uint16_t points;
+} sweep_window_t;
+
+typedef enum {
+    SWEEP_MODE_FULL = 0,    // One dense sweep over the configured band
+    SWEEP_MODE_COARSE_FINE, // Sparse sweep over the band, then dense sweep around the dip
+    SWEEP_MODE_TRACKING,    // Narrow sweep centred on the previous resonance
+} sweep_mode_t;
+
+typedef enum {
+    CAL_ACTION_NONE = 0,
+    CAL_ACTION_MEASURE_OPEN,  // Measure the standard fitted now ("CAL OPEN" / "SHORT" / "LOAD")
+    CAL_ACTION_MEASURE_SHORT,
+    CAL_ACTION_MEASURE_LOAD,
+    CAL_ACTION_SAVE,          // Solve the terms from the three standards and store them
+    CAL_ACTION_CLEAR,         // Back to raw S11; forget stored terms and measured standards
+} cal_action_t;
+
+static const sweep_profile_t default_sweep_profiles[] = {
+    { .name = "fast", .start_hz = CONFIGURED_SWEEP_START_HZ, .step_hz = SWEEP_PROFILE_FAST_STEP_HZ,
+      .points = SWEEP_PROFILE_FAST_POINTS, .values_per_freq = 2, .chunk_points = CHUNK_NUM_VALUES },
+    { .name = "standard", .start_hz = CONFIGURED_SWEEP_START_HZ, .step_hz = CONFIGURED_SWEEP_STEP_HZ,
+      .points = CONFIGURED_SWEEP_POINTS, .values_per_freq = CONFIGURED_VALUES_PER_FREQ, .chunk_points = CHUNK_NUM_VALUES },
+    // Slow points: shorter chunks so a lost one costs less to re-read
+    { .name = "precise", .start_hz = CONFIGURED_SWEEP_START_HZ, .step_hz = CONFIGURED_SWEEP_STEP_HZ,
+      .points = CONFIGURED_SWEEP_POINTS, .values_per_freq = 40, .chunk_points = CHUNK_NUM_VALUES / 2 },
+};
+
+static const sweep_profile_limits_t sweep_profile_limits = {
+    .max_points = CONFIGURED_SWEEP_POINTS,
+    .max_chunk_points = CHUNK_NUM_VALUES,
+    .max_values_per_freq = SWEEP_PROFILE_MAX_VALUES_PER_FREQ,
+    .min_hz = SWEEP_PROFILE_MIN_HZ,
+    .max_hz = SWEEP_PROFILE_MAX_HZ,
+};
 
 // --- Logging ---
 static const char *TAG_MAIN = "APP_MAIN";
 static const char *TAG_NANO = "NANOVNA_TASK";
 static const char *TAG_BLE = "NIMBLE_GATTS";
 static const char *TAG_USB = "USB_HOST_LIB"; // For usb_lib_task
+static const char *TAG_TRACE = "TRACE";
+// Trace tags are named after the console tag of the code that records them
+static const char *const trace_tag_names[TRACE_TAG_COUNT] = {
+    [TRACE_TAG_NANO] = "NANOVNA_TASK",
+    [TRACE_TAG_USB] = "USB_HOST_LIB",
+    [TRACE_TAG_BLE] = "NIMBLE_GATTS",
+};
 
 // --- Shared Resources ---
 // USB/NanoVNA related
 static SemaphoreHandle_t device_disconnected_sem; // Signals device disconnection
-static SemaphoreHandle_t fifo_data_ready_sem;   // Signals complete FIFO CHUNK received
-// Buffer for ONE CHUNK of raw data
-static uint8_t chunk_rx_buffer[CHUNK_EXPECTED_BYTES];
-static volatile size_t current_chunk_rx_count = 0;     // Bytes received for current chunk
+static SemaphoreHandle_t fifo_data_ready_sem;   // Signals a complete register reply, or FIFO points pushed
+// Buffer for register replies
+static uint8_t reply_rx_buffer[REPLY_BUFFER_SIZE];
+static volatile size_t reply_rx_count = 0;     // Bytes received for current reply
+static volatile size_t reply_expected_bytes = 0; // Bytes requested by the current batch
+// FIFO reads: records are framed on the USB core and handed to the processing task
+static point_ring_t fifo_point_ring;               // SPSC: USB driver task -> NanoVNA task
+static uint32_t fifo_bytes_due = 0;                // Bytes of the current READFIFO reply not yet received (atomic)
+static fifo_framer_t fifo_framer;                  // USB side while a READFIFO is in flight, NanoVNA task otherwise
 static volatile cdc_acm_dev_hdl_t current_cdc_dev = NULL; // Store current device handle (use carefully)
 
 // BLE related
 static uint16_t gatt_chr_handle;                    // Characteristic handle for notifications
-static volatile uint16_t current_conn_handle = BLE_HS_CONN_HANDLE_NONE; // Store current connection handle
-static char ble_notify_buffer[BLE_NOTIFY_BUF_SIZE]; // Buffer for formatting BLE notification string
+static uint16_t gatt_sweep_chr_handle;              // Characteristic handle for sweep curve notifications
+static uint16_t gatt_trace_chr_handle;              // Characteristic handle for trace dump notifications
+static uint16_t gatt_journal_chr_handle;            // Characteristic handle for journal sync notifications
+static uint16_t gatt_history_chr_handle;            // Characteristic handle for sweep history notifications
+static ble_client_t ble_clients[BLE_MAX_CLIENTS];  // Connected centrals, by slot
+static SemaphoreHandle_t ble_clients_mutex;         // Guards ble_clients (BLE host, NanoVNA and trace dump tasks)
+static volatile bool sweep_dump_enabled = false;    // Send every completed sweep curve after its result
+static SemaphoreHandle_t result_frame_mutex;        // Guards ble_result_frame (NanoVNA and BLE host tasks)
+static uint8_t ble_result_frame[RESULT_FRAME_MAX_LEN]; // Last reading as GATT reads return it (request id 0)
+static size_t ble_result_frame_len = 0;
+static uint16_t result_frame_seq = 0;               // Sequence number of the next result frame
 
 // Synchronization between BLE and NanoVNA Task
-static SemaphoreHandle_t trigger_nanovna_read_sem; // Signaled by BLE write to trigger USB read
+static QueueHandle_t sweep_request_queue;          // sweep_request_t from BLE writes (and wake-ups) to the NanoVNA task
+static sweep_request_set_t pending_requests;       // Requests drained from the queue, not yet answered (NanoVNA task only)
+static uint16_t next_auto_request_id = SWEEP_REQUEST_AUTO_ID_BASE; // Id for the next untagged "DATA REQUESTED"
+static volatile bool stream_restart = false;       // "STREAM <ms>" received: take the first streamed reading now
+
+// Streaming state (written from the BLE host task, read by the NanoVNA task)
+static volatile uint32_t stream_period_ms = 0;      // 0 = streaming off
+static uint32_t stream_skipped_count = 0;           // Periods skipped because the link was backed up
 
 // --- Stream Processing State ---
-// Variables to store the minimum S11 found *during* the sweep
-static volatile double current_min_s11_db = INFINITY;
-static volatile double freq_at_min_s11_hz = 0.0;
-static volatile int points_processed_count = 0; // To track how many points were processed
+// Variables to store the minimum S11 found *during* the sweep (NanoVNA task only)
+static double current_min_s11_db = INFINITY;
+static double freq_at_min_s11_hz = 0.0;
+static double current_max_s11_db = -INFINITY; // Used to judge dip depth within a window
+static int16_t sweep_curve_cdb[CONFIGURED_SWEEP_POINTS]; // S11 of the last swept window, centi-dB, by freqIndex
+static float sweep_curve_re[CONFIGURED_SWEEP_POINTS];    // Complex S11 of the same points (NAN if not finite), for the history
+static float sweep_curve_im[CONFIGURED_SWEEP_POINTS];
+static int points_processed_count = 0; // To track how many points were processed
+static sweep_window_t swept_window;    // Window the state above describes (the programmed one, except while re-reading part of it)
+static uint16_t fifo_index_base = 0;   // Index in swept_window of freqIndex 0 of the programmed window
+static uint8_t swept_points_seen[(CONFIGURED_SWEEP_POINTS + 7) / 8]; // Bit per swept_window point processed
+
+// --- Sweep Programming State ---
+static sweep_window_t active_sweep_window;           // Window the NanoVNA is currently programmed with
+static bool active_sweep_window_valid = false;       // False until the window registers are written after connect
+static uint16_t active_values_per_freq = 0;          // Averaging the NanoVNA is programmed with (valid with the window)
+static uint32_t applied_config_hash = 0;             // Connect-time config last written and verified (mirrored in NVS)
+static volatile sweep_mode_t sweep_mode = SWEEP_MODE_FULL;              // Selected over BLE ("SWEEP FULL" / "SWEEP COARSE")
+static volatile uint16_t coarse_sweep_points = COARSE_SWEEP_POINTS_DEFAULT;
+static volatile uint16_t fine_sweep_points = FINE_SWEEP_POINTS_DEFAULT;
+
+// --- Sweep Profile State ---
+static sweep_profile_table_t sweep_profiles;         // Guarded by sweep_profiles_mutex (BLE host writes, NanoVNA task reads)
+static SemaphoreHandle_t sweep_profiles_mutex;
+static uint8_t active_profile = SWEEP_PROFILE_DEFAULT_ACTIVE; // Selected index: new requests and streamed readings use it (atomic)
+static uint8_t profile_requested = SWEEP_PROFILE_NONE; // Index selected over BLE, not yet applied (atomic)
+static uint8_t applied_profile = SWEEP_PROFILE_NONE; // Index the settings below come from (NanoVNA task only)
+static sweep_window_t full_sweep_window;             // Band of the applied profile (NanoVNA task only)
+static uint16_t sweep_values_per_freq = CONFIGURED_VALUES_PER_FREQ;
+static uint16_t sweep_chunk_points = CHUNK_NUM_VALUES; // Points per READFIFO (also read for the diagnostics)
+
+// --- USB Tuning State ---
+static uint16_t usb_rx_buffer_size = RX_BUFFER_SIZE; // CDC in-buffer size the NanoVNA is opened with (NanoVNA task only)
+static usb_tune_t usb_tune;                          // Last "USB TUNE" run; written by the NanoVNA task under diag_stats_mutex
+static uint8_t usb_tune_requested = 0;               // Counted sweeps per candidate of a run not yet started (atomic)
+
+// --- Averaging State ---
+static volatile uint8_t average_sweeps = 1;          // "AVERAGE <n>": sweeps per reading (1 = off)
+static sweep_average_t sweep_avg;                    // Accumulators of the window being averaged (NanoVNA task only)
+static bool sweep_avg_active = false;                // Processed points also go into sweep_avg
+
+// --- Dip Detection State ---
+static volatile uint8_t dip_count = DIP_COUNT_DEFAULT;                   // "DIPS <n>": dips per result frame
+static volatile uint16_t dip_min_prominence_cdb = DIP_MIN_PROMINENCE_CDB_DEFAULT;
+
+// --- Calibration State (NanoVNA task only, once loaded at boot) ---
+static sol_cal_t sol_cal;                            // Error terms of the calibrated band
+static sol_cal_window_t sol_cal_window;              // The terms interpolated onto the programmed window
+static bool sol_cal_window_active = false;           // process_fifo_point corrects with sol_cal_window
+static bool cal_bypass = false;                      // Raw S11 while a standard is measured
+static sol_cal_capture_t *cal_capture = NULL;        // Standards measured so far; allocated during a calibration
+static uint8_t cal_action = CAL_ACTION_NONE;         // cal_action_t written by the BLE host task (atomic)
+
+// --- Resonance Tracking State ---
+static bool tracking_locked = false;                 // True once a resonance is known for this sensor
+static uint64_t tracked_resonance_hz = 0;            // Last resonance found while tracking
+static volatile uint16_t tracking_window_points = TRACKING_WINDOW_POINTS_DEFAULT;
+
+// --- Latency Diagnostics ---
+static latency_stats_t sweep_latency_stats;          // Written by the NanoVNA task, read by the BLE host task
+static chunk_timing_t chunk_timing;                  // Learned READFIFO timing; written by the NanoVNA task
+// Guards the state the diagnostics characteristic reports and "STATS RESET" clears as one
+// snapshot: sweep_latency_stats, chunk_timing and power_idle, plus the usb_tune report
+static SemaphoreHandle_t diag_stats_mutex;
+static trace_buffer_t trace_buffer;                  // Lock-free; written from any task
+static SemaphoreHandle_t trace_dump_sem;             // Signals the trace dump task
+static volatile bool trace_dump_to_ble = false;      // Destination of the pending dump: BLE or console
+static volatile uint16_t trace_dump_conn = BLE_HS_CONN_HANDLE_NONE; // Client that asked for the BLE dump
+static uint8_t trace_dump_id = 0;                    // transfer_id of the next BLE dump
+
+// --- Result Journal ---
+static result_journal_t result_journal;              // Guarded by journal_mutex (NanoVNA, BLE host and sync tasks)
+static bool journal_ready = false;                   // Partition found and scanned at boot
+static SemaphoreHandle_t journal_mutex;
+static SemaphoreHandle_t journal_sync_sem;           // Signals the journal sync task
+static volatile uint16_t journal_sync_conn = BLE_HS_CONN_HANDLE_NONE; // Client that asked for the sync
+static volatile uint32_t journal_sync_after = 0;     // Send records after this one
+static uint8_t journal_sync_id = 0;                  // transfer_id of the next sync
+
+// --- Sweep History ---
+static sweep_history_t sweep_history;                // Guarded by history_mutex (NanoVNA and history send tasks)
+static bool history_ready = false;                   // Storage allocated at boot
+static SemaphoreHandle_t history_mutex;
+static SemaphoreHandle_t history_send_sem;           // Signals the history send task
+static volatile uint16_t history_send_conn = BLE_HS_CONN_HANDLE_NONE; // Client that asked for the sweep
+static volatile uint32_t history_send_seq = 0;       // Sweep asked for (0 = newest)
+static volatile uint16_t history_send_first = 0;     // Point range asked for
+static volatile uint16_t history_send_count = 0;
+static uint8_t history_send_id = 0;                  // transfer_id of the next history transfer
+
+// --- Power State ---
+static power_idle_t power_idle;                      // Run by the NanoVNA task; guarded by diag_stats_mutex
+static bool power_activity = false;                  // Client connected or "POWER" received: back to ACTIVE (atomic)
+static bool power_wake_reading_due = false;          // Next reading is the first after a wake (NanoVNA task only)
+static sweep_window_t suspended_sweep_window;        // Window the NanoVNA was left with when suspended
+static bool suspended_sweep_window_valid = false;
+static volatile uint16_t ble_adv_itvl_ms = POWER_ADV_ITVL_ACTIVE_MS; // Interval ble_app_on_sync() advertises at
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t nanovna_pm_lock;         // Held while the NanoVNA is powered
+#endif
 
 // --- Forward Declarations ---
 static void nimble_host_task(void *param);
 static void usb_lib_task(void *param);
 static void nanovna_control_task(void *param);
 static int gatt_chr_access_cb(uint16_t conn_handle_, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int gatt_model_chr_access_cb(uint16_t conn_handle_, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int gatt_diag_chr_access_cb(uint16_t conn_handle_, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int gatt_journal_chr_access_cb(uint16_t conn_handle_, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int gatt_history_chr_access_cb(uint16_t conn_handle_, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int gatt_profile_chr_access_cb(uint16_t conn_handle_, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int gatt_usb_tune_chr_access_cb(uint16_t conn_handle_, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
 static int gap_event_handler(struct ble_gap_event *event, void *arg);
 static void ble_app_on_sync(void);
 static void ble_app_on_reset(int reason);
-static bool process_chunk_and_update_min(int chunk_index); // NEW: Processes chunk and updates running minimum
+static bool process_fifo_point(const nanovna_fifo_point_t *point, int position, int64_t rx_time_us); // Updates running minimum
+static bool perform_sweep(const sweep_window_t *window);
+static bool perform_coarse_fine_sweep(int *total_points_acquired);
+static bool perform_tracking_sweep(int *total_points_acquired);
+static void handle_ble_command(uint16_t conn_handle, const char *cmd, uint16_t len);
+static void request_queue_wake(void);
+static int ble_notify_result(uint16_t conn_handle, const void *data, uint16_t len, bool wait);
+static uint16_t ble_client_mtu(uint16_t conn_handle);
+static bool ble_client_request_reserve(uint16_t conn_handle);
+static void ble_client_request_release(uint16_t conn_handle);
 
 
 // =========================================================================
@@ -134,33 +599,85 @@ static bool process_chunk_and_update_min(int chunk_index); // NEW: Processes chu
 // =========================================================================
 
 /**
- * @brief USB Data received callback - Accumulates CHUNK data
+ * @brief Pushes one framed point onto fifo_point_ring (fifo_framer_emit_cb_t).
+ */
+static void fifo_point_emit(const nanovna_fifo_point_t *point, void *arg)
+{
+    (void)arg;
+    if (!point_ring_push(&fifo_point_ring, point)) {
+        TRACE_EVENT(&trace_buffer, TRACE_TAG_USB, TRACE_LEVEL_WARN, esp_timer_get_time(), TRACE_EV_POINT_DROPPED, 0,
+                    point->freq_index, (int32_t)fifo_point_ring.dropped);
+    }
+}
+
+/**
+ * @brief FIFO half of handle_usb_rx(): frames READFIFO reply bytes into records (see
+ * fifo_framer.h) and pushes one parsed point per accepted record onto fifo_point_ring.
+ * Runs in the CDC driver task on USB_BLE_CORE and does no S11 math, so processing never
+ * holds up USB servicing.
+ */
+static void handle_usb_rx_fifo(const uint8_t *data, size_t data_len)
+{
+    const uint32_t due = __atomic_load_n(&fifo_bytes_due, __ATOMIC_ACQUIRE);
+    const size_t used = (data_len < due) ? data_len : due;
+    const uint32_t resyncs = fifo_framer.resyncs;
+    size_t pushed = fifo_framer_feed(&fifo_framer, data, used, fifo_point_emit, NULL);
+    bool complete = (due > 0 && used == due);
+    if (complete) {
+        pushed += fifo_framer_finish(&fifo_framer, fifo_point_emit, NULL);
+    } else if (due > 0 && due - used < NANOVNA_FIFO_RECORD_SIZE && fifo_framer_reply_done(&fifo_framer)) {
+        // Last record framed with part of a record still due: the reply lost bytes on the way
+        fifo_framer_finish(&fifo_framer, fifo_point_emit, NULL);
+        __atomic_store_n(&fifo_bytes_due, (uint32_t)used, __ATOMIC_RELAXED);
+        complete = true;
+    }
+    if (fifo_framer.resyncs != resyncs) {
+        TRACE_EVENT(&trace_buffer, TRACE_TAG_USB, TRACE_LEVEL_WARN, esp_timer_get_time(), TRACE_EV_FIFO_RESYNC, 0,
+                    fifo_framer.expected_index, (int32_t)fifo_framer.discarded_bytes);
+    }
+    // Points are on the ring before the NanoVNA task can see the reply complete
+    __atomic_fetch_sub(&fifo_bytes_due, (uint32_t)used, __ATOMIC_RELEASE);
+    if (data_len > used) {
+        ESP_LOGW(TAG_NANO, "Unexpected USB RX data (%d bytes) received after FIFO read completion.", (int)(data_len - used));
+    }
+    if (pushed > 0 || complete) {
+        BaseType_t higher_task_woken = pdFALSE;
+        xSemaphoreGiveFromISR(fifo_data_ready_sem, &higher_task_woken); // One wake-up per USB packet
+    }
+}
+
+/**
+ * @brief USB Data received callback - Frames FIFO records or accumulates a register reply
  */
 static bool handle_usb_rx(const uint8_t *data, size_t data_len, void *user_arg)
 {
+    if (__atomic_load_n(&fifo_bytes_due, __ATOMIC_ACQUIRE) > 0) {
+        handle_usb_rx_fifo(data, data_len);
+        return true;
+    }
     // Check if we are expecting data for the current chunk
-    if (current_chunk_rx_count < CHUNK_EXPECTED_BYTES) {
+    const size_t expected_bytes = reply_expected_bytes;
+    if (reply_rx_count < expected_bytes) {
         size_t bytes_to_copy = data_len;
-        if (current_chunk_rx_count + bytes_to_copy > CHUNK_EXPECTED_BYTES) {
-            ESP_LOGW(TAG_NANO, "Chunk RX Overflow: Received %d, have %d, expected %d. Truncating.",
-                     (int)data_len, (int)current_chunk_rx_count, (int)CHUNK_EXPECTED_BYTES);
-            bytes_to_copy = CHUNK_EXPECTED_BYTES - current_chunk_rx_count;
+        if (reply_rx_count + bytes_to_copy > expected_bytes) {
+            ESP_LOGW(TAG_NANO, "Reply RX Overflow: Received %d, have %d, expected %d. Truncating.",
+                     (int)data_len, (int)reply_rx_count, (int)expected_bytes);
+            bytes_to_copy = expected_bytes - reply_rx_count;
         }
 
         if (bytes_to_copy > 0) {
-            memcpy(chunk_rx_buffer + current_chunk_rx_count, data, bytes_to_copy);
-            current_chunk_rx_count += bytes_to_copy;
+            memcpy(reply_rx_buffer + reply_rx_count, data, bytes_to_copy);
+            reply_rx_count += bytes_to_copy;
         }
 
-        // Check if we have received the complete CHUNK
-        if (current_chunk_rx_count >= CHUNK_EXPECTED_BYTES) {
-            // ESP_LOGD(TAG_NANO, "Complete chunk received (%d bytes).", CHUNK_EXPECTED_BYTES); // Use Debug level
+        // Check if we have received the complete reply
+        if (reply_rx_count >= expected_bytes) {
             BaseType_t higher_task_woken = pdFALSE;
             xSemaphoreGiveFromISR(fifo_data_ready_sem, &higher_task_woken);
             // No need to yield from ISR if giving to a normal task
         }
     } else {
-         ESP_LOGW(TAG_NANO, "Unexpected USB RX data (%d bytes) received after chunk completion.", (int)data_len);
+         ESP_LOGW(TAG_NANO, "Unexpected USB RX data (%d bytes) received after reply completion.", (int)data_len);
          // ESP_LOG_BUFFER_HEXDUMP(TAG_NANO, data, data_len, ESP_LOG_WARN); // Can be noisy
     }
     return true; // Consume the data regardless
@@ -172,19 +689,24 @@ static bool handle_usb_rx(const uint8_t *data, size_t data_len, void *user_arg)
  */
 static void handle_usb_event(const cdc_acm_host_dev_event_data_t *event, void *user_ctx)
 {
+    TRACE_EVENT(&trace_buffer, TRACE_TAG_USB, TRACE_LEVEL_INFO, esp_timer_get_time(), TRACE_EV_USB_EVENT, 0,
+                (uint16_t)event->type, (event->type == CDC_ACM_HOST_ERROR) ? event->data.error : 0);
     switch (event->type) {
     case CDC_ACM_HOST_DEVICE_DISCONNECTED:
         ESP_LOGW(TAG_NANO, "NanoVNA Disconnected (Event)");
         if (current_cdc_dev == event->data.cdc_hdl) { // Check if it's the device we were using
             current_cdc_dev = NULL; // Clear global handle
-             // Reset rx count in case disconnect happened mid-read
-             current_chunk_rx_count = 0;
+             // Reset rx state in case disconnect happened mid-read, and wake the reader so it fails now
+             reply_rx_count = 0;
+             __atomic_store_n(&fifo_bytes_due, 0, __ATOMIC_RELEASE);
+             xSemaphoreGive(fifo_data_ready_sem);
             // Attempt to close handle (might already be closing)
             esp_err_t close_err = cdc_acm_host_close(event->data.cdc_hdl);
             if (close_err != ESP_OK && close_err != ESP_ERR_INVALID_STATE && close_err != ESP_ERR_NOT_FOUND) {
                 ESP_LOGE(TAG_NANO, "Error closing CDC handle in disconnect event: %s", esp_err_to_name(close_err));
             }
             xSemaphoreGive(device_disconnected_sem); // Signal the main loop
+            request_queue_wake(); // Wake an idle control task so it reconnects now
         } else {
              ESP_LOGW(TAG_NANO,"Disconnect event for an unknown/different handle (%p)", event->data.cdc_hdl);
         }
@@ -194,12 +716,15 @@ static void handle_usb_event(const cdc_acm_host_dev_event_data_t *event, void *u
          // Treat error as potential disconnection? Difficult to recover reliably.
          if (current_cdc_dev == event->data.cdc_hdl) {
             current_cdc_dev = NULL;
-            current_chunk_rx_count = 0;
+            reply_rx_count = 0;
+            __atomic_store_n(&fifo_bytes_due, 0, __ATOMIC_RELEASE);
+            xSemaphoreGive(fifo_data_ready_sem);
              esp_err_t close_err = cdc_acm_host_close(event->data.cdc_hdl);
              if (close_err != ESP_OK && close_err != ESP_ERR_INVALID_STATE && close_err != ESP_ERR_NOT_FOUND) {
                  ESP_LOGE(TAG_NANO, "Error closing CDC handle on error event: %s", esp_err_to_name(close_err));
              }
             xSemaphoreGive(device_disconnected_sem);
+            request_queue_wake();
          }
          break;
     default:
@@ -209,168 +734,2632 @@ static void handle_usb_event(const cdc_acm_host_dev_event_data_t *event, void *u
 }
 
 /**
- * @brief Processes ONE chunk of received FIFO data point-by-point,
- * updating the global minimum S11 and corresponding frequency.
- * @param chunk_index The index of the current chunk (0 to NUM_CHUNKS - 1)
- * @return true if processing was successful, false on critical error (like bad index)
+ * @brief Processes one FIFO point handed over by the USB side, updating the global
+ * minimum S11 and corresponding frequency.
+ * Frequencies are derived from swept_window; freqIndex counts from fifo_index_base in it
+ * (0 unless a range of the window is being re-read).
+ * @param position Index of the point within its chunk (for the trace record of a bad index)
+ * @param rx_time_us When the point was taken off the ring; timestamps its trace record
+ * @return false if freqIndex lies outside the programmed window (the point is skipped)
+ */
+static bool process_fifo_point(const nanovna_fifo_point_t *point, int position, int64_t rx_time_us)
+{
+    const uint16_t freqIndex = (uint16_t)(fifo_index_base + point->freq_index);
+
+    // --- Use freqIndex to determine storage location and calculate frequency ---
+    if (point->freq_index >= active_sweep_window.points || freqIndex >= swept_window.points) {
+        TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_WARN, rx_time_us, TRACE_EV_POINT_BAD_INDEX, 0, point->freq_index, position);
+        return false;
+    }
+    const uint8_t seen_bit = (uint8_t)(1u << (freqIndex % 8));
+    if (swept_points_seen[freqIndex / 8] & seen_bit) {
+        return true; // Already processed (a re-read range padded to two points)
+    }
+    swept_points_seen[freqIndex / 8] |= seen_bit;
+
+    // --- Calculate Frequency from Index using the PROGRAMMED Step ---
+    // Freq = Window_Start + Index * Window_Step
+    double currentFreqHz = (double)swept_window.start_hz + (double)freqIndex * (double)swept_window.step_hz;
+
+    // --- Calculate S11 ---
+    double a = (double)point->rev_re; double b = (double)point->rev_im;
+    double c = (double)point->fwd_re; double d = (double)point->fwd_im;
+    double s11_re = 0.0, s11_im = 0.0;
+    double current_s11_mag_db = INFINITY; // Default to infinity for this point
+    bool s11_finite;
+
+    if (sol_cal_window_active) {
+        // Error-corrected S11 in place of the raw rev/fwd division (see sol_cal.h)
+        s11_finite = sol_cal_correct(&sol_cal_window.terms[freqIndex], a, b, c, d, &s11_re, &s11_im);
+    } else {
+        double denom = c * c + d * d;
+        s11_finite = (denom > 1e-12); // Check for non-zero denominator
+        if (s11_finite) {
+            s11_re = (a * c + b * d) / denom;
+            s11_im = (b * c - a * d) / denom;
+        }
+    }
+
+    if (s11_finite) {
+        if (sweep_avg_active) {
+            sweep_average_add(&sweep_avg, freqIndex, s11_re, s11_im);
+        }
+
+        // --- Calculate Magnitude (dB) ---
+        double mag_sq = s11_re * s11_re + s11_im * s11_im;
+        if (mag_sq > 1e-18) { // Avoid log10(0) for valid points
+            current_s11_mag_db = 10.0 * log10(mag_sq); // Use 10*log10(mag_sq) = 20*log10(mag)
+        } else {
+            current_s11_mag_db = -INFINITY; // Treat as perfect match or below noise floor
+        }
+    } else {
+         // Denominator near zero -> S11 is effectively infinite magnitude
+         current_s11_mag_db = INFINITY;
+         // ESP_LOGW(TAG_NANO,"S11 calculation: Near-zero denominator at freqIndex %u", freqIndex);
+    }
+
+    const int16_t current_s11_cdb = sweep_transfer_db_to_cdb(current_s11_mag_db);
+    sweep_curve_cdb[freqIndex] = current_s11_cdb;
+    sweep_curve_re[freqIndex] = s11_finite ? (float)s11_re : NAN;
+    sweep_curve_im[freqIndex] = s11_finite ? (float)s11_im : NAN;
+    uint8_t trace_flags = isfinite(current_s11_mag_db) ? 0 : TRACE_POINT_NOT_FINITE;
+
+    if (isfinite(current_s11_mag_db) && current_s11_mag_db > current_max_s11_db) {
+        current_max_s11_db = current_s11_mag_db;
+    }
+
+    // --- Update Running Minimum ---
+    // We only update if the current point's magnitude is finite and less than the minimum found so far
+    if (isfinite(current_s11_mag_db) && current_s11_mag_db < current_min_s11_db) {
+        current_min_s11_db = current_s11_mag_db;
+        freq_at_min_s11_hz = currentFreqHz;
+        trace_flags |= TRACE_POINT_NEW_MIN;
+    }
+    // Per-point record instead of a console line; "TRACE DUMP" retrieves the latest sweep
+    TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_VERBOSE, rx_time_us, TRACE_EV_POINT, trace_flags, freqIndex, current_s11_cdb);
+
+    // --- Phase calculation (optional, can be removed if not needed) ---
+    // double current_s11_phase_deg = atan2(s11_im, s11_re) * 180.0 / M_PI;
+
+    // Increment processed point counter (regardless of whether it was the minimum)
+    points_processed_count++;
+    return true;
+}
+
+// =========================================================================
+// == Sweep Programming and Execution                                     ==
+// =========================================================================
+
+/**
+ * @brief Adds one stage duration to the diagnostics histograms.
+ */
+static void latency_record(latency_stage_t stage, int64_t duration_us)
+{
+    xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+    latency_stats_record(&sweep_latency_stats, stage, duration_us);
+    xSemaphoreGive(diag_stats_mutex);
+}
+
+/**
+ * @brief Sends a command batch in one USB transfer and waits until its whole reply
+ * is in reply_rx_buffer.
+ * @param tx_done_us If not NULL, set to the esp_timer time the transfer completed
+ * @return ESP_OK, ESP_ERR_TIMEOUT if the reply did not complete, or the transfer error
+ */
+static esp_err_t nanovna_transact(const nanovna_batch_t *batch, uint32_t timeout_ms, int64_t *tx_done_us)
+{
+    if (batch->overflow || batch->reply_len > sizeof(reply_rx_buffer)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Reset receive state before sending so no reply byte can be missed
+    reply_expected_bytes = batch->reply_len;
+    reply_rx_count = 0;
+    xSemaphoreTake(fifo_data_ready_sem, 0); // Clear stale signal before waiting
+
+    esp_err_t err = cdc_acm_host_data_tx_blocking(current_cdc_dev, batch->data, batch->len, TX_TIMEOUT_MS);
+    if (tx_done_us != NULL) {
+        *tx_done_us = esp_timer_get_time();
+    }
+    if (err != ESP_OK || batch->reply_len == 0) {
+        return err;
+    }
+    if (xSemaphoreTake(fifo_data_ready_sem, pdMS_TO_TICKS(timeout_ms)) != pdTRUE ||
+        reply_rx_count < batch->reply_len) {
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Sends a READFIFO batch for `records` records. The reply bypasses reply_rx_buffer:
+ * the USB side frames it into points on fifo_point_ring (see handle_usb_rx_fifo()).
+ * @param first_index freqIndex of the first record the reply should carry
+ * @param tx_done_us Set to the esp_timer time the transfer completed
+ */
+static esp_err_t nanovna_request_fifo(const nanovna_batch_t *batch, uint16_t first_index, uint16_t records,
+                                      int64_t *tx_done_us)
+{
+    if (batch->overflow) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // No read is in flight, so the USB side's framing state can be reset from here
+    point_ring_discard(&fifo_point_ring);
+    fifo_framer_begin_read(&fifo_framer, first_index + records);
+    xSemaphoreTake(fifo_data_ready_sem, 0); // Clear stale signal before waiting
+    __atomic_store_n(&fifo_bytes_due, (uint32_t)records * NANOVNA_FIFO_RECORD_SIZE, __ATOMIC_RELEASE);
+
+    esp_err_t err = cdc_acm_host_data_tx_blocking(current_cdc_dev, batch->data, batch->len, TX_TIMEOUT_MS);
+    *tx_done_us = esp_timer_get_time();
+    if (err != ESP_OK) {
+        __atomic_store_n(&fifo_bytes_due, 0, __ATOMIC_RELEASE);
+    }
+    return err;
+}
+
+/**
+ * @brief Logs which sweep registers read back differently from what was written.
+ */
+static void nanovna_log_config_mismatch(const nanovna_sweep_config_t *want, const nanovna_sweep_config_t *got)
+{
+    ESP_LOGE(TAG_NANO, "Sweep register readback mismatch: start %" PRIu64 "/%" PRIu64 " Hz, step %" PRIu64 "/%" PRIu64
+             " Hz, points %u/%u, values/freq %u/%u (wrote/read)",
+             want->start_hz, got->start_hz, want->step_hz, got->step_hz,
+             want->points, got->points, want->values_per_freq, got->values_per_freq);
+}
+
+/**
+ * @brief Loads the hash of the last applied connect-time configuration from NVS.
+ */
+static void config_cache_load(void)
+{
+    nvs_handle_t handle;
+    if (nvs_open(CONFIG_CACHE_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return; // Nothing stored yet
+    }
+    if (nvs_get_u32(handle, CONFIG_CACHE_NVS_KEY, &applied_config_hash) == ESP_OK) {
+        ESP_LOGI(TAG_MAIN, "Last applied NanoVNA config hash: 0x%08" PRIX32, applied_config_hash);
+    }
+    nvs_close(handle);
+}
+
+/**
+ * @brief Records `hash` as the applied configuration. NVS is only written when it changes.
+ */
+static void config_cache_store(uint32_t hash)
+{
+    if (hash == applied_config_hash) {
+        return;
+    }
+    applied_config_hash = hash;
+
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(CONFIG_CACHE_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err == ESP_OK) {
+        err = nvs_set_u32(handle, CONFIG_CACHE_NVS_KEY, hash);
+        if (err == ESP_OK) {
+            err = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_NANO, "Failed to store config hash in NVS: %s", esp_err_to_name(err));
+    }
+}
+
+/**
+ * @brief Finds the journal partition and scans it, resuming after the last acknowledged
+ * record stored in NVS. Leaves journal_ready false if the partition is missing.
+ */
+static void journal_open(void)
+{
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                                (esp_partition_subtype_t)JOURNAL_PARTITION_SUBTYPE,
+                                                                JOURNAL_PARTITION_LABEL);
+    if (partition == NULL) {
+        ESP_LOGW(TAG_MAIN, "No \"%s\" partition; readings taken while disconnected are not kept.", JOURNAL_PARTITION_LABEL);
+        return;
+    }
+    uint32_t acked_seq = 0;
+    nvs_handle_t handle;
+    if (nvs_open(JOURNAL_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        nvs_get_u32(handle, JOURNAL_NVS_ACKED_KEY, &acked_seq);
+        nvs_close(handle);
+    }
+    const int64_t start_us = esp_timer_get_time();
+    esp_err_t err = result_journal_open(&result_journal, partition, acked_seq);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_MAIN, "Failed to open the result journal: %s", esp_err_to_name(err));
+        return;
+    }
+    journal_ready = true;
+    ESP_LOGI(TAG_MAIN, "Result journal: %" PRIu32 " records pending, next seq %" PRIu32 ", capacity %" PRIu32 " (scan %lld us).",
+             result_journal_pending(&result_journal), result_journal.next_seq, result_journal_capacity(&result_journal),
+             (long long)(esp_timer_get_time() - start_us));
+}
+
+/**
+ * @brief Releases journal records up to `seq` once a client has them, and persists the
+ * acknowledgement. Caller holds journal_mutex.
+ * @return false if `seq` is not a record awaiting acknowledgement
+ */
+static bool journal_ack(uint32_t seq)
+{
+    if (!result_journal_ack(&result_journal, seq)) {
+        return false;
+    }
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(JOURNAL_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err == ESP_OK) {
+        err = nvs_set_u32(handle, JOURNAL_NVS_ACKED_KEY, seq);
+        if (err == ESP_OK) {
+            err = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_BLE, "Failed to store journal acknowledgement in NVS: %s", esp_err_to_name(err));
+    }
+    return true;
+}
+
+/**
+ * @brief Loads the calibration terms stored in NVS. They correct every profile whose band
+ * lies within the calibrated one; sweeps outside it stay uncorrected.
+ */
+static void calibration_load(void)
+{
+    esp_err_t err = sol_cal_nvs_load(&sol_cal, CAL_NVS_NAMESPACE);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGI(TAG_MAIN, "No stored calibration; S11 is uncorrected.");
+        return;
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_MAIN, "Failed to load the calibration from NVS: %s", esp_err_to_name(err));
+        return;
+    }
+    ESP_LOGI(TAG_MAIN, "Loaded SOL calibration (%u points from %.6f MHz, step %.3f kHz).",
+             sol_cal.points, sol_cal.start_hz / 1e6, sol_cal.step_hz / 1e3);
+}
+
+/**
+ * @brief Starts learning the READFIFO timing afresh from the fixed deadlines.
+ */
+static void chunk_timing_start(void)
+{
+    const uint32_t chunk_timing_defaults_us[CHUNK_TIMING_COUNT] = {
+        [CHUNK_TIMING_FIRST_POINT] = RX_CHUNK_FIRST_POINT_TIMEOUT_MS * 1000,
+        [CHUNK_TIMING_PACKET_GAP] = RX_CHUNK_IDLE_TIMEOUT_MS * 1000,
+    };
+    chunk_timing_init(&chunk_timing, chunk_timing_defaults_us, RX_CHUNK_TIMEOUT_FLOOR_MS * 1000);
+}
+
+/**
+ * @brief Loads the settings of profile `index` for the next sweeps (NanoVNA task, or before
+ * it starts). The registers follow with the next sweep. Tracking re-acquires on the new band,
+ * and standards measured for a calibration not yet saved are dropped with the old one.
+ * @return false if there is no such profile
+ */
+static bool sweep_profile_apply(uint8_t index)
+{
+    xSemaphoreTake(sweep_profiles_mutex, portMAX_DELAY);
+    const bool found = (index < sweep_profiles.count);
+    const sweep_profile_t profile = found ? sweep_profiles.entries[index] : (sweep_profile_t){ 0 };
+    xSemaphoreGive(sweep_profiles_mutex);
+    if (!found) {
+        ESP_LOGW(TAG_NANO, "No sweep profile %u; keeping the current one.", index);
+        return false;
+    }
+
+    if (profile.values_per_freq != sweep_values_per_freq) {
+        // The first-point latency is learned per record, and each record now takes longer or shorter
+        xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+        chunk_timing_start();
+        xSemaphoreGive(diag_stats_mutex);
+    }
+    full_sweep_window = (sweep_window_t){ .start_hz = profile.start_hz, .step_hz = profile.step_hz, .points = profile.points };
+    sweep_values_per_freq = profile.values_per_freq;
+    sweep_chunk_points = profile.chunk_points;
+    tracking_locked = false;
+    if (cal_capture != NULL) {
+        free(cal_capture);
+        cal_capture = NULL;
+        ESP_LOGW(TAG_NANO, "Calibration standards measured on the previous band dropped; measure them again.");
+    }
+    applied_profile = index;
+    ESP_LOGI(TAG_NANO, "Sweep profile %u \"%s\": %u points from %.6f MHz, step %.3f kHz, %u values per point, %u-point chunks.",
+             index, profile.name, profile.points, profile.start_hz / 1e6, profile.step_hz / 1e3,
+             profile.values_per_freq, profile.chunk_points);
+    return true;
+}
+
+/**
+ * @brief Makes sure the next sweep is taken with profile `index`: a request queued before a
+ * profile switch is still served with the profile it was made under.
+ */
+static void sweep_profile_use(uint8_t index)
+{
+    if (index != applied_profile) {
+        sweep_profile_apply(index);
+    }
+}
+
+/**
+ * @brief Applies the profile selected over BLE since the last reading, if any, and makes it
+ * the one used after a reboot.
+ */
+static void sweep_profile_apply_requested(void)
+{
+    const uint8_t index = __atomic_exchange_n(&profile_requested, SWEEP_PROFILE_NONE, __ATOMIC_ACQ_REL);
+    if (index == SWEEP_PROFILE_NONE || !sweep_profile_apply(index)) {
+        return;
+    }
+    __atomic_store_n(&active_profile, index, __ATOMIC_RELEASE);
+    esp_err_t err = sweep_profile_nvs_store(NULL, index, SWEEP_PROFILE_NVS_NAMESPACE);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_NANO, "Failed to store the active sweep profile in NVS: %s", esp_err_to_name(err));
+    }
+}
+
+/**
+ * @brief Loads the sweep profiles stored in NVS, storing the defaults on first boot, and
+ * applies the active one.
+ */
+static void sweep_profiles_load(void)
+{
+    const size_t default_count = sizeof(default_sweep_profiles) / sizeof(default_sweep_profiles[0]);
+    uint8_t active = SWEEP_PROFILE_DEFAULT_ACTIVE;
+    sweep_profiles.count = (uint8_t)default_count;
+    memcpy(sweep_profiles.entries, default_sweep_profiles, sizeof(default_sweep_profiles));
+
+    esp_err_t err = sweep_profile_nvs_load(&sweep_profiles, &active, SWEEP_PROFILE_NVS_NAMESPACE, &sweep_profile_limits);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        err = sweep_profile_nvs_store(&sweep_profiles, active, SWEEP_PROFILE_NVS_NAMESPACE);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG_MAIN, "Failed to store the default sweep profiles in NVS: %s", esp_err_to_name(err));
+        } else {
+            ESP_LOGI(TAG_MAIN, "Stored the %u default sweep profiles.", sweep_profiles.count);
+        }
+    } else if (err != ESP_OK) {
+        ESP_LOGW(TAG_MAIN, "Stored sweep profiles unusable (%s); using the defaults.", esp_err_to_name(err));
+    } else {
+        ESP_LOGI(TAG_MAIN, "Loaded %u sweep profiles.", sweep_profiles.count);
+    }
+    if (sweep_profile_apply(active)) {
+        __atomic_store_n(&active_profile, active, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief Opens the NanoVNA with the receive buffer size a past "USB TUNE" found, if any.
+ * The tuned chunk size is already in the active profile.
+ */
+static void usb_tune_load(void)
+{
+    usb_tune_config_t tuned;
+    esp_err_t err = usb_tune_nvs_load(&tuned, USB_TUNE_NVS_NAMESPACE);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        return;
+    }
+    if (err != ESP_OK || tuned.rx_buffer_size < RX_BUFFER_SIZE_MIN || tuned.rx_buffer_size > RX_BUFFER_SIZE) {
+        ESP_LOGW(TAG_MAIN, "Stored USB tuning unusable (%s); using a %d-byte receive buffer.",
+                 err != ESP_OK ? esp_err_to_name(err) : "size out of range", RX_BUFFER_SIZE);
+        return;
+    }
+    usb_rx_buffer_size = tuned.rx_buffer_size;
+    ESP_LOGI(TAG_MAIN, "Tuned USB receive buffer: %u bytes.", usb_rx_buffer_size);
+}
+
+/**
+ * @brief Resynchronises the NanoVNA's command parser and reads its sweep registers back.
+ * Registers survive a USB glitch while the NanoVNA stays powered, so only those that
+ * differ from the full sweep configuration are rewritten (and verified).
+ * The INDICATE reply replaces a fixed settle delay after DTR/RTS.
+ * @param kept window the NanoVNA was left with before a suspend, or NULL. Registers that
+ *             still hold it are kept as they are, so the next sweep needs no reprogramming.
+ * @return true if the NanoVNA holds the full sweep window, or `kept`
+ */
+static bool nanovna_configure_on_connect(const sweep_window_t *kept)
+{
+    const nanovna_sweep_config_t config = {
+        .start_hz = full_sweep_window.start_hz,
+        .step_hz = full_sweep_window.step_hz,
+        .points = full_sweep_window.points,
+        .values_per_freq = sweep_values_per_freq,
+    };
+    nanovna_sweep_config_t kept_config = config;
+    if (kept != NULL) {
+        kept_config.start_hz = kept->start_hz;
+        kept_config.step_hz = kept->step_hz;
+        kept_config.points = kept->points;
+    }
+    const uint32_t config_hash = nanovna_sweep_config_hash(&config);
+    active_sweep_window_valid = false; // Registers unknown after (re)connect
+
+    for (int attempt = 1; attempt <= NANOVNA_SYNC_ATTEMPTS; ++attempt) {
+        nanovna_batch_t batch;
+        nanovna_batch_init(&batch);
+        nanovna_batch_sync(&batch);
+        nanovna_batch_sweep_readback(&batch);
+
+        esp_err_t err = nanovna_transact(&batch, NANOVNA_REPLY_TIMEOUT_MS, NULL);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG_NANO, "Configuration attempt %d/%d failed: %s", attempt, NANOVNA_SYNC_ATTEMPTS, esp_err_to_name(err));
+            continue;
+        }
+        if (reply_rx_buffer[0] != NANOVNA_INDICATE_REPLY) {
+            ESP_LOGW(TAG_NANO, "Configuration attempt %d/%d: unexpected INDICATE reply 0x%02x",
+                     attempt, NANOVNA_SYNC_ATTEMPTS, reply_rx_buffer[0]);
+            continue;
+        }
+        nanovna_sweep_config_t device;
+        nanovna_parse_sweep_readback(reply_rx_buffer + 1, &device);
+        const uint32_t device_hash = nanovna_sweep_config_hash(&device);
+
+        if (kept != NULL && nanovna_sweep_config_equal(&kept_config, &device)) {
+            ESP_LOGI(TAG_NANO, "NanoVNA kept its %u-point window while suspended; nothing to reprogram.", kept->points);
+            active_sweep_window = *kept;
+            active_values_per_freq = kept_config.values_per_freq;
+            active_sweep_window_valid = true;
+            return true;
+        }
+        if (device_hash == config_hash && nanovna_sweep_config_equal(&config, &device)) {
+            ESP_LOGI(TAG_NANO, "NanoVNA already configured (hash 0x%08" PRIX32 "); skipping reprogramming.", config_hash);
+        } else {
+            // Tells a power-cycled/foreign-configured NanoVNA apart from a firmware config change
+            ESP_LOGI(TAG_NANO, "NanoVNA config hash 0x%08" PRIX32 " (last applied 0x%08" PRIX32 ", wanted 0x%08" PRIX32 "); reprogramming.",
+                     device_hash, applied_config_hash, config_hash);
+            nanovna_batch_init(&batch);
+            nanovna_batch_sweep_config(&batch, &config, &device);
+            nanovna_batch_sweep_readback(&batch);
+            err = nanovna_transact(&batch, NANOVNA_REPLY_TIMEOUT_MS, NULL);
+            if (err != ESP_OK) {
+                ESP_LOGW(TAG_NANO, "Configuration attempt %d/%d failed: %s", attempt, NANOVNA_SYNC_ATTEMPTS, esp_err_to_name(err));
+                continue;
+            }
+            nanovna_parse_sweep_readback(reply_rx_buffer, &device);
+            if (!nanovna_sweep_config_equal(&config, &device)) {
+                nanovna_log_config_mismatch(&config, &device);
+                continue;
+            }
+        }
+
+        config_cache_store(config_hash);
+        active_sweep_window = full_sweep_window;
+        active_values_per_freq = config.values_per_freq;
+        active_sweep_window_valid = true;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Programs sweepStartHz / sweepStepHz / sweepPoints, and valuesPerFrequency of the
+ * active profile, skipping registers that already match, and optionally clears the FIFO,
+ * all in one transfer. Written registers are verified by reading them back in the same
+ * transfer.
+ * @return true if the NanoVNA now holds the requested window
+ */
+static bool nanovna_program_sweep_window(const sweep_window_t *window, bool clear_fifo)
+{
+    const nanovna_sweep_config_t config = {
+        .start_hz = window->start_hz,
+        .step_hz = window->step_hz,
+        .points = window->points,
+        .values_per_freq = sweep_values_per_freq,
+    };
+    const nanovna_sweep_config_t current = {
+        .start_hz = active_sweep_window.start_hz,
+        .step_hz = active_sweep_window.step_hz,
+        .points = active_sweep_window.points,
+        .values_per_freq = active_values_per_freq,
+    };
+
+    nanovna_batch_t batch;
+    nanovna_batch_init(&batch);
+    const int written = nanovna_batch_sweep_config(&batch, &config, active_sweep_window_valid ? &current : NULL);
+    if (clear_fifo) {
+        nanovna_batch_clear_fifo(&batch);
+    }
+    if (written > 0) {
+        nanovna_batch_sweep_readback(&batch); // Answered only after the writes are applied
+        active_sweep_window_valid = false;    // Invalid until the readback matches
+    }
+    if (batch.len == 0) {
+        return true;
+    }
+
+    esp_err_t err = nanovna_transact(&batch, NANOVNA_REPLY_TIMEOUT_MS, NULL);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_NANO, "Failed to program sweep window: %s", esp_err_to_name(err));
+        return false;
+    }
+    if (written > 0) {
+        nanovna_sweep_config_t readback;
+        nanovna_parse_sweep_readback(reply_rx_buffer, &readback);
+        if (!nanovna_sweep_config_equal(&config, &readback)) {
+            nanovna_log_config_mismatch(&config, &readback);
+            return false;
+        }
+    }
+
+    active_sweep_window = *window;
+    active_values_per_freq = config.values_per_freq;
+    active_sweep_window_valid = true;
+    return true;
+}
+
+/**
+ * @brief Builds a window of `points` at `step_hz` centred on `centre_hz`, clamped to the configured band.
+ */
+static sweep_window_t sweep_window_centred(uint64_t centre_hz, uint16_t points, uint64_t step_hz)
+{
+    const uint64_t band_start_hz = full_sweep_window.start_hz;
+    const uint64_t band_stop_hz = full_sweep_window.start_hz + (uint64_t)(full_sweep_window.points - 1) * full_sweep_window.step_hz;
+    const uint64_t span_hz = (uint64_t)(points - 1) * step_hz;
+
+    uint64_t start_hz = (centre_hz > band_start_hz + span_hz / 2) ? centre_hz - span_hz / 2 : band_start_hz;
+    if (start_hz + span_hz > band_stop_hz) {
+        start_hz = (band_stop_hz > band_start_hz + span_hz) ? band_stop_hz - span_hz : band_start_hz;
+    }
+
+    sweep_window_t window = { .start_hz = start_hz, .step_hz = step_hz, .points = points };
+    return window;
+}
+
+/**
+ * @brief Converts a deadline to ticks, rounding up and counting the partial current tick,
+ * so short learned deadlines never become zero.
+ */
+static TickType_t deadline_us_to_ticks(uint32_t deadline_us)
+{
+    return (TickType_t)(((uint64_t)deadline_us * configTICK_RATE_HZ + 999999) / 1000000) + 1;
+}
+
+typedef struct {
+    int received;            // Points handed over
+    int bad_index_count;     // Of which outside the programmed window
+    bool stalled;            // Points stopped before the reply was complete
+    int64_t tx_start_us;     // READFIFO transfer started
+    int64_t tx_done_us;      // READFIFO transfer completed
+    int64_t rx_time_us;      // Last wake-up (the chunk's last point, or the deadline)
+    int64_t first_point_us;  // READFIFO sent -> first point (-1: none)
+    int64_t max_gap_us;      // Longest wait between points
+} chunk_read_t;
+
+/**
+ * @brief Sends one READFIFO for `chunk_values` records starting at `first_index` and
+ * processes its points as they arrive. The first point must arrive within
+ * `first_deadline_us`; after that a gap longer than the learned packet-gap deadline
+ * ends the chunk as stalled.
+ * @return ESP_ERR_TIMEOUT if no point arrived in time, or the transfer/disconnect error
+ */
+static esp_err_t read_chunk_once(uint16_t first_index, int chunk_values, uint32_t first_deadline_us, chunk_read_t *rx)
+{
+    // NOTE: NanoVNA expects number of POINTS for READFIFO, not bytes.
+    nanovna_batch_t batch;
+    nanovna_batch_init(&batch);
+    nanovna_batch_read_fifo(&batch, (uint16_t)chunk_values);
+
+    // Send the command, then process points as the USB side hands them over
+    rx->tx_start_us = esp_timer_get_time();
+    esp_err_t err = nanovna_request_fifo(&batch, first_index, (uint16_t)chunk_values, &rx->tx_done_us);
+    const uint32_t gap_deadline_us = chunk_timing_deadline_us(&chunk_timing, CHUNK_TIMING_PACKET_GAP, 1);
+    TickType_t deadline = xTaskGetTickCount() + deadline_us_to_ticks(first_deadline_us);
+    int64_t last_point_us = rx->tx_done_us;
+    bool waited = true;
+    rx->rx_time_us = rx->tx_done_us;
+    rx->received = 0;
+    rx->bad_index_count = 0;
+    rx->stalled = false;
+    rx->first_point_us = -1;
+    rx->max_gap_us = 0;
+    while (err == ESP_OK && rx->received < chunk_values) {
+        // Read before popping: every point of a complete reply is on the ring by then
+        const bool reply_complete = (__atomic_load_n(&fifo_bytes_due, __ATOMIC_ACQUIRE) == 0);
+        nanovna_fifo_point_t point;
+        if (point_ring_pop(&fifo_point_ring, &point)) {
+            if (waited) {
+                // First point of a USB packet: one arrival-time sample
+                if (rx->received == 0) {
+                    rx->first_point_us = rx->rx_time_us - rx->tx_done_us;
+                } else if (rx->rx_time_us - last_point_us > rx->max_gap_us) {
+                    rx->max_gap_us = rx->rx_time_us - last_point_us;
+                }
+                last_point_us = rx->rx_time_us;
+                waited = false;
+            }
+            rx->bad_index_count += !process_fifo_point(&point, rx->received, rx->rx_time_us);
+            rx->received++;
+            // Points are flowing: from here a stall ends the chunk instead of failing the sweep
+            deadline = xTaskGetTickCount() + deadline_us_to_ticks(gap_deadline_us);
+            continue;
+        }
+        if (reply_complete) {
+            break; // Whole reply framed; records it lacked are re-read afterwards
+        }
+        // Ring drained: wait for the next USB packet of this chunk
+        const TickType_t now = xTaskGetTickCount();
+        if ((int32_t)(deadline - now) <= 0 || xSemaphoreTake(fifo_data_ready_sem, deadline - now) != pdTRUE) {
+            if (rx->received > 0) {
+                rx->stalled = true;
+                break;
+            }
+            err = ESP_ERR_TIMEOUT;
+        } else if (current_cdc_dev == NULL) {
+            err = ESP_ERR_INVALID_STATE;
+        }
+        rx->rx_time_us = esp_timer_get_time();
+        waited = true;
+    }
+    if (err != ESP_OK || rx->stalled) {
+        __atomic_store_n(&fifo_bytes_due, 0, __ATOMIC_RELEASE); // Late bytes are reported, not framed
+    }
+    return err;
+}
+
+/**
+ * @brief Reads every point of the programmed window in chunks, processing points as they
+ * arrive. A chunk that comes up short (records lost to a resync, or a stall once points
+ * were flowing) is not an error: the points it lacked are re-read afterwards. A chunk
+ * whose first point misses its learned deadline is requested once more.
+ * @param index_base Index in swept_window of the programmed window's first point
+ * @return false if the device disconnected, a READFIFO could not be sent or a chunk
+ *         produced no points even when retried
+ */
+static bool read_programmed_window(uint16_t index_base)
+{
+    const uint16_t points = active_sweep_window.points;
+    const int chunk_points = sweep_chunk_points;
+    const int num_chunks = (points + chunk_points - 1) / chunk_points;
+    fifo_index_base = index_base;
+    fifo_framer_reset(&fifo_framer, points); // The FIFO was just cleared: records start at index 0
+
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        // Check if device disconnected during multi-chunk read
+        if (current_cdc_dev == NULL) {
+            ESP_LOGW(TAG_NANO,"Device disconnected during chunk read (%d/%d).", chunk + 1, num_chunks);
+            return false;
+        }
+
+        // Last chunk may be short when the window is not a multiple of the chunk size
+        const int remaining = points - chunk * chunk_points;
+        const int chunk_values = (remaining < chunk_points) ? remaining : chunk_points;
+        ESP_LOGD(TAG_NANO, "Requesting Chunk %d/%d (%d points)...", chunk + 1, num_chunks, chunk_values);
+
+        const uint32_t first_deadline_us = chunk_timing_deadline_us(&chunk_timing, CHUNK_TIMING_FIRST_POINT, (uint16_t)chunk_values);
+        chunk_read_t rx;
+        esp_err_t err = read_chunk_once((uint16_t)(chunk * chunk_points), chunk_values, first_deadline_us, &rx);
+        bool retried = false;
+        if (err == ESP_ERR_TIMEOUT) {
+            // Fail fast, then give the NanoVNA one more, longer, chance before failing the sweep
+            ESP_LOGW(TAG_NANO, "No point of chunk %d within %lu us; retrying once.", chunk + 1, (unsigned long)first_deadline_us);
+            retried = true;
+            err = read_chunk_once((uint16_t)(chunk * chunk_points), chunk_values,
+                                  first_deadline_us * RX_CHUNK_RETRY_BACKOFF, &rx);
+        }
+
+        xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+        if (rx.first_point_us >= 0) {
+            chunk_timing_add(&chunk_timing, CHUNK_TIMING_FIRST_POINT, rx.first_point_us, (uint16_t)chunk_values);
+        }
+        if (rx.received > 1) {
+            chunk_timing_add(&chunk_timing, CHUNK_TIMING_PACKET_GAP, rx.max_gap_us, 1);
+        }
+        chunk_timing.timeouts += retried;
+        chunk_timing.retries_ok += (retried && err == ESP_OK);
+        chunk_timing.stalls += rx.stalled;
+        xSemaphoreGive(diag_stats_mutex);
+
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG_NANO, "READFIFO for chunk %d failed (%s). Got %d/%d points.",
+                     chunk + 1, esp_err_to_name(err), rx.received, chunk_values);
+            return false;
+        }
+        if (rx.stalled) {
+            ESP_LOGW(TAG_NANO, "Chunk %d stalled after %d/%d points; the rest will be re-read.", chunk + 1, rx.received, chunk_values);
+        } else if (rx.received < chunk_values) {
+            ESP_LOGW(TAG_NANO, "Chunk %d: %d/%d records framed (stream resynchronised); the rest will be re-read.",
+                     chunk + 1, rx.received, chunk_values);
+        }
+        if (rx.bad_index_count > 0) {
+            ESP_LOGW(TAG_NANO, "Skipped %d points with freqIndex outside 0-%d in chunk %d.",
+                     rx.bad_index_count, points - 1, chunk + 1);
+        }
+        const int64_t processed_us = esp_timer_get_time();
+        ESP_LOGD(TAG_NANO, "Chunk %d processed (%d points).", chunk + 1, rx.received);
+        TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_DEBUG, rx.rx_time_us, TRACE_EV_CHUNK, 0,
+                    (uint16_t)chunk, (int32_t)(rx.received * NANOVNA_FIFO_RECORD_SIZE));
+        latency_record(LATENCY_STAGE_CHUNK_TX, rx.tx_done_us - rx.tx_start_us);
+        latency_record(LATENCY_STAGE_CHUNK_RX, rx.rx_time_us - rx.tx_done_us);
+        latency_record(LATENCY_STAGE_CHUNK_PROCESS, processed_us - rx.rx_time_us);
+    }
+    return true;
+}
+
+/**
+ * @brief Re-reads the points of swept_window that never arrived, one contiguous range at a
+ * time: each range is programmed as a window of its own, so only its points are swept again.
+ * A range whose re-read comes up short again counts as another re-read.
+ * @return true once every point has been processed
+ */
+static bool reread_missing_points(void)
+{
+    const sweep_window_t window = swept_window;
+    uint16_t first = 0;
+    for (int reread = 0; ; ++reread) {
+        while (first < window.points && (swept_points_seen[first / 8] & (1u << (first % 8)))) {
+            first++;
+        }
+        if (first == window.points) {
+            return true;
+        }
+        if (reread == FIFO_MAX_REREADS) {
+            ESP_LOGE(TAG_NANO, "Points still missing after %d re-reads; giving up on the sweep.", FIFO_MAX_REREADS);
+            return false;
+        }
+        uint16_t end = first + 1;
+        while (end < window.points && !(swept_points_seen[end / 8] & (1u << (end % 8)))) {
+            end++;
+        }
+        const uint16_t missing = end - first;
+        // A sweep needs two points: pad a single missing one with a neighbour (processed once only)
+        uint16_t range_first = first;
+        uint16_t range_end = end;
+        if (range_end - range_first < 2) {
+            if (range_end < window.points) {
+                range_end++;
+            } else {
+                range_first--;
+            }
+        }
+        const sweep_window_t range = {
+            .start_hz = window.start_hz + (uint64_t)range_first * window.step_hz,
+            .step_hz = window.step_hz,
+            .points = range_end - range_first,
+        };
+        ESP_LOGW(TAG_NANO, "Re-reading %u missing points from index %u.", missing, first);
+        TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_WARN, esp_timer_get_time(), TRACE_EV_FIFO_REREAD, 0,
+                    first, missing);
+        if (!nanovna_program_sweep_window(&range, true) || !read_programmed_window(range_first)) {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Programs `window` (if needed), clears the FIFO and reads every point in chunks,
+ * updating the running minimum S11 as chunks arrive. Points lost on the way are re-read.
+ * @return true if every point of the window was received and processed
+ */
+static bool perform_sweep(const sweep_window_t *window)
+{
+    // --- RESET stream processing state for this sweep ---
+    current_min_s11_db = INFINITY;
+    freq_at_min_s11_hz = 0.0;
+    current_max_s11_db = -INFINITY;
+    points_processed_count = 0;
+    swept_window = *window;
+    memset(swept_points_seen, 0, sizeof(swept_points_seen));
+    if (sweep_avg_active) {
+        sweep_average_begin(&sweep_avg, window->start_hz, window->step_hz, window->points);
+    }
+    // Terms are interpolated onto a window once; repeated sweeps of it reuse them
+    sol_cal_window_active = !cal_bypass &&
+        sol_cal_window_prepare(&sol_cal, &sol_cal_window, window->start_hz, window->step_hz, window->points);
+    // ----------------------------------------------------
+
+    // Window registers (if changed) and the FIFO clear go out in one transfer
+    const int64_t program_start_us = esp_timer_get_time();
+    if (!nanovna_program_sweep_window(window, true)) {
+        return false;
+    }
+    latency_record(LATENCY_STAGE_PROGRAM, esp_timer_get_time() - program_start_us);
+
+    ESP_LOGI(TAG_NANO, "Sweeping %u points from %.6f MHz, step %.3f kHz, in %d chunks...",
+             window->points, window->start_hz / 1e6, window->step_hz / 1e3, (window->points + sweep_chunk_points - 1) / sweep_chunk_points);
+    TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_DEBUG, esp_timer_get_time(), TRACE_EV_SWEEP_START, 0,
+                window->points, (int32_t)(window->start_hz / 1000));
+
+    bool complete = read_programmed_window(0);
+    if (complete && points_processed_count < window->points) {
+        complete = reread_missing_points();
+    }
+    TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_DEBUG, esp_timer_get_time(), TRACE_EV_SWEEP_END,
+                complete ? TRACE_SWEEP_OK : 0, (uint16_t)points_processed_count,
+                isfinite(current_min_s11_db) ? sweep_transfer_db_to_cdb(current_min_s11_db) : 0);
+    return complete;
+}
+
+/**
+ * @brief Two-stage sweep: a sparse pass over the whole band locates the dip, then a
+ * dense pass at full resolution (the active profile's step) is taken around it.
+ * On return the running minimum holds the fine-stage result.
+ * @param total_points_acquired Set to the number of points read across both stages
+ * @return true if both stages completed
+ */
+static bool perform_coarse_fine_sweep(int *total_points_acquired)
+{
+    const uint16_t n_coarse = coarse_sweep_points;
+    const uint16_t n_fine = fine_sweep_points;
+    const uint64_t band_span_hz = (uint64_t)(full_sweep_window.points - 1) * full_sweep_window.step_hz;
+
+    *total_points_acquired = 0;
+
+    // --- Stage 1: coarse sweep across the configured band ---
+    const sweep_window_t coarse_window = {
+        .start_hz = full_sweep_window.start_hz,
+        .step_hz  = band_span_hz / (n_coarse - 1),
+        .points   = n_coarse,
+    };
+    bool ok = perform_sweep(&coarse_window);
+    *total_points_acquired += points_processed_count;
+    if (!ok || !isfinite(current_min_s11_db)) {
+        ESP_LOGE(TAG_NANO, "Coarse stage failed (%d/%u pts).", (int)points_processed_count, n_coarse);
+        return false;
+    }
+    ESP_LOGI(TAG_NANO, "Coarse dip: %.4f dB at %.6f MHz", current_min_s11_db, freq_at_min_s11_hz / 1e6);
+
+    // --- Stage 2: fine sweep at full resolution around the coarse dip ---
+    const sweep_window_t fine_window = sweep_window_centred((uint64_t)freq_at_min_s11_hz, n_fine, full_sweep_window.step_hz);
+    ok = perform_sweep(&fine_window);
+    *total_points_acquired += points_processed_count;
+    return ok;
+}
+
+/**
+ * @brief Full sweep used to (re)acquire the resonance for tracking mode.
+ */
+static bool tracking_acquire(int *total_points_acquired)
+{
+    ESP_LOGI(TAG_NANO, "Tracking: acquiring resonance with a full sweep...");
+    bool ok = perform_sweep(&full_sweep_window);
+    *total_points_acquired += points_processed_count;
+    if (ok && isfinite(current_min_s11_db)) {
+        tracked_resonance_hz = (uint64_t)freq_at_min_s11_hz;
+        tracking_locked = true;
+        ESP_LOGI(TAG_NANO, "Tracking: locked at %.6f MHz", tracked_resonance_hz / 1e6);
+    }
+    return ok;
+}
+
+/**
+ * @brief Tracking sweep: a narrow full-resolution window centred on the previous resonance.
+ * The window doubles (up to TRACKING_WINDOW_POINTS_MAX) while the minimum lands on an edge;
+ * if that fails, or the window no longer contains a dip, lock is dropped and a full sweep
+ * re-acquires it. On return the running minimum holds the result.
+ * @param total_points_acquired Set to the number of points read across all passes
+ * @return true if a sweep completed
+ */
+static bool perform_tracking_sweep(int *total_points_acquired)
+{
+    *total_points_acquired = 0;
+    if (!tracking_locked) {
+        return tracking_acquire(total_points_acquired);
+    }
+
+    const uint64_t band_start_hz = full_sweep_window.start_hz;
+    const uint64_t band_stop_hz = full_sweep_window.start_hz + (uint64_t)(full_sweep_window.points - 1) * full_sweep_window.step_hz;
+    uint16_t points = tracking_window_points;
+
+    while (true) {
+        const sweep_window_t window = sweep_window_centred(tracked_resonance_hz, points, full_sweep_window.step_hz);
+        const uint64_t window_stop_hz = window.start_hz + (uint64_t)(window.points - 1) * window.step_hz;
+
+        bool ok = perform_sweep(&window);
+        *total_points_acquired += points_processed_count;
+        if (!ok) {
+            return false; // Read failure, not a tracking failure: keep the lock for the next trigger
+        }
+
+        if (!isfinite(current_min_s11_db) || current_max_s11_db - current_min_s11_db < TRACKING_MIN_DIP_DB) {
+            ESP_LOGW(TAG_NANO, "Tracking: no dip within %.6f-%.6f MHz, lock lost.", window.start_hz / 1e6, window_stop_hz / 1e6);
+            break;
+        }
+
+        // An edge minimum is genuine only where the window already sits on the band edge
+        const int min_index = (int)llround((freq_at_min_s11_hz - (double)window.start_hz) / (double)window.step_hz);
+        const bool on_low_edge = min_index < TRACKING_EDGE_POINTS && window.start_hz > band_start_hz;
+        const bool on_high_edge = min_index >= window.points - TRACKING_EDGE_POINTS && window_stop_hz < band_stop_hz;
+
+        tracked_resonance_hz = (uint64_t)freq_at_min_s11_hz;
+        if (!on_low_edge && !on_high_edge) {
+            ESP_LOGI(TAG_NANO, "Tracking: resonance at %.6f MHz (%u point window)", tracked_resonance_hz / 1e6, points);
+            return true;
+        }
+
+        if (points >= TRACKING_WINDOW_POINTS_MAX) {
+            ESP_LOGW(TAG_NANO, "Tracking: minimum still on window edge at %u points, lock lost.", points);
+            break;
+        }
+        points = (points * 2 > TRACKING_WINDOW_POINTS_MAX) ? TRACKING_WINDOW_POINTS_MAX : points * 2;
+        ESP_LOGI(TAG_NANO, "Tracking: minimum on window edge, widening to %u points around %.6f MHz", points, tracked_resonance_hz / 1e6);
+    }
+
+    // --- Loss of lock: fall back to a full sweep ---
+    tracking_locked = false;
+    return tracking_acquire(total_points_acquired);
+}
+
+/**
+ * @brief One reading in `mode` without averaging.
+ * @param total_points_acquired Set to the number of points read across all passes
+ */
+static bool perform_mode_sweep(sweep_mode_t mode, int *total_points_acquired)
+{
+    if (mode == SWEEP_MODE_COARSE_FINE) {
+        return perform_coarse_fine_sweep(total_points_acquired);
+    }
+    if (mode == SWEEP_MODE_TRACKING) {
+        return perform_tracking_sweep(total_points_acquired);
+    }
+    bool ok = perform_sweep(&full_sweep_window);
+    *total_points_acquired = points_processed_count;
+    return ok;
+}
+
+/**
+ * @brief One reading in `mode` averaged over `sweeps` sweeps: the mode's own sweep settles
+ * the window, then sweeps - 1 more of that window follow back to back. Points are averaged
+ * as they are processed. On return the running minimum and the sweep curve hold the
+ * averaged result.
+ * @param sweeps_done Set to the sweeps combined into the result (1 without averaging)
+ * @param noise_db Set to sweep_average_noise_db() of the window, NAN without averaging
+ * @return true if every sweep completed
+ */
+static bool perform_averaged_sweep(sweep_mode_t mode, uint8_t sweeps, int *total_points_acquired,
+                                   uint8_t *sweeps_done, double *noise_db)
+{
+    *sweeps_done = 1;
+    *noise_db = NAN;
+    sweep_average_reset(&sweep_avg);
+    sweep_avg_active = (sweeps > 1);
+    bool ok = perform_mode_sweep(mode, total_points_acquired);
+    const sweep_window_t window = swept_window;
+    for (uint8_t k = 1; ok && k < sweeps; ++k) {
+        ok = perform_sweep(&window); // Same window: only the FIFO clear goes out
+        *total_points_acquired += points_processed_count;
+    }
+    sweep_avg_active = false;
+    if (!ok || sweeps < 2) {
+        return ok;
+    }
+
+    // The averaged curve's minimum replaces the last sweep's
+    current_min_s11_db = INFINITY;
+    current_max_s11_db = -INFINITY;
+    freq_at_min_s11_hz = 0.0;
+    for (uint16_t i = 0; i < window.points; ++i) {
+        const double s11_db = sweep_average_db(&sweep_avg, i);
+        sweep_curve_cdb[i] = sweep_transfer_db_to_cdb(s11_db);
+        sweep_curve_re[i] = (sweep_avg.count[i] > 0) ? sweep_avg.mean_re[i] : NAN;
+        sweep_curve_im[i] = (sweep_avg.count[i] > 0) ? sweep_avg.mean_im[i] : NAN;
+        // A point is in the averaged curve if any sweep got it, not only the last one
+        if (sweep_avg.count[i] > 0) {
+            swept_points_seen[i / 8] |= (uint8_t)(1u << (i % 8));
+        }
+        if (!isfinite(s11_db)) {
+            continue;
+        }
+        if (s11_db > current_max_s11_db) {
+            current_max_s11_db = s11_db;
+        }
+        if (s11_db < current_min_s11_db) {
+            current_min_s11_db = s11_db;
+            freq_at_min_s11_hz = (double)window.start_hz + (double)i * (double)window.step_hz;
+        }
+    }
+    if (mode == SWEEP_MODE_TRACKING && tracking_locked && isfinite(current_min_s11_db)) {
+        tracked_resonance_hz = (uint64_t)freq_at_min_s11_hz; // Track from the less noisy estimate
+    }
+    *sweeps_done = sweep_avg.sweeps;
+    *noise_db = sweep_average_noise_db(&sweep_avg);
+    ESP_LOGI(TAG_NANO, "Averaged %u sweeps of %u points: noise %.2f dB.", sweep_avg.sweeps, window.points, *noise_db);
+    return true;
+}
+
+/**
+ * @brief Lists the most prominent dips of the last swept window in `frame`, from the curve
+ * the sweep (or the average) left in sweep_curve_cdb.
+ */
+static void find_dips(result_frame_t *frame)
+{
+    dip_t dips[RESULT_FRAME_MAX_DIPS];
+    const int64_t start_us = esp_timer_get_time();
+    const size_t found = dip_detect_find(sweep_curve_cdb, swept_window.points, dip_min_prominence_cdb, dips, dip_count);
+    const int64_t elapsed_us = esp_timer_get_time() - start_us;
+    for (size_t i = 0; i < found; ++i) {
+        const double width_khz = (double)dips[i].width_points * (double)swept_window.step_hz / 1e3;
+        result_frame_dip_t *dip = &frame->dips[i];
+        dip->resonance_hz = (uint32_t)(swept_window.start_hz + (uint64_t)dips[i].index * swept_window.step_hz);
+        dip->s11_cdb = dips[i].s11_cdb;
+        dip->prominence_cdb = dips[i].prominence_cdb;
+        dip->width_khz = (width_khz >= UINT16_MAX) ? UINT16_MAX : (uint16_t)lround(width_khz);
+        ESP_LOGI(TAG_NANO, "  Dip %u: %.6f MHz, %.2f dB, prominence %.2f dB, width %u kHz", (unsigned)(i + 1),
+                 dip->resonance_hz / 1e6, dip->s11_cdb / 100.0, dip->prominence_cdb / 100.0, dip->width_khz);
+    }
+    frame->dip_count = (uint8_t)found;
+    ESP_LOGD(TAG_NANO, "Dip search over %u points took %lld us.", swept_window.points, (long long)elapsed_us);
+}
+
+/**
+ * @brief Averages CAL_MEASURE_SWEEPS full-band sweeps of raw S11 into the capture of `standard`.
+ * @return true if every sweep completed
+ */
+static bool calibration_measure(sol_cal_standard_t standard)
+{
+    if (cal_capture == NULL) {
+        cal_capture = calloc(1, sizeof(*cal_capture));
+        if (cal_capture == NULL) {
+            ESP_LOGE(TAG_NANO, "No memory for the calibration standards.");
+            return false;
+        }
+    }
+    sweep_average_reset(&sweep_avg);
+    sweep_avg_active = true;
+    cal_bypass = true;
+    bool ok = true;
+    for (int k = 0; ok && k < CAL_MEASURE_SWEEPS; ++k) {
+        ok = perform_sweep(&full_sweep_window);
+    }
+    sweep_avg_active = false;
+    cal_bypass = false;
+    if (!ok) {
+        return false;
+    }
+    sol_cal_capture_set(cal_capture, standard, sweep_avg.mean_re, sweep_avg.mean_im, sweep_avg.count, full_sweep_window.points);
+    return true;
+}
+
+/**
+ * @brief Carries out one calibration step asked for over BLE ("CAL ..." commands).
+ */
+static void calibration_run(cal_action_t action)
+{
+    static const char *const standard_names[SOL_CAL_STANDARD_COUNT] = { "open", "short", "load" };
+    sweep_profile_use(__atomic_load_n(&active_profile, __ATOMIC_ACQUIRE)); // Calibrates the selected band
+
+    if (action >= CAL_ACTION_MEASURE_OPEN && action <= CAL_ACTION_MEASURE_LOAD) {
+        const sol_cal_standard_t standard = (sol_cal_standard_t)(action - CAL_ACTION_MEASURE_OPEN);
+        const int64_t start_us = esp_timer_get_time();
+        if (!calibration_measure(standard)) {
+            ESP_LOGE(TAG_NANO, "Calibration: measuring the %s standard failed.", standard_names[standard]);
+            return;
+        }
+        ESP_LOGI(TAG_NANO, "Calibration: %s standard measured (%d sweeps, %lld ms).", standard_names[standard],
+                 CAL_MEASURE_SWEEPS, (long long)((esp_timer_get_time() - start_us) / 1000));
+    } else if (action == CAL_ACTION_SAVE) {
+        uint16_t degenerate = 0;
+        if (cal_capture == NULL ||
+            !sol_cal_compute(&sol_cal, cal_capture, full_sweep_window.start_hz, full_sweep_window.step_hz,
+                             full_sweep_window.points, &degenerate)) {
+            ESP_LOGW(TAG_NANO, "Calibration: measure the open, short and load standards before saving.");
+            return;
+        }
+        free(cal_capture);
+        cal_capture = NULL;
+        if (degenerate > 0) {
+            ESP_LOGW(TAG_NANO, "Calibration: %u points left uncorrected (standards indistinguishable).", degenerate);
+        }
+        esp_err_t err = sol_cal_nvs_store(&sol_cal, CAL_NVS_NAMESPACE);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG_NANO, "Failed to store the calibration in NVS: %s (applied until reboot)", esp_err_to_name(err));
+        }
+        ESP_LOGI(TAG_NANO, "Calibration saved; S11 is corrected from the next sweep.");
+    } else if (action == CAL_ACTION_CLEAR) {
+        free(cal_capture);
+        cal_capture = NULL;
+        sol_cal_clear(&sol_cal);
+        esp_err_t err = sol_cal_nvs_store(&sol_cal, CAL_NVS_NAMESPACE);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG_NANO, "Failed to erase the calibration in NVS: %s", esp_err_to_name(err));
+        }
+        ESP_LOGI(TAG_NANO, "Calibration cleared; S11 is uncorrected.");
+    }
+}
+
+/**
+ * @brief Opens the NanoVNA with a `rx_buffer_size`-byte receive buffer (current_cdc_dev),
+ * waiting up to the connection timeout for it to appear.
+ */
+static esp_err_t nanovna_open(uint16_t rx_buffer_size)
+{
+    const cdc_acm_host_device_config_t dev_config = {
+        .connection_timeout_ms = 5000,
+        .out_buffer_size = TX_BUFFER_SIZE,
+        .in_buffer_size = rx_buffer_size,
+        .event_cb = handle_usb_event,
+        .data_cb = handle_usb_rx,
+        .user_arg = NULL
+    };
+    return cdc_acm_host_open(NANOVNA_VID, NANOVNA_PID, NANOVNA_INTERFACE, &dev_config, (cdc_acm_dev_hdl_t *)&current_cdc_dev); // Cast needed for volatile
+}
+
+/**
+ * @brief Closes the NanoVNA and opens it again with another receive buffer size. It stays
+ * powered, so its registers are kept; the handshake resynchronises the command parser.
+ * @return false if it did not come back; the control loop then reconnects as after a
+ *         disconnect
+ */
+static bool nanovna_reopen(uint16_t rx_buffer_size)
+{
+    cdc_acm_dev_hdl_t dev = current_cdc_dev;
+    current_cdc_dev = NULL; // Events for the closed handle are ignored from here
+    if (dev != NULL) {
+        cdc_acm_host_close(dev);
+    }
+    esp_err_t err = nanovna_open(rx_buffer_size);
+    if (err == ESP_OK) {
+        cdc_acm_host_set_control_line_state(current_cdc_dev, true, true);
+        if (nanovna_configure_on_connect(NULL)) {
+            return true;
+        }
+        err = ESP_ERR_INVALID_RESPONSE;
+        dev = current_cdc_dev;
+        current_cdc_dev = NULL;
+        if (dev != NULL) {
+            cdc_acm_host_close(dev);
+        }
+    }
+    ESP_LOGE(TAG_NANO, "Reopening the NanoVNA with a %u-byte buffer failed: %s", rx_buffer_size, esp_err_to_name(err));
+    xSemaphoreGive(device_disconnected_sem);
+    return false;
+}
+
+/**
+ * @brief Runs a "USB TUNE" benchmark of `sweeps` counted sweeps per candidate over the
+ * active profile's band, then keeps the fastest sizes: the receive buffer in NVS and in
+ * use from now, the chunk size in the active profile.
+ */
+static void usb_tune_run(uint8_t sweeps)
+{
+    static const uint16_t buffer_sizes[] = USB_TUNE_BUFFER_SIZES;
+    static const uint8_t chunk_sizes[] = USB_TUNE_CHUNK_SIZES;
+    sweep_profile_use(__atomic_load_n(&active_profile, __ATOMIC_ACQUIRE)); // Tunes the selected profile
+    const uint16_t profile_chunk_points = sweep_chunk_points;
+    uint16_t open_buffer_size = usb_rx_buffer_size;
+
+    xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+    usb_tune_begin(&usb_tune, buffer_sizes, sizeof(buffer_sizes) / sizeof(buffer_sizes[0]),
+                   chunk_sizes, sizeof(chunk_sizes) / sizeof(chunk_sizes[0]), sweeps);
+    const uint8_t candidates = usb_tune.count;
+    xSemaphoreGive(diag_stats_mutex);
+    ESP_LOGI(TAG_NANO, "USB tuning: %u candidates, %u sweeps each of %u points.", candidates, sweeps, full_sweep_window.points);
+    const int64_t start_us = esp_timer_get_time();
+
+    bool aborted = false;
+    usb_tune_config_t candidate;
+    while (true) {
+        xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+        const bool more = usb_tune_next(&usb_tune, &candidate);
+        xSemaphoreGive(diag_stats_mutex);
+        if (!more) {
+            break;
+        }
+        if (candidate.rx_buffer_size != open_buffer_size) {
+            if (!nanovna_reopen(candidate.rx_buffer_size)) {
+                aborted = true;
+                break;
+            }
+            open_buffer_size = candidate.rx_buffer_size;
+        }
+        sweep_chunk_points = candidate.chunk_points;
+        const int64_t sweep_start_us = esp_timer_get_time();
+        const bool ok = perform_sweep(&full_sweep_window);
+        const int64_t sweep_us = esp_timer_get_time() - sweep_start_us;
+        xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+        usb_tune_record(&usb_tune, ok, sweep_us);
+        xSemaphoreGive(diag_stats_mutex);
+        if (current_cdc_dev == NULL) {
+            aborted = true;
+            break;
+        }
+    }
+
+    usb_tune_config_t best = { .rx_buffer_size = usb_rx_buffer_size, .chunk_points = (uint8_t)profile_chunk_points };
+    xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+    const bool found = usb_tune_finish(&usb_tune, aborted, &best);
+    const uint32_t best_us = found ? usb_tune_best_mean_us(&usb_tune) : 0;
+    xSemaphoreGive(diag_stats_mutex);
+    sweep_chunk_points = found ? best.chunk_points : profile_chunk_points;
+    if (aborted) {
+        ESP_LOGW(TAG_NANO, "USB tuning aborted: the NanoVNA went away. Sizes unchanged.");
+        return;
+    }
+    if (!found) {
+        ESP_LOGW(TAG_NANO, "USB tuning: no candidate completed its sweeps. Sizes unchanged.");
+    } else {
+        ESP_LOGI(TAG_NANO, "USB tuning done in %lld ms: %u-byte buffer, %u-point chunks, %.1f ms a sweep.",
+                 (long long)((esp_timer_get_time() - start_us) / 1000), best.rx_buffer_size, best.chunk_points, best_us / 1000.0);
+        usb_rx_buffer_size = best.rx_buffer_size;
+        esp_err_t err = usb_tune_nvs_store(&usb_tune, USB_TUNE_NVS_NAMESPACE);
+        // The chunk size is the active profile's
+        const uint8_t active = __atomic_load_n(&active_profile, __ATOMIC_ACQUIRE);
+        xSemaphoreTake(sweep_profiles_mutex, portMAX_DELAY);
+        sweep_profile_t profile = sweep_profiles.entries[active];
+        profile.chunk_points = best.chunk_points;
+        if (err == ESP_OK && sweep_profile_set(&sweep_profiles, active, &profile, &sweep_profile_limits)) {
+            err = sweep_profile_nvs_store(&sweep_profiles, active, SWEEP_PROFILE_NVS_NAMESPACE);
+        }
+        xSemaphoreGive(sweep_profiles_mutex);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG_NANO, "Failed to store the tuned sizes in NVS: %s (used until reboot)", esp_err_to_name(err));
+        }
+    }
+    if (open_buffer_size != usb_rx_buffer_size) {
+        nanovna_reopen(usb_rx_buffer_size);
+    }
+}
+
+/**
+ * @brief True if a BLE command is waiting for the NanoVNA (a calibration step or a tuning run).
+ */
+static bool nanovna_action_pending(void)
+{
+    return __atomic_load_n(&cal_action, __ATOMIC_ACQUIRE) != CAL_ACTION_NONE ||
+           __atomic_load_n(&usb_tune_requested, __ATOMIC_ACQUIRE) != 0;
+}
+
+/**
+ * @brief Starts a "USB TUNE" run asked for over BLE, if any.
+ * @return true if one ran
+ */
+static bool usb_tune_run_requested(void)
+{
+    const uint8_t sweeps = __atomic_exchange_n(&usb_tune_requested, 0, __ATOMIC_ACQ_REL);
+    if (sweeps == 0) {
+        return false;
+    }
+    usb_tune_run(sweeps);
+    return true;
+}
+
+// =========================================================================
+// == NimBLE GATT Server Logic                                            ==
+// =========================================================================
+
+/**
+ * @brief Wakes the control task without asking for a reading.
+ */
+static void request_queue_wake(void)
+{
+    const sweep_request_t wake = { .kind = SWEEP_REQUEST_WAKE };
+    xQueueSendToFront(sweep_request_queue, &wake, 0); // A full queue wakes the task anyway
+}
+
+/**
+ * @brief Index of the profile the next reading is taken with: the one selected, if its
+ * switch is still pending, otherwise the active one.
+ */
+static uint8_t sweep_profile_next_index(void)
+{
+    const uint8_t index = __atomic_load_n(&profile_requested, __ATOMIC_ACQUIRE);
+    return (index != SWEEP_PROFILE_NONE) ? index : __atomic_load_n(&active_profile, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Queues a reading for `conn_handle`. When the queue is full, or the client already
+ * has BLE_CLIENT_MAX_PENDING requests outstanding, the request is answered at once with a
+ * RESULT_FLAG_REJECTED frame to that client only, so it can retry.
+ */
+static void request_queue_submit(uint16_t conn_handle, uint16_t id, uint8_t priority)
+{
+    const sweep_request_t request = {
+        .id = id,
+        .conn_handle = conn_handle,
+        .kind = SWEEP_REQUEST_READ,
+        .mode = (uint8_t)sweep_mode,
+        .profile = sweep_profile_next_index(),
+        .averages = average_sweeps,
+        .priority = priority,
+        .received_us = esp_timer_get_time(),
+    };
+    const bool reserved = ble_client_request_reserve(conn_handle);
+    const bool queued = reserved && (xQueueSend(sweep_request_queue, &request, 0) == pdTRUE);
+    TRACE_EVENT(&trace_buffer, TRACE_TAG_BLE, TRACE_LEVEL_INFO, request.received_us, TRACE_EV_REQUEST,
+                queued ? 0 : TRACE_REQUEST_REJECTED, id, conn_handle);
+    if (queued) {
+        ESP_LOGI(TAG_BLE, "Queued request %u (conn 0x%x, priority %u).", id, conn_handle, priority);
+        return;
+    }
+
+    if (reserved) {
+        ble_client_request_release(conn_handle);
+        ESP_LOGW(TAG_BLE, "Request queue full; rejecting request %u.", id);
+    } else {
+        ESP_LOGW(TAG_BLE, "Conn 0x%x has %d requests outstanding; rejecting request %u.", conn_handle, BLE_CLIENT_MAX_PENDING, id);
+    }
+    const result_frame_t frame = {
+        .flags = RESULT_FLAG_REJECTED,
+        .seq = __atomic_fetch_add(&result_frame_seq, 1, __ATOMIC_RELAXED),
+        .timestamp_ms = (uint32_t)(request.received_us / 1000),
+        .request_id = id,
+    };
+    uint8_t encoded[RESULT_FRAME_MAX_LEN];
+    const size_t len = result_frame_encode(&frame, encoded, sizeof(encoded));
+    ble_notify_result(conn_handle, encoded, (uint16_t)len, false); // Host task: never wait for mbufs
+}
+
+/**
+ * @brief Copy of the profile the next reading is taken with (sweep_profile_next_index()).
+ */
+static sweep_profile_t sweep_profile_next(void)
+{
+    const uint8_t index = sweep_profile_next_index();
+    xSemaphoreTake(sweep_profiles_mutex, portMAX_DELAY);
+    const sweep_profile_t profile = sweep_profiles.entries[(index < sweep_profiles.count) ? index : 0];
+    xSemaphoreGive(sweep_profiles_mutex);
+    return profile;
+}
+
+/**
+ * @brief Selects profile `index` for the next reading; the NanoVNA task applies it.
+ * @return false if there is no such profile
+ */
+static bool sweep_profile_select(unsigned index)
+{
+    xSemaphoreTake(sweep_profiles_mutex, portMAX_DELAY);
+    const bool found = (index < sweep_profiles.count);
+    char name[SWEEP_PROFILE_NAME_LEN] = "";
+    if (found) {
+        memcpy(name, sweep_profiles.entries[index].name, sizeof(name));
+    }
+    xSemaphoreGive(sweep_profiles_mutex);
+    if (!found) {
+        ESP_LOGW(TAG_BLE, "No sweep profile %u.", index);
+        return false;
+    }
+    ESP_LOGI(TAG_BLE, "Sweep profile %u \"%s\" selected.", index, name);
+    __atomic_store_n(&profile_requested, (uint8_t)index, __ATOMIC_RELEASE);
+    request_queue_wake(); // Applied now rather than with the next reading, so a read shows it
+    return true;
+}
+
+/**
+ * @brief "PROFILE SET": replaces (or appends) a profile and stores the table. Editing the
+ * active profile re-applies it.
+ */
+static void sweep_profile_define(unsigned index, const sweep_profile_t *profile)
+{
+    xSemaphoreTake(sweep_profiles_mutex, portMAX_DELAY);
+    const bool ok = (index <= UINT8_MAX) && sweep_profile_set(&sweep_profiles, (uint8_t)index, profile, &sweep_profile_limits);
+    const uint8_t active = __atomic_load_n(&active_profile, __ATOMIC_ACQUIRE);
+    esp_err_t err = ok ? sweep_profile_nvs_store(&sweep_profiles, active, SWEEP_PROFILE_NVS_NAMESPACE) : ESP_OK;
+    const uint8_t count = sweep_profiles.count;
+    xSemaphoreGive(sweep_profiles_mutex);
+    if (!ok) {
+        ESP_LOGW(TAG_BLE, "Rejecting profile %u \"%s\" (index 0-%u, unique name, %u-%u points, 1-%u chunk points, "
+                 "1-%d values per point, %.3f-%.3f MHz).", index, profile->name, count, 2, sweep_profile_limits.max_points,
+                 sweep_profile_limits.max_chunk_points, SWEEP_PROFILE_MAX_VALUES_PER_FREQ,
+                 SWEEP_PROFILE_MIN_HZ / 1e6, SWEEP_PROFILE_MAX_HZ / 1e6);
+        return;
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG_BLE, "Failed to store the sweep profiles in NVS: %s (kept until reboot)", esp_err_to_name(err));
+    }
+    ESP_LOGI(TAG_BLE, "Sweep profile %u \"%s\" defined.", index, profile->name);
+    if (index == active) {
+        sweep_profile_select(index);
+    }
+}
+
+/**
+ * @brief Dispatches a null-terminated command string written by the client.
+ *
+ * Supported commands:
+ *   "DATA REQUESTED [<id> [<p>]]" - request one measurement in the selected sweep mode; the result
+ *                                  frame echoes <id> (1-32767; firmware assigns one if omitted),
+ *                                  <p> is the priority 0-3 (default 0, higher served first)
+ *   "SWEEP FULL"                 - one dense sweep over the configured band (default)
+ *   "SWEEP COARSE <n_c> <n_f>"   - two-stage sweep: n_c coarse points, then n_f fine points
+ *   "SWEEP TRACK <n>"            - track the last resonance with an n-point window
+ *   "AVERAGE <n>"                - average n back-to-back sweeps per reading (1 = off, up to 32)
+ *   "DIPS <n> [<min_cdb>]"       - list the n most prominent dips in each result frame (0-3), counting
+ *                                  only dips at least min_cdb centi-dB prominent
+ *   "STREAM <period_ms>"         - sweep and notify every period_ms without further triggers
+ *   "STREAM OFF"                 - stop streaming
+ *   "SWEEP DUMP ON" / "OFF"      - also send each completed sweep curve on the sweep data characteristic
+ *                                  (to every client subscribed to it)
+ *   "STATS RESET"                - clear the latency statistics, READFIFO timeout and power state counters on the
+ *                                  diagnostics characteristic
+ *   "POWER <idle_s> <suspend_s> [<adv_ms> <conn_ms>]" - idle after idle_s and suspend after suspend_s seconds
+ *                                  without activity (0 = never), advertising every adv_ms and asking for a
+ *                                  conn_ms connection interval while idle or suspended
+ *   "LOG <tag> <0-5>"            - set the console log level of a tag ("*" for all)
+ *   "TRACE <tag> <0-5>"          - set the trace buffer level of a tag ("*" for all)
+ *   "TRACE DUMP" / "TRACE DUMP UART" - send the trace buffer to the writing client / to the console
+ *   "JOURNAL SYNC [<seq>]"       - send the journaled readings after <seq> (default: the last
+ *                                  acknowledged) to the writing client on the journal characteristic
+ *   "JOURNAL ACK <seq>"          - the client holds every journaled reading up to <seq>; they may be overwritten
+ *   "HISTORY <seq> [<first> <n>]" - send sweep <seq> of the history (points first..first+n-1, default all)
+ *                                  to the writing client on the history characteristic
+ *   "HISTORY LAST [<first> <n>]" - the same for the newest sweep held
+ *   "CAL OPEN" / "SHORT" / "LOAD" - measure the standard fitted in place of the sensor
+ *   "CAL SAVE"                   - solve and store the calibration from the three standards; later sweeps are corrected
+ *   "CAL CLEAR"                  - drop the calibration (and any measured standards); S11 is uncorrected again
+ *   "PROFILE <name>|<index>"     - sweep with that profile from the next reading on, also after a reboot
+ *                                  (a one-byte write of the index to the profile characteristic does the same)
+ *   "PROFILE SET <i> <name> <start_hz> <step_hz> <points> <vpf> <chunk>" - define profile <i> (the next
+ *                                  free index adds one): <vpf> values averaged per point, <chunk> points per READFIFO
+ *   "USB TUNE [<sweeps>]"        - time <sweeps> sweeps (default 4, up to 32) per pair of READFIFO chunk and USB receive
+ *                                  buffer sizes and keep the fastest pair; the report is on the USB tuning characteristic
+ */
+static void handle_ble_command(uint16_t conn_handle, const char *cmd, uint16_t len)
+{
+    unsigned int n_coarse = 0, n_fine = 0, n_track = 0, n_average = 0, period_ms = 0, level = 0, request_id = 0, priority = 0;
+    unsigned int idle_s = 0, suspend_s = 0, adv_idle_ms = 0, conn_idle_ms = 0;
+    unsigned int n_dips = 0, min_prominence_cdb = 0;
+    int fields = 0;
+    unsigned long journal_seq = 0;
+    unsigned long history_seq = 0;
+    unsigned int history_first = 0, history_count = UINT16_MAX;
+    unsigned int profile_index = 0, profile_points = 0, profile_vpf = 0, profile_chunk = 0;
+    unsigned int tune_sweeps = USB_TUNE_SWEEPS_DEFAULT;
+    unsigned long long profile_start_hz = 0, profile_step_hz = 0;
+    char tag[16];
+    char profile_name[SWEEP_PROFILE_NAME_LEN];
+
+    int32_t cmd_head = 0;
+    memcpy(&cmd_head, cmd, len < sizeof(cmd_head) ? len : sizeof(cmd_head));
+    TRACE_EVENT(&trace_buffer, TRACE_TAG_BLE, TRACE_LEVEL_INFO, esp_timer_get_time(), TRACE_EV_BLE_COMMAND, 0, len, cmd_head);
+
+    // Check if the received command is "DATA REQUESTED"
+    if (strncmp(cmd, BLE_TRIGGER_STRING, len) == 0 && len == strlen(BLE_TRIGGER_STRING)) {
+        ESP_LOGI(TAG_BLE, "Received trigger string! Queueing request.");
+        request_queue_submit(conn_handle, next_auto_request_id, 0);
+        next_auto_request_id = (next_auto_request_id == UINT16_MAX) ? SWEEP_REQUEST_AUTO_ID_BASE : next_auto_request_id + 1;
+    } else if (sscanf(cmd, BLE_TRIGGER_STRING " %u %u", &request_id, &priority) >= 1) {
+        if (request_id == 0 || request_id >= SWEEP_REQUEST_AUTO_ID_BASE || priority > SWEEP_REQUEST_PRIORITY_MAX) {
+            ESP_LOGW(TAG_BLE, "Rejecting request id %u / priority %u (id must be 1-%u, priority 0-%d).",
+                     request_id, priority, SWEEP_REQUEST_AUTO_ID_BASE - 1, SWEEP_REQUEST_PRIORITY_MAX);
+            return;
+        }
+        request_queue_submit(conn_handle, (uint16_t)request_id, (uint8_t)priority);
+    } else if (strcmp(cmd, "SWEEP FULL") == 0) {
+        sweep_mode = SWEEP_MODE_FULL;
+        ESP_LOGI(TAG_BLE, "Sweep mode: full (%u points)", sweep_profile_next().points);
+    } else if (sscanf(cmd, "SWEEP COARSE %u %u", &n_coarse, &n_fine) == 2) {
+        const sweep_profile_t profile = sweep_profile_next();
+        if (n_coarse < 2 || n_coarse > profile.points || n_fine < 2 || n_fine > profile.points) {
+            ESP_LOGW(TAG_BLE, "Rejecting coarse/fine sizes %u/%u (each must be 2-%u).", n_coarse, n_fine, profile.points);
+            return;
+        }
+        // The fine window must span at least two coarse steps or the dip can fall between stages
+        uint64_t coarse_step_hz = ((uint64_t)(profile.points - 1) * profile.step_hz) / (n_coarse - 1);
+        if ((uint64_t)(n_fine - 1) * profile.step_hz < 2 * coarse_step_hz) {
+            ESP_LOGW(TAG_BLE, "Fine window (%u pts) narrower than two coarse steps; the dip may be missed.", n_fine);
+        }
+        coarse_sweep_points = (uint16_t)n_coarse;
+        fine_sweep_points = (uint16_t)n_fine;
+        sweep_mode = SWEEP_MODE_COARSE_FINE;
+        ESP_LOGI(TAG_BLE, "Sweep mode: coarse-to-fine (%u + %u points)", n_coarse, n_fine);
+    } else if (sscanf(cmd, "SWEEP TRACK %u", &n_track) == 1) {
+        if (n_track < 2 * TRACKING_EDGE_POINTS + 1 || n_track > TRACKING_WINDOW_POINTS_MAX) {
+            ESP_LOGW(TAG_BLE, "Rejecting tracking window %u (must be %d-%d).", n_track, 2 * TRACKING_EDGE_POINTS + 1, TRACKING_WINDOW_POINTS_MAX);
+            return;
+        }
+        tracking_window_points = (uint16_t)n_track;
+        tracking_locked = false; // Re-acquire with a full sweep on the next trigger
+        sweep_mode = SWEEP_MODE_TRACKING;
+        ESP_LOGI(TAG_BLE, "Sweep mode: tracking (%u point window)", n_track);
+    } else if (sscanf(cmd, "AVERAGE %u", &n_average) == 1) {
+        if (n_average < 1 || n_average > SWEEP_AVERAGE_MAX_SWEEPS) {
+            ESP_LOGW(TAG_BLE, "Rejecting average count %u (must be 1-%d).", n_average, SWEEP_AVERAGE_MAX_SWEEPS);
+            return;
+        }
+        average_sweeps = (uint8_t)n_average;
+        ESP_LOGI(TAG_BLE, "Averaging %u sweeps per reading.", n_average);
+    } else if ((fields = sscanf(cmd, "DIPS %u %u", &n_dips, &min_prominence_cdb)) >= 1) {
+        if (n_dips > RESULT_FRAME_MAX_DIPS || (fields == 2 && (min_prominence_cdb < 1 || min_prominence_cdb > UINT16_MAX))) {
+            ESP_LOGW(TAG_BLE, "Rejecting dip settings %u / %u (count must be 0-%d, prominence 1-%u cdB).",
+                     n_dips, min_prominence_cdb, RESULT_FRAME_MAX_DIPS, UINT16_MAX);
+            return;
+        }
+        dip_count = (uint8_t)n_dips;
+        if (fields == 2) {
+            dip_min_prominence_cdb = (uint16_t)min_prominence_cdb;
+        }
+        ESP_LOGI(TAG_BLE, "Listing up to %u dips of at least %.2f dB prominence.", n_dips, dip_min_prominence_cdb / 100.0);
+    } else if (strcmp(cmd, "SWEEP DUMP ON") == 0 || strcmp(cmd, "SWEEP DUMP OFF") == 0) {
+        sweep_dump_enabled = (strcmp(cmd, "SWEEP DUMP ON") == 0);
+        ESP_LOGI(TAG_BLE, "Sweep curve transfer %s (MTU %u).", sweep_dump_enabled ? "enabled" : "disabled", ble_client_mtu(conn_handle));
+    } else if (strcmp(cmd, "STATS RESET") == 0) {
+        xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+        latency_stats_reset(&sweep_latency_stats, esp_timer_get_time());
+        chunk_timing_reset_counters(&chunk_timing);
+        power_idle_reset_counters(&power_idle, esp_timer_get_time());
+        xSemaphoreGive(diag_stats_mutex);
+        ESP_LOGI(TAG_BLE, "Latency statistics reset.");
+    } else if (strcmp(cmd, "TRACE DUMP") == 0 || strcmp(cmd, "TRACE DUMP UART") == 0) {
+        trace_dump_to_ble = (strcmp(cmd, "TRACE DUMP") == 0);
+        trace_dump_conn = conn_handle;
+        xSemaphoreGive(trace_dump_sem);
+    } else if (strncmp(cmd, "JOURNAL SYNC", 12) == 0) {
+        if (!journal_ready) {
+            ESP_LOGW(TAG_BLE, "No result journal on this device.");
+            return;
+        }
+        if (sscanf(cmd, "JOURNAL SYNC %lu", &journal_seq) != 1) {
+            xSemaphoreTake(journal_mutex, portMAX_DELAY);
+            journal_seq = result_journal.acked_seq;
+            xSemaphoreGive(journal_mutex);
+        }
+        journal_sync_after = (uint32_t)journal_seq;
+        journal_sync_conn = conn_handle;
+        xSemaphoreGive(journal_sync_sem);
+    } else if (strncmp(cmd, "HISTORY ", 8) == 0) {
+        if (!history_ready) {
+            ESP_LOGW(TAG_BLE, "No sweep history on this device.");
+            return;
+        }
+        if (strncmp(cmd, "HISTORY LAST", 12) == 0) {
+            fields = sscanf(cmd, "HISTORY LAST %u %u", &history_first, &history_count);
+            fields = (fields == EOF) ? 0 : fields;
+        } else {
+            fields = sscanf(cmd, "HISTORY %lu %u %u", &history_seq, &history_first, &history_count) - 1;
+            if (fields < 0 || history_seq == 0) {
+                ESP_LOGW(TAG_BLE, "Invalid HISTORY command: \"%s\"", cmd);
+                return;
+            }
+        }
+        if (fields == 1 || history_first > UINT16_MAX || history_count > UINT16_MAX) {
+            ESP_LOGW(TAG_BLE, "Invalid HISTORY range: \"%s\" (give both <first> and <n>, up to %u).", cmd, UINT16_MAX);
+            return;
+        }
+        history_send_seq = (uint32_t)history_seq;
+        history_send_first = (uint16_t)history_first;
+        history_send_count = (uint16_t)history_count;
+        history_send_conn = conn_handle;
+        xSemaphoreGive(history_send_sem);
+    } else if (sscanf(cmd, "JOURNAL ACK %lu", &journal_seq) == 1) {
+        if (!journal_ready) {
+            ESP_LOGW(TAG_BLE, "No result journal on this device.");
+            return;
+        }
+        xSemaphoreTake(journal_mutex, portMAX_DELAY);
+        const bool acked = journal_ack((uint32_t)journal_seq);
+        const uint32_t pending = result_journal_pending(&result_journal);
+        xSemaphoreGive(journal_mutex);
+        if (!acked) {
+            ESP_LOGW(TAG_BLE, "Ignoring journal acknowledgement of %lu (already acknowledged or not written).", journal_seq);
+            return;
+        }
+        ESP_LOGI(TAG_BLE, "Journal acknowledged up to %lu; %" PRIu32 " records pending.", journal_seq, pending);
+    } else if (strncmp(cmd, "CAL ", 4) == 0) {
+        static const char *const cal_commands[] = {
+            [CAL_ACTION_MEASURE_OPEN] = "CAL OPEN",
+            [CAL_ACTION_MEASURE_SHORT] = "CAL SHORT",
+            [CAL_ACTION_MEASURE_LOAD] = "CAL LOAD",
+            [CAL_ACTION_SAVE] = "CAL SAVE",
+            [CAL_ACTION_CLEAR] = "CAL CLEAR",
+        };
+        uint8_t action = CAL_ACTION_NONE;
+        for (uint8_t a = CAL_ACTION_MEASURE_OPEN; a <= CAL_ACTION_CLEAR; ++a) {
+            if (strcmp(cmd, cal_commands[a]) == 0) {
+                action = a;
+            }
+        }
+        if (action == CAL_ACTION_NONE) {
+            ESP_LOGW(TAG_BLE, "Unknown calibration command \"%s\".", cmd);
+            return;
+        }
+        // Carried out by the NanoVNA task between readings
+        __atomic_store_n(&cal_action, action, __ATOMIC_RELEASE);
+        request_queue_wake();
+        ESP_LOGI(TAG_BLE, "Queued \"%s\".", cmd);
+    } else if (sscanf(cmd, "LOG %15s %u", tag, &level) == 2) {
+        if (level > ESP_LOG_VERBOSE) {
+            ESP_LOGW(TAG_BLE, "Rejecting log level %u (must be 0-%d).", level, ESP_LOG_VERBOSE);
+            return;
+        }
+        esp_log_level_set(tag, (esp_log_level_t)level);
+        ESP_LOGI(TAG_BLE, "Console log level of %s set to %u.", tag, level);
+    } else if (sscanf(cmd, "TRACE %15s %u", tag, &level) == 2) {
+        if (level > TRACE_LEVEL_VERBOSE) {
+            ESP_LOGW(TAG_BLE, "Rejecting trace level %u (must be 0-%d).", level, TRACE_LEVEL_VERBOSE);
+            return;
+        }
+        bool matched = false;
+        for (int t = 0; t < TRACE_TAG_COUNT; ++t) {
+            if (strcmp(tag, "*") == 0 || strcmp(tag, trace_tag_names[t]) == 0) {
+                trace_buffer_set_level(&trace_buffer, (trace_tag_t)t, (trace_level_t)level);
+                matched = true;
+            }
+        }
+        if (!matched) {
+            ESP_LOGW(TAG_BLE, "Unknown trace tag \"%s\".", tag);
+            return;
+        }
+        ESP_LOGI(TAG_BLE, "Trace level of %s set to %u.", tag, level);
+    } else if ((fields = sscanf(cmd, "POWER %u %u %u %u", &idle_s, &suspend_s, &adv_idle_ms, &conn_idle_ms)) >= 2) {
+        xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+        power_idle_config_t config = power_idle.config;
+        xSemaphoreGive(diag_stats_mutex);
+        config.idle_after_ms = idle_s * 1000;
+        config.suspend_after_ms = suspend_s * 1000;
+        if (fields == 4) {
+            config.adv_itvl_ms[1] = (uint16_t)(adv_idle_ms > UINT16_MAX ? UINT16_MAX : adv_idle_ms);
+            config.conn_itvl_ms[1] = (uint16_t)(conn_idle_ms > UINT16_MAX ? UINT16_MAX : conn_idle_ms);
+        }
+        if (fields == 3 || idle_s > POWER_TIMEOUT_MAX_S || suspend_s > POWER_TIMEOUT_MAX_S || !power_idle_config_valid(&config)) {
+            ESP_LOGW(TAG_BLE, "Rejecting \"%s\" (timeouts up to %d s, suspend 0 or not before idle, "
+                     "advertising %d-%d ms, connection interval %d-%d ms).", cmd, POWER_TIMEOUT_MAX_S,
+                     POWER_ADV_ITVL_MIN_MS, POWER_ADV_ITVL_MAX_MS, POWER_CONN_ITVL_MIN_MS, POWER_CONN_ITVL_MAX_MS);
+            return;
+        }
+        if (NANOVNA_VBUS_EN_GPIO < 0 && config.suspend_after_ms > 0) {
+            ESP_LOGW(TAG_BLE, "No NanoVNA power switch on this board (NANOVNA_VBUS_EN_GPIO); not suspending.");
+            config.suspend_after_ms = 0;
+        }
+        xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+        power_idle_set_config(&power_idle, &config);
+        xSemaphoreGive(diag_stats_mutex);
+        // The NanoVNA task starts timing inactivity from now under the new settings
+        __atomic_store_n(&power_activity, true, __ATOMIC_RELEASE);
+        request_queue_wake();
+        ESP_LOGI(TAG_BLE, "Power: idle after %u s, suspend after %u s; idle intervals %u ms advertising, %u ms connection.",
+                 idle_s, suspend_s, config.adv_itvl_ms[1], config.conn_itvl_ms[1]);
+    } else if (sscanf(cmd, "PROFILE SET %u %11s %llu %llu %u %u %u", &profile_index, profile_name, &profile_start_hz,
+                      &profile_step_hz, &profile_points, &profile_vpf, &profile_chunk) == 7) {
+        sweep_profile_t profile = {
+            .start_hz = profile_start_hz,
+            .step_hz = profile_step_hz,
+            .points = (profile_points > UINT16_MAX) ? 0 : (uint16_t)profile_points,
+            .values_per_freq = (profile_vpf > UINT16_MAX) ? 0 : (uint16_t)profile_vpf,
+            .chunk_points = (profile_chunk > UINT8_MAX) ? 0 : (uint8_t)profile_chunk,
+        };
+        memcpy(profile.name, profile_name, sizeof(profile.name));
+        sweep_profile_define(profile_index, &profile);
+    } else if (strncmp(cmd, "PROFILE SET", 11) != 0 && sscanf(cmd, "PROFILE %11s", profile_name) == 1) {
+        xSemaphoreTake(sweep_profiles_mutex, portMAX_DELAY);
+        const int found = sweep_profile_find(&sweep_profiles, profile_name);
+        xSemaphoreGive(sweep_profiles_mutex);
+        char *end = NULL;
+        const unsigned long index = strtoul(profile_name, &end, 10);
+        if (found >= 0) {
+            sweep_profile_select((unsigned)found);
+        } else if (*end == '\0' && index <= UINT8_MAX) {
+            sweep_profile_select((unsigned)index);
+        } else {
+            ESP_LOGW(TAG_BLE, "No sweep profile \"%s\".", profile_name);
+        }
+    } else if (strcmp(cmd, "USB TUNE") == 0 || sscanf(cmd, "USB TUNE %u", &tune_sweeps) == 1) {
+        if (tune_sweeps == 0 || tune_sweeps > USB_TUNE_SWEEPS_MAX) {
+            ESP_LOGW(TAG_BLE, "Rejecting %u tuning sweeps (must be 1-%d).", tune_sweeps, USB_TUNE_SWEEPS_MAX);
+            return;
+        }
+        ESP_LOGI(TAG_BLE, "USB tuning with %u sweeps per candidate queued.", tune_sweeps);
+        __atomic_store_n(&usb_tune_requested, (uint8_t)tune_sweeps, __ATOMIC_RELEASE);
+        request_queue_wake();
+    } else if (strcmp(cmd, "STREAM OFF") == 0) {
+        stream_period_ms = 0;
+        ESP_LOGI(TAG_BLE, "Streaming stopped.");
+    } else if (sscanf(cmd, "STREAM %u", &period_ms) == 1) {
+        if (period_ms < STREAM_PERIOD_MIN_MS) {
+            ESP_LOGW(TAG_BLE, "Rejecting stream period %u ms (minimum %d ms).", period_ms, STREAM_PERIOD_MIN_MS);
+            return;
+        }
+        stream_period_ms = period_ms;
+        ESP_LOGI(TAG_BLE, "Streaming every %u ms.", period_ms);
+        // Wake the NanoVNA task so the first reading goes out now and the period is picked up
+        stream_restart = true;
+        request_queue_wake();
+    } else {
+        ESP_LOGW(TAG_BLE, "Ignoring unknown write data.");
+    }
+}
+
+/**
+ * @brief GATT Characteristic Access Callback
+ */
+static int gatt_chr_access_cb(uint16_t conn_handle_,
+                              uint16_t attr_handle,
+                              struct ble_gatt_access_ctxt *ctxt,
+                              void *arg)
+{
+    switch (ctxt->op) {
+        case BLE_GATT_ACCESS_OP_WRITE_CHR: {
+            ESP_LOGI(TAG_BLE, "GATT Write received (conn=0x%x, attr=0x%x)", conn_handle_, attr_handle);
+            uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+            if (len > 0) {
+                char buf[80]; // Buffer for received command string (longest: "PROFILE SET ...")
+                int rc = ble_hs_mbuf_to_flat(ctxt->om, buf, sizeof(buf) -1, NULL); // Read mbuf into flat buffer
+                 if (rc == 0) {
+                     buf[len] = '\0'; // Null terminate
+                     ESP_LOGI(TAG_BLE, "Write data: \"%s\" (%d bytes)", buf, len);
+                     handle_ble_command(conn_handle_, buf, len);
+                 } else {
+                     ESP_LOGE(TAG_BLE, "Failed to read mbuf flat (rc=%d)", rc);
+                 }
+            }
+             return 0; // Success for write operation
+        }
+
+         case BLE_GATT_ACCESS_OP_READ_CHR: {
+             ESP_LOGI(TAG_BLE, "GATT Read received (conn=0x%x, attr=0x%x)", conn_handle_, attr_handle);
+             // Return the latest result frame (empty until the first reading)
+             xSemaphoreTake(result_frame_mutex, portMAX_DELAY);
+             int rc = os_mbuf_append(ctxt->om, ble_result_frame, ble_result_frame_len);
+             xSemaphoreGive(result_frame_mutex);
+             return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+         }
+
+         default:
+             ESP_LOGW(TAG_BLE,"Unhandled GATT Op: %d", ctxt->op);
+             return BLE_ATT_ERR_UNLIKELY;
+    }
+}
+
+/**
+ * @brief Model info characteristic: reports which tree ensemble the firmware runs.
+ */
+static int gatt_model_chr_access_cb(uint16_t conn_handle_,
+                                    uint16_t attr_handle,
+                                    struct ble_gatt_access_ctxt *ctxt,
+                                    void *arg)
+{
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t info[9] = { MODEL_INFO_FORMAT };
+    le_put_u32(info + 1, xgb_model_table_id);
+    le_put_u16(info + 5, xgb_model_table_num_trees);
+    le_put_u16(info + 7, xgb_model_table_num_nodes);
+    int rc = os_mbuf_append(ctxt->om, info, sizeof(info));
+    return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/**
+ * @brief Diagnostics characteristic: per-stage latency statistics since the last reset,
+ * followed by the learned READFIFO timing (layout in chunk_timing.h).
+ */
+static int gatt_diag_chr_access_cb(uint16_t conn_handle_,
+                                   uint16_t attr_handle,
+                                   struct ble_gatt_access_ctxt *ctxt,
+                                   void *arg)
+{
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t stats[LATENCY_STATS_ENCODED_LEN + CHUNK_TIMING_ENCODED_LEN + POWER_IDLE_ENCODED_LEN];
+    xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+    const int64_t now_us = esp_timer_get_time();
+    size_t len = latency_stats_encode(&sweep_latency_stats, now_us, stats, sizeof(stats));
+    len += chunk_timing_encode(&chunk_timing, sweep_chunk_points, stats + len, sizeof(stats) - len);
+    len += power_idle_encode(&power_idle, now_us, stats + len, sizeof(stats) - len);
+    xSemaphoreGive(diag_stats_mutex);
+    int rc = os_mbuf_append(ctxt->om, stats, len);
+    return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/**
+ * @brief Journal characteristic: a read returns the journal status (layout above JOURNAL_STATUS_FORMAT).
+ */
+static int gatt_journal_chr_access_cb(uint16_t conn_handle_,
+                                      uint16_t attr_handle,
+                                      struct ble_gatt_access_ctxt *ctxt,
+                                      void *arg)
+{
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint32_t fields[5] = { 0 };
+    if (journal_ready) {
+        xSemaphoreTake(journal_mutex, portMAX_DELAY);
+        fields[0] = result_journal.acked_seq;
+        fields[1] = result_journal.next_seq - 1;
+        fields[2] = result_journal_pending(&result_journal);
+        fields[3] = result_journal.dropped;
+        fields[4] = result_journal_capacity(&result_journal);
+        xSemaphoreGive(journal_mutex);
+    }
+    uint8_t status[JOURNAL_STATUS_LEN] = { JOURNAL_STATUS_FORMAT };
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t b = 0; b < 4; ++b) {
+            status[1 + 4 * i + b] = (uint8_t)(fields[i] >> (8 * b));
+        }
+    }
+    int rc = os_mbuf_append(ctxt->om, status, sizeof(status));
+    return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/**
+ * @brief History characteristic: a read returns the history status (layout above HISTORY_STATUS_FORMAT).
+ */
+static int gatt_history_chr_access_cb(uint16_t conn_handle_,
+                                      uint16_t attr_handle,
+                                      struct ble_gatt_access_ctxt *ctxt,
+                                      void *arg)
+{
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint16_t sizes[3] = { 0 };
+    uint32_t oldest_seq = 0, newest_seq = 0;
+    if (history_ready) {
+        xSemaphoreTake(history_mutex, portMAX_DELAY);
+        sizes[0] = sweep_history.slots;
+        sizes[1] = sweep_history.max_points;
+        sizes[2] = sweep_history.held;
+        sweep_history_range(&sweep_history, &oldest_seq, &newest_seq);
+        xSemaphoreGive(history_mutex);
+    }
+    uint8_t status[HISTORY_STATUS_LEN] = { HISTORY_STATUS_FORMAT };
+    for (size_t i = 0; i < 3; ++i) {
+        le_put_u16(status + 1 + 2 * i, sizes[i]);
+    }
+    le_put_u32(status + 7, oldest_seq);
+    le_put_u32(status + 11, newest_seq);
+    int rc = os_mbuf_append(ctxt->om, status, sizeof(status));
+    return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/**
+ * @brief Profile characteristic: a read returns the profile table, a one-byte write selects a profile.
+ */
+static int gatt_profile_chr_access_cb(uint16_t conn_handle_,
+                                      uint16_t attr_handle,
+                                      struct ble_gatt_access_ctxt *ctxt,
+                                      void *arg)
+{
+    if (ctxt->op == BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        uint8_t index = 0;
+        if (OS_MBUF_PKTLEN(ctxt->om) != 1 || ble_hs_mbuf_to_flat(ctxt->om, &index, sizeof(index), NULL) != 0) {
+            return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+        }
+        return sweep_profile_select(index) ? 0 : BLE_ATT_ERR_VALUE_NOT_ALLOWED;
+    }
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t table[SWEEP_PROFILE_TABLE_MAX_LEN];
+    const uint8_t active = sweep_profile_next_index();
+    xSemaphoreTake(sweep_profiles_mutex, portMAX_DELAY);
+    const size_t len = sweep_profile_encode(&sweep_profiles, active, table, sizeof(table));
+    xSemaphoreGive(sweep_profiles_mutex);
+    int rc = os_mbuf_append(ctxt->om, table, len);
+    return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/**
+ * @brief USB tuning characteristic: a read returns the last "USB TUNE" run, or its progress.
+ */
+static int gatt_usb_tune_chr_access_cb(uint16_t conn_handle_,
+                                       uint16_t attr_handle,
+                                       struct ble_gatt_access_ctxt *ctxt,
+                                       void *arg)
+{
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t report[USB_TUNE_ENCODED_MAX_LEN];
+    xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+    const size_t len = usb_tune_encode(&usb_tune, report, sizeof(report));
+    xSemaphoreGive(diag_stats_mutex);
+    int rc = os_mbuf_append(ctxt->om, report, len);
+    return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/**
+ * @brief Sweep data and trace data characteristics are notify-only; nothing to read or write.
+ */
+static int gatt_sweep_chr_access_cb(uint16_t conn_handle_,
+                                    uint16_t attr_handle,
+                                    struct ble_gatt_access_ctxt *ctxt,
+                                    void *arg)
+{
+    ESP_LOGW(TAG_BLE,"Unexpected access to notify-only characteristic 0x%x: op %d", attr_handle, ctxt->op);
+    return BLE_ATT_ERR_UNLIKELY;
+}
+
+/**
+ * @brief Define the GATT service and characteristic
+ */
+static const struct ble_gatt_svc_def gatt_svr_svcs[] = {
+    {
+        .type = BLE_GATT_SVC_TYPE_PRIMARY,
+        .uuid = &SERVICE_UUID.u,
+        .characteristics = (struct ble_gatt_chr_def[]) {
+            {
+                .uuid = &CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_NOTIFY,
+                .val_handle = &gatt_chr_handle, // Store characteristic value handle
+            },
+            {
+                .uuid = &SWEEP_DATA_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_sweep_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_NOTIFY,
+                .val_handle = &gatt_sweep_chr_handle,
+            },
+            {
+                .uuid = &MODEL_INFO_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_model_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ,
+            },
+            {
+                .uuid = &TRACE_DATA_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_sweep_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_NOTIFY,
+                .val_handle = &gatt_trace_chr_handle,
+            },
+            {
+                .uuid = &DIAGNOSTICS_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_diag_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ,
+            },
+            {
+                .uuid = &JOURNAL_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_journal_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_NOTIFY,
+                .val_handle = &gatt_journal_chr_handle,
+            },
+            {
+                .uuid = &HISTORY_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_history_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_NOTIFY,
+                .val_handle = &gatt_history_chr_handle,
+            },
+            {
+                .uuid = &PROFILE_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_profile_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
+            },
+            {
+                .uuid = &USB_TUNE_CHARACTERISTIC_UUID.u,
+                .access_cb = gatt_usb_tune_chr_access_cb,
+                .flags = BLE_GATT_CHR_F_READ,
+            },
+            { 0 } // End of characteristics
+        }
+    },
+    { 0 } // End of services
+};
+
+/**
+ * @brief Returns the slot of `conn_handle`, or NULL. Caller holds ble_clients_mutex.
+ */
+static ble_client_t *ble_client_find(uint16_t conn_handle)
+{
+    if (conn_handle == BLE_HS_CONN_HANDLE_NONE) {
+        return NULL;
+    }
+    for (size_t i = 0; i < BLE_MAX_CLIENTS; ++i) {
+        if (ble_clients[i].conn_handle == conn_handle) {
+            return &ble_clients[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Claims a slot for a new connection.
+ * @return false if every slot is taken
+ */
+static bool ble_client_add(uint16_t conn_handle)
+{
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = NULL;
+    for (size_t i = 0; i < BLE_MAX_CLIENTS && client == NULL; ++i) {
+        if (ble_clients[i].conn_handle == BLE_HS_CONN_HANDLE_NONE) {
+            client = &ble_clients[i];
+        }
+    }
+    if (client != NULL) {
+        *client = (ble_client_t){ .conn_handle = conn_handle, .mtu = BLE_ATT_MTU_DFLT };
+    }
+    xSemaphoreGive(ble_clients_mutex);
+    return client != NULL;
+}
+
+/**
+ * @brief Frees the slot of `conn_handle`; its pending requests are dropped when taken.
+ * @return number of clients still connected
+ */
+static size_t ble_client_remove(uint16_t conn_handle)
+{
+    size_t remaining = 0;
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = ble_client_find(conn_handle);
+    if (client != NULL) {
+        client->conn_handle = BLE_HS_CONN_HANDLE_NONE;
+    }
+    for (size_t i = 0; i < BLE_MAX_CLIENTS; ++i) {
+        remaining += (ble_clients[i].conn_handle != BLE_HS_CONN_HANDLE_NONE);
+    }
+    xSemaphoreGive(ble_clients_mutex);
+    return remaining;
+}
+
+/**
+ * @brief Copies the connected clients into `out` (BLE_MAX_CLIENTS entries), so notifications
+ * are sent without holding ble_clients_mutex.
+ * @return number of clients copied
+ */
+static size_t ble_clients_snapshot(ble_client_t *out)
+{
+    size_t count = 0;
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    for (size_t i = 0; i < BLE_MAX_CLIENTS; ++i) {
+        if (ble_clients[i].conn_handle != BLE_HS_CONN_HANDLE_NONE) {
+            out[count++] = ble_clients[i];
+        }
+    }
+    xSemaphoreGive(ble_clients_mutex);
+    return count;
+}
+
+/**
+ * @brief Negotiated ATT MTU of `conn_handle`, or 0 if it is not connected.
+ */
+static uint16_t ble_client_mtu(uint16_t conn_handle)
+{
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    const ble_client_t *client = ble_client_find(conn_handle);
+    const uint16_t mtu = (client != NULL) ? client->mtu : 0;
+    xSemaphoreGive(ble_clients_mutex);
+    return mtu;
+}
+
+static void ble_client_set_mtu(uint16_t conn_handle, uint16_t mtu)
+{
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = ble_client_find(conn_handle);
+    if (client != NULL) {
+        client->mtu = mtu;
+    }
+    xSemaphoreGive(ble_clients_mutex);
+}
+
+/**
+ * @brief Applies a CCCD write: notifications on `attr_handle` turned on or off for `conn_handle`.
+ */
+static void ble_client_set_subscription(uint16_t conn_handle, uint16_t attr_handle, bool notify)
+{
+    uint8_t bit = 0;
+    if (attr_handle == gatt_chr_handle) {
+        bit = BLE_CLIENT_SUB_RESULT;
+    } else if (attr_handle == gatt_sweep_chr_handle) {
+        bit = BLE_CLIENT_SUB_SWEEP;
+    } else if (attr_handle == gatt_trace_chr_handle) {
+        bit = BLE_CLIENT_SUB_TRACE;
+    } else if (attr_handle == gatt_journal_chr_handle) {
+        bit = BLE_CLIENT_SUB_JOURNAL;
+    } else if (attr_handle == gatt_history_chr_handle) {
+        bit = BLE_CLIENT_SUB_HISTORY;
+    }
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = ble_client_find(conn_handle);
+    if (client != NULL) {
+        client->subscribed = notify ? (client->subscribed | bit) : (client->subscribed & ~bit);
+    }
+    xSemaphoreGive(ble_clients_mutex);
+}
+
+/**
+ * @brief Counts a new request against the client's BLE_CLIENT_MAX_PENDING budget.
+ * @return false if the client is at its limit (or not connected)
+ */
+static bool ble_client_request_reserve(uint16_t conn_handle)
+{
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = ble_client_find(conn_handle);
+    const bool ok = (client != NULL && client->pending_requests < BLE_CLIENT_MAX_PENDING);
+    if (ok) {
+        client->pending_requests++;
+    }
+    xSemaphoreGive(ble_clients_mutex);
+    return ok;
+}
+
+/**
+ * @brief Returns a request to the client's budget once it is answered or dropped as a duplicate.
+ */
+static void ble_client_request_release(uint16_t conn_handle)
+{
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = ble_client_find(conn_handle);
+    if (client != NULL && client->pending_requests > 0) {
+        client->pending_requests--;
+    }
+    xSemaphoreGive(ble_clients_mutex);
+}
+
+/**
+ * @brief Records that `conn_handle` missed readings (skipped true) or has been sent a frame
+ * flagging them (skipped false). A skipped client is re-probed with the next reading.
+ */
+static void ble_client_set_skipped(uint16_t conn_handle, bool skipped)
+{
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = ble_client_find(conn_handle);
+    if (client != NULL) {
+        client->skipped_pending = skipped;
+        if (skipped) {
+            client->notify_backlogged = false;
+        }
+    }
+    xSemaphoreGive(ble_clients_mutex);
+}
+
+/**
+ * @brief True when no result-subscribed client can take a streamed reading: the BLE stack is
+ * short of buffers, or every subscriber's earlier notifications have not drained.
+ */
+static bool ble_link_backlogged(void)
+{
+    if (os_msys_num_free() < STREAM_MIN_FREE_MBUFS) {
+        return true;
+    }
+    bool backlogged = true;
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    for (size_t i = 0; i < BLE_MAX_CLIENTS; ++i) {
+        const ble_client_t *client = &ble_clients[i];
+        if (client->conn_handle != BLE_HS_CONN_HANDLE_NONE && (client->subscribed & BLE_CLIENT_SUB_RESULT) &&
+            !client->notify_backlogged) {
+            backlogged = false;
+        }
+    }
+    xSemaphoreGive(ble_clients_mutex);
+    return backlogged;
+}
+
+/**
+ * @brief Sends `len` bytes as a notification on characteristic `chr_handle` to one client.
+ * @return 0 on success, otherwise a NimBLE error code (BLE_HS_ENOTCONN if the client is gone)
+ */
+static int ble_notify_chr(uint16_t conn_handle, uint16_t chr_handle, const void *data, uint16_t len)
+{
+    if (conn_handle == BLE_HS_CONN_HANDLE_NONE) {
+        return BLE_HS_ENOTCONN;
+    }
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(data, len);
+    if (om == NULL) {
+        return BLE_HS_ENOMEM;
+    }
+    return ble_gatts_notify_custom(conn_handle, chr_handle, om);
+}
+
+/**
+ * @brief ble_notify_chr() for bulk transfers: waits briefly for mbufs when the stack runs short.
+ */
+static int ble_notify_chr_wait(uint16_t conn_handle, uint16_t chr_handle, const void *data, uint16_t len)
+{
+    int rc;
+    int retries = 0;
+    while ((rc = ble_notify_chr(conn_handle, chr_handle, data, len)) == BLE_HS_ENOMEM &&
+           retries++ < SWEEP_DUMP_NOTIFY_RETRIES) {
+        vTaskDelay(pdMS_TO_TICKS(SWEEP_DUMP_RETRY_DELAY_MS));
+    }
+    if (rc != 0) {
+        TRACE_EVENT(&trace_buffer, TRACE_TAG_BLE, TRACE_LEVEL_WARN, esp_timer_get_time(), TRACE_EV_BLE_NOTIFY_FAIL, 0, chr_handle, rc);
+    }
+    return rc;
+}
+
+/**
+ * @brief Sends a result frame to one client on the result characteristic, recording its backpressure.
+ * With `wait` (answers to the client's own requests) it waits briefly for mbufs like a bulk transfer.
+ */
+static int ble_notify_result(uint16_t conn_handle, const void *data, uint16_t len, bool wait)
+{
+    int rc = wait ? ble_notify_chr_wait(conn_handle, gatt_chr_handle, data, len)
+                  : ble_notify_chr(conn_handle, gatt_chr_handle, data, len);
+    xSemaphoreTake(ble_clients_mutex, portMAX_DELAY);
+    ble_client_t *client = ble_client_find(conn_handle);
+    if (client != NULL) {
+        client->notify_backlogged = (rc == BLE_HS_ENOMEM);
+    }
+    xSemaphoreGive(ble_clients_mutex);
+    if (rc != 0 && rc != BLE_HS_ENOTCONN && !wait) { // ble_notify_chr_wait() traced it already
+        TRACE_EVENT(&trace_buffer, TRACE_TAG_BLE, TRACE_LEVEL_WARN, esp_timer_get_time(), TRACE_EV_BLE_NOTIFY_FAIL, 0, gatt_chr_handle, rc);
+    }
+    return rc;
+}
+
+/**
+ * @brief Streams the last swept window's curve to one client on the sweep data characteristic
+ * in packets sized to that client's MTU. Waits briefly for mbufs when the stack runs short.
+ * @return true if every packet was queued
+ */
+static bool ble_send_sweep_curve(uint16_t conn_handle, uint16_t mtu, uint8_t transfer_id)
+{
+    uint8_t packet[BLE_ATT_MTU_MAX];
+    const size_t max_packet = (mtu > 3 ? mtu - 3 : 0); // ATT notify header is 3 bytes
+    sweep_transfer_t transfer;
+    sweep_transfer_begin(&transfer, transfer_id,
+                         (uint32_t)swept_window.start_hz, (uint32_t)swept_window.step_hz,
+                         sweep_curve_cdb, swept_window.points);
+
+    size_t len;
+    while ((len = sweep_transfer_next(&transfer, packet, max_packet < sizeof(packet) ? max_packet : sizeof(packet))) > 0) {
+        int rc = ble_notify_chr_wait(conn_handle, gatt_sweep_chr_handle, packet, (uint16_t)len);
+        if (rc != 0) {
+            ESP_LOGE(TAG_BLE, "Sweep curve packet %u to conn 0x%x failed; rc=%d", transfer.packet_index - 1, conn_handle, rc);
+            return false;
+        }
+    }
+    ESP_LOGI(TAG_BLE, "Sweep curve sent to conn 0x%x: %u points in %u packets (MTU %u).",
+             conn_handle, swept_window.points, transfer.packet_index, mtu);
+    return true;
+}
+
+/**
+ * @brief Encodes `frame` with the next sequence number and `request_id`, and notifies it to one
+ * client. Answers to requests (request_id != 0) wait briefly for mbufs.
+ * @return NimBLE status of the notify
+ */
+static int ble_send_result_frame(uint16_t conn_handle, result_frame_t *frame, uint16_t request_id)
+{
+    frame->seq = __atomic_fetch_add(&result_frame_seq, 1, __ATOMIC_RELAXED);
+    frame->request_id = request_id;
+    uint8_t encoded[RESULT_FRAME_MAX_LEN];
+    const size_t len = result_frame_encode(frame, encoded, sizeof(encoded));
+    ESP_LOGI(TAG_NANO, "Sending BLE Notification to conn 0x%x: seq=%u request=%u flags=0x%02x (%d bytes)",
+             conn_handle, frame->seq, frame->request_id, frame->flags, (int)len);
+    return ble_notify_result(conn_handle, encoded, (uint16_t)len, request_id != 0);
+}
+
+/**
+ * @brief Publishes `frame` as the value GATT reads of the result characteristic return, with
+ * request id 0 so a read never shows another client's request.
  */
-static bool process_chunk_and_update_min(int chunk_index)
+static void ble_publish_result_frame(const result_frame_t *frame)
 {
-    ESP_LOGD(TAG_NANO, "Processing chunk %d for minimum S11...", chunk_index);
-    bool success = true;
-
-    for (int i = 0; i < CHUNK_NUM_VALUES; ++i) {
-        size_t buffer_offset = i * VALUE_SIZE; // Offset within the chunk_rx_buffer
-
-        int32_t fwd0Re, fwd0Im, rev0Re, rev0Im;
-        uint16_t freqIndex; // Variable to hold the frequency index from VNA data
+    result_frame_t copy = *frame;
+    copy.request_id = 0;
+    uint8_t encoded[RESULT_FRAME_MAX_LEN];
+    const size_t len = result_frame_encode(&copy, encoded, sizeof(encoded));
+    xSemaphoreTake(result_frame_mutex, portMAX_DELAY);
+    memcpy(ble_result_frame, encoded, len);
+    ble_result_frame_len = len;
+    xSemaphoreGive(result_frame_mutex);
+}
 
-        // Basic bounds check for buffer read
-        if (buffer_offset + VALUE_SIZE > CHUNK_EXPECTED_BYTES) {
-            ESP_LOGE(TAG_NANO, "Internal Error: Buffer offset out of bounds during chunk processing!");
-            success = false;
-            break; // Stop processing this chunk
+/**
+ * @brief Sends one sweep's result to every client. A client gets one frame per request of its
+ * own in `served`, each echoing the request id; every other result-subscribed client gets one
+ * frame with request id 0. A client whose last notify was refused is skipped for frames it did
+ * not ask for, and its next frame carries RESULT_FLAG_SKIPPED. With `send_curve`, the curve
+ * follows the client's first frame when it is subscribed to the sweep data characteristic.
+ * @param frame     result of the sweep; seq, request_id and RESULT_FLAG_SKIPPED are set per frame
+ * @param served    requests answered by this sweep (none for a streamed reading)
+ * @param wake_us   start of a streamed reading, for LATENCY_STAGE_TOTAL
+ * @return Number of clients that were sent a frame
+ */
+static size_t ble_fan_out_result(result_frame_t *frame, const sweep_request_t *served, size_t served_count,
+                               int64_t wake_us, bool send_curve)
+{
+    const uint8_t sweep_flags = frame->flags;
+    ble_client_t clients[BLE_MAX_CLIENTS];
+    const size_t client_count = ble_clients_snapshot(clients);
+    size_t delivered = 0;
+    bool sent_any = false;
+
+    for (size_t c = 0; c < client_count; ++c) {
+        const ble_client_t *client = &clients[c];
+        size_t own = 0;
+        for (size_t i = 0; i < served_count; ++i) {
+            own += (served[i].conn_handle == client->conn_handle);
         }
-
-        // Parse data using memcpy (assumes correct endianness - usually little-endian for STM32/ESP32)
-        memcpy(&fwd0Re,   chunk_rx_buffer + buffer_offset + 0, 4);
-        memcpy(&fwd0Im,   chunk_rx_buffer + buffer_offset + 4, 4);
-        memcpy(&rev0Re,   chunk_rx_buffer + buffer_offset + 8, 4);
-        memcpy(&rev0Im,   chunk_rx_buffer + buffer_offset + 12, 4);
-        memcpy(&freqIndex, chunk_rx_buffer + buffer_offset + 24, 2); // Parse freqIndex
-
-        // --- Use freqIndex to determine storage location and calculate frequency ---
-        // Important: Assumes freqIndex corresponds to the overall sweep point (0 to TOTAL_SWEEP_POINTS-1)
-        if (freqIndex >= TOTAL_SWEEP_POINTS) {
-            ESP_LOGW(TAG_NANO, "Warning: freqIndex %u out of bounds (0-%d) in chunk %d, point %d. Skipping point.",
-                     freqIndex, TOTAL_SWEEP_POINTS - 1, chunk_index, i);
-            continue; // Skip this point if index is bad, but don't fail the whole chunk unless necessary
+        if (own == 0 && !(client->subscribed & BLE_CLIENT_SUB_RESULT)) {
+            continue;
+        }
+        if (own == 0 && client->notify_backlogged) {
+            ble_client_set_skipped(client->conn_handle, true);
+            ESP_LOGW(TAG_NANO, "Conn 0x%x backed up, skipping its copy of this reading.", client->conn_handle);
+            continue;
         }
 
-        // --- Calculate Frequency from Index using CONFIGURED Step ---
-        // Freq = Configured_Start + Index * Configured_Step
-        double currentFreqHz = (double)CONFIGURED_SWEEP_START_HZ + (double)freqIndex * (double)CONFIGURED_SWEEP_STEP_HZ;
+        int first_rc = -1;
+        uint8_t transfer_id = 0;
+        frame->flags = sweep_flags | (client->skipped_pending ? RESULT_FLAG_SKIPPED : 0);
+        for (size_t i = 0; i < (own > 0 ? served_count : 1); ++i) {
+            if (own > 0 && served[i].conn_handle != client->conn_handle) {
+                continue;
+            }
+            const int64_t notify_start_us = esp_timer_get_time();
+            int rc = ble_send_result_frame(client->conn_handle, frame, own > 0 ? served[i].id : 0);
+            if (rc == 0) {
+                const int64_t notified_us = esp_timer_get_time();
+                latency_record(LATENCY_STAGE_NOTIFY, notified_us - notify_start_us);
+                if (own > 0 || served_count == 0) {
+                    latency_record(LATENCY_STAGE_TOTAL, notified_us - (own > 0 ? served[i].received_us : wake_us));
+                }
+            } else if (rc != BLE_HS_ENOTCONN) {
+                ESP_LOGE(TAG_NANO, "BLE notify to conn 0x%x failed; rc=%d", client->conn_handle, rc);
+            }
+            sent_any = true;
+            if (first_rc < 0) {
+                first_rc = rc;
+                transfer_id = (uint8_t)frame->seq;
+            }
+        }
+        delivered += (first_rc == 0);
+        if (first_rc == 0 && client->skipped_pending) {
+            ble_client_set_skipped(client->conn_handle, false);
+        }
+        if (send_curve && first_rc == 0 && (client->subscribed & BLE_CLIENT_SUB_SWEEP)) {
+            // Curve follows the client's (first) result frame; transfer_id ties the two together
+            ble_send_sweep_curve(client->conn_handle, client->mtu, transfer_id);
+        }
+    }
+    frame->flags = sweep_flags;
+    if (sent_any) {
+        ble_publish_result_frame(frame); // With the seq of the last frame sent for this reading
+    }
+    return delivered;
+}
 
-        // --- Calculate S11 ---
-        double a = (double)rev0Re; double b = (double)rev0Im;
-        double c = (double)fwd0Re; double d = (double)fwd0Im;
-        double denom = c * c + d * d;
-        double s11_re = 0.0, s11_im = 0.0;
-        double current_s11_mag_db = INFINITY; // Default to infinity for this point
+/**
+ * @brief Sends the trace buffer to the client that asked for it, on the trace data
+ * characteristic (layout in trace_buffer.h).
+ */
+static void trace_dump_ble(uint16_t conn_handle)
+{
+    uint8_t packet[BLE_ATT_MTU_MAX];
+    const uint16_t mtu = ble_client_mtu(conn_handle);
+    if (mtu == 0) {
+        ESP_LOGW(TAG_TRACE, "Conn 0x%x disconnected before its trace dump.", conn_handle);
+        return;
+    }
+    const size_t max_packet = (mtu > 3 ? mtu - 3 : 0);
+    trace_dump_t dump;
+    trace_dump_begin(&dump, &trace_buffer, trace_dump_id++);
+
+    size_t len;
+    while ((len = trace_dump_next(&dump, packet, max_packet < sizeof(packet) ? max_packet : sizeof(packet))) > 0) {
+        int rc = ble_notify_chr_wait(conn_handle, gatt_trace_chr_handle, packet, (uint16_t)len);
+        if (rc != 0) {
+            ESP_LOGE(TAG_TRACE, "Trace dump packet %u failed; rc=%d", dump.packet_index - 1, rc);
+            return;
+        }
+    }
+    ESP_LOGI(TAG_TRACE, "Trace dump sent to conn 0x%x: %u records in %u packets.", conn_handle, trace_dump_record_count(&dump), dump.packet_index);
+}
 
-        if (denom > 1e-12) { // Check for non-zero denominator
-            s11_re = (a * c + b * d) / denom;
-            s11_im = (b * c - a * d) / denom;
+/**
+ * @brief Prints the trace buffer to the console, one line per record, oldest first.
+ */
+static void trace_dump_console(void)
+{
+    static const char *const event_names[] = {
+        [TRACE_EV_LOST] = "lost", [TRACE_EV_SWEEP_START] = "sweep_start", [TRACE_EV_SWEEP_END] = "sweep_end",
+        [TRACE_EV_CHUNK] = "chunk", [TRACE_EV_POINT] = "point", [TRACE_EV_POINT_BAD_INDEX] = "bad_index",
+        [TRACE_EV_USB_EVENT] = "usb_event", [TRACE_EV_BLE_COMMAND] = "ble_cmd", [TRACE_EV_BLE_NOTIFY_FAIL] = "notify_fail",
+        [TRACE_EV_REQUEST] = "request", [TRACE_EV_REQUEST_SERVED] = "served", [TRACE_EV_POINT_DROPPED] = "point_dropped",
+        [TRACE_EV_FIFO_RESYNC] = "fifo_resync", [TRACE_EV_FIFO_REREAD] = "fifo_reread",
+        [TRACE_EV_POWER_STATE] = "power_state",
+    };
+    trace_dump_t dump;
+    trace_dump_begin(&dump, &trace_buffer, 0);
+
+    // Formatting happens here, off the sweep path; printf bypasses the console log levels
+    printf("--- trace: %u records ---\n", trace_dump_record_count(&dump));
+    for (uint32_t i = 0; i < trace_dump_record_count(&dump); ++i) {
+        trace_record_t r;
+        if (!trace_buffer_read(&trace_buffer, dump.first_seq + i, &r)) {
+            printf("%" PRIu32 " lost\n", dump.first_seq + i);
+            continue;
+        }
+        const char *name = (r.event < sizeof(event_names) / sizeof(event_names[0]) && event_names[r.event]) ? event_names[r.event] : "?";
+        printf("%" PRIu32 " %10" PRIu32 " us %-12s flags=0x%02x index=%u value=%" PRId32 "\n",
+               r.seq, r.time_us, name, r.flags, r.index, r.value);
+    }
+    printf("--- end of trace ---\n");
+}
 
-            // --- Calculate Magnitude (dB) ---
-            double mag_sq = s11_re * s11_re + s11_im * s11_im;
-            if (mag_sq > 1e-18) { // Avoid log10(0) for valid points
-                current_s11_mag_db = 10.0 * log10(mag_sq); // Use 10*log10(mag_sq) = 20*log10(mag)
-            } else {
-                current_s11_mag_db = -INFINITY; // Treat as perfect match or below noise floor
-            }
+/**
+ * @brief Low-priority task serving "TRACE DUMP" requests, so dumps never hold up a sweep
+ * or the BLE host task.
+ */
+static void trace_dump_task(void *param)
+{
+    while (true) {
+        xSemaphoreTake(trace_dump_sem, portMAX_DELAY);
+        if (trace_dump_to_ble) {
+            trace_dump_ble(trace_dump_conn);
         } else {
-             // Denominator near zero -> S11 is effectively infinite magnitude
-             current_s11_mag_db = INFINITY;
-             // ESP_LOGW(TAG_NANO,"S11 calculation: Near-zero denominator at freqIndex %u", freqIndex);
+            trace_dump_console();
         }
+    }
+}
 
-        ESP_LOGI(TAG_NANO, "current_s11_mag_db: %.9f dB at %.9f MHz (Point Index %u)",
-                 current_s11_mag_db, currentFreqHz / 1e6, freqIndex);
-        // --- Update Running Minimum ---
-        // We only update if the current point's magnitude is finite and less than the minimum found so far
-        if (isfinite(current_s11_mag_db) && current_s11_mag_db < current_min_s11_db) {
-            current_min_s11_db = current_s11_mag_db;
-            freq_at_min_s11_hz = currentFreqHz;
-            // Optional: Log when the minimum is updated
-             ESP_LOGD(TAG_NANO, "New min S11: %.4f dB at %.6f MHz (Point Index %u)",
-                      current_min_s11_db, freq_at_min_s11_hz / 1e6, freqIndex);
+/**
+ * @brief Streams the journaled readings after `after_seq` to one client on the journal
+ * characteristic, packed to that client's MTU. The journal is locked per packet so sweeps
+ * keep appending during a long sync.
+ */
+static void journal_sync_ble(uint16_t conn_handle, uint32_t after_seq)
+{
+    uint8_t packet[BLE_ATT_MTU_MAX];
+    const uint16_t mtu = ble_client_mtu(conn_handle);
+    if (mtu == 0) {
+        ESP_LOGW(TAG_BLE, "Conn 0x%x disconnected before its journal sync.", conn_handle);
+        return;
+    }
+    const size_t max_packet = (mtu > 3 ? mtu - 3 : 0);
+    const int64_t start_us = esp_timer_get_time();
+    result_journal_sync_t sync;
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+    result_journal_sync_begin(&result_journal, &sync, after_seq, journal_sync_id++);
+    xSemaphoreGive(journal_mutex);
+
+    while (true) {
+        xSemaphoreTake(journal_mutex, portMAX_DELAY);
+        const size_t len = result_journal_sync_next(&result_journal, &sync, packet,
+                                                    max_packet < sizeof(packet) ? max_packet : sizeof(packet));
+        xSemaphoreGive(journal_mutex);
+        if (len == 0) {
+            break;
         }
+        int rc = ble_notify_chr_wait(conn_handle, gatt_journal_chr_handle, packet, (uint16_t)len);
+        if (rc != 0) {
+            ESP_LOGE(TAG_BLE, "Journal sync packet %u to conn 0x%x failed; rc=%d", sync.packet_index - 1, conn_handle, rc);
+            return;
+        }
+    }
+    ESP_LOGI(TAG_BLE, "Journal sync to conn 0x%x: %" PRIu32 " records after %" PRIu32 " in %u packets, %lld ms (MTU %u).",
+             conn_handle, sync.records, after_seq, sync.packet_index, (long long)((esp_timer_get_time() - start_us) / 1000), mtu);
+}
 
-        // --- Phase calculation (optional, can be removed if not needed) ---
-        // double current_s11_phase_deg = atan2(s11_im, s11_re) * 180.0 / M_PI;
-
-        // Increment processed point counter (regardless of whether it was the minimum)
-        points_processed_count++;
-
-        // Optional detailed logging per point: Use Verbose level
-         //ESP_LOGV(TAG_NANO, "Chunk %d, Idx %d (FqIdx %u, %.2f MHz): S11: %.4f dB",
-         //         chunk_index, i, freqIndex, currentFreqHz / 1e6, current_s11_mag_db);
+/**
+ * @brief Low-priority task serving "JOURNAL SYNC" requests, so a sync never holds up a sweep
+ * or the BLE host task.
+ */
+static void journal_sync_task(void *param)
+{
+    while (true) {
+        xSemaphoreTake(journal_sync_sem, portMAX_DELAY);
+        journal_sync_ble(journal_sync_conn, journal_sync_after);
+    }
+}
 
-    } // End for loop over points in chunk
-    return success; // Return true if loop completed (even if some points were skipped)
+/**
+ * @brief Appends a reading no client received to the journal.
+ */
+static void journal_append_result(result_frame_t *frame)
+{
+    frame->seq = __atomic_fetch_add(&result_frame_seq, 1, __ATOMIC_RELAXED);
+    frame->request_id = 0;
+    uint8_t encoded[RESULT_FRAME_MAX_LEN];
+    const size_t len = result_frame_encode(frame, encoded, sizeof(encoded));
+    uint32_t journal_seq = 0;
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+    const uint32_t dropped_before = result_journal.dropped;
+    esp_err_t err = result_journal_append(&result_journal, encoded, len, &journal_seq);
+    const uint32_t dropped = result_journal.dropped - dropped_before;
+    const uint32_t pending = result_journal_pending(&result_journal);
+    xSemaphoreGive(journal_mutex);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG_NANO, "Failed to journal the reading: %s", esp_err_to_name(err));
+        return;
+    }
+    if (dropped > 0) {
+        ESP_LOGW(TAG_NANO, "Journal full: overwrote %" PRIu32 " unsynced readings.", dropped);
+    }
+    ESP_LOGI(TAG_NANO, "No client received the reading; journaled as %" PRIu32 " (%" PRIu32 " pending).", journal_seq, pending);
 }
 
-// =========================================================================
-// == NimBLE GATT Server Logic                                            ==
-// =========================================================================
+/**
+ * @brief Allocates the sweep history in PSRAM. Leaves history_ready false without it.
+ */
+static void history_open(void)
+{
+    const size_t size = sweep_history_storage_size(SWEEP_HISTORY_SLOTS, CONFIGURED_SWEEP_POINTS);
+    void *storage = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (storage == NULL) {
+        ESP_LOGW(TAG_MAIN, "No PSRAM for the sweep history (%u bytes); past sweeps are not kept.", (unsigned)size);
+        return;
+    }
+    sweep_history_init(&sweep_history, storage, SWEEP_HISTORY_SLOTS, CONFIGURED_SWEEP_POINTS);
+    history_ready = true;
+    ESP_LOGI(TAG_MAIN, "Sweep history: %u sweeps of up to %u points in PSRAM (%u bytes).",
+             SWEEP_HISTORY_SLOTS, CONFIGURED_SWEEP_POINTS, (unsigned)size);
+}
 
 /**
- * @brief GATT Characteristic Access Callback
+ * @brief Adds the last swept window to the history, with the reading's timestamp and flags.
+ * Called once the reading has gone out.
  */
-static int gatt_chr_access_cb(uint16_t conn_handle_,
-                              uint16_t attr_handle,
-                              struct ble_gatt_access_ctxt *ctxt,
-                              void *arg)
+static void history_add_sweep(const result_frame_t *frame)
 {
-    switch (ctxt->op) {
-        case BLE_GATT_ACCESS_OP_WRITE_CHR: {
-            ESP_LOGI(TAG_BLE, "GATT Write received (conn=0x%x, attr=0x%x)", conn_handle_, attr_handle);
-            uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
-            if (len > 0) {
-                char buf[50]; // Buffer for received command string
-                int rc = ble_hs_mbuf_to_flat(ctxt->om, buf, sizeof(buf) -1, NULL); // Read mbuf into flat buffer
-                 if (rc == 0) {
-                     buf[len] = '\0'; // Null terminate
-                     ESP_LOGI(TAG_BLE, "Write data: \"%s\" (%d bytes)", buf, len);
+    const sweep_history_info_t info = {
+        .timestamp_ms = frame->timestamp_ms,
+        .start_hz = (uint32_t)swept_window.start_hz,
+        .step_hz = (uint32_t)swept_window.step_hz,
+        .points = swept_window.points,
+        .flags = frame->flags,
+        .sweeps_averaged = frame->sweeps_averaged,
+    };
+    xSemaphoreTake(history_mutex, portMAX_DELAY);
+    const uint32_t seq = sweep_history_add(&sweep_history, &info, sweep_curve_cdb, sweep_curve_re, sweep_curve_im,
+                                           swept_points_seen);
+    xSemaphoreGive(history_mutex);
+    ESP_LOGD(TAG_NANO, "Sweep of %u points kept in the history as %" PRIu32 ".", info.points, seq);
+}
 
-                     // Check if the received command is "DATA REQUESTED"
-                     if (strncmp(buf, BLE_TRIGGER_STRING, len) == 0 && len == strlen(BLE_TRIGGER_STRING)) {
-                         ESP_LOGI(TAG_BLE, "Received trigger string! Signaling NanoVNA task.");
-                         // Signal the NanoVNA task to perform a read
-                         xSemaphoreGive(trigger_nanovna_read_sem);
-                     } else {
-                         ESP_LOGW(TAG_BLE, "Ignoring unknown write data.");
-                     }
-                 } else {
-                     ESP_LOGE(TAG_BLE, "Failed to read mbuf flat (rc=%d)", rc);
-                 }
-            }
-             return 0; // Success for write operation
+/**
+ * @brief Streams points `first`..`first + count - 1` of history sweep `seq` (0 = newest) to one
+ * client on the history characteristic, packed to that client's MTU. The history is locked
+ * per packet so sweeps keep being added during a long transfer.
+ */
+static void history_send_ble(uint16_t conn_handle, uint32_t seq, uint16_t first, uint16_t count)
+{
+    uint8_t packet[BLE_ATT_MTU_MAX];
+    const uint16_t mtu = ble_client_mtu(conn_handle);
+    if (mtu == 0) {
+        ESP_LOGW(TAG_BLE, "Conn 0x%x disconnected before its history transfer.", conn_handle);
+        return;
+    }
+    const size_t max_packet = (mtu > 3 ? mtu - 3 : 0);
+    const int64_t start_us = esp_timer_get_time();
+    sweep_history_transfer_t transfer;
+    xSemaphoreTake(history_mutex, portMAX_DELAY);
+    sweep_history_transfer_begin(&sweep_history, &transfer, seq, first, count, history_send_id++);
+    xSemaphoreGive(history_mutex);
+
+    while (true) {
+        xSemaphoreTake(history_mutex, portMAX_DELAY);
+        const size_t len = sweep_history_transfer_next(&sweep_history, &transfer, packet,
+                                                       max_packet < sizeof(packet) ? max_packet : sizeof(packet));
+        xSemaphoreGive(history_mutex);
+        if (len == 0) {
+            break;
+        }
+        int rc = ble_notify_chr_wait(conn_handle, gatt_history_chr_handle, packet, (uint16_t)len);
+        if (rc != 0) {
+            ESP_LOGE(TAG_BLE, "History packet %u to conn 0x%x failed; rc=%d", transfer.packet_index - 1, conn_handle, rc);
+            return;
         }
+    }
+    ESP_LOGI(TAG_BLE, "History sweep %" PRIu32 " to conn 0x%x: status %u, %u points from %u in %u packets, %lld ms (MTU %u).",
+             transfer.seq, conn_handle, transfer.header[1], transfer.count, first, transfer.packet_index,
+             (long long)((esp_timer_get_time() - start_us) / 1000), mtu);
+}
 
-         case BLE_GATT_ACCESS_OP_READ_CHR: {
-             ESP_LOGI(TAG_BLE, "GATT Read received (conn=0x%x, attr=0x%x)", conn_handle_, attr_handle);
-             // Optionally return status or last result. For now, just return latest buffer.
-             int rc = os_mbuf_append(ctxt->om, ble_notify_buffer, strlen(ble_notify_buffer));
-             return (rc == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
-         }
+/**
+ * @brief Low-priority task serving "HISTORY" requests, so a transfer never holds up a sweep
+ * or the BLE host task.
+ */
+static void history_send_task(void *param)
+{
+    while (true) {
+        xSemaphoreTake(history_send_sem, portMAX_DELAY);
+        history_send_ble(history_send_conn, history_send_seq, history_send_first, history_send_count);
+    }
+}
 
-         default:
-             ESP_LOGW(TAG_BLE,"Unhandled GATT Op: %d", ctxt->op);
-             return BLE_ATT_ERR_UNLIKELY;
+/**
+ * @brief MTU exchange completion callback.
+ */
+static int ble_on_mtu_exchanged(uint16_t conn_handle, const struct ble_gatt_error *error, uint16_t mtu, void *arg)
+{
+    if (error->status == 0) {
+        ESP_LOGI(TAG_BLE, "MTU exchange complete; conn=0x%x, mtu=%u", conn_handle, mtu);
+    } else {
+        ESP_LOGW(TAG_BLE, "MTU exchange failed; conn=0x%x, status=%d", conn_handle, error->status);
     }
+    return 0;
 }
 
 /**
- * @brief Define the GATT service and characteristic
+ * @brief Restarts advertising while a client slot is free. A connectable advertiser
+ * stops when a central connects, so this runs after every connect and disconnect.
  */
-static const struct ble_gatt_svc_def gatt_svr_svcs[] = {
-    {
-        .type = BLE_GATT_SVC_TYPE_PRIMARY,
-        .uuid = &SERVICE_UUID.u,
-        .characteristics = (struct ble_gatt_chr_def[]) {
-            {
-                .uuid = &CHARACTERISTIC_UUID.u,
-                .access_cb = gatt_chr_access_cb,
-                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_NOTIFY,
-                .val_handle = &gatt_chr_handle, // Store characteristic value handle
-            },
-            { 0 } // End of characteristics
-        }
-    },
-    { 0 } // End of services
-};
+static void ble_advertise_if_room(void)
+{
+    ble_client_t clients[BLE_MAX_CLIENTS];
+    const size_t client_count = ble_clients_snapshot(clients);
+    if (client_count >= BLE_MAX_CLIENTS) {
+        ESP_LOGI(TAG_BLE, "All %d client slots in use; not advertising.", BLE_MAX_CLIENTS);
+        return;
+    }
+    if (!ble_gap_adv_active()) {
+        ble_app_on_sync();
+    }
+}
 
 /**
  * @brief GAP Event Handler
@@ -387,36 +3376,69 @@ static int gap_event_handler(struct ble_gap_event *event, void *arg)
                 rc = ble_gap_conn_find(event->connect.conn_handle, &desc);
                 if (rc == 0) {
                      ESP_LOGI(TAG_BLE, "Client connected; conn_handle=0x%x", event->connect.conn_handle);
-                     // Store connection handle - ASSUMES ONLY ONE CLIENT for simplicity
-                     current_conn_handle = event->connect.conn_handle;
+                     if (!ble_client_add(event->connect.conn_handle)) {
+                         ESP_LOGW(TAG_BLE, "No free client slot for conn 0x%x; disconnecting.", event->connect.conn_handle);
+                         ble_gap_terminate(event->connect.conn_handle, BLE_ERR_REM_USER_CONN_TERM);
+                         return 0;
+                     }
+                     // Ask for the largest MTU so sweep curves need as few notifications as possible
+                     rc = ble_gattc_exchange_mtu(event->connect.conn_handle, ble_on_mtu_exchanged, NULL);
+                     if (rc != 0) {
+                         ESP_LOGW(TAG_BLE, "Failed to start MTU exchange; rc=%d", rc);
+                     }
+                     // A reading is likely to follow: wake the NanoVNA while the app gets ready
+                     __atomic_store_n(&power_activity, true, __ATOMIC_RELEASE);
+                     request_queue_wake();
                 }
-            } else {
-                // Connection failed, restart advertising
-                ble_app_on_sync(); // Call sync again to restart advertising
             }
+            // Keep advertising for further clients (or again after a failed connection)
+            ble_advertise_if_room();
             return 0;
 
         case BLE_GAP_EVENT_DISCONNECT:
             ESP_LOGI(TAG_BLE, "BLE GAP Event: DISCONNECT; reason=0x%x", event->disconnect.reason);
-             // Check if it was the handle we were tracking
-             if(event->disconnect.conn.conn_handle == current_conn_handle) {
-                 current_conn_handle = BLE_HS_CONN_HANDLE_NONE; // Reset connection handle
-             }
+            if (ble_client_remove(event->disconnect.conn.conn_handle) == 0 && stream_period_ms > 0) {
+                if (journal_ready) {
+                    ESP_LOGI(TAG_BLE, "Last client gone; streamed readings go to the journal.");
+                } else {
+                    stream_period_ms = 0; // Nobody left to stream to
+                }
+            }
             // Restart advertising
-            ble_app_on_sync();
+            ble_advertise_if_room();
             return 0;
 
          case BLE_GAP_EVENT_ADV_COMPLETE:
             ESP_LOGI(TAG_BLE, "BLE GAP Event: ADV_COMPLETE");
              // Can sometimes happen if advertising times out (though we use BLE_HS_FOREVER)
              // Restart advertising if needed
-             ble_app_on_sync();
+             ble_advertise_if_room();
+             return 0;
+
+        case BLE_GAP_EVENT_CONN_UPDATE:
+             if (event->conn_update.status == 0 && ble_gap_conn_find(event->conn_update.conn_handle, &desc) == 0) {
+                 ESP_LOGI(TAG_BLE, "Connection updated; conn=0x%x, interval=%u.%02u ms, latency=%u, timeout=%u ms",
+                          desc.conn_handle, desc.conn_itvl * 5 / 4, (desc.conn_itvl * 125) % 100,
+                          desc.conn_latency, desc.supervision_timeout * 10);
+             } else {
+                 ESP_LOGW(TAG_BLE, "Connection update failed; conn=0x%x, status=%d",
+                          event->conn_update.conn_handle, event->conn_update.status);
+             }
              return 0;
 
         // Handle MTU changes (good practice)
         case BLE_GAP_EVENT_MTU:
              ESP_LOGI(TAG_BLE, "BLE GAP MTU changed; conn=0x%x, tx_mtu=%d",
                       event->mtu.conn_handle, event->mtu.value);
+             ble_client_set_mtu(event->mtu.conn_handle, event->mtu.value);
+             return 0;
+
+        // CCCD writes decide which clients get result frames, sweep curves and trace dumps
+        case BLE_GAP_EVENT_SUBSCRIBE:
+             ESP_LOGI(TAG_BLE, "BLE GAP Event: SUBSCRIBE; conn=0x%x, attr=0x%x, notify=%d",
+                      event->subscribe.conn_handle, event->subscribe.attr_handle, event->subscribe.cur_notify);
+             ble_client_set_subscription(event->subscribe.conn_handle, event->subscribe.attr_handle,
+                                         event->subscribe.cur_notify);
              return 0;
 
          default:
@@ -440,6 +3462,8 @@ static void ble_app_on_sync(void)
     memset(&adv_params, 0, sizeof(adv_params));
     adv_params.conn_mode = BLE_GAP_CONN_MODE_UND; // Undirected Connectable
     adv_params.disc_mode = BLE_GAP_DISC_MODE_GEN; // General Discoverable
+    adv_params.itvl_min = (uint16_t)(ble_adv_itvl_ms * 8 / 5); // 0.625 ms units; slower while idle
+    adv_params.itvl_max = adv_params.itvl_min;
 
     // Specify Public Address type (or determine dynamically if needed)
     rc = ble_gap_adv_start(BLE_OWN_ADDR_PUBLIC,      // Specify Public Address type
@@ -451,7 +3475,7 @@ static void ble_app_on_sync(void)
     if (rc != 0) {
         ESP_LOGE(TAG_BLE, "Error starting advertising; rc=%d", rc);
     } else {
-        ESP_LOGI(TAG_BLE, "BLE Advertising started");
+        ESP_LOGI(TAG_BLE, "BLE Advertising started (interval %u ms)", ble_adv_itvl_ms);
     }
 }
 /**
@@ -463,6 +3487,122 @@ static void ble_app_on_reset(int reason)
 }
 
 
+// =========================================================================
+// == Power Management                                                    ==
+// =========================================================================
+
+/**
+ * @brief Asks every connected client's central for a connection interval of `itvl_ms`.
+ * The central decides; BLE_GAP_EVENT_CONN_UPDATE reports what it chose.
+ */
+static void ble_request_conn_interval(uint16_t itvl_ms)
+{
+    const uint32_t timeout_ms = (6u * itvl_ms > POWER_SUPERVISION_MIN_MS) ? 6u * itvl_ms : POWER_SUPERVISION_MIN_MS;
+    const struct ble_gap_upd_params params = {
+        .itvl_min = (uint16_t)(itvl_ms * 4 / 5), // 1.25 ms units
+        .itvl_max = (uint16_t)(itvl_ms * 4 / 5),
+        .latency = 0,
+        .supervision_timeout = (uint16_t)(timeout_ms / 10), // 10 ms units
+    };
+    ble_client_t clients[BLE_MAX_CLIENTS];
+    const size_t client_count = ble_clients_snapshot(clients);
+    for (size_t c = 0; c < client_count; ++c) {
+        const int rc = ble_gap_update_params(clients[c].conn_handle, &params);
+        if (rc != 0) {
+            ESP_LOGW(TAG_BLE, "Failed to request a %u ms interval on conn 0x%x; rc=%d", itvl_ms, clients[c].conn_handle, rc);
+        }
+    }
+}
+
+/**
+ * @brief Advertises at `itvl_ms` from now on, restarting advertising if it is running.
+ */
+static void ble_set_adv_interval(uint16_t itvl_ms)
+{
+    ble_adv_itvl_ms = itvl_ms;
+    if (ble_gap_adv_active()) {
+        ble_gap_adv_stop();
+        ble_advertise_if_room();
+    }
+}
+
+/**
+ * @brief Switches the NanoVNA's VBUS. The CPU_FREQ_MAX lock is taken before the NanoVNA
+ * comes up and dropped after it is gone, so the USB host never sees light sleep.
+ */
+static void nanovna_set_power(bool on)
+{
+#if CONFIG_PM_ENABLE
+    if (on) {
+        esp_pm_lock_acquire(nanovna_pm_lock);
+    }
+#endif
+#if NANOVNA_VBUS_EN_GPIO >= 0
+    gpio_set_level(NANOVNA_VBUS_EN_GPIO, on ? 1 : 0);
+#endif
+#if CONFIG_PM_ENABLE
+    if (!on) {
+        esp_pm_lock_release(nanovna_pm_lock);
+    }
+#endif
+}
+
+/**
+ * @brief Runs the power state machine (NanoVNA task): records activity if `active` (or a
+ * client connected or "POWER" was received meanwhile), otherwise makes any transition due,
+ * then applies the intervals and NanoVNA power of the new state.
+ * @return the state now in force
+ */
+static power_state_t power_service(bool active)
+{
+    static const char *const state_names[POWER_STATE_COUNT] = { "active", "idle", "suspended" };
+    active |= __atomic_exchange_n(&power_activity, false, __ATOMIC_ACQ_REL);
+    const int64_t now_us = esp_timer_get_time();
+
+    xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+    const power_state_t from = active ? power_idle_activity(&power_idle, now_us) : power_idle_update(&power_idle, now_us);
+    const power_state_t to = power_idle.state;
+    const uint16_t adv_itvl_ms = power_idle_adv_itvl_ms(&power_idle);
+    const uint16_t conn_itvl_ms = power_idle_conn_itvl_ms(&power_idle);
+    xSemaphoreGive(diag_stats_mutex);
+    if (from == to) {
+        return to;
+    }
+
+    ESP_LOGI(TAG_NANO, "Power state %s -> %s (advertising every %u ms, connection interval %u ms).",
+             state_names[from], state_names[to], adv_itvl_ms, conn_itvl_ms);
+    TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_INFO, now_us, TRACE_EV_POWER_STATE, 0, from, to);
+    if (to == POWER_STATE_SUSPENDED) {
+        // Remember the window the NanoVNA is left with; the disconnect event ends the inner loop
+        suspended_sweep_window = active_sweep_window;
+        suspended_sweep_window_valid = active_sweep_window_valid;
+        nanovna_set_power(false);
+    } else if (from == POWER_STATE_SUSPENDED) {
+        nanovna_set_power(true);
+        power_wake_reading_due = true;
+    }
+    if ((from == POWER_STATE_ACTIVE) != (to == POWER_STATE_ACTIVE)) {
+        ble_set_adv_interval(adv_itvl_ms);
+        ble_request_conn_interval(conn_itvl_ms);
+    }
+    return to;
+}
+
+/**
+ * @brief Ticks until the next idle or suspend transition is due, or portMAX_DELAY if none is.
+ */
+static TickType_t power_wait_ticks(void)
+{
+    xSemaphoreTake(diag_stats_mutex, portMAX_DELAY);
+    const int64_t next_us = power_idle_next_us(&power_idle, esp_timer_get_time());
+    xSemaphoreGive(diag_stats_mutex);
+    if (next_us < 0) {
+        return portMAX_DELAY;
+    }
+    return (TickType_t)((next_us * configTICK_RATE_HZ + 999999) / 1000000) + 1;
+}
+
+
 // =========================================================================
 // == Background Tasks                                                    ==
 // =========================================================================
@@ -484,7 +3624,7 @@ static void nimble_host_task(void *param)
  */
 static void usb_lib_task(void *param)
 {
-    ESP_LOGI(TAG_USB, "USB host library task started");
+    ESP_LOGI(TAG_USB, "USB host library task started on core %d", (int)xPortGetCoreID());
     while (1) {
         uint32_t event_flags;
         esp_err_t err = usb_host_lib_handle_events(portMAX_DELAY, &event_flags);
@@ -515,26 +3655,28 @@ static void usb_lib_task(void *param)
  */
 static void nanovna_control_task(void *param)
 {
-     ESP_LOGI(TAG_NANO,"NanoVNA Control Task Started");
+     ESP_LOGI(TAG_NANO,"NanoVNA Control Task Started on core %d", (int)xPortGetCoreID());
 
      // --- Main application loop for USB Connection Lifecycle ---
      while (true) {
+         // Suspended: the NanoVNA stays unpowered until a request, a client or a command needs it
+         while (power_service(pending_requests.count > 0 || stream_restart ||
+                              nanovna_action_pending()) == POWER_STATE_SUSPENDED) {
+             sweep_request_t request;
+             if (xQueueReceive(sweep_request_queue, &request, portMAX_DELAY) == pdTRUE && request.kind == SWEEP_REQUEST_READ &&
+                 sweep_request_set_add(&pending_requests, &request) == SWEEP_REQUEST_DUPLICATE) {
+                 ble_client_request_release(request.conn_handle);
+             }
+         }
+         const bool resuming = power_wake_reading_due; // Set by the wake until its first reading
+         const int64_t resume_start_us = esp_timer_get_time();
+
          // Reset global handle before attempting connection
          current_cdc_dev = NULL;
 
-         // Configuration for the USB device when opened
-         const cdc_acm_host_device_config_t dev_config = {
-             .connection_timeout_ms = 5000,
-             .out_buffer_size = TX_BUFFER_SIZE,
-             .in_buffer_size = RX_BUFFER_SIZE, // Sized for ONE CHUNK
-             .event_cb = handle_usb_event,
-             .data_cb = handle_usb_rx,
-             .user_arg = NULL
-         };
-
          ESP_LOGI(TAG_NANO, "Waiting for NanoVNA (VID:0x%04X, PID:0x%04X) to connect...", NANOVNA_VID, NANOVNA_PID);
          // This call blocks until device connects or timeout
-         esp_err_t err = cdc_acm_host_open(NANOVNA_VID, NANOVNA_PID, NANOVNA_INTERFACE, &dev_config, (cdc_acm_dev_hdl_t *)&current_cdc_dev); // Cast needed for volatile
+         esp_err_t err = nanovna_open(usb_rx_buffer_size);
 
          if (err != ESP_OK) {
              ESP_LOGD(TAG_NANO, "NanoVNA not found or failed to open (%s). Retrying...", esp_err_to_name(err));
@@ -551,64 +3693,26 @@ static void nanovna_control_task(void *param)
           if (err != ESP_OK) {
               ESP_LOGW(TAG_NANO,"Failed to set DTR/RTS: %s", esp_err_to_name(err));
          }
-         vTaskDelay(pdMS_TO_TICKS(100)); // Short delay
 
          // ********************************************************************
          // ** START: ADDED CONFIGURATION COMMANDS                          **
          // ********************************************************************
          ESP_LOGI(TAG_NANO, "Sending configuration commands...");
 
-         // Command sequences based on previous analysis
-         // sweepStartHz = 2,200,000,000 -> WRITE8 @ Addr 00
-         const uint8_t cmd_set_start_hz[] = {0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x21, 0x56, 0x00};
-         // sweepStepHz = 391,000 -> WRITE8 @ Addr 10
-         const uint8_t cmd_set_step_hz[] = {0x23, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x58};
-         // sweepPoints = 1024 -> WRITE2 @ Addr 20
-         const uint8_t cmd_set_points[] = {0x21, 0x20, 0x04, 0x00};
-         // valuesPerFrequency = 10 -> WRITE2 @ Addr 22
-         const uint8_t cmd_set_vals_per_freq[] = {0x21, 0x22, 0x00, 0x0A};
-
-         bool config_ok = true;
-
-         ESP_LOGI(TAG_NANO, "Setting Sweep Start Frequency...");
-         err = cdc_acm_host_data_tx_blocking(current_cdc_dev, cmd_set_start_hz, sizeof(cmd_set_start_hz), TX_TIMEOUT_MS);
-         if (err != ESP_OK) {
-             ESP_LOGE(TAG_NANO, "Failed to send sweepStartHz config: %s", esp_err_to_name(err));
-             config_ok = false;
-         }
-         vTaskDelay(pdMS_TO_TICKS(50)); // Small delay between commands
-
-         if (config_ok) {
-             ESP_LOGI(TAG_NANO, "Setting Sweep Step Frequency...");
-             err = cdc_acm_host_data_tx_blocking(current_cdc_dev, cmd_set_step_hz, sizeof(cmd_set_step_hz), TX_TIMEOUT_MS);
-             if (err != ESP_OK) {
-                 ESP_LOGE(TAG_NANO, "Failed to send sweepStepHz config: %s", esp_err_to_name(err));
-                 config_ok = false;
-             }
-         }
-         vTaskDelay(pdMS_TO_TICKS(50)); // Small delay between commands
-
-         if (config_ok) {
-             ESP_LOGI(TAG_NANO, "Setting Sweep Points...");
-             err = cdc_acm_host_data_tx_blocking(current_cdc_dev, cmd_set_points, sizeof(cmd_set_points), TX_TIMEOUT_MS);
-             if (err != ESP_OK) {
-                 ESP_LOGE(TAG_NANO, "Failed to send sweepPoints config: %s", esp_err_to_name(err));
-                 config_ok = false;
-             }
+         // Handshake and register readback; only registers that differ are rewritten (see nanovna_proto.h)
+         if (!resuming) {
+             tracking_locked = false;       // May be a different sensor; re-acquire before tracking
          }
-         vTaskDelay(pdMS_TO_TICKS(50)); // Small delay between commands
-
-         if (config_ok) {
-             ESP_LOGI(TAG_NANO, "Setting Values Per Frequency...");
-             err = cdc_acm_host_data_tx_blocking(current_cdc_dev, cmd_set_vals_per_freq, sizeof(cmd_set_vals_per_freq), TX_TIMEOUT_MS);
-             if (err != ESP_OK) {
-                 ESP_LOGE(TAG_NANO, "Failed to send valuesPerFrequency config: %s", esp_err_to_name(err));
-                 config_ok = false;
-             }
+         sweep_profile_apply_requested(); // Selected while disconnected or suspended
+         const int64_t config_start_us = esp_timer_get_time();
+         bool config_ok = nanovna_configure_on_connect(resuming && suspended_sweep_window_valid ? &suspended_sweep_window : NULL);
+         ESP_LOGI(TAG_NANO, "Configuration took %lld us.", (long long)(esp_timer_get_time() - config_start_us));
+         if (resuming) {
+             ESP_LOGI(TAG_NANO, "NanoVNA back %lld ms after the wake.", (long long)((esp_timer_get_time() - resume_start_us) / 1000));
          }
 
          if (config_ok) {
-             ESP_LOGI(TAG_NANO, "Configuration commands sent successfully.");
+             ESP_LOGI(TAG_NANO, "NanoVNA configuration verified.");
          } else {
              ESP_LOGE(TAG_NANO, "Configuration failed! Check connection and device state.");
              // Decide how to handle config failure - maybe disconnect and retry?
@@ -619,135 +3723,196 @@ static void nanovna_control_task(void *param)
          // ********************************************************************
 
 
-         // --- Inner loop: Wait for BLE trigger and perform CHUNKED read ---
+         // --- Inner loop: Serve queued requests and streaming periods with CHUNKED reads ---
+         TickType_t next_stream_tick = xTaskGetTickCount();
          while (current_cdc_dev != NULL) {
-             ESP_LOGI(TAG_NANO, "Waiting for BLE trigger to read %d points in %d chunks...", TOTAL_SWEEP_POINTS, NUM_CHUNKS);
-             // Wait indefinitely for the trigger semaphore from BLE callback
-             if (xSemaphoreTake(trigger_nanovna_read_sem, portMAX_DELAY) == pdTRUE) {
-                 ESP_LOGI(TAG_NANO, "BLE trigger received! Starting chunked read and on-the-fly minimum S11 calculation...");
-
-                 // --- RESET stream processing state for this sweep ---
-                 current_min_s11_db = INFINITY;
-                 freq_at_min_s11_hz = 0.0;
-                 points_processed_count = 0;
-                 // ----------------------------------------------------
-
-                 bool read_error = false;
-                 // Optional: Add overall timeout start time
-                 // int64_t start_time = esp_timer_get_time();
-
-                 // Clear the FIFO (opcode 0x20 = WRITE, 0x30 = FIFO_ADDR_VALUES, 0x00 = dummy)
-                uint8_t clear_fifo_cmd[] = { 0x20, FIFO_ADDR_VALUES, 0x00 };
-                esp_err_t err = cdc_acm_host_data_tx_blocking(
-                    current_cdc_dev,
-                    clear_fifo_cmd,
-                    sizeof(clear_fifo_cmd),
-                    TX_TIMEOUT_MS
-                );
-                if (err != ESP_OK) {
-                    ESP_LOGE(TAG_NANO, "Failed to clear FIFO: %s", esp_err_to_name(err));
-                    // handle error…
-                }
-
-                 for (int chunk = 0; chunk < NUM_CHUNKS; ++chunk) {
-                     // Check if device disconnected during multi-chunk read
-                     if (current_cdc_dev == NULL) {
-                         ESP_LOGW(TAG_NANO,"Device disconnected during chunk read (%d/%d).", chunk + 1, NUM_CHUNKS);
-                         read_error = true;
-                         break; // Exit chunk loop
-                     }
-
-                     // Prepare the READFIFO command for the current chunk
-                     // NOTE: NanoVNA expects number of POINTS for 0x18 command, not bytes.
-                     uint8_t fifoCmd[3] = {DFU_CMD_READFIFO, FIFO_ADDR_VALUES, CHUNK_NUM_VALUES & 0xFF};
-                     ESP_LOGI(TAG_NANO, "Requesting Chunk %d/%d (%d points)...", chunk + 1, NUM_CHUNKS, CHUNK_NUM_VALUES);
-
-                     // Reset receive state for the chunk
-                     current_chunk_rx_count = 0;
-                     xSemaphoreTake(fifo_data_ready_sem, 0); // Clear stale signal before waiting
-
-                     // Send the command
-                     err = cdc_acm_host_data_tx_blocking(current_cdc_dev, fifoCmd, sizeof(fifoCmd), TX_TIMEOUT_MS);
-                     if (err != ESP_OK) {
-                         ESP_LOGE(TAG_NANO, "Failed to send READFIFO command for chunk %d: %s", chunk + 1, esp_err_to_name(err));
-                         read_error = true;
-                         break; // Exit chunk loop on TX error
-                     }
-
-                     // Wait for the complete chunk data
-                     // ESP_LOGD(TAG_NANO, "Waiting for %d bytes for chunk %d...", CHUNK_EXPECTED_BYTES, chunk + 1);
-                     BaseType_t got_semaphore = xSemaphoreTake(fifo_data_ready_sem, pdMS_TO_TICKS(RX_CHUNK_TIMEOUT_MS));
-
-                     if (got_semaphore == pdTRUE && current_chunk_rx_count >= CHUNK_EXPECTED_BYTES) {
-                         // Double check count, semaphore might be given slightly early in some scenarios?
-                         if (current_chunk_rx_count < CHUNK_EXPECTED_BYTES) {
-                             ESP_LOGW(TAG_NANO, "Semaphore received for chunk %d but rx count %d < expected %d.", chunk + 1, (int)current_chunk_rx_count, (int)CHUNK_EXPECTED_BYTES);
-                             // Treat as incomplete data
-                             read_error = true;
-                             break;
-                         }
-                         ESP_LOGD(TAG_NANO, "Chunk %d data received (%d bytes). Processing and updating minimum...", chunk + 1, (int)current_chunk_rx_count);
-                         // Process this chunk's points and update the running minimum S11/Frequency
-                         if (!process_chunk_and_update_min(chunk)) {
-                             ESP_LOGE(TAG_NANO, "Error processing data for chunk %d.", chunk + 1);
-                             read_error = true;
-                             break; // Exit chunk loop on processing error
-                         }
-                         // points_processed_count is incremented inside process_chunk_and_update_min
-                     } else {
-                         ESP_LOGE(TAG_NANO, "TIMEOUT or incomplete data for chunk %d. Got %d/%d bytes.",
-                                  chunk + 1, (int)current_chunk_rx_count, (int)CHUNK_EXPECTED_BYTES);
-                         read_error = true;
-                         break; // Exit chunk loop on RX error/timeout
-                     }
-                     // Small delay between chunks? Maybe not needed if VNA/USB handles it.
-                     // vTaskDelay(pdMS_TO_TICKS(20));
-
-                 } // --- End of chunk loop ---
-
-                 // --- After attempting all chunks ---
-                 memset(ble_notify_buffer, 0, BLE_NOTIFY_BUF_SIZE); // Clear notification buffer
-
-                 if (!read_error && points_processed_count >= TOTAL_SWEEP_POINTS) {
-                     ESP_LOGI(TAG_NANO, "All %d chunks received and %d points processed successfully.", NUM_CHUNKS, (int)points_processed_count);
-                     // Check if a valid minimum was found (i.e., not still INFINITY)
-                     if (isfinite(current_min_s11_db)) {
-                         ESP_LOGI(TAG_NANO, "Overall Resonant Point Found:");
-                         ESP_LOGI(TAG_NANO, "  Frequency: %.6f MHz", freq_at_min_s11_hz / 1e6); // Increased precision
-                         ESP_LOGI(TAG_NANO, "  Min S11 Mag: %.4f dB", current_min_s11_db);      // Increased precision
-
-                         // Format notification string: "FreqGHz,MagdB" (adjust precision to fit)
-                         snprintf(ble_notify_buffer, BLE_NOTIFY_BUF_SIZE, "%.6f,%.4f", // Using more precision
-                                  freq_at_min_s11_hz / 1e9, // Freq in GHz
-                                  current_min_s11_db);      // Mag in dB
-                     } else {
-                         ESP_LOGW(TAG_NANO, "Sweep completed but no valid finite S11 minimum found.");
-                         snprintf(ble_notify_buffer, BLE_NOTIFY_BUF_SIZE, "Error: No finite min");
-                     }
+             if (stream_restart) {
+                 stream_restart = false;
+                 next_stream_tick = xTaskGetTickCount(); // First streamed reading goes out now
+             }
+             // Block only when nothing is pending: until a request, a wake-up or the next streaming period
+             sweep_request_t request;
+             if (pending_requests.count == 0) {
+                 ESP_LOGI(TAG_NANO, "Waiting for BLE request (%s sweep)...",
+                          sweep_mode == SWEEP_MODE_COARSE_FINE ? "coarse-to-fine" : sweep_mode == SWEEP_MODE_TRACKING ? "tracking" : "full");
+                 TickType_t wait_ticks = portMAX_DELAY;
+                 if (stream_period_ms > 0) {
+                     TickType_t now = xTaskGetTickCount();
+                     wait_ticks = (int32_t)(next_stream_tick - now) > 0 ? next_stream_tick - now : 0;
                  } else {
-                      ESP_LOGE(TAG_NANO, "Failed to complete full sweep read. Error occurred or not all points processed (%d/%d).",
-                              (int)points_processed_count, TOTAL_SWEEP_POINTS);
-                      // Prepare error notification
-                      snprintf(ble_notify_buffer, BLE_NOTIFY_BUF_SIZE, "Error: Read failed (%d/%d pts)", (int)points_processed_count, TOTAL_SWEEP_POINTS);
+                     wait_ticks = power_wait_ticks(); // Wake up to idle or suspend
+                 }
+                 if (xQueueReceive(sweep_request_queue, &request, wait_ticks) == pdTRUE &&
+                     request.kind == SWEEP_REQUEST_READ) {
+                     sweep_request_set_add(&pending_requests, &request); // Set is empty: always added
+                 }
+             }
+             // Drain whatever else arrived; anything beyond the pending set waits in the queue
+             while (!sweep_request_set_full(&pending_requests) &&
+                    xQueueReceive(sweep_request_queue, &request, 0) == pdTRUE) {
+                 if (request.kind == SWEEP_REQUEST_READ &&
+                     sweep_request_set_add(&pending_requests, &request) == SWEEP_REQUEST_DUPLICATE) {
+                     ESP_LOGI(TAG_NANO, "Request %u from conn 0x%x already pending; coalesced.", request.id, request.conn_handle);
+                     ble_client_request_release(request.conn_handle);
                  }
+             }
+             const int64_t wake_us = esp_timer_get_time();
+             if (current_cdc_dev == NULL) {
+                 break; // Woken by the disconnect event; pending requests are served after reconnecting
+             }
+             // Anything that needs the NanoVNA is activity; streaming keeps the sensor active
+             if (power_service(pending_requests.count > 0 || stream_period_ms > 0 || stream_restart ||
+                               nanovna_action_pending()) == POWER_STATE_SUSPENDED) {
+                 continue; // VBUS is off; the disconnect event follows
+             }
+             const cal_action_t cal_step = (cal_action_t)__atomic_exchange_n(&cal_action, CAL_ACTION_NONE, __ATOMIC_ACQ_REL);
+             if (cal_step != CAL_ACTION_NONE) {
+                 calibration_run(cal_step); // Pending requests are served next
+                 continue;
+             }
+             sweep_profile_apply_requested();
+             if (usb_tune_run_requested()) {
+                 continue; // Pending requests are served next, with the tuned sizes
+             }
 
-                 // Send notification (success or error message) via BLE
-                 if (current_conn_handle != BLE_HS_CONN_HANDLE_NONE) {
-                     ESP_LOGI(TAG_NANO,"Sending BLE Notification: \"%s\"", ble_notify_buffer);
-                     struct os_mbuf *om = ble_hs_mbuf_from_flat(ble_notify_buffer, strlen(ble_notify_buffer));
-                     if (om) {
-                         int rc = ble_gatts_notify_custom(current_conn_handle, gatt_chr_handle, om);
-                         if (rc != 0) {
-                             ESP_LOGE(TAG_NANO, "BLE notify failed; rc=%d", rc);
+             sweep_request_t served[SWEEP_REQUEST_PENDING_MAX];
+             const size_t taken_count = sweep_request_set_take(&pending_requests, served, SWEEP_REQUEST_PENDING_MAX);
+             // Requests of clients that have since disconnected are dropped unanswered
+             size_t served_count = 0;
+             for (size_t i = 0; i < taken_count; ++i) {
+                 if (ble_client_mtu(served[i].conn_handle) == 0) {
+                     ESP_LOGW(TAG_NANO, "Dropping request %u: conn 0x%x disconnected.", served[i].id, served[i].conn_handle);
+                     continue;
+                 }
+                 served[served_count++] = served[i];
+             }
+             if (taken_count > 0 && served_count == 0) {
+                 continue;
+             }
+             const bool triggered = (served_count > 0);
+             if (!triggered) {
+                 TickType_t now = xTaskGetTickCount();
+                 if (stream_period_ms == 0 || stream_restart || (int32_t)(next_stream_tick - now) > 0) {
+                     continue; // Streaming off, restarting, or woken before the period is due
+                 }
+                 // Periodic reading. Falling behind restarts the schedule instead of bursting to catch up.
+                 next_stream_tick += pdMS_TO_TICKS(stream_period_ms);
+                 if ((int32_t)(next_stream_tick - now) <= 0) {
+                     next_stream_tick = now + pdMS_TO_TICKS(stream_period_ms);
+                 }
+                 // Backpressure: skip this period rather than queue results the link cannot drain.
+                 // With no client connected the reading is taken for the journal instead.
+                 ble_client_t clients[BLE_MAX_CLIENTS];
+                 const size_t client_count = ble_clients_snapshot(clients);
+                 if (!(journal_ready && client_count == 0) && ble_link_backlogged()) {
+                     for (size_t c = 0; c < client_count; ++c) {
+                         if (clients[c].subscribed & BLE_CLIENT_SUB_RESULT) {
+                             ble_client_set_skipped(clients[c].conn_handle, true); // Re-probed with the next reading
                          }
-                     } else {
-                         ESP_LOGE(TAG_NANO,"Failed to allocate mbuf for BLE notification");
                      }
+                     stream_skipped_count++;
+                     ESP_LOGW(TAG_NANO, "BLE link backed up, skipping streamed reading (%" PRIu32 " skipped).", stream_skipped_count);
+                     continue;
+                 }
+             } else if (stream_period_ms > 0) {
+                 // Explicit request: schedule the next periodic reading from now
+                 next_stream_tick = xTaskGetTickCount() + pdMS_TO_TICKS(stream_period_ms);
+             }
+             if (triggered) {
+                 ESP_LOGI(TAG_NANO, "Serving request %u (priority %u)%s. Starting chunked read...", served[0].id, served[0].priority,
+                          served_count > 1 ? " with coalesced requests" : "");
+             } else {
+                 ESP_LOGI(TAG_NANO, "Streaming period elapsed. Starting chunked read...");
+             }
+
+             // Each request waited from its write; a streamed reading starts when the task wakes
+             const int64_t sweep_start_us = esp_timer_get_time();
+             if (triggered) {
+                 for (size_t i = 0; i < served_count; ++i) {
+                     latency_record(LATENCY_STAGE_TRIGGER_WAIT, sweep_start_us - served[i].received_us);
+                     TRACE_EVENT(&trace_buffer, TRACE_TAG_NANO, TRACE_LEVEL_INFO, sweep_start_us, TRACE_EV_REQUEST_SERVED,
+                                 i > 0 ? TRACE_REQUEST_COALESCED : 0, served[i].id, (int32_t)(sweep_start_us - served[i].received_us));
+                 }
+             } else {
+                 latency_record(LATENCY_STAGE_TRIGGER_WAIT, sweep_start_us - wake_us);
+             }
+
+             const sweep_mode_t mode = triggered ? (sweep_mode_t)served[0].mode : sweep_mode;
+             const uint8_t averages = triggered ? served[0].averages : average_sweeps;
+             sweep_profile_use(triggered ? served[0].profile : __atomic_load_n(&active_profile, __ATOMIC_ACQUIRE));
+             int total_points_acquired = 0;
+             uint8_t sweeps_averaged = 1;
+             double noise_db = NAN;
+             bool sweep_ok = perform_averaged_sweep(mode, averages, &total_points_acquired, &sweeps_averaged, &noise_db);
+             if (sweep_ok) {
+                 latency_record(LATENCY_STAGE_SWEEP, esp_timer_get_time() - sweep_start_us);
+             }
+
+             // --- After attempting all chunks ---
+             result_frame_t frame = {
+                 .timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000),
+                 .points_acquired = (uint16_t)total_points_acquired,
+                 .sweeps_averaged = sweeps_averaged,
+                 .noise_cdb = (sweeps_averaged >= 2) ? result_frame_db_to_cdb(noise_db) : 0,
+             };
+             if (!triggered) {
+                 frame.flags |= RESULT_FLAG_STREAMED;
+             }
+             if (served_count > 1) {
+                 frame.flags |= RESULT_FLAG_COALESCED;
+             }
+
+             if (sweep_ok) {
+                 ESP_LOGI(TAG_NANO, "Sweep complete: %d points acquired.", total_points_acquired);
+                 // Check if a valid minimum was found (i.e., not still INFINITY)
+                 if (isfinite(current_min_s11_db)) {
+                     ESP_LOGI(TAG_NANO, "Overall Resonant Point Found:");
+                     ESP_LOGI(TAG_NANO, "  Frequency: %.6f MHz", freq_at_min_s11_hz / 1e6); // Increased precision
+                     ESP_LOGI(TAG_NANO, "  Min S11 Mag: %.4f dB", current_min_s11_db);      // Increased precision
+                     find_dips(&frame);
+                     frame.flags |= RESULT_FLAG_VALID;
+                     frame.resonance_hz = (uint32_t)llround(freq_at_min_s11_hz);
+                     frame.s11_cdb = result_frame_db_to_cdb(current_min_s11_db);
+
+                     // Run the model on the same (GHz, dB) inputs the app used to pass to score()
+                     const double model_input[XGB_MODEL_NUM_FEATURES] = { freq_at_min_s11_hz / 1e9, current_min_s11_db };
+                     const int64_t model_start_us = esp_timer_get_time();
+                     frame.model_output = (float)xgb_table_score(model_input);
+                     latency_record(LATENCY_STAGE_MODEL, esp_timer_get_time() - model_start_us);
+                     frame.flags |= RESULT_FLAG_HAS_MODEL;
+                     ESP_LOGI(TAG_NANO, "  Model output: %.4f (model 0x%08" PRIX32 ")", frame.model_output, xgb_model_table_id);
                  } else {
-                     ESP_LOGW(TAG_NANO,"No BLE client connected, cannot send notification.");
+                     ESP_LOGW(TAG_NANO, "Sweep completed but no valid finite S11 minimum found.");
+                     frame.flags |= RESULT_FLAG_NO_MINIMUM;
                  }
+             } else {
+                  ESP_LOGE(TAG_NANO, "Failed to complete sweep read. Error occurred or not all points processed (%d/%d in stage).",
+                          (int)points_processed_count, swept_window.points);
+                  frame.flags |= RESULT_FLAG_READ_ERROR;
+             }
 
-             } // End if(xSemaphoreTake trigger)
+             // One frame per request answered, one per other subscribed client
+             const size_t delivered = ble_fan_out_result(&frame, served, served_count, wake_us, sweep_dump_enabled && sweep_ok);
+             if (delivered == 0 && journal_ready) {
+                 journal_append_result(&frame);
+             }
+             if (history_ready && frame.points_acquired > 0) {
+                 history_add_sweep(&frame);
+             }
+             if (power_wake_reading_due) {
+                 // Time to first reading after a wake, from the trigger that waited longest
+                 power_wake_reading_due = false;
+                 int64_t trigger_us = wake_us;
+                 for (size_t i = 0; i < served_count; ++i) {
+                     trigger_us = (served[i].received_us < trigger_us) ? served[i].received_us : trigger_us;
+                 }
+                 const int64_t wake_reading_us = esp_timer_get_time() - trigger_us;
+                 latency_record(LATENCY_STAGE_WAKE, wake_reading_us);
+                 ESP_LOGI(TAG_NANO, "First reading after the wake took %lld ms.", (long long)(wake_reading_us / 1000));
+             }
+             for (size_t i = 0; i < served_count; ++i) {
+                 ble_client_request_release(served[i].conn_handle);
+             }
          } // --- End of inner communication loop ---
 
          ESP_LOGI(TAG_NANO, "NanoVNA disconnected or error occurred in inner loop. Waiting for USB disconnect event to be fully processed...");
@@ -778,30 +3943,103 @@ void app_main(void)
     }
     ESP_ERROR_CHECK(ret);
     ESP_LOGI(TAG_MAIN, "NVS Initialized.");
+    config_cache_load();
+    calibration_load();
+    journal_mutex = xSemaphoreCreateMutex();
+    assert(journal_mutex != NULL);
+    journal_sync_sem = xSemaphoreCreateBinary();
+    assert(journal_sync_sem != NULL);
+    journal_open();
+    history_mutex = xSemaphoreCreateMutex();
+    assert(history_mutex != NULL);
+    history_send_sem = xSemaphoreCreateBinary();
+    assert(history_send_sem != NULL);
+    history_open();
 
     // --- 2. Create Semaphores ---
     device_disconnected_sem = xSemaphoreCreateBinary();
     assert(device_disconnected_sem != NULL);
     fifo_data_ready_sem = xSemaphoreCreateBinary();
     assert(fifo_data_ready_sem != NULL);
-    trigger_nanovna_read_sem = xSemaphoreCreateBinary();
-    assert(trigger_nanovna_read_sem != NULL);
-    ESP_LOGI(TAG_MAIN, "Semaphores Created.");
+    point_ring_init(&fifo_point_ring);
+    fifo_framer_init(&fifo_framer);
+    sweep_request_queue = xQueueCreate(REQUEST_QUEUE_LEN, sizeof(sweep_request_t));
+    assert(sweep_request_queue != NULL);
+    sweep_request_set_init(&pending_requests);
+    diag_stats_mutex = xSemaphoreCreateMutex();
+    assert(diag_stats_mutex != NULL);
+    latency_stats_reset(&sweep_latency_stats, esp_timer_get_time());
+    chunk_timing_start();
+    sweep_profiles_mutex = xSemaphoreCreateMutex();
+    assert(sweep_profiles_mutex != NULL);
+    sweep_profiles_load();
+    usb_tune_load();
+    trace_buffer_init(&trace_buffer, TRACE_DEFAULT_LEVEL);
+    trace_dump_sem = xSemaphoreCreateBinary();
+    assert(trace_dump_sem != NULL);
+    ble_clients_mutex = xSemaphoreCreateMutex();
+    assert(ble_clients_mutex != NULL);
+    result_frame_mutex = xSemaphoreCreateMutex();
+    assert(result_frame_mutex != NULL);
+    for (size_t i = 0; i < BLE_MAX_CLIENTS; ++i) {
+        ble_clients[i].conn_handle = BLE_HS_CONN_HANDLE_NONE;
+    }
+    ESP_LOGI(TAG_MAIN, "Semaphores and Request Queue Created.");
+
+    // Power management: start ACTIVE with the NanoVNA powered (see power_idle.h)
+    const power_idle_config_t power_config = {
+        .idle_after_ms = POWER_IDLE_AFTER_MS_DEFAULT,
+        .suspend_after_ms = POWER_SUSPEND_AFTER_MS_DEFAULT,
+        .adv_itvl_ms = { POWER_ADV_ITVL_ACTIVE_MS, POWER_ADV_ITVL_IDLE_MS },
+        .conn_itvl_ms = { POWER_CONN_ITVL_ACTIVE_MS, POWER_CONN_ITVL_IDLE_MS },
+    };
+    power_idle_init(&power_idle, &power_config, esp_timer_get_time());
+#if CONFIG_PM_ENABLE
+    ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "nanovna", &nanovna_pm_lock));
+    const esp_pm_config_t pm_config = {
+        .max_freq_mhz = POWER_MAX_CPU_FREQ_MHZ,
+        .min_freq_mhz = POWER_MIN_CPU_FREQ_MHZ,
+        .light_sleep_enable = true,
+    };
+    ret = esp_pm_configure(&pm_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG_MAIN, "Automatic light sleep unavailable (%s); suspending only powers down the NanoVNA.", esp_err_to_name(ret));
+    }
+#endif
+#if NANOVNA_VBUS_EN_GPIO >= 0
+    const gpio_config_t vbus_gpio_config = {
+        .pin_bit_mask = 1ULL << NANOVNA_VBUS_EN_GPIO,
+        .mode = GPIO_MODE_OUTPUT,
+    };
+    ESP_ERROR_CHECK(gpio_config(&vbus_gpio_config));
+#endif
+    nanovna_set_power(true);
+    ESP_LOGI(TAG_MAIN, "Power management: idle after %" PRIu32 " ms, suspend after %" PRIu32 " ms.",
+             power_config.idle_after_ms, power_config.suspend_after_ms);
 
     // --- 3. Initialize USB Host ---
     ESP_LOGI(TAG_MAIN, "Initializing USB Host Library...");
     const usb_host_config_t host_config = { .intr_flags = ESP_INTR_FLAG_LEVEL1 };
     ESP_ERROR_CHECK(usb_host_install(&host_config));
     ESP_LOGI(TAG_MAIN, "Initializing CDC-ACM Host driver...");
-    ESP_ERROR_CHECK(cdc_acm_host_install(NULL)); // Install CDC driver
+    // The driver task runs handle_usb_rx(), so it stays with the USB stack
+    const cdc_acm_host_driver_config_t cdc_driver_config = {
+        .driver_task_stack_size = 4096,
+        .driver_task_priority = USB_HOST_TASK_PRIORITY,
+        .xCoreID = USB_BLE_CORE,
+        .new_dev_cb = NULL,
+    };
+    ESP_ERROR_CHECK(cdc_acm_host_install(&cdc_driver_config)); // Install CDC driver
     // Start USB library task
-    BaseType_t task_created = xTaskCreate(usb_lib_task, "usb_lib", 4096, NULL, USB_HOST_TASK_PRIORITY, NULL);
+    BaseType_t task_created = xTaskCreatePinnedToCore(usb_lib_task, "usb_lib", 4096, NULL, USB_HOST_TASK_PRIORITY, NULL, USB_BLE_CORE);
     assert(task_created == pdTRUE);
     ESP_LOGI(TAG_MAIN, "USB Host Initialized and Task Started.");
 
     // --- 4. Initialize NimBLE ---
     ESP_LOGI(TAG_MAIN, "Initializing NimBLE Stack...");
     nimble_port_init();
+    // Advertise the largest ATT MTU we support; the client's answer sets the sweep packet size
+    ble_att_set_preferred_mtu(BLE_ATT_MTU_MAX);
 
     // Configure the BLE host stack
     ble_hs_cfg.sync_cb  = ble_app_on_sync;
@@ -832,10 +4070,17 @@ void app_main(void)
 
     // --- 5. Start NanoVNA Control Task ---
     // Increased stack size for safety due to chunk processing logic/loops
-    task_created = xTaskCreate(nanovna_control_task, "nanovna_task", 8192, NULL, NANOVNA_TASK_PRIORITY, NULL);
+    task_created = xTaskCreatePinnedToCore(nanovna_control_task, "nanovna_task", 8192, NULL, NANOVNA_TASK_PRIORITY, NULL, PROCESSING_CORE);
     assert(task_created == pdTRUE);
     ESP_LOGI(TAG_MAIN, "NanoVNA Control Task Started.");
 
+    task_created = xTaskCreatePinnedToCore(trace_dump_task, "trace_dump", 4096, NULL, TRACE_DUMP_TASK_PRIORITY, NULL, PROCESSING_CORE);
+    assert(task_created == pdTRUE);
+    task_created = xTaskCreatePinnedToCore(journal_sync_task, "journal_sync", 4096, NULL, JOURNAL_SYNC_TASK_PRIORITY, NULL, PROCESSING_CORE);
+    assert(task_created == pdTRUE);
+    task_created = xTaskCreatePinnedToCore(history_send_task, "history_send", 4096, NULL, HISTORY_SEND_TASK_PRIORITY, NULL, PROCESSING_CORE);
+    assert(task_created == pdTRUE);
+
     ESP_LOGI(TAG_MAIN, "Initialization Complete. System Running.");
     // app_main can exit now, background tasks will run.
 }
\ No newline at end of file
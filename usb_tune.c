@@ -0,0 +1,174 @@
+#include <string.h>
+#include "nvs.h"
+#include "usb_tune.h"
+#include "le_bytes.h"
+
+#define USB_TUNE_NVS_KEY    "best"
+
+/**
+ * @brief Mean of the counted sweeps, or 0 if there are none.
+ */
+static uint32_t candidate_mean_us(const usb_tune_candidate_t *candidate)
+{
+    const uint8_t counted = (candidate->sweeps > 1) ? candidate->sweeps - 1 : 0;
+    if (counted == 0 || candidate->failures > 0) {
+        return 0;
+    }
+    const uint64_t mean_us = candidate->total_us / counted;
+    return (mean_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)mean_us;
+}
+
+void usb_tune_begin(usb_tune_t *tune, const uint16_t *buffer_sizes, size_t buffer_count,
+                    const uint8_t *chunk_sizes, size_t chunk_count, uint8_t sweeps)
+{
+    memset(tune, 0, sizeof(*tune));
+    for (size_t b = 0; b < buffer_count; ++b) {
+        for (size_t c = 0; c < chunk_count && tune->count < USB_TUNE_MAX_CANDIDATES; ++c) {
+            tune->candidates[tune->count++].config = (usb_tune_config_t){
+                .rx_buffer_size = buffer_sizes[b],
+                .chunk_points = chunk_sizes[c],
+            };
+        }
+    }
+    tune->sweeps = (sweeps > 0) ? sweeps : 1;
+    tune->state = USB_TUNE_RUNNING;
+    tune->best = -1;
+}
+
+bool usb_tune_next(const usb_tune_t *tune, usb_tune_config_t *config)
+{
+    if (tune->state != USB_TUNE_RUNNING || tune->current >= tune->count) {
+        return false;
+    }
+    *config = tune->candidates[tune->current].config;
+    return true;
+}
+
+void usb_tune_record(usb_tune_t *tune, bool ok, int64_t sweep_us)
+{
+    if (tune->state != USB_TUNE_RUNNING || tune->current >= tune->count) {
+        return;
+    }
+    usb_tune_candidate_t *candidate = &tune->candidates[tune->current];
+    const bool warm_up = (candidate->sweeps == 0);
+    candidate->sweeps++;
+    if (!ok) {
+        candidate->failures++;
+        tune->current++;
+        return;
+    }
+    if (!warm_up && sweep_us > 0) {
+        candidate->total_us += (uint64_t)sweep_us;
+        if ((uint64_t)sweep_us > candidate->max_us) {
+            candidate->max_us = (sweep_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)sweep_us;
+        }
+    }
+    if (candidate->sweeps > tune->sweeps) {
+        tune->current++;
+    }
+}
+
+bool usb_tune_finish(usb_tune_t *tune, bool aborted, usb_tune_config_t *best)
+{
+    tune->best = -1;
+    uint32_t best_us = 0;
+    for (uint8_t i = 0; i < tune->count; ++i) {
+        const usb_tune_candidate_t *candidate = &tune->candidates[i];
+        const uint32_t mean_us = candidate_mean_us(candidate);
+        // Only candidates that got every counted sweep compete
+        if (mean_us == 0 || candidate->sweeps <= tune->sweeps) {
+            continue;
+        }
+        if (tune->best < 0 || mean_us < best_us) {
+            tune->best = i;
+            best_us = mean_us;
+        }
+    }
+    if (aborted || tune->best < 0) {
+        tune->best = -1;
+        tune->state = USB_TUNE_FAILED;
+        return false;
+    }
+    tune->state = USB_TUNE_DONE;
+    *best = tune->candidates[tune->best].config;
+    return true;
+}
+
+uint32_t usb_tune_best_mean_us(const usb_tune_t *tune)
+{
+    return (tune->best >= 0) ? candidate_mean_us(&tune->candidates[tune->best]) : 0;
+}
+
+size_t usb_tune_encode(const usb_tune_t *tune, uint8_t *out, size_t max_len)
+{
+    const size_t len = USB_TUNE_HEADER_LEN + (size_t)tune->count * USB_TUNE_CANDIDATE_LEN;
+    if (max_len < len) {
+        return 0;
+    }
+    const usb_tune_candidate_t *best = (tune->best >= 0) ? &tune->candidates[tune->best] : NULL;
+    out[0] = USB_TUNE_FORMAT;
+    out[1] = (uint8_t)tune->state;
+    out[2] = tune->count;
+    out[3] = tune->sweeps;
+    le_put_u16(out + 4, best ? best->config.rx_buffer_size : 0);
+    out[6] = best ? best->config.chunk_points : 0;
+    out[7] = 0;
+    le_put_u32(out + 8, usb_tune_best_mean_us(tune));
+    uint8_t *p = out + USB_TUNE_HEADER_LEN;
+    for (uint8_t i = 0; i < tune->count; ++i, p += USB_TUNE_CANDIDATE_LEN) {
+        const usb_tune_candidate_t *candidate = &tune->candidates[i];
+        le_put_u16(p, candidate->config.rx_buffer_size);
+        p[2] = candidate->config.chunk_points;
+        p[3] = candidate->failures;
+        le_put_u32(p + 4, candidate_mean_us(candidate));
+        le_put_u32(p + 8, candidate->max_us);
+    }
+    return len;
+}
+
+esp_err_t usb_tune_nvs_load(usb_tune_config_t *config, const char *nvs_namespace)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(nvs_namespace, NVS_READONLY, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    usb_tune_nvs_t stored;
+    size_t len = sizeof(stored);
+    err = nvs_get_blob(handle, USB_TUNE_NVS_KEY, &stored, &len);
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (len != sizeof(stored) || stored.format != USB_TUNE_NVS_FORMAT) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+    config->rx_buffer_size = stored.rx_buffer_size;
+    config->chunk_points = stored.chunk_points;
+    return ESP_OK;
+}
+
+esp_err_t usb_tune_nvs_store(const usb_tune_t *tune, const char *nvs_namespace)
+{
+    if (tune->state != USB_TUNE_DONE || tune->best < 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const usb_tune_candidate_t *best = &tune->candidates[tune->best];
+    const usb_tune_nvs_t stored = {
+        .format = USB_TUNE_NVS_FORMAT,
+        .chunk_points = best->config.chunk_points,
+        .rx_buffer_size = best->config.rx_buffer_size,
+        .mean_us = usb_tune_best_mean_us(tune),
+    };
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(nvs_namespace, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_set_blob(handle, USB_TUNE_NVS_KEY, &stored, sizeof(stored));
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return err;
+}
@@ -0,0 +1,132 @@
+// usb_tune.h
+// Benchmark of the READFIFO chunk size and the USB receive buffer size. How fast a
+// sweep comes in depends on the NanoVNA firmware, the cable and the hub, so the sizes
+// are measured per unit instead of guessed: every pair of candidate sizes is given the
+// same number of sweeps over the same window, and the pair with the lowest mean sweep
+// time wins. A pair with a failed sweep is out. The first sweep of each pair warms up
+// (reopened device, reprogrammed window, chunk timing) and is not counted.
+//
+// Candidates are ordered buffer size first, so the device is reopened once per buffer
+// size rather than per pair.
+//
+// Report layout (little-endian):
+//  Offset  Size  Field
+//  0       1     format           (USB_TUNE_FORMAT)
+//  1       1     state            (usb_tune_state_t)
+//  2       1     candidate_count
+//  3       1     sweeps           (counted per candidate)
+//  4       2     best rx_buffer_size (0 = none)
+//  6       1     best chunk_points
+//  7       1     reserved         (0)
+//  8       4     best mean_us
+//  12      12*N  per candidate: u16 rx_buffer_size, u8 chunk_points, u8 failures,
+//                u32 mean_us (0 = not measured), u32 max_us
+//
+// NVS layout (namespace chosen by the caller):
+//  "best"    blob  usb_tune_nvs_t (format, the winning sizes and their mean sweep time)
+#ifndef USB_TUNE_H
+#define USB_TUNE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define USB_TUNE_FORMAT           (1)
+#define USB_TUNE_NVS_FORMAT       (1)
+#define USB_TUNE_MAX_CANDIDATES   (24)
+#define USB_TUNE_HEADER_LEN       (12)
+#define USB_TUNE_CANDIDATE_LEN    (12)
+#define USB_TUNE_ENCODED_MAX_LEN  (USB_TUNE_HEADER_LEN + USB_TUNE_MAX_CANDIDATES * USB_TUNE_CANDIDATE_LEN)
+
+typedef enum {
+    USB_TUNE_IDLE = 0,       // Never run since boot
+    USB_TUNE_RUNNING,
+    USB_TUNE_DONE,           // best holds the winner
+    USB_TUNE_FAILED,         // No candidate completed all its sweeps, or the device went away
+} usb_tune_state_t;
+
+typedef struct {
+    uint16_t rx_buffer_size;
+    uint8_t chunk_points;
+} usb_tune_config_t;
+
+typedef struct {
+    usb_tune_config_t config;
+    uint8_t sweeps;          // Sweeps taken so far, warm-up included
+    uint8_t failures;
+    uint64_t total_us;       // Of the counted sweeps
+    uint32_t max_us;
+} usb_tune_candidate_t;
+
+typedef struct {
+    usb_tune_candidate_t candidates[USB_TUNE_MAX_CANDIDATES];
+    uint8_t count;
+    uint8_t sweeps;          // Counted sweeps per candidate
+    uint8_t current;         // Candidate being measured
+    usb_tune_state_t state;
+    int best;                // Index of the winner, or -1
+} usb_tune_t;
+
+typedef struct {
+    uint8_t format;
+    uint8_t chunk_points;
+    uint16_t rx_buffer_size;
+    uint32_t mean_us;
+} usb_tune_nvs_t;
+
+/**
+ * @brief Starts a run over every pair of `buffer_sizes` and `chunk_sizes` (up to
+ * USB_TUNE_MAX_CANDIDATES pairs), `sweeps` counted sweeps each.
+ */
+void usb_tune_begin(usb_tune_t *tune, const uint16_t *buffer_sizes, size_t buffer_count,
+                    const uint8_t *chunk_sizes, size_t chunk_count, uint8_t sweeps);
+
+/**
+ * @brief Sizes to take the next sweep with.
+ * @return false once every candidate has been measured
+ */
+bool usb_tune_next(const usb_tune_t *tune, usb_tune_config_t *config);
+
+/**
+ * @brief Records the sweep taken with the sizes from usb_tune_next(). A failed sweep ends its candidate.
+ */
+void usb_tune_record(usb_tune_t *tune, bool ok, int64_t sweep_us);
+
+/**
+ * @brief Ends the run (early if `aborted`) and picks the winner.
+ * @return true with `best` set if a candidate completed all its sweeps
+ */
+bool usb_tune_finish(usb_tune_t *tune, bool aborted, usb_tune_config_t *best);
+
+/**
+ * @brief Mean sweep time of the winner, as usb_tune_encode() reports it.
+ * @return 0 if there is no winner
+ */
+uint32_t usb_tune_best_mean_us(const usb_tune_t *tune);
+
+/**
+ * @brief Encodes the run (layout above).
+ * @return Length written, or 0 if `max_len` is too small
+ */
+size_t usb_tune_encode(const usb_tune_t *tune, uint8_t *out, size_t max_len);
+
+/**
+ * @brief Loads the sizes stored under `nvs_namespace` by usb_tune_nvs_store().
+ */
+esp_err_t usb_tune_nvs_load(usb_tune_config_t *config, const char *nvs_namespace);
+
+/**
+ * @brief Stores the winner of a finished run under `nvs_namespace`.
+ */
+esp_err_t usb_tune_nvs_store(const usb_tune_t *tune, const char *nvs_namespace);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // USB_TUNE_H
@@ -0,0 +1,5939 @@
+// xgb_model_table.c
+// GENERATED by xgb_model_table.py from xgb_model.c - do not edit by hand.
+#include "xgb_model_table.h"
+
+const uint32_t xgb_model_table_id = 0x932AF7F5u;
+const uint16_t xgb_model_table_num_trees = 200;
+const uint16_t xgb_model_table_num_nodes = 31428;
+
+static const uint16_t xgb_tree_root[200] = {
+    0, 79, 194, 293, 426, 531, 658, 791, 944, 1111, 1282, 1465, 1634, 1791, 1968, 2133,
+    2334, 2473, 2662, 2751, 2968, 3169, 3354, 3537, 3658, 3847, 3950, 4161, 4268, 4465, 4690, 4897,
+    5026, 5241, 5456, 5567, 5744, 5963, 6136, 6307, 6484, 6661, 6852, 7043, 7236, 7431, 7642, 7783,
+    7948, 7997, 8222, 8391, 8444, 8589, 8786, 8923, 9148, 9359, 9524, 9721, 9890, 9947, 10092, 10309,
+    10540, 10613, 10784, 10947, 11122, 11307, 11502, 11667, 11870, 11909, 12042, 12239, 12434, 12533, 12742, 12933,
+    13108, 13323, 13512, 13685, 13860, 13899, 14050, 14209, 14390, 14487, 14670, 14879, 15090, 15279, 15454, 15595,
+    15668, 15871, 16050, 16203, 16412, 16571, 16742, 16899, 17082, 17193, 17368, 17533, 17578, 17753, 17866, 18039,
+    18168, 18257, 18418, 18567, 18724, 18917, 18996, 19125, 19256, 19397, 19532, 19629, 19766, 19837, 19996, 20177,
+    20242, 20401, 20588, 20757, 20940, 21007, 21136, 21235, 21304, 21467, 21526, 21695, 21848, 22015, 22192, 22317,
+    22494, 22623, 22826, 22991, 23186, 23367, 23550, 23725, 23864, 24017, 24090, 24199, 24350, 24543, 24742, 24931,
+    25124, 25265, 25456, 25639, 25806, 25949, 26170, 26341, 26492, 26655, 26782, 26887, 27028, 27213, 27404, 27543,
+    27714, 27903, 28094, 28245, 28354, 28467, 28596, 28747, 28924, 29099, 29242, 29447, 29600, 29785, 29930, 30107,
+    30254, 30399, 30528, 30701, 30880, 30957, 31108, 31281
+};
+
+static const double xgb_node_value[31428] = {
+    -1.5751029, -2.4040701, -3.2152596, -6.131815, 8.48, -7.485508, 8.13, 12.0179205,
+    9.49956, 6.53, 12.163721, 13.473792, 9.38, -6.389413, 9.209161, 10.902564,
+    -7.722872, 9.646512, 12.31875, 6.49, 5.79, -3.593756, 13.260172, 11.825954,
+    6.06, 10.316667, 8.678992, -5.784454, 8.68, 14.577777, 12.885982, 14.795905,
+    5.12, 2.01, 13.42, -2.9810855, 11.503226, 10.329851, 8.977298, 4.53,
+    -1.960713, 2.37, 2.13, 12.72, 8.32, 14.6193075, 3.48, 2.4,
+    2.17, 12.666667, 8.45, 3.1, 14.8, 13.239081, -1.7678375, 12.153506,
+    10.96875, 8.397163, 2.78, 2.25, 13.859311, -0.6559018, 13.411635, 2.48,
+    11.63038, -0.30146822, 10.680412, 9.1891165, -1.2630312, 3.48, 11.981132, 9.576398,
+    4.45, 3.24, -0.771789, 10.658201, 8.836559, 8.652427, 11.931035, -1.4832442,
+    -6.2222686, 8.4, -8.718564, 7.93, -11.26825, 7.57, 9.550321, 7.3567843,
+    6.49, 11.159953, 9.733865, -9.847813, 6.0863695, 8.05, 8.211297, 6.6697707,
+    6.18, 4.57, 1.88, 11.237094, 8.013364, 6.02, 12.149809, 10.820587,
+    6.53, -7.3014965, 9.023959, 7.0480056, 8.05, 11.923468, 10.005783, 9.46,
+    -6.5924907, 8.64, -6.961682, 6.8497024, 8.584653, 6.4765434, 8.64, 10.393895,
+    9.34, 7.558207, 9.093697, -7.667374, 9.84, 6.5616884, -7.8932815, 7.1518426,
+    8.989338, 9.8, -7.349471, 7.3950005, 10.004309, 11.490376, 3.94, 2.4,
+    2.01, 1.93, 11.716773, 9.543408, 2.13, 8.196443, 6.643823, -1.8541082,
+    11.839995, 3.2, 11.507814, 9.50479, -3.4696734, 5.4, 4.57, 8.8659725,
+    11.628444, -4.750224, 6.49, 9.81882, 10.868503, 5.63, 9.135742, 6.99151,
+    4.53, -2.0137024, 11.437457, -1.6862178, 9.330355, 7.9511466, -2.8076367, 5.24,
+    9.550361, 7.082049, 7.1668544, 2.67, 2.25, 11.128748, -0.48152414, 10.655122,
+    2.4, 9.487305, 7.987317, 3.13, -0.9247528, 9.786238, -0.48152414, 8.063151,
+    6.8576045, 4.45, 3.75, -1.114961, 8.262628, 6.8786736, 6.831796, -0.3603938,
+    9.759604, 3.742529, -1.6287112, -2.4040701, -3.1480272, -6.1628103, 8.44, -8.018251,
+    7.97, 7.6981835, 5.904403, 6.53, 7.828319, 8.675574, 9.42, -6.417596,
+    5.857939, 6.994353, -7.617456, 6.43544, 8.055263, 6.49, 5.83, -3.593756,
+    8.529394, 7.513601, 6.1, 6.2698903, 4.8777785, -5.784454, 9.27, 8.052894,
+    9.616207, 9.680542, 5.04, 4.53, 7.958117, -2.6292815, 4.61, 4.791559,
+    7.1202364, 5.9078956, 5.7080946, 4.53, -2.040998, 2.37, 2.05, 8.691949,
+    5.9539104, 4.45, -2.196643, 10.0482645, 9.218952, 6.7229266, 3.56, 2.4,
+    2.09, 8.721972, 5.8127475, 3.13, 9.71906, 8.722614, -1.8216634, 7.916024,
+    7.174208, 5.306436, 2.9, -0.8777573, 2.37, 2.01, 9.334954, -1.2343782,
+    2.21, 6.470314, 4.010236, 7.8559566, -1.1948682, 9.453001, 8.221425, 2.33,
+    2.09, 9.789537, 8.523301, -0.3603938, 7.3139625, 2.55, 6.7296867, 5.637714,
+    -1.362035, 3.63, 7.5763297, 6.230863, 4.45, 3.51, -0.9800166, 6.78466,
+    5.564082, 5.3483953, -0.3603938, 8.0784235, 3.2435246, -1.4217949, -6.2222686, 8.28,
+    -11.26825, 7.61, -19.76686, 7.18, 6.4328547, 3.866778, 1.38, 4.293056,
+    6.255802, -12.962669, 3.3163788, 7.77, 5.3765526, 3.3971882, 1.77, 8.500593,
+    2.21, 1.93, 5.9680896, 3.4066007, 6.26, 7.433468, 6.366173, 9.46,
+    -6.910217, -7.722872, 3.4156857, 8.8, 4.445352, 2.3380623, 8.6, -6.5924907,
+    6.3181334, 7.624115, -6.4524984, 4.352758, 5.2578063, -7.7751694, -8.018251, 3.6301892,
+    9.88, 4.0068197, 5.167118, 9.84, -6.7859416, 5.5845046, 7.429094, -7.5758924,
+    6.7807083, 8.226828, 3.78, 2.44, 1.97, 1.88, 8.1117325, 6.6832995,
+    2.09, -3.6424093, 4.4531856, 6.1046343, -3.4696734, 3.0201037, 4.439922, -1.7983414,
+    -2.0137024, 8.054362, 3.32, 7.8587775, 6.799965, 2.94, 7.831407, 6.237912,
+    -3.3498714, 5.28, 4.61, -4.2262564, 6.4506464, 5.057301, -3.7061508, 8.298489,
+    7.3937798, -4.2262564, 5.67, 7.7711916, 6.473817, 5.55, 5.2468653, 3.5857313,
+    4.53, -2.1208782, 4.45, 7.7507806, 5.5221806, -1.7983414, 6.249664, 5.2494507,
+    -2.7231896, 5.28, 5.856016, 4.139131, -2.2326505, 4.5831313, 3.9074516, 2.59,
+    2.13, 7.5564957, -0.30146822, 6.762169, 2.37, 6.334514, 5.1595564, 3.06,
+    -0.7202588, -1.0684927, 6.618562, 5.7042336, -0.18892978, 2.86, 5.248391, 4.4061594,
+    4.102912, 4.45, 3.86, -1.0684927, 3.36, 5.5885334, 4.854858, 4.3182054,
+    4.1257133, 6.292167, -1.6287112, -2.4040701, -3.0695794, -6.131815, 8.52, 4.53,
+    1.73, 4.892814, 3.4174023, 6.14, 6.2657213, 5.0064707, 9.34, 8.76,
+    4.385166, 3.4092774, -6.511228, 4.70226, 6.0315146, 6.49, 5.72, 4.57,
+    4.3574204, 5.516781, -5.254704, 4.477493, 3.0666502, -5.949599, 8.64, 6.6612945,
+    4.6728044, -5.682901, 5.9070907, 6.9366927, 5.0, 4.53, -2.8076367, 2.17,
+    4.9712243, 2.4628716, 2.37, 4.7432113, 7.0227304, 4.65, 3.21927, 4.447018,
+    3.5479457, 4.53, -2.0923567, 2.37, 2.21, 5.5051074, 3.1364167, -2.2551181,
+    4.49, 6.632322, 3.2547193, 3.67, 6.666134, 5.6436396, 3.44, 2.4,
+    2.25, 5.476424, 3.1908097, 6.106226, -1.8803589, 5.2165556, 4.7182994, 3.400055,
+    2.74, -0.9247528, 2.33, 2.05, 5.80232, 3.8680997, 6.136087, 2.33,
+    2.05, 6.5270233, 5.548899, -0.18892978, 4.6738963, 2.52, 4.2477837, 3.4995706,
+    -1.2630312, 3.32, 5.185844, 4.02, 4.219585, 3.6563134, 4.45, 3.4,
+    -0.82226276, 2.98, 4.737505, 4.141181, 2.98, 3.748263, 3.2965786, 3.344041,
+    -0.48152414, 5.607385, 3.4047582, -1.4217949, -6.3148303, 8.36, -11.773308, 7.53,
+    2.05, 1.66, 3.9145753, 2.0703971, 6.79, 4.771199, 3.9540143, -13.937053,
+    -16.183819, 0.8481757, 1.7529429, 7.69, 3.8696535, 1.8521613, 1.77, 5.959148,
+    2.17, 1.97, 3.7898808, 1.6950448, 6.34, 4.798116, 4.0459495, 9.61,
+    -6.7859416, 8.87, -7.20367, 1.983147, 2.823836, -7.01124, 0.79481894, 2.1411352,
+    9.5, 8.72, 4.2325444, 2.871414, -6.653369, 4.301463, 5.648155, -7.5758924,
+    9.88, 9.77, 1.1789387, 2.6560209, -7.832062, 2.8694596, 4.648042, 9.77,
+    -7.1555967, 3.0249996, 5.610008, -7.349471, 5.254091, 6.4506974, 9.27, 3.86,
+    2.44, 1.97, 1.85, 5.8142633, 4.5863743, 2.09, 3.441756, 2.3091319,
+    -1.9079165, 3.36, 5.401487, 4.876289, 3.02, 5.0792465, 4.0208244, -3.5361924,
+    5.32, 4.61, 3.9598439, 5.299222, -4.4179254, 4.238212, 2.721631, 5.16,
+    -1.8216634, 4.035947, 3.332632, 5.48, 2.8258247, 1.6482857, 5.24768, 2.59,
+    2.09, 5.0336185, -0.5968429, 2.21, 2.784115, 4.677562, 2.29, 4.5203886,
+    2.44, 3.7485416, 3.2009702, 3.02, -0.54071695, -1.1551399, 4.3988376, 3.7007568,
+    -0.14428757, 2.82, 3.2541008, 2.584288, 2.5108025, 4.45, 3.75, -1.0267481,
+    3.59, 3.460304, 2.9592528, -0.5968429, 2.804578, 2.274558, 2.6384282, -0.3603938,
+    4.25855, 1.5181316, -1.6287112, -2.4040701, -3.3498714, -5.987348, 8.6, -7.054926,
+    8.2, 3.1825912, 1.741791, 6.53, 2.8756769, 4.27632, 9.3, 8.8,
+    2.676453, 1.9155724, -6.511228, 2.998828, 3.9824474, 6.49, 5.91, 5.55,
+    3.710179, 2.9392786, 6.18, 1.6836249, 0.62445277, -5.682901, 8.72, 4.8894496,
+    3.612581, 4.717342, 5.08, 1.93, 4.4640446, -3.0695794, 4.65, 1.9894949,
+    3.691378, 4.53, 3.2824833, 2.5856788, 5.4, -2.7231896, 2.5516534, 1.8639567,
+    5.6, 1.7301081, 5.67, 0.88356894, 0.36387208, 4.53, -2.1208782, -2.3197646,
+    4.45, 2.37, 2.8606558, 4.735391, -2.357731, 0.4407463, 2.0407465, 3.9,
+    4.2332993, 3.7889168, 3.63, 3.28, 2.4, 3.3786945, 4.0497165, -1.7140237,
+    3.6773095, 2.9935424, 4.36, 4.02, 3.1713083, 2.825538, 3.6187787, -2.173437,
+    5.04, 2.1509995, 1.5264105, 1.5139621, 2.71, -0.9247528, 2.44, -1.114961,
+    2.05, 3.6571157, -1.362035, 1.4421514, 2.8829067, 2.29, 2.05, 3.6117718,
+    1.857181, 4.4204535, -1.114961, 4.4922347, 3.432286, 2.33, 2.01, 4.4735565,
+    3.5921795, -0.4176023, 3.1291091, 2.44, 2.9502335, 2.454356, 3.28, -0.8777573,
+    -1.1948682, 3.3454602, 2.857538, -0.5968429, 3.13, 2.731423, 2.1942308, 2.127602,
+    4.49, -1.3340919, 4.06, 2.7226102, 2.3194478, -0.771789, 4.45, 2.2177036,
+    3.479616, -0.4176023, 1.5242817, 2.4854033, -0.48152414, 4.0205083, 1.0275463, -1.5448009,
+    2.4, 1.85, -16.991007, -19.668941, 1.58, 0.83, 2.4470775, 3.1806152,
+    -25.265562, -0.00036961536, 1.4323597, 1.34, -19.330385, 1.4435861, 0.29985282, 1.69,
+    4.290152, 1.1450518, 1.69, 4.9845753, -9.50892, 1.77, 3.1467597, 2.037546,
+    3.9471798, -8.85124, -14.672277, 1.88, -17.44737, -0.49256048, 0.16789742, -0.5500572,
+    1.93, 1.88, 1.1865453, 0.7797746, -11.515594, -0.42673165, 0.27975056, 2.05,
+    -3.6424093, 2.01, 2.2351663, 1.4181684, 3.2206075, -3.4696734, 2.17, 0.70866597,
+    0.062491175, 2.25, 2.1079733, 1.1886777, 3.71, -1.98534, 3.439053, 2.86,
+    3.5422592, -1.7429106, 2.9684885, 2.5249171, -3.7061508, 5.91, -5.004444, 4.57,
+    2.4090917, 4.072965, 5.52, 3.3596056, 1.6192251, -5.4127874, -5.878716, 2.5155647,
+    3.0912943, 5.99, 1.3034763, 0.7181972, 5.08, -3.3498714, 4.65, 1.8245236,
+    3.663173, 4.45, 2.7586775, 2.1471596, 5.52, 5.36, 1.8715972, 1.3933449,
+    -3.2152596, 0.5370061, 1.1753056, 2.63, 2.13, -0.3603938, 1.97, 3.671833,
+    2.140036, 3.6144912, -0.30146822, -1.1551399, 2.37, -1.2343782, 0.69560856, 1.7003405,
+    2.44, 2.7750318, 3.8216903, 2.4, -1.0684927, 1.7931544, 3.0805244, -0.82226276,
+    2.8355331, 2.2702138, 2.21, 2.89624, 2.52, -0.10486277, 2.3816955, 2.053089,
+    1.8879267, 3.2, -0.6559018, -1.1551399, 2.7287202, 2.94, 2.4397686, 2.0925539,
+    -0.07408267, 2.82, 2.0742128, -0.30146822, 1.7607149, 1.291023, 1.2554787, 4.49,
+    -1.1551399, 3.9, 2.1644742, 4.45, 1.6812738, 2.4262168, -0.7202588, 4.45,
+    1.7255497, 2.6322038, -0.4176023, 1.2350391, 2.0711691, -0.48152414, 3.2782605, 0.92479175,
+    -1.6862178, -2.4040701, 4.61, -19.876776, 1.54, 0.79, -20.402336, 2.0165243,
+    0.82019234, 1.22, 3.9412389, 1.9827951, -24.11707, 1.62, 0.45044643, -0.17530183,
+    1.69, 2.674896, 0.10728132, 1.38, -19.428238, 1.18, 1.9292511, -0.3596607,
+    -18.977423, 0.5189601, -0.5852316, 1.81, 1.62, 4.5154305, 2.8673174, -13.286145,
+    0.2434531, 1.5165685, 5.0, -3.1480272, -3.7061508, 3.5725617, 4.65, 2.0423763,
+    3.0085335, -2.6292815, 4.65, 1.2950506, 2.0275617, 4.65, 0.7042371, 1.4007872,
+    -3.9679167, 5.87, -5.4127874, 3.6760533, 2.4206226, -5.4127874, 2.0539613, 0.8242756,
+    5.4, 5.2, 1.9054183, 1.3342342, 5.6, 0.9102873, 0.4167315, 4.53,
+    -2.196643, 4.45, 2.37, 2.33, 2.1092145, 0.5147461, -2.3197646, 3.2555501,
+    2.8172898, -2.2551181, -2.357731, 0.18195572, 2.1951406, 0.14432882, 3.59, -1.960713,
+    2.37, 2.1104546, 2.7691567, 2.94, 2.6865287, 2.3020446, 4.36, 4.02,
+    2.0878835, 1.7981627, -1.960713, 3.0623538, 2.1567333, -2.3197646, 5.0, 1.5393459,
+    1.0132648, -2.173437, 4.93, 4.61, 0.42001215, 1.1967219, 0.8071047, 0.8020774,
+    2.82, -0.9800166, 2.44, 1.93, 3.277933, 2.29, 2.17, 1.9385313,
+    0.6700316, -1.362035, 0.068577915, 2.6648843, 2.59, -1.0684927, 3.2094834, 1.9760332,
+    -1.2995658, 2.6128566, 2.1653774, 2.4, 2.21, -0.54071695, 2.01, 2.6220756,
+    1.3370181, 2.7178702, -0.24307282, 2.4026802, 1.7726383, -0.4176023, 1.9550269, -0.07408267,
+    2.74, 1.6825622, 1.2844454, 2.63, 1.445526, 1.0163401, 4.49, 3.67,
+    -1.0684927, 3.1, 2.0989122, 1.8371185, -0.3603938, 2.98, 1.7685261, 1.4340314,
+    1.1229327, -1.3340919, 4.06, 1.6204665, 1.452134, 4.45, -1.1948682, 1.3149966,
+    1.0860344, -0.771789, 2.406803, 1.1487709, -0.48152414, 2.8941057, 0.8323124, 9.69,
+    8.83, -11.773308, 7.49, 2.05, 1.73, -18.367512, 1.543472, 2.9519284,
+    -15.789676, -0.12286878, 0.6393877, 6.72, -15.789676, 3.7901006, 1.1482532, -20.981464,
+    1.7902285, 1.5615581, -14.672277, -17.44737, -18.7905, -1.4928386, -0.9842207, 7.65,
+    -0.16724865, -0.67496043, 7.65, -12.655651, 1.2342418, 2.7466886, 7.73, 0.56586117,
+    -0.31689003, 6.88, 6.53, -9.029197, 4.57, 1.4940658, 3.3233144, 6.22,
+    1.66141, 0.14352915, -10.19933, 6.72, -1.1360345, -2.0469189, -2.1658208, 7.73,
+    7.65, 4.2682576, -10.59073, 1.874421, 4.0859447, -9.684118, 7.85, 1.1054757,
+    -0.6782295, 8.01, 3.081139, 1.7350867, -6.961682, -7.1032915, 9.65, -7.2534256,
+    -1.3810936, 9.61, -1.1942267, -0.17252079, -7.3987164, -1.0752757, -7.2534256, 0.061891414,
+    0.88667995, 9.61, 9.57, 9.53, -1.0671192, -0.5858657, 0.31548548, 9.65,
+    -7.054926, 0.28754017, 1.0056092, 2.1629043, 9.57, -6.5924907, 9.53, -6.7036514,
+    -0.30944288, 0.41396236, -6.740236, 0.46873212, 2.184948, 9.23, -5.878716, 0.5614366,
+    2.095615, -6.0203667, 1.9423722, 2.9088583, -6.8701315, 9.65, 9.61, 1.177853,
+    1.9981326, 3.5365942, 3.4485517, -7.485508, 9.92, 9.77, 9.73, -7.722872,
+    -0.16777001, -0.695477, -7.5758924, -7.7751694, -0.016002199, -0.25472888, -7.5297284, 0.28459948,
+    0.53640264, -7.832062, -7.9547505, -8.018251, -0.32525876, -0.14678065, 9.8, -0.21027935,
+    0.43621126, 9.84, 9.8, 0.51160383, 0.7877482, -7.722872, 1.0716819, 1.4850298,
+    -7.832062, -7.9547505, -8.113236, -0.33401045, 9.96, 0.06336787, 0.77701426, 9.96,
+    1.0502838, 1.862579, -7.617456, 9.96, 1.8369201, 2.8002849, 3.442159, -7.2534256,
+    9.73, -7.3987164, -7.444791, 0.2026308, 0.4601495, 0.9415493, 9.84, -7.444791,
+    9.77, 0.1350872, 0.9796203, 2.5924592, 3.421336, 9.73, -7.1555967, 2.1640422,
+    3.7224138, 4.058161, -1.6862178, -2.4040701, -2.9810855, 4.61, 1.85, -14.995561,
+    -19.668941, 1.354554, 0.49718162, 1.69, 2.9951777, 2.0110412, 2.33, -9.193894,
+    -0.24932785, 0.5888788, -4.2262564, 1.5055485, 0.2724956, 5.12, -3.7061508, 2.5179768,
+    4.97, 1.9499369, 1.375232, -4.0418863, 5.63, 2.1419888, 1.3136269, 5.44,
+    0.9056382, 0.14322446, 4.53, 2.37, 2.17, 2.05, 1.8911227, 1.0049092,
+    2.29, 0.18412323, -0.5430929, 4.21, 3.954841, -2.5247674, 2.2753232, 0.011479696,
+    -2.5247674, 4.61, 4.57, -0.5154165, 0.120286815, 4.97, 1.0946935, 0.7366964,
+    4.89, 4.61, -0.31537667, 0.6257251, 5.2, 0.26147234, 0.07660866, 4.53,
+    -2.173437, 4.45, -2.3197646, 2.37, 1.3336649, 2.2846067, 2.29, 1.2468715,
+    1.8987865, -2.2551181, -2.357731, -0.002381134, 1.5780922, -0.09643657, 3.4, 2.4,
+    2.01, 2.1337018, 0.9279917, -1.8216634, 1.9297533, 1.5924076, 4.36, 3.75,
+    1.4552125, 1.1491526, -1.960713, 2.1102521, 1.4067403, -2.3197646, 4.93, 4.69,
+    0.64204377, 1.0632309, 0.58352727, -2.173437, 5.0, 4.61, 0.14248887, 0.61729836,
+    0.28208908, 0.32306555, 2.86, -0.9247528, 2.29, 2.01, 1.93, 2.3660543,
+    1.4510794, -1.4217949, 1.5110188, 2.17, 0.76081735, 0.05090912, 2.67, 2.44,
+    -1.362035, -0.23897552, 1.8638638, -1.2630312, 2.1997664, 1.6211869, -1.0267481, 1.5498725,
+    1.1002287, 2.29, 2.01, 2.0987298, -0.7202588, 2.21, 0.22177568, 1.4768504,
+    2.21, 1.7014258, 1.42491, -0.18892978, 2.4, -0.6559018, 1.7069912, 1.2800388,
+    -0.4176023, 1.2178011, 1.0266086, 2.55, 1.0285281, 2.74, 0.76700896, 0.46069714,
+    4.49, 3.59, -0.9247528, -1.3340919, 3.24, 1.3700883, 1.1724886, 3.44,
+    1.1218824, 0.941719, 3.36, -0.6559018, 0.9833538, 0.68637323, 3.48, 0.49776998,
+    0.27775544, -1.2630312, 4.02, 0.99240696, -1.4536674, 0.8895387, 0.69050616, 4.45,
+    4.02, 0.6779086, 0.44666877, -0.771789, 1.6835648, 0.6429384, -0.48152414, 2.0480814,
+    0.5829399, 9.69, 8.76, -1.7140237, -11.515594, 7.57, -20.089907, 7.14,
+    1.2917318, -0.69092363, 7.14, 0.5378565, 2.0161057, -13.286145, 7.69, -0.34784046,
+    -0.806687, 7.73, 0.8623479, -0.4097937, 1.88, 1.81, -9.193894, 1.6605641,
+    2.224535, -4.524055, 1.1674309, 2.11812, 2.4, 2.01, 0.94192725, 0.15454036,
+    6.88, 1.0762938, 1.3056287, 2.94, -0.9247528, -1.2995658, 2.44, 1.0790063,
+    1.494881, 2.29, 0.8089218, 1.2546091, 2.29, 1.97, 1.835787, 1.2583264,
+    -0.4176023, 1.0318072, 0.7687, 4.45, 3.71, -1.1551399, 0.9641307, 0.66142887,
+    -1.362035, 0.709122, 0.5224059, -1.6287112, 2.5653977, -1.362035, 0.30050668, 1.3155395,
+    -6.961682, -7.1032915, 9.65, 9.57, -1.5010608, -7.2534256, -1.2835882, -0.61797744,
+    -7.3987164, -1.1189731, -7.20367, -0.16221009, 0.5862185, 9.61, 9.57, 9.46,
+    -0.4423994, -1.0370795, -7.054926, -0.065040015, 0.0670414, 9.65, -7.01124, 0.2574341,
+    0.8755978, 1.5062267, -5.750133, 9.18, -5.949599, 8.91, 0.37412116, 0.027081564,
+    8.83, 1.076672, 0.57462114, 9.57, -6.653369, -0.289466, 1.3388621, 9.65,
+    2.055243, 3.0320234, -5.6420994, 9.14, 8.83, 1.8565925, 1.1421268, 2.3212013,
+    2.252239, -7.485508, 9.92, 9.8, 9.73, -0.7847408, -7.667374, -7.7751694,
+    -0.21680179, -0.44950292, 9.77, 0.026957944, 0.3067803, -7.832062, -7.9547505, -0.45919806,
+    9.88, -0.03747691, 0.2275466, 9.88, 9.84, 0.38363823, 0.651575, -7.7751694,
+    0.43691203, 1.0817393, -7.832062, -7.9547505, -8.113236, -0.4972795, 9.96, -0.1908466,
+    0.3778919, 9.96, 0.6070506, 1.2647052, -7.617456, 9.96, 1.2399744, 2.0058744,
+    2.515391, -7.20367, 9.73, -7.349471, -7.444791, -0.024807358, 0.21537073, 1.009616,
+    9.88, -7.3987164, 9.84, 0.9783514, 1.6145018, 9.8, 1.8214034, 2.6570976,
+    2.7875586, 2.806535, 9.69, 8.76, 0.83, -20.089907, 0.75, -20.402336,
+    0.71, 0.71495175, 1.3591838, -0.9149286, -20.28955, -20.516748, 3.4613397, 2.2759864,
+    0.79, 0.08391309, 0.9379136, 0.79, -0.7176047, -19.876776, -0.21429804, -0.538263,
+    1.18, -19.668941, -19.982029, 1.1, 3.247717, 2.325587, 0.87, 0.42157266,
+    1.842266, -19.22157, 0.91, -0.14456415, 0.9151808, -18.977423, -0.16209985, -0.9099094,
+    2.29, -18.7905, -21.69312, 0.79502076, -0.5000737, 1.77, 1.8151848, 0.74422294,
+    -1.7140237, 4.45, 1.0928992, 0.85764706, 2.82, 0.8608245, 0.6336925, -5.987348,
+    -7.1032915, 9.65, 9.61, -1.0656002, -7.2534256, -1.0803269, -0.27060738, -7.3987164,
+    -0.9138281, -7.20367, -0.13157068, 0.48363, 9.34, 8.87, -6.7036514, -0.24250709,
+    0.41244236, 9.27, 0.038848232, 0.27498206, -6.417596, 9.53, -0.036756795, 1.346386,
+    9.42, 1.2596004, 2.2904155, -5.6420994, 9.18, -5.750133, 8.83, 0.85426867,
+    0.4228398, 9.14, 1.0271796, 1.6096874, 9.27, -5.842078, 0.9166924, 1.9984188,
+    2.114921, 1.8065838, -7.444791, 9.92, 9.8, 9.73, -7.485508, -0.6420607,
+    -0.021086311, -7.667374, -7.7751694, -0.17825945, -0.36959162, 9.77, 0.009995613, 0.24903314,
+    -7.832062, -7.9547505, -0.37501177, -7.8932815, -0.04737309, 0.18637934, -7.5297284, 9.88,
+    0.38522053, 0.678527, 9.84, 0.32559633, 1.2696574, -7.832062, -7.9547505, -8.113236,
+    -0.41439947, 9.96, -0.15561359, 0.30574897, 9.96, 0.4932284, 1.0266429, -7.5758924,
+    9.96, 1.0275282, -7.667374, 1.4284848, 2.0761263, 2.1960118, -7.3014965, 9.77,
+    9.73, -7.3987164, 0.11915349, 0.3564244, 0.6637625, 9.84, 1.4719192, 2.1407654,
+    -7.054926, 9.73, -7.2534256, 0.46356913, 1.33864, 2.3169167, 2.7207997, 9.69,
+    8.8, 0.83, -20.188913, 0.75, -20.516748, 0.71, 0.57544464, 1.5607299,
+    -20.402336, -0.14046341, -0.68318677, -20.28955, 0.79, 1.8461508, 2.9173944, 0.79,
+    0.08057885, 1.2791008, -20.089907, 0.75, -0.8231358, 0.79, 0.049809616, 0.36268255,
+    0.79, -0.5816373, -19.876776, -0.17395954, -0.43599334, 1.26, -19.539429, -20.089907,
+    -22.12889, 3.3018682, 2.0266883, 1.1, 1.3799294, -0.08468926, -18.977423, 1.14,
+    0.13856064, -0.562373, -18.7905, -0.6635465, -1.2324768, 2.29, -19.22157, -24.452414,
+    0.6886717, -0.4497264, 1.66, 2.0071435, 0.6497368, -4.6410313, 5.99, 1.3108007,
+    0.67055345, 5.48, 0.68270385, -0.27485332, -6.910217, 9.65, 9.57, 9.46,
+    -0.3857507, 9.53, -1.2415736, -0.7949251, -7.20367, -0.7788119, -7.01124, -0.23952058,
+    0.2036701, -7.20367, -7.3987164, -0.74629265, -7.3014965, -0.26383287, 0.017247703, -7.054926,
+    0.5459587, 1.4424909, 9.53, -6.4785495, -6.740236, 9.38, -0.10950053, -0.6132216,
+    9.5, -0.05505686, 0.7112309, 9.38, -6.0203667, 0.15993904, 0.91260976, -6.3485193,
+    1.1267462, 1.792161, 9.61, -6.7036514, -6.8701315, -0.10279999, 0.85897505, -6.5553975,
+    1.6764873, 2.4545772, 2.0801742, -7.485508, 9.92, 9.77, 9.73, -7.617456,
+    -7.667374, -0.4239668, -0.049946595, -0.6554737, -7.5758924, -7.7751694, -0.160412, -0.36089784,
+    -7.5297284, -0.0060987687, 0.20618077, -7.8932815, 9.84, -0.38774338, -8.018251, -0.35168546,
+    -0.021316195, 9.84, -7.7751694, -0.04576683, 0.2072383, -7.5758924, 0.40203974, 0.72011864,
+    -7.832062, -7.9547505, -8.018251, 9.96, -0.4551899, -0.044867758, 9.96, 0.017125396,
+    0.31102717, 9.96, 0.40074798, -7.8932815, 0.6166289, 1.0549654, -7.617456, 9.96,
+    0.8103425, 1.3114222, 1.6315361, -7.20367, 9.73, -7.349471, -7.444791, -0.017923165,
+    0.1372922, 0.6501979, 9.88, -7.3987164, 9.77, 0.18109919, 0.839722, 9.8,
+    1.137041, 1.7742821, 1.8922026, 9.73, -7.054926, 1.1615688, 2.2101617, 2.1188676,
+    -19.668941, 7.22, 1.88, 1.5, 0.83, -20.188913, 0.75, 0.46422026,
+    1.3310446, -20.089907, 0.09627015, -0.34399423, -24.452414, 1.46, 2.4032955, 0.73688066,
+    1.3, 1.2946795, -1.1560858, -24.11707, 1.62, -26.084858, -0.41272798, -1.3982884,
+    -30.874868, -1.6129477, -0.71602756, 1.66, -22.12889, 0.5279181, 2.306975, 1.77,
+    0.1727192, -0.8776826, 7.03, 6.88, -23.178364, 3.1489153, 6.79, 2.8924842,
+    1.1494005, -23.477354, -28.209562, 2.3855374, 1.5577117, 6.95, -0.05006903, -1.1116582,
+    -28.209562, 7.1, 7.06, 0.52587295, -0.046823915, -31.608435, -0.8348576, -0.59116,
+    7.1, -20.28955, 1.5172933, -0.8283395, -20.089907, 0.35087475, 2.4842622, -24.864492,
+    7.26, -25.265562, -1.2356071, 0.02130623, 7.34, -25.69593, -1.7910203, -0.56804067,
+    -2.273195, 7.34, -22.656353, -22.907703, -23.178364, -0.28853413, 0.29507497, 7.26,
+    -1.3786938, -0.17869377, 7.26, -22.377066, 0.4284083, 1.2981943, 7.3, 0.48303556,
+    -0.11519759, 7.38, -20.981464, -0.8777608, -0.43760362, 7.42, -20.652575, -1.2770754,
+    -0.3558266, -1.8390135, 1.34, 1.22, -19.428238, 0.91, 0.87, -19.539429,
+    -0.2525506, -0.56269103, -19.539429, 0.19342403, 0.084199905, 1.1, 0.95, 0.70292,
+    1.5780529, 0.5098158, -18.977423, 1.1, 0.95, -0.22575985, 0.14395885, 1.18,
+    -0.19771326, -0.5613245, 1.14, -18.7905, -0.37483355, -0.9771783, -1.018474, -1.1464503,
+    1.62, 1.58, 2.5391793, -16.183819, 1.1144365, 1.9451603, 7.14, 6.72,
+    -16.605732, 4.57, 0.015164325, 2.6305757, 6.53, 0.54982436, -0.6365923, -16.605732,
+    6.88, 0.5491599, -1.3749466, 6.88, -1.7237662, -2.7864132, 7.42, -15.789676,
+    7.3, 2.3069875, 0.039853707, -14.294952, 2.4829268, 3.3289025, -14.294952, -16.605732,
+    -1.6232026, -0.6005886, 7.73, 1.612233, 0.52692074, -1.3970085, -6.389413, 8.13,
+    -9.193894, 7.81, -11.515594, 7.49, 0.45426193, -0.23870097, 6.88, 0.54848427,
+    1.6464046, 7.89, -10.19933, -1.1186479, 0.29065463, -10.025825, -1.6775868, -1.0892886,
+    6.64, 6.26, -7.617456, 1.3673362, 0.5448868, -7.722872, -0.18869911, -1.4305594,
+    -7.8932815, 7.97, 1.9637822, 0.18441664, -7.3987164, 2.1218472, 3.0231524, -8.113236,
+    -8.453863, -1.6945101, 8.2, -8.21763, -0.6732363, -0.31838748, 8.44, -1.3431052,
+    -0.42567506, 8.28, -7.2534256, -7.722872, -0.45803452, 0.6466125, -7.01124, 1.4786136,
+    2.4942927, 9.5, -6.8298554, -0.6743327, 0.19501488, -6.7859416, 0.41028914, 1.2547628,
+    6.49, 5.95, -5.5490093, 4.53, 1.93, 0.79161096, -0.6243786, 5.75,
+    2.0657966, 1.0989735, 5.6, -4.2262564, 0.93683046, 0.46755558, -5.1183767, 0.43687773,
+    -0.3546336, 6.14, 6.02, -5.682901, 0.031596772, -0.48222557, -6.1923833, -1.1615931,
+    -0.62597793, -6.131815, -2.1736467, 6.26, -1.0250837, -1.5758332, 8.64, 8.52,
+    -6.3485193, 8.48, 1.8291825, 0.6386122, 2.3693137, -5.949599, -6.286212, 0.41446096,
+    1.164585, 2.1451128, -5.878716, 9.3, 8.72, 0.56933945, -0.0071232184, 9.42,
+    0.8165046, 1.5383149, 8.8, 8.76, 1.6321608, 1.1814742, 9.18, 0.59606266,
+    1.3155671, 2.55, 1.97, -1.2995658, 0.18817902, 1.1493279, 2.4, -1.0684927,
+    2.37, 2.17, 0.13221842, -0.50918686, -1.1948682, 2.056254, -0.24765828, -0.9247528,
+    2.29, -0.012889481, 1.8080765, -0.82226276, 0.120546274, 0.5908281, -1.0684927, 2.44,
+    -1.3340919, 0.082594685, 0.598584, 1.1962813, -0.5968429, 2.52, 0.320658, 0.6976587,
+    2.44, 0.3875309, 0.16564104, -0.24307282, 2.98, -0.771789, -1.3340919, 0.6440708,
+    2.63, 0.5481313, 0.4099269, 2.63, 2.59, 0.24986696, 0.5720559, -0.5968429,
+    0.3606648, 0.23541863, 4.45, 4.02, -0.8777573, 0.25554153, 0.041532543, -1.2630312,
+    0.0065226513, -0.10506538, -1.362035, -0.8490338, -0.54071695, 0.95367634, 0.21813515, 2.74,
+    -0.14428757, 2.71, 2.63, 0.18843454, 0.36459237, -0.18892978, -0.039369714, 0.22841339,
+    -0.07408267, -0.10486277, 0.026607666, 0.14678678, 2.63, 0.02023741, -0.15091625, 2.78,
+    -0.14428757, 0.11788992, -0.07408267, -0.08269288, -0.21449833, -0.20094576, 9.65, 8.87,
+    0.03, -51.15694, 0.85656893, 0.240436, 0.59, -21.931791, -22.377066, 0.56,
+    0.22684522, -1.8068665, 0.56, 0.6291614, 0.37245783, -0.3677747, -20.981464, 7.14,
+    1.88, 0.4549089, 1.3022165, 7.26, -0.45629898, -1.4091959, 7.1, 6.76,
+    0.33304316, -1.3159113, 7.34, 1.5819812, 0.4197247, -6.8701315, 9.57, 9.46,
+    -0.34976524, 9.53, -1.1142031, -7.01124, -0.99640054, -0.5205323, -7.054926, -7.20367,
+    -0.80905145, 9.61, -0.5632209, -0.26732084, 9.61, -6.910217, -0.30711713, 0.06366455,
+    -7.01124, -0.07736524, 0.3973969, 9.53, -6.4524984, 9.5, -6.7036514, -0.5121657,
+    -0.17568187, -6.5924907, -0.16390413, 0.69228166, 9.23, -5.750133, -0.048556414, 0.7192655,
+    -6.131815, 0.45489046, 0.9870697, -6.5924907, 9.61, -6.740236, 0.3342171, 0.82318896,
+    -6.7859416, 0.8555643, 1.6220849, 1.5068773, -7.2534256, 9.77, -7.3987164, 9.69,
+    -0.7812943, -7.5758924, -7.722872, -0.3009164, -0.5324182, 9.73, -0.27253845, -0.077777356,
+    9.69, -7.3014965, -0.38167402, -0.18571304, -7.3014965, -7.349471, 0.044810053, 0.16862433,
+    9.73, 0.19010569, 0.7774048, -7.5758924, 9.96, -7.8932815, -8.018251, -0.52744013,
+    -0.1594799, 9.92, 0.06328048, 0.38778165, -7.8932815, -8.113236, -0.35472935, 0.14111209,
+    -7.667374, 0.74917585, 1.2389606, 9.88, -7.444791, 9.84, -0.07165321, 0.31841037,
+    -7.349471, 0.705275, 1.2034248, 1.2193453, -7.01124, 9.73, 9.69, -7.1032915,
+    -7.1555967, 0.25752804, -0.09548401, 0.44127184, -7.1555967, 0.5143603, 0.96825886, 1.5149463,
+    1.6909198, 9.65, 8.83, -1.3970085, 2.44, 1.93, -7.832062, 1.69,
+    0.27538848, -0.21400099, -3.8950949, 0.77513826, 1.3070916, -3.8215072, -8.718564, -1.1774454,
+    -0.5357356, 2.21, 0.4431336, -0.4843897, 3.32, -2.040998, 1.0236284, 2.78,
+    0.8641648, 0.45492062, -2.068156, 4.45, 0.6784833, 0.29011056, 4.53, 0.15043245,
+    -0.49944434, 2.48, 2.05, -0.14428757, 1.97, 0.82916766, 0.23501812, 1.1795586,
+    -0.10486277, -1.362035, -0.18978654, 0.38841337, 2.17, 0.67659354, -0.0008962978, -0.7202588,
+    3.36, 2.55, 0.74251115, 0.26430562, 4.45, 0.009770636, 0.52291393, 4.49,
+    3.1, 0.05245124, -0.16049194, -0.48152414, 1.0660344, 0.15135193, -6.8701315, 9.57,
+    9.46, -0.28980538, 9.53, -0.90250427, -7.01124, -0.81135505, -0.42336655, -7.054926,
+    -7.2534256, -0.721654, 9.61, -0.5005161, -0.25198337, 9.61, -6.961682, -0.30199763,
+    -0.02375183, -7.01124, -0.06447093, 0.32288513, -5.6420994, 9.14, -5.7152433, -6.2222686,
+    0.02448945, -0.13842064, 9.07, 0.14429083, 0.5353422, -6.0520425, 9.38, -0.13937856,
+    0.4862767, 9.34, 0.63507026, 1.5094855, -5.5945034, 9.07, 8.91, 0.5956984,
+    0.25671986, 0.92264986, 1.0365638, -7.444791, 9.88, 9.73, -7.485508, -7.617456,
+    -0.39272633, -0.6859128, 9.69, -0.43964463, -0.114935875, -7.832062, -7.8932815, -0.3705382,
+    9.84, -0.22774306, -0.09590226, 9.8, -7.667374, -0.33172747, -0.09177249, -7.485508,
+    0.06295676, 0.2869306, -7.7751694, -7.9547505, -8.018251, 9.96, -0.44618455, -0.14899227,
+    9.96, -0.12595801, 0.05453163, 9.92, -7.8932815, -0.08979664, 0.011298132, 9.96,
+    0.21710034, 0.4424679, 9.96, -7.5297284, 9.92, 0.29741117, 0.42349902, 0.88934916,
+    -7.667374, 0.5958747, 1.1017928, -7.01124, 9.73, -7.2534256, 9.69, -7.3014965,
+    -0.4224765, -0.15269707, -7.349471, -0.031599287, 0.20799987, 9.69, -7.1032915, 0.08866104,
+    0.35932118, -7.1555967, 0.41791806, 0.7859978, -7.2534256, 9.8, -7.349471, 0.2876805,
+    0.51693505, 9.88, 0.87211317, 1.2565398, 9.77, -7.1032915, 0.80780286, 1.4382917,
+    1.4262148, -6.910217, 9.69, 0.80310833, 1.3786472, 1.598837, 0.03, -51.15694,
+    0.63461715, 0.14464025, 0.59, -21.931791, 0.16, 0.12, -36.19027, -40.02452,
+    0.17673181, -0.049839824, 0.54716444, -33.599087, -34.72578, -0.12843937, -0.084422074, -0.20071049,
+    -32.61234, 1.2043073, -29.518152, 0.23, 0.14636378, 1.0251802, -27.639406, -0.096018516,
+    0.14807124, -0.35083687, 1.18, -19.428238, 0.87, -20.089907, 0.79, 0.24960218,
+    1.3370093, -19.876776, -0.27164802, -0.53062063, -20.089907, 1.1, 1.824884, 1.0837102,
+    1.06, 0.9469139, 0.1479704, -19.22157, 0.91, -19.330385, -0.3853348, -0.6110986,
+    0.99, -0.03457175, 0.10971391, -18.7905, 1.14, -0.36264798, -0.81001896, -1.0267371,
+    2.29, -18.7905, -21.69312, 1.42, 1.3625574, -0.4169538, 1.46, -1.1796546,
+    0.9434034, 1.81, 1.62, 1.4518038, 0.6467149, -3.6424093, -0.30069205, 0.3808035,
+    -17.897657, 6.99, 6.83, 2.0406892, 0.9574694, 7.26, 0.13202573, -1.1545743,
+    7.14, 6.68, 0.22143362, -1.3768857, 7.46, 1.5243546, 0.23816183, -1.8216634,
+    -2.4040701, -2.9810855, 4.61, 1.88, -13.614294, 1.62, 0.18678586, -0.45680156,
+    1.73, 0.9535705, 0.48134327, 4.57, -13.286145, -0.83965886, -0.28935635, -4.2262564,
+    1.3625565, -0.4565539, 5.16, -3.7061508, 4.65, 0.6583116, 1.158213, 4.97,
+    0.66913426, 0.18335466, -4.127986, 5.55, 0.9162041, 0.18946148, -3.2152596, -0.42568776,
+    0.09293535, 4.53, 2.37, 2.17, 1.88, 0.8902265, 0.32072794, 2.25,
+    -0.26140016, -0.75681597, 4.21, 2.3446927, -2.5247674, 1.1175059, -0.5871989, -2.6292815,
+    4.65, 4.61, -0.8656648, -0.3876256, 4.93, 0.1222126, -0.22143169, 4.93,
+    4.65, -0.72256035, -0.17699336, -2.5247674, -0.4955767, -0.68230677, 4.45, -2.2551181,
+    2.37, -2.357731, 0.6375599, 2.25, 0.18179375, -0.11962147, -2.357731, 0.89893353,
+    3.9, 0.852059, 0.5468301, 3.51, -2.1208782, 2.37, 0.4371468, 0.82006466,
+    3.17, 0.6183173, 0.3085167, 4.33, 4.06, 0.19834873, -0.04044289, -1.9079165,
+    0.74697375, 0.14305475, -1.9079165, -1.98534, 4.53, -2.068156, -0.16920374, 1.3576936,
+    -2.3197646, -0.20667963, -0.48144293, 4.49, -1.6347712, -1.9313097, 0.17681924, -0.4231808,
+    1.1768192, 3.02, -1.2630312, 2.74, 2.44, 2.33, -1.4217949, 0.59546655,
+    -0.20241828, -1.362035, -1.1146749, 0.43671632, 2.52, 1.0700694, -1.6862178, 1.028174,
+    0.47660112, -1.5751029, -1.7429106, 2.82, 0.65244275, 0.26930317, -1.6287112, 0.041946847,
+    0.20245658, -1.3340919, 2.9, 0.32724458, 0.4335102, 2.94, 0.21863234, 0.058798343,
+    2.4, 2.01, -0.30146822, 1.93, 0.78870296, 0.24921048, 0.8242346, -1.0684927,
+    2.33, -0.6734734, 0.42840227, -0.9800166, 0.78438014, 0.24454439, -0.4176023, -1.0684927,
+    2.52, 0.4612101, 0.20810115, 2.44, -0.022119535, 0.14900517, 2.71, -0.07408267,
+    0.08222129, -0.091591865, -0.24307282, -0.04493701, -0.2219402, 4.45, 3.86, -1.1948682,
+    3.71, -1.7140237, 0.24145575, 0.15462571, -1.4217949, 0.044557523, 0.17969544, 3.44,
+    -0.8777573, 0.15240747, -0.07707126, -0.9800166, -0.08206686, -0.32763657, 4.06, -1.1948682,
+    -1.4217949, -0.023823468, 0.097193055, -1.1551399, -0.12284642, -0.28021404, 4.36, -1.6862178,
+    -0.29791704, -0.11766054, -1.5751029, 0.10506391, -0.15203996, -1.6287112, -1.7678375, -1.7983414,
+    0.97115785, -0.43842775, 1.8556899, -1.1948682, -1.3340919, -1.362035, -0.26024914, 0.5252902,
+    -0.87975997, -0.54071695, -0.82226276, 0.28273317, 0.90880585, -0.4176023, -0.3415522, 0.51814103,
+    -5.5490093, -6.2553506, 7.89, -6.961682, -11.773308, 7.53, 2.05, 0.10918339,
+    0.26451278, -12.377764, -0.7932687, 0.12798975, 6.88, 6.49, 0.70609343, -1.9636062,
+    -9.847813, 0.5203616, 1.6712475, 6.02, 5.95, 4.57, 0.31370965, 1.0275953,
+    -6.653369, 0.20732346, -0.50857633, 6.06, -6.7036514, -0.14390412, -0.7941005, -6.8298554,
+    -1.1835264, -1.7041454, -8.453863, 8.05, -9.349648, -10.59073, -1.6882595, -1.0664332,
+    7.93, 0.31214127, -0.4264237, -9.029197, -1.7466141, 8.17, -1.0190511, -1.6076926,
+    8.2, -7.722872, 8.05, 1.3624703, -0.19082662, -7.1555967, 1.4375819, 2.1656263,
+    -7.9547505, 8.48, -1.2963846, -0.23161729, 8.36, 0.56724846, 0.0067567513, 5.87,
+    4.53, 2.09, 1.81, 0.52269095, -6.1628103, 0.17944854, -0.13185215, -5.784454,
+    2.17, -0.45975685, -1.3554189, 2.17, -0.2986954, 0.0048332214, 5.75, -5.9075212,
+    4.57, 0.6849701, 1.9104298, 5.67, 1.4932088, 0.97969455, -5.878716, 1.2204331,
+    -5.682901, 0.48077407, 0.06937396, 6.49, 6.14, 5.99, -5.784454, 0.45513126,
+    -0.088540755, -5.842078, -0.24285908, -0.6467974, 6.3, -1.0880969, -1.7325362, 8.64,
+    8.56, 8.52, 1.771389, 1.2725813, -5.9075212, 0.56462204, 1.6345488, -5.813874,
+    9.27, -0.06815547, 0.56501013, 8.8, 1.0833442, 0.35835978, 5.67, -4.524055,
+    4.57, 2.05, 1.77, 0.73612183, -5.254704, -0.17394403, 0.09954936, 4.53,
+    2.21, -0.74856025, -1.8948961, -5.1183767, -0.71339995, 0.37315246, 5.6, -4.894484,
+    -5.1183767, 1.6213448, 1.1577812, 5.44, 1.3599349, 0.26541916, -5.254704, 1.0623316,
+    -4.894484, 0.27450767, -0.14997254, 5.36, -3.2776601, 4.61, 2.05, 0.64779896,
+    -0.355242, 5.08, 0.7558758, 0.25479546, 4.53, -2.1466296, 0.43532005, 0.12797357,
+    -2.7231896, 0.029067462, -0.3115205, 5.44, -3.8950949, -4.32814, 0.32847524, -0.038422775,
+    -3.3498714, -0.52704453, -0.23239534, -3.2152596, -3.8215072, -0.4404306, -0.5596748, -2.907736,
+    -0.10919636, -0.33087215, 6.3, 6.02, -5.1183767, 5.75, -5.254704, 0.40975648,
+    -0.030593395, 5.99, -0.29374373, -0.4435192, 5.95, 5.83, -0.5559164, -0.37333328,
+    -4.2262564, -0.7006496, -0.35601795, 6.14, -5.1183767, -0.6565704, -0.93838835, -1.1175112,
+    0.93542045, 9.65, 7.85, -7.3014965, -11.773308, 7.49, 2.05, 1.66,
+    0.12549442, -0.36096683, 6.79, 0.64185405, 0.08858581, -12.655651, -15.789676, -1.1390504,
+    -0.5031389, 7.61, 1.1251546, -0.26533118, 6.49, 4.57, 1.73, 0.45579606,
+    -0.22723602, -9.847813, 2.1724393, 0.57228667, 6.88, -11.018427, -0.85085976, -1.826387,
+    7.65, 1.679737, 0.570575, 6.06, -5.5945034, 5.99, 4.61, 0.13115881,
+    0.8249537, -6.7859416, 0.23971303, -0.40812704, 5.67, -4.4179254, 0.4350656, 0.10607964,
+    -5.1183767, -0.1508459, -0.43508872, 6.3, -6.131815, -6.7859416, -0.8148473, -1.2296981,
+    6.14, -0.5823023, -0.85475475, -5.987348, -1.5589021, -1.1488162, -8.577097, 8.01,
+    -9.50892, -10.396682, -11.26825, -1.0609072, -1.4709548, -0.74909925, -9.029197, 7.93,
+    -0.27503464, -0.6191751, 7.89, 0.6799285, -0.013279199, -9.349648, -1.4474592, 8.09,
+    -8.85124, -0.86346716, -0.327146, -1.230257, 8.17, -7.667374, 8.01, -8.328821,
+    0.8105728, 1.5578928, -8.21763, -0.43710598, 0.3094097, 8.09, 1.8655099, -7.2534256,
+    0.8067026, 1.8009617, -6.910217, -7.3014965, 8.24, -0.48038217, -1.0516809, 8.24,
+    0.8533541, -0.4788274, 8.4, -6.7036514, 0.8958315, 1.6996326, -6.511228, -0.15261418,
+    0.2609471, -7.2534256, 9.77, -7.3987164, 9.69, -0.62280977, -7.5297284, -7.5758924,
+    -0.41511115, -0.2688019, 9.73, -0.22960337, -0.04079079, 9.69, -0.272542, -7.3014965,
+    9.73, -0.015682546, -0.045709785, 9.73, 0.079107665, 0.4700772, -7.5758924, 9.96,
+    -7.832062, 9.88, -0.3249861, -0.12511031, 9.88, -0.06012993, 0.15124817, -7.8932815,
+    -8.113236, -0.3034439, 0.0375335, -7.667374, 0.41476616, 0.7209362, 9.88, -7.3987164,
+    -7.5297284, -0.30104664, 0.16984056, 9.8, 0.39550123, 0.7529062, -7.444791, 9.92,
+    0.34646806, 0.7720744, 0.94653815, -7.01124, 9.73, 9.69, -7.054926, -7.20367,
+    -0.119999185, 0.0883422, 0.3540381, -7.1555967, -7.20367, 0.1648407, 0.2975908, 0.55628014,
+    9.77, -7.1032915, 0.57489413, 1.138664, 1.0789036, -6.8701315, 9.69, 0.69311166,
+    1.1251317, 1.4184762, 9.57, 8.76, -20.981464, 7.14, 1.88, 1.5,
+    0.67, 0.057656802, 0.6952871, -24.11707, -0.8130968, 0.1262301, 6.95, -28.786161,
+    2.0524607, 0.8589632, 7.06, 0.62853616, -0.112296246, -25.265562, 7.22, -27.161629,
+    -0.8419809, -0.4127809, 7.34, -1.1763631, -1.5994047, 7.34, -21.931791, -0.20527656,
+    0.6721588, -21.69312, -1.1369494, -0.5974691, 0.71, 0.67, -1.5710281, -20.803585,
+    -0.16773587, -20.652575, -0.83113635, -1.4048036, 7.14, 6.83, 6.68, 0.09469775,
+    -0.3635875, -18.7905, -0.30426574, -1.6983591, 7.34, -18.7905, 0.13527791, 1.4774622,
+    -14.995561, -0.8870163, 0.21896386, -6.653369, -6.8298554, 9.46, 8.83, -0.58973366,
+    9.38, -0.053913116, -0.3063035, 9.53, -0.7491049, -7.01124, -0.6442363, -0.31833813,
+    9.53, 9.38, 8.83, -0.3940539, -0.13266382, 9.5, -0.6023697, -0.28301856,
+    -6.740236, -6.7859416, 0.062032472, -0.39489186, -6.7036514, 0.68331224, 0.002340889, 9.42,
+    -5.949599, 9.34, -6.2222686, -0.11639048, -0.30433807, -6.131815, -0.34279138, 0.80012435,
+    9.18, -5.682901, -0.08457904, 0.45858008, 9.3, 0.47161323, 0.8776205, -6.5553975,
+    9.5, 9.46, -0.12290337, -0.23461227, -6.5924907, 0.089330584, 0.39061376, 9.46,
+    -6.286212, -0.04283597, 1.0922813, -6.389413, 0.72512764, 1.2518692, -6.910217, 9.69,
+    -7.1032915, -7.3014965, -7.3987164, -0.5272843, -7.349471, -0.22156416, -0.4331393, 9.61,
+    -7.2534256, -0.119484715, -0.502538, -7.20367, -0.25388938, -0.08538546, 9.65, 9.61,
+    -6.961682, -0.24328712, -0.085319825, -7.01124, -0.09385653, 0.14309174, -7.054926, 0.10376694,
+    0.43066326, -7.444791, 9.92, 9.84, 9.73, -0.38203305, -0.16750978, -7.5297284,
+    -0.044084586, 0.30116737, -7.832062, -7.9547505, -0.12414896, 0.14502202, -7.5758924, 0.34639636,
+    0.62264115, -7.1555967, 9.77, -7.3014965, -0.023551878, 0.322584, -7.349471, 0.40599513,
+    0.7107124, 9.73, -7.054926, 0.36276528, 0.8205759, 0.91558534, -6.7036514, 9.61,
+    -6.8701315, 0.012196044, 0.2428248, -6.8701315, 9.65, 0.35835356, 0.7639065, 1.0234022,
+    1.4081867, -51.15694, 1.5, 0.03, 0.41623694, 1.46, 1.7530869, 0.28526422,
+    1.58, -0.260936, 1.73, -0.9268177, 7.03, 0.19290848, -0.61096877, 9.57,
+    7.77, -7.667374, -11.773308, 7.49, 2.05, 0.04368375, 0.18631832, -13.614294,
+    -0.6122319, 0.17042945, 6.49, 4.57, -0.13782588, 0.89207566, 6.88, -1.2487286,
+    0.87417203, 6.1, -5.842078, 6.02, 0.5669528, -0.07874351, 5.75, 0.079358384,
+    -0.33278954, 6.3, -6.131815, -0.87788975, -0.6536401, -6.131815, -1.3104025, -0.9903455,
+    -9.349648, -10.19933, -11.515594, -12.962669, -1.1142857, -0.778208, -10.59073, -1.3538605,
+    -0.9622998, 7.97, 7.81, 0.27824, -0.46079737, 8.05, -0.7987797, -1.2192858,
+    7.93, -8.85124, 7.85, 1.1594819, -0.052001785, 7.85, 1.9605144, 1.1661925,
+    -8.21763, 8.09, -0.29033956, -1.015021, 8.17, 0.83855313, 0.05602783, -6.910217,
+    9.69, -7.1032915, -7.3014965, -7.444791, -0.45489097, -0.310114, 9.65, -0.2950849,
+    -0.049562115, 9.65, 9.61, -0.17693852, 0.032582182, -7.054926, 0.08508881, 0.35027263,
+    -7.485508, 9.92, 9.8, -0.19739334, -0.03536914, -7.832062, -0.0022387805, 0.33960617,
+    -7.1555967, 9.84, 0.21729796, 0.51903844, 9.73, 0.5017366, 0.74772745, -6.7036514,
+    9.61, -6.8701315, 0.010244751, 0.19637096, -6.7859416, 9.65, 0.36684218, 0.86006135,
+    0.96000683, 1.1500188, 1.26, -19.428238, 0.87, -20.089907, 0.83, -20.28955,
+    0.75, 0.03344373, 1.0742676, 0.79, -0.55450195, -0.033965256, -20.28955, 0.8205746,
+    1.7582722, -19.876776, 0.83, 0.79, -0.59667796, -0.33074737, -19.982029, 0.7167651,
+    -0.256722, -0.5363681, -20.981464, -23.178364, 1.9486662, 1.18, 1.5009549, -22.377066,
+    1.1777034, 0.50159234, 1.1, -19.982029, 1.06, 1.4456567, 0.63155097, 0.95,
+    0.22588351, 0.78404117, 1.22, -19.76686, -0.34521016, 0.1465117, -20.402336, -0.45365545,
+    -1.0305756, -18.977423, 1.1, 0.95, -19.09326, 0.91, -0.5278596, -0.19649623,
+    -0.89360505, -19.330385, 0.99, -0.027298737, 0.4852512, -19.09326, -0.3518241, -0.12069126,
+    -19.22157, 1.18, -19.330385, -0.3662183, 0.051457882, -19.330385, -0.38936895, -0.74147785,
+    1.14, -0.45061108, -0.76955634, 1.14, -18.7905, 1.06, -0.66431814, -0.2877542,
+    -0.91179913, -0.94316196, 1.46, -25.265562, 1.34, 2.2632058, -28.786161, -33.599087,
+    1.42, 2.1185122, 1.2101406, 1.0977439, -27.161629, -27.639406, 0.13382907, 1.0782061,
+    -25.69593, 0.06678791, -0.5065697, -22.656353, 1.34, 1.3, -23.178364, 1.2974443,
+    0.6683417, -23.477354, 0.6083086, 0.16973023, 1.38, -23.178364, -0.15092055, -0.47026977,
+    -24.11707, -0.6808805, -1.4710478, 1.34, -20.652575, 1.3, -0.07387225, -0.6269009,
+    -19.668941, -1.675194, -1.1338359, 1.38, -20.981464, -1.2038331, -2.1529565, -2.4592505,
+    -25.265562, 7.06, 1.81, 1.54, -26.084858, 0.25167465, -2.1021705, -27.639406,
+    -0.853082, -0.5425946, 6.99, 6.91, 1.558276, 0.9568595, -27.639406, 0.034744263,
+    0.9364106, 7.22, -28.209562, 7.1, -0.5725986, -0.80657256, -27.639406, 0.2499583,
+    -0.36467654, -27.639406, 7.34, -1.064804, -1.3981972, -27.161629, -0.052394103, -0.843197,
+    1.69, -22.377066, 1.54, -23.813517, -0.3829343, -1.0572352, -24.11707, -0.16446549,
+    0.757749, 1.58, 1.54, 2.2085056, 1.3445991, 1.62, 0.84447664, 0.49269548,
+    7.06, 6.83, -15.789676, 0.7112221, 0.035867605, -21.325644, 0.19653477, -1.2134557,
+    7.69, -14.995561, -0.05487463, 0.8540611, -10.025825, -0.78624374, 0.08753273, -51.15694,
+    1.5, 0.03, 0.32806432, 1.46, 1.1683778, 0.23157044, 1.58, -0.11240031,
+    1.73, 1.62, -0.29942036, -0.7450002, 7.03, 0.17014313, -0.46921465, 0.44,
+    -24.11707, -25.69593, 0.16, 0.12, 0.07, -0.11337304, 0.10704412, -33.599087,
+    -0.1949029, -0.2684319, -32.61234, 0.877347, -27.639406, -0.016647281, 0.17001401, -24.452414,
+    -25.265562, -0.50312203, 0.4, -0.103626065, -0.2686727, 0.3184546, -1.2412878, 1.22,
+    -19.539429, 0.87, -20.089907, 0.83, 0.08310557, 1.3296007, 0.79, -0.5470657,
+    -0.2785521, -20.803585, -21.50634, 1.3223271, 0.8621198, 1.1, 0.7554579, -0.27761188,
+    -19.22157, 0.95, 0.91, -0.47076556, -0.21568675, -19.428238, 0.39169332, -0.0998941,
+    -18.977423, -19.09326, -0.40527102, -0.2467221, 1.14, -0.52548784, -0.77339303, 2.33,
+    -26.084858, 1.5, 1.38, 1.6436781, 0.67573684, 1.54, -0.009331062, -0.64073914,
+    1.5, -22.377066, 0.04815432, -1.018926, 1.73, 0.39005643, -0.026577404, -1.7678375,
+    3.63, 2.4, -0.72250944, 0.29505557, -3.7061508, 0.070081815, -0.013498831, 3.32,
+    -0.9247528, 0.13214937, -0.03992336, 4.45, -0.095640294, 0.28918564, -6.511228, 8.24,
+    -8.718564, 7.85, -11.773308, 7.46, -12.062972, 0.062405474, -1.0130067, -13.286145,
+    -0.59725344, 0.19165437, 6.49, 4.57, -0.21672928, 0.99561226, 6.88, -1.0231966,
+    0.43691665, -9.029197, 8.01, -10.59073, -0.7793245, -0.459381, -0.94900274, 7.97,
+    7.89, 0.2471088, 0.039279938, -8.85124, -0.5758384, -0.26138973, 6.1, 4.57,
+    2.01, -7.5297284, 0.17086196, 0.5427205, -7.617456, -0.07415061, -0.8081727, -7.20367,
+    -7.832062, 1.8480076, 1.1557602, 5.95, 0.9681239, -0.07549234, 6.53, -8.113236,
+    6.3, 0.79856557, -0.620891, 6.3, -0.54275703, -1.0644568, -7.2534256, 8.09,
+    0.7051987, -0.28494212, -6.8701315, 1.0165068, 1.7987359, 9.53, -7.1555967, -7.5758924,
+    -1.0231541, 8.6, -7.349471, -0.7913808, -0.5054377, -1.0992845, 8.36, -6.7859416,
+    8.32, 0.3646135, -0.29535016, 8.32, 1.4108715, 0.60077333, -6.7036514, 8.56,
+    -0.4035813, -0.61832213, 8.52, -0.0046120784, -0.2559738, -6.8701315, 9.65, 9.57,
+    -7.01124, -0.5642686, -0.33824566, -7.054926, -0.28871745, -0.011678415, -7.3014965, 9.84,
+    -0.11954407, 0.10653172, 9.73, 0.19339965, 0.45758054, 9.61, -6.7036514, -6.740236,
+    0.043925416, 0.22960238, 9.57, 0.29133552, 0.8988514, -6.740236, 9.65, 0.4475124,
+    0.8254094, 0.9778308, 6.49, 5.95, -5.5490093, 4.53, 2.09, -6.2222686,
+    0.49145466, -0.01561359, -6.4524984, -0.038117472, -0.95534605, 5.83, -5.9075212, 0.96970284,
+    0.6474757, -6.1628103, -0.21952029, 0.19355668, 5.6, -3.8215072, 4.57, -0.337702,
+    0.4018766, 5.04, 0.06624235, -0.2949807, -4.894484, 5.72, 0.3079589, -0.16249196,
+    5.79, -0.42463332, -0.21898289, -6.131815, 6.1, -0.80785435, -1.1764961, 6.18,
+    -5.842078, -6.0520425, 0.17817102, -0.03367147, 6.02, -0.36498183, -0.54024935, 6.26,
+    -5.7152433, -0.4028781, -0.6579923, -0.8181432, 8.56, 8.4, 8.36, 1.811953,
+    -6.4785495, 0.4407898, 1.3337283, -6.286212, -6.4785495, 8.48, -0.17300156, 0.038777925,
+    8.52, 0.62587214, 0.16248463, 8.52, 1.2376639, -6.0520425, 0.58485556, 1.224778,
+    9.46, -5.949599, 9.38, 8.72, 0.08675108, -0.18434551, -6.1923833, -0.080399014,
+    0.8288891, 8.76, -5.9075212, 0.3912091, 0.88918656, 9.23, 0.07103439, 0.5045065,
+    -6.389413, 9.5, -6.4524984, -0.06106753, 0.26314673, 9.53, 0.61182404, 1.0944322,
+    0.9727235, -40.02452, 7.06, 1.73, 1.58, 0.07, -51.15694, 0.25150186,
+    0.03, 0.02394055, -0.12762426, 1.46, 1.42, 1.3587861, 0.698893, 1.5,
+    0.4914978, 0.009372814, 1.66, 1.62, -45.980717, -0.26846555, -0.051773578, -0.4696485,
+    -0.8714553, 6.95, 1.4603148, 6.99, 0.4198965, -51.15694, 0.14688797, -0.22126837,
+    7.1, -45.980717, -0.06439286, -0.44065475, -0.8933011, 0.16, 0.12, -36.19027,
+    -0.18259756, 0.31077588, -33.599087, -0.16895504, -0.22918847, 1.3, -19.876776, 0.83,
+    -20.402336, 0.75, 0.023260457, 1.1779872, 0.75, -1.0364594, -0.18241698, -23.178364,
+    -23.477354, 1.6295595, 0.8834444, 1.14, 0.74938196, 0.03743669, 1.22, -19.330385,
+    0.91, -0.33776262, 0.23315278, 1.14, -0.2555769, -0.55934834, 1.26, -19.09326,
+    -0.39281845, -0.7272919, -19.668941, -1.14439, -0.6442113, 1.46, -25.69593, -27.161629,
+    1.38, 1.311858, 0.6973831, -26.084858, -0.23237121, 0.27626497, -22.656353, 1.38,
+    0.032886986, -1.0221628, 1.38, -1.0361247, -1.8212967, -25.265562, 7.06, 1.81,
+    -0.39709267, 0.6869548, 7.22, -0.49278197, -0.89785796, 1.69, -22.377066, -0.33984438,
+    0.69361514, -14.294952, 0.092604175, 0.02498022, -6.5553975, 8.24, -8.718564, 7.81,
+    -11.773308, 7.46, -12.062972, 0.04241171, -0.8314374, -12.962669, -0.45618573, 0.2707288,
+    6.49, 4.57, -0.19987254, 0.79233044, 6.88, -0.82503176, 0.45344716, -9.193894,
+    8.05, -10.59073, -0.7197634, -0.40539438, -0.83075, 7.89, 7.85, 0.6582017,
+    0.12135233, -8.85124, -0.47629353, -0.10317253, 6.14, 4.57, 1.97, -7.1032915,
+    0.19994597, 0.5612281, -8.577097, 0.5945398, -0.42243478, -7.3987164, 6.06, 1.4263644,
+    0.8361687, 5.99, 0.77178687, -0.15513995, 6.53, -8.328821, 6.3, 0.68435144,
+    -0.34720898, 6.34, -0.45820758, -0.9113647, -7.5758924, 8.01, 0.70515114, -0.26425186,
+    -6.961682, 0.6747636, 1.2718071, 9.57, -7.1555967, -7.3987164, 8.4, 8.32,
+    -0.7401381, -0.968993, -0.6641926, 8.6, 8.32, -0.25470683, -0.5094202, 8.68,
+    -0.97856563, -0.4895981, 8.36, -6.740236, 8.32, 0.3538513, -0.22964244, 8.32,
+    1.2022892, 0.5201989, -6.740236, 8.8, -0.5233511, -0.34541842, 9.5, -0.22998495,
+    0.07188097, -6.910217, 9.69, -7.20367, -7.444791, -0.3747429, -0.25000244, 9.61,
+    -0.20309542, 0.04078815, -7.444791, 9.96, -0.06550829, 0.16533954, 9.8, 0.17954645,
+    0.38235244, -6.7036514, 9.61, -6.8701315, -0.018741457, 0.10416827, -6.740236, 0.43109757,
+    0.8128502, 0.7396014, 1.97, -4.4179254, 1.77, 0.5467994, -6.2222686, 0.43011323,
+    -5.254704, -6.1628103, 0.004063263, -0.1794478, 1.88, 0.24926884, -0.058703538, 1.93,
+    1.88, -3.8950949, 0.46665207, 0.8737041, 0.5407836, -0.4176023, -1.4217949, -2.29015,
+    0.20505372, 0.45106617, -0.5968429, 0.021372033, 0.13781586, 0.5364582, 6.49, 5.95,
+    -4.894484, 4.53, 2.17, -0.30863324, -1.3321601, 5.75, 0.5780986, 0.08873915,
+    5.44, -3.7061508, 0.30444533, 0.014845555, -4.524055, -0.14863099, -0.37520513, -6.131815,
+    6.06, -0.5979607, -0.9262369, 6.18, -5.784454, -0.010785122, -0.3921483, 6.26,
+    -0.47541052, -0.66446775, 8.56, 8.36, 1.4290682, -6.3148303, 8.44, 0.59556407,
+    0.1646971, 8.44, 1.2855045, 0.7877237, 9.42, -6.0520425, 8.91, -0.051498145,
+    -0.19658288, 8.76, 0.5424029, 0.07439542, -6.286212, 9.46, -0.06077646, 0.5295375,
+    0.81766766, -1.8803589, -2.4040701, -2.907736, 4.65, 1.93, -15.789676, 1.62,
+    0.016476858, -0.42598388, 1.81, 0.3426668, 0.06110948, -13.286145, -19.22157, 1.3144051,
+    -1.0759854, -12.062972, 0.55534977, -0.32031065, 5.04, -3.2152596, 4.93, 0.635871,
+    0.3675049, 4.89, 0.24770847, -0.062378764, -3.8950949, 5.36, 0.5513664, 0.027314384,
+    -3.4696734, -0.38261566, -0.038021587, 4.53, 2.37, 2.13, 1.88, 0.5782236,
+    0.1704434, 2.21, -0.16062489, -0.646605, 4.21, 1.777832, -2.5247674, 0.78126746,
+    -0.6214239, -2.5247674, 4.69, 4.65, -0.546316, -0.3325177, 4.89, 0.018592943,
+    -0.26328072, 4.89, 4.69, -0.50207263, -0.23959427, -0.53080547, 4.45, -2.2326505,
+    -2.357731, 0.5523183, 3.9, 2.37, 0.021728134, 0.48878333, 4.29, 0.1448285,
+    0.49356133, 3.48, 3.2, 2.37, 0.1049914, 0.41561085, -2.1208782, 0.469395,
+    0.08447851, 4.36, 4.06, 0.013642634, -0.10487626, -1.9313097, 0.61617815, 0.02734127,
+    -1.9079165, -1.98534, 4.53, -2.068156, -0.2806979, 1.105127, -2.3197646, -0.17079118,
+    -0.39790854, 4.49, -1.4700369, -1.9313097, 0.10548325, -0.4345169, 1.0054833, 2.86,
+    -1.2630312, 2.44, 2.33, -1.4217949, 1.97, 0.5965053, 0.20372815, 2.05,
+    0.04949036, -0.47513732, -1.3340919, -1.362035, -0.95731986, -0.23906556, 1.1223572, 2.55,
+    -1.3340919, 0.7520373, 2.52, 0.4896391, 0.03727112, -1.7678375, 2.82, 0.6615771,
+    0.33297095, 2.67, 0.33884278, 0.106258504, 2.4, 2.05, -0.14428757, 1.97,
+    0.33540073, -0.043003235, -0.10486277, 0.43114623, 0.7985196, -0.10486277, -1.0684927, -0.16445628,
+    0.14696294, 2.17, 0.32328862, -0.2262774, -0.18892978, -0.82226276, 2.44, -0.11252637,
+    0.09079807, 2.52, -0.09153665, 0.0010063896, 2.52, 2.48, -0.08582391, 0.16141072,
+    -0.14428757, -0.0892839, -0.22319987, 3.86, -1.1948682, -1.2630312, -1.2995658, -1.8541082,
+    -0.08841889, 0.022092177, 3.48, -0.18065338, -0.010403137, 3.28, -1.2343782, 0.10053896,
+    0.008803232, 3.48, 0.24648824, 0.08310531, 3.56, -0.54071695, 3.32, -0.021333566,
+    -0.12673253, 2.94, -0.1227411, -0.30732295, -1.0684927, 3.63, -0.034399707, -0.18998365,
+    -0.9800166, -0.2927936, -0.43353254, 4.41, -1.6862178, 3.98, 3.9, -0.032021843,
+    -0.12555712, 4.33, -0.33234602, -0.1640206, 4.1, -1.1948682, -0.07252998, -0.27125403,
+    -1.362035, -0.15099613, -0.25541344, -1.5751029, 4.45, -1.8541082, 0.49867758, 0.13828522,
+    -1.7678375, 0.07156181, 1.1278523, -1.1948682, -1.2995658, -0.22739902, -0.678006, -1.1551399,
+    0.7488409, 0.071046844, 7.69, 7.18, 6.88, -14.294952, 4.57, 1.77,
+    1.34, 0.035680722, -0.10668671, -14.672277, -0.68295014, 0.5621516, 6.68, -17.44737,
+    1.666048, 0.80204165, -18.7905, 0.8482122, 0.037238847, 6.53, -9.684118, 4.49,
+    -0.05818988, 0.87208, 6.3, 0.028870558, -0.65807205, -13.614294, 6.68, -0.19995207,
+    -0.8171933, -11.773308, -1.2886603, -0.8389617, -17.44737, -21.931791, 7.06, -30.874868,
+    0.5410461, 0.20812085, -24.864492, -0.4443383, 0.41778633, 7.06, 6.95, -0.52437854,
+    -1.3062518, -21.50634, -0.5190953, 0.40821615, 7.14, 6.95, -14.294952, -0.69674116,
+    -1.6660284, -1.7985178, 1.2741708, -16.991007, 7.3, -22.656353, -22.907703, -23.178364,
+    -0.5546475, 0.24721248, -1.7942231, 7.22, -20.516748, 0.3609601, 1.2129136, 7.26,
+    0.4148808, -0.05197605, 7.53, 7.38, -30.874868, -1.0311165, -0.5079752, 7.49,
+    -1.2379235, -0.7397753, 7.57, -20.089907, 0.0072700502, -0.5858154, -18.367512, -0.19581573,
+    -0.04865257, 7.46, -13.286145, 7.38, 7.26, 1.8453467, 1.0000163, -14.672277,
+    -0.5387232, 0.486905, 2.1159935, -12.377764, -13.614294, 7.57, -0.42248026, -0.043286808,
+    7.53, 0.6369397, -0.3134641, 7.53, 7.49, 2.0060422, 1.3316423, -10.59073,
+    0.15016983, 1.09775, -10.025825, -11.773308, -12.062972, -12.377764, -14.995561, -0.28705534,
+    -0.5057425, -0.33234835, 7.85, 7.77, 7.73, -0.08376713, -0.02425232, 0.034985732,
+    7.89, -0.11298733, 7.93, 0.028860474, -0.0440979, -10.792877, 7.85, -11.515594,
+    -0.7697733, -1.1847153, -11.26825, -0.31304824, 7.93, -0.8882891, -0.55647796, -10.396682,
+    7.85, 7.77, -0.54992193, -0.91027135, 8.01, -0.36105296, -0.61593705, 7.77,
+    -10.19933, -0.18045501, 0.15746765, 8.05, -0.39135802, -0.6188206, 7.85, -9.50892,
+    7.77, -9.847813, 0.4870267, 0.90691197, -9.847813, -0.2834376, 7.81, 0.031008149,
+    -0.14257532, 7.81, 7.77, 1.6610771, -9.193894, 0.7039831, 1.4221108, -9.029197,
+    -9.349648, 0.0931427, 0.25787035, 1.0928892, -8.328821, 7.97, -9.029197, -9.50892,
+    -0.30987218, -0.17147341, 7.89, 0.5326644, -0.03295212, 8.17, -9.029197, -0.56563205,
+    -0.40425888, -0.7488839, 8.09, -7.8932815, 7.93, 1.1364744, 0.27172348, -7.485508,
+    0.8197832, 1.1610187, -7.667374, 9.73, -0.5173151, -0.07860205, 8.32, 0.4391547,
+    0.01751888, -36.19027, 6.99, 1.73, 1.58, 0.12, -51.15694, 0.18364511,
+    -40.02452, 0.0049080807, -0.1653056, 1.42, 1.3713179, 1.5, 0.55039907, 0.07541896,
+    1.62, -42.560875, -45.980717, -0.2157547, 0.17112695, -37.815678, -0.41547623, -0.12578838,
+    1.69, -0.47640562, -0.8028207, 6.91, 1.4603885, 6.95, 0.72444695, -45.980717,
+    0.11959648, 0.4291165, 7.22, 7.06, -51.15694, 0.07112198, -0.25190592, -0.44846073,
+    -0.7193911, 0.59, -29.518152, 0.23, -30.874868, 0.2, -31.608435, 0.00363138,
+    -0.36570013, 1.281347, -0.22071277, 0.69670695, -27.639406, -28.209562, 0.27, -28.786161,
+    -0.095038764, -0.4587333, 0.54559904, -0.5940884, -26.084858, 0.35, -27.161629, 0.16721325,
+    0.09595572, 1.3891705, 0.35, -1.1162443, -24.452414, -0.21035378, -0.025112225, 1.3,
+    -20.981464, 0.67, -21.12554, 0.63, -0.0024670342, 0.60878634, -1.0366118, -23.813517,
+    1.3476745, 1.14, 1.2301909, 0.5547678, 1.14, 0.71, 0.67, -1.3600744,
+    -0.6121068, -20.516748, 0.8276674, -0.004152261, 1.26, -20.803585, 0.12208042, -0.44405952,
+    -20.652575, -0.124240115, -0.84091616, 1.46, -25.69593, 1.34, -27.639406, 1.3310059,
+    0.5612399, -28.786161, 0.6215395, 0.04397072, -22.656353, 1.38, 0.024158394, -0.8170868,
+    1.34, -0.658958, -1.2794809, -24.452414, 7.1, 1.85, -0.29661867, 0.34370893,
+    7.38, -0.41301486, -0.8454443, 1.66, -22.377066, -0.32282436, 0.6999969, -14.294952,
+    0.061443478, 0.00879568, -1.8803589, -2.4040701, -2.907736, 4.65, 1.93, -7.9547505,
+    1.77, 0.009717834, -0.24785988, -4.524055, 0.18675315, 0.4868891, -3.2776601, 4.57,
+    -0.31675687, 0.12411286, 4.45, 0.01862766, -0.8980675, 5.16, -3.4047515, -3.8950949,
+    0.7860827, 0.37432086, 4.93, 0.24645081, -0.029150203, -4.32814, 5.48, 0.6210628,
+    0.017834364, -3.2152596, -0.2557905, 0.08895358, 4.53, 2.37, 2.13, 1.88,
+    0.4796811, 0.1314229, 2.29, -0.29145882, -0.75530624, -2.8076367, -0.51844025, 4.21,
+    1.4550768, 0.6301008, -2.5247674, 5.28, 4.69, -0.38892543, -0.10665727, -2.8076367,
+    -0.07054946, -0.48318607, 4.89, 4.61, -0.62270814, -0.24751535, -0.4355789, 4.45,
+    -2.2551181, 2.37, 2.01, -2.3197646, 0.30963403, 0.0025993348, 2.13, -0.20223115,
+    -0.01820755, -2.3197646, 4.1, 0.4676462, 0.34272638, 3.86, 0.41197014, 0.18465655,
+    4.36, 3.56, -2.173437, 0.44332275, 0.17119136, -2.173437, 0.05812931, -0.05624776,
+    -1.9079165, 4.41, 0.29481924, 0.68599856, 4.41, 0.12652282, -0.3734772, -1.9079165,
+    -1.98534, 4.93, -2.2551181, -0.034898024, -0.28685078, -2.357731, -0.2339224, -0.4119372,
+    4.49, -1.2551816, -1.9313097, 0.09116822, -0.39483187, 0.90116847, 2.86, -1.2995658,
+    2.44, 2.21, 1.93, -1.4832442, 0.59492934, 0.17328542, -1.4217949, 0.20062959,
+    -0.10785713, -1.3340919, 2.33, -0.000017852783, -0.6733263, 2.29, -0.4845135, 1.0063546,
+    2.59, 2.52, 0.6352367, -1.4536674, 0.49166662, 0.19657734, -1.7429106, 2.78,
+    0.5842361, 0.25062442, 2.71, 0.18846798, 0.065383576, 2.4, 2.05, -0.18892978,
+    1.97, 0.25228384, -0.07469064, -0.07408267, 0.36705357, 0.67782223, -0.30146822, 2.13,
+    -0.48882934, 0.20017067, 2.17, 0.33511218, -0.15233503, -0.18892978, -0.82226276, 2.63,
+    0.11565193, -0.013425176, 2.48, 0.057329405, -0.058890857, 2.59, -0.07408267, -0.008734098,
+    -0.097666785, -0.07408267, -0.14572279, -0.2547147, 4.49, 3.86, -1.1948682, -1.2630312,
+    -1.2995658, 0.0054181544, -0.1029034, -1.2343782, 0.12767561, 0.04596004, 3.44, -0.5968429,
+    -0.031306606, -0.18697746, -0.9800166, -0.12765574, -0.31315976, 4.41, -1.6287112, 3.98,
+    -0.100639544, -0.23656438, -1.2995658, -0.09797468, -0.18332517, -1.6592834, 4.45, 0.2073543,
+    0.55093116, -0.4176023, -0.16616647, 0.2737938, -1.6287112, 1.2771462, -0.6559018, -1.3340919,
+    -1.3970085, 0.25953063, -0.9911434, -0.771789, 0.15855357, -0.14422302, -0.48152414, 0.8081152,
+    0.053434756, 7.65, 7.14, 6.88, -14.294952, 4.57, 1.77, -20.516748,
+    0.034626212, -0.07045645, -16.183819, -0.60033816, -0.055839475, 6.76, -17.44737, 1.1330161,
+    0.4890041, -23.178364, 0.73027414, -0.019520357, 6.53, -9.684118, 4.49, -0.041216157,
+    0.6996233, 6.34, 0.017596187, -0.6066116, -9.847813, -11.773308, -0.8753764, -0.45889083,
+    -1.1752565, -18.7905, -21.931791, -22.12889, 7.06, 0.22232616, -0.1389083, 6.99,
+    -0.93469876, 2.000384, 7.06, 6.91, -0.172479, -0.97599, -20.803585, -0.071848355,
+    0.90337497, 6.99, -14.995561, 6.91, -0.24504943, -0.6350231, -1.3465918, -1.6524403,
+    -15.789676, 7.3, -18.7905, -21.931791, -27.161629, -0.38531512, -0.19501907, -19.668941,
+    0.39754054, -0.37417698, 7.22, 7.18, 1.9584292, 1.3253064, -17.44737, -0.029384179,
+    0.6675016, 7.57, 7.38, -16.605732, -0.46987316, 0.09822554, 7.49, -0.9203972,
+    -0.54047436, 7.61, -17.44737, -0.16684397, -0.06313738, -16.991007, -0.0035839844, 0.10507279,
+    7.49, -12.962669, 7.38, -14.294952, 0.95185614, 1.6226324, -13.937053, -0.18719509,
+    0.681194, -12.655651, 7.46, 1.4572629, 0.68495363, 1.9302208, -12.377764, 7.53,
+    -13.937053, -0.25998247, 0.24974564, -14.294952, 0.019450195, -0.20348716, 7.57, -11.515594,
+    0.67271405, 1.2055496, -10.792877, -0.032999475, 0.90742034, -10.19933, -11.773308, -12.062972,
+    -14.995561, -15.410659, -16.605732, -0.10320562, -0.2681244, 7.69, -0.0010023117, -0.18590431,
+    7.69, -14.672277, -0.13549308, -0.6513411, -12.377764, -0.41286474, -0.2759082, 7.69,
+    -0.27622008, 7.85, 7.77, -0.05299368, 0.025743484, 7.89, -0.10003376, -0.0126932785,
+    -10.792877, 7.93, -11.26825, 7.85, -0.7032249, -0.19006775, 7.73, -0.6512324,
+    -1.017301, -11.26825, -0.27201483, -0.46014223, 7.69, -10.59073, -0.089949034, 0.10446861,
+    -10.396682, 7.85, -0.6076691, -0.36230224, 7.81, -0.19096003, -0.4205794, 7.81,
+    -9.684118, 7.69, 1.0962389, 7.77, -10.025825, 0.12985268, 0.49260473, -9.847813,
+    -0.3044965, 0.0378006, 7.77, 1.2206177, -9.193894, -9.50892, -0.00759786, 0.5711443,
+    1.1613365, -6.653369, 8.09, -8.113236, 7.93, 0.20863076, -0.24387796, 7.97,
+    0.98237497, 0.5419287, 9.57, 8.32, -0.09266012, -0.40407798, -7.01124, 0.008429947,
+    0.2362564, 8.52, 8.36, 8.32, 1.1574544, 0.774378, -6.4785495, 0.02006035,
+    0.6997862, -5.878716, 9.42, -0.08146065, 0.27867088, 8.83, 0.51762843, 0.062034477,
+    0.59, -21.931791, -22.12889, 0.56, -22.656353, 0.48, -23.477354, -0.010395302,
+    -0.75710833, -23.477354, -1.3664991, -0.12997593, -22.377066, 0.08870807, 0.2718899, -22.377066,
+    -1.7342545, -0.20991878, 0.22024317, -0.44029984, -20.981464, 1.34, 0.67, -21.12554,
+    0.63, -21.50634, 0.19460852, -0.7872455, -21.69312, 1.2995884, 0.43669397, -0.8523328,
+    -23.477354, -24.864492, 1.059924, -24.452414, 0.43243542, 0.88157475, 1.18, 0.75,
+    1.1039276, 0.70930153, -22.12889, 0.5234905, 0.09750212, 7.18, 1.88, -26.084858,
+    1.54, 0.36923936, -0.33206865, 1.54, -0.6023013, -0.13265496, 6.83, -23.178364,
+    0.97598755, 0.5250855, 7.1, 0.13645442, -0.114559256, -22.656353, -22.907703, 7.34,
+    -0.31068465, -0.5276426, 7.26, -1.539561, 0.034617998, 7.3, -22.12889, 0.18226567,
+    0.6300346, 7.34, 0.019937439, -0.33022544, 0.71, -20.652575, 0.67, -1.1345204,
+    -20.803585, -0.09232015, -0.6305911, -1.1099817, -20.516748, 1.14, -20.803585, 1.06,
+    1.6680542, 0.53929263, 0.75, 0.34808463, 0.84511536, 1.46, 1.34, -0.1728465,
+    -1.1629487, 6.88, 0.6777043, -0.37097612, 0.75, -20.402336, -0.4479234, -0.84768695,
+    1.42, 1.1, 0.07047843, -0.49147573, 1.58, 1.1040465, 0.0077097877, 9.88,
+    6.64, -7.1032915, 2.17, 1.88, -16.605732, -19.330385, 0.01097178, -0.18136328,
+    1.66, 0.3677081, 0.10235574, -8.453863, 1.97, -0.4070978, -0.80497676, 2.05,
+    0.15842663, -0.6835509, 6.22, -13.286145, -19.22157, 1.3360535, -0.82416576, -7.9547505,
+    0.95007336, 0.36140093, -10.025825, 6.49, 0.94760984, 0.27624583, 6.34, 0.067507096,
+    -0.5332107, 5.99, -5.4127874, 5.91, 4.61, 0.011925091, 0.43852043, -6.8298554,
+    0.39656618, -0.22110124, 5.55, -4.6410313, 0.29591173, 0.0046051806, -5.254704, 0.14259955,
+    -0.20835927, -6.131815, -6.7036514, 6.06, -0.022277396, -0.45205185, -6.5924907, -0.48233077,
+    -0.6528174, -5.842078, 6.14, 0.052817345, -0.2810969, 6.14, -0.3403992, -0.48284194,
+    -6.4785495, 8.32, -7.1555967, 8.17, -8.113236, -0.034793906, 0.37465808, -7.7751694,
+    -0.5138312, -0.2809803, -6.8298554, 8.2, 0.8423853, 0.18623595, 8.28, 1.0367144,
+    0.5979969, 9.53, -6.8298554, -7.2534256, -0.52645165, -0.3296835, 8.4, 0.14186512,
+    -0.18455572, -6.8701315, 9.65, -0.17982887, 0.011691338, -6.5553975, 0.21465842, 0.6998416,
+    8.64, 8.44, 8.4, 0.86882126, -6.2222686, 0.39018005, 0.93632525, -6.2222686,
+    8.56, 0.18412258, -0.090624414, -5.949599, 0.44207093, 0.7943992, -5.7152433, 9.23,
+    8.72, 0.15727493, -0.15087722, -5.9075212, 0.077544205, 0.500053, 8.87, 8.83,
+    0.5587267, 0.33051226, 9.1, 0.038898267, 0.44034487, -7.7751694, -8.018251, 9.96,
+    -0.40107948, -8.113236, -0.3061301, -0.118863456, 9.92, -0.12519272, -7.9547505, 9.96,
+    -0.13200508, -0.05764653, 9.96, -7.832062, -0.033900023, 0.17371522, -7.8932815, 0.035162214,
+    0.19867113, -7.5758924, 9.96, 9.92, -7.722872, 0.34600952, -7.667374, -0.3230708,
+    0.06365585, -7.722872, -0.29790244, -7.667374, 0.1749585, -0.030800411, -7.667374, -7.722872,
+    0.1522305, 0.06291085, 0.35712048, -7.5297284, 9.96, 9.92, 0.052305825, 0.10422873,
+    0.3847706, -7.444791, 9.92, -7.485508, 0.31651956, 0.12711574, 0.37871495, 0.46425033,
+    -1.5112904, 7.65, 7.14, 6.79, -14.294952, 4.57, 1.77, 0.0023640704,
+    -0.32466283, -16.183819, 0.7194478, 0.20206085, 6.49, -8.113236, 0.24208148, 0.00012287688,
+    -13.614294, -0.20085846, -0.5915178, -18.7905, 6.91, -30.874868, 1.0026476, 0.05844691,
+    -21.931791, 0.07161131, -0.16803734, 6.95, -14.995561, -0.17210567, -0.9045154, 7.06,
+    -1.009277, -1.627042, -15.410659, 7.3, -18.7905, -23.178364, -0.21144226, 0.06204149,
+    7.22, 1.2746637, 0.4570895, 7.57, 7.38, -0.26400033, -0.59208435, -18.367512,
+    -0.14614105, 0.011341931, 7.49, -13.286145, 7.38, 1.0043685, 0.12998456, -12.655651,
+    1.027454, 1.5661424, -12.377764, 7.53, 0.054674048, -0.109812394, 7.61, 0.6353445,
+    0.08595245, -10.19933, -11.773308, -12.062972, -14.995561, -15.410659, -0.19892044, -0.08614001,
+    7.69, -0.50386435, -0.31046754, 7.69, -0.22769165, 7.85, -0.018914726, -0.057672378,
+    -10.792877, 7.85, -11.515594, -0.46095797, -0.740818, -11.26825, -0.21116646, -0.47695598,
+    7.69, -10.59073, -0.0723938, 0.09039862, -10.396682, -0.40824166, -0.29817957, 7.85,
+    -9.847813, 7.77, 7.69, 0.7384493, 0.27547643, -0.36088616, 7.77, -9.50892,
+    0.7206456, 1.123244, -9.029197, 0.2280247, 0.9589557, -8.453863, 8.05, -9.029197,
+    -0.25142115, -0.008840943, -8.718564, -0.40678927, -0.553535, 8.13, -7.485508, 0.22822109,
+    0.75621605, -7.20367, -0.11279602, 0.040788304, 2.63, 2.09, -0.18892978, 2.01,
+    1.93, 1.88, 0.49230346, 0.25484854, -0.4176023, -0.030315017, 0.26734924, -0.9247528,
+    -1.4832442, 0.4071345, 0.011850262, -0.24307282, -0.40087014, 0.047758993, -0.07408267, 0.34142628,
+    0.50069255, -0.18892978, 2.17, -0.48152414, -1.0267481, -0.11000154, -0.9082695, -0.4176023,
+    -0.034366608, 0.4507675, -0.48152414, 2.4, 0.18877606, 0.0695697, 2.59, -0.034613516,
+    0.3392349, 2.13, -0.14428757, -0.095609665, -0.10486277, 0.7150137, 0.19798534, 2.33,
+    2.21, -0.022351494, -0.24784935, 2.52, -0.0025529407, -0.13714083, -0.30146822, 3.1,
+    -1.3340919, -1.4832442, 2.94, -0.025351716, 0.08693756, -1.3970085, 0.16432507, 0.086763844,
+    2.78, -0.6559018, -0.09973797, -0.010751846, 2.82, 0.13980082, -0.013965066, -0.4176023,
+    -0.54071695, 4.45, -0.08277919, 0.18785124, 4.49, -0.631354, 0.3931143, -0.3603938,
+    0.7053154, -0.37055054, 2.74, -0.07408267, -0.14428757, -0.18892978, 0.018040212, 0.18261461,
+    2.67, -0.1461847, -0.0018378448, -0.23369364, 2.9, -0.24307282, 2.86, -0.030661926,
+    -0.09903546, -0.25204653, -0.3653204, 9.77, 8.56, 8.48, 0.79, -20.402336,
+    0.75, -20.516748, -0.008735136, -0.45981717, -20.516748, 1.311682, 0.40047875, 0.75,
+    -0.6912463, -19.876776, -0.35347834, -0.77048457, 1.03, -19.982029, 0.83, 0.24466033,
+    0.88987035, 0.91, -0.25532112, 0.122079134, -36.19027, 1.46, 0.81773406, -0.02827021,
+    7.1, -0.00491701, 0.03241842, -6.2222686, -7.485508, -0.3997207, 8.52, -6.2553506,
+    0.16009428, -0.14408799, -6.511228, -0.09208359, 0.06600966, -6.0203667, -6.131815, 0.46370202,
+    8.52, 0.32941937, 0.06729301, 0.762175, -5.9075212, 9.34, -6.8701315, 8.6,
+    -0.34851488, -6.961682, -0.7220998, -0.35779914, 8.95, -6.653369, -0.28003347, -0.038894724,
+    -6.2222686, -0.12532297, -0.21638648, -6.0905485, 9.38, -6.5924907, 0.12520814, -0.36546656,
+    -6.286212, -0.02903809, 0.37551162, 0.7355993, 8.8, 8.68, -5.842078, 8.6,
+    0.66155046, 0.29947662, 0.72202015, -5.7152433, -5.842078, 0.081175454, 0.23023205, 8.76,
+    0.5146399, 0.295634, -5.5945034, 9.1, 8.91, -0.055722006, -0.2739102, -5.813874,
+    0.07672319, 0.31812102, 8.91, 0.5402237, -5.5490093, 0.31976357, 0.5480098, -7.7751694,
+    -8.018251, 9.96, -0.31136355, -8.113236, -0.23630905, -0.07716484, 9.92, 9.84,
+    -7.8932815, -0.33002993, 9.8, 0.06299693, -0.2258708, -7.8932815, 9.88, -0.18861564,
+    -0.10713952, 9.88, -0.007851728, -0.057254028, -7.9547505, 9.96, -0.08794098, -0.026179856,
+    9.96, -7.832062, -0.006394148, 0.1639685, -7.8932815, 0.049277287, 0.18340488, -7.349471,
+    9.88, 9.8, -7.667374, -0.33635926, -7.5297284, 0.0021831736, -0.060566265, -7.3987164,
+    -7.617456, 0.06391988, -0.035355903, 9.84, -0.0071248375, 0.4688103, -7.5758924, 9.96,
+    9.92, 0.09003296, 0.0018888855, -7.667374, 0.108582534, 0.3115134, -7.5297284, 9.96,
+    0.08938866, 0.33531967, 0.33544278, -7.20367, 9.8, -7.3014965, 0.38914108, -7.2534256,
+    -0.11454544, 0.07237651, 9.84, -7.3014965, 0.26906854, 0.57880014, 0.28734514, 0.5781157,
+    9.5, 8.91, 0.63, -21.325644, -21.50634, 0.59, -51.15694, 0.14007829,
+    -0.03751346, -22.12889, 1.3407933, 0.10694057, -0.39520594, -1.4146953, 1.26, -21.12554,
+    -21.69312, 1.18, 0.8823704, 0.6330369, 1.14, 0.4643112, 0.15395574, 0.67,
+    -0.81571466, -19.539429, 0.08911486, -0.15367438, 1.46, -23.477354, -28.209562, 0.5892421,
+    0.14049517, 1.38, -0.41868573, -1.0624126, -24.452414, 7.03, 0.036121797, -0.24569781,
+    1.62, 0.36007035, 0.0052640657, -6.3485193, 8.99, 8.95, -6.4524984, -6.511228,
+    0.042409386, 0.21780579, -0.048098247, -6.4785495, -6.511228, -0.021945382, -0.05486698, 0.05653992,
+    9.46, -6.5924907, 9.23, -0.13490757, -0.020434884, 9.42, -0.29643887, -0.08370923,
+    -6.653369, -7.1032915, -0.13517202, -0.5065951, -6.4524984, -0.1910839, 0.08348656, 9.14,
+    -5.6420994, -6.2222686, -6.286212, -0.14405084, 0.07867775, 9.07, -0.269088, -0.14215378,
+    -5.5945034, 9.03, -0.21104462, 0.22776473, 9.03, 0.25151697, 0.45445308, -5.842078,
+    9.3, -6.2222686, 0.034926392, -0.13451551, -6.0520425, 0.11102738, 0.4725646, 9.23,
+    -5.7152433, 0.1895967, 0.406859, -5.750133, 0.5085263, 0.10224991, -6.5924907, 9.61,
+    -6.8701315, 9.57, -7.20367, -0.39706543, -7.1032915, -0.06635704, -0.22603266, -7.1032915,
+    -7.2534256, -0.090043485, -0.2767907, -6.961682, -0.13356674, -0.056168962, 9.57, -6.7859416,
+    9.53, 0.030849803, 0.076657325, -6.740236, -0.3067524, -0.052818794, -6.7036514, -6.7859416,
+    0.0252623, -0.049942996, -6.618714, 0.42175928, 0.1462789, -7.01124, 9.73, -7.2534256,
+    -7.485508, -0.31232765, -0.17191158, 9.69, -0.047303535, 0.074129656, -7.5297284, 9.96,
+    -0.052438434, 0.09416208, -7.2534256, 0.12451544, 0.324519, 9.69, -6.7859416, 9.65,
+    0.05810495, 0.29381263, -6.740236, 0.32172582, 0.6035599, 0.51253194, -6.4785495, 9.53,
+    -6.511228, -6.5553975, 0.26984063, 0.051015474, -0.36065918, -6.5553975, 9.57, 0.07898273,
+    0.61201096, 0.57175475, 0.6669454, 9.5, 8.56, 8.48, 4.69, 4.49,
+    -4.32814, 2.05, -0.008321214, -0.5878069, -2.0923567, 0.15143682, -0.0060117333, -3.6424093,
+    4.57, -0.20237043, 0.24041243, -1.9079165, -0.37830657, 0.2872708, 4.89, -3.2152596,
+    -3.4696734, 0.60947335, 0.40555355, -2.6292815, 0.14525203, -0.12068281, -3.8215072, 5.24,
+    0.5033044, 0.012420512, -2.6292815, -0.10406496, -0.3068933, -6.2222686, -7.444791, -7.5297284,
+    -0.34003967, -0.1337033, 8.52, -6.389413, 0.15589671, -0.010170855, -6.286212, -0.045804653,
+    0.16359444, -6.0520425, -6.131815, 0.37577134, 8.52, 0.13803902, 0.05485491, 0.58732575,
+    -6.3485193, 8.76, -6.653369, 8.68, -7.01124, -0.43899107, -0.30959612, -0.6304932,
+    8.6, -6.4785495, -0.47436938, -0.238403, 8.68, 0.009293309, -0.17297275, 9.03,
+    8.8, -6.618714, -0.17918225, 0.03755943, 8.95, 0.0969038, -0.023895795, 9.3,
+    -6.653369, 0.12775373, -0.15235709, 9.42, -0.23231478, -0.15265854, 9.38, 8.72,
+    -5.9075212, -6.0203667, 0.015520512, 0.17513363, 8.68, 0.50475377, 0.27320966, -5.682901,
+    9.14, -0.1218848, 0.032793615, 8.87, 0.33644074, 0.12546918, -6.1628103, 9.42,
+    -6.2222686, -0.05739928, -0.29345232, 9.46, 0.17593336, 0.53941935, -6.0520425, 0.67024404,
+    -0.032338716, -6.5924907, 9.61, -6.8701315, 9.53, -0.2469693, -7.20367, 9.57,
+    -0.33353516, -0.14256239, -7.01124, -0.1495961, -0.096342035, 9.57, -6.7859416, 9.53,
+    0.025240812, 0.06351624, -6.740236, -0.2607397, -0.04271443, -6.7036514, -6.7859416, 0.020715332,
+    -0.04066805, -6.618714, 0.35146588, 0.12677512, -7.01124, 9.73, -7.2534256, -7.485508,
+    -0.25314966, -0.13827638, -7.054926, -0.020434571, 0.10625197, -7.7751694, -8.018251, -0.18903117,
+    -0.03885936, -7.3014965, 0.062801465, 0.22902046, 9.69, -6.7859416, 9.65, 0.0469487,
+    0.23760442, -6.740236, 0.26453045, 0.5069901, 0.4202756, -6.4785495, 9.53, -6.511228,
+    -6.5553975, 0.22936402, 0.043362807, -0.3029541, -6.5553975, 9.57, 0.065161325, 0.5202088,
+    0.468839, -6.4524984, 0.35381055, 0.60506046, 9.88, 7.65, 7.14, 6.64,
+    -7.1032915, 2.17, 1.88, -0.0018061912, -0.36517915, 6.18, 0.5078417, 0.0903305,
+    5.95, -5.682901, 0.2610421, 0.0007610635, 6.02, -0.16434465, -0.3673228, -14.995561,
+    6.83, -18.7905, 0.5332358, 0.07965443, -19.330385, 0.06643731, -0.52483696, -11.773308,
+    -13.286145, -0.5522224, -1.1123092, -10.396682, -0.1678888, -0.69858146, -15.789676, 7.3,
+    -18.7905, -18.977423, -0.04426619, -0.8879904, 7.26, 0.8249612, -0.08239254, 7.53,
+    7.42, -0.2648624, -0.62807626, -20.089907, 0.16619797, -0.13228773, 7.46, -13.937053,
+    7.34, 0.9134005, 0.033194993, -12.655651, 0.8928615, 1.4568145, -12.377764, -13.614294,
+    -0.13174228, 0.08438255, 7.53, 0.88386863, 0.26066956, -10.19933, -11.773308, -12.062972,
+    -14.995561, 7.69, -0.09368455, -0.19203143, 7.69, -0.42067465, -0.25918362, 7.69,
+    -0.19927734, 7.73, -0.06786328, -0.025957901, -10.792877, 7.89, 7.73, -0.42166153,
+    -0.6133235, -11.26825, -0.17063184, -0.33751914, 7.69, -10.59073, -0.069049835, 0.064852625,
+    8.01, -0.28161266, -0.4421206, 7.89, -8.718564, 7.81, -9.684118, 0.32617977,
+    0.7078153, -9.50892, -0.27481085, 0.10065227, -8.577097, 7.85, 0.6458782, 0.22914009,
+    0.9094739, -7.3987164, 8.05, -8.21763, -0.14247683, 0.40207133, -7.832062, -0.33590612,
+    -0.13127713, 8.32, -6.8701315, 0.22277434, 0.6894894, -6.511228, -0.053088088, 0.048104033,
+    -7.667374, -7.9547505, -8.018251, 9.96, -0.2182153, -8.113236, -0.18111293, -0.046199188,
+    9.96, -0.055538177, -0.031556115, 9.92, -7.722872, -7.7751694, -7.8932815, -0.07556667,
+    -0.02940054, 0.29263183, -0.27834168, 9.96, -7.722872, -7.7751694, 0.047623597, -0.24477641,
+    0.16305237, -7.722872, -7.8932815, 0.030262757, 0.12651925, 0.023371762, 9.96, -7.485508,
+    -7.5758924, 9.92, -7.617456, -0.06071682, 0.09932997, -7.617456, 0.022698296, -0.049001314,
+    -7.5297284, 9.92, 0.04557408, 0.089030966, 9.92, 0.20754662, 0.08370497, 9.92,
+    -7.444791, 0.03504508, 0.26840767, 0.41979423, 0.25647947, 9.5, 8.91, 0.87,
+    -20.188913, 0.79, -20.402336, 0.71, -0.01984516, 0.3405119, 0.75, -0.5280217,
+    -0.31638524, -20.516748, 0.06891887, -20.28955, 1.1240581, 0.6782107, 0.83, 0.75,
+    -0.6514252, -0.30201823, -19.982029, 0.45652533, -19.76686, -0.18907005, -0.3187634, 1.03,
+    -19.668941, -19.876776, -20.28955, 0.38597792, 0.80229187, 0.91, 0.019677887, 0.5233292,
+    0.95, -19.09326, -0.17942785, -0.67549497, -19.428238, 0.5860622, -0.11045136, -36.19027,
+    6.99, 1.42, 0.764252, 0.14578024, 7.14, -0.32037953, -0.20639113, 1.46,
+    -21.325644, 0.18999855, -0.21564768, -22.656353, -0.06371211, 0.005979154, -6.286212, 8.99,
+    8.95, -6.4524984, -6.511228, 0.028038789, 0.15975587, -6.3485193, -0.06101939, 0.07844727,
+    -6.4785495, -6.511228, -0.0071058273, -0.050268173, -6.417596, 0.043619998, -0.008471489, 9.42,
+    -6.5924907, -6.7036514, 0.10171955, -0.050154466, 9.34, -0.14837731, -0.34675348, -6.7036514,
+    9.46, -0.11871338, -0.3621975, -6.389413, -0.05929734, 0.12272034, 9.3, -5.5945034,
+    9.07, -6.2222686, 0.07342072, -0.20201401, -5.842078, -0.09862512, 0.1389565, -5.5490093,
+    9.03, 0.105563596, 0.3445494, 0.3811929, -6.0203667, 9.38, -6.0520425, -0.1732476,
+    0.23495927, -6.1628103, 0.13902538, 0.50285196, 9.34, -5.949599, 0.059240468, 0.40747347,
+    0.50562066, -6.5924907, 9.61, -6.8701315, 9.53, -6.961682, -0.13900538, -0.27251384,
+    -7.20367, 9.57, -0.27167544, -0.1044138, -7.01124, -0.110560216, -0.067523524, 9.57,
+    -6.7859416, 9.53, 0.030303955, 0.061728995, -6.740236, -0.21366559, -0.024387028, -6.7036514,
+    -6.7859416, 0.026542893, -0.023257338, -6.618714, 0.3017362, 0.11694946, -7.1032915, 9.77,
+    -7.3014965, -7.444791, -0.13930063, -0.089069955, 9.69, -0.06334617, 0.050725814, -7.349471,
+    -7.8932815, -0.063166164, 0.052179437, -7.20367, 0.21652327, 0.38397357, 9.69, -6.8701315,
+    -7.01124, -0.014052617, 0.08402097, 9.65, 0.1984522, 0.43083802, 9.73, -7.054926,
+    0.03332418, 0.34354052, -7.054926, 0.54766315, 0.05805359, -6.4785495, 9.53, -6.511228,
+    -6.5553975, 0.20292245, 0.044820786, -0.26217774, -6.511228, 9.57, -6.5553975, 0.06304779,
+    0.26330084, 0.45014, 0.4558545, 0.43434152, 1.3, -19.22157, 0.87, -20.188913,
+    0.79, -20.516748, 0.71, -0.013913201, 0.51141804, 0.75, -0.45118532, -0.08960246,
+    -20.516748, 0.059730023, -20.28955, 0.921727, 0.5530032, 0.83, 0.75, -0.58628273,
+    -0.24240957, -19.982029, 0.37536487, -19.76686, -0.15324596, -0.25694257, -22.377066, -24.864492,
+    0.92800933, 1.26, 0.59873664, -24.452414, 0.14368592, 0.42955232, 1.14, -19.539429,
+    1.03, 0.4148798, 0.19108643, 0.99, -0.12924473, 0.18170062, -20.803585, 1.22,
+    0.22325929, 0.006443351, -19.76686, -0.46849385, 0.06479441, -18.977423, 1.22, 0.95,
+    -19.09326, 0.91, -0.2871562, -0.08407898, -0.5741707, -19.09326, 0.99, 0.15530881,
+    -0.28803203, 0.99, -0.25591406, 0.04425114, 1.26, -19.09326, -0.07957306, -0.43497673,
+    -0.6518377, -18.7905, 1.06, 0.99, -0.16643128, -0.3859875, 1.18, 1.1,
+    -0.0602114, 0.042238183, -0.38796934, -0.46362272, 1.46, -27.161629, 1.38, -29.518152,
+    0.8033072, 1.34, 0.4166448, -28.209562, 0.19944763, -0.06288859, -30.874868, 1.42,
+    -37.815678, 0.3141668, 0.7041547, -33.599087, 0.26003358, -0.1980992, 1.42, -30.058292,
+    -0.093508914, -0.60706866, -27.639406, 0.1650556, 1.7187033, -20.652575, 1.38, 1.34,
+    -21.12554, 0.17870235, -0.12073686, -23.178364, -0.067395866, -0.28937167, -24.11707, 1.42,
+    -0.6428221, 0.07707488, 1.42, -0.53987145, -1.0965966, -19.876776, -20.402336, 1.34,
+    -0.13621178, -0.8241157, -1.1402642, -0.514426, -22.656353, 1.85, -26.084858, 1.54,
+    -32.61234, 0.2636158, -0.003078003, -27.639406, -0.32051012, 0.05900771, 1.58, -25.265562,
+    -1.7709671, -0.37591323, 1.69, 0.5498184, -0.34794894, 7.03, -27.161629, 6.95,
+    0.5583581, 0.18107824, 6.79, 0.6935825, -0.14834704, -28.209562, 7.14, -0.41177946,
+    -0.17664465, 7.1, 0.43822232, -0.06238225, 1.58, -18.367512, -21.325644, -22.377066,
+    -0.20504366, 0.5628893, 1.54, 1.8620348, 0.71107125, -16.605732, -17.44737, 0.050199892,
+    -0.079322055, -15.410659, 0.4878721, 0.111136876, 1.93, -4.524055, 1.81, 0.09012097,
+    -0.08186995, 1.81, 0.5977791, 0.32993874, 2.33, -2.6292815, -0.262042, 0.025977964,
+    -1.1551399, 0.00568688, -0.04095941, 9.5, 7.61, 7.14, 6.72, -7.9547505,
+    4.53, 1.88, -0.0023633305, -0.26499483, 6.3, 0.60641927, 0.058402218, 6.06,
+    -6.961682, 0.39725935, 0.0033078685, -6.1628103, -0.40633568, -0.22993362, -18.7905, 6.83,
+    -23.178364, 0.540729, 0.11747598, -21.931791, 0.07902518, -0.121535555, 6.99, -15.410659,
+    -0.03232056, -0.5872414, 7.06, -0.7892799, -1.2377291, -14.672277, 7.3, -18.367512,
+    -21.931791, -0.079497956, 0.108909704, -16.605732, 0.436869, 0.95453566, -16.183819, -20.089907,
+    -0.14158045, -0.45360622, 7.42, 0.039905135, -0.21067098, 7.46, -12.962669, 7.42,
+    0.7388434, 0.099959984, 1.0662043, -12.962669, -13.614294, -0.1486272, 0.03320217, -11.018427,
+    0.3423197, 0.85944444, -10.396682, -13.286145, 7.65, -14.672277, -15.410659, 0.055037767,
+    0.29315734, -13.614294, -0.0620612, 0.027781678, 7.73, -13.614294, -0.12245436, 0.013036499,
+    -13.937053, -0.33823586, -0.19551055, 7.89, -11.773308, -12.062972, -0.29785118, -0.07271718,
+    -11.018427, -0.4908054, -0.26481414, 8.01, -11.018427, -0.22184621, -0.072562665, -0.37117112,
+    7.81, 7.65, 0.9323351, -10.025825, 7.69, 0.16722107, -0.107046746, 7.69,
+    0.89677393, 0.416939, -7.1555967, 8.17, -8.577097, -0.14675435, 0.15470092, 8.44,
+    -0.32336843, -0.20847814, 8.56, 8.24, 0.56480134, 0.17556983, -6.0203667, -0.07591721,
+    0.045023944, -6.5924907, 9.61, -6.8701315, 9.53, -6.961682, -7.01124, -0.15030003,
+    -0.06484009, -0.23693696, -7.20367, -7.349471, -0.037568282, -0.18804559, -6.961682, -0.08621373,
+    -0.048952255, 9.57, -6.7859416, 9.53, 0.023760015, 0.05017177, -6.740236, -0.182469,
+    -0.020809704, -6.7036514, -6.8298554, -0.0437854, 0.007706411, 0.2255991, -7.1032915, 9.77,
+    -7.3014965, -7.722872, -0.008661906, -0.10245899, 9.69, -0.05214382, 0.03967851, -7.349471,
+    -7.9547505, -0.07962607, 0.03559944, 9.8, 0.14658706, 0.28304705, 9.69, -6.8701315,
+    -7.01124, -0.01245902, 0.06664014, -6.740236, 0.16633682, 0.40170318, -6.961682, 9.73,
+    0.14966002, 0.39240113, 0.41698763, -6.4524984, 9.53, -6.511228, -6.5553975, 0.171632,
+    0.037244797, -6.4785495, -0.22113891, 0.083905794, -6.511228, 9.57, -6.5553975, 0.05101948,
+    0.2184705, 0.38176614, 0.3800951, 0.40464312, 1.3, -19.22157, 0.91, -19.76686,
+    0.87, -20.981464, 0.67, -0.0051227934, 0.8421566, 0.71, -0.46686155, 0.010577551,
+    -20.28955, 0.013331222, -19.982029, 0.8252098, 0.33699116, -19.428238, 0.87, -19.539429,
+    -0.16928075, -0.26506004, -19.539429, -0.4838972, -0.16859055, -19.330385, 0.87, -0.14073944,
+    -0.020970853, -0.2519889, -22.377066, -25.69593, 0.8214356, 1.26, 0.49909034, -22.656353,
+    0.37229523, 0.14959513, 1.14, -20.402336, 0.99, 0.011849976, 0.48814034, 1.06,
+    0.23651712, -0.082211375, -20.652575, -21.325644, 0.18843594, -0.012531424, -19.668941, -0.38779745,
+    0.09722379, 1.22, -18.977423, 0.95, -19.09326, 0.91, -0.24855347, -0.06836174,
+    -0.48769054, -19.09326, 0.99, 0.12750106, -0.23195525, 0.99, -0.21286774, 0.03607352,
+    -18.7905, 1.06, 0.99, -0.13942383, -0.31429186, 1.18, -0.0075820335, -0.32551575,
+    1.14, -0.42483345, -0.15106302, 1.26, -19.09326, -0.068647765, -0.37666425, -0.56461084,
+    1.46, -27.161629, 1.38, -29.518152, 0.6511283, 1.34, 0.34299573, -28.209562,
+    0.16988526, -0.05418803, -28.786161, -51.15694, 1.42, 0.09629314, -0.058200072, -33.599087,
+    0.3158962, 0.17262669, -27.639406, -28.209562, -0.16651689, -0.57337254, 1.42, -0.5706411,
+    1.489858, -20.652575, 1.38, 1.34, -21.12554, 0.1449042, -0.09885237, -23.178364,
+    -0.054218717, -0.23367651, -24.11707, -26.084858, -0.8894699, -0.025569603, 1.42, -0.4359428,
+    -0.8872706, -19.876776, -20.402336, 1.34, -0.1154253, -0.6863688, -0.92443436, -0.42583305,
+    -22.656353, 1.85, -26.084858, 1.54, -32.61234, 0.2128171, -0.002013482, -27.639406,
+    -0.25651667, 0.04834523, 1.58, -25.265562, -1.4458565, -0.30210313, 1.69, 0.4471706,
+    -0.28157344, 7.03, -27.161629, 6.95, 0.42367458, 0.12984617, 6.99, -0.18406369,
+    0.73272413, -27.161629, 7.14, -0.31189916, -0.1160435, 7.1, 0.45783114, -0.055889186,
+    1.58, -18.367512, -21.325644, -22.12889, 0.5895147, -0.11667557, 1.5, 2.2762406,
+    0.9272291, -16.605732, -17.44737, 0.042227175, -0.07115326, -15.410659, 0.40695474, 0.09663391,
+    1.97, -4.524055, -21.69312, -0.39643034, 0.02899389, 1.88, 0.3699936, 0.18798316,
+    -14.294952, 6.68, 0.5309921, -0.046171725, -11.773308, -0.09664229, -0.0023183662, 7.1,
+    6.91, -14.672277, 4.57, 1.77, 1.34, -20.402336, 0.04377188, -0.047250863,
+    -20.28955, -0.09236624, 0.1172115, 4.49, -18.7905, -0.40681624, -0.109452486, -19.22157,
+    1.0894241, -1.1357653, 6.64, -18.367512, 1.0670942, -16.183819, 0.51562613, 0.33009544,
+    -30.874868, -36.19027, 0.66148895, 0.37280273, 6.76, 0.254923, 0.004258972, 6.53,
+    -10.396682, 4.49, 1.93, 0.092313886, -0.66246825, 6.49, 0.8572842, -0.22823952,
+    6.34, -8.113236, 0.2603822, -0.0019279044, 6.45, -0.40195137, -0.1995059, -13.286145,
+    6.64, 6.57, -0.0011854172, 0.109748684, 6.72, -0.16850851, -0.36109456, -11.773308,
+    -12.655651, -0.4255479, -0.8542587, -10.59073, -0.03290321, -0.6120207, -20.089907, 6.99,
+    -25.265562, -26.572838, -37.815678, 0.11931727, 0.30339265, 6.95, -0.66343194, 0.12348074,
+    -20.981464, 6.95, -0.8902425, -1.4240164, -0.28186443, -26.084858, 7.03, -32.61234,
+    -0.31795537, 0.15688959, -37.815678, -0.03580561, -0.3785163, -22.377066, -24.11707, 0.41287848,
+    1.4954735, 7.03, -1.1084534, 0.38846558, 7.06, -15.789676, 6.99, -17.897657,
+    -0.37933743, -0.2425528, -18.7905, -0.87149346, -0.5214471, -0.71346617, -17.897657, -1.7874993,
+    -0.81717014, 7.42, -16.605732, 7.26, -20.089907, -20.188913, -22.377066, -0.07607179,
+    0.1818169, -2.1037927, -19.668941, 7.18, 1.3887883, 0.38166103, -19.539429, -2.1795783,
+    0.4432194, -19.668941, -30.874868, 7.3, -0.04426991, -0.31863776, 7.34, 0.08928587,
+    -0.026088947, -19.22157, -0.64679307, 7.38, -0.2644485, -0.46029162, -13.937053, 7.3,
+    -15.410659, 7.26, 0.9559336, 0.29824165, 1.0377951, -14.672277, 7.34, 0.13466617,
+    -0.040139545, 7.34, 0.6914297, 0.21474825, -13.614294, 7.38, 0.86527985, 0.29796055,
+    1.0107936, -15.410659, 7.49, -25.69593, -27.639406, -0.19510536, 7.46, 0.0007968903,
+    -0.08337784, -16.183819, -20.188913, -0.47162437, -0.75950724, -0.35307884, -20.981464, -21.931791,
+    -22.907703, 0.060946148, 0.014960735, 0.26702404, 7.53, -19.982029, -0.046502877, -0.3173789,
+    -18.7905, -0.16969082, -0.014152146, 7.53, -12.962669, -13.614294, -13.937053, -0.16959962,
+    0.008794709, 7.46, 0.29898185, 0.1411571, -12.377764, 7.49, 0.53171223, 0.2535747,
+    7.49, 1.0138762, 0.5584033, -10.59073, 7.61, -11.018427, -0.01420788, 0.5899908,
+    -11.773308, -0.13171048, -0.29895914, 7.77, 7.65, 0.6611153, 0.3034847, -9.349648,
+    -0.2150967, 0.008468977, -29.518152, 6.99, 1.81, 1.58, 0.23, -30.874868,
+    0.2, -0.019665735, 1.0476365, -0.17629066, 1.38, 1.34, 0.62477976, 0.4286799,
+    -32.61234, 0.190693, 0.039080888, -30.058292, -31.608435, 1.62, 0.028113175, -0.39067852,
+    1.66, -1.1088012, -0.10456238, 1.69, 1.66, 0.02517408, 0.35836285, -0.110832214,
+    6.95, -30.058292, 0.42827487, 6.83, 0.4219513, -0.5164347, -30.058292, -30.874868,
+    -45.980717, -0.07162171, 0.0926709, -0.46336594, 0.5049511, 7.14, 7.1, -37.815678,
+    7.06, -40.02452, -0.1709288, 0.0023871104, -45.980717, 0.1387291, 0.0112282755, -34.72578,
+    -0.35782868, -30.874868, -0.050391555, -0.3151204, -30.058292, -33.599087, -34.72578, -0.39779645,
+    0.077616885, -0.62505674, 0.25324708, 7.26, -32.61234, -36.19027, -37.815678, -0.045453392,
+    0.30530396, -34.72578, -0.31863666, -0.042730205, 7.22, 7.18, 0.24601984, 0.056834288,
+    0.3828499, 7.3, -31.608435, -34.72578, -0.17453384, 0.29731598, -0.30936185, -30.874868,
+    -33.599087, -0.18372345, -0.33946326, 7.42, 0.087393574, -0.10675087, 0.44, -24.11707,
+    -24.452414, -25.69593, -27.639406, -28.209562, -0.05624155, -0.47876343, 0.35, 0.057234015,
+    0.2320588, -25.265562, -0.39853525, 0.4, -0.07673362, -0.20920883, 0.22878785, -1.0664514,
+    0.48, -23.477354, -24.11707, -0.51252264, -23.813517, 0.508655, 0.21863785, -0.6175257,
+    0.51, -22.907703, -23.477354, -1.1413776, -23.178364, -0.032406908, 0.30310437, -1.3783561,
+    1.3, -23.178364, -24.864492, 0.61712676, 0.37308925, -20.803585, 0.09144267, -0.021244695,
+    1.46, -23.178364, -0.0158429, -0.39214632, 2.05, 0.036961637, -0.0013919467, 0.79,
+    -20.516748, 0.71, -20.803585, 0.67, -21.12554, 0.63, -0.021751344, 0.281746,
+    -0.6489553, -20.981464, 0.58247656, -0.02044376, -20.652575, -0.43591553, -0.7472088, -20.803585,
+    1.4062556, 0.75, -20.652575, 0.16690479, 0.053873744, -20.652575, 0.39758492, 1.1440905,
+    0.75, 0.71, -0.6643606, -20.28955, -20.402336, -0.27938807, -0.46270844, -20.188913,
+    -0.063776396, -0.52162594, -20.402336, 0.2609422, -19.876776, -19.982029, -20.089907, -0.17743117,
+    -0.34010744, -0.01235342, -0.6408642, 1.22, -20.188913, 1.06, -20.516748, 1.03,
+    0.83, 0.047668457, -0.019999696, -20.652575, 0.13220704, 0.61158246, 0.87, -20.402336,
+    0.29495424, 0.67364526, -20.28955, 0.27789328, 0.61298084, -20.402336, -21.50634, 1.18,
+    0.41010356, 0.28858653, 1.14, 0.35789567, 0.011531854, 1.1, -20.28955, -0.08391686,
+    -0.030148316, -0.26146713, -19.22157, 0.87, -19.982029, 0.83, -0.17338191, 0.31935087,
+    -19.876776, -0.19269857, -0.13278902, 1.06, -19.539429, 0.25790885, -0.030876298, -19.76686,
+    -0.30473712, 0.13132435, -18.977423, 1.18, 0.95, -0.16963434, -0.047909927, 0.14304338,
+    -18.7905, 1.06, -0.21752249, -0.07225544, 1.14, -0.34026226, -0.12178854, 2.33,
+    2.05, -7.9547505, 1.81, -27.161629, 0.04288612, -0.049462385, -19.539429, -0.5561148,
+    -0.16422348, -0.10486277, -6.2222686, 0.22777574, 0.09964442, 0.43239194, -1.0684927, 2.21,
+    -4.6410313, -0.43082085, -0.06994211, -1.2995658, -0.5179536, -1.7169287, -0.30146822, 2.17,
+    -0.2578278, 0.22081129, 2.13, 0.30296466, -0.12653373, 3.06, -1.7983414, 2.4,
+    -1.8541082, -0.5930771, -0.0594677, -1.960713, 0.57809585, 0.24929368, -0.5968429, 2.63,
+    0.116332114, 0.023895122, 2.44, 0.04646772, -0.067376725, -2.0137024, 4.49, -2.3197646,
+    0.38561678, 0.06773053, 4.57, -0.35866132, 0.0033393994, 3.71, -0.8777573, 0.0018637801,
+    -0.14330262, 4.41, -0.097019404, 0.021406254, 0.03, -51.15694, 0.12222177, 0.009930366,
+    0.07, -42.560875, -0.1292306, -0.06849801, -40.02452, 1.38, 0.80588526, 1.5,
+    -51.15694, 1.42, 0.06462606, -0.05985527, 1.42, 0.25150976, 0.10938503, 1.73,
+    1.69, -0.06686526, -0.48240876, 6.95, 0.2819776, -0.09372499, 0.16, 0.12,
+    -36.19027, -0.12341062, 0.24373372, -33.599087, -0.14570253, -0.1950996, -30.874868, 1.58,
+    -32.61234, 0.3327889, 0.063374035, 1.77, -0.2854842, 0.02290033, 0.71, -20.803585,
+    -0.018070055, -0.47312012, 1.22, 0.04459283, -0.0015542505, -4.750224, -6.3485193, 8.01,
+    7.1, 6.88, 4.57, 1.97, -0.0027600208, -0.17793587, 6.06, 0.38753244,
+    0.00024959064, -20.089907, 6.99, -0.11864632, 0.11154634, 7.03, -0.35079643, -0.9819283,
+    -9.50892, 7.69, -16.183819, -0.030598596, 0.17120986, -10.396682, -0.17890126, -0.0550044,
+    7.89, -8.718564, 0.31670094, 0.6400465, -8.21763, -0.061930656, 0.3629297, -7.9547505,
+    8.4, -8.018251, -8.328821, -0.26236817, -0.14125825, -0.4339758, 8.44, -8.113236,
+    0.06582337, -0.017509842, -8.018251, -0.09745624, -0.03481625, 8.24, -7.5297284, 8.05,
+    0.2001578, -0.05856493, -6.8701315, 0.26430407, 0.7349748, 9.5, -6.740236, -0.20947087,
+    -0.0031560503, -6.5924907, 0.018260015, 0.19590801, 5.75, 4.53, 2.21, -6.131815,
+    2.17, 0.16903768, -0.1798809, 1.77, 0.1485768, -0.178766, -5.1183767, -5.682901,
+    -0.67653656, -1.6538204, -0.4885771, -6.1628103, 4.57, 1.8909985, 0.75693434, 5.63,
+    -5.813874, -0.7483265, 0.540314, -5.7152433, 0.6636428, -0.01581425, 6.49, -5.682901,
+    5.83, -5.949599, 0.4398798, 0.027906096, -6.1628103, -0.44030625, -0.010543604, -4.894484,
+    -5.4127874, -0.31259766, -0.15915497, -0.4534429, 8.64, 8.48, -6.2222686, 0.4690655,
+    0.71157134, -6.0203667, 0.10855871, 0.36333176, 9.46, -5.6420994, -0.023286138, 0.15614912,
+    0.4176425, 5.36, -4.2262564, 4.57, 4.49, 2.25, 2.13, 0.05669191,
+    -0.56109774, 1.4165581, 4.53, -1.9065323, -4.524055, -1.1724961, -0.22097038, 5.24,
+    -4.4179254, 1.0732565, 4.65, 0.44472834, 0.7941225, -4.4179254, 0.69493383, 5.28,
+    0.36629456, 0.1249721, 5.2, -3.2776601, 4.61, 4.49, 0.09606882, -0.69093084,
+    -3.9679167, 0.519088, 0.2029964, 4.53, -2.2551181, 0.15277566, 0.0009486514, 4.61,
+    -0.7191825, -0.07347053, -3.4696734, -3.9679167, -4.0418863, 0.008686066, -0.22487247, -3.5361924,
+    -0.502976, -0.33112764, -2.8076367, 5.24, -0.06960369, 0.1323434, -2.6292815, -0.16073623,
+    -0.36734086, 5.79, -3.593756, -4.524055, 5.48, -4.6410313, 0.32059297, 0.074658535,
+    5.63, -0.24544612, -0.12745206, 5.63, 5.48, -0.29548115, -0.45615116, -4.2262564,
+    -0.3770443, -0.15852027, -2.8076367, -3.1480272, 5.48, -0.22554179, -0.10002845, -2.9810855,
+    0.14888112, -0.050018605, -0.41218325, -4.2262564, 5.99, -4.524055, -4.6410313, -0.100765996,
+    -0.048667908, 5.83, -0.24600251, -0.14195113, 6.1, -4.524055, -0.2110282, -0.36297902,
+    -0.060082056, 5.83, -3.7527802, -3.9679167, -0.01917511, 0.09577573, -3.593756, -0.07964458,
+    0.048482895, -4.0418863, 5.95, 0.07937829, 0.009983699, 0.1788651, 9.88, 8.56,
+    7.1, 6.88, -14.294952, 4.57, 1.34, 0.008205932, -0.05435371, 6.64,
+    0.43787962, 0.1063051, 6.53, -9.193894, 0.15549052, -0.0050440426, -9.684118, -0.2900682,
+    -0.6918966, -20.089907, 6.99, -26.084858, 0.16860788, -0.6453706, -26.084858, -0.16432108,
+    0.41638634, 7.06, 6.95, -0.1971497, -0.43027496, -18.977423, -1.5630245, -0.6215354,
+    -6.7036514, 8.24, -7.722872, 7.97, 0.04207275, -0.15282981, 8.13, 0.38803482,
+    0.11460227, -7.2534256, 8.4, -0.29620668, -0.12656294, 8.32, 0.05427518, -0.115384005,
+    8.36, -6.511228, 8.28, 0.6158655, 0.32456642, 0.72566456, -6.3485193, -6.4785495,
+    -0.039593846, 0.13034801, 8.48, 0.45437452, 0.18511014, -5.842078, 9.27, -6.8701315,
+    8.64, 8.6, -0.14214168, -0.24129906, -6.961682, -0.5293864, -0.18304704, -6.2222686,
+    -6.286212, -0.048140757, 0.1865012, 8.64, 0.13756733, -0.13950492, -6.1923833, 9.42,
+    -6.5924907, 0.069125466, -0.1695409, -6.4524984, -0.008510674, 0.16202903, 9.34, -5.949599,
+    -0.16173278, 0.22432745, -6.0905485, 0.11866778, 0.43492088, 8.83, 8.72, 8.68,
+    0.44067383, 0.29733542, -5.750133, -5.784454, 0.18712436, -0.12738901, -5.6420994, 0.22746146,
+    0.37096503, 9.14, -5.5945034, 8.87, 0.039755467, -0.13125823, 8.91, 0.29005677,
+    0.13025482, 9.23, -5.7152433, 0.10352244, 0.2718334, -5.784454, 0.40088043, 0.18788122,
+    -7.5758924, -8.018251, 9.96, 9.92, -0.06955719, -0.17844887, -8.113236, -0.11292394,
+    0.003160324, 9.96, -7.7751694, 9.92, -7.832062, -0.027575327, -0.088042535, -7.832062,
+    -0.011259583, 0.12579834, 9.92, -7.722872, 0.22688721, -0.035899136, -7.722872, -0.22790883,
+    0.011426206, -7.667374, -7.832062, -7.8932815, 0.014301466, 0.16506892, -7.7751694, -0.09280955,
+    0.022965929, 0.15411164, -7.444791, 9.92, -7.485508, -7.5297284, 0.017488316, 0.15867463,
+    0.008764213, -7.485508, 9.96, 0.05407824, 0.20329654, 0.2786145, 0.23056462, 0.03,
+    -51.15694, 0.09718912, 0.007075337, 0.07, -42.560875, -45.980717, -0.08047261, -0.1166118,
+    -0.056487896, -40.02452, 1.38, 0.65789086, 1.5, -51.15694, 1.42, 0.06362407,
+    -0.042310335, 1.42, 0.21818455, 0.099677935, 1.73, 1.69, -0.042778168, -0.3960849,
+    6.95, 0.21816316, -0.07442822, 0.16, 0.12, -36.19027, -0.10023879, 0.19745816,
+    -33.599087, -34.72578, -0.13537167, -0.099893026, -0.15897478, -30.874868, 6.99, 1.42,
+    0.20932281, 0.055481624, -32.61234, -0.1516959, 0.013177708, 0.44, -24.11707, -0.034614515,
+    -0.8903186, 0.48, 0.150752, -0.0002636134, -0.07408267, 6.14, 4.69, 4.49,
+    4.33, 4.06, -2.4040701, -0.011749947, 0.021517618, -2.4040701, 1.0677816, -0.11101772,
+    -2.0137024, -11.018427, -0.93375295, 0.35565862, -0.771789, 0.014123186, -0.3986644, -11.515594,
+    -13.286145, -19.22157, 1.0398972, -0.68838805, -12.062972, 1.7171175, 0.27630463, -10.19933,
+    -10.59073, -0.0067413333, -1.0610836, -9.193894, 0.92765886, -0.14728884, -6.961682, 6.02,
+    5.95, 0.9653103, -7.3987164, 0.86830276, 0.24552684, -8.018251, -8.21763, 0.94853926,
+    0.45375833, -7.5297284, 0.19856083, -0.17171407, 4.93, -2.907736, -3.6424093, 0.54105383,
+    0.26444635, -2.2326505, -0.0062700906, -0.21094513, -4.894484, 5.72, 0.41442728, -0.05048455,
+    5.44, -0.017855322, -0.17588602, 7.06, -8.328821, 6.3, -9.193894, 6.22,
+    1.1750507, 0.68469656, 6.18, 0.63507986, 0.03107506, -10.19933, 6.49, 0.60517335,
+    -0.016936664, -8.718564, -0.38493398, -0.006342602, -7.3014965, -8.018251, 6.22, -0.09540695,
+    -0.3459071, 6.49, -0.4615948, 0.13588753, 6.3, -6.389413, -0.36716223, -0.20229807,
+    -6.7036514, -0.0138979135, -0.21017142, 7.38, -16.605732, 7.22, -21.325644, -0.022024527,
+    0.29309618, -19.876776, -0.0113061955, -0.16384561, -13.937053, 7.3, 0.5538092, 0.16281319,
+    0.83386534, -13.937053, 7.49, 7.42, -0.15811186, -0.38806802, 7.57, -0.14328149,
+    -0.014166686, 7.53, -12.962669, 0.1633928, 0.52464074, -11.018427, -0.14845058, 0.00655083,
+    2.09, 0.3292682, 2.13, -0.058459997, 0.15675126, -0.04324875, 2.63, 2.25,
+    2.21, -0.058459997, -0.18144888, -0.06714885, -0.2269694, 2.29, -0.058459997, -0.026796177,
+    0.026553346, 2.33, -0.1980545, -0.057430804, -0.1835122, -1.3340919, 2.44, 2.17,
+    -4.2262564, 2.09, 1.81, -15.789676, -0.0023547679, 0.07799353, -8.453863, -0.19065607,
+    0.0682674, -6.910217, -0.58002985, 2.13, -0.13833362, -0.28567657, 1.97, 1.85,
+    -3.593756, 0.103404574, 0.42609626, -2.1466296, 0.11830711, 0.2517413, -2.9810855, 2.05,
+    0.29899675, 0.059253465, -1.6592834, -0.041997842, 0.16935246, -2.9810855, 2.25, -5.1183767,
+    -0.28222695, -0.61976916, -0.9540066, 2.29, -2.4040701, -0.24067624, -2.0923567, -0.0036664691,
+    0.16699034, -1.4832442, -1.98534, -0.5508475, -0.13220638, -1.362035, -1.1587648, -0.14323501,
+    2.98, -1.8803589, -1.9079165, 0.5309126, 2.9, 0.4014605, 0.0629036, 2.59,
+    2.52, 0.52720326, -1.5112904, 0.4139845, 0.17597778, -1.7429106, 2.82, 0.38921067,
+    0.05592816, 2.71, 0.14159302, 0.016852004, -1.9079165, 4.45, -2.4040701, 4.21,
+    0.8779541, 1.8286552, 4.41, 0.04605983, 0.48622894, -2.6292815, 4.57, -0.21543653,
+    0.007109379, -1.98534, -0.1551337, -0.7774694, 4.45, 3.71, 3.48, -0.02668544,
+    0.06928643, -1.6287112, -0.10993624, -0.04311418, -1.6287112, -1.7678375, 0.29219696, 1.1052941,
+    -1.362035, -0.377096, 0.40343934, 2.48, -0.7202588, 2.29, 2.13, 1.93,
+    1.88, 0.30772933, 0.10032654, -0.9247528, -0.022049151, -0.22783946, -0.9800166, 2.21,
+    -0.4089481, -1.4095762, 2.25, -0.9388588, 0.58117026, 2.37, -1.114961, -1.2343782,
+    -1.6742188, -0.2885663, -0.9800166, 1.5724801, 0.30486032, -1.114961, -1.1948682, 0.6035885,
+    0.085614294, -0.9247528, -0.10185852, -0.48845646, -0.6559018, 2.17, -0.4050827, 2.29,
+    0.537085, 0.900242, 2.21, -0.54071695, 2.17, -0.37624398, 0.16427003, 2.13,
+    0.120181635, 0.21377133, 2.37, 2.29, -0.028307486, -0.15545128, -0.5968429, 0.81260437,
+    0.018933808, 4.49, -0.7202588, 2.52, -1.114961, -1.2995658, 0.03835551, 0.13984703,
+    0.52604944, 3.36, -1.2630312, -0.07363496, 0.008657133, 4.45, -0.07604011, 0.21323843,
+    2.52, -0.48152414, -0.6559018, -1.4021637, -0.6234624, -0.4176023, 0.7203461, -0.111509874,
+    3.17, -0.48152414, 0.036325194, -0.07040509, -0.4176023, -0.32432562, 0.2480704, -0.6559018,
+    -0.771789, -0.82226276, -0.9247528, 0.1231369, -0.2768631, 0.19079399, -0.1635048, -0.48152414,
+    0.60846925, -0.006139374, -26.084858, -27.639406, -28.209562, 7.03, 1.81, 1.54,
+    0.27, -0.002519625, 0.17006737, -33.599087, -0.09498612, -0.19190118, 6.95, -30.058292,
+    0.2931214, 0.002424739, -30.058292, -0.046644323, 0.3475903, -28.786161, 7.14, -33.599087,
+    -0.089239225, -0.30197176, 7.18, 0.14379966, -0.07545712, 7.1, -0.68462336, 7.14,
+    0.2535782, -0.39639065, 7.06, 6.99, 6.95, 0.31, -0.37088647, -0.11060911,
+    1.0153893, -1.0125104, 7.22, 0.55202484, 7.3, -0.5606453, 7.34, 0.23555553,
+    -0.0024707795, -27.161629, 7.06, 6.99, 6.83, 1.42, 0.09724426, 0.8667043,
+    6.95, -0.50615174, 0.28718567, 1.0415324, 7.1, -0.94682735, 7.14, 0.4802452,
+    7.18, -0.41858006, 0.2751587, 0.31, -1.5257744, 1.3, 0.35, -26.572838,
+    0.3350088, 0.082871765, 0.4, 1.236013, 0.40653563, 1.62, 1.54, 0.008114014,
+    -0.7802569, 1.69, 0.7380912, 0.023744619, 0.35, -0.9439444, -24.452414, 1.58,
+    1.5, 1.42, 1.38, -0.07199826, -0.6655439, -24.864492, -0.07366351, 1.5616219,
+    -25.265562, -1.2720625, -24.864492, -0.090415955, -1.050416, 1.69, -25.69593, -0.3602173,
+    1.62, 0.90794486, 0.33242977, 7.06, 6.99, -0.09635391, 0.6214305, -25.265562,
+    0.07054796, -0.26396117, -23.813517, 1.5, 1.46, 1.42, 0.19736968, -0.46060854,
+    0.7911609, 1.54, -1.0073141, 6.99, -0.12728505, 0.12867044, 0.59, -21.931791,
+    -22.377066, -0.104130045, 0.09938681, -0.35997963, -20.981464, 1.34, 0.13369624, -0.041332662,
+    0.71, -0.2751929, -0.00044408898, 6.1, 4.69, 4.49, 4.36, 4.06,
+    -2.4040701, 2.17, -0.002556837, -0.535989, -2.173437, 0.14007948, 0.0053332993, -2.357731,
+    -2.4040701, 0.7219523, 0.19927841, -2.2551181, 0.05044457, -0.107628815, -3.0695794, -5.004444,
+    -8.577097, 0.57497835, -0.9609348, 1.9327185, -2.4040701, -0.94872683, -2.1208782, 0.3615083,
+    0.017509677, -4.32814, 4.57, -11.515594, -13.286145, -0.3037463, 1.2007765, -10.19933,
+    -0.73302346, -0.028721783, -5.878716, -0.50194705, -4.750224, 0.28048503, 0.82501376, -4.127986,
+    -4.2262564, 4.57, -0.952919, 0.35843873, -1.6251982, -3.8215072, 4.57, -1.6581265,
+    0.3632175, -2.8076367, -0.29047987, 0.02696966, -7.01124, 5.99, -7.3014965, 0.8644399,
+    5.95, 0.7085442, -7.054926, 0.26964507, 0.020593261, -7.722872, -8.018251, 0.8115451,
+    6.06, 0.62552875, 0.16771866, 6.06, -7.3014965, 0.25215906, -0.015782472, -7.5758924,
+    -0.007292175, -0.20875816, 4.93, -3.2152596, -3.6424093, 4.73, 0.22215119, 0.47156736,
+    4.85, 0.29802075, 0.19832906, -2.29015, 4.89, 0.07764059, -0.046155095, -2.196643,
+    -0.04879483, -0.16772062, -3.8950949, 5.44, -4.6410313, 0.74451685, 0.20183432, -5.004444,
+    0.083567284, -0.14962491, -3.593756, 5.08, 0.1292153, -0.29950386, -2.907736, -0.011985679,
+    -0.16845317, -16.183819, 6.76, -18.7905, 6.68, 0.8277262, -21.50634, 0.5932109,
+    6.72, 0.36821026, 0.09902148, 6.64, 6.53, -18.367512, 0.35656434, 0.05725937,
+    -16.991007, 0.48989287, 0.27349997, 6.72, -16.991007, -0.04190623, -0.237352, 0.14171211,
+    7.34, 6.83, -24.864492, -25.69593, 0.4579899, 0.21940981, -20.981464, -0.025805179,
+    0.08674819, 7.1, -22.377066, 0.02827985, -0.18264377, -19.539429, -0.009634028, 0.18718706,
+    -20.089907, 7.49, 7.42, -0.024022657, -0.24420802, -20.981464, 0.16718684, 0.036247827,
+    7.53, -18.367512, -0.5572161, -0.2387598, -18.7905, -0.16805458, -0.006407797, 7.1,
+    6.53, -8.453863, 6.3, -9.349648, 0.7072307, 0.3300242, -10.59073, 0.35990673,
+    -0.19151895, -6.1628103, -8.018251, -0.15639693, -0.273693, -5.784454, -0.04810625, -0.16658905,
+    -13.286145, 6.72, -14.995561, 0.22115739, -0.028204057, 6.95, -0.21260051, -0.45269084,
+    -11.773308, -12.655651, -0.31802496, -0.62662834, -11.26825, 0.20822774, -0.28682816, 7.49,
+    -13.614294, 7.34, 7.3, 0.563167, 0.23290797, -14.672277, -0.15554492, 0.11003349,
+    7.42, 0.68423456, -12.655651, 0.15497278, 0.61997455, -10.59073, 7.61, -12.062972,
+    -0.04829354, 0.22123554, -11.26825, -0.09611528, -0.24735406, 7.93, -8.453863, 0.11923361,
+    0.5497939, -7.9547505, -0.12343407, 0.0076559144, -1.1551399, 5.24, 4.69, 4.49,
+    4.41, 3.98, 2.44, -0.0066689486, 0.038478144, -2.357731, 0.25891387, -0.05331483,
+    -3.0695794, -5.004444, -0.2389766, 1.6013952, -2.2326505, -0.5956681, 0.13634773, -4.32814,
+    -5.1183767, -5.4127874, 0.060943015, -1.3154718, 4.53, -1.6761597, 0.46558586, 4.57,
+    -2.907736, -1.608126, 0.35198075, -3.2152596, 0.044686493, -0.19730149, -4.0418863, 5.2,
+    -4.127986, 0.7047541, 5.12, 0.5535717, 0.3070011, -4.2262564, 0.5369127, -4.127986,
+    0.13341431, 0.028118897, -2.907736, 5.04, -3.6424093, 0.32693446, 0.12630421, -3.9679167,
+    0.20324798, -0.06205749, 4.93, -2.196643, 0.0005582741, -0.1352946, -2.5247674, -0.06761927,
+    -0.18710005, -4.4179254, 5.52, -4.750224, -5.004444, 0.81790286, 5.48, 0.658371,
+    0.22728883, 5.36, 0.5089529, -4.524055, 0.06281128, -0.15077199, -5.1183767, 5.67,
+    -5.254704, 0.59794074, 0.0992285, 5.87, 0.14388739, -0.0027432384, -4.524055, -4.750224,
+    -0.17818525, -0.059723664, 5.79, -0.29267308, -0.15793228, -3.4696734, 5.63, -3.8215072,
+    5.36, -0.06786654, -0.23301828, 5.4, -0.4367323, -0.29015353, -4.2262564, -4.32814,
+    -0.10288315, -0.23685518, 5.79, -0.017868383, 0.14699903, -2.8076367, 5.32, -3.2152596,
+    0.09986391, 0.21893232, -3.1480272, -0.09006313, 0.070784144, 5.32, -2.6292815, -0.109212115,
+    -0.2239753, 5.44, -0.33213797, -0.113978066, 3.32, 2.4, -1.0684927, 2.01,
+    1.88, 0.27646714, 1.97, -0.035087075, 0.17491607, 2.33, 2.21, -0.2271347,
+    -1.406022, -1.114961, 0.24667053, -0.3083248, -0.9800166, 2.29, 2.17, 0.005228424,
+    -1.2754952, 1.1372793, -0.82226276, -0.8777573, 0.022917302, -0.435781, -0.771789, 0.39885047,
+    0.029263338, -0.5968429, 2.44, -0.7202588, -1.0267481, 0.13475865, -0.49974522, 0.5730113,
+    -0.7202588, 2.48, -0.14324689, 0.028715376, 2.48, 0.48974487, -0.05377501, 2.94,
+    2.44, -0.24307282, -0.05765145, 0.13010688, 2.55, -0.08079919, -0.019456113, -0.4176023,
+    3.06, 0.05225423, -0.16894452, -0.2489125, 4.49, -0.771789, 3.56, -0.8777573,
+    -0.9247528, 0.056216843, -0.051548976, 3.44, -0.14995144, -0.2665103, -0.8777573, 4.45,
+    -0.16147903, -0.6755356, 1.0493805, -0.4176023, -0.54071695, -0.23659527, -0.48152414, -1.5039619,
+    -0.3782659, -0.3603938, 0.6235542, -0.42364374, -0.6559018, -0.771789, -0.82226276, -0.9247528,
+    0.10817032, -0.25182953, 0.1581955, -0.14980698, -0.48152414, 0.50687015, -0.00817833, -19.22157,
+    7.34, 1.88, 1.34, 0.91, -19.76686, 0.87, -0.0047609913, 0.377736,
+    0.87, -0.12828363, -0.24808331, -22.656353, -27.639406, 0.4981343, 0.280286, 1.22,
+    0.10694734, -0.16756493, -20.28955, -26.084858, 1.5, 0.08382988, -0.08333694, 1.54,
+    -0.22271255, 0.029936964, 1.42, -19.76686, -0.7904671, -0.21324311, 1.54, 1.4304742,
+    0.16719818, 6.76, 6.68, 0.71718657, -21.50634, 0.48249933, -21.12554, -0.0920934,
+    0.23007493, -19.539429, -19.668941, -19.876776, 0.0067754635, 0.38415155, 7.18, -1.6531401,
+    -0.041479494, 7.1, 6.95, 0.13234809, -0.7101288, 7.18, 2.2900274, -0.039958064,
+    -19.982029, 7.49, 7.46, -24.452414, -30.874868, -0.12295746, 0.08139098, -22.12889,
+    -0.17471093, -0.04955395, -25.69593, -0.020464325, -0.3144724, -20.981464, -21.931791, -22.907703,
+    0.05301361, 0.013159688, 0.2271883, 7.53, -20.652575, 0.021210862, -0.008979289, 0.057891082,
+    7.53, -0.5047974, 7.57, -0.17667288, -0.0106250765, -19.09326, 6.91, 1.3,
+    0.99, 0.95, 0.91, -0.18712921, -0.017363392, 0.12075528, 1.06, -0.5200639,
+    1.26, -0.041616917, -0.47091624, 1.62, 0.29758188, 6.83, -0.050860852, 6.88,
+    0.21963616, 0.030051803, 7.18, -2.9412925, 7.26, 7.22, 0.15039673, -0.0321401,
+    -0.36688766, 1.26, -18.977423, 0.99, 0.95, -0.3827179, -0.162323, 1.1,
+    1.03, 0.039429855, 0.18570842, 1.22, -0.11786921, -0.30802917, -18.7905, 1.06,
+    0.99, -0.07551392, -0.20826605, 1.18, 0.015001914, -0.25507388, 1.14, -0.28638938,
+    -0.10901743, -18.977423, 7.1, 6.95, 1.62, -0.033924356, 0.18253988, -0.8335846,
+    7.18, 1.7799176, 7.3, -0.07799225, -0.428907, 2.01, -7.1032915, -11.773308,
+    0.047313713, -0.066199705, -6.2222686, 0.28930977, 0.07526362, 2.33, -2.1466296, -0.17966259,
+    0.0003062167, 3.32, 0.017984563, -0.004216325, -1.5112904, 6.37, 2.4, 2.13,
+    -4.4179254, 1.73, -15.789676, 0.0011081883, 0.09853742, -8.453863, -0.10982801, 0.027465587,
+    -3.0695794, -3.593756, 0.115174584, 0.32910967, 1.85, 0.2847432, 0.020348297, -2.4040701,
+    2.25, -3.593756, -0.31404802, -0.11600876, -2.9810855, -0.66057265, -0.3342772, 2.29,
+    -1.9079165, 0.07552331, 0.18100406, 2.33, -0.09748437, -0.31967667, -8.577097, -16.183819,
+    -17.897657, 4.53, 0.020939637, 0.91005784, -1.2329617, -14.294952, 1.5312027, -13.286145,
+    -1.2305502, 0.32542136, 6.1, -7.3014965, 4.53, -0.085793816, 0.42034855, 5.95,
+    0.01337754, -0.13051216, -8.328821, 6.18, 0.24855971, -0.09349661, -5.4127874, -0.18673019,
+    -0.004011457, 6.45, -10.792877, -11.26825, 1.2690187, 0.3686103, -7.7751694, -10.59073,
+    -0.17755765, 6.41, -0.33409473, -0.5565285, -6.4785495, -7.5297284, -0.22775288, -0.031855047,
+    -5.987348, -0.3026425, -0.013353221, -6.740236, 8.09, -8.328821, -14.995561, 0.020204239,
+    -0.027076188, 6.53, -0.17727454, 0.20255242, 9.61, -7.2534256, -0.15727875, -0.03923022,
+    -7.2534256, -0.0019109047, 0.07162661, 8.44, 6.49, -6.4785495, -0.057155352, -0.16112442,
+    8.36, 0.4246485, 0.19163178, 8.68, -6.2222686, -0.035691418, 0.16156241, -5.7152433,
+    -0.022510527, 0.072803065, 2.98, -1.2630312, 2.44, 2.25, -1.4832442, 1.97,
+    0.10757243, 0.32055104, -1.2995658, -0.07973932, 0.08852717, -1.362035, 2.33, -0.09967753,
+    -1.0937685, -1.3340919, -0.12418061, 0.367393, 2.52, 2.48, 0.48977032, -1.362035,
+    0.28761685, 0.08274353, 2.9, 2.86, 0.055149257, -0.10279967, -1.362035, 0.17119232,
+    0.09564438, 2.4, -0.7202588, 2.29, 2.13, -0.042543635, -0.45091316, 2.33,
+    0.51369435, 0.035706133, -0.6559018, 2.17, -0.34830973, 0.6261623, 2.21, 0.090543054,
+    -0.050370242, -1.2343782, 2.44, -0.68094677, 2.74, -0.0320385, 0.07110618, -1.0684927,
+    2.48, 0.36706924, -0.00491034, -0.9247528, -0.093797885, -0.01503633, -0.3603938, -1.4832442,
+    3.36, 3.32, 3.06, -0.0016096116, -0.08273087, 0.03237305, 4.02, -0.22183566,
+    4.41, -0.01908842, -0.16369109, -0.4176023, -0.54071695, 4.45, -0.02859938, 0.09961958,
+    4.49, -0.23504809, 0.2020916, 3.1, 3.02, -0.0034123738, -0.21357167, 0.5306534,
+    -0.29911253, 9.88, 8.56, 7.1, 6.91, -14.995561, 6.53, 1.77,
+    0.0012155798, -0.11555207, 6.64, 0.38290724, 0.07875433, 6.53, -11.018427, 0.15815695,
+    -0.0020540268, -12.962669, -0.09767046, -0.25725782, -20.089907, -20.402336, -22.377066, 0.017811386,
+    -0.28475258, 7.06, -0.82169914, 2.4195595, 7.06, -14.995561, -0.18197767, -0.40457463,
+    -18.977423, -1.2718714, -0.5444717, -6.4785495, 8.32, -7.01124, 8.09, 0.026927818,
+    -0.073395535, 8.24, 0.41214752, 0.20953882, 8.48, -6.653369, -0.1913925, 0.0212661,
+    8.52, 0.11195236, -0.0490273, 8.4, -6.417596, 8.32, 0.49295044, 0.15249568,
+    0.4806541, -6.2222686, 8.44, 0.12889244, 0.0072562057, 8.48, 0.45128962, 0.1762988,
+    -5.842078, 9.27, -6.8701315, 8.64, 8.6, -0.1061118, -0.18499063, -6.961682,
+    -0.42579347, -0.14479898, -6.131815, 8.6, -0.19003819, -0.0012114483, -6.0520425, -0.2858997,
+    -0.048728082, -6.286212, 9.5, 9.3, 0.056423623, -0.09324472, -6.910217, -0.019498339,
+    0.081681125, 9.42, -6.131815, -0.057548832, 0.12767272, -6.2553506, 0.19332467, 0.3948069,
+    8.83, 8.72, -5.784454, 0.3418922, -5.7152433, 0.17670123, 0.30608705, -5.750133,
+    -5.784454, 0.1547133, -0.102409236, -5.6420994, 0.17168818, 0.28780046, 9.14, -5.6420994,
+    8.87, 0.036111165, -0.13689785, -5.5945034, -0.0015675726, 0.11783148, 9.23, -5.813874,
+    -0.045227304, 0.14872275, -5.784454, 0.3285087, 0.1580452, -7.5758924, 9.96, -8.018251,
+    9.92, -0.04122105, -0.13377972, -7.8932815, 9.92, -7.9547505, 0.012487284, -0.06008301,
+    -7.9547505, 0.007596817, 0.06674669, -7.832062, 9.92, 0.009691238, -0.09056492, -7.617456,
+    -0.0087767495, 0.014145006, -7.667374, -8.113236, -0.07421176, -7.832062, -7.8932815, 0.02405336,
+    0.13475844, -7.7751694, -0.08200073, 0.016372604, 0.12315338, -7.444791, 9.92, -7.485508,
+    -7.5297284, 0.012479073, 0.1331131, 0.0052498956, -7.485508, 9.96, 0.041856166, 0.163363,
+    0.23215821, 0.18614261, 0.03, -51.15694, 0.08367761, 0.011013576, 0.07, -42.560875,
+    -45.980717, -0.059866734, -0.088567875, -0.040341187, -40.02452, 1.38, -51.15694, 0.1563179,
+    0.5464734, 6.99, 1.73, 1.69, 0.018363992, -0.30082002, 6.91, 0.20739578,
+    -0.0056786537, 7.03, -45.980717, 0.021589153, -0.26587448, 7.1, 0.027423305, -0.086014666,
+    0.16, 0.12, -36.19027, -37.815678, -0.06469955, -0.08695029, 0.16604011, -33.599087,
+    -34.72578, -0.10412858, -0.07520769, -0.123307005, -30.874868, 1.42, 0.2, -0.011043965,
+    0.4990216, 6.99, 0.031657945, -0.07424379, -30.058292, 7.14, -0.14152813, 0.16255103,
+    -29.518152, 0.13430099, -0.0006616797, -0.10486277, 9.8, 8.56, 7.06, 6.91,
+    6.37, 4.65, -0.0020537989, 0.0159694, -16.183819, 0.13102621, -0.10777713, -21.325644,
+    -21.50634, -0.009632903, 1.0925907, 7.03, -0.19316006, -0.687967, -6.7036514, 8.24,
+    -7.8932815, 0.0036097907, 0.15906352, 8.48, -0.11413085, 0.037782177, 8.4, -6.618714,
+    0.105786934, 0.32207024, -6.2222686, -0.005088221, 0.2166413, -5.9075212, 8.76, -6.5553975,
+    8.68, -0.14405428, -0.35019204, 8.72, 0.00027155914, -0.15923554, -6.2222686, -6.2553506,
+    -0.008908539, 0.24834104, 9.34, -0.10379591, 0.13416453, 8.8, 8.68, 8.6,
+    0.34927675, 0.20535114, -5.7152433, 0.09986593, 0.1834041, 9.18, -5.682901, -0.09806096,
+    0.04232469, 9.23, 0.080918044, 0.21102428, -7.349471, -7.7751694, 9.84, -7.832062,
+    -7.8932815, -0.15569687, -0.040919747, -0.29029188, 9.92, -7.8932815, -0.053234693, -0.010287984,
+    -8.018251, -0.034789827, 0.025146937, 9.88, -7.617456, 9.84, 0.07314638, 0.025049005,
+    -7.485508, -0.148358, 0.037495703, -7.5758924, 9.96, 0.0011287173, 0.05212003, -7.444791,
+    0.08426003, 0.15213828, 9.84, -7.3014965, 0.13160668, -7.2534256, 0.446896, 0.16184296,
+    -7.3014965, 0.14298503, 0.021931967, 2.09, 2.05, 0.25936502, -0.058459997, 0.16421945,
+    0.058665086, 2.67, 2.33, 2.17, -0.07408267, 0.10030228, 2.13, 0.013563538,
+    -0.15273787, 2.25, 2.21, -0.109519795, -0.27184156, -0.07408267, -0.1684267, -0.05753031,
+    -0.07408267, 2.48, 2.37, 0.16718261, -0.070861734, 2.52, 0.36631852, 0.0287007,
+    2.37, -0.058459997, -0.08142395, 0.08730672, 2.48, -0.06483484, -0.034432855, 2.71,
+    -0.07408267, -0.026156617, -0.14069691, -0.1923567, -1.1551399, 5.24, 4.69, 4.49,
+    4.33, 4.1, 2.44, -0.004959877, 0.024101745, -2.4040701, 0.5467963, -0.07249642,
+    -11.018427, -18.367512, 0.44245264, -1.7178673, -8.577097, 1.6517737, 0.06583851, -12.062972,
+    -13.286145, -14.294952, 0.08573177, -1.0872029, 4.53, 1.4226502, 0.45750123, 4.57,
+    -2.8076367, -0.32585126, 0.3954909, -3.7527802, 0.1920616, -0.105851606, -3.8950949, -4.127986,
+    5.2, 0.5714405, -4.32814, 0.51022166, 0.19536269, 5.08, 0.47650114, -4.0418863,
+    0.26368257, -0.008945432, 4.93, -3.2152596, 4.73, 0.10828986, 0.23051219, -2.29015,
+    0.030806735, -0.081245445, -2.5247674, -3.8215072, 0.07557923, -0.038459882, -2.29015, -0.1288229,
+    -0.19336091, -4.4179254, 5.6, -5.1183767, -5.254704, 0.7165546, 5.52, 0.6769187,
+    0.25845337, 5.48, -4.750224, 0.57879406, 0.20782922, -4.750224, 0.051619913, -0.19166075,
+    -5.5490093, 5.83, -5.987348, 0.50655144, 0.1312101, 6.02, 0.070491366, -0.001712415,
+    6.3, 5.63, 0.0043290514, -0.12120024, 0.21477225, 5.79, -3.4696734, 5.63,
+    -3.8215072, -0.14746834, -0.29745284, -3.593756, -0.09460696, 0.106456816, -2.8076367, 5.32,
+    0.14139946, -0.031202704, 5.32, -0.14455532, -0.26000977, -4.2262564, 5.83, -0.13118683,
+    5.95, -0.00405365, -0.10250789, 5.83, -3.7527802, 0.07967583, 0.0005319214, -4.0418863,
+    0.08288358, 0.18635015, 3.56, 2.4, -1.0684927, 2.01, 1.88, 0.24602509,
+    1.97, -0.03413595, 0.15462875, 2.33, 2.21, -0.14517708, -1.3163433, -1.114961,
+    0.20233154, -0.26941377, -0.9247528, 2.29, -0.9800166, -0.494026, 0.1500884, -0.9800166,
+    0.8957127, 0.08305028, -0.82226276, 2.33, -0.042096138, -0.49958012, -0.771789, 0.34218904,
+    0.017780064, -0.82226276, 2.48, -0.9800166, -1.0684927, -0.023347257, -0.47976685, -0.9247528,
+    0.64338225, -0.14547233, 2.52, -1.114961, 0.07164307, 0.41576728, 2.67, 0.072221786,
+    -0.0022129926, 3.28, -0.3603938, 2.52, -0.090962194, 0.015957804, 2.78, -0.017198281,
+    -0.13537239, 3.36, -0.13904782, -0.7202588, -0.22989643, -0.027081681, -0.82226276, 4.45,
+    -1.0684927, 3.82, 3.63, 0.051495194, -0.041358948, -0.16904896, 3.71, -0.9800166,
+    -0.028014055, -0.23977871, -0.23302133, 4.49, -0.58780116, -0.9247528, 0.08829041, -0.23570938,
+    -0.54071695, -0.771789, 4.49, 0.8973796, 0.12087174, 4.49, -0.16987725, -0.6559018,
+    -0.14388962, 0.42401633, -0.4176023, 4.49, -0.48152414, -1.329163, -0.2952937, -0.48152414,
+    0.24777119, -0.026671601, -0.3603938, 0.45176983, -0.32607853, -1.9079165, -2.4040701, -2.907736,
+    4.65, 2.09, -7.832062, 1.97, -0.00051458605, -0.27168792, -6.2222686, 0.1846402,
+    0.022897333, -11.515594, -16.183819, -0.3135709, 0.6149097, -10.396682, -1.2336802, -0.11267909,
+    4.97, -3.4047515, -3.7527802, 0.30433804, 0.161062, 4.89, 0.09599059, -0.025178293,
+    -3.8950949, 5.36, 0.18118453, 0.0004996327, -3.3498714, -0.10914669, 0.03496253, 4.53,
+    4.49, 4.21, 2.37, -0.020792821, 0.44958767, -2.7231896, 0.1532669, -0.5541855,
+    -2.8076367, -0.29282227, 1.3554798, -2.5247674, 5.28, 4.65, -0.16410065, -0.030524028,
+    -2.7231896, -0.045581713, -0.2521296, 4.61, -0.39691964, 4.65, -0.05314496, -0.15318908,
+    3.24, 2.37, 1.97, 1.85, 0.36702424, -2.1466296, -0.005240304, 0.218573,
+    2.29, 2.09, -0.1340702, 0.044932064, -2.3197646, -0.09047648, -0.33839938, -2.0137024,
+    -2.040998, 3.1, 0.48615518, 0.3341844, 3.02, 0.35285988, 0.17396323, 2.98,
+    0.40947857, 3.06, 0.07686627, -0.09699609, -2.2551181, 4.53, 4.33, 3.78,
+    0.22736493, 0.08623977, -2.357731, -0.48222008, 0.41942936, 5.04, -2.357731, 0.1048113,
+    -0.023173748, 5.08, -0.054689217, -0.14224617, 4.45, 4.33, 3.75, 0.018321127,
+    -0.07094898, 4.41, 0.13330108, 0.34567025, -1.98534, -2.068156, -0.17632385, 0.05297477,
+    4.49, -0.99344486, -0.11970621, 2.98, -1.3970085, 2.82, -1.6287112, 2.4,
+    -1.7140237, 0.015340544, 0.21899514, 2.71, 0.40337348, 0.14436866, 2.44, 2.37,
+    0.066211626, -0.9831195, 2.59, 0.27393627, -0.0013261616, -1.605014, -1.7678375, 2.9,
+    0.14336911, -0.013932801, 2.94, -0.22074988, -0.04000912, 2.9, 2.86, 0.09151802,
+    -0.06350128, 2.94, 0.1068573, 0.21349488, -0.14428757, 2.13, -0.24307282, 2.01,
+    0.017000351, -0.25058648, -0.18892978, 0.39275494, 0.034958716, 2.48, -0.7202588, -0.038856965,
+    0.089209415, 2.52, -0.09832482, 0.00605003, 2.13, -0.10486277, 2.09, 0.16564713,
+    0.5394806, 2.09, 0.1709337, 0.03780098, 2.25, -0.10486277, -0.34858495, -0.1405345,
+    2.74, -0.026299581, -0.14893575, 4.45, -1.6287112, -1.6592834, 3.1, 3.06,
+    -0.16730714, -0.2513419, 3.82, 0.013186069, -0.07983468, 4.41, 3.2, -0.36314163,
+    -0.13384369, -0.56931764, -1.5112904, 3.13, -1.5751029, 0.07366425, 0.2426687, -1.605014,
+    0.07148626, -0.01175756, 4.33, -1.4832442, -0.11618439, -0.018511314, 4.41, -0.1070145,
+    -0.18928234, -1.6287112, -1.7678375, -1.7983414, 0.96629184, -0.61685586, 0.8704735, -1.1948682,
+    -1.4536674, -1.5112904, -0.44224378, 0.9699112, -1.362035, -0.78818494, -0.23276654, -1.1551399,
+    0.8913544, -0.9800166, -0.49963075, 0.04959176, 0.03, -51.15694, 0.068745695, 0.010366059,
+    0.63, -21.325644, -21.50634, 0.59, -21.931791, -22.12889, -0.013660694, 0.16226391,
+    -0.29034564, -22.12889, 1.1918182, -21.931791, -0.45567447, 0.10894014, -0.35006008, -1.2459301,
+    1.14, -21.12554, -21.69312, 0.67, 1.0356873, 0.3541209, -21.50634, 0.67,
+    -0.45794803, 0.17183472, -21.325644, 0.37376618, 0.20927015, 0.67, -0.51762366, -20.803585,
+    0.71, 0.1894595, 0.6931059, 0.75, -0.17033969, 0.030996904, 1.46, -21.325644,
+    1.34, -23.813517, 0.31651044, 0.13554543, -25.69593, 0.056655284, -0.18227516, -19.76686,
+    -20.402336, -0.12901968, -0.4416456, -19.330385, 0.07998408, -0.1587665, -22.656353, 1.58,
+    -26.084858, 0.009722499, -0.3437888, 7.18, 0.008372578, -0.07017563, 1.58, -19.330385,
+    0.7356091, 0.21109362, -19.22157, 0.04460032, -0.0008161316, 9.84, 8.91, 7.03,
+    6.79, -9.50892, 4.53, -11.773308, 0.0017927664, -0.18229578, 6.49, 0.27077553,
+    0.016389683, 6.22, -7.5297284, 0.1890281, -0.0024457145, -7.3014965, -0.22901578, -0.060528625,
+    -27.161629, 6.83, -28.209562, 0.32705933, 0.10012614, -27.639406, 0.05733602, 0.21034408,
+    -20.981464, -23.178364, -0.06651161, -0.63551694, -15.789676, 0.021562226, -0.1894618, -6.511228,
+    8.32, -7.1032915, 8.09, 0.020318415, -0.07623293, 8.17, 0.45974442, 0.16525367,
+    8.8, 8.68, -0.08162509, -0.2016038, -6.7036514, 0.14689103, 0.043142654, 8.44,
+    8.36, 0.37939465, -6.417596, 0.011292921, 0.2692548, -5.7152433, 8.72, 0.051329155,
+    -0.0146318525, 8.83, 0.1769536, 0.06328493, 9.1, -5.5945034, -5.813874, 8.99,
+    -6.2553506, 0.05748252, -0.0135481525, -5.878716, -0.08319378, 0.07846632, 9.07, -5.750133,
+    -0.24428311, -0.1264072, -5.6420994, -0.064276695, 0.14634399, 9.03, -5.5490093, 8.99,
+    -0.062036037, 0.024692327, 0.1780086, 9.07, 0.24898045, -0.014148967, -5.813874, -7.444791,
+    9.65, -0.25203592, -7.8932815, -0.16502953, -0.063738175, 9.65, -6.286212, -0.03230909,
+    0.019314043, -7.054926, 0.025472244, 0.15686534, -5.784454, 0.3028766, -5.7152433, 9.18,
+    -0.13861044, 0.097061835, 9.18, 0.11121984, 0.23157087, -7.5297284, 9.96, -7.667374,
+    -7.722872, -8.018251, 9.92, -0.033901, -0.108090594, 9.88, -0.043326776, -0.0016844281,
+    9.88, 0.41580507, 9.92, -0.25239918, 0.11598816, 9.88, -0.2518826, -7.617456,
+    9.92, -0.064175226, -0.0046434193, 9.92, 0.03592143, -0.023758907, -7.667374, -8.113236,
+    -0.05559667, -7.722872, -7.8932815, 0.018413711, 0.050711688, -0.021018093, 0.09594562, -7.3987164,
+    9.92, -7.444791, 9.88, -7.485508, 0.013110352, 0.15839888, -7.485508, 0.100911714,
+    -0.009632655, 9.88, -0.05425347, 0.08771668, -7.485508, 9.96, 0.0141588, 0.15392952,
+    0.23031235, -7.3014965, 9.88, -7.349471, 0.35783577, 0.11949285, 0.0818689, 0.019277954,
+    -20.188913, 1.38, 0.75, -20.516748, 0.71, -20.981464, 0.67, -0.0052792053,
+    0.41548076, 0.67, -0.48131844, -0.13744633, -20.803585, 1.0568793, -20.652575, 0.16440791,
+    0.07287107, -20.28955, 0.71, -0.44969535, -20.402336, -0.19796646, -0.35185158, -0.027619425,
+    1.1, 0.79, -20.402336, -20.516748, 0.76119274, 0.20427297, -20.28955, -0.10461356,
+    -0.2768043, 0.87, -20.402336, 0.18642142, 0.5373035, -20.28955, 0.18419498, 0.3712512,
+    -20.652575, -22.12889, 1.34, 0.19865735, 0.07395345, 1.14, 0.18901621, 0.024241168,
+    1.26, -20.402336, 0.043022107, -0.17811297, -20.402336, -0.1988843, -0.34772557, 1.46,
+    -25.69593, -26.084858, -27.161629, -27.639406, 0.00030334975, 0.402666, -0.7417393, 1.42,
+    -0.4666849, 1.303476, -21.50634, 1.42, -24.452414, -0.3953537, -0.030040786, -24.452414,
+    -0.057380833, -0.44535443, -0.50479144, -21.50634, 1.85, 1.77, -22.377066, -0.060235716,
+    0.29710355, -25.265562, -0.028951416, -0.4096202, 6.83, 6.76, 0.34144917, 0.142379,
+    -21.931791, -0.014803327, -0.23469138, 1.54, -21.325644, -0.3137797, 1.5517203, 7.06,
+    6.91, 0.094565906, -0.25413722, 7.1, 0.97766155, 0.0230872, 0.83, 0.75,
+    -0.45414695, -19.668941, -19.876776, -19.982029, -20.089907, -0.119525686, -0.19892041, 0.79,
+    -0.01862259, -0.10126387, 0.79, -0.58159524, -0.14093104, -0.035213623, 1.38, 1.22,
+    -19.539429, 1.03, 0.91, 0.0011989725, 0.3219974, -19.668941, -0.20163102, 0.2926884,
+    0.95, -19.428238, -0.25293905, -0.06566406, -19.428238, 0.21172619, -0.05055284, -19.76686,
+    -0.4275809, -19.428238, 1.3, 0.036169436, -0.2161386, 1.26, -0.065131545, -0.4646875,
+    1.54, -19.330385, 0.7972809, 0.33604583, -19.76686, 7.14, 7.06, 0.08657811,
+    1.2453436, -20.089907, -0.9644661, 0.12075931, -19.539429, 6.99, 0.03467124, -0.6973551,
+    -19.330385, 0.34463534, -0.00031854206, 9.8, 8.95, 7.1, 6.64, 6.57,
+    6.37, -7.485508, 0.011337689, -0.0030415836, -11.018427, 0.16878127, -0.15792243, -12.962669,
+    -18.367512, 0.5151667, 0.17602761, -9.193894, -0.10835582, -0.42248964, -14.995561, 6.76,
+    -19.76686, 0.25724217, -0.0063758413, -22.377066, 0.023378823, -0.08849437, -11.773308, -12.962669,
+    -0.1483827, -0.4383977, -11.26825, 0.23957972, -0.069987595, 7.38, -14.672277, -18.367512,
+    -18.7905, 0.012328196, -0.351014, 7.26, 0.3906197, -0.029672667, -14.294952, 7.34,
+    0.46281648, 0.09600612, 0.5370322, -13.614294, 7.57, -19.982029, -0.049808893, -0.19014792,
+    7.65, 0.052964818, -0.102796435, 7.57, -11.26825, 0.20916541, 0.6590347, -10.792877,
+    -0.1335906, 0.015210301, 9.1, -5.5945034, -5.813874, -5.878716, -6.3148303, -0.000118073964,
+    -0.07762465, 9.07, 0.13116269, -0.06611633, 9.03, -5.784454, -0.2467453, -0.1588366,
+    -5.750133, -0.14863986, -0.010314745, 9.03, -5.5490093, 8.99, -0.103172086, 0.020261731,
+    0.13771118, 9.07, 0.20753758, -0.012219238, -5.813874, -7.2534256, -7.667374, -7.7751694,
+    -0.03286099, -0.1899765, 9.69, -0.09359197, -0.026237069, 9.42, -6.0905485, -0.06057484,
+    0.024571342, -6.4524984, 0.00770387, 0.14596602, -5.784454, 9.18, 9.14, 0.098293304,
+    0.35241944, 9.23, 0.06529786, 0.23513515, -5.7152433, 9.18, -0.1126766, 0.07878859,
+    9.18, 0.08975515, 0.19192855, -7.349471, 9.84, -7.5758924, -7.7751694, -7.832062,
+    -7.8932815, -0.107235335, -0.023084767, -0.24277447, -7.722872, 0.29893544, -7.667374, -0.1028673,
+    0.116581835, -7.444791, -7.485508, -0.25053743, -0.1265339, -7.3987164, 0.1122785, -0.058511015,
+    -7.5297284, 9.96, -7.667374, -7.722872, -0.016644305, 0.12452247, 9.88, -0.20864749,
+    -0.0007196215, -7.667374, -8.113236, -0.046277367, 0.016485337, 0.07758527, -7.3987164, 9.92,
+    -7.444791, 0.054351617, 0.007211914, -7.485508, 0.052403133, 0.19197999, 9.88, 0.30420876,
+    0.0688208, 9.84, -7.3014965, 0.10839691, -7.2534256, 0.37639236, 0.13224824, -7.3014965,
+    0.099631, 0.01675008, 9.53, 8.01, 7.1, 6.64, 6.57, 6.49,
+    6.45, 0.00038853174, 0.09422251, -14.672277, 0.1522238, -0.15751007, -12.962669, -18.367512,
+    0.4190022, 0.1414089, -9.684118, -0.06357867, -0.28324708, -14.995561, 6.88, -17.44737,
+    0.07273521, -0.03791685, -22.377066, 0.004312159, -0.111384265, -11.773308, -12.962669, -0.11904311,
+    -0.3529104, 6.72, -0.10961276, 0.14610612, -9.50892, 7.73, -10.19933, 7.61,
+    0.030627484, -0.08889934, 7.69, 0.58857495, 0.17658447, -11.26825, -12.655651, -0.09425578,
+    0.03748804, 7.93, -0.2202744, 0.0016747526, 7.85, -9.029197, 7.77, 0.5387344,
+    0.09206515, 0.5045802, -8.328821, 7.93, 0.015858447, -0.10499493, 7.93, 0.44449216,
+    0.12430389, -7.667374, 8.13, 8.09, -10.19933, 8.05, -0.108319856, -0.23767109,
+    -8.018251, -0.06559297, -0.13520133, -8.328821, -8.718564, -0.24091911, -0.3747345, -7.722872,
+    -0.17669505, -0.03304367, -8.018251, -9.029197, 8.17, -0.088860855, -0.22200821, -8.718564,
+    0.14163753, -0.047426317, 8.2, -7.8932815, -0.22385156, 0.17229329, -7.7751694, -0.24271937,
+    -0.083768755, 8.17, -7.3014965, 8.05, 0.3785042, 8.13, 0.11953252, -0.057904996,
+    8.13, 0.4817543, -7.1555967, 0.118519925, 0.34932235, -7.1032915, -7.485508, -7.5758924,
+    -0.11229538, 0.15375398, -7.3987164, -0.32334483, -0.08877003, 8.36, -6.8298554, 0.025087282,
+    0.21879713, -6.4785495, -0.05108428, 0.009176559, -6.740236, 9.65, -7.01124, -7.444791,
+    -0.20014325, -7.349471, 9.61, 0.010764695, 0.15501575, -7.2534256, -0.19813818, -0.06676557,
+    9.61, -6.7859416, -6.8298554, -0.03600314, 0.05799637, 9.57, -0.19070283, -0.025186593,
+    -6.7859416, -6.961682, 0.1515049, -0.048220824, 0.1349962, -7.1032915, 9.77, -7.3014965,
+    -7.722872, 0.014682389, -0.05780797, -7.20367, 0.036209583, -0.026833905, -7.20367, -7.349471,
+    0.0032427448, 0.08403257, 0.26021942, 9.73, -6.8701315, 9.69, 0.0115050515, 0.13839851,
+    0.26991054, -7.054926, 0.39030457, -0.011030579, 9.61, -6.5553975, 9.57, -6.7036514,
+    0.5843758, -6.618714, -0.079111904, -0.0054178876, -6.7036514, -0.030034065, 0.23411062, -6.511228,
+    0.14368846, 0.27306333, 0.32901886, -12.377764, 7.42, -12.655651, 7.1, -13.614294,
+    6.91, 2.01, -0.0040936, 0.049838923, -20.089907, 0.0020750747, -0.16043834, 1.88,
+    1.77, 0.1370983, 0.0077456157, 6.53, -0.3550312, -0.11550223, -16.605732, 7.22,
+    -19.539429, -0.030175585, 0.30434772, -19.876776, -0.0057119704, -0.1870164, -14.294952, 7.3,
+    0.38725996, 0.0046308204, -13.614294, 0.30271944, 0.4906903, 4.57, 1.73, 1.62,
+    0.022750854, 0.35776597, 2.01, 1.88, 0.049634095, -0.32385358, 0.3077484, 6.53,
+    -1.7005433, 6.95, -0.27425647, 0.33411154, -16.991007, 7.49, -20.188913, -25.69593,
+    -27.639406, -0.07416611, 0.023821004, -0.2318512, -0.48582387, -20.089907, 7.53, -20.981464,
+    0.08436966, -0.013471985, 0.19836375, 7.57, 7.53, -0.23324509, -0.10256034, -17.897657,
+    0.02609994, -0.026746655, -13.614294, 7.57, -16.605732, 7.53, -0.103125, 0.035768893,
+    -15.410659, -0.16445051, -0.10896858, 7.77, 7.65, 0.0658672, -0.037043072, -0.24101244,
+    7.49, -12.655651, -13.286145, 0.01916591, 0.09363484, 0.27182427, 7.69, 7.61,
+    -0.029031737, -0.22769096, 7.81, 0.03040438, -0.0924379, -11.26825, 6.53, 2.05,
+    1.88, -11.773308, 0.54702467, 1.73, 0.20575969, -0.039908346, 2.01, -11.773308,
+    0.046344124, -0.28641805, -0.5530693, -11.515594, 6.45, 4.57, 0.38639578, 1.0699615,
+    -11.773308, 0.115288995, -0.8302851, 6.45, 0.7871777, 1.6609423, 6.76, -11.773308,
+    -12.062972, -0.43898115, -0.2642696, -11.515594, 0.31816682, 6.64, 0.20343693, 0.012136332,
+    7.53, 6.91, -11.773308, -0.23744468, 0.2500063, 7.46, 0.7122574, 0.26668033,
+    7.77, -11.773308, -0.027880488, -0.17178738, -11.773308, 0.109868445, 0.02103282, 1.77,
+    -7.054926, -10.59073, -0.49401483, 1.73, -7.3987164, -0.061566796, 0.16513926, -0.32775486,
+    -5.5945034, -6.131815, -6.961682, 0.06985092, 0.26895192, -5.682901, 0.013006592, -0.08156281,
+    0.2886592, 2.05, -10.19933, -11.018427, -0.2840769, -10.792877, -0.040574457, -0.19007584,
+    -6.2222686, -6.961682, 0.04838232, 0.36507994, -4.6410313, -0.1334376, 0.073861845, 2.33,
+    -2.9810855, 2.21, -0.109510206, -0.41812044, -0.9247528, -0.06965291, 0.00855211, 3.02,
+    -1.7983414, 0.16540074, 0.009716684, -2.0923567, 0.0034314245, -0.020804636, -0.5968429, -0.7202588,
+    2.44, 2.09, -6.961682, 1.97, 1.69, 0.001150938, -0.03491312, -8.718564,
+    -0.28669348, 0.05781589, -6.3485193, 1.93, 0.21825531, 0.37853867, -4.6410313, -0.047723353,
+    0.061572235, -6.5924907, -6.910217, -0.39828095, -6.8298554, 0.06762695, -0.27724025, -0.771789,
+    -1.114961, -0.114789225, 0.035580236, 2.33, 0.006068251, -0.5162588, 2.55, -0.771789,
+    -0.8777573, -1.0267481, 0.16136076, 0.49861532, 2.48, -0.88567203, 0.38781497, 2.52,
+    0.65665805, 0.03873482, 3.36, -2.068156, 3.28, 0.31196854, 0.17596693, -1.98534,
+    0.106262885, 0.007277275, -2.173437, 4.45, 0.08545405, 0.000031146978, -1.960713, -0.05627931,
+    -0.012234512, 2.48, 2.17, 2.05, 1.93, 0.10180868, -0.14577332, 2.13,
+    -0.30197296, -0.740095, 2.25, -0.6559018, 0.4013147, 0.96191466, -0.6559018, 2.29,
+    0.14872192, 0.61272526, 2.37, -0.39657003, 0.63588524, 2.52, -0.6559018, -1.1836747,
+    -0.4387556, 3.24, 2.55, 0.26015112, 2.78, -0.06376128, 0.08531508, -0.6559018,
+    3.28, 0.031614177, -0.118521884, 3.28, -0.21988736, -0.0961441, 2.21, -0.54071695,
+    2.13, 2.05, 2.01, -0.042427827, 0.08572312, -0.13458787, -0.73727846, 2.13,
+    -0.3603938, 2.01, 1.97, -0.075382695, 0.098350525, 2.09, -0.3311467, -0.6951203,
+    -0.24307282, 2.01, 0.100817874, -0.09801891, -0.18892978, 0.31872043, 0.11446997, -0.30146822,
+    2.17, -0.48152414, -0.8491699, 0.6062723, -0.48152414, 1.2898926, 0.29440105, 2.17,
+    -0.14428757, 0.13855606, -0.07093092, -0.18892978, -0.26266348, -0.07306478, 4.49, 3.2,
+    2.33, -0.54071695, 2.29, 0.5980553, -0.06649094, -0.4176023, -0.3397756, -0.08665775,
+    2.44, -0.54071695, -0.21369489, 0.050550044, 2.55, -0.0577055, -0.017119644, -0.4176023,
+    -0.54071695, -0.15086071, -0.48152414, -1.198502, -0.25892842, -0.3603938, 0.38062134, -0.28560817,
+    -0.48152414, 0.34572205, -0.026259614, -1.1551399, 5.2, 4.73, 4.49, 4.33,
+    4.1, -3.593756, -0.004370824, 0.016439373, -2.4040701, 0.35496828, -0.049751543, -3.0695794,
+    -5.004444, -0.21528701, 1.3321811, -2.9810855, -1.0925964, 0.046509366, -1.3970085, -1.9079165,
+    -4.32814, 0.06459402, -0.08173795, -1.6287112, 0.85834885, 0.22919999, -1.0300022, -3.1480272,
+    -4.0418863, -4.127986, 0.4339685, 5.12, 0.36476898, 0.17199002, 5.04, -3.7527802,
+    0.29114392, 0.10362049, -3.9679167, 0.14280881, -0.035921287, 4.89, -2.196643, -2.907736,
+    0.08412474, 0.027954761, -0.07557616, 5.12, -3.0695794, -0.17128102, -0.073353074, -2.907736,
+    0.16314022, -0.0067182602, -4.32814, 5.52, -4.750224, -5.004444, 0.5629363, 5.44,
+    0.5102722, 0.19733654, 5.36, 5.28, 0.48008892, 0.24452646, -4.524055, 0.027151784,
+    -0.13379791, -5.1183767, 5.67, -5.254704, 0.42780343, 0.05742764, 5.87, 0.08231921,
+    -0.0013196727, -4.524055, -4.750224, -0.12586641, -0.022637052, 5.63, -0.27867317, -0.109255075,
+    -3.5361924, 5.6, -4.127986, 5.48, -0.0042365217, -0.31541982, 5.32, -0.29777393,
+    -0.14914471, -4.2262564, 5.83, -0.26747307, -0.06583993, 5.79, -0.017208088, 0.104245186,
+    -2.8076367, -3.1480272, -3.4047515, -0.0053698733, -0.07481638, -2.9810855, 0.15860415, -0.008606559,
+    5.32, -2.6292815, -0.0010402256, -0.13315678, 5.44, -0.19197738, -0.060655214, 3.56,
+    -1.114961, 2.37, 2.13, 2.01, 0.12454758, -0.06705513, -0.9511669, 2.4,
+    1.1295922, 2.44, -0.67012256, 2.98, 0.1126792, -0.018925762, 2.37, -0.9800166,
+    2.29, 2.21, -0.0025605636, -1.0475224, 0.9687683, -0.3603938, 2.17, -0.17921574,
+    0.03616505, -0.30146822, 0.302082, 0.00066796265, -0.3603938, -0.6559018, 2.4, -0.30952302,
+    -0.0023982702, 2.4, 0.4916694, 0.00076738506, 2.9, -0.24307282, -0.06892686, -0.0042720414,
+    -0.1652621, -0.82226276, -1.0267481, 3.78, 3.63, 3.59, -0.0015158082, 0.07615064,
+    3.67, -0.058233645, -0.010116005, -1.114961, 3.82, 0.033041995, -0.103125654, 3.86,
+    -0.18671884, -0.103125654, 4.45, -0.9800166, 3.63, -0.01197141, -0.16067712, -0.18522505,
+    4.49, -0.4187954, -0.9247528, 0.07843094, -0.2131691, -0.771789, 4.49, 0.77635497,
+    0.10119476, 4.49, -0.4176023, -0.48152414, -0.8124738, -0.22440441, -0.3603938, 0.3235279,
+    -0.24752732, -0.6559018, -0.119902804, -0.48152414, 0.29040712, -0.023633575, 0.03, -51.15694,
+    0.055084586, 0.008269065, 0.07, -42.560875, -45.980717, -0.04468464, -0.0675041, -0.028798277,
+    0.12, -40.02452, 0.4484372, -36.19027, -37.815678, -0.048207138, -0.06644088, 0.13896692,
+    0.16, -33.599087, -34.72578, -0.08038147, -0.056821525, -0.09596107, -30.874868, 1.42,
+    0.2, -0.0048781424, 0.33699352, 6.99, 0.012196379, -0.061378967, -27.639406, -28.209562,
+    -0.016102692, -0.16005068, -27.161629, 0.13808362, 0.000020442843, -0.07408267, -24.452414, -25.69593,
+    1.5, 0.35, -26.084858, -27.639406, 0.001764145, 0.08219745, -0.79746914, 1.34,
+    -26.084858, 0.30553144, 0.1612238, 1.42, -0.06599579, 0.097479425, 1.66, -26.084858,
+    -30.874868, 0.009689097, -0.17059532, 1.58, -0.86459297, -0.3080841, 7.03, -32.61234,
+    -0.029730177, 0.08701196, 7.1, -0.17235446, 0.0075189765, 1.58, 1.5, 1.46,
+    -25.265562, -0.25934955, -0.075412445, -25.265562, -0.6352427, 1.3062944, -24.864492, -25.265562,
+    -0.8271168, 0.005533447, 1.54, -1.3068279, -0.027950034, 1.69, 1.62, 0.77637047,
+    0.29221013, 7.26, 7.1, 0.0039008004, -0.2922065, -25.265562, 0.44768962, -0.09735291,
+    -23.813517, 1.5, 1.46, 1.42, 0.44, 0.012737512, 0.22758412, -0.2494391,
+    0.76627016, 1.54, -0.74444914, 6.99, 6.83, 0.1468963, -0.5466237, 7.03,
+    0.5923473, 0.001317482, 0.63, -21.325644, -21.50634, -22.377066, -0.07697964, 0.0470944,
+    -0.28605595, -1.0799321, -20.188913, 7.03, 6.91, 0.023312993, -0.50824374, 7.1,
+    0.6321226, 0.0017266298, 0.83, 0.75, -0.4091755, -0.12379503, 1.38, -0.021800337,
+    0.00127956, 2.09, 2.05, 0.15883043, -0.058459997, 0.08810311, 0.003937149, 2.25,
+    2.13, -0.058459997, 0.06887436, -0.10112496, -0.11054881, 2.63, 2.29, -0.058459997,
+    0.011505563, 0.052065086, 2.33, -0.058459997, -0.045022964, -0.14502297, -0.058459997, -0.036140874,
+    -0.0019477844, -0.058459997, 2.71, -0.092325136, 2.74, 0.1049717, -0.061266582, 2.67,
+    -0.031203613, -0.13143899, 1.22, 0.91, -19.76686, 0.87, -20.089907, 0.79,
+    -20.516748, 0.0049031335, -0.12550241, -20.188913, 0.36659345, -0.009999084, 0.79, -19.876776,
+    -0.13758639, -0.5114994, -19.982029, 0.02907542, -0.093519375, -20.28955, -0.11646881, -19.982029,
+    0.5503666, 0.161356, -19.539429, 0.87, -19.668941, 0.83, -0.05486959, -0.19378188,
+    0.83, -0.010481568, 0.013253848, -0.38835606, -19.330385, 0.87, -0.111026764, -19.428238,
+    -0.046354294, 0.05209141, -0.15986519, -19.539429, 0.99, -20.28955, -0.12363485, -19.982029,
+    0.5136439, 0.95, 0.22346182, 0.39642546, -20.28955, 1.06, -20.516748, 0.12756866,
+    0.41241074, -20.402336, 0.104685985, -0.15780757, -19.76686, -19.982029, -0.21901762, -0.13310649,
+    -19.668941, 0.11259512, 0.26342362, 0.95, -19.330385, -19.428238, -0.34562233, -0.15468387,
+    -19.09326, -19.22157, 0.10554123, -0.0040064035, -0.31689548, -19.428238, 0.99, 0.041583348,
+    1.06, 0.3098862, 0.15486355, -18.977423, -19.09326, -0.03507293, 0.02812828, -18.7905,
+    -0.08815352, -0.20033519, 1.46, -21.12554, 1.38, -23.178364, 1.3, -24.864492,
+    0.3217847, 0.13370733, -24.452414, 0.03531708, 0.1831921, -21.69312, -22.12889, 0.028762186,
+    -0.12765034, 1.3, 0.07801819, 0.23092651, -24.11707, 1.42, -30.874868, 0.12566566,
+    -0.39408082, -27.639406, -0.023636987, 0.3543751, 1.42, -23.813517, 0.07653351, -0.109933235,
+    -22.907703, -0.26138255, -0.49433976, 1.34, -20.402336, -20.981464, 1.26, -0.028952537,
+    -0.10614105, -20.652575, 0.07795837, -0.056613803, -19.76686, -20.28955, -0.14721878, -0.30539337,
+    -19.428238, -0.002870814, -0.18399817, -20.981464, 1.38, 0.1102665, -0.31667313, -0.4215539,
+    -21.50634, 6.99, -26.084858, 6.95, 1.5, 0.10407626, -0.025101695, -28.209562,
+    0.0049134255, 0.8042943, 6.91, 1.54, -0.22950427, -0.0015763305, -25.265562, -0.1619931,
+    -0.7326681, -26.572838, 7.14, -27.161629, -0.061375614, -0.6179619, -27.161629, -0.027695602,
+    0.37222987, 7.06, -21.931791, 0.59432316, -0.6286068, -22.377066, 0.021318084, -0.11692442,
+    1.54, -21.325644, -0.2756419, 1.5, 1.5978551, -19.330385, 0.7207816, 0.28478202,
+    -21.325644, 7.1, 6.95, -0.062292375, 1.8436049, 7.14, -0.67494816, 0.12909432,
+    1.62, -19.76686, 0.42794105, 0.057612218, -20.803585, -0.083931476, 0.0005041473, -5.784454,
+    -5.813874, 6.37, 4.61, -6.131815, -6.3148303, 4.53, -0.0010247381, -0.29859108,
+    4.53, -0.048187148, 1.7133656, 2.13, 2.05, -0.15672036, 0.0042180377, -5.878716,
+    -0.75871456, 0.05122223, -8.328821, 6.18, -8.718564, 0.8769628, 0.41144934, -9.50892,
+    0.33736065, -0.0273484, 6.06, -6.8298554, 0.32163838, 0.029423451, -6.131815, -0.15069483,
+    0.036284342, 6.45, -10.792877, -11.26825, 0.77904946, 0.23738606, -8.718564, -10.59073,
+    -0.1460649, -0.36690518, -8.577097, 0.26160687, -0.08822455, 6.49, -10.59073, -10.792877,
+    0.7036809, 0.3603723, -9.349648, 0.06318297, -0.08372732, 7.1, -13.614294, 0.012184209,
+    -0.106531516, 7.42, 0.038395602, -0.00348184, 4.49, -0.42491457, 8.95, 5.72,
+    0.34541118, 6.37, 5.95, 0.071676925, -0.004538536, 8.91, 0.23383205, 0.074892685,
+    9.07, -0.22220452, 9.1, 0.012422486, 9.18, 0.2739937, 0.14262879, 5.67,
+    -5.5490093, 2.17, 1.85, 1.77, -5.682901, 0.09613724, -0.06837769, -0.17260742,
+    -5.750133, 0.11989746, -5.682901, -0.08010254, 0.088952065, 4.57, -5.6420994, -5.682901,
+    0.8289637, -0.2516121, 1.517997, 0.30619892, -4.6410313, 4.53, 2.25, 1.77,
+    0.22648011, -0.10193244, -5.1183767, -1.4845543, -0.18721162, 5.6, -5.4127874, 0.6880434,
+    0.18739018, -5.254704, 0.15976116, -0.115264356, 5.36, -4.2262564, 4.57, -0.12104964,
+    0.28582016, 5.2, 0.003597316, -0.08054234, -3.593756, 5.63, -0.13441543, 0.006082916,
+    5.48, -0.07134964, 0.023253325, 6.34, -4.750224, 5.91, 5.75, -5.7152433,
+    0.09943848, -0.123006225, -5.004444, -0.24479763, -0.0888572, -5.4127874, -5.6420994, -0.05510006,
+    -0.2616789, -5.004444, 0.06824445, -0.17137988, 5.79, -3.9679167, -4.524055, -0.01004634,
+    -0.13822314, -3.8950949, 0.12471651, -0.061146855, -4.127986, 5.99, 0.012793483, -0.07789882,
+    5.83, 0.047504935, 0.11794306, 8.83, -5.750133, 8.68, 8.64, 0.03112259,
+    0.15986863, 8.8, -0.06188829, -0.11163153, 8.76, 6.37, 0.0014579773, 0.1823735,
+    8.8, 0.0012648519, 0.17574851, 9.03, -5.5945034, 8.87, -0.018690914, -0.13227035,
+    8.91, 0.1775087, 0.009638644, -5.7152433, 9.18, -0.0754042, 0.06142612, 9.14,
+    0.039275423, 0.11547198, -22.656353, -22.907703, 1.5, -23.813517, 0.44, -24.11707,
+    -24.452414, -0.006035735, 0.16598193, -0.77463865, -24.11707, 0.48, -0.510126, 0.06392382,
+    0.48, 0.31393, 0.13920091, 0.51, -23.178364, 0.48, 0.02616213, -0.16414917,
+    0.2945785, 0.56, -0.9694295, 1.46, 0.0026469382, -0.5294239, -23.178364, 1.58,
+    -23.813517, -26.084858, -0.023741795, -0.5400723, 1.3756925, 7.03, 6.99, -0.014975525,
+    0.17753975, -24.11707, -0.034943745, -0.19032952, 1.54, -1.5953652, 7.26, 6.99,
+    0.17334764, 0.974681, 7.3, 0.12500763, -0.052975845, 0.51, -1.1055404, 7.18,
+    7.14, 6.95, 1.5, -0.00065354136, 0.31298086, 7.03, -1.2129288, -0.045812227,
+    0.9525325, 7.26, -1.2969567, 0.10172997, 0.56, -22.377066, 0.111667395, 0.1978681,
+    0.59, -22.377066, -1.4753402, -21.931791, -22.12889, -0.19305734, 0.12114062, -0.24663417,
+    -21.12554, 7.03, 6.95, 1.62, 0.056399923, -0.1437119, -0.7787409, 7.06,
+    2.026594, 7.1, -0.30314308, 0.116044186, 0.67, -0.39605808, -20.981464, 7.06,
+    0.011950902, 0.50709397, 0.71, -0.13541207, 0.0007817933, 1.26, -19.22157, 0.91,
+    -19.76686, 0.83, -20.28955, 0.79, 0.0022549594, 0.68292236, -20.188913, -0.17905861,
+    -0.09920018, -19.982029, -20.28955, -0.2097059, 0.4341726, 0.87, -0.07088029, 0.13128215,
+    -19.539429, 0.87, -19.668941, -0.12197832, 0.0054126265, -0.31495395, -19.330385, 0.87,
+    -0.09036217, 0.016441615, -0.113800146, 1.06, -19.539429, 0.99, -20.28955, -0.10161201,
+    0.31920508, -20.28955, 0.24231707, -0.022482648, 0.99, -19.428238, -0.15052186, -0.08128941,
+    -19.330385, 0.29956552, -0.0476039, -20.652575, 1.1, -21.12554, -0.03391215, 0.3144789,
+    -21.325644, 0.10906539, -0.025215475, -19.876776, -20.188913, -0.06691056, -0.24659498, -19.428238,
+    0.0877715, 0.0063977563, -18.7905, 1.06, -18.977423, -19.09326, 0.99, 0.034947272,
+    -0.415699, 0.99, -0.20842336, 0.06070758, 1.03, 0.99, -0.042729493, -0.21255146,
+    -0.05846122, 1.14, -19.09326, 1.1, -0.18201275, 0.101240374, 1.1, 0.10618471,
+    -0.006706085, -19.09326, 1.18, -0.016972924, 0.08758354, 1.22, -0.07810239, -0.2096817,
+    1.14, -0.1958823, -0.036970522, 1.46, -21.12554, 1.38, -27.639406, -28.786161,
+    -29.518152, 0.105175786, -0.05944519, 0.288373, -21.69312, -22.12889, 0.033963457, -0.12627696,
+    -21.325644, 0.18329468, 0.007901891, -25.69593, -26.084858, -27.161629, -0.0061330004, -0.6627598,
+    1.42, -0.33777007, 1.0300754, -24.864492, 1.42, -0.11676331, -0.7708677, -24.452414,
+    0.29945794, -0.19364654, 1.34, -20.402336, 1.3, -20.652575, -0.01581299, -0.13940202,
+    -20.981464, -0.07654419, 0.063145675, -19.668941, -0.2841118, -19.428238, 0.11392839, -0.35807985,
+    1.38, -20.803585, -20.981464, 0.098147206, -0.028419876, -20.28955, -0.19737557, -0.41135025,
+    -0.40153247, 1.66, -25.265562, -26.084858, -26.572838, -32.61234, 0.028418366, -0.100256205,
+    1.5, 0.7097046, 0.04857352, 1.58, -0.73049587, -25.69593, -0.26466268, 0.360936,
+    -19.09326, -22.377066, 1.54, -0.13493647, 0.43608522, 1.62, 0.5098028, -0.114756525,
+    -12.962669, 1.58, 0.11957766, -0.06696656, -11.515594, 0.29883206, 0.0014596122, -22.12889,
+    -22.377066, -22.656353, -22.907703, -0.0072513944, -0.22492121, 6.99, -0.2536438, 0.37489772,
+    7.1, 7.06, -0.08631456, -2.27165, 7.18, 0.8853429, -0.31521943, -21.931791,
+    7.14, 6.99, 0.04280561, 1.4665512, 7.18, -1.6275402, 0.18422644, -21.69312,
+    7.14, -0.39097416, 0.26990828, -19.22157, 0.034876864, -0.0003057118, -0.5968429, -0.7202588,
+    -1.1551399, -12.377764, 7.42, -12.655651, 7.14, -0.0006491864, 0.029254654, 4.57,
+    0.10540219, -0.32597953, -16.991007, 7.49, -0.27081928, -0.052357264, -13.614294, -0.057530105,
+    -0.009096465, -11.26825, 6.53, 2.05, 0.113469064, 0.49170876, 7.53, 0.07639432,
+    -0.036149856, -11.018427, 7.57, 0.13743368, -0.31508964, 3.67, 0.014945264, -0.0017026173,
+    2.25, 2.17, 1.93, -1.0267481, 0.18583679, 0.040721383, -0.9247528, -0.00944322,
+    -0.22296588, 2.21, -0.9800166, -0.22199707, -1.157915, -0.771789, -0.35123494, -0.12143351,
+    2.37, -1.114961, 2.33, -1.0672268, -0.36768088, -1.0684927, 0.88002396, 0.2987181,
+    2.44, -1.0267481, 0.048906248, -0.28810748, 2.63, 0.069070876, -0.01563291, 2.48,
+    2.17, 2.13, 1.93, 0.111345425, 2.01, -0.07721215, -0.21572521, -0.6183037,
+    2.25, -0.6559018, 0.3303772, 0.80128115, -0.6559018, 2.29, 0.11819947, 0.50905097,
+    2.37, -0.33452818, 0.51496047, 2.52, -0.6559018, -1.0263149, -0.37393856, 3.17,
+    2.78, -0.6559018, -0.222239, 0.17082313, -0.6559018, 0.13709237, 0.024207154, 3.24,
+    3.2, -0.04015274, -0.005373001, -0.6559018, -0.06828018, -0.15463944, 2.21, -0.54071695,
+    2.13, 2.05, 2.01, -0.020851899, 0.09448395, -0.103795625, -0.61742556, 2.13,
+    -0.3603938, 2.01, 1.97, -0.03558777, 0.10584869, 2.09, -0.24466465, -0.5648522,
+    -0.24307282, 2.09, -0.11412781, 0.08334834, -0.18892978, 0.2617979, 0.085437745, -0.30146822,
+    2.17, -0.48152414, -0.74692005, 0.49946594, -0.48152414, 1.0901016, 0.2168603, 2.17,
+    -0.14428757, 0.11243607, -0.04938965, -0.18892978, -0.21875873, -0.05468465, 2.33, -0.54071695,
+    2.29, 2.25, -0.059918214, 1.0626353, -0.06282425, 2.29, -0.24307282, 2.25,
+    0.27231178, -0.22513132, 2.25, -0.25028828, 0.06851757, -0.3603938, -0.60824084, -0.14428757,
+    -0.20849513, -0.039188996, 3.06, 2.71, -0.54071695, 2.37, -1.4155095, 0.0045388653,
+    -0.14428757, 0.034933638, -0.017214878, -0.24307282, -0.4176023, 0.02713399, -0.022091705, 2.78,
+    -0.028848229, -0.1496091, 4.49, -0.4176023, 3.28, -0.09738883, -0.5401167, -0.3603938,
+    0.16883652, -0.21530686, -0.48152414, 0.2430011, -0.021857833, -1.9079165, -1.960713, -1.98534,
+    -2.4040701, -2.5247674, 4.57, 4.49, -0.0014482132, -0.1583002, 4.89, 0.06181512,
+    0.0001557652, 4.21, 2.37, -0.044298384, 0.29112005, 4.61, -0.53960913, -0.105536655,
+    3.44, 2.37, 2.29, 0.011312235, -0.26527852, 3.17, 0.24759987, 0.07338473,
+    -2.29015, 4.02, 0.1854525, 0.0423886, 4.29, -0.049094465, 0.016526781, 3.02,
+    2.09, 2.05, 1.85, 0.31497803, 0.059681196, -0.1882702, 2.9, 0.33656272,
+    2.98, 0.024375154, 0.14149576, 4.41, 4.36, 3.94, -0.15134771, 0.014375306,
+    -0.32680932, 0.18178101, 4.45, 3.94, 2.86, 2.33, 2.21, 0.16819128,
+    0.013096364, 0.3167852, -1.9313097, 3.4, -0.06217579, 0.07550066, 3.67, -0.045902666,
+    -0.21058121, -1.9313097, 4.41, 0.27941862, 0.5750546, 4.41, 3.98, 0.15744202,
+    0.09440651, -0.024414062, 4.49, -0.8461394, -1.9313097, 0.15257454, -0.28482553, 2.86,
+    -1.6592834, 2.78, 2.4, 1.97, 1.88, 0.30516967, 0.13402024, 2.09,
+    -0.13348217, 0.0627666, 2.71, 0.38796774, -1.8216634, 0.31463775, 0.09567424, -1.7678375,
+    -1.8541082, 0.20459239, 2.82, 0.11397584, 0.025335183, -1.7140237, 2.82, 0.024076538,
+    -0.10019042, -0.14279823, 2.63, -1.4832442, -1.605014, 1.93, 0.043460082, 0.2745784,
+    2.59, 0.14919205, 0.06957179, -1.4536674, 2.44, -1.073027, 0.08587697, -1.1551399,
+    0.03684418, -0.0004964369, -1.5751029, 2.71, -1.605014, 0.04322074, -0.11608072, -1.6287112,
+    -0.22595482, -0.12565136, 2.78, -0.6559018, -0.06688842, 0.010410204, -0.54071695, 0.08913638,
+    -0.056499243, -1.6287112, 4.45, -1.6592834, 3.1, 2.98, -0.0529548, -0.17083696,
+    3.82, 0.010307039, -0.056887615, 4.41, 3.2, -0.33826676, -0.106499135, -0.49493003,
+    -1.7983414, 0.8359317, -1.7678375, -0.5361298, 0.69689894, -0.30146822, -1.605014, 4.36,
+    2.9, -0.08775126, 0.05109064, 0.1819626, 4.17, -1.1948682, 0.008248582, -0.01350366,
+    -1.1948682, -0.07640469, 0.064416714, -0.13182265, -5.682901, -6.0520425, 7.97, -6.1628103,
+    -6.7036514, -12.062972, 7.46, 0.0007000213, -0.046186548, 4.57, -0.03969555, 0.044205632,
+    5.83, 4.53, 0.040780894, 0.43195993, 6.18, -0.32587284, -0.08420696, 6.18,
+    4.57, 2.17, 0.19701481, -0.5736622, -6.131815, 0.11470757, 0.36777893, 6.34,
+    6.26, -0.0065885545, -0.103874974, 0.052497864, -7.7751694, 9.84, -8.018251, -8.113236,
+    -0.07572488, 0.06371989, -7.8932815, -0.17982982, -0.07737441, 9.92, -7.8932815, -0.035598617,
+    -0.0014385082, -8.018251, -0.021945192, 0.017461266, 8.2, -7.3987164, 8.05, 0.2782053,
+    -0.019125191, 8.13, 0.3480428, 0.14899449, -6.131815, -6.286212, -0.008213792, 0.057375576,
+    9.38, -0.18779929, 0.39929387, 9.3, 8.8, 5.72, 4.49, 2.13,
+    -0.08262961, -0.38215563, 4.57, 0.60765946, 0.3028223, 6.49, -5.878716, 0.06804775,
+    -0.05325349, 8.6, 0.24803124, 0.037261963, -5.842078, -5.987348, 9.18, 0.057840534,
+    -0.19783318, 9.18, -0.15690823, -0.04582298, 9.18, 8.87, 0.032247134, -0.050978612,
+    9.23, 0.047946732, 0.14165072, 9.34, -5.949599, -6.0203667, -0.115676366, -5.987348,
+    0.19220683, -0.054277804, 0.24597931, 9.38, -5.949599, 0.3525817, 0.075899504, -0.14923707,
+    5.63, -4.750224, 4.53, 2.25, 1.81, -5.254704, 0.0039057415, 0.12045365,
+    -5.5490093, 0.07351341, -0.094048694, -5.1183767, -1.2536277, -0.16189371, -5.4127874, -5.5945034,
+    4.57, -0.21049805, 0.24567871, 4.61, 0.96276426, 0.38399827, -5.254704, 4.57,
+    -2.1912959, 0.32738385, 5.52, 0.34007105, -0.006759312, 5.36, -4.2262564, 4.57,
+    4.49, 0.042111512, -0.5026998, 4.61, 0.5131361, 0.1777957, -4.127986, 4.61,
+    -0.7147463, 0.12509918, -3.9679167, 0.12115753, -0.0012474771, -3.3498714, -4.524055, 5.48,
+    0.07169382, -0.10419351, -4.2262564, -0.18179642, -0.08049136, -2.8076367, -3.0695794, -0.013827428,
+    0.061871637, -2.7231896, -0.05849762, -0.17750078, 6.34, -4.750224, 5.91, 5.75,
+    -5.254704, 0.0042204014, -0.1356334, -5.004444, -0.19919075, -0.0716218, -5.4127874, -5.6420994,
+    -0.052490573, -0.21067476, -5.004444, 0.05507779, -0.13816783, -3.4047515, -3.9679167, 5.83,
+    -0.06456605, 0.004740439, -3.8950949, 0.16302003, 0.028976018, 5.72, -3.3498714, -0.223732,
+    -0.11619896, 0.0039791106, -5.5945034, 8.76, 0.15462704, 9.03, 8.87, -0.0007360549,
+    -0.10224342, 9.14, 0.020982647, 0.112195335, 8.91, 0.18449174, -5.5490093, 9.03,
+    -0.02443032, 0.11675739, 0.12722169, 9.53, 8.56, 7.1, 6.37, -7.485508,
+    2.17, 2.01, -0.0008567801, -0.23043361, 6.18, 0.21885458, 0.039221905, 5.95,
+    -5.9075212, 0.106656626, -0.0013846256, -6.1628103, -0.1485701, -0.0361303, -11.018427, -11.515594,
+    6.45, 0.6722832, -0.01644087, 6.53, 0.6729221, 0.08725749, -10.792877, 6.49,
+    0.3340381, -0.49330267, 6.45, -0.16568802, -0.031914454, -6.4785495, -16.991007, 7.22,
+    -19.539429, -0.027142912, 0.2058502, -19.876776, -0.016111808, -0.18208425, 7.26, 7.22,
+    0.53974175, 0.33495343, 7.61, 0.07188132, -0.0062794783, 8.48, -6.2222686, 8.4,
+    0.22137943, 0.044102628, 0.29754534, -6.0203667, -6.417596, 0.099693194, -0.02130289, -5.949599,
+    0.12300396, 0.29772708, -6.7036514, 8.76, 8.68, -6.7859416, -6.8701315, -0.08588688,
+    0.024613844, -0.25522748, 8.72, -7.054926, -0.30398762, -0.13422756, -0.3451334, 9.46,
+    8.83, 8.8, -0.05399933, 0.017551994, 9.38, 0.21561468, 0.022140851, 9.5,
+    -6.8701315, -0.054147203, -0.30775312, -6.910217, -0.11589394, -0.021216279, 9.42, -6.0520425,
+    -6.2222686, -6.2553506, -0.022672001, 0.17087734, 9.38, -0.1097547, 0.09943645, 9.3,
+    8.6, 0.19922706, -0.008433333, 9.34, 0.10951032, 0.24730809, -6.286212, -6.4524984,
+    9.46, 0.091940165, -0.07475569, 9.46, -0.18935394, 0.18958187, -6.131815, -6.2553506,
+    0.12111473, 0.26604077, -0.0069877626, -6.740236, 9.65, -7.01124, -7.444791, -0.16879903,
+    -7.349471, 9.61, 0.01047287, 0.13308659, -7.20367, -0.13229172, -0.04345883, 9.61,
+    -6.7859416, -6.8298554, -0.02730226, 0.049144823, 9.57, -0.16409963, -0.0193573, -6.7859416,
+    -6.961682, 0.13010216, -0.037331667, 0.1125651, -7.1032915, 9.8, -7.3987164, -7.667374,
+    -0.093514636, -0.033889797, 9.77, -0.0047625974, 0.054737855, -7.444791, 9.96, -0.004616564,
+    0.028507015, -7.3014965, 0.06165522, 0.17081146, 9.73, -7.054926, 9.69, -0.018821945,
+    -0.036934916, -6.8298554, 0.093505375, 0.30845135, -7.054926, 0.3330818, -0.00904541, 9.61,
+    -6.5553975, 9.57, -6.7036514, 0.52682036, -6.618714, -0.063480124, -0.0028078714, -6.7036514,
+    -0.023234177, -6.653369, 0.0932766, 0.21894169, -6.511228, 0.12120972, 0.2260866, 0.27778718,
+    9.5, 8.95, 8.8, 8.68, 7.1, 6.72, 6.57, -0.00040895594,
+    0.029843122, -22.377066, 0.022123618, -0.06455987, -6.3485193, 8.32, 0.010307292, -0.041937724,
+    8.48, 0.1704825, 0.04186068, -5.9075212, -6.7859416, 8.76, -0.25201857, -0.043381654,
+    -6.2222686, -0.0066954657, -0.12378397, -5.784454, -5.842078, 0.043448422, 0.13848673, -5.750133,
+    -0.055820044, 0.07114919, -6.2222686, -6.286212, -6.511228, 8.83, 0.010567728, 0.08713439,
+    -6.389413, 0.19146174, 0.10512038, 0.31779125, -5.5945034, -5.842078, 8.87, -0.13373281,
+    -0.011994722, 8.87, 0.022867193, -0.057450335, 8.91, 8.83, 0.22865398, 0.1140599,
+    -5.5490093, -0.009058533, 0.09400024, -6.286212, -6.3148303, -6.910217, 9.46, 0.22276103,
+    -7.1032915, 0.03707784, -0.069426574, 9.18, 9.14, 0.00030241013, 0.05418442, -6.3485193,
+    -0.056580346, 0.021439884, 9.46, 9.34, 9.27, -0.14830206, -0.029965822, -0.4592002,
+    0.24248658, 9.42, 9.07, -5.5945034, -5.813874, -0.034408297, -0.09029992, 9.03,
+    0.0040809265, 0.1463384, -6.0905485, -6.2222686, 0.06055676, -0.077101275, 9.34, 0.0032721863,
+    0.21938239, -6.131815, -6.2553506, 9.46, -0.123963416, 0.19520746, 0.21692622, -0.00628891,
+    -6.5924907, 9.57, -7.01124, -7.1032915, -7.20367, -7.3014965, -0.014368057, -0.13435955,
+    9.53, -0.07259267, 0.14446221, -0.1781332, -6.961682, 9.53, -0.015889892, 0.10275841,
+    -6.8701315, 9.53, -0.17319845, -0.04937948, -6.653369, 0.013671468, -0.058512237, -6.910217,
+    9.69, -7.1032915, -7.1555967, -0.017221507, -0.20619278, -7.01124, -0.0011291743, -0.022313876,
+    -7.1555967, 9.8, -0.016261693, 0.013495035, 9.73, 0.081996344, 0.16079877, 9.65,
+    -6.7859416, -6.8701315, 0.04652072, -0.025255546, 9.61, 0.028723871, 0.15382233, -6.8298554,
+    9.69, 0.051255938, 0.2621704, 0.26732484, -6.4524984, 9.53, -6.511228, -6.5553975,
+    0.1315525, 0.017322922, -6.4785495, -0.20104738, 0.047945023, 9.57, -6.5553975, 0.004784775,
+    -6.511228, 0.101008356, 0.18748055, 0.22333299, 0.19180883, 1.26, 0.63, -21.325644,
+    -21.50634, -26.084858, 0.35, 0.31, 0.004115762, 0.08302235, 1.0853714, 0.35,
+    -0.67746353, -24.452414, -0.085496895, 0.0040373243, -0.24458802, -0.9439235, -20.803585, 0.67,
+    -21.12554, -21.69312, 0.92370456, -21.50634, -0.3981366, 0.16899315, -0.3207297, 1.1,
+    0.71, -20.981464, 0.32473108, 0.05455759, 1.06, 0.8351855, 0.1491445, -24.11707,
+    0.21741472, -21.325644, 0.06713701, -0.028225824, 0.71, -20.652575, -0.12836336, -0.44271645,
+    -20.516748, 0.79, 0.75, 0.0797047, 0.6223831, 1.03, -0.15182012, 0.059914082,
+    0.75, -20.28955, -0.1971176, -0.07848107, -20.28955, 0.1033134, -0.0063201017, 1.46,
+    -21.12554, 1.38, -27.639406, -28.786161, -40.02452, 0.20527153, 0.030730039, -28.209562,
+    0.3046219, 0.13769959, -21.69312, -21.931791, 0.022732671, -0.15061216, 1.3, -0.004006831,
+    0.15740211, -25.69593, -26.084858, -27.161629, -0.0044007287, -0.5629463, 1.42, -0.2867054,
+    0.8759636, -24.864492, 1.42, -0.10482063, -0.6677305, -24.11707, 0.14006701, -0.17486012,
+    1.34, -20.402336, 1.3, -20.652575, -0.012857056, -0.11572482, -20.981464, -0.06598308,
+    0.05225891, -19.668941, -0.22888128, -19.428238, 0.09414758, -0.30036134, 1.38, -20.803585,
+    -20.981464, 0.08859863, -0.025311662, -20.28955, -0.16136856, -0.34510818, -0.3280427, 1.66,
+    -25.265562, -26.084858, -26.572838, -31.608435, 0.018481726, -0.0873021, 1.5, 0.6036482,
+    0.040703256, 1.58, -0.5960835, -25.69593, -0.22901917, 0.31316632, -19.330385, -21.325644,
+    1.54, -0.052389063, 0.3006326, 1.5, 1.3135136, 0.25377664, -12.962669, 1.58,
+    0.11070348, -0.051167764, -11.515594, 0.23337403, -0.0010811941, -32.61234, -33.599087, 1.77,
+    -40.02452, -0.14078681, -0.29438677, 6.95, 0.17831129, -0.024546318, 6.99, 6.95,
+    -0.31327516, 0.106767654, 7.14, -0.44267368, -0.23503189, -30.874868, 7.03, 6.99,
+    0.1389958, 0.4245678, 7.06, -0.40407714, 0.07533004, 1.69, -24.11707, 0.4703794,
+    -0.023153432, -22.12889, -0.030283092, 0.00031286906, 0.03, -51.15694, 0.043634515, 0.0061182296,
+    0.07, -42.560875, -45.980717, -0.03684532, -0.0550795, -0.023943802, 0.12, -40.02452,
+    0.36630127, -36.19027, -37.815678, -0.039492194, -0.054363947, 0.11254408, 0.16, -33.599087,
+    -34.72578, -0.06566769, -0.046516135, -0.078313194, -29.518152, 1.34, -32.61234, 0.5793119,
+    0.027301997, 6.99, 0.010610644, -0.040378395, 0.27, -28.786161, -0.03902403, -0.33475465,
+    -27.639406, -0.034692455, 0.0004273274, 1.14, 0.63, -21.325644, -21.50634, -25.69593,
+    0.35, -26.084858, 0.009551301, -0.5759081, -26.084858, 0.9767914, 0.1148695, -25.265562,
+    -0.21773277, 0.59, -0.01761165, 0.06165747, -0.19982542, -0.81812394, -21.69312, 0.67,
+    0.8312912, 0.23322754, -20.803585, 0.67, -21.12554, -21.50634, -0.33450317, 0.1358788,
+    -0.2598725, 1.06, 0.71, 0.15447748, 0.6959173, -21.12554, 0.06497357, 0.13445847,
+    0.71, -20.652575, -0.1041226, -0.36408758, -20.402336, 0.75, 0.006730683, 0.16487591,
+    0.79, -0.117841996, 0.01429671, 1.46, -21.931791, 1.34, 1.18, -22.12889,
+    -22.377066, 0.29194567, -0.025941163, 0.28599367, -22.12889, -27.639406, 0.15620443, 0.055411886,
+    1.3, -0.15117855, 0.061073303, -28.786161, -29.518152, -33.599087, 0.021452827, -0.057948586,
+    1.42, -0.101798706, 0.36364016, -27.639406, 1.38, 0.18479995, -0.33064538, -27.161629,
+    0.17768817, -0.05445149, 1.42, -19.668941, -20.28955, 1.34, -0.017364418, -0.090889946,
+    -20.089907, -0.24467802, -0.12658261, -19.330385, 1.18, 0.26495874, 0.039873112, 1.18,
+    -0.021879533, -0.1137403, -0.39468575, 1.62, -22.377066, -23.178364, -25.265562, -26.084858,
+    -0.0030145957, -0.38933784, 1.5, 0.42695704, -0.002110117, 1.54, -22.907703, -0.7093332,
+    -0.35615328, 0.63730973, -22.12889, 1.5, 1.739983, 0.37444764, -21.931791, 1.5,
+    -2.1893978, 0.9803047, 1.54, 0.53836215, 0.059632696, -32.61234, -33.599087, 1.77,
+    1.66, -0.04617353, -0.17688791, 6.95, 0.14157555, -0.013127043, 1.69, -0.59469503,
+    6.99, -0.07275467, -0.2705043, 1.73, -24.11707, -30.874868, -0.43558407, 0.30141553,
+    -20.652575, -0.13027243, 0.021919815, -30.874868, 7.3, 0.10668736, -0.15278678, -22.12889,
+    -0.024006525, 0.00005954997, -0.07408267, 9.53, 8.95, 7.1, 6.02, 4.65,
+    4.49, 0.0009170407, -0.073438525, -6.8298554, 0.30857828, 0.0018050602, -8.018251, 6.26,
+    0.23811541, -0.008636368, -7.3014965, -0.16190332, -0.053740483, -15.410659, 7.26, -18.367512,
+    -0.00057399273, 0.21075323, -20.089907, 0.0028581666, -0.11542217, 7.49, -12.655651, 0.104582764,
+    0.3665294, -10.19933, -0.035992052, 0.01308987, -6.286212, -6.3148303, 9.07, -6.4524984,
+    0.008787355, 0.044662986, 9.42, -0.041605175, -0.011151114, 9.46, 9.34, -0.10002513,
+    -0.37898046, 0.20356078, 9.38, -5.9075212, -6.2222686, 0.046890367, -0.04305856, 9.23,
+    -0.011173775, 0.11949902, -6.1628103, 9.42, -0.12638222, 0.15213962, -6.0520425, 0.27542064,
+    -0.18106233, -6.740236, 9.65, -7.20367, -7.349471, -7.444791, -0.14101563, 0.07254421,
+    -7.2534256, -0.12976508, -0.05949809, -7.1555967, 9.61, -0.013304393, 0.14890246, -7.01124,
+    -0.061426498, -0.0055858935, -7.349471, 9.84, -7.5758924, -0.015508505, -0.04442881, -7.5297284,
+    -0.0011740113, 0.058664065, -6.8701315, 9.77, 0.018377205, 0.090719886, -6.8298554, 0.10685181,
+    0.23157452, 9.61, -6.5553975, 9.57, -6.7036514, 0.47269136, -0.020495148, -6.7036514,
+    -0.024335671, 0.14421262, -6.511228, 0.084040575, 0.15232493, -6.7036514, 0.23937188, 0.042759705,
+    2.09, 2.05, -0.058459997, 0.06566442, 2.01, 0.044731904, 0.18408713, -0.058459997,
+    0.061796572, -0.009744263, 2.63, 2.48, 2.21, 2.13, -0.058459997, 0.045451738,
+    -0.09904671, -0.058459997, -0.12482249, -0.031959023, 2.44, 2.33, -0.031213855, -0.00845941,
+    -0.058459997, -0.0851117, -0.044356536, 2.55, 2.52, -0.058459997, -0.018684387, 0.027932739,
+    0.08661728, 2.59, -0.058459997, -0.00044738772, -0.0059179687, -0.02047466, 2.78, -0.058459997,
+    2.71, -0.07683869, 2.74, 0.096084215, -0.06107216, 2.67, -0.025496215, -0.10604538,
+    0.0034126283, -19.22157, -19.428238, 1.3, 0.91, -19.76686, 0.87, -20.089907,
+    0.0043637403, -0.06030026, -20.28955, -0.08494835, 0.23104964, 0.87, -19.668941, -0.10056136,
+    -0.03274281, -19.539429, -0.25672024, -0.042437874, 1.03, -19.539429, -20.28955, 0.019460754,
+    0.19062369, 0.95, -0.2574708, 0.13183245, -22.377066, -24.864492, 0.20036411, 0.063177556,
+    -19.668941, -0.038181704, 0.1362522, -19.668941, -19.876776, 1.46, -20.652575, -0.0214748,
+    -0.20830691, -20.516748, -0.004135998, 0.117360465, 7.06, 6.68, 0.08615577, -0.20678015,
+    7.22, 0.79992193, -0.13022563, 6.99, 1.34, -0.17191887, -19.539429, 0.17302988,
+    0.0118752485, -19.539429, 7.18, -2.3179877, -0.03650055, 7.1, -0.69760287, 0.21704674,
+    1.3, 1.18, 1.03, -19.330385, 0.99, -0.025930917, 0.16993517, 0.95,
+    0.0027334595, -0.27953368, -19.330385, 1.14, -0.26829323, 0.33104172, 1.1, 0.120102145,
+    0.32366344, 1.22, -19.330385, -0.10165291, -0.30990112, 1.26, 0.08084702, -0.20633088,
+    7.22, 7.06, 6.57, 1.81, 0.28148347, 0.7373235, 6.91, 0.14792009,
+    -0.13194732, 7.14, 1.8125021, 0.37693176, 7.53, -0.30394924, 7.57, -0.06476593,
+    0.003331375, -19.09326, 6.91, 1.1, 0.99, 0.95, 0.91, -0.1388977,
+    -0.010797951, 0.105109476, 1.06, -0.3441166, -0.15132514, 1.26, 1.22, 1.18,
+    0.05821082, 0.120136455, 0.02625071, 1.3, -0.19444327, 6.83, 0.027360788, 0.13446604,
+    7.18, -2.6406245, 7.26, 7.22, 0.06523514, -0.0041107177, -0.21658401, -18.977423,
+    7.1, 6.95, 0.99, 0.95, -0.23905964, -0.09945743, 1.1, 0.080601655,
+    -0.035221588, -0.58357394, 7.18, 1.3841317, 7.3, -0.040901948, -0.2733228, -18.367512,
+    6.99, 4.53, 4.49, -0.040517356, -0.97447014, 6.6, 0.41831127, 0.03880574,
+    7.18, 7.1, -0.24440704, -0.70332783, -18.7905, -0.0027741326, -0.15962365, -17.897657,
+    7.1, 7.06, 0.0037504497, -0.38088915, 7.18, 0.74976677, -0.014928437, -16.605732,
+    7.26, -0.004025088, -0.1265031, 1.88, 0.026223961, -0.00028782536, 0.2, -31.608435,
+    0.16, 0.12, -36.19027, -40.02452, 0.07, -0.006676368, 0.29700485, -37.815678,
+    -0.03470486, -0.04680136, 0.088888444, -33.599087, -34.72578, -0.05596289, -0.040413864, -0.06622169,
+    -32.61234, 0.4885021, -0.062487423, -0.33626086, -29.518152, 1.34, -30.874868, 0.23,
+    0.6558628, -33.599087, 0.08144303, -0.0364151, 0.23, -0.11072494, -30.058292, 0.12053528,
+    0.42842022, -34.72578, -36.19027, 1.42, -37.815678, -0.0011821493, 0.2629031, 1.73,
+    -0.039495803, 0.026672486, 1.58, 1.46, -0.24281159, 0.12220217, 1.66, -0.46886903,
+    -0.17152503, -33.599087, 1.42, 1.38, 0.27702865, -0.48451766, 1.46, 0.5624878,
+    0.12917905, 1.58, -32.61234, 0.2240306, -0.001672239, -32.61234, -0.24184847, 0.004135373,
+    0.27, -28.786161, -0.034332093, -0.2739692, -28.209562, 1.3, 0.31, 0.45189816,
+    0.12380371, 7.03, 6.99, -0.033349264, 0.7111416, 7.3, -0.24616683, 0.096648104,
+    -27.639406, 7.06, 6.99, -0.13366902, -0.8242618, 7.22, 0.5091095, -0.0011108399,
+    -27.161629, 7.06, 0.13484377, -0.26706716, 0.31, -1.3068752, 0.0002679317, -1.9079165,
+    -1.960713, -2.0923567, -2.4040701, -2.5247674, 4.61, 2.13, -0.0005821294, -0.076620124,
+    4.89, 0.060970068, 0.00014772474, 4.21, 2.37, -0.037362248, 0.23960505, 4.61,
+    -0.45474893, -0.08321249, 3.9, -2.173437, 2.13, -0.046606448, 0.1132859, 3.44,
+    0.12051719, -0.053923525, -2.29015, 5.0, 0.058841795, -0.07712995, 4.29, -0.10758107,
+    0.015761647, 3.13, 2.37, 2.01, 1.85, 0.2809639, 0.09612884, -2.068156,
+    -0.046128463, -0.1408049, 3.1, -2.040998, 0.31325313, 0.18175958, -2.0137024, 0.07131856,
+    0.022531128, 4.41, -2.068156, 3.4, 0.095639855, -0.02979881, -2.040998, -0.14177488,
+    -0.052019995, 4.45, -2.040998, 0.58154976, 0.14499424, -2.068156, -0.744112, 0.06736693,
+    4.45, 3.94, 2.94, 2.86, 2.33, 0.094484866, 0.2642123, 0.07907524,
+    3.4, 3.06, -0.028512765, -0.098674804, 3.71, 0.091855906, -0.093549706, -1.9313097,
+    4.41, 4.02, 0.12763672, 0.24985714, 0.4889984, 4.41, 3.98, 0.13246644,
+    0.07656937, -0.021837616, 4.49, -0.7190172, -1.9313097, 0.1448864, -0.24877357, 2.71,
+    -1.4832442, 2.4, 2.33, -1.7429106, 2.09, -0.049675465, 0.10465459, 1.88,
+    0.2472992, 0.13902599, 2.37, -0.05918579, -0.259293, -1.6592834, 2.67, 0.36791897,
+    0.19539033, 2.63, -1.5448009, 0.21552952, 0.06921112, -1.6287112, 0.052860107, -0.048333462,
+    -1.4536674, 2.44, -0.96558994, 2.55, 0.18787499, 2.63, -0.10692139, -0.020239258,
+    2.33, -1.114961, 2.25, -0.028392, -0.8285341, -0.8777573, 0.10100458, -0.005736324,
+    -0.9247528, 2.52, 0.142736, -0.040461622, -0.8777573, -0.22868748, 0.008220925, 4.45,
+    -1.6287112, -1.6592834, 2.78, -1.6862178, 0.18224694, -0.044368744, 3.44, -0.055384316,
+    -0.0073371045, 4.41, 3.2, -0.25063387, -0.08551372, -0.4287603, 2.78, -1.2630312,
+    -1.4217949, -0.04600514, 0.097238295, -0.6559018, -0.1294282, -0.023976965, -0.24307282, 3.02,
+    0.027192796, -0.007557352, -0.07408267, -0.10960789, 0.0030731203, -1.7983414, 0.7246539, -1.7678375,
+    -0.46446687, -1.6287112, 0.5885848, -1.1948682, -0.26253113, 0.065559715, -4.32814, 4.53,
+    -6.3485193, -6.910217, -7.444791, -7.7751694, -11.773308, 0.00070999813, -0.07314389, 2.17,
+    0.016978128, 1.6876116, 2.17, 2.09, -0.026521338, -0.227601, -7.3987164, -1.7774289,
+    -0.22318535, 2.17, 2.09, -6.7036514, 0.3300777, 0.15830067, -6.8298554, 0.05306015,
+    -0.19140625, 0.55168647, 2.25, 1.77, -6.3148303, -0.12742615, -6.131815, 0.27716753,
+    0.094889835, -6.2222686, -6.3148303, -0.02818184, 0.18293808, -5.254704, -0.105352156, -0.011838127,
+    4.49, -5.1183767, -0.6102614, -0.13007914, -5.682901, -6.1628103, -0.68172455, 0.30060387,
+    -1.7296807, 5.48, -6.4524984, -7.1032915, -7.5758924, -7.9547505, 0.297417, -1.9239037,
+    -7.3987164, 1.7168823, 0.29241487, -1.3531678, -6.1628103, 1.4219521, -5.878716, -0.6199608,
+    -5.4127874, 0.6688034, 0.1487649, -5.1183767, 5.63, 5.6, 5.55, 0.39419326,
+    0.25316334, -5.4127874, 0.22430098, 0.03996105, 5.87, -5.750133, 0.20659457, -0.095214844,
+    -9.684118, 0.006909636, -0.004644521, -4.524055, -4.750224, 5.55, 0.031018434, -0.077858895,
+    5.63, -0.08444042, 0.017125985, 5.79, 5.63, -0.16360049, -0.10122289, 5.99,
+    0.013961181, -0.12889557, 5.2, -3.8215072, 4.57, 4.49, 2.29, 2.21,
+    0.081017576, -0.34634948, 0.7950005, -4.2262564, -0.41795555, -1.3614464, -4.127986, 4.65,
+    -4.2262564, 0.1883252, -1.0660169, 0.30817872, 5.08, -4.0418863, 0.68995667, 0.1920194,
+    -4.0418863, 0.18557306, -0.06740003, 1.88, -2.6292815, 1.81, -3.7061508, 0.00017700196,
+    0.37454376, -2.9810855, 0.006668854, -0.1967266, 1.85, 0.29979706, -2.357731, 0.070860796,
+    0.18567505, 4.93, 4.73, 4.49, 0.0018199281, -0.06602996, -3.4047515, 0.14105771,
+    0.0106536895, -3.7061508, -3.7527802, -0.024078442, -0.2794367, -2.907736, 0.01258632, -0.057800334,
+    -3.4696734, 5.55, -4.0418863, 5.48, 5.24, 0.054514725, -0.053808153, -0.23220484,
+    5.32, -3.5361924, -0.2535109, -0.055482317, -3.8215072, -0.05998099, -0.15339951, -4.2262564,
+    5.79, 5.63, -0.3611748, -0.18440825, -0.070991434, -3.593756, -3.6424093, 0.039994117,
+    -0.12714164, 5.75, 0.115029335, 0.042178195, -2.907736, -3.1480272, -3.4047515, 5.63,
+    0.085095495, -0.011051178, -3.3498714, -0.13260251, -0.015707763, -2.9810855, -3.0695794, 0.045901574,
+    0.20615964, 5.44, 0.06476941, -0.040823113, 5.24, -2.6292815, -2.8076367, -0.010042191,
+    0.08866915, -0.060213726, 5.48, 5.32, -0.04685669, -0.11247511, 0.07476368, 7.06,
+    6.91, -17.44737, 4.53, 1.77, -19.22157, -22.377066, -0.0051451754, 0.011802082,
+    1.66, -0.038807772, 0.039933667, -18.367512, 4.49, -0.1402852, -0.8694588, 1.93,
+    -0.062141877, 0.24902141, 6.6, -18.7905, -19.330385, 0.22530976, 0.58689576, 6.53,
+    0.05293274, 0.24535711, 6.83, -21.931791, 0.1727855, 0.043427415, -21.50634, -0.07733979,
+    0.15603839, 6.37, -7.8932815, 4.53, -11.773308, 0.038615912, -0.061363466, -10.59073,
+    0.40774918, 0.08270003, 6.02, -7.1032915, 0.14609562, -0.0006958284, 6.34, -0.08696305,
+    0.09874903, -10.19933, -11.773308, -12.655651, -0.018268172, -0.267253, -11.018427, 0.25685313,
+    -0.048237663, -8.718564, 6.45, -0.2768307, -0.092787534, -8.577097, 0.26238188, -0.027645696,
+    -21.325644, -21.50634, 6.99, -25.265562, 6.95, -0.06795303, 0.123232804, 6.95,
+    -0.3056784, -0.70925736, -26.572838, -27.161629, -0.045225497, -0.5147097, -21.931791, 0.44095168,
+    -0.44144937, 6.95, -0.0950058, 1.2877274, 7.03, -13.937053, 6.99, 6.95,
+    0.09879252, 0.0024304825, -18.7905, -0.30252478, -0.009156863, -12.655651, -0.23876487, -0.04956856,
+    -20.089907, -1.2838553, -17.897657, -0.24456196, -17.44737, 0.09138031, -0.11740559, 7.73,
+    -11.018427, 7.61, -13.286145, 7.38, -14.995561, 0.006502422, 0.21126588, 7.57,
+    -0.08619257, 0.04903966, 7.46, -12.377764, 0.22184964, 0.5035446, 7.57, 0.09599801,
+    -0.08808337, -13.286145, 7.65, -14.672277, 0.16946821, 0.03335249, -15.410659, -0.03219498,
+    0.07568183, -11.26825, 7.69, -0.18661855, -0.05376504, 7.65, -0.5035535, -0.20355836,
+    7.61, -10.792877, 7.57, 0.4597542, 0.07158916, 0.6043793, -10.19933, 7.65,
+    -10.396682, 0.030904135, 0.3356482, -10.59073, 0.07690019, -0.13619576, 7.69, 7.65,
+    0.61939824, 0.3700442, -9.684118, 0.03324003, 0.49838853, -9.349648, -11.26825, -13.937053,
+    -0.12366364, -11.773308, -12.377764, 0.0025357818, 0.10975703, 7.77, -0.26487428, 0.022711597,
+    7.85, -10.59073, -11.018427, -0.61083263, -0.35816476, 7.77, 0.02283376, -0.17705779,
+    -9.684118, 8.01, 0.006766267, -0.080410466, -9.50892, -0.3058419, -0.15843551, 7.85,
+    7.81, -9.193894, 7.77, 0.36946604, 0.1293601, 0.51472336, -8.85124, -9.193894,
+    -0.05770073, 0.073623404, 0.37230024, -8.328821, -8.718564, -8.85124, -0.07282143, 0.198279,
+    7.89, 0.27849844, -0.14873092, 7.97, -8.018251, 0.12347382, 0.41224486, -7.667374,
+    -0.025788147, 0.0059882523, 9.69, 8.32, 7.1, 6.14, 4.65, 4.49,
+    4.29, -0.0016073799, 0.04443362, -4.32814, 0.032490607, -0.10973109, -6.8701315, 5.95,
+    0.41634828, 0.102799915, -6.2222686, -0.12537824, 0.0037899807, -9.50892, 6.34, 6.26,
+    0.49560395, 0.20764664, -10.396682, 0.0053384556, -0.09123135, -7.3014965, 6.18, 0.0764893,
+    -0.12647562, 6.3, -0.061582327, 0.061289676, -6.8701315, 8.2, -7.8932815, 7.93,
+    0.013516788, -0.05652046, 8.01, 0.28886637, 0.086185895, -8.018251, -8.328821, -0.050232153,
+    0.14132626, 8.28, -0.12648167, -0.047625154, 8.24, -6.8298554, 0.13092041, 0.39103338,
+    -6.618714, 8.28, 0.15014611, 0.021396695, 0.29915938, -6.7036514, 8.44, -8.018251,
+    8.4, 8.36, -0.06588882, 0.012444496, 0.17262688, -7.2534256, -7.485508, -0.10728848,
+    -0.3293025, -6.910217, -0.0072170733, -0.13789444, 8.52, -6.910217, -7.3014965, 0.0346797,
+    0.22509074, -6.740236, -0.17223151, 0.048056792, 8.8, 8.64, -0.03732141, -0.14149463,
+    9.42, 0.1266661, -0.022029791, 8.52, -6.1923833, 8.4, -6.653369, -0.25873834,
+    0.12797183, -6.618714, 0.1013085, -0.024539676, -6.131815, 0.2502284, 8.48, 0.14402027,
+    0.045125663, 9.42, -5.842078, -6.2222686, -0.0028191807, -0.028751606, 8.72, 0.14083873,
+    0.008256745, -6.389413, -6.417596, 0.03441416, -0.1053, 9.46, 0.009191474, 0.21194851,
+    -7.1555967, 9.8, -7.667374, -7.7751694, -7.8932815, -0.083317064, 9.77, 0.0117214965,
+    0.115745544, 9.77, -7.722872, 0.11686859, -0.087850735, -0.2113568, 9.73, -7.617456,
+    0.18995209, -7.485508, -0.23227234, -0.009884043, -7.617456, 9.77, -0.3260227, 0.006554498,
+    -7.485508, 0.06325012, -0.008010763, -7.3987164, 9.96, -7.485508, -7.5758924, 0.0017812029,
+    -0.039276727, 9.92, 0.0014063714, 0.1470693, -7.667374, -7.832062, 0.01544752, -0.013738251,
+    -7.5297284, 0.05548663, 0.10842438, -7.3014965, 9.84, -7.349471, -0.052982587, 0.055635072,
+    -7.349471, 0.14258252, 0.042467754, 9.84, -7.2534256, 0.2670578, 0.04763977, -0.032483928,
+    -6.961682, 9.73, -7.054926, -7.1032915, 0.05920563, -0.04788564, 0.07395075, -7.1032915,
+    9.77, -0.025880128, 0.16134147, -7.054926, 0.25590286, -0.02628479, 0.25630838, 9.53,
+    8.95, 8.76, 8.72, 7.06, 6.72, 6.57, -0.00044028467, 0.024626939,
+    -11.773308, -0.025750725, 0.111455075, -6.0203667, -6.131815, 0.0037908144, -0.1036103, 8.6,
+    0.17605978, 0.04151256, -6.0203667, -6.2222686, -6.5924907, -0.22612412, -0.06649297, -0.2373739,
+    -5.750133, -5.842078, 0.0645745, -0.06270718, 0.11236369, -6.2222686, -6.3485193, -6.389413,
+    -6.511228, 0.031591427, 0.16115037, 8.87, -0.013671112, -0.09117355, 8.91, 0.24091554,
+    0.0641449, -6.0905485, -6.131815, -6.1923833, -0.11228722, 0.050127883, -0.28057647, -5.5945034,
+    -5.949599, 0.0466658, -0.039359014, 8.91, 0.12315369, 0.00984726, -6.1923833, -6.2222686,
+    -6.2553506, -6.417596, 9.46, 0.0068599456, -0.053673584, 9.46, -0.0859204, 0.1054479,
+    9.14, 9.1, -0.008021407, -0.017555542, 0.19062021, 9.42, 9.34, -0.14875376,
+    -0.3790098, 0.1041919, 9.38, 9.14, -5.6420994, -6.1628103, -0.109176636, -0.033851232,
+    9.03, -0.020988295, 0.07623767, -6.1628103, 0.15259247, -6.0905485, -0.10686117, 0.025201002,
+    -6.1628103, 9.42, -0.109819345, 0.12564331, -6.0520425, 9.42, 0.27084616, 0.0071163177,
+    -0.16022721, -6.740236, 9.65, -7.20367, -7.349471, -7.444791, -0.1167799, 9.61,
+    0.003567505, 0.10778885, 9.61, -7.2534256, 0.013117218, -0.091834106, -7.2534256, -0.1985913,
+    0.010355225, -7.1555967, 9.61, 9.57, 0.16144677, -0.073771365, 0.12690037, -7.01124,
+    9.61, -0.017593661, -0.08925664, 9.61, -0.011599387, 0.01686947, -6.961682, -7.3987164,
+    9.88, -7.5758924, -0.0035744272, -0.03519149, -7.5758924, 0.0023058294, 0.04146996, 9.77,
+    -7.1032915, -0.0032664908, 0.03152555, -7.20367, 0.022394832, 0.16793168, 9.69, -6.8701315,
+    -6.910217, 0.019696046, -0.0102765765, -6.8298554, 0.09304565, 0.20343934, 0.21786194, 9.61,
+    -6.5924907, -6.7036514, 9.57, 0.42747805, -0.016478349, 9.57, -6.618714, -0.049483914,
+    -0.006387939, -6.618714, 0.10772909, -0.023671469, 9.57, -6.5553975, 0.0011144638, -6.511228,
+    0.06405411, 0.11886545, 0.16269875, -6.7036514, 0.20655023, 0.034895327, -25.69593, -27.639406,
+    -28.209562, 7.03, -30.058292, -30.874868, 0.2, -0.009275423, 0.03457543, 6.95,
+    -0.05934438, -0.44960403, 6.99, -29.518152, 0.11466781, -0.009847392, -29.518152, -0.0026885986,
+    0.6132569, -28.786161, 7.06, -33.599087, 0.051535454, -0.3748564, 7.1, 0.09398447,
+    -0.021274071, 7.1, -0.5676853, 7.14, 0.26129302, -0.27793765, 7.06, 6.99,
+    6.95, 0.31, -0.23249316, -0.051760245, 0.83987504, 7.03, -0.93924564, -0.19909923,
+    7.22, 0.41938576, 7.3, -0.4840145, 7.34, 0.23156993, 0.06672802, 7.1,
+    7.06, 6.95, 6.88, 1.62, 0.033314936, 0.14832498, -0.58314, -27.161629,
+    6.99, 0.049624633, 0.7968964, -26.572838, -0.08392138, 0.35426313, -26.084858, -26.572838,
+    -0.66206247, -0.02360344, -1.3576263, 7.14, 0.5691925, -27.161629, 7.18, -0.34098226,
+    0.26182252, 7.18, 0.65257853, 7.22, 0.24908867, 0.04779647, -25.265562, 7.26,
+    7.14, 7.03, 6.99, 1.58, -0.19431093, 0.17576936, -1.3644753, 0.761047,
+    -0.66299564, 0.38249835, -24.452414, 7.03, 6.99, 6.91, 1.42, -0.07221041,
+    0.10809734, -0.5258741, 0.8149139, 7.14, -24.864492, 7.06, -0.32614517, -1.8765267,
+    0.64762574, -24.864492, 7.26, 0.73420715, -0.09943085, 7.22, -1.5170131, 0.16511053,
+    -23.813517, 1.5, 1.46, 1.42, 0.09538323, -0.18584046, 0.62792116, 1.54,
+    -24.11707, -0.7286919, -0.2228676, 7.34, 0.01671082, -0.32693788, 0.63, -21.325644,
+    -21.50634, -0.01461118, -0.1660197, -0.71109825, 1.06, -21.69312, 0.7466194, 0.015762383,
+    1.5, -0.036262743, 0.0007555098, 0.03, -51.15694, 0.03668279, 0.0065014972, -34.72578,
+    -36.19027, 0.07, -42.560875, -45.980717, -0.028313566, -0.042835064, -0.0178243, 7.22,
+    7.18, 1.42, 0.026583496, -0.008677937, -37.815678, 0.10814883, 0.28271484, -45.980717,
+    -0.1490766, 7.26, 0.0048348745, -0.061621554, 1.58, 0.12, 0.07541455, 1.46,
+    0.16, -0.042160176, -0.21051636, 0.097249605, 1.73, -0.37644044, 6.95, 6.91,
+    -0.13832957, 0.58719105, 6.99, -0.029508462, -0.22588456, -32.61234, 0.16, -33.599087,
+    -0.029483993, -0.05049569, 1.38, 0.39035287, -33.599087, 1.42, -0.43881685, 0.13299803,
+    1.58, 0.17829584, -0.19985431, 0.2, -31.608435, -0.047199782, -0.26909894, -30.874868,
+    0.23, 0.53057784, 1.5, -0.10295635, 0.067722194, 0.23, -30.058292, -0.069721386,
+    -0.11921259, -29.518152, 0.05107062, -0.00030010167, 1.22, -19.539429, 0.83, -20.28955,
+    0.79, 0.75, -20.516748, 0.0030282969, -0.17395194, -20.516748, 0.47913152, 0.031035447,
+    -20.516748, -0.13913065, -20.402336, 0.32451478, 0.8490076, -20.188913, 0.75, 0.05110512,
+    -0.18039165, 0.75, -0.32899627, -19.876776, -0.040622767, -0.08110439, 0.99, -19.982029,
+    -20.28955, 0.87, -0.2735649, -0.11454493, -20.188913, 0.4272738, 0.2762421, 0.91,
+    -19.76686, -0.0038270429, -0.13094021, -19.668941, 0.099947445, 0.27322042, -20.28955, 1.06,
+    -20.652575, -0.12006104, 0.21412022, -20.402336, 0.05339272, -0.12457713, -19.76686, 1.18,
+    -0.13323157, 0.0009692601, -19.668941, 0.07616475, 0.16943304, 1.03, -18.977423, 0.95,
+    -19.428238, 0.91, -0.07032795, -0.21573646, -19.09326, -0.013684221, -0.19945107, -19.330385,
+    0.99, -0.017316116, 0.17588417, -19.22157, -0.23336612, 0.00034056272, 0.99, -0.02647583,
+    -0.16602434, -18.7905, -19.22157, 1.1, -19.330385, 0.22575743, 0.0982435, -19.330385,
+    -0.082206614, 0.07439213, -19.09326, 1.1, -0.20266464, 0.07963934, 1.1, 0.06071964,
+    -0.01156049, 1.14, -0.14329442, -0.012432861, 1.46, -20.652575, 1.38, -40.02452,
+    0.16481896, -34.72578, -0.110445656, -27.639406, 0.08253115, 0.019637285, -25.69593, -26.084858,
+    -27.161629, -0.0040134373, -0.4712494, 1.42, -0.23644467, 0.75182384, -24.864492, 1.42,
+    -0.078949355, -0.5620613, -24.452414, 0.23898144, -0.109482005, 1.34, 1.26, -19.876776,
+    -20.188913, 0.03636494, -0.2084279, -19.668941, 0.15168051, -0.04310538, -19.428238, -19.668941,
+    -0.10731733, 0.07110121, -0.20012787, -20.28955, 1.38, -20.516748, -0.18506216, 0.009175364,
+    -0.28120145, -19.76686, -0.281792, -0.05151825, 1.62, -22.377066, -23.178364, -24.11707,
+    1.5, 0.12825146, -0.095797524, 1.5, -0.25681162, 0.5496917, 1.54, -22.907703,
+    -0.5845816, -0.2878468, 1.58, 0.66748637, 0.22729747, -22.12889, 1.5, 1.5689477,
+    0.33626404, -21.931791, 1.5, -1.967495, 0.88153535, 1.54, 0.432157, 0.041910615,
+    -12.062972, 7.42, -12.655651, 6.53, -0.034269467, 0.009292196, 4.57, 0.15682235,
+    -0.25723112, 7.57, -13.286145, -0.08241661, 0.027068792, -14.672277, 0.06567588, -0.03826478,
+    -11.26825, 7.53, -11.515594, 0.069367476, 0.25507376, -11.773308, 0.061921924, -0.07680818,
+    -11.018427, 4.49, -0.62450653, -0.00296206, 2.05, 0.021720711, -0.00042580525, -0.5968429,
+    -0.7202588, 2.44, 2.13, -6.961682, 2.01, 1.73, 0.0018300075, -0.027383065,
+    -8.21763, -0.25823715, 0.0024443406, -6.286212, 2.09, 0.17407294, -0.025367929, -5.1183767,
+    -0.056607366, 0.032894593, 2.29, -0.8777573, -0.9247528, -0.106176935, 1.2267869, 2.21,
+    -0.8947012, -0.1808363, -1.3340919, -1.4832442, -0.19736932, -0.48465633, 2.33, 0.33927262,
+    -0.010343835, 2.52, -0.771789, -0.8777573, -1.0267481, 0.09206916, 0.59049934, 2.48,
+    -0.75106597, 0.3586194, 2.48, 0.67358094, 0.22492981, 2.86, -1.6862178, 2.74,
+    0.26387033, 0.096314125, -0.9247528, -0.007060734, 0.059971947, -1.9313097, 3.24, 0.10352452,
+    0.0009018161, 4.45, -0.012961052, 0.10162356, 2.48, 2.17, 2.13, 1.93,
+    0.09467672, 1.97, -0.020575715, -0.16301937, -0.53473383, 2.25, -0.6559018, 0.2788733,
+    0.67443174, -0.6559018, 2.29, 0.100643314, 0.41600704, 2.37, -0.27520084, 0.43689308,
+    2.52, -0.6559018, -0.8902049, -0.31867105, 3.17, 2.55, 0.19368553, 2.78,
+    -0.037185844, 0.06446251, 3.24, 3.2, -0.030635262, -0.0010728836, -0.6559018, -0.04981033,
+    -0.12413603, 2.21, -0.54071695, 2.13, 2.05, 2.01, -0.020133972, 0.08366852,
+    -0.09256821, -0.5172815, 2.13, -0.3603938, 2.05, 2.01, 0.0045649214, -0.14268418,
+    2.09, -0.2128582, -0.47885323, -0.24307282, 1.97, 0.099015504, -0.093262695, -0.18892978,
+    0.215806, 0.06594821, -0.30146822, -0.3603938, -0.48152414, 0.4737338, 0.17296906, 2.17,
+    0.21160622, 0.7017891, -0.18892978, 2.17, -0.045174155, -0.17980434, -0.14428757, 0.3019956,
+    -0.06224842, 2.33, -0.54071695, 2.29, 2.25, -0.049658585, 0.9220805, -0.052129745,
+    -0.4176023, 2.25, -0.48152414, -0.058818817, 0.18633544, -0.48152414, -0.19891332, -0.7003782,
+    -0.24307282, 2.25, 0.3187878, -0.08825704, 2.25, -0.19854926, -0.024242893, 4.49,
+    3.06, -0.54071695, 2.37, -1.2745075, 0.0177067, 2.37, 0.068450235, -0.005036543,
+    -0.4176023, 3.28, -0.07421719, -0.48150283, -0.3603938, 0.12190139, -0.19668733, -0.48152414,
+    0.2237372, -0.0074134828, -1.1551399, -1.4217949, -1.4536674, 5.2, 4.29, 3.75,
+    2.44, -0.0013431575, 0.019841773, -2.357731, 0.120394014, -0.036456585, -19.22157, 0.6824547,
+    -16.183819, -0.52188134, 0.016938036, -4.32814, 5.44, 5.28, 0.2742655, 0.10167588,
+    -4.894484, 0.0019547471, -0.055861868, -3.593756, 5.55, -0.106109455, -0.0072567924, -2.6292815,
+    -0.001097876, -0.08935061, 4.14, 3.17, 2.9, 2.37, -0.09218502, -0.026367545,
+    0.11108811, 3.78, 3.56, -0.09136855, -0.17775367, 3.82, 0.05925217, -0.01574065,
+    -0.6264547, 4.49, 4.45, 2.37, -1.2343782, 2.33, -0.065884195, -1.2758021,
+    2.29, -0.18125573, 1.4599648, 2.48, -1.1948682, 0.36430126, -0.03268051, -1.3340919,
+    0.0378694, -0.016583446, -1.362035, -0.8156101, -1.3340919, 1.5057099, -1.1948682, -0.8310642,
+    0.73426616, -1.3970085, 0.25485, -0.8784321, 3.56, 1.93, -1.0267481, -1.0684927,
+    1.88, 0.15152054, -0.072293095, 0.16966477, -0.8777573, -0.021207048, 0.08479675, 3.13,
+    -0.9247528, 2.33, 2.13, 0.029503632, -0.25445715, 2.4, 0.27533773, -0.058070578,
+    2.55, -0.24307282, -0.02504695, 0.014399856, -0.24307282, 0.028525535, -0.031848356, -0.8777573,
+    -1.114961, 3.24, -0.08521029, 0.0504488, 3.32, 0.1273674, 0.05834305, 3.32,
+    -0.6559018, 0.030388895, -0.07200338, -0.7202588, -0.14383896, -0.0401076, -0.82226276, 4.45,
+    -1.0684927, 3.82, 3.63, 0.054160055, -0.011729191, -0.09803058, -0.9800166, 3.71,
+    -0.00006828308, -0.1373556, -0.14283048, 4.49, -0.39582253, -0.9247528, 0.073661044, -0.18877868,
+    -0.54071695, 4.49, -0.771789, 0.63742167, 0.025384903, -0.6559018, -0.771789, 0.090625,
+    -0.084430695, 0.23298848, -0.48152414, 4.49, -0.913208, 0.080242924, -0.3603938, -0.4176023,
+    -0.065002635, 0.20444012, -0.17046255, -2.173437, -2.4040701, -3.2776601, -3.3498714, -3.4047515,
+    -3.593756, -3.6424093, 0.0008628002, -0.1322803, 2.25, 0.200102, 0.023704091, 4.49,
+    2.21, 0.033711243, 1.1528618, 4.81, -0.033197384, -0.119860284, 4.57, 4.49,
+    2.29, 0.03959976, 0.8461788, -1.267476, 4.81, 4.65, 0.36674666, 0.18899427,
+    5.52, 0.12226801, 0.011784649, 4.45, 4.21, 2.37, 2.29, 0.0133254845,
+    -0.4264864, 0.17560357, 1.1564095, 4.61, -2.8076367, -3.1480272, -1.0023705, -0.33540422,
+    -2.5247674, 0.5018103, -0.3848835, -2.907736, 5.55, 0.02387505, -0.10133972, -2.8076367,
+    -0.06601629, -0.027885487, 3.75, 2.13, 1.93, 1.85, 0.2236702, 1.88,
+    -0.009874726, 0.11163559, -2.3197646, 0.032291666, -2.2551181, -0.26368028, -0.007260895, 3.63,
+    2.37, 2.17, 0.24995117, -0.015965598, -2.2326505, 0.22283995, 0.14749603, -2.29015,
+    0.22661515, 3.67, 0.105649225, 0.03593584, -2.29015, 4.02, 3.78, 0.23280945,
+    -2.357731, 0.18670349, 0.0778561, 4.21, 4.1, 0.042143136, -0.1035582, 4.53,
+    0.13152947, 0.0050207283, 4.41, 4.36, 4.33, -0.05612981, 0.08919525, 0.363262,
+    4.49, -2.2551181, 0.23743694, -0.8443165, 4.85, 0.01077089, -0.08723537, 3.32,
+    -2.040998, 2.37, -2.1466296, 1.88, 1.85, -0.049488068, 0.051815033, -0.3342846,
+    2.05, 1.93, 0.10642294, -0.0999363, 2.25, 0.092348024, -0.00055160525, 3.13,
+    0.22162704, -2.068156, -2.1466296, 0.19113126, 0.12497838, 3.17, 0.06596718, -0.0240666,
+    1.88, -1.6592834, 0.2506363, 0.10649109, 2.98, -1.7983414, 2.4, 0.021387788,
+    0.1401271, 2.71, 0.0061234604, -0.013252402, -1.6287112, -1.7140237, -0.0382733, -0.13910542,
+    -1.5448009, 0.1032596, -0.0048149265, -1.960713, 4.29, 4.06, -1.98534, 3.78,
+    -0.0579457, 0.021651423, 3.67, -0.05857829, -0.24421051, -2.040998, -2.068156, -0.11691425,
+    -0.23472595, -2.0137024, -0.025828933, 0.025989732, 4.49, -2.1208782, 4.45, 0.16296175,
+    1.2001266, -2.068156, -0.20492737, 0.10916474, 4.53, -0.26331177, -2.0923567, -0.1151376,
+    -0.06266718, -1.9313097, 4.45, 4.02, 3.44, -0.01184082, 0.08598241, 4.41,
+    0.20078857, 0.4062004, 4.49, -0.6206123, 0.14630051, -1.0267481, 3.67, 3.48,
+    -0.029568622, 0.05321179, 4.45, -0.017492823, 0.09550476, 4.49, -0.54071695, -0.04955433,
+    -0.17917176, -0.6559018, -0.007294137, 0.13567619, -0.07408267, 5.87, 4.57, 4.49,
+    4.41, 3.98, 3.94, 0.00095456204, 0.03338014, -2.357731, 0.0693491, -0.01755612,
+    -3.0695794, -3.4047515, 0.1181457, 1.4199524, -2.2326505, -0.42556533, 0.049203496, -4.750224,
+    -4.894484, -5.5490093, 0.037374526, -0.32683662, 1.0949436, -2.907736, -4.2262564, -0.35488734,
+    -1.055842, -1.3970085, 0.3580967, -0.07416939, -6.4524984, -6.7036514, 0.5037651, 5.83,
+    -6.5553975, 0.17881064, 0.48373476, -6.653369, 0.20466411, 0.0637235, -5.750133, 5.79,
+    -6.0520425, 0.432847, 0.13794093, -6.2222686, -0.2838232, 0.046570312, 5.67, -5.1183767,
+    0.17757982, 0.0018050931, -5.004444, -0.10924573, -0.018023971, 7.06, -6.740236, 5.99,
+    -7.01124, 5.95, 0.40487313, 0.20573972, 5.91, 0.23093383, -0.06332779, -8.21763,
+    6.22, 0.26160398, -0.0057502906, 6.06, 0.03483882, -0.08107623, -6.131815, 6.18,
+    6.02, -0.31597465, -0.18733984, -6.2222686, 0.043895774, -0.336298, -5.842078, -6.0520425,
+    0.17106052, 0.05582087, -5.4127874, -0.08046076, 0.0065973247, 7.73, -11.018427, 7.61,
+    -13.286145, -0.008512959, 0.07685151, -12.962669, 0.042874884, -0.15101121, -9.847813, 7.65,
+    0.27235138, -0.0050964877, -9.684118, 0.25438416, 0.40842158, -9.349648, -11.26825, -13.937053,
+    -0.10461861, 0.022261633, 7.85, -0.15699594, -0.060949773, 7.85, 7.77, 0.47014314,
+    0.20256877, 7.93, 0.08431377, -0.0013652236, 2.05, -0.058459997, 0.03772558, 2.01,
+    0.030062104, 0.14594625, 2.63, 2.48, 2.44, 2.21, 2.09, 0.011599078,
+    -0.056773733, 2.29, 0.015137948, -0.031266302, -0.06202835, 2.55, 2.52, -0.058459997,
+    -0.019301224, 0.019816285, 0.07020531, 2.59, -0.058459997, 0.003376465, -0.001218872, -0.01248807,
+    -0.058459997, 2.71, -0.060791936, 2.74, 0.09397812, 2.78, -0.047462463, 0.007868576,
+    2.67, -0.017664185, -0.07861015, 9.5, 8.56, 8.48, 8.32, 8.28,
+    7.14, 6.64, 0.00072726625, -0.014507842, -6.961682, 0.0008049232, 0.18234879, -6.5553975,
+    -8.018251, 0.13975027, -0.023750288, 0.22621155, -6.417596, -6.653369, 8.4, -0.10626383,
+    -0.036526885, 8.4, 0.05854624, -0.11141815, -6.1923833, 8.4, 0.16224615, 0.053364128,
+    -6.131815, 0.23326226, 0.13653146, -6.910217, -7.485508, 8.52, -7.667374, -0.07556858,
+    -0.010719045, -0.15975739, -7.3014965, 0.10473702, -7.054926, 0.30432996, 0.10559626, -5.987348,
+    8.52, -6.417596, 0.0842543, 0.0050385934, -6.740236, -0.14800994, -0.04229699, -5.949599,
+    0.07466339, 0.21698487, -6.3485193, 8.6, -6.910217, -7.3987164, -0.068385825, -7.01124,
+    0.09597637, -0.01610756, -0.2710596, -7.054926, 8.72, -7.20367, -0.11012312, -0.19711602,
+    -7.1032915, 0.04309438, -0.11419779, -6.417596, 9.46, 0.010002759, -0.07565759, 9.23,
+    -0.02370116, -0.11516688, -6.2222686, 8.95, 8.6, -6.286212, -0.26317394, -0.029190635,
+    8.76, 0.10834205, 0.17664091, 9.46, -6.2553506, -0.061442185, 0.08194969, -6.286212,
+    0.16574402, 0.08364283, -6.1923833, 8.64, 8.6, 0.07842465, 0.19338761, 9.42,
+    -0.17577957, 0.0871399, 9.34, -5.9075212, -0.03542499, 0.010774761, -6.0905485, 0.009670845,
+    0.17089471, -6.4524984, -6.910217, 9.69, -7.20367, -7.617456, 0.048919167, -7.5297284,
+    -0.12492561, -0.03635637, -7.1555967, 9.61, -0.0221838, 0.16813591, -7.1032915, -0.114199996,
+    -0.016372403, -7.1555967, 9.8, -7.667374, -0.052438583, -0.004161072, -7.444791, 0.0020884776,
+    0.04516518, 9.73, -7.054926, 0.009127808, 0.07419833, -7.1032915, 0.042298317, 0.15912628,
+    9.53, -6.511228, -6.618714, -6.7859416, 0.040126454, -0.08838501, -6.5553975, 0.0886322,
+    0.018588638, -6.4785495, -0.16475709, 0.044618227, -6.740236, 9.65, 9.57, -0.037028722,
+    0.014633747, -6.8298554, 0.058241017, 0.17599691, 9.61, -6.5924907, 0.026140813, 0.072899,
+    -6.7036514, 0.17521058, 0.031167602, 9.53, 0.14388983, 0.03638916, -20.188913, -21.50634,
+    -21.69312, -22.12889, -25.69593, -27.639406, -28.209562, 0.002424508, -0.07776898, 7.1,
+    0.018203314, 0.16975372, 7.18, 6.99, -0.02085042, 0.11717514, -24.11707, 0.1138821,
+    -0.20747125, 7.03, 1.18, 0.63, 0.037771877, 0.33148125, 1.5, -0.21669368,
+    0.01955254, 7.1, 1.1099461, 7.18, -0.2615321, 0.21727183, 7.1, 6.95,
+    1.18, 0.63, -0.05242246, -0.16929032, 6.72, 0.12069048, -0.093193665, -0.7694462,
+    7.14, 1.1049541, 7.18, -0.51442313, 7.22, 0.4083252, 0.052011717, 0.63,
+    -21.325644, -0.13663884, -0.6170532, -21.12554, 7.03, 1.14, -21.325644, 0.20891313,
+    0.06329483, 1.18, -0.32804993, -0.0117523195, 7.1, 1.4035726, 7.14, -0.6103363,
+    0.3148606, 0.67, -0.21751778, 1.1, -20.803585, 0.16426195, 0.018882362, -20.803585,
+    -0.06435924, 0.023958528, 0.83, 0.75, -0.29640007, -19.76686, -19.876776, -19.982029,
+    -20.089907, -0.026863828, -0.083934896, 0.79, 0.081613354, -0.019112943, 0.79, -0.42658043,
+    -0.049696904, -19.668941, -0.00095965073, 0.0029357912, -16.605732, 7.26, 6.53, -17.897657,
+    1.93, -0.004606798, 0.24304573, 1.93, -0.04028158, -0.5119756, 6.64, -16.991007,
+    0.20098405, -0.1350947, -20.089907, -0.21261649, 0.006127426, 7.53, -18.977423, -19.668941,
+    -0.097185135, -0.29997715, 7.3, -0.27043256, -0.09892333, -18.7905, -19.539429, 0.10159429,
+    -0.0462381, -17.897657, 0.11186743, 0.051521253, 1.81, -11.26825, -12.962669, 1.58,
+    0.13128243, -0.0024645273, -11.773308, 0.26864448, 0.05477642, -10.792877, 1.66, -0.09245606,
+    -0.34895414, -5.254704, -0.03114355, 0.18236278, 2.44, -10.19933, 1.88, 0.013759198,
+    -0.17569293, 2.05, 0.0230334, -0.014055523, -0.7202588, 2.55, 0.09790461, 0.00080433453,
+    2.55, -0.059000414, -0.0013323354, -19.22157, -19.428238, 6.83, 1.88, 1.81,
+    -22.377066, -23.813517, 0.003287124, -0.035972327, 1.46, 0.0044008642, 0.12862922, -19.539429,
+    -0.31224415, -0.04552727, 6.72, -19.982029, -20.516748, 0.21713701, 0.36439362, 6.68,
+    0.19046682, 0.034170914, -23.178364, 6.79, 0.25478885, 0.051098634, -20.981464, -0.12268692,
+    -0.0116352085, -19.668941, -19.876776, 6.99, -30.058292, 0.08208315, -0.14935617, -20.981464,
+    0.020711912, -0.101187065, 7.06, 6.99, 0.00414505, -0.24944611, 7.22, 0.6599424,
+    -0.09252879, -19.539429, 7.18, 6.99, 0.060399372, -2.0136368, 7.26, 0.24080239,
+    -0.13227272, 7.14, 7.1, -0.6297951, 1.3349015, 7.22, -0.112389125, -0.36983213,
+    1.3, 1.18, 1.03, -19.330385, 0.99, -0.022647016, 0.106531635, 0.95,
+    0.0002903239, -0.19064914, -19.330385, 1.1, 0.42126748, -0.20370045, 1.1, 0.080290824,
+    0.25890228, 1.22, -19.330385, -0.06634471, -0.26774108, 1.26, 0.07928635, -19.330385,
+    -0.19772492, -0.024882508, 7.22, 7.06, 6.57, 0.3980839, 6.91, 0.09931669,
+    -0.08767738, 7.14, 1.5671418, 0.3209381, 7.34, -0.32252884, 7.57, -0.07454041,
+    -0.005958557, -19.09326, 6.91, 1.1, 0.99, 0.95, 0.91, -0.11501058,
+    -0.0015150591, 0.0907683, 1.06, -0.25900507, -0.07562246, 1.26, 1.18, 1.14,
+    0.07152439, -0.018886948, 1.22, 0.1019598, 0.038978066, 1.54, 1.3, -0.13135427,
+    -0.02458725, 1.58, 0.12015152, 0.028228251, 7.18, -2.2932556, 7.26, 7.22,
+    0.054409027, -0.009298706, -0.15017624, -18.977423, 7.1, 6.95, 0.99, 0.95,
+    -0.16929702, -0.07850902, 1.1, 0.066189475, -0.019922152, -0.52716905, 7.18, 1.1563998,
+    7.3, -0.010503006, -0.18950754, -18.367512, 6.95, 4.53, 4.49, -0.01705537,
+    -0.75843966, 6.6, 0.22926648, 0.018505922, 7.18, 7.1, -0.16728668, -0.5888192,
+    -18.7905, 0.0197514, -0.11731156, -17.897657, 7.1, 7.06, -0.007301431, -0.34475252,
+    7.18, 0.61865693, -0.004325358, -16.605732, 7.14, -0.057512414, 0.016455628, 1.81,
+    0.022052038, -0.000003827026, -34.72578, -36.19027, 7.22, 7.18, 7.1, 1.73,
+    1.69, -0.001525939, -0.17985383, 6.91, 0.17227519, -0.012134119, 7.14, -51.15694,
+    -0.028421402, -0.1819645, -37.815678, -0.0076130456, 0.16370697, -37.815678, -42.560875, 0.19906159,
+    -40.02452, -0.050703812, 0.0055089314, 0.25159952, -45.980717, -0.13299128, 7.34, -40.02452,
+    -42.560875, -0.027930832, 0.047931924, -0.037069894, -40.02452, -0.14509201, -37.815678, 0.050251007,
+    -0.06633199, 1.58, 0.12, 0.05922236, 1.46, 1.42, 0.16, -0.03635958,
+    -0.07508545, -0.23602524, 0.07314529, 1.66, -0.33621788, 6.95, 6.91, 1.77,
+    -0.057845306, -0.19088593, 0.52074665, 6.99, -0.03587443, 7.18, -0.24979496, -0.10261202,
+    -32.61234, 0.16, -33.599087, -0.026073596, -0.04312061, 1.38, 0.31296602, -33.599087,
+    1.42, -0.3954079, 1.46, 0.46545815, 0.0720664, 1.58, 1.46, -0.24469273,
+    0.518388, 1.69, -0.5248726, -0.08188123, 0.2, -31.608435, -0.04032981, -0.22008479,
+    -30.874868, 0.23, 0.43114686, 1.5, 1.46, 0.081973575, -0.37887344, 1.62,
+    0.23088494, 0.0045155673, -30.058292, 7.14, 7.1, -0.06424838, -0.6354523, 7.18,
+    0.2784195, 0.08828517, -29.518152, 1.34, 0.1586021, -0.009956959, 0.27, -0.101847924,
+    0.00026598226, 8.09, 7.18, 6.14, -3.8215072, 4.57, -5.5490093, -5.5945034,
+    -0.00041937843, 0.6691219, -5.254704, -0.33992928, -0.010276466, -7.7751694, -8.453863, 0.4481473,
+    0.16266264, 5.08, 0.15696855, 0.0014991364, 4.93, -3.2152596, 4.61, -0.06894278,
+    0.08277241, -2.8076367, -0.048132747, 0.0011492909, -3.593756, -3.6424093, -0.059088904, -0.18681867,
+    -2.907736, 0.005986398, -0.039682742, -9.50892, 6.34, -10.19933, 0.388868, 6.26,
+    0.39222807, -0.031686958, -10.19933, 6.49, 0.12989819, -0.0052954606, 6.45, -0.25740474,
+    0.02791582, -7.3014965, 6.18, -8.85124, 0.49900723, -0.09114364, -8.21763, -0.076991014,
+    -0.14319287, 6.26, -6.389413, -0.15308319, 0.0122196125, -6.4524984, 0.12819044, -0.053846147,
+    -7.667374, -17.44737, -17.897657, -20.652575, -22.656353, -0.035476405, 0.11791231, -20.516748,
+    -0.6612198, -0.029275466, 7.46, 7.22, -0.10232506, -0.3152101, 7.61, -0.08544159,
+    -0.022515489, 7.26, 7.22, 0.42386395, -16.605732, 0.09114807, 0.29179785, -9.029197,
+    7.77, 0.023430282, -0.054291207, 7.89, 0.21706188, 0.0033257832, 8.05, -7.444791,
+    0.3281345, 0.12848587, -7.349471, -7.5758924, -7.617456, 0.05086873, -0.0824646, -7.485508,
+    0.04496948, 0.09242066, 0.3060889, -9.193894, 8.13, -0.18385598, 8.17, -9.349648,
+    -9.684118, -9.847813, 0.051999282, -0.008454896, -9.50892, -0.16529846, -0.051619466, 0.02339306,
+    -0.183152, -7.2534256, 8.4, -8.718564, 8.13, -9.029197, 0.029725647, -0.16295898,
+    8.17, 0.19861282, 0.022548715, -8.577097, 8.32, -0.19985382, -0.015127182, 8.32,
+    -0.041821282, -0.13749842, 9.8, -7.9547505, 0.16289781, -7.832062, -0.07271292, -0.011093176,
+    -7.3014965, -7.7751694, -0.008064517, 0.011728201, 9.84, 0.21634904, -0.03761902, 8.17,
+    -7.20367, 8.13, 0.15371858, -0.058893587, -6.961682, -7.1555967, 0.14495361, 0.27743468,
+    0.09434917, 8.36, -6.961682, 8.28, -0.11656057, 0.050564375, 8.24, 0.18860038,
+    0.0812812, -6.286212, 8.76, -0.034842953, 0.0037212204, 8.6, 0.08193993, -0.0020054816,
+    -19.22157, -19.428238, 7.49, 7.34, -24.452414, -25.69593, -27.639406, -0.0028137502,
+    0.027622644, 7.26, -0.05445354, 0.20789985, 7.03, 6.95, 0.005870295, -0.2505025,
+    -19.668941, 0.093522824, -0.4401575, -20.188913, -25.265562, -26.572838, -0.012457675, 0.15964012,
+    -23.813517, -0.15695725, -0.070427395, -0.30415002, -21.931791, -22.907703, 0.124617256, -0.038357545,
+    -19.982029, 0.117562585, 0.029307557, 1.3, 1.18, 1.03, -19.330385, 0.99,
+    -0.018244172, 0.08829498, 0.95, 0.00026468912, -0.1559576, -19.330385, 1.14, -0.22326039,
+    0.32849255, 1.1, 0.065407835, 0.21362086, 1.22, -19.330385, -0.05526174, -0.22487794,
+    1.26, -19.330385, 0.034441184, 0.097680666, -19.330385, -0.17793731, -0.022378922, 7.22,
+    7.06, 6.64, 4.57, 0.35376695, 0.14168473, 6.91, 0.062208217, -0.07377167,
+    7.14, 1.3588604, 0.28041536, 7.34, -0.27565715, 7.57, -0.057973024, -0.0024620057,
+    -19.09326, 6.91, 1.1, 0.99, 0.95, 0.91, -0.09965566, -0.001211964,
+    0.074292965, 1.06, -0.21365224, -0.062361814, 1.26, 1.18, 1.14, 0.05883586,
+    -0.016031075, 1.22, 0.08668881, 0.03380127, 1.54, 1.3, -0.11381989, -0.022113038,
+    6.83, 0.015420533, 0.09447276, 7.18, -1.986818, 7.26, 7.22, 0.051869202,
+    -0.004191081, -0.13225785, -18.977423, 7.1, 6.95, 0.99, 0.95, -0.1438797,
+    -0.06539854, 1.62, 0.011394749, 0.12124329, -0.47394943, 7.18, 7.14, 1.4557495,
+    0.48735008, 7.38, 7.3, -0.006552124, -0.04462395, -0.19593468, -18.367512, 6.95,
+    4.53, 4.49, -0.01367754, -0.6825806, 6.6, 0.18786915, 0.015917879, 7.18,
+    7.1, -0.13856773, -0.48701683, -18.7905, 0.021396637, -0.08932008, -17.897657, 7.1,
+    7.06, -0.0052853837, -0.3097744, 7.18, 0.51638514, 0.0020634334, -16.605732, 7.26,
+    -0.0005104065, -0.08250121, 1.58, 0.10447674, 0.000047426827, 0.03, -51.15694, 0.028114676,
+    0.0039914814, 0.07, -42.560875, -45.980717, -0.024278259, -0.035902157, -0.015765091, 0.56,
+    -22.656353, -40.02452, 0.23986761, 0.48, -23.477354, 0.009791381, -0.48209, -23.477354,
+    -0.8791224, -0.011212279, -22.377066, 0.10459279, 0.16383778, 0.59, -22.377066, -1.2686238,
+    -21.931791, -22.12889, -0.15353875, 0.09002588, -0.20891903, 1.06, -22.12889, 1.0556484,
+    -21.931791, -0.4193274, 0.009453595, -12.062972, -13.614294, -0.0008839657, -0.0312882, -11.773308,
+    0.08884474, 0.000058277732, -2.0923567, -2.4040701, -2.5247674, 4.57, 4.49, 2.33,
+    2.21, 0.000028966886, -0.20922342, -11.018427, -0.58956736, 0.39546934, -4.750224, -5.1183767,
+    -0.045706835, 0.62250704, -2.8076367, -0.6131729, 0.7451152, 4.89, -3.2152596, -5.878716,
+    -0.39064103, 0.071372405, 4.65, -0.12050076, 0.010127936, -3.7527802, 5.08, 0.15624197,
+    0.0003344336, -3.7061508, -0.18282434, -0.010392475, 4.21, 2.37, 1.88, 0.2000819,
+    2.29, -0.058384962, -0.22154541, 0.13151449, 4.61, -0.28514194, 5.08, 4.65,
+    0.043519463, -0.09286775, 5.2, 0.043657687, -0.024695588, 3.9, 2.37, 2.29,
+    -2.3197646, 1.88, -0.011510468, 0.11604004, -2.29015, -0.16645905, 0.0063779354, -2.3197646,
+    -0.022992453, -0.2562317, 3.44, -2.1466296, 3.24, 0.04628067, 0.16949655, 3.2,
+    0.1820933, 0.05906075, -2.2326505, 3.59, 0.2053769, 0.07826715, -2.1466296, 0.023253046,
+    -0.057904202, 4.25, -2.357731, 4.02, 0.15020426, 4.21, 0.0030313346, 0.12688772,
+    4.1, -2.2326505, 0.008990844, -0.072771646, -2.3197646, -0.17026275, -0.07680298, 4.49,
+    4.33, -2.3197646, 0.20376435, -0.03437109, -2.1208782, 0.18296324, -0.027881876, -2.196643,
+    5.08, 0.010588721, -0.09467903, 4.53, -0.27309418, -0.086941145, 1.88, -1.6592834,
+    0.20910683, -1.4217949, -1.4832442, 0.041241456, 0.008827972, 0.123096466, 2.98, -1.7983414,
+    2.4, 2.33, -1.9313097, -0.015958175, 0.093494035, -1.8541082, -0.1855011, -0.0015563965,
+    2.9, -1.8803589, 0.22667792, 0.10711473, -1.98534, 0.15998885, -0.03358032, 2.71,
+    -1.4832442, 2.09, 0.007659963, 0.10052069, -1.4536674, -0.17748737, 0.0011159878, -1.605014,
+    -1.7140237, -0.032451745, -0.11785195, 2.78, -0.03686965, 0.016266044, -0.54071695, -1.6287112,
+    4.41, -1.6592834, -0.01766778, -0.086317234, -2.068156, -0.2488356, 0.07594851, -1.605014,
+    4.36, 0.040284168, 0.1417306, 4.21, 0.001855812, -0.034320273, 4.49, 3.2,
+    -0.4176023, -0.030180061, -0.12471092, -0.48152414, -0.80898136, 0.026488876, -0.48152414, 0.061222333,
+    -0.006414032, -34.72578, -36.19027, 7.26, 7.14, 7.1, 1.73, -40.02452,
+    0.010178991, -0.040316205, 6.91, 0.14173421, -0.008057359, -51.15694, -0.024713134, -42.560875,
+    -0.1906901, -0.0822731, -37.815678, 7.22, -45.980717, 0.11221161, -0.00035018922, -45.980717,
+    -0.085989, 0.011027655, 0.25235063, -42.560875, 7.3, -0.01636467, -0.11834284, 7.34,
+    7.3, -0.029372407, 0.09403076, -40.02452, -0.12573433, -37.815678, 0.050074387, -0.051022846,
+    1.58, 0.12, 0.047000285, 1.46, 1.42, 0.16, -0.030676235, -0.0645284,
+    -0.212014, 0.061635714, 1.66, -0.2851719, 6.95, 6.91, 1.77, -0.04958725,
+    -0.17093125, 0.46953812, 7.18, 7.1, -0.089408495, -0.3370224, 7.22, -0.03759384,
+    -0.094497375, -32.61234, 0.16, -33.599087, -0.02232084, -0.036161877, 1.42, -33.599087,
+    1.38, 1.34, -0.00850296, 0.16752397, -0.35545808, 0.31375083, -33.599087, 1.46,
+    0.40394187, 1.54, -0.22989781, 0.113046885, 1.46, -0.6260914, 1.54, 0.64551127,
+    -0.12373225, 0.2, -31.608435, -0.033786103, -0.17941867, -30.874868, 0.23, 0.35089657,
+    1.54, 1.46, 0.06795502, -0.19291729, 1.62, 0.3576401, 0.006962433, 0.23,
+    -30.058292, -0.04730114, -0.12980093, -29.518152, 1.34, 0.27010396, -0.030651191, 0.27,
+    -0.08316219, 0.00017400335, -20.188913, -24.452414, -25.69593, -27.639406, -28.209562, 7.03,
+    -30.058292, -0.0028528755, 0.041010838, -28.786161, -0.009902868, -0.2412424, 7.06, 6.99,
+    -0.06863288, -0.58028746, 7.22, 0.36307782, 0.012915476, 7.1, 7.06, 6.95,
+    0.007935133, 0.2663913, -26.084858, -0.34175, -1.2269459, 7.14, 0.45345783, -27.161629,
+    -0.17123444, 0.12723978, 7.03, -25.265562, 6.99, 6.95, -0.09378192, 0.54049075,
+    -1.2350754, 6.99, 6.95, -0.008822824, -0.52524513, 0.66734874, -25.265562, 7.14,
+    0.6367325, 7.26, -0.5661845, 0.28074953, 7.14, -24.864492, -1.0095402, 0.54032385,
+    -24.864492, 0.3607957, -0.70815736, 7.03, 6.95, 0.48, -23.477354, 0.44,
+    -0.012837271, 0.15192877, -0.3977603, 0.71, -23.477354, -0.7384955, -0.008426814, 1.1,
+    0.05782581, -0.00014834282, -23.477354, 6.99, -0.46411324, -24.11707, -0.13122864, 1.4101955,
+    -21.12554, 6.99, -0.29090807, -1.0166105, 6.99, 0.135657, -0.07304001, 7.1,
+    -22.377066, -23.477354, 7.06, -0.8110156, 0.4187718, 1.2968581, -22.12889, 7.06,
+    0.9372627, -1.9810278, -20.516748, 0.08715597, 1.1975594, -24.11707, 7.26, 0.6543701,
+    -0.21912232, -23.178364, 7.22, -0.46471053, -0.023505675, -22.907703, 0.35267743, -0.015510946,
+    0.87, 0.75, -0.26873818, -20.089907, 0.83, 0.79, 0.06313407, -0.12794925,
+    0.17768434, 0.79, -19.876776, -19.982029, -0.13844174, 0.06386995, -0.3859005, -19.982029,
+    0.83, 0.001531705, 0.047208253, -19.876776, -0.10669372, -0.025378013, -20.089907, 7.1,
+    7.06, 0.95, 0.28976357, 6.91, -0.1405528, -0.61438245, 1.692096, 7.18,
+    -1.8418633, 0.11091589, -19.22157, 7.1, 7.06, 1.38, 0.0018176361, 0.06288051,
+    -0.9775807, 7.14, -19.539429, 0.40740567, 1.5062798, -19.668941, 0.14702585, -0.21734262,
+    -19.09326, 6.91, 1.1, -0.03994947, 0.028514598, 7.18, -1.7218592, -0.031059725,
+    -18.977423, 7.1, -0.011664391, 0.47913295, 1.1, -0.076790005, -0.00021462324, 9.96,
+    8.01, 7.14, 5.87, 5.83, -4.4179254, 4.53, -0.0027210359, 0.04823813,
+    5.24, 0.0017058864, -0.03298124, -6.653369, 0.35622898, -3.9679167, -0.03482029, 0.18627417,
+    -6.740236, 5.99, -7.20367, 0.3179664, 0.06323789, -18.7905, 0.021658298, -0.015565029,
+    -6.131815, 6.18, -0.20957701, -0.01333811, -5.842078, 0.073162675, -0.020728406, -7.9547505,
+    -18.7905, -19.668941, -20.516748, -0.006555652, 0.11391165, 7.18, -1.1372888, -0.04100299,
+    7.18, 0.76860946, -17.44737, -0.07463085, 0.0151234735, 7.97, 0.35619983, -7.832062,
+    -7.8932815, 0.011301677, -0.13386942, -7.667374, 0.1586504, 0.31672162, -7.3987164, 8.4,
+    -7.485508, -7.5297284, 8.13, -0.063166715, -0.018589899, 8.13, 0.036567036, 0.22883072,
+    8.13, 0.15027785, -7.444791, -0.43468985, -0.26077056, -8.113236, 0.14477845, -7.832062,
+    8.44, -0.077532806, -0.016094005, -7.722872, 0.021902766, -0.008895744, 8.17, 8.13,
+    -7.349471, 0.109316505, 0.25481102, -7.1555967, -7.2534256, 0.07419129, -0.012850952, -6.961682,
+    0.21095777, 0.08171489, 8.52, -6.8298554, 8.48, -0.045868095, 0.15899222, 8.28,
+    0.1848853, 0.025166973, -5.842078, -6.131815, 0.0007426658, -0.024328733, 8.83, 0.060433734,
+    -0.00096051116, -7.667374, -8.113236, -0.039836884, -7.832062, -7.8932815, -8.018251, 0.018892746,
+    -7.9547505, 0.00054016116, -0.0038017966, 0.08827842, -7.7751694, -0.0853597, -7.722872, 0.022607422,
+    -0.022321701, -7.5297284, -7.617456, 0.05566559, -7.5758924, 0.014682579, 0.034896296, 0.08329087,
+    0.56, -22.656353, 0.51, -22.907703, -23.178364, 0.48, -23.477354, 0.007940773,
+    -0.3276766, -23.477354, -0.6199011, 0.07278864, 0.2568159, -0.9050862, -22.907703, -0.7798096,
+    0.16492338, -22.377066, 0.0865085, 0.13495725, 0.59, -22.377066, -1.0980153, -21.931791,
+    -22.12889, -0.122699074, 0.07484131, -0.16861133, 1.3, -21.69312, 1.18, -21.931791,
+    -22.12889, 0.30997282, -0.09065349, 1.14, 0.27254683, 0.07110558, -22.656353, -24.864492,
+    0.17133942, 0.049767558, -22.12889, -0.023811493, -0.09834541, 0.63, -21.325644, -21.50634,
+    -0.043947186, -0.11317106, -0.5359304, -20.803585, 0.67, -0.02171311, 0.07327802, 0.71,
+    -0.1689698, -0.0010455858, 1.46, -20.803585, 1.38, -24.452414, -0.040380616, 0.07536017,
+    -25.69593, 0.0025528676, -0.080694266, 1.34, -20.402336, 0.06895714, -0.1223611, 1.38,
+    -0.13736878, -0.23791702, -23.477354, 1.5, -25.265562, -0.0035671478, 0.5601108, 1.58,
+    -0.090148985, -0.0062882244, 1.58, 1.5, -0.13991976, 0.19485705, -22.907703, 0.09424857,
+    -0.00019912513, -2.0923567, -2.4040701, -2.5247674, -3.593756, -3.6424093, -3.7061508, -3.7527802,
+    0.00042744484, -0.042184517, 4.73, -0.060216665, 0.05497576, 4.69, 2.21, -0.100361824,
+    -0.33376554, 4.89, 0.05529896, -0.1389365, 4.49, -3.0695794, 2.29, 0.11355662,
+    0.96742296, 2.29, -0.022509422, -0.52306354, 4.61, -3.1480272, -0.41005307, 0.14185016,
+    -2.907736, 0.018689899, -0.016260723, 4.21, 2.37, 1.88, 0.1732081, 2.29,
+    -0.04889908, -0.19953766, 0.10787218, 4.61, -0.2425911, 5.08, 5.0, -0.033730153,
+    -0.12999167, 5.2, 0.03576031, -0.016199367, 3.9, 2.37, 2.29, 2.09,
+    1.93, 0.047805957, -0.14483309, 2.17, 0.1284813, 0.008265686, -2.3197646, 2.33,
+    -0.023857499, -0.0063266754, -0.22226308, 3.44, -2.1466296, 0.134549, 3.24, 0.13555108,
+    0.038922884, -2.2326505, 3.78, 0.11550361, 0.03605447, -2.1466296, 0.018379344, -0.046892565,
+    4.25, -2.357731, 4.02, 0.12420197, 4.21, 0.0021656917, 0.104883686, 4.02,
+    -2.2326505, 0.01897456, -0.049685236, -2.1208782, -0.07332062, 0.0032670242, 4.41, 4.36,
+    -2.29015, 0.10517377, -0.0012279412, -2.2326505, 0.35816118, 0.18219581, -2.1208782, -2.1466296,
+    -0.027344218, 0.35901308, 4.45, -0.49512228, -0.063564606, 1.88, -1.6592834, 0.17751999,
+    -1.4217949, -1.4832442, 0.03696976, 0.0077980044, 0.11063919, 4.45, 4.41, 4.17,
+    -1.8541082, 3.06, 0.058609456, -0.028307507, -1.7429106, 0.025685197, -0.0007898084, -2.0137024,
+    -2.068156, 0.03533674, -0.1739658, -1.8803589, 0.060873445, -0.039752442, -1.9313097, -2.040998,
+    0.48487526, -1.960713, 0.068397306, 0.3258194, -1.8803589, -1.9079165, -0.03578415, -0.3482212,
+    -1.5751029, 0.094081454, -0.15380321, -2.068156, 4.49, -1.8443397, 0.06292664, -2.040998,
+    4.49, 0.9103905, -0.051511575, -1.9079165, -1.98534, -0.036255818, -0.4258661, -1.7983414,
+    0.5761823, 0.00016952862, 9.5, 9.38, 8.09, 7.14, 6.64, 6.57,
+    6.49, 0.0005041713, -0.037985463, -12.962669, 0.111888625, -0.054622192, -18.7905, -19.09326,
+    0.001350643, 0.37352726, 7.1, -0.026531849, -1.1987228, -7.667374, -10.19933, 7.61,
+    0.013090576, -0.04599806, 7.77, 0.19309108, 0.0018010179, 8.05, -7.5297284, 0.28888372,
+    0.13070135, -7.3014965, 0.04687205, 0.27901003, -7.349471, 8.13, -7.485508, -8.328821,
+    -0.1636378, -0.10451614, 0.12378254, -7.485508, -7.5758924, -0.018796755, 0.12654176, 8.48,
+    -0.19238114, 0.028938828, 8.17, 8.13, 0.18726431, -7.1555967, 0.03874817, 0.1595159,
+    -7.1032915, 8.4, -0.08622371, 0.017590513, 8.36, 0.0553209, -0.0018334268, -6.1628103,
+    9.42, -6.7036514, -6.910217, 0.15259959, -6.8701315, -0.06896057, -0.0028117588, -6.286212,
+    -6.417596, -0.10623536, -0.286238, -6.2222686, 0.028326694, -0.18081176, -6.7036514, -6.8701315,
+    9.46, 0.15355511, -0.011821817, -6.8298554, -0.33047593, -0.10874666, -6.2553506, -6.4785495,
+    0.05491022, -0.015119532, 0.1258495, -6.0520425, 9.42, -6.131815, 0.09055074, 0.22530141,
+    -6.131815, 0.029773965, -0.03380127, -0.1590683, -6.4524984, -6.910217, 9.69, 9.53,
+    -6.961682, -7.01124, -0.057211876, 0.0014385986, -0.1377833, -7.20367, -7.617456, 0.04483541,
+    -0.0340314, -7.1555967, 0.090802304, -0.022834493, -7.1555967, 9.84, -7.349471, -0.014937033,
+    0.0144312475, -7.5297284, -0.0006415193, 0.031134797, 9.73, -6.961682, 0.02256629, 0.11156412,
+    -7.054926, 0.09282782, -0.043575287, 9.69, 9.53, -6.511228, -6.5924907, -0.013521321,
+    0.06648189, -6.4785495, -0.1393811, 0.037002183, -6.740236, 9.57, -0.031295996, 0.020133821,
+    -6.7036514, 0.09977061, 0.031070372, 0.17979355, 9.53, 0.1166085, 0.032134246, -2.173437,
+    -2.4040701, -2.5247674, -2.8076367, -2.907736, 4.57, -3.0695794, -0.0021821898, -0.2589688,
+    4.85, 0.044603035, 0.0001149195, 5.2, 5.08, -0.039317634, -0.13005203, 5.48,
+    -0.0028556825, 0.08738079, 4.53, 4.49, 2.01, -0.07395537, 0.110000074, -2.7231896,
+    0.24992676, 1.1292156, 4.57, -0.43653947, 4.69, -0.07440983, 0.0030511513, 1.88,
+    0.15004629, 4.21, 2.37, 2.29, -0.040832903, -0.1796341, 0.08860542, 4.61,
+    -0.20627785, 4.65, 0.04155935, -0.04240244, 3.75, 2.13, 1.93, 1.85,
+    0.19306412, 1.88, -0.015337372, 0.08126678, -2.3197646, 0.030537162, -2.2551181, -0.1910762,
+    0.004490662, 3.59, -2.2551181, 2.17, 0.21235886, 0.00047073365, -2.2326505, 0.17532673,
+    0.092912704, -2.29015, 3.71, 0.038903046, 0.17110474, 3.67, 0.061881732, 0.010693359,
+    -2.29015, 5.12, 3.78, 0.16792603, 4.29, 0.015377551, 0.05796621, -0.09344243,
+    4.41, 4.36, 4.33, -0.036800344, 0.042684633, -2.2326505, 0.30436134, 0.116167605,
+    4.49, -2.2551181, 0.2411031, -0.67793006, 4.53, 0.17421761, -0.029248768, 4.53,
+    4.41, -2.1208782, 3.51, 2.37, -2.1466296, -0.16447626, -0.0016830445, -2.1466296,
+    0.10244354, 0.017279271, 4.36, -2.1466296, -0.03626625, -0.12169619, -2.1466296, 0.17540169,
+    0.021503067, -2.068156, 4.33, 3.4, 0.086293414, 0.010938504, -2.0923567, 0.17202716,
+    0.019499207, -2.040998, 3.17, 0.13312559, -0.10110104, 1.88, 0.12609929, -0.0018857996,
+    -2.1208782, 4.49, 4.45, 0.3039112, 1.0204941, -0.24324799, -2.068156, 4.45,
+    -2.0923567, -0.42917275, 0.30976984, -1.659956, -2.040998, 0.64223814, -1.5751029, 0.050928887,
+    -0.043464467, -2.1208782, -2.1466296, -0.059270173, -0.12108719, -2.068156, -2.0923567, -0.053474884,
+    0.052777708, 4.89, -0.07796521, -0.030810038, 1.06, 0.91, -19.76686, 0.87,
+    -20.516748, 0.71, -20.981464, 0.0037771158, -0.102392256, -20.803585, 0.5810224, 0.09245151,
+    0.75, -20.28955, -0.15528505, -0.04595795, -20.28955, 0.10846358, -0.025011906, -20.28955,
+    -0.07303963, -19.982029, 0.23560588, -19.876776, 0.03741741, 0.06672001, 0.87, -19.668941,
+    0.83, 0.0009699504, -0.10001627, -19.539429, 0.83, 0.004164429, 0.036204085, -19.428238,
+    -0.06567341, -0.024827957, -19.539429, -0.19116712, -19.330385, -19.428238, -0.030412674, 0.047549058,
+    -0.10333077, -19.539429, -19.668941, 0.99, -20.28955, -0.115361534, -19.876776, 0.21398953,
+    0.05493108, -20.28955, -20.652575, -0.12475739, 0.1560291, -19.76686, -0.11908405, 0.13234036,
+    0.95, 0.027975246, 1.03, 0.3973027, 0.080813095, 0.95, -19.330385, -0.17284183,
+    -19.09326, -19.22157, 0.09668455, 0.0054283836, -0.12124443, -19.330385, 0.99, -19.428238,
+    0.032376863, -0.038927715, 1.03, 0.12104409, 0.22604828, 1.03, -19.22157, -0.12877613,
+    -0.019537544, -19.22157, 0.08653761, -0.03378498, -19.539429, -20.188913, -20.516748, -20.652575,
+    -20.803585, -20.981464, -0.0013402486, -0.091260545, 1.66, 0.031751573, 0.24616592, 7.14,
+    7.1, -0.09238498, 0.8909607, 7.22, -1.8150753, 0.2045515, 7.14, 7.1,
+    7.03, -0.0029767654, 1.0754677, -1.9590572, 7.22, 0.9831694, 7.26, 0.24857636,
+    -0.059737504, 7.14, 7.06, 6.99, -19.668941, -0.046911515, 0.07509181, -0.52265227,
+    -19.76686, -20.089907, 1.5205513, 0.40420896, -0.9715225, 7.18, -20.089907, -1.6704117,
+    -19.668941, 0.3682901, -1.4660496, 7.26, -19.76686, 0.09097538, 0.2881672, 7.46,
+    -0.12019874, 0.079179384, -19.22157, 7.1, 7.03, 1.85, 1.66, 0.022898102,
+    -0.11581536, 4.57, 0.5045128, 0.030817008, 7.06, -0.09535485, -0.4268368, 7.18,
+    7.14, 1.2768348, 0.3217163, -19.330385, 7.22, -0.0021443686, -0.24642976, 7.22,
+    0.2015091, -0.019877879, -19.09326, 6.91, 1.1, -0.04346018, 1.26, 0.0406167,
+    -0.016231308, 7.18, -1.4189115, 7.26, 0.029466247, -0.11313172, -18.977423, 7.1,
+    6.95, 0.016192487, -0.46490365, 7.18, 0.89790773, -0.17887841, -18.367512, 6.95,
+    0.021589344, -0.10963239, -17.897657, 0.033489387, -0.000043276643, 0.2, -31.608435, 0.16,
+    -40.02452, 0.07, 0.03, -51.15694, 0.019640815, 0.00044572013, -42.560875, -0.028906468,
+    -0.01563866, 0.19351003, -36.19027, -37.815678, -0.026349057, -0.036252562, 0.12, 0.037362617,
+    -33.599087, -0.022471588, -0.030205864, -32.61234, 0.2076112, -0.028182706, -0.14617556, 0.48,
+    -30.874868, 0.28566858, -23.477354, -24.11707, 0.44, -24.452414, -0.008230227, 0.11892017,
+    -0.46448693, 0.44, -0.66335756, 0.19552772, -0.2707754, 0.59, -23.477354, -0.5211212,
+    0.56, -22.656353, 0.51, 0.03052106, -0.06264121, -22.377066, 0.06931552, 0.108988486,
+    -22.377066, -0.9519501, -21.931791, -0.0025746345, -0.13816255, 1.06, -22.12889, 0.9199287,
+    -21.931791, -0.33638427, -21.69312, 0.2241654, 0.0022490597, -12.062972, 7.42, -12.655651,
+    0.000797939, -0.06070375, 7.57, -0.04343606, 0.0016639993, -11.26825, 6.53, 0.16742748,
+    0.005517901, -11.018427, -0.068207316, 0.00011795482, -0.07408267, -0.3603938, -0.5968429, -0.7202588,
+    -0.771789, -0.82226276, -0.8777573, 0.00003382232, -0.035103492, 2.4, 0.32544112, -0.021130627,
+    2.29, 2.05, 0.03729767, -0.5308921, 2.33, 0.8312275, -0.041313853, 2.48,
+    2.17, 2.13, -0.081513844, -0.4595304, 2.25, 0.45008445, 0.16049805, 2.52,
+    -0.6559018, -0.7616125, -0.25973454, 2.55, 0.17576809, 0.0015767887, 2.37, 2.29,
+    2.13, 2.05, -0.03304693, -0.3096783, -0.4176023, 0.0322376, 0.18164292, -0.39199698,
+    2.4, -0.48152414, 0.768891, -0.4176023, -0.10625855, 0.27778703, -0.48152414, 2.52,
+    -0.16847828, 0.0064451597, 2.63, 0.084373854, -0.011896602, 2.9, 2.21, -0.30146822,
+    2.17, 2.13, -0.042231243, 0.18425941, 0.60091513, 2.17, 2.09, 0.0060382476,
+    0.1279972, -0.10486277, -0.12236657, 0.037932128, 2.33, -0.24307282, 2.25, 0.5387858,
+    -0.1923442, 2.25, -0.24450207, -0.021286061, 2.37, -0.24307282, 0.54392636, 0.07659995,
+    -0.24307282, -0.057190984, 0.029742286, -0.10874134, 2.05, -0.058459997, 0.027144877, 2.01,
+    0.024480438, 0.12305298, 2.63, 2.48, 2.09, -0.058459997, 0.040513992, -0.020295715,
+    2.21, 2.17, -0.031630885, -0.06720642, 2.29, 0.014417394, -0.0281625, 2.55,
+    2.52, -0.058459997, -0.007965851, 0.025648195, 0.068114474, 2.59, -0.058459997, 0.0026116944,
+    -0.001248169, -0.010472524, -0.058459997, 2.71, -0.051289976, 2.74, 0.08823853, 2.78,
+    -0.03905792, 0.005426407, 2.67, -0.015062257, -0.061674196, 9.96, 8.09, 7.14,
+    6.64, 6.57, 6.49, 6.45, -0.00014362085, 0.07007625, -11.515594, -0.09085943,
+    0.08658835, -9.684118, -14.995561, 0.12163621, 0.015565817, -9.193894, -0.06033249, -0.22635232,
+    -18.7905, -19.09326, 6.72, 0.17071958, -0.008157219, 7.1, -0.14266612, 1.9802595,
+    7.1, 7.06, -0.014552488, -0.32403576, -17.897657, -0.4811081, -1.5059047, -8.85124,
+    7.77, -10.396682, 7.61, 0.012597322, -0.047078423, 7.65, 0.40523252, 0.09980694,
+    7.93, -11.26825, 0.018789792, -0.08313846, -9.847813, 0.07594243, -0.06206463, 7.93,
+    -8.453863, 7.85, 0.2617907, -0.05113351, -8.21763, 0.21110335, 0.4085415, -8.718564,
+    8.05, 0.33116683, 0.010716757, -8.113236, -0.12652278, 0.06218738, -9.193894, -9.684118,
+    8.13, -0.07095363, -9.847813, 0.050452422, -0.0024571738, -9.349648, -0.16020782, 8.13,
+    -0.098545335, 8.17, 0.025363732, -0.08266926, -7.3987164, 8.13, -7.485508, -9.029197,
+    0.055889387, -0.1164153, 0.08975307, -8.718564, 8.17, 0.16943794, 0.02520508, -8.577097,
+    -0.11662952, -0.012054025, 8.2, -7.1555967, 8.17, 0.085616484, -0.09404885, -7.01124,
+    0.10217804, 0.16746311, -6.7036514, 8.83, -0.030391796, 0.0056964355, 8.36, 0.08703787,
+    0.0013378148, -7.667374, -8.113236, -0.033166252, -7.832062, -7.8932815, -8.018251, 0.015525437,
+    -7.9547505, 0.00047466575, -0.0030763107, 0.073176794, -7.7751694, -0.07395325, -7.722872, 0.018621827,
+    -0.018192673, -7.5297284, -7.617456, 0.045959093, -7.5758924, 0.012148476, 0.028587481, 0.06606064,
+    9.5, 8.68, 8.64, 7.14, 6.41, -7.8932815, 2.13, -0.0015170249,
+    0.057806503, -7.832062, -0.29882607, -0.0006288069, -13.614294, 6.6, 0.092208214, -0.0015013017,
+    -11.773308, -0.121169046, -0.01118242, -18.7905, -20.188913, -20.516748, -0.009128097, 0.30256253,
+    7.18, -0.6939415, -0.021352582, 7.18, 0.6298352, 7.42, 0.046701398, 0.000898834,
+    -6.961682, -7.20367, -0.041703288, -0.1262594, -6.286212, -6.7036514, -6.7859416, 0.0547301,
+    -0.09740525, -6.417596, 0.24018335, 0.111686625, -6.0520425, -6.1628103, -0.0062329103, -0.21656494,
+    -5.842078, 0.02425668, 0.119004145, 8.76, -6.0203667, -6.653369, -0.15330012, -6.2222686,
+    -6.286212, -0.084934235, 0.10865132, -6.0905485, -0.19603373, -0.07630734, -5.987348, 0.1308435,
+    -5.7152433, -5.784454, 0.025570327, -0.054133482, 0.081021935, -5.5945034, -6.2222686, 8.99,
+    -6.2553506, 0.057651784, 0.21031018, -6.2553506, -0.021367356, 0.06350243, -6.1923833, 9.42,
+    -0.1355245, 0.05274536, 9.07, -0.03125916, 0.016435442, 8.91, 8.83, 0.16886596,
+    8.87, 0.030351767, 0.093625486, -5.5490093, 8.99, -0.045826625, 0.04051768, 0.099593244,
+    -6.4524984, -6.910217, 9.69, 9.53, -6.961682, -7.01124, -0.049518015, 0.00026123048,
+    -0.120201625, -7.20367, -7.349471, -0.003922272, -0.039168302, -7.1555967, 0.0727476, -0.019489817,
+    -7.1555967, 9.73, -7.617456, 0.09689662, -0.033291306, -7.2534256, 0.0023759182, 0.03267172,
+    9.77, -6.961682, 0.025150275, 0.09590047, 0.089514926, 9.69, 9.53, -6.7859416,
+    0.033092845, -6.618714, -0.07202827, -0.0026313781, -6.511228, 9.57, -0.003368945, 0.025860265,
+    -6.4785495, 0.10839844, 0.026171112, 0.16122285, 0.0919927, -34.72578, -36.19027, 7.26,
+    7.18, 7.1, 7.03, 6.99, 0.0024047762, -0.10903549, -37.815678, 0.08055549,
+    -0.06798039, 7.14, -51.15694, -0.021961594, -0.12878673, -37.815678, -0.010140556, 0.12358246,
+    7.22, -37.815678, -42.560875, 0.17106171, -0.012434006, 0.20570412, -45.980717, -0.07677498,
+    -42.560875, 0.0314394, -0.021488953, -42.560875, 7.3, -0.014112854, -0.10174332, 7.34,
+    7.3, -0.02463557, 0.085242845, -40.02452, -0.11254539, -37.815678, 0.045682143, -0.043399557,
+    1.58, 1.46, 1.42, 0.12, 0.030726625, 0.16, -0.021152774, -0.05220235,
+    -0.19016801, 1.5, 0.028476907, 0.08048909, 1.73, -0.22524033, 6.95, 6.91,
+    1.77, 0.0214859, -0.15426254, 0.42216036, 7.06, 7.03, -0.06919251, -0.36042175,
+    7.1, 0.2713913, -0.13905609, -33.599087, 1.54, 1.46, 1.42, 1.38,
+    1.34, -0.014005388, 0.15570985, -0.31926727, 0.350943, 1.5, -0.07470296, -0.21521759,
+    1.62, 1.58, 0.06808065, 0.58415526, 7.1, 1.69, 1.66, 0.09248098,
+    -0.4457077, 6.95, 0.07550337, -0.06150716, 7.3, 7.14, 0.06814995, 0.32211214,
+    7.34, -0.0044166567, -0.07667974, 0.2, -31.608435, -32.61234, 0.16, -0.02414231,
+    0.16935806, -0.022401012, -0.118022375, -30.874868, 1.42, -32.61234, 0.38735554, -31.608435,
+    -0.16071726, 0.22877322, 1.5, -31.608435, -0.089796886, -0.2808524, 1.62, 0.17456482,
+    -0.024162762, 0.23, -30.058292, -0.037164122, -0.11313515, -29.518152, 1.34, 0.21377419,
+    -0.024675375, 0.27, -0.07448005, 0.00014914694, -26.084858, -26.572838, 7.14, 7.03,
+    6.95, -28.209562, 1.73, 0.0006686275, 0.059798658, 6.88, -0.010136844, -0.52827966,
+    -28.786161, -29.518152, -0.018175812, -0.24415791, 6.99, 0.4360384, 0.038279448, -27.161629,
+    -37.815678, 7.1, 0.065451436, -0.097637616, -28.209562, -0.12463118, 0.058609433, -0.32081482,
+    -27.161629, -28.786161, 7.22, -34.72578, 0.040630553, 0.15992734, -31.608435, -0.0035759646,
+    -0.06215423, 7.3, 7.26, -0.108242035, -0.42824897, 7.42, 0.17617814, 0.027342224,
+    7.3, 0.44530335, 7.34, -0.029610826, -0.12765326, 7.14, 6.95, 6.88,
+    0.35, 0.019884959, 0.4, 0.8688637, 0.081894755, -0.33431816, 7.1, 7.06,
+    0.24749528, 0.022489358, 0.32407913, 7.26, -0.29265627, 0.13427277, 0.35, -0.5048947,
+    0.44, -24.11707, -24.452414, -25.69593, 0.07321002, -25.265562, -0.10812533, -0.029172227,
+    0.09637182, -0.55698365, 0.48, -24.11707, -0.38460717, -23.477354, 0.15745078, -0.2231308,
+    -23.477354, 0.51, -0.43750486, 1.5, 0.06961184, -0.048307262, -22.907703, 6.99,
+    -0.005155792, 0.20277324, 0.51, -0.7594996, 0.00027874735, 1.14, -18.7905, 0.91,
+    -19.76686, 0.83, -20.28955, 0.79, 0.0016535603, 0.4142022, -20.188913, -0.11775166,
+    -0.03707979, -20.28955, 0.87, -0.26313135, -0.062242128, -20.089907, 0.2729861, 0.019181302,
+    0.87, -19.668941, 0.83, 0.00063362124, -0.08242188, -19.539429, 0.023071242, -0.048443113,
+    -19.539429, -0.15525614, -19.330385, 0.018268226, -0.08491974, -19.539429, 0.99, -20.28955,
+    -0.09503954, -19.982029, 0.1959015, 0.101795964, -20.402336, 1.03, -0.058889605, 0.07104307,
+    -19.76686, -0.06386616, 0.07942257, 1.03, -18.977423, 0.95, -0.04739685, -0.0016395781,
+    0.99, -0.0025445556, -0.11646097, -19.330385, 1.1, 0.15812106, -0.28584653, -19.22157,
+    0.12890244, 0.013610992, 1.1, -0.13197099, -0.05916481, 1.18, -21.69312, -22.377066,
+    0.19873123, -22.12889, -0.06746094, -21.931791, 0.20229125, 0.06088829, -20.981464, -0.30924416,
+    -19.668941, -20.402336, -20.803585, 0.095411174, -0.017792089, -20.089907, -0.27019837, -0.0789082,
+    -19.330385, -19.428238, 0.014271736, 0.27642652, -18.977423, -0.076582335, 0.021348698, 1.22,
+    -19.428238, -19.76686, -19.982029, -21.325644, 0.067461856, 0.015466042, -0.092260234, 0.16950554,
+    -19.22157, -19.330385, -0.04915377, -0.19187622, -18.977423, -19.09326, 0.06423092, 0.2253001,
+    -0.10787537, 1.46, -20.803585, 1.38, -40.02452, 0.145047, 0.01478661, -28.786161,
+    0.012785057, -0.05812032, 1.34, -20.402336, 0.017335376, -0.055064697, 1.38, -0.10692455,
+    -0.20049806, 1.5, -21.325644, -22.12889, 0.05454749, -1.1963114, 1.0052766, -22.12889,
+    -22.377066, -0.0057264217, -0.23560321, -21.931791, 0.3094679, 0.00014839556, 0.56, -22.656353,
+    0.51, -22.907703, -23.178364, -26.084858, 0.35, 0.004204619, 0.78181154, 0.35,
+    -0.42940828, -0.004178886, 0.20231755, -0.6331918, -22.907703, -0.6296034, 0.14465128, -22.377066,
+    0.055843275, 0.088316515, 0.59, -22.377066, -0.82508343, -22.12889, -0.099767976, -21.931791,
+    0.06039502, -0.11291561, 1.06, -22.12889, 0.82789004, -21.931791, -0.28263488, -21.69312,
+    0.63, 0.1264287, 0.58740157, 0.63, -0.08286663, 0.006373574, 2.44, -0.3603938,
+    2.05, -10.19933, -0.0074197613, 0.019474078, -8.21763, -0.3304929, -0.02514941, -0.30146822,
+    2.13, -0.03469001, 0.3047169, 2.17, 0.042609364, -0.029125476, 2.71, -1.6592834,
+    2.67, 0.24703808, 0.090045676, -1.362035, 0.05869603, 0.0010867435, -0.54071695, -40.02452,
+    -0.029153675, 0.00029210345, 3.02, -0.011160183, -0.07653131, -7.485508, -7.667374, 8.01,
+    -8.718564, -9.193894, 7.73, -10.025825, 0.0010006109, 0.055416733, 7.93, -0.0486545,
+    0.035109874, 6.49, 6.22, 0.009201693, -0.18606453, 6.53, 0.7991435, 0.015318013,
+    6.1, 2.13, 2.09, 0.034842666, -0.25300446, 4.49, 1.5880784, 0.12653789,
+    6.34, -8.577097, 0.13035575, -0.11402055, 7.93, 0.08194571, -0.043190684, 8.13,
+    -8.018251, 8.09, -8.328821, -0.018741515, 0.056372393, -8.113236, -0.10430094, 0.082538866,
+    -7.9547505, -0.16217689, -7.7751694, -0.05717917, -0.12664254, -9.029197, 8.17, -9.349648,
+    -0.04058094, 0.02318751, 8.2, -0.13696976, -0.06361019, -8.718564, 8.2, 0.15119587,
+    0.038578987, -8.577097, -0.09529828, -0.0031885353, 4.53, -7.617456, 1.8623364, 2.17,
+    -7.5758924, -0.18813376, 2.09, 0.07518206, -0.12929153, 0.41798362, 4.57, -0.7316502,
+    6.06, -7.5297284, 0.23494382, 6.02, 0.12480011, -0.13948517, 6.26, -7.617456,
+    -0.17041449, -0.0074042096, 8.05, 0.11480477, 0.0032549065, -7.3987164, 4.53, 2.13,
+    1.81, -0.16847229, 1.88, -7.444791, 0.091724396, -0.06295776, 1.97, 0.15861015,
+    0.014845276, -1.618288, 4.57, 1.5214967, 5.95, 0.3238139, 8.44, 8.13,
+    -0.042214368, -0.24776705, 9.92, -0.0044312705, 0.108953856, 1.77, -7.054926, -7.3014965,
+    0.2115387, 1.73, -0.030239105, -7.20367, -0.058068085, -0.25806808, -5.5945034, -6.131815,
+    -6.3148303, 0.05530701, 0.25244218, -6.0520425, -0.09448242, 0.007933553, 0.18821208, 6.3,
+    5.95, -7.3014965, 0.3155583, -7.054926, -0.13652818, 0.0004957028, -6.389413, 6.26,
+    -0.11625053, 0.066645466, 6.06, -0.031913247, 0.013196982, 8.2, -6.7036514, -6.961682,
+    0.06677498, 0.18987726, -5.987348, -0.050214984, 0.048100792, -6.286212, -6.3148303, -0.0020170659,
+    -0.04948437, 8.6, 0.06436633, -0.0010674775, -5.784454, -5.813874, -6.1923833, -6.2222686,
+    8.76, 8.56, -6.2553506, 0.000545606, -0.1346731, 8.6, -0.117684506, -0.0138333365,
+    8.91, -6.511228, 0.013366088, 0.11052531, -6.2553506, -0.0014225986, 0.051237274, 1.85,
+    -0.28737745, 5.83, 1.93, 0.07226906, 0.2649025, 6.41, -0.15588371, -0.058303695,
+    8.6, -6.0905485, 5.79, 4.53, 0.019180425, 0.56972307, 8.56, 0.04724376,
+    0.24148682, 4.61, 2.13, -0.08224457, -0.4398098, 5.72, 0.3378665, 0.034991298,
+    9.3, -6.131815, 9.14, 0.008362311, 0.18107414, -6.0905485, -0.2085445, -0.021621063,
+    -6.0520425, 9.38, -0.11230949, 0.10160493, 9.38, 0.12685551, -0.14494018, 4.49,
+    -0.33260384, 8.95, 8.72, 5.72, 0.2050771, 5.99, 0.011914317, 0.09263756,
+    0.1722744, 9.07, -0.14386068, 9.1, 0.020652466, 9.18, 0.2311025, 0.07758164,
+    5.67, -5.5490093, 2.17, 2.01, -5.750133, -0.13019614, -5.682901, 0.08351517,
+    -0.044049263, -5.750133, 0.1251049, 2.05, -0.0548954, 0.059902955, 4.57, -5.6420994,
+    -5.682901, 0.5670967, -0.25028917, 1.1580803, -5.6420994, 0.19901104, 5.63, 0.10081762,
+    -0.004327901, 1.81, -4.0418863, 1.77, -5.4127874, 0.24216615, 0.09134614, -5.4127874,
+    -0.054035444, 0.025186593, 0.23417282, -5.4127874, 4.53, 2.17, -0.12019751, -0.97709465,
+    5.6, 0.39428237, 0.117034234, -5.254704, 4.57, -0.62463534, 0.14423874, -4.750224,
+    0.041514117, -0.0011239952, 5.79, 5.75, 5.72, -5.254704, -5.5490093, -0.04650907,
+    0.10028701, -5.1183767, -0.26429567, -0.07662639, -5.254704, -5.5490093, -0.23674896, -0.061446536,
+    -5.004444, -0.0034662883, 0.08537426, -4.2262564, -0.15946855, -3.5361924, -4.127986, 0.0077127456,
+    -0.062328424, 0.072880365, -4.2262564, 5.91, -5.004444, 5.87, -0.080108464, -0.19196168,
+    -4.894484, 0.05384742, -0.011360086, -5.4127874, -5.5490093, -0.0068646297, -0.09689579, -5.004444,
+    0.07562687, -0.026310131, -3.9679167, 5.87, -4.0418863, 0.031153236, -0.049913216, -4.0418863,
+    0.032682884, 0.10430222, 5.87, -3.8215072, 0.18839544, 0.06801827, 5.91, -0.03509884,
+    0.08017464, 0.2, -31.608435, 0.16, -40.02452, 0.07, 0.03, -51.15694,
+    0.014055649, -0.0012793405, -42.560875, -0.024975305, -0.014343843, 0.15671693, -36.19027, -37.815678,
+    -0.0229509, -0.031009177, 0.12, 0.02352175, -33.599087, -0.015963841, -0.02108038, -32.61234,
+    0.13640551, -0.019621508, -0.0970786, 0.4, -24.864492, -25.265562, -30.874868, 0.1901722,
+    -25.69593, 0.35, 0.0012962057, 0.11326908, -0.0869864, 0.1542374, -0.8002152, 0.44,
+    -24.864492, -0.5232158, -24.11707, -24.452414, 0.05727288, 0.07805689, -0.46770936, 0.48,
+    -24.11707, -0.31850675, -23.477354, 0.12674698, -0.1839116, 0.63, -23.477354, -0.36734742,
+    -21.325644, 0.000017087323, -0.45432687, 1.06, -21.69312, 0.52850646, 0.0047919084, 1.46,
+    -0.0064942143, 0.00015585178, 4.73, 4.49, 4.41, -30.058292, 1.62, -30.874868,
+    1.54, -0.0022356068, 0.1068624, 1.58, 0.0019590724, -0.6570889, -40.02452, -42.560875,
+    -0.09700864, 0.11943447, 1.69, -0.32049683, -0.001655655, -29.518152, 0.23, -0.09411042,
+    0.27, 0.196521, 0.027561856, 0.27, -28.786161, 0.013067442, -0.18200172, -28.209562,
+    0.1125494, -0.00020743572, -3.0695794, -3.4047515, -8.577097, -11.018427, -0.51537555, 1.2833288,
+    -5.004444, -0.49094567, 0.20248699, 1.0116147, -2.9810855, -0.86290514, -2.2326505, -2.2551181,
+    0.09818551, -0.5762001, -2.1208782, 0.5740817, -0.0040722163, -16.183819, -17.44737, 4.53,
+    -18.367512, -0.61750835, -17.897657, 0.62878954, -0.1797184, 0.44795534, -1.1127164, -14.294952,
+    1.2119042, -13.286145, -13.937053, -0.28260309, -1.2390759, -12.062972, 4.53, 1.0243291,
+    0.11076456, -8.453863, -0.40970936, -0.013787873, 4.85, -3.5361924, 4.77, -3.6424093,
+    -3.7061508, 0.07701035, 0.17603531, -3.593756, 0.023992157, 0.116611734, 4.81, -3.6424093,
+    0.24482727, 0.119989395, -3.7061508, 0.07086086, 0.1503994, -2.196643, -2.2326505, -3.3498714,
+    -3.4047515, 0.034128513, -0.057077564, -3.1480272, 0.12766956, 0.013646761, 0.1963171, -0.05773727,
+    -3.7527802, 5.04, -3.8950949, 0.2772783, 4.97, 4.93, 0.13176407, 0.21408139,
+    5.0, 0.01693268, 0.039879035, 5.24, -3.9679167, -4.0418863, 0.1615612, 0.056491088,
+    5.08, -0.02261856, -0.12284968, -4.524055, 5.55, 0.10192903, 0.00010033733, 5.79,
+    -0.04316488, 0.020116363, -3.7061508, 5.55, 4.97, 4.89, -0.048908487, 0.03977127,
+    5.32, -0.22385035, -0.1179403, 5.75, 5.6, 0.082178496, 0.030408327, 5.79,
+    -0.119529344, 0.01861229, 5.08, -3.4047515, -3.6424093, 0.069662474, 0.0026791056, -3.3498714,
+    -0.13613139, -0.028525291, -3.2152596, 5.12, 0.1355833, -0.03983904, -2.9810855, 0.08121594,
+    -0.000724798, -5.784454, -5.813874, -6.1923833, -6.2222686, -6.3485193, -6.4785495, -6.5553975,
+    0.00017342702, 0.01865934, 4.53, 0.27595672, -0.026584653, 5.79, 4.53, -0.06400414,
+    0.5601399, 6.02, -0.37421188, 0.025222896, 6.1, 1.85, -0.24905346, 5.79,
+    0.22868024, 0.047195107, 6.41, -0.29863557, 8.68, 0.038247593, -0.086948596, 8.6,
+    -6.0905485, 5.79, 4.53, 0.016444905, 0.4724095, 8.56, 0.037934616, 0.20280853,
+    4.61, 2.13, -0.06743126, -0.37179318, 5.72, 0.2758779, 0.02799894, 9.34,
+    -6.131815, 9.3, 0.03932494, -0.21264496, -6.0905485, -0.16058043, -0.013555688, -6.0905485,
+    9.38, -0.072334506, 0.052226674, -5.987348, 0.14238809, 0.053177834, 4.49, -0.25026473,
+    8.95, 8.8, 5.72, 0.17769979, 5.99, 0.009750959, 0.08953643, 8.91,
+    0.2068039, 0.062371828, 9.07, -0.117533244, 9.1, 0.01730713, 9.18, 0.19254355,
+    0.06357133, 5.48, -5.5490093, 2.17, 2.01, -5.750133, -0.11282959, -5.682901,
+    0.07516861, -0.037434198, -5.750133, 0.11259957, 2.05, -0.049400713, 0.053917695, -5.6420994,
+    -5.682901, 0.4840767, -0.22389679, 1.0436356, -5.254704, 2.21, 1.77, -5.4127874,
+    0.21795502, 0.004637909, -5.4127874, -0.093061745, 0.08273381, -5.4127874, 4.53, -0.8780224,
+    0.35615265, -1.7319758, -4.2262564, 4.53, 4.49, -0.02686919, -1.1106293, 5.28,
+    0.21496952, 0.033767413, 5.2, -4.127986, -0.18863815, 0.0015430881, -3.2152596, -0.056259908,
+    0.022632211, -4.0418863, -5.1183767, 5.6, 5.55, 0.24288265, -5.254704, 0.19213687,
+    0.01283613, 5.91, 5.72, 0.0033659872, -0.10923678, -5.4127874, -0.010498883, 0.07459024,
+    5.63, -4.524055, 5.55, -0.03126916, -0.085197136, -4.2262564, -0.17098506, -0.05526949,
+    -4.750224, -4.894484, -0.028211588, -0.09110327, -4.524055, 0.029862836, -0.027712835, 5.55,
+    -3.3498714, -3.7527802, 5.52, -0.10412254, 0.024149869, -3.7061508, -0.18599167, -0.060115952,
+    5.52, 0.13505682, -3.1480272, 0.02048931, -0.026072947, -3.4047515, 5.67, -3.5361924,
+    0.08471746, 0.17821833, 5.72, -0.041139122, 0.0570555, -3.2776601, 5.63, 0.054050636,
+    -0.06394654, -3.1480272, -0.13061027, 0.022024537, 4.69, 4.49, 4.29, 4.14,
+    -30.058292, 1.62, -30.874868, 0.004998583, -0.04609255, -33.599087, -0.051576447, -0.2532535,
+    -29.518152, 0.23, -0.07688866, 0.0811336, 0.27, -0.050049823, 0.0010070371, -1.6862178,
+    -1.7140237, -2.357731, 0.040259916, -0.04317185, -0.24199231, -1.362035, 4.17, 0.05976146,
+    0.013646054, -1.2995658, -0.0033361309, -0.028224945, -3.0695794, -3.4047515, -8.577097, -11.018427,
+    -0.44668147, 1.1121954, -5.004444, -0.39719686, 0.1733036, 0.8596417, -2.9810855, -0.7767693,
+    -1.7983414, -2.1208782, 0.073100306, 0.023931485, -1.1948682, -0.04111004, 0.052570265, -16.183819,
+    -17.44737, 4.53, -18.367512, -0.5557747, -17.897657, 0.5658936, -0.16176377, 0.40314254,
+    -0.9643771, -14.294952, -14.995561, 0.26331368, 1.3121277, -13.286145, -13.937053, -0.2543598,
+    -1.1151856, -12.962669, 1.1379937, -8.453863, -0.19161002, -0.018074395, 4.85, -3.5361924,
+    4.73, -3.7061508, -3.7527802, -0.01966451, 0.20575981, -3.6424093, -0.1022171, -3.593756,
+    0.011340332, -0.059848785, -3.6424093, -3.7061508, 4.81, 0.11960647, 0.058190346, 0.24876647,
+    -3.593756, 4.77, 0.019736227, 0.07164345, 0.13199972, -2.196643, -2.4040701, -2.907736,
+    -3.3498714, -0.007547118, 0.057392534, -2.7231896, 0.0031848364, -0.029047756, 4.73, -2.3197646,
+    0.08681885, -0.06650467, -2.2326505, 0.06273097, 0.166638, -2.173437, -0.031855606, -0.05582706,
+    -3.7527802, 5.04, -3.8950949, 0.22771099, 4.97, 4.93, 0.10776856, 0.17634754,
+    5.0, 0.013766262, 0.03263054, 5.48, -4.894484, 0.3013589, -4.0418863, 0.040548082,
+    -0.051339347, -5.1183767, 5.6, 0.15241821, 0.000701223, -3.9679167, -0.035084456, 0.060481377,
+    -3.7061508, 5.55, 4.97, 4.89, -0.041013338, 0.035639953, 5.32, -0.17999922,
+    -0.07880058, 5.75, 5.6, 0.065488815, 0.014201355, 5.79, -0.11328202, 0.011045456,
+    -2.357731, -3.593756, -3.6424093, 0.01837713, -0.096839465, 5.08, -0.015344095, 0.01099542,
+    4.97, -2.2551181, 0.027874826, -0.047320228, -0.06654366, -2.173437, -2.4040701, -3.2776601,
+    -3.3498714, -3.4047515, -3.4696734, -3.6424093, 0.00042154125, -0.017969351, 4.61, -0.15776384,
+    0.077523805, 4.49, 2.21, 0.0003944397, 0.5787644, 4.61, -0.20181504, -0.073081665,
+    4.57, 4.49, 2.29, 0.03364746, 0.30274963, -0.808225, 4.65, 0.34691772,
+    5.52, 0.103745595, 0.02153225, 5.12, -2.9810855, 2.13, 1.85, 0.053853225,
+    0.28147376, 4.61, -0.28715166, -0.028622556, 4.53, 4.49, -0.009894416, 0.5146591,
+    4.57, -0.33878276, -0.007847573, -3.2152596, 5.6, 5.2, -0.030125124, -0.15969367,
+    5.63, 0.062784195, -0.06678448, 5.32, -2.9810855, 0.12542231, 0.029291226, -2.8076367,
+    0.009240734, -0.079015665, 3.75, 2.13, 1.93, 1.85, 0.1716324, 1.88,
+    -0.015929414, 0.071014404, -2.3197646, 0.026605988, -2.2551181, -0.16033554, 0.001915741, 3.59,
+    2.17, 0.19345932, -2.2551181, 0.0034105938, 0.09379106, -2.29015, 3.71, 0.03480606,
+    0.14339721, 3.67, 0.049891185, 0.008251555, -2.29015, 4.02, 3.78, 0.14242744,
+    3.86, -0.009364472, 0.07654937, 4.21, 4.1, 0.029247088, -0.06823136, 5.12,
+    0.039441682, -0.068326674, 4.1, 3.98, -2.2326505, 0.00898869, -0.0450669, 4.06,
+    -0.11587252, -0.031964492, 4.41, 4.36, -0.0071750716, 0.17736435, 4.49, -0.24100292,
+    -0.012111133, 1.88, -2.1466296, 1.85, -0.038455963, 0.05271683, -1.6592834, 0.12871324,
+    -1.4217949, -1.4832442, 0.018486787, -0.007767487, 0.084789276, 2.09, -0.18892978, 2.01,
+    -2.1466296, -0.17568131, -1.5448009, 0.05096606, -0.033481147, -0.8777573, -1.5448009, -0.15623665,
+    0.092115715, -0.3603938, -0.14296664, -0.32648978, 2.01, -0.10486277, 0.1291708, 0.021386718,
+    2.05, -0.10486277, -0.17958435, 0.04657084, -0.10486277, 0.13241234, 0.012268219, 2.98,
+    -1.8803589, -2.1466296, -0.16764985, 2.37, 0.031082565, 0.12490212, -0.18892978, -0.24307282,
+    0.0033335635, 0.058450807, 2.78, -0.008613175, -0.068055324, -0.54071695, -1.4217949, -1.4536674,
+    -0.005681997, -0.08405833, 4.45, 0.002867241, 0.073510915, 4.49, 3.2, -0.036753986,
+    -0.12419782, -0.48152414, 0.07203471, 0.01029358, 0.2, -31.608435, 0.16, -40.02452,
+    0.07, 0.03, -51.15694, 0.01064112, -0.0016654423, -42.560875, -0.020739963, -0.012251209,
+    0.12761287, -36.19027, -37.815678, -0.019147694, -0.02571909, 0.12, 0.018530056, -33.599087,
+    -0.013494857, -0.017704556, -32.61234, 0.110449545, -0.016466916, -0.079226546, 0.4, -24.864492,
+    -25.265562, -30.874868, 0.15469222, -25.69593, 0.35, 0.0033036575, 0.091253236, -0.07040327,
+    0.12452584, -0.69370574, 0.44, -24.864492, -0.43189725, -24.11707, -24.452414, 0.045917388,
+    0.06280201, -0.39309937, 0.48, -24.11707, -0.2641447, -23.477354, -23.813517, 0.11354238,
+    0.08244283, -0.15197162, 0.63, -23.477354, -0.30879518, -21.325644, -0.0002640338, -0.39393616,
+    -20.981464, -21.50634, -0.002881611, 0.048027303, 0.71, -0.093254596, 0.00012970902, 9.5,
+    9.38, 9.14, 8.99, 8.83, 8.68, 8.64, 0.000017571372, 0.027879382,
+    -5.750133, -0.026594508, 0.052770253, -5.949599, -6.0520425, 0.039863456, 0.104928665, -5.842078,
+    -0.114486985, -0.012984874, -5.6420994, -6.3148303, -6.417596, -0.011312621, 0.042693213, -6.0203667,
+    -0.0642461, -0.014224579, 9.03, -5.5945034, -0.07608398, 0.01524575, 0.059444487, -6.653369,
+    9.27, 0.096875004, 0.2054973, -5.9075212, 9.23, -6.0203667, 0.05356124, -0.040706318,
+    -6.5924907, 0.14156507, -0.03919776, 9.27, -5.813874, -0.038483452, 0.04249498, -5.878716,
+    0.058500864, 0.15256101, -6.1628103, 9.42, -6.910217, 0.13443094, -6.7036514, -6.8701315,
+    -0.06043091, 0.00047040667, -6.286212, -0.12554762, -0.061820984, -6.7036514, -6.8701315, 9.46,
+    0.13297176, -0.0067024925, -6.8298554, -0.27498642, -0.08504727, -6.389413, -6.417596, 0.026085204,
+    -0.17805271, 9.46, 0.0027487536, 0.13899918, -6.0520425, 9.42, -6.131815, 0.05539449,
+    0.14619797, -6.131815, 0.0027211509, -0.047733307, -0.1448349, -6.4785495, 9.53, -6.511228,
+    -6.618714, -6.653369, -6.910217, -0.04781868, 0.0055599636, -0.16602555, -6.5553975, -6.5924907,
+    0.012444052, 0.091788866, 0.0024272918, -0.1197229, -6.740236, 9.65, -7.444791, -0.07979965,
+    -7.3987164, 0.10729275, -0.011133007, -6.8701315, -7.3987164, -0.0010392083, 0.011109759, -6.8298554,
+    0.059309084, 0.14490663, 9.61, -6.511228, -6.7036514, 0.04466824, 0.009114903, 0.08823853,
+    -6.7036514, 0.12840652, 0.021675874, -6.4524984, 0.03551701, 9.53, 0.083426185, 0.022331238,
+    9.96, -26.084858, -27.639406, -28.209562, 7.03, 1.73, 1.54, 0.005702254,
+    -0.03491607, -40.02452, -0.05416381, 0.057574898, -28.786161, 7.06, -0.10664517, 0.012568222,
+    7.1, -0.47499582, -0.08184071, 1.46, 1.42, 0.31, -0.16308448, 0.051779937,
+    -0.5789124, 1.5, 0.42606384, 1.54, -0.39536867, 0.05083505, 1.69, 1.62,
+    -27.161629, 1.42, -0.029980972, 0.79480857, 0.31, -1.1258767, 0.035903517, 0.56596863,
+    6.95, 6.91, -27.161629, -0.15924631, 0.00079498295, -0.49768922, 6.99, -27.161629,
+    -0.0353892, 0.5916851, -27.161629, 0.14548437, -0.06670435, 0.35, -0.36613104, 0.44,
+    -24.11707, -24.452414, -25.69593, 0.019894537, -0.033765387, 0.05074048, -0.3302063, 0.56,
+    -24.11707, -0.21886598, -23.813517, 0.091587506, 0.012797968, 0.59, -22.377066, -0.7154338,
+    -0.023739072, -21.12554, 0.0052227215, -0.00024501374, -7.667374, -8.113236, -0.02751859, -7.832062,
+    -7.8932815, -8.018251, 0.012860565, -7.9547505, 0.0005204421, -0.0023861972, 0.0607557, -7.7751694,
+    -0.06399689, -7.722872, 0.0154391825, -0.014723842, -7.5297284, -7.617456, 0.036914825, -7.5758924,
+    0.009021568, 0.02234941, 0.055292893, 0.2, -31.608435, 0.16, -40.02452, 0.07,
+    0.03, -51.15694, 0.007432287, -0.002418518, -42.560875, -0.017797573, -0.011007255, 0.103372194,
+    -36.19027, -37.815678, -0.016541874, -0.021893643, 0.12, 0.01402577, -33.599087, -0.01197238,
+    -0.015422276, -32.61234, 0.08887602, -0.014382842, -0.06522551, 0.4, -24.864492, -25.265562,
+    -26.084858, 0.35, -30.874868, 0.12528406, 0.013568781, 0.67929155, 0.35, -0.3112114,
+    -25.69593, 0.016081588, -0.050224423, 0.1071947, -0.5967123, 0.44, -24.864492, -0.35041007,
+    -24.11707, 0.04318848, -0.27737305, 0.56, -24.11707, -0.18134634, -23.813517, 0.073880665,
+    -22.656353, -0.0069450573, 0.053403344, 0.59, -22.377066, -0.62004244, -22.12889, -0.07711869,
+    0.007238749, -22.656353, 1.3, 0.06492529, -0.0076982337, -21.12554, 0.01465522, -0.00013962103,
+    4.57, 4.49, 4.41, -6.910217, 2.09, 1.81, -11.26825, 0.0014459708,
+    -0.072813585, -10.19933, -0.08713711, 0.04213843, -0.22016592, -6.7859416, 2.09, 0.25393996,
+    0.054558944, -2.2326505, 4.36, 0.015982231, 0.22101402, 3.67, 0.0010749222, -0.007832247,
+    -18.367512, 0.6137722, -11.018427, -1.1944954, -8.577097, -9.684118, 0.256205, 1.1896118,
+    -5.1183767, -0.44293043, 0.022849862, -4.750224, -4.894484, -5.004444, -5.1183767, -5.4127874,
+    0.023404362, -0.72073734, 1.1666805, -0.63005906, 0.79772455, -3.1480272, -4.2262564, 4.53,
+    -0.9977776, -4.524055, -0.7782608, 0.34562573, -3.2152596, -0.85018367, -0.17356034, -1.3970085,
+    -2.8076367, -3.0695794, 0.17675705, -0.19306214, 4.53, 0.37291425, -0.35592538, -1.3340919,
+    -0.7897316, -0.82226276, -0.05187734, 0.10554581, -2.6292815, 5.2, -3.9679167, -4.750224,
+    -5.878716, -0.27668688, -5.4127874, 0.1393303, -0.2115912, -4.4179254, -4.6410313, 0.14110719,
+    0.48473054, -4.127986, -0.06876526, 0.20143314, 4.61, -3.8950949, -0.35408816, -3.2776601,
+    0.013779168, -0.15595071, 4.85, -3.2152596, 0.053938758, -0.00025469874, -2.8076367, -0.0058804075,
+    0.03256784, -4.524055, 5.52, -4.894484, 5.48, 0.24535786, 0.10961447, 5.44,
+    0.072289534, -0.06521033, -5.254704, 5.72, 0.10531167, -0.000031395895, 5.79, -0.053213943,
+    0.008754368, -3.1480272, 5.6, -4.32814, -0.005514029, -0.039600246, -4.2262564, -0.04415188,
+    0.029539455, -2.9810855, -3.0695794, 0.006646093, 0.1304199, 5.36, 0.020213364, -0.030238697,
+    4.65, -2.5247674, 4.61, -0.05173416, -0.36998853, 4.61, -2.2551181, -0.147361,
+    -0.0017505646, -2.4040701, 0.04107679, -2.0923567, -0.04868973, 0.040574647, 5.28, -2.196643,
+    5.0, 4.73, -0.023297785, 0.01741226, 5.16, -0.04913559, 0.016642364, 4.97,
+    4.89, -0.038394053, 0.0033569336, 5.04, -0.07843752, 0.006906128, -2.5247674, 5.36,
+    -0.17189942, -0.02351532, -0.0114664715, 0.23, -30.874868, 0.2, -31.608435, 0.16,
+    -40.02452, 0.07, -0.004917058, 0.08431397, -36.19027, -0.015649756, -0.0072539346, -32.61234,
+    0.07210149, -0.011874112, -0.053077336, 0.10204989, -30.058292, -0.027991831, -0.067277335, 0.4,
+    -24.864492, -29.518152, 0.139619, 0.27, -28.786161, 0.0154615, -0.1425926, -28.209562,
+    0.3330234, -27.639406, -0.13465479, 0.023452332, -0.51734316, 0.44, -24.864492, -0.28934127,
+    -24.11707, 0.034423634, -0.2332245, 0.48, -24.11707, -0.15050615, -23.477354, 0.06311826,
+    -0.12665729, 0.67, -21.12554, -23.477354, -0.26055846, 0.0045094895, -0.17186047, 1.06,
+    -21.325644, 0.678878, 0.004554223, 1.46, -0.009107702, 0.0002057767, -1.1551399, -1.4217949,
+    -1.4536674, -1.4832442, -1.5112904, -1.5751029, -1.605014, 0.000034844736, -0.02681068, 4.41,
+    0.037866157, -0.33575305, 2.52, 1.97, -0.03022461, 0.15667139, 3.36, -0.036387254,
+    -0.109392665, 4.41, 2.44, -0.80015033, 3.24, 0.10620721, -0.0028371855, 0.8849026,
+    4.45, 3.17, 2.9, 2.48, -0.019690553, -0.06822073, 0.09999718, 3.75,
+    3.56, -0.061505634, -0.18338078, 4.14, 0.009389591, -0.13387871, -0.6472084, 4.49,
+    2.37, -1.2343782, 2.33, -1.2995658, -0.14812374, 0.039451886, -1.362035, -0.2673668,
+    -1.3865143, 2.29, 2.13, 0.004789734, -0.4838768, 1.3162987, 2.48, -1.1948682,
+    2.4, 1.2193966, 0.035775185, 2.4, -0.9893646, 0.6931812, 4.45, -1.3340919,
+    0.033109467, -0.011466697, -1.362035, -0.74650234, 0.5972722, -1.3970085, 0.14968376, -0.7107792,
+    3.56, 2.55, -1.114961, 2.37, 2.13, 2.01, 0.104947664, -0.060789492,
+    -0.71892494, 2.4, 0.97298586, 2.44, -0.58506435, 0.16315614, -0.24307282, 2.37,
+    2.21, -0.046777003, 0.06916293, -0.3603938, -0.020891985, -0.2507669, 2.4, 2.13,
+    0.04497976, -0.03245212, -0.18892978, 0.2743625, 0.024221232, -0.24307282, 2.63, 2.59,
+    -0.3603938, 0.07468307, -0.23814121, -0.3603938, 0.08428674, 0.43097243, -0.3603938, 2.78,
+    -0.040930383, 0.010967743, 2.9, 0.12818055, -0.071974285, 2.78, -0.14428757, 2.63,
+    -0.030529082, 0.07711222, -0.10486277, -0.070459746, -0.010678663, -0.07408267, -0.10486277, -0.062439766,
+    -0.12745324, 0.012533188, -0.82226276, 4.45, -1.0684927, 3.82, 3.75, -0.009743682,
+    0.0447185, 3.86, -0.13197784, -0.06353713, -0.9800166, 3.71, -0.0019640604, -0.10477791,
+    3.59, -0.055513572, -0.12106985, 4.49, -0.3474226, -0.9247528, 0.08260041, -0.15008163,
+    -0.771789, 4.49, 0.5455017, 0.08105087, -0.4176023, 4.49, -0.48152414, -0.46443048,
+    -0.0356542, -0.6559018, -0.07536545, 0.115272276, -0.3603938, 0.21641235, -0.09692078, -7.485508,
+    -7.667374, 8.01, -7.722872, -7.8932815, -8.453863, 7.77, 0.001325025, -0.017345352,
+    6.1, 0.18670894, -0.020877639, 4.57, 2.13, -0.00004357232, -1.7989384, 6.06,
+    0.21207677, -0.03601133, 5.99, 1.77, 0.007173157, 0.4532412, 6.49, -0.12580049,
+    0.21506639, 8.13, -8.018251, 8.09, -10.19933, -0.0733461, 0.0079636555, -8.113236,
+    -0.08453646, 0.071257524, -7.9547505, -0.13549271, 8.05, -0.02645891, -0.08955303, -9.029197,
+    8.17, -9.349648, -0.0338418, 0.018977992, -9.349648, -0.12794171, -0.060730826, -8.718564,
+    -8.85124, 0.02472777, 0.12151121, -8.577097, -0.07798462, -0.002703762, 4.53, -7.617456,
+    1.6768185, 2.17, -7.5758924, -0.16128464, 2.09, 0.05715685, -0.09455605, 0.37690088,
+    4.57, -0.6577694, 6.06, -7.5297284, 0.1928065, 6.02, 0.10788321, -0.12574387,
+    8.48, 6.34, -0.04257941, 0.051079627, 9.73, -0.06758229, 0.003554113, -7.444791,
+    8.44, 8.13, 6.26, 6.06, 5.95, 0.11269951, -0.034720995, -0.19197072,
+    0.10167414, -0.27280366, 9.84, 9.73, 8.56, 0.0626009, 9.65, -0.064661406,
+    0.052172747, 9.77, -0.19088021, -0.08819389, 9.88, 0.11227983, 9.92, -0.040088326,
+    0.051676024, 1.81, -4.0418863, -7.01124, 1.73, -7.3987164, -0.1418724, 0.1182073,
+    -7.20367, -0.04519043, -0.1675316, 1.77, -4.750224, 0.06086238, 0.17292278, -5.4127874,
+    -0.073387146, 0.020875333, 0.19082566, 1.85, -2.6292815, -4.6410313, -7.01124, -0.13881722,
+    -0.024426905, -3.8950949, -0.18348923, -0.04927483, -2.2326505, 0.20659077, -2.1466296, -0.034718323,
+    0.09670308, 2.17, -2.9810855, -4.2262564, 0.016349776, 0.14064153, -0.4176023, -0.049868833,
+    0.04539788, 2.37, -1.114961, -0.108405165, 0.015885716, 9.92, -0.0005451728, 0.14366685,
+    7.14, 6.37, 6.34, -7.8932815, 4.53, -8.577097, 2.09, -0.0017899806,
+    0.16750225, 2.13, -0.013847631, -0.6688028, 6.18, -10.396682, -0.3051423, 0.20273852,
+    -9.349648, 0.15834749, -0.074379556, -7.832062, 4.57, 2.13, -0.07033145, -1.6190445,
+    6.14, 0.15536438, -0.08529587, 5.99, -7.617456, 0.46839452, 0.0001282922, -6.389413,
+    -0.066953234, -0.0008131809, -10.792877, -11.018427, 0.5575513, 0.2286663, -8.718564, -10.59073,
+    0.025481163, -9.029197, -0.21875535, -0.092961125, -6.3485193, -7.3014965, 0.088129364, 0.2124366,
+    -6.1628103, -0.31503105, -0.0027835846, -11.018427, -11.515594, 6.45, 0.45676216, 6.53,
+    -14.294952, 0.093673915, -0.46953017, -11.773308, -0.0011994229, 0.22463827, 6.53, 6.49,
+    6.45, 0.03685244, 0.3425412, 1.4017161, 6.72, 6.64, 0.036678966, -0.11978455,
+    6.79, 0.077044025, -0.010630417, -10.792877, 6.53, 6.49, 6.41, 0.09361064,
+    0.33818766, -1.3725752, 6.72, 6.64, 0.13277607, 0.013618851, 6.76, 0.2524086,
+    0.092251085, 6.45, -9.029197, 6.41, -0.12697953, -0.23910616, -7.7751694, -0.060020078,
+    0.019924313, -9.684118, 6.53, 0.34941274, -0.029330557, -9.193894, -0.19438533, -0.025439842,
+    -18.7905, -18.977423, -24.864492, -25.265562, -25.69593, -26.084858, 0.014451076, 0.18474308,
+    7.26, -0.4675078, 0.24621868, 7.22, 0.63083434, 7.26, 0.071834184, -0.13455772,
+    -24.452414, 7.22, -1.2224236, 0.24448167, -24.11707, 7.26, 0.5577582, -0.18773194,
+    -21.931791, -0.13791032, -0.006563693, 7.18, -2.1894112, 7.3, 7.22, 0.37387544,
+    0.0967397, 7.57, 7.34, -0.036169816, -0.14867269, 0.014814759, 7.18, -18.367512,
+    0.7518911, -17.897657, 0.13267441, 0.46649286, 7.22, -17.44737, -0.080012254, 0.32989213,
+    -16.183819, 7.49, 7.26, -0.010938644, -0.11047899, -17.897657, 0.11875687, 0.02293035,
+    7.3, -15.410659, 0.08654315, 0.4107399, 7.42, 0.057873096, 0.0009820563, -1.1551399,
+    -1.4217949, -1.4536674, -1.4832442, -1.5112904, -1.5751029, -1.605014, 0.000086203676, -0.02144586,
+    4.41, 0.031159295, -0.28532752, 2.52, 1.97, -0.019562786, 0.13751246, 3.36,
+    -0.02929012, -0.08813915, 4.41, 2.44, -0.72009355, 3.24, 0.08600998, -0.00220086,
+    0.7964539, 4.45, 3.17, 2.9, 2.01, -0.085001834, -0.023718758, 0.082072295,
+    3.75, 3.56, -0.05015361, -0.15187292, 4.14, 0.00770731, -0.120449446, -0.5824459,
+    4.49, 2.37, -1.2343782, 2.33, -1.2995658, -0.11057091, 0.04271536, -1.362035,
+    -0.22980233, -1.2370354, 2.29, 2.13, 0.011981201, -0.42466164, 1.1954964, 2.48,
+    -1.1948682, 2.4, 1.0365486, 0.029144764, 2.4, -0.8573944, 0.58926547, 4.45,
+    4.33, 0.00932637, -0.07726819, -1.362035, -0.67181057, 0.5017747, -1.3970085, 0.13475685,
+    -0.6396595, 3.44, 3.13, -0.9247528, 2.4, 2.33, 2.13, 0.05597318,
+    -0.19723044, -1.0684927, -0.0641425, 0.4365377, -1.0267481, 2.44, 0.20772444, -0.02229262,
+    2.44, -0.7302494, -0.06348346, 2.55, -0.82226276, 2.21, -0.28561443, 0.022012962,
+    2.48, 0.0045998236, -0.055189427, -0.8777573, 2.74, 0.15616743, 0.05550321, -0.24307282,
+    0.019465106, -0.019097112, -0.9247528, -1.114961, 3.24, -0.07382279, 3.4, -0.0013603211,
+    0.060802203, 3.24, 3.2, 0.10996176, -0.019018745, 3.32, 0.17924534, 0.11069965,
+    3.28, -0.6559018, 3.17, 0.0889129, 0.024508616, -0.5968429, -0.09904564, -0.020308087,
+    -0.82226276, 3.32, 0.012813377, -0.043146897, -0.7202588, -0.08702785, -0.043392565, 4.49,
+    -1.0267481, 3.63, 3.56, -1.0684927, 0.052921187, 0.1247175, 3.59, -0.011248474,
+    0.054616928, 3.82, 3.67, -0.048978, -0.007879066, 3.86, -0.104114376, -0.051730346,
+    -0.4176023, -0.54071695, -0.82226276, -0.08422903, 0.08401913, -0.48152414, -0.6652641, -0.030844627,
+    -0.3603938, 0.184013, -0.083942674, -0.82226276, -0.9247528, 0.074381255, -0.13503265, -0.48152414,
+    -0.6559018, -0.771789, 0.06895447, -0.06778794, -0.54071695, 0.16772665, 0.03304647, -0.012772751,
+    -1.2995658, -1.4217949, -1.4536674, -1.4832442, -1.5112904, -1.6287112, -1.6592834, 0.00013665539,
+    -0.05420577, 4.45, 0.018497718, -0.29806978, 2.33, 1.97, -0.016954549, 0.16754723,
+    4.02, -0.060894933, 0.011315155, 4.41, 2.44, -0.6480843, 3.24, 0.06958972,
+    -0.0017704265, 0.7168083, 4.45, 3.17, 2.9, 2.48, 0.0023470307, -0.050981343,
+    0.06729912, 3.75, 3.56, -0.040959105, -0.12583727, 4.14, 0.0062624933, -0.10840454,
+    -0.5242012, 4.49, 4.45, 2.37, 2.17, -1.3340919, -0.019737244, -0.069178775,
+    -0.20187111, 2.48, -1.3340919, 0.093756974, 0.41835022, 3.48, -0.008565287, 0.03694224,
+    -1.362035, -0.6046295, 1.2328228, -1.3970085, 0.12128105, -0.57569355, 1.93, -1.0684927,
+    1.88, 0.0802597, -1.2343782, 0.05732524, -0.0631691, -1.0267481, 0.1545929, -0.8777573,
+    0.03605461, 0.08602295, -1.2630312, 2.52, 2.48, 0.13761635, 0.036709595, 3.48,
+    3.17, 2.94, -0.0063167573, -0.074385226, 3.28, -0.2893146, -0.12690735, 3.98,
+    3.75, -0.019744111, 0.05884857, 4.1, -0.064525984, 0.014265823, 2.09, -0.18892978,
+    2.01, -0.6559018, -0.08704705, 0.030453289, -0.8777573, 0.060461935, -0.16822594, 2.01,
+    -0.10486277, 0.08973866, 0.005714925, 2.05, -0.049261477, 0.039225053, 3.94, 3.13,
+    -1.2343782, -0.10169705, -0.0015612533, -1.2343782, 0.16323635, 0.0055908184, -0.82226276, 4.45,
+    -0.041100893, -0.17753492, -0.54071695, 0.20397492, -0.06727893, 7.14, 6.37, 6.34,
+    -8.577097, 4.57, 4.53, -8.718564, -0.0010449544, 0.27512068, -10.025825, -0.0054293317,
+    -0.9593628, 6.22, -9.029197, 0.43747425, 0.13031897, -10.19933, 0.27591118, -0.03401793,
+    6.1, -7.3014965, 4.53, -0.027967388, 0.13281615, -7.054926, -0.068754934, -0.00028037876,
+    -6.961682, -7.485508, -0.07579102, -0.13257585, -6.7859416, 0.12930451, -0.011196185, -10.792877,
+    -11.018427, 0.46830812, 0.19433288, -8.718564, -10.59073, 0.022054037, -9.029197, -0.17723344,
+    -0.07905083, -6.3485193, -8.453863, 0.2773511, 0.092157446, -6.1628103, -0.28355065, -0.0023569742,
+    -11.018427, -11.515594, 6.45, 0.38059795, -12.655651, -12.962669, -0.00055381394, 0.1982941,
+    6.53, -0.58574164, -0.052484583, 6.53, 6.49, 6.45, 0.030008523, 0.2876987,
+    1.1774057, 6.72, 6.64, 0.030352673, -0.09928851, 6.79, 0.06379765, -0.009069443,
+    -10.792877, 6.53, 6.49, 6.41, 0.08109944, 0.2930664, -1.1529993, 6.72,
+    6.64, 0.11282616, 0.01154232, 6.76, 0.22714539, 0.07992096, 6.45, -9.684118,
+    -10.59073, -0.0754611, -0.22440778, 6.41, 0.01913761, -0.06885662, -9.684118, 6.53,
+    0.28252634, -0.023633188, -9.193894, -0.15699147, -0.020488504, -18.7905, -18.977423, -24.864492,
+    -25.265562, -25.69593, 7.22, 0.06951108, -0.01291241, 7.18, -0.69899064, 0.03875362,
+    7.22, 0.52986515, 7.26, 0.06462822, -0.11440792, -24.452414, 7.22, -1.0594639,
+    0.2118543, -24.11707, 7.26, 0.46848083, -0.16898118, -19.09326, -0.053199407, 0.18861553,
+    7.18, -1.9704926, 7.3, 7.22, 0.33646545, 0.08381093, 7.53, 7.34,
+    -0.032575227, -0.15374045, 7.57, -0.022200013, 0.013310623, 7.18, -18.367512, 0.6516093,
+    -17.897657, 0.11273994, 0.3964859, -17.44737, 7.3, 7.22, -0.06538442, 7.26,
+    -0.14424388, -0.25084752, -17.897657, 7.38, 0.1308931, 0.013010521, 7.46, -0.20335846,
+    -0.040779877, 7.26, 7.22, 0.26987097, -16.605732, 0.059964754, 0.20597897, -15.410659,
+    7.49, -0.07467428, 0.025008945, 7.3, 0.3246277, 0.0019815238, -1.3340919, -1.4217949,
+    -1.4536674, -1.4832442, -1.5112904, -1.6287112, -1.6592834, 0.000120128934, -0.043476045, 4.45,
+    0.014867775, -0.25331765, 2.52, 1.97, -0.014656575, 0.10194536, 3.36, -0.0118431095,
+    -0.064364694, 4.41, 2.44, -0.58324814, 3.24, 0.05635799, -0.0013698324, 0.6451554,
+    4.45, 3.17, 2.9, 2.01, -0.07173279, -0.01213871, 0.055235445, 3.75,
+    3.56, -0.033399012, -0.104217745, 4.14, 0.005140257, -0.09753609, -0.47175333, 4.49,
+    4.45, 2.44, 2.33, -0.0261652, -0.16736908, 2.86, 2.48, 0.25193977,
+    0.07541056, 4.21, 0.024260877, -0.03445096, -1.362035, -0.5441387, 1.1095685, -1.3970085,
+    0.10918083, -0.51809615, 1.93, -1.0684927, 1.88, 0.07226181, -1.2343782, 0.04971924,
+    -0.05682373, -1.0267481, 0.13916169, -0.8777573, 0.030688478, 0.07230469, 2.09, -0.18892978,
+    -0.30146822, -0.9247528, 1.97, -0.09473144, 0.03923569, -0.771789, -0.14381586, -0.02348209,
+    2.05, -0.24307282, 0.04354172, -0.1474884, -0.35922775, 2.01, -0.10486277, 0.074084096,
+    0.0049906415, 2.05, -0.10486277, -0.15830873, 0.0300059, -0.10486277, 0.085598186, -0.014256897,
+    4.02, -1.2630312, 2.44, 2.29, -0.09277344, 0.69662094, 3.51, -0.06823346,
+    0.048791766, -1.1948682, 2.37, -0.56167525, 0.053249873, 3.63, 0.0005492439, -0.04696026,
+    -0.82226276, 4.45, -1.2343782, -0.012921994, -0.055633582, -1.1948682, -0.85249215, 0.048959542,
+    -0.771789, 4.49, 0.43446144, 0.028057862, -0.4176023, -0.07965269, 0.07915853, -0.14428757,
+    -0.3603938, -0.5968429, -0.7202588, -0.771789, -0.82226276, -0.8777573, 0.00005797971, -0.025182134,
+    2.4, 0.28034434, -0.03823885, 2.29, 2.05, 0.051687926, -0.4501105, 2.33,
+    0.69613457, -0.03295059, 2.48, 2.17, 2.13, -0.031372625, -0.3832863, 2.25,
+    0.36546326, 0.12318622, 2.52, -0.6559018, -0.6506445, -0.21017705, 2.55, 0.15999985,
+    -0.0024717543, 2.37, 2.29, 2.13, 2.09, -0.013203322, -0.29055208, 2.25,
+    0.024828363, 0.14938995, -0.3305483, 2.4, -0.48152414, 0.6591215, -0.4176023, -0.083322145,
+    0.2537178, -0.48152414, 2.52, -0.12878911, 0.0057028304, 2.71, 0.05949183, -0.012295483,
+    2.44, 2.33, 2.25, -0.24307282, 2.17, 0.02356082, 0.37285075, 2.21,
+    0.022129133, -0.19078201, -0.24307282, 2.29, -0.31631765, -0.054604996, 2.29, 0.16585094,
+    -0.21978454, -0.30146822, 2.4, 0.66679573, 0.10515957, -0.24307282, 2.37, 0.21179138,
+    -0.28762683, 2.4, 0.13814539, 0.39174435, 2.59, -0.30146822, 2.55, -0.39042577,
+    -0.13716187, -0.24307282, 2.48, 0.10770283, -0.1774994, -0.18892978, 0.073413566, -0.046521466,
+    2.71, -0.24307282, 2.63, 0.35618338, 0.15112297, 2.63, -0.19514173, 0.093546145,
+    2.9, -0.30146822, 0.10867714, -0.009644379, -0.18892978, -0.07104688, -0.012717438, 2.44,
+    2.13, -0.10486277, 2.09, 2.01, 1.97, -0.006716919, 0.06710625, 2.05,
+    -0.08077495, 0.032460276, 0.396227, 2.05, -0.058459997, -0.07408267, 0.0017201742, -0.005450694,
+    2.01, 0.004807282, 0.084316, -0.058459997, -0.07408267, -0.0165802, 0.017068699, 2.09,
+    -0.043860245, -0.100782774, -0.10486277, 2.25, -0.22988129, 2.33, 0.14951883, 2.37,
+    -0.51915973, -0.110211864, -0.07408267, 2.21, 2.17, 0.09987671, 0.03956787, 2.33,
+    -0.1431413, -0.009959259, 2.21, -0.058459997, -0.08362147, 0.0028862, 2.29, 0.020788534,
+    -0.009659119, 2.52, -0.07408267, 2.48, -0.10486277, 0.15507546, 0.050621796, 0.4411864,
+    2.48, -0.058459997, -0.055277098, -0.020071538, -0.058459997, -0.0011486054, 0.027541503, -0.10486277,
+    2.67, 2.55, -0.0014312745, 2.63, -0.11187371, -0.25007173, 2.74, 0.1868953,
+    2.82, 0.011838722, -0.036466982, 2.67, -0.07408267, 2.59, -0.013280488, 0.10443916,
+    2.55, 0.06351967, -0.0053011472, -0.07408267, 2.71, -0.0073638917, -0.09698857, -0.058459997,
+    0.014776738, -0.04306122, -12.962669, 7.38, -13.614294, -14.294952, 7.3, -15.789676,
+    7.26, 0.00074545975, -0.057887282, 7.06, 0.016844062, 0.23431905, -15.789676, -30.874868,
+    -0.107229725, 0.03710927, -14.672277, -0.21076469, 0.039356843, 6.53, -13.937053, 1.97,
+    -0.023299715, -0.47352067, 2.01, -0.0495536, 0.18379211, 7.03, 6.95, 0.09266731,
+    -0.17092225, -13.937053, 0.1300238, 0.2628512, 6.53, 4.53, -13.286145, 2.01,
+    0.035657015, -1.0228684, 1.97, 0.047883466, 1.0049919, -1.3541651, 6.99, 6.68,
+    6.6, 0.1531674, 0.036246836, 6.91, -0.050047528, -0.15895706, 0.3185669, 7.57,
+    -25.265562, -30.874868, -0.058598902, 7.46, -25.69593, 0.076390155, 0.0192482, -0.019585038,
+    7.49, -13.937053, -16.991007, -0.12612627, -0.0815227, 7.42, 0.1373893, -0.014424266,
+    -14.995561, 7.53, 0.014356232, 0.08862488, 7.53, -0.029269664, -0.18365026, 7.77,
+    -13.614294, -14.294952, 7.65, 0.08985151, -0.017201615, 7.69, -0.107752435, 0.06383423,
+    7.69, -13.286145, 0.048898604, -0.033453044, -13.286145, 0.23019257, 0.07428271, -14.294952,
+    -0.0023731233, -13.614294, -0.16511269, -13.286145, 0.0053262333, -0.13918458, 1.66, -12.062972,
+    -12.377764, -12.655651, 1.62, 0.108501434, -0.028330995, -0.08451767, 1.62, 0.062247466,
+    0.020999147, -11.773308, 0.4886345, -11.018427, -11.515594, 0.12402903, -0.062832646, 0.1280664,
+    -11.773308, 1.77, 0.36164245, 6.95, 6.53, 2.05, -0.07352397, 0.3154538,
+    -12.377764, -0.04115099, -0.14536932, 7.49, -12.062972, 0.13306652, 0.5653436, 7.69,
+    -0.06475946, 0.06294243, 1.77, -7.054926, 1.73, -9.847813, -0.15090059, -0.002392807,
+    -11.26825, -0.053196717, -0.27711585, -4.750224, -5.4127874, 0.07298182, -0.05275218, 0.14983317,
+    1.81, -9.193894, -10.59073, -0.02737236, 0.26408184, -4.0418863, -0.02095344, 0.15897928,
+    -11.515594, 6.53, -0.16069089, 0.013584687, -11.26825, 0.044873547, -0.00005592458, 2.44,
+    -0.14428757, -0.3603938, 2.33, 2.29, -0.8777573, -0.9800166, -0.0010318144, 0.23533843,
+    -0.7202588, -0.2586014, 0.01936303, -0.54071695, -1.114961, -0.13897242, 0.2873603, -0.48152414,
+    -0.44187722, -0.1955954, -1.2343782, 2.37, -1.362035, -0.16494225, -1.0469669, 2.4,
+    0.2678374, -0.30167246, -1.1551399, 2.37, 1.0760758, 0.11676758, -0.8777573, -0.15760529,
+    0.018023176, 2.33, 2.25, -0.24307282, 2.17, 0.019073278, 0.3050698, 2.21,
+    0.017855687, -0.1564319, -0.24307282, 2.29, -0.26208246, -0.045234572, 2.29, 0.13742904,
+    -0.1807017, -0.30146822, 2.4, 0.5667853, 0.08939419, -0.24307282, 2.37, 0.17791383,
+    -0.23648274, 2.4, 0.11265218, 0.32459828, 2.13, -0.10486277, 2.09, 2.01,
+    1.97, -0.0060401917, 0.057048034, 2.05, -0.06999817, 0.027058665, 0.34340414, 2.05,
+    -0.058459997, -0.07408267, 0.0014984132, -0.004533895, 2.01, 0.00433197, 0.07308146, -0.058459997,
+    -0.07408267, -0.013623387, 0.01415209, 2.09, -0.037273027, -0.08565712, -0.10486277, 2.33,
+    2.25, -0.18964271, 0.12294821, 2.37, -0.46723786, -0.09060872, 2.17, -0.07408267,
+    0.083905034, -0.058459997, -0.06098633, 0.04335531, -0.07408267, 2.21, 0.03324585, -0.072669014,
+    2.21, -0.04574097, 0.0014953451, 2.63, -1.5448009, -1.6287112, 0.22428639, 0.121433415,
+    -1.0684927, 2.48, -1.1551399, -1.362035, 0.2710071, 0.11163652, 0.3972931, -1.114961,
+    2.55, 0.021175355, -0.06337172, 2.55, 0.01790123, 0.17602946, -1.0267481, 2.48,
+    -1.4544617, 2.55, 0.19099274, 0.061950684, -0.8777573, 2.48, 0.6758847, 0.015218735,
+    -0.82226276, -0.16451907, 0.0007099152, -30.874868, 7.3, -32.61234, 6.99, -42.560875,
+    -0.053800117, 0.08251663, 7.03, -0.10716903, 0.012946196, 6.91, 6.88, 0.084913254,
+    -0.18952027, 6.95, 0.41306612, 0.04572296, -31.608435, -32.61234, -33.599087, -0.029314492,
+    -0.219413, 7.38, 0.03825709, -0.023755645, 7.34, -0.34591562, -0.017897798, -23.477354,
+    6.79, -24.452414, 0.23799133, 0.100368045, 6.95, 6.88, -0.019793872, -0.2927182,
+    7.03, 0.11074443, -0.035633422, -22.907703, 7.18, 6.99, -0.049658496, 0.49497142,
+    7.22, -1.1080929, 0.07823845, -22.656353, 7.18, -0.009850311, -0.7158123, -22.377066,
+    0.1825556, -0.000045682347, 7.18, 6.91, 6.88, -17.44737, 1.93, 1.77,
+    -18.7905, 0.0010437163, -0.066616766, -17.897657, -0.11514898, 0.08396073, 4.49, 0.5354828,
+    6.68, 0.08930426, 0.016354164, -16.605732, 6.72, 6.64, -0.04262169, -0.24502043,
+    6.76, 0.08024537, -0.023673521, 6.41, -9.193894, 0.024940621, -0.00075129553, -16.183819,
+    0.1319458, -0.021168021, -21.69312, -36.19027, -40.02452, -45.980717, -0.013221741, 0.07996216,
+    0.35078126, -28.209562, -0.27932015, -23.813517, -0.093900494, -0.03018631, -13.286145, -18.7905,
+    -19.22157, 0.11240311, -0.025643159, -16.183819, 0.20483856, 0.10365639, -12.962669, -0.025193786,
+    -12.377764, 0.033596423, 0.0001332601, -19.330385, -19.539429, -19.668941, -19.876776, -20.981464,
+    0.0036890854, -0.120876096, 7.06, -0.10264994, 0.584361, 6.99, 0.03242264, -1.4133344,
+    7.1, 6.95, -0.056198504, -0.38373145, 1.0139261, -19.09326, 7.06, 7.03,
+    -0.0049365996, -0.08539772, -1.1805146, -18.977423, 7.1, 6.95, -0.010334397, -0.40454063,
+    0.7339231, 7.06, -16.183819, 0.07443117, -0.05995753, -17.897657, -0.061945833, -0.38001946,
+    -22.656353, -24.11707, -24.452414, -24.864492, 7.22, -28.209562, -0.02204092, 0.23593266,
+    -26.572838, 0.0050540986, -0.044931795, 7.22, -0.59284705, 7.26, 0.2244381, 0.054278947,
+    7.26, 7.22, 0.4410141, 0.09008026, -0.13592492, 7.22, -1.3925085, 7.26,
+    -22.907703, -23.477354, -0.08666992, 0.17926788, -0.73147506, 7.34, -23.178364, 0.079415284,
+    0.194383, 7.42, -0.055115968, 0.06694015, 7.26, -20.652575, 7.22, -22.12889,
+    -22.377066, 0.63675946, -0.4321808, 0.71717453, 0.07387505, -20.516748, 7.22, -1.6286576,
+    0.29614678, -19.539429, -20.402336, -0.064684294, 0.34964177, -17.44737, -0.034880884, 0.15315756,
+    -16.183819, 7.49, 7.38, 7.3, -0.1072151, -0.00038251877, 7.46, -0.08191609,
+    -0.1470033, 7.53, -20.981464, 0.042801667, -0.02422185, -16.605732, 0.059232075, -0.026817868,
+    7.42, -13.937053, 7.34, 0.07511914, -0.07119535, -13.614294, 0.1368445, 0.2530981,
+    -11.018427, -11.26825, -0.00926748, -0.108762704, 7.61, 0.3018585, 0.0010331972, -12.377764,
+    -12.655651, 7.38, -12.962669, -13.614294, -14.294952, 7.3, 0.000742651, -0.0165228,
+    6.53, -0.06293612, 0.08056642, 6.53, 4.53, 0.026699498, -1.1341046, 6.99,
+    0.0069305026, 0.22710815, 6.53, 2.01, 1.85, 0.032247078, -0.34679368, 0.9669409,
+    6.6, 6.57, -0.05396042, 0.04600474, 6.72, -0.19725342, -0.067034915, 7.49,
+    -13.937053, -25.265562, -30.874868, -0.047019005, 0.061088115, 7.46, -0.05947224, -0.09965829,
+    7.42, -13.614294, 0.023374286, 0.15688111, -12.962669, -0.009882455, -0.039052736, -14.995561,
+    -15.410659, 7.65, 0.026594354, -0.044857256, 7.69, 0.13783774, 0.014528465, 7.57,
+    -12.962669, -0.08184124, 0.11925751, -12.962669, 0.00918396, -0.06308039, 6.53, 4.57,
+    2.01, 1.88, 1.62, -0.07845688, 0.0894125, -0.23983486, 0.20885468, -1.1957718,
+    7.49, 6.95, 6.72, 0.076330654, 6.83, -0.027888617, 0.037923127, 7.46,
+    7.42, 0.19530843, 0.09209473, 0.037849046, 7.69, 7.53, -0.035357665, -0.13159962,
+    7.81, 0.07654428, 7.89, -0.049836986, 0.08874207, -11.773308, 6.53, -12.062972,
+    1.93, 1.66, 1.62, 0.053631593, 0.0150115965, 1.81, 0.31166732, 0.12830506,
+    2.05, -0.29251125, 4.53, 0.35677388, -0.07900085, 0.43532714, 6.79, 6.57,
+    -0.21819656, -0.123416424, 7.49, 6.91, -12.062972, -0.035069123, 0.057638932, -12.062972,
+    0.17673515, 0.47637877, 7.69, -12.062972, -0.10544641, 0.028107071, 7.81, 0.09854193,
+    0.038486894, 1.77, -7.3987164, 1.73, 1.66, -10.025825, 0.040208217, 0.12575836,
+    -9.847813, -0.12719554, -0.021149276, -11.26825, -11.515594, -0.114374794, 0.073954776, -7.9547505,
+    -0.25824782, -0.08115896, -7.3014965, 0.18879548, -7.054926, -7.20367, -0.005960083, -0.13230133,
+    -5.5945034, 0.02980179, 0.102700554, 1.81, -3.7061508, -9.193894, -10.59073, -0.026795197,
+    0.21608327, -8.718564, -0.12702636, 0.001140694, -3.4696734, 0.24149476, 0.058660384, 1.88,
+    -2.6292815, -9.029197, 0.0088679725, -0.06252158, 1.85, 0.12127533, 0.06713524, 2.01,
+    -11.018427, -0.18131125, 0.027791113, -11.26825, 0.019721681, -0.00030643897, 3.48, 3.4,
+    -6.910217, 2.01, 1.85, -8.85124, -13.286145, -0.00053584547, 0.040372796, -8.453863,
+    -0.14715815, -0.037541915, -10.025825, 1.88, -0.0070342063, -0.10209029, -9.684118, 0.21860187,
+    0.032286417, -8.718564, -11.515594, -0.33457643, 2.05, -0.06507998, -0.28623277, 2.09,
+    -7.832062, 0.018990217, 0.122589745, -0.17595468, -6.7859416, 2.09, 0.2028038, 0.04763336,
+    -2.040998, 2.37, 2.25, 0.015952406, -0.15758239, 3.1, 0.17207438, 0.04588924,
+    3.02, -1.9079165, 0.06994821, 0.00038745903, -1.6287112, -0.044367984, 0.004601315, -1.2630312,
+    -1.7983414, -2.1466296, -2.173437, -2.196643, 0.08500606, -0.05789795, 0.09616852, -1.8541082,
+    -2.0923567, 0.014380731, -0.033508185, 3.44, -0.042210694, 0.16680664, -0.1333044, -0.82226276,
+    -1.1948682, 0.1763443, -0.9247528, -1.1551399, 0.012899145, 0.08050108, -0.8777573, -0.016061401,
+    0.049528506, -0.13021488, 3.59, -1.960713, -2.1466296, -2.2326505, -2.2551181, 0.020606486,
+    3.51, 0.028936768, 0.15263061, -2.196643, 3.51, 0.11440735, -0.0071332655, 3.51,
+    0.0028696696, 0.07233276, -2.0923567, -0.11276417, 3.56, -0.08713814, -2.040998, -0.040932085,
+    0.024199678, -1.0267481, -1.5751029, -1.7983414, 3.56, 0.016249018, 0.08149096, 3.56,
+    0.11352586, 0.23923326, -1.362035, 3.56, 0.023363877, -0.06707891, -1.2343782, 0.12361697,
+    0.026265172, -0.8777573, -0.03467282, -0.10300609, -1.2343782, -1.4217949, -1.4536674, -1.4832442,
+    -1.605014, 0.0002521842, -0.029279923, 4.41, 0.01643433, 0.5807499, 4.45, 3.63,
+    -0.16192983, -0.010598029, -0.42446786, 4.49, 4.45, 4.17, 0.046226654, -0.022023287,
+    -1.362035, -0.4896145, 0.9987217, -1.3970085, 0.09837303, -0.46617624, -0.82226276, 4.41,
+    -1.0684927, 3.82, 0.0141198505, -0.031866234, 3.71, -0.032033794, -0.073536746, -1.1948682,
+    4.45, -0.0045421603, -0.7671326, -1.1551399, 0.28469354, -0.14999478, -0.54071695, 4.49,
+    -0.771789, 0.3817851, 0.040327072, -0.6559018, -0.0054144287, 0.12821859, -0.48152414, 4.49,
+    -0.58447117, 0.047662355, -0.3603938, 0.08856681, -0.064669296, -1.3340919, -1.4217949, -1.4536674,
+    -1.6287112, -1.6592834, -1.7983414, -1.9079165, 0.00021497086, -0.012842039, 2.74, 0.07666576,
+    -0.0013906428, 4.45, 2.67, 0.1756239, -0.08550802, 0.5746315, 3.94, 3.56,
+    2.9, -0.027801514, 0.042958368, 3.9, -0.04971778, -0.15211411, -1.5448009, 4.45,
+    0.029026154, -0.38416013, 4.45, 0.038509175, 0.4515938, 4.45, 2.01, 1.88,
+    0.008737946, 1.93, -0.12117386, -0.0351354, 2.13, 0.13228302, 2.37, -0.11021551,
+    -0.011098661, -0.38202095, 4.49, 4.45, 4.17, 3.75, 2.86, 0.05231893,
+    -0.006207285, -1.362035, 0.04407196, 0.1301725, 4.33, -1.3970085, 0.010518236, -0.023967808,
+    -1.3970085, -0.029715305, -0.063734695, -1.362035, -0.44065323, 0.8988495, -1.3970085, 0.08853569,
+    -0.41955873, 1.93, -0.8777573, -1.0267481, -1.0684927, 1.88, 0.058460236, -1.2343782,
+    0.039568078, -0.053782653, 0.12260437, -0.013331222, 0.07386841, 2.21, -0.54071695, 2.13,
+    -0.9247528, 1.97, -0.0932547, 0.034744263, -0.771789, -0.17415628, -0.00817773, -1.0684927,
+    2.17, 0.073439024, -0.0034011842, -0.7202588, -0.46273184, -0.20415047, -0.30146822, 2.13,
+    2.01, 0.03690445, -0.16173379, -0.48152414, 0.40058872, 0.18884711, 2.17, 2.09,
+    -0.016606344, 0.046145663, -0.18892978, -0.16994761, -0.017440593, -1.2630312, 2.44, 2.29,
+    -0.12031517, 0.65719223, 3.51, 3.24, -0.022673124, -0.124746814, 3.59, 0.16630341,
+    -0.0030043777, -0.54071695, 2.33, -1.114961, -0.7659258, 0.16502604, 2.78, -0.020470848,
+    0.007834054, 2.33, -0.4176023, -0.19793685, -0.02390735, 3.02, 0.00823563, -0.050344754,
+    8.52, 8.48, 8.32, 8.28, 8.24, 7.18, 6.91, 0.000018559387,
+    -0.00958095, -6.7859416, 0.0036017112, 0.26052988, -6.961682, -7.1555967, -0.04661012, -0.26279336,
+    -6.618714, 0.029874975, 0.17245239, -8.018251, -8.577097, -8.718564, 0.17761587, -0.083129376,
+    0.16349937, -6.511228, -6.653369, 0.004647951, -0.08363088, 0.17046306, -6.417596, -6.910217,
+    -6.961682, 8.4, -0.06368814, 0.03370699, 8.4, 0.4038569, -0.040268328, 8.4,
+    -6.618714, -0.08080788, 0.03564795, -6.8298554, -0.23628867, -0.087928794, 8.44, -6.1923833,
+    8.4, 0.110342406, 0.06233063, -6.131815, 0.2034874, 0.023506165, -6.2222686, -6.3485193,
+    0.104672246, -0.040299073, -6.0905485, 0.0549366, 0.10280114, -6.417596, -7.485508, -7.667374,
+    -7.722872, -0.009237671, -0.10681496, -7.5758924, 0.03873558, -0.046213914, -6.961682, -7.3014965,
+    -7.3987164, 0.08589726, 0.019424438, 0.2034546, -6.740236, -6.910217, 0.049850974, -0.08818085,
+    -6.4785495, 0.09051391, 0.15864392, -6.1923833, -6.2553506, -6.3148303, -6.389413, 0.018213464,
+    -0.11056458, 0.12951279, -6.2222686, -0.20301056, -0.08058599, -6.1628103, 0.17819825, -6.0203667,
+    -6.0905485, -0.051542055, -0.005216217, -5.987348, 0.090315245, 0.022039795, -5.5490093, -6.0520425,
+    -6.131815, -6.286212, 8.6, -6.910217, 0.060466588, -0.121774666, -6.3148303, -0.0005891595,
+    -0.04377472, 8.72, -6.1628103, 0.110924624, -0.022544947, 8.76, -0.11299699, 0.017351165,
+    9.38, 8.8, -0.16932546, 9.23, -0.021745186, -0.1303012, 9.42, 0.11851525,
+    -0.04333496, 9.3, 8.6, -5.949599, 8.56, -0.011085256, 0.0386261, 0.16081767,
+    -5.842078, -5.987348, 0.014274396, -0.038175087, -5.784454, 0.039049137, -0.0047328672, 9.38,
+    -5.949599, 9.34, -0.043209285, 0.13899517, 9.34, 0.15449534, -0.0049919127, -0.13072662,
+    0.10228882, 0.23, -30.874868, 0.2, -31.608435, 0.16, -40.02452, 0.07,
+    -0.0039660656, 0.06896085, -36.19027, -0.01260079, -0.0058456045, -32.61234, 0.058687814, -0.009595467,
+    -0.042991277, 0.0833168, -30.058292, -0.022587446, -0.05496648, 0.31, -27.161629, -27.639406,
+    -28.209562, 0.27, -28.786161, 0.04769013, -0.115523756, 0.27115288, -0.1088252, 0.15706049,
+    -0.962784, 0.67, -27.161629, -0.9301142, -26.572838, 0.20918165, -21.12554, 0.63,
+    -0.0072313244, 0.049299575, -0.13923104, 1.14, -20.803585, 1.06, 0.71, 0.07867999,
+    0.44483086, -21.69312, 0.11281027, 0.03849494, 0.75, -20.652575, 0.005348101, -0.09044297,
+    -20.402336, 0.0674832, -0.002061798, 1.46, -21.931791, -26.084858, -0.020949556, 0.025897158,
+    1.42, -0.017969765, -0.26480922, 1.69, -25.265562, -0.015712067, 0.0339428, -20.803585,
+    -0.008131124, 0.00040011932, -27.161629, -27.639406, -28.209562, 7.03, 1.73, 1.54,
+    0.27, -0.002977344, 0.025124177, -33.599087, 0.023144778, -0.09634852, -40.02452, -51.15694,
+    0.10853272, -0.04427981, 6.95, 0.069506004, 0.015796198, -28.786161, 7.14, 7.1,
+    0.005129528, -0.15958405, 7.18, 0.10618725, 0.0011985226, 7.1, -0.42197418, 7.14,
+    0.2847912, -0.15794526, 7.06, 6.99, 6.95, 1.66, -0.062233396, 0.14081955,
+    0.72903293, 7.03, -0.7512411, -0.09297435, 7.22, 0.28245634, 7.3, -0.38038635,
+    7.34, 0.18337505, 0.04123192, 1.42, 0.31, 0.12666203, 0.35, -0.79059696,
+    1.38, -0.11351675, -0.55358684, 1.62, 1.46, 0.89802045, 1.54, -0.21484832,
+    0.8640508, 7.06, 6.99, 6.83, -0.015398152, -0.23509128, 0.5789243, 7.1,
+    -0.7403027, 7.14, 0.31085855, -0.15175186, 0.31, -0.81836647, 0.35, -26.572838,
+    0.16901855, -26.084858, 0.00042040428, -0.26719856, -26.572838, 1.62, 1.54, 1.5,
+    -0.20901628, 0.31614888, -1.4331691, 6.99, 6.95, 0.2009398, 0.8641548, 7.1,
+    -0.38769227, 0.18450813, -26.084858, 0.4, 0.60958254, 7.14, 0.062451243, -0.16678467,
+    -24.11707, 1.5, 0.018193424, -0.05372442, 0.44, -0.19477174, 0.00014151513, -20.188913,
+    6.99, 6.83, 1.88, 1.81, -22.377066, -23.178364, 0.0011757021, -0.031822048,
+    1.46, 0.0042410675, 0.10572391, -21.69312, -0.283856, -0.10024357, -20.516748, -21.931791,
+    6.79, 0.15364546, 0.032608192, 6.72, 0.0875124, -0.13548766, 6.76, 0.2654724,
+    -20.402336, 0.15508424, -0.044915773, -26.572838, -27.161629, -30.058292, 6.95, 0.073544584,
+    -0.041004434, 6.95, -0.2663614, 0.10853157, 6.95, 6.88, 0.10089417, -0.15544358,
+    0.777739, -21.325644, 6.91, -22.377066, -0.08277979, -0.19259186, -25.265562, -0.14496714,
+    -0.31847903, -20.981464, 6.91, 0.030084228, -0.04200872, 6.88, 0.016145935, 0.23708649,
+    -20.981464, -21.50634, -21.931791, -22.12889, -22.377066, 0.018149948, -0.2634794, 7.14,
+    1.0777707, -0.27863398, 7.1, -0.65886587, 7.18, -0.12416102, 0.1554898, 7.22,
+    7.06, -21.325644, 0.99438936, -0.8743772, -21.325644, -0.025180435, 0.7449795, -21.12554,
+    7.3, 0.07083225, -0.06635071, 7.34, 0.11214218, 0.033227157, -20.803585, 7.18,
+    7.03, 0.007106781, -1.3824505, 7.38, 0.0961737, -0.009356308, 7.06, 7.03,
+    -0.06986809, -0.6402168, 7.18, -20.402336, 0.73650855, -0.14220905, -20.402336, -0.16988502,
+    0.1965346, 0.75, -0.22613335, 0.87, -20.089907, 0.79, 0.060336776, 0.83,
+    -0.09596197, 0.10731933, 0.79, -19.876776, -19.982029, -0.10454643, 0.061089516, -0.34251252,
+    -19.982029, 0.83, 0.009976751, 0.038327638, -19.876776, -0.08382212, -0.0143518625, -20.089907,
+    7.1, 7.06, 0.95, 0.14921875, -0.14240327, 1.3817872, 7.18, -1.4171082,
+    0.079515584, -19.982029, 0.99, 0.18523651, 1.38, -0.07121124, 0.12440314, 0.95,
+    -19.876776, 0.06887329, -0.04341638, -19.22157, 0.023167929, -0.00036133008, 2.44, -0.14428757,
+    -0.3603938, 2.33, -0.48152414, 2.25, -1.0267481, 0.00008770682, -0.063865185, -0.9247528,
+    -0.10951769, 0.20851679, 2.17, 2.13, -0.10093893, 0.38762382, 2.21, -0.26841077,
+    -0.10306444, -1.362035, 2.37, -1.5448009, -0.080774784, -0.20680237, -0.38269183, -0.9247528,
+    -0.9800166, 0.020637512, 0.6261279, -0.8777573, -0.87144846, 0.016189108, 2.33, 2.25,
+    -0.24307282, 2.17, 0.011464137, 0.2477399, 2.21, 0.016100237, -0.123886265, -0.18892978,
+    -0.24307282, -0.13261044, 0.096475646, 2.29, 0.024315072, -0.35934773, -0.30146822, 2.4,
+    0.48060265, 0.07482014, -0.24307282, 2.37, 0.14820497, -0.1958218, 2.4, 0.090421066,
+    0.26762173, 2.13, -0.10486277, 2.09, 2.01, 1.97, -0.006538391, 0.046837617,
+    2.05, -0.058388263, 0.025394186, 0.2915263, 2.09, 2.05, -0.058459997, -0.000061225895,
+    0.050608445, -0.058459997, 0.01121194, -0.029121399, -0.058459997, -0.07408267, -0.03197759, 0.010515213,
+    -0.079660416, -0.10486277, 2.33, 2.25, 2.21, -0.17715454, -0.06640218, 0.10542434,
+    2.37, -0.4212906, -0.07588094, 2.33, 2.21, -0.07408267, 0.052201338, -0.034183573,
+    -0.07408267, -0.098788224, 0.00049359, 2.37, -0.07408267, 0.12883851, 0.020494334, -0.07408267,
+    -0.10148799, -0.003960562, 2.82, -1.7140237, 2.74, 0.15395688, -1.8541082, 0.15798035,
+    -1.8216634, 2.78, 0.10130768, 0.029133225, -1.7983414, -0.021601487, 0.03921848, -0.7202588,
+    -0.9247528, -0.9800166, -1.0267481, 0.0037699006, 0.10082126, 2.48, 0.25399476, -0.16297646,
+    2.48, -0.771789, -0.3996229, 0.5868022, 2.52, 0.29359132, 0.058794554, -0.6559018,
+    2.48, -0.011766561, 2.52, -0.56118673, -0.16278654, -0.5968429, 2.48, 0.2303355,
+    0.059994068, -0.30146822, -0.0351826, 0.015030217, 2.9, -1.7983414, 2.86, -1.8541082,
+    -1.9079165, 0.09269165, 0.040628053, -0.03678894, 0.1466658, -0.82226276, 2.86, -1.6287112,
+    -0.106447004, 0.0074675293, -1.0267481, -0.072692916, -0.21674299, 2.86, -0.3603938, -0.04062548,
+    0.032503128, -0.30146822, 0.06651535, -0.05840149, -0.3603938, 2.94, -1.6287112, -1.8216634,
+    0.032600544, -0.200284, -0.7202588, 0.060409844, 0.12478229, -0.6559018, -8.018251, 0.00274205,
+    -0.00066556706, 3.06, 0.030744633, -0.046559073, -0.18892978, -0.05558283, -0.012211991, -10.025825,
+    7.65, -12.062972, 7.46, -12.377764, -12.655651, -12.962669, -0.00043657413, 0.0434053,
+    6.53, -0.20921397, 0.060884733, 6.91, 4.53, 0.13603349, -0.106383376, 0.25633425,
+    -12.655651, 7.49, -14.672277, -0.10515108, 0.014478132, -14.294952, 0.029033545, -0.033086177,
+    7.53, -12.377764, -0.0037002563, -0.049391635, -0.11400612, 4.57, -11.773308, 1.88,
+    0.35490128, 1.97, 0.082271196, 0.00443573, -10.19933, 2.05, -0.08609211, -0.5189551,
+    2.09, -0.012260368, 0.9804222, 6.37, -10.792877, 0.34894258, 6.3, 0.18593833,
+    -0.04411563, 6.72, -11.018427, 0.095047645, -0.063023366, 7.57, 0.116505004, -0.016358146,
+    7.85, -11.515594, 7.69, -11.773308, -13.286145, -0.015885418, -0.14543915, 0.1391323,
+    -13.937053, 7.73, -0.0111486055, -0.06338676, -11.773308, 0.04963471, -0.030804796, 7.73,
+    -10.59073, -11.018427, -0.07649994, 0.06615501, 7.69, -0.05300964, -0.25160086, -10.59073,
+    7.81, -0.31915498, -0.11262798, 7.77, 0.01489563, -0.16577293, 8.01, 7.97,
+    7.93, -11.26825, 0.061786044, -0.02370506, -11.515594, -0.03993042, 0.089420065, -10.19933,
+    -10.396682, 0.09395396, -0.038856506, 0.24826622, -10.19933, 8.05, -10.59073, -0.05409756,
+    0.032890704, 8.09, -0.13409176, -0.016386796, 8.09, 0.10698986, -0.03753103, -9.684118,
+    6.26, 1.77, 1.69, 1.66, 0.10016098, -0.012867737, -0.1638401, -9.847813,
+    4.53, 1.93, 0.13640137, -0.042218782, 0.15878175, 0.24170768, 6.49, 6.45,
+    6.34, -9.847813, -0.019794082, -0.12039124, -9.847813, -0.22633858, -0.11650314, -9.847813,
+    0.119651794, -0.112532966, 6.53, 1.0132645, 7.69, 6.76, -0.037495423, 0.36783925,
+    7.81, -0.05031609, 0.022844998, -9.50892, 7.77, 6.26, 2.09, 1.85,
+    0.1326585, -0.16926308, 0.35822296, 6.72, 6.49, 0.034394685, -0.20433398, 7.73,
+    0.21959709, -0.017439526, 8.05, 7.85, -0.10808068, -0.22663634, 8.09, 0.061038207,
+    -0.11369496, 1.77, -7.3987164, 1.69, -8.718564, 0.06010315, -0.04519844, -9.349648,
+    0.08668442, -0.16044393, -7.3014965, 0.17362061, -7.1032915, -0.10563355, 0.041848183, -8.018251,
+    6.18, -9.193894, 0.34324393, 0.058391917, 6.68, -0.047349207, 0.015891036, -7.832062,
+    8.44, -0.05323819, -0.00042736784, -7.485508, 0.012192207, -0.00025673502, 8.09, 7.18,
+    5.95, 5.72, -10.19933, -11.26825, 2.05, -0.00066223525, 0.12657295, 2.05,
+    -0.075465694, -0.5269143, -9.193894, 4.49, 0.032250796, 0.80598164, -8.453863, -0.14036518,
+    0.0011077715, -6.653369, 5.91, -6.7036514, 0.33979297, 0.08696228, -7.20367, 0.26656735,
+    -0.02531418, -5.004444, 5.87, -0.0054565757, -0.08980044, 5.75, 0.07631425, 0.008428218,
+    -8.328821, 6.26, -8.85124, 6.22, 0.29137588, 0.12446083, 6.14, 0.19818476,
+    -0.10845999, -8.718564, -10.19933, 0.00581741, -0.0848193, -8.577097, 0.2636618, 0.07458704,
+    -7.3014965, 6.06, -7.722872, 0.16800718, 0.018529566, -7.485508, -0.056193937, -0.1666871,
+    6.18, -6.2222686, -0.0807683, 0.0066677043, -6.2553506, 0.06740887, -0.050845098, -7.9547505,
+    -9.50892, 7.73, -11.018427, -11.773308, 0.0008196396, -0.064218916, 7.61, 0.24060689,
+    0.042802382, 7.85, -11.515594, 0.020856345, -0.11773838, -9.684118, 0.02935542, -0.16491929,
+    7.81, -9.193894, 7.73, 0.2594686, 0.12058318, -8.718564, 0.3391696, 0.08812561,
+    7.93, -8.577097, -0.045567628, 0.17089395, -8.718564, 0.022686532, -0.07737359, 7.97,
+    0.2975627, -7.667374, 8.01, -7.832062, -0.055892944, 0.11050663, -7.7751694, -0.005298545,
+    -0.10778675, 8.05, -7.5297284, 0.19875132, 0.084344916, -7.3014965, 0.012056681, 0.22316895,
+    -7.3987164, 8.36, -7.485508, 8.13, -8.328821, -8.718564, -0.043264437, -0.15292263,
+    -7.832062, -0.013981804, -0.072906494, -7.5758924, -8.018251, 0.0048401738, -0.055009734, 8.17,
+    -0.042602923, 0.15729463, 8.13, 0.071020074, -0.1986907, -8.113236, 8.44, 0.09217806,
+    -0.026272455, 9.88, -7.832062, -8.018251, 0.027614703, -0.041487146, -7.722872, 0.020905206,
+    -0.011188388, -7.444791, 9.96, -0.0032839798, 0.008625324, 9.92, 0.029464288, 0.12898636,
+    8.13, -7.2534256, 0.17783661, -7.20367, 0.039769746, -7.054926, 0.11679121, 0.022258759,
+    -5.5945034, 8.36, -6.7859416, 8.2, 0.029931147, -0.025850315, 8.24, 0.2159947,
+    0.0455622, 9.8, -6.286212, -0.0055812392, 0.0023722309, -7.3014965, 0.01699314, 0.06519272,
+    8.91, 8.83, 0.14168397, 8.87, 0.030420432, 0.0835669, -5.5490093, 8.99,
+    -0.03146572, 0.02990426, 0.084880725, -12.377764, -19.22157, -19.428238, 6.83, 1.88,
+    1.81, -19.668941, -0.00007357101, 0.020817844, -19.539429, -0.1922267, -0.017256547, 6.72,
+    -19.76686, 0.1579438, 0.023753053, -23.178364, 0.09704753, -0.06810366, -19.668941, -19.876776,
+    6.99, -0.0376528, 0.007076735, 7.06, -0.082024194, 0.28800842, -19.539429, 7.18,
+    -0.71196645, 0.07207886, 7.1, -0.34770432, 0.2068259, 7.06, 1.3, 1.18,
+    1.14, -0.0061900294, 0.102567196, 1.22, -0.10256958, -0.0009431021, 6.57, 1.81,
+    0.100585364, 0.29565686, 6.91, 0.0143179465, -0.069458775, 7.22, 0.57826996, 7.34,
+    -0.18341014, 7.42, 0.021973928, 0.0009321213, -19.09326, 6.91, 0.99, 0.95,
+    0.91, -0.053187054, 0.017658997, 0.06782809, 1.06, -0.16958466, 1.1, -0.0343091,
+    0.020821763, 7.18, -1.0231034, 7.26, 7.22, 0.058443453, 0.012049357, -0.0651741,
+    -18.977423, 7.1, 6.95, 0.99, -0.076128386, 0.018015964, -0.36407968, 7.18,
+    7.14, 0.86114806, 0.34006006, 7.3, -0.035403825, -0.17215703, 1.69, -14.995561,
+    -15.789676, -0.03935124, 0.06542622, -14.294952, -0.15736872, -0.027487565, 1.88, -12.655651,
+    0.036091622, 0.11369498, 6.53, -0.07650449, -0.0024254045, -11.773308, 6.53, -12.062972,
+    1.93, 1.66, 1.62, 0.027289582, -0.014961751, 1.77, 0.28804907, 0.107432775,
+    2.05, -0.24251454, 4.53, 0.27373657, -0.058613967, 0.3203609, 6.79, 6.57,
+    -0.19191116, -0.10695391, 7.49, 6.91, -12.062972, -0.013912506, 0.03013363, -12.062972,
+    0.118627064, 0.38026795, 7.73, -12.062972, -0.072030865, 0.02547513, 7.81, 0.091827676,
+    0.016101368, 1.77, -7.3987164, 1.73, -11.26825, 0.093409985, -10.59073, -0.16033827,
+    -0.009859756, -11.26825, -11.515594, -0.093006395, 0.07114792, -7.9547505, -0.18795182, -0.044152323,
+    -7.3014965, 0.15614776, -6.3148303, -6.4785495, 0.00074634555, -0.15783386, -6.131815, 0.19974747,
+    0.019535998, -11.515594, 6.45, 4.53, 2.05, -0.10502472, 0.007001241, 0.32525074,
+    6.53, -0.64047545, 6.88, 0.17136781, -0.04040706, -11.26825, 6.53, 6.49,
+    0.03712986, 0.79710007, 7.81, -0.06986086, 0.12062492, -10.792877, 7.57, 0.053276252,
+    -0.09591427, -10.59073, 0.044805203, 0.0003980526, -1.3340919, -1.4217949, -1.4536674, -1.6287112,
+    -1.6592834, -1.7983414, -1.9079165, 0.0002827175, -0.01165798, 3.48, -0.020691214, 0.026931275,
+    4.45, 4.41, -0.023512933, -0.38441977, 0.5170906, 3.94, 3.4, 2.9,
+    -0.019222887, 0.050801106, -1.605014, 0.02246192, -0.052611817, -1.5448009, 4.45, 0.023152217,
+    -0.3330432, 4.45, 0.030793777, 0.3912768, 4.14, 3.9, 3.17, 2.9,
+    -0.01647876, 0.046772536, 3.63, -0.05289045, -0.021018665, 4.1, 3.94, 0.018991088,
+    0.0038330078, 0.043200683, 4.45, -0.085580826, -0.34389687, 4.49, 4.45, 2.44,
+    2.33, 2.17, -0.022407023, -0.004572296, 2.37, -0.13800545, -0.056613542, 2.86,
+    -1.362035, 0.097364515, -0.012095365, 3.59, -0.012017482, 0.019668974, -1.362035, -0.39666596,
+    0.80888635, -1.3970085, 0.07960396, -0.377681, 1.93, -1.0684927, 1.88, 0.052461244,
+    -1.2343782, 0.03408915, -0.04855728, -1.0267481, 0.110191345, -0.8777573, -0.0019683838, 0.072037354,
+    2.21, -0.54071695, 2.13, -0.5968429, -0.82226276, -0.0024238918, -0.081564434, 2.05,
+    0.08171489, -0.003933716, -0.9247528, 2.17, 0.03968155, -0.083585165, -0.7202588, -0.52996796,
+    -0.15616767, -0.30146822, 2.13, 2.01, 0.036954347, -0.1212314, -0.48152414, 0.34648225,
+    0.13333258, 2.17, 2.09, -0.015783928, 0.037062753, -0.18892978, -0.15705785, -0.011549275,
+    4.49, 4.33, -0.48152414, 2.33, 0.04664702, -0.00048508236, 2.33, -0.031691503,
+    0.00013689234, -1.1948682, 4.45, -0.038005553, -0.69128114, -1.1551399, 0.24069749, -0.022316312,
+    -0.6559018, -0.9247528, 0.09407654, -0.82226276, -0.09187164, -0.0059259036, -0.48152414, 0.10207825,
+    0.005260086, -5.784454, -6.1923833, -6.2222686, -6.3485193, -6.389413, -6.5924907, -6.618714,
+    0.0001944183, 0.030854631, 4.57, -0.20327683, -0.0023837877, 9.42, 8.56, 0.026838303,
+    -0.122008, 9.5, 0.13563427, 0.049602892, 5.79, 4.53, 2.21, 0.057153102,
+    -0.42993546, 4.57, 0.910378, 0.103927925, 5.99, 5.95, -0.34218165, -0.14001058,
+    9.34, 0.029205946, -0.034931112, 5.99, 1.85, -0.20834859, 5.79, 1.93,
+    0.034383774, 0.2317683, 5.95, 0.022808228, 0.10751992, 6.41, 6.1, -0.009907913,
+    -0.24287446, 8.68, 8.52, -0.013877563, 0.06222973, 9.42, -0.09157683, 0.06315308,
+    8.6, 4.53, 2.17, -6.131815, 0.18075378, 1.93, -0.12383486, 0.01880661,
+    -0.4007899, 5.75, -6.1628103, 0.73756206, 4.61, -0.30189496, 0.14710103, 5.83,
+    -5.987348, 0.06959534, -0.07962799, -5.987348, 0.022438932, 0.059614945, -5.842078, 8.87,
+    -6.0905485, -6.131815, -0.0080367355, -0.14878951, -5.878716, -0.004638681, -0.07446764, 9.34,
+    -6.131815, 0.035438493, -0.014239751, -6.0905485, -0.0083070025, 0.08673802, 8.87, 8.83,
+    8.72, 0.097314455, 0.02063238, 0.18611184, 9.23, 9.18, 0.0054363455, -0.060891386,
+    0.08328294, 5.24, -5.5490093, 2.17, 1.85, 1.77, -5.682901, 0.041775513,
+    -0.09092331, -0.090700276, -5.750133, 0.09635391, 1.97, 0.06482048, -0.042453956, -5.6420994,
+    -5.682901, 0.41058904, -0.20209122, 0.9386879, -5.254704, 2.21, -5.4127874, 1.77,
+    0.16299362, -0.08240119, 1.97, -0.02248459, 0.13863125, -5.4127874, 4.53, -0.79080355,
+    0.29359773, -1.4026047, -3.9679167, 4.53, 4.49, -0.008758745, -0.89803165, -4.4179254,
+    0.23998009, 0.04110863, 1.81, -3.7061508, 0.043351237, 0.14410554, 5.0, 0.0008716628,
+    -0.011836062, 9.18, -3.4696734, 5.28, -4.2262564, -4.32814, 0.20428482, 0.096074134,
+    -4.127986, -0.08706563, -0.22815016, -4.2262564, -4.32814, -0.009977669, -0.13896094, 5.55,
+    -0.018567298, 0.035895657, 5.32, -2.907736, 5.28, 0.0710966, 0.16572317, -2.8076367,
+    0.027510706, -0.029089842, 5.63, 5.6, -0.013991852, 0.09654736, 5.72, -0.08302417,
+    -0.008982239, -5.750133, 9.23, -0.09983928, 0.016094971, 9.23, 0.12025125, -0.04754715,
+    8.95, 8.76, 8.72, 4.73, 4.49, 4.41, 4.14, 0.0004197034,
+    -0.008292552, -3.0695794, 0.19702077, -0.0021318623, -16.183819, -17.897657, 0.13959332, -0.7164143,
+    -14.294952, 0.90686315, -0.020162543, 4.85, -3.5361924, 4.77, 0.054362055, 0.10099646,
+    -2.196643, 0.020139737, -0.029991785, -3.7527802, 5.04, 0.10637251, 0.00076534564, -3.7061508,
+    -0.08073052, -0.004475603, -6.0203667, -6.7859416, -0.18955283, -6.3485193, -6.5924907, -0.059501804,
+    -0.013722229, -6.0520425, -0.09002087, -0.18106842, -5.842078, -5.949599, -5.987348, 0.0745697,
+    -0.02921753, -5.9075212, 0.12946878, 0.05155884, -5.750133, -5.813874, -0.10730795, -0.033052936,
+    -5.7152433, 0.12121277, 0.044107474, -6.131815, -6.511228, 8.83, -6.618714, 8.8,
+    -0.014454396, -0.043119594, -6.5553975, 0.042209055, -0.0057952884, -6.7036514, 8.87, 0.016066285,
+    0.09298706, 8.87, 0.0414416, -0.050843377, -6.2222686, 8.87, -6.2553506, 0.08137748,
+    0.19736023, -6.4524984, 0.08423277, 0.0171659, 8.83, -6.1628103, -0.12977432, 0.020756532,
+    -6.1923833, 0.040166803, 0.11842867, -6.0905485, 8.83, 8.8, -0.1223217, 0.047757532,
+    -0.1898291, -5.949599, -6.0520425, 8.87, 0.0589347, -0.12935232, 8.83, 0.06060467,
+    0.114433125, -5.9075212, -0.14234397, -5.6420994, -0.018138494, 0.032646544, 9.14, -6.0203667,
+    -6.0520425, 9.03, -6.1628103, -6.2553506, 0.014867656, -0.062235948, -6.131815, 0.081834316,
+    -0.022804642, -6.4524984, -6.5924907, 0.015107155, 0.027833048, -6.417596, -0.13432303, -0.037628923,
+    9.1, -0.16688326, 0.061019517, -5.987348, 9.03, 0.06565116, 9.1, 0.18187766,
+    0.0810936, -5.6420994, -5.9075212, 8.99, 0.027249146, -0.07441124, -5.813874, 0.008906185,
+    -0.033819377, 9.03, -5.5490093, -0.036163997, 0.0683313, 0.048191834, -5.7152433, -5.784454,
+    -5.813874, -6.0203667, 9.3, 0.03697758, -0.003292127, 9.3, -0.05088502, 0.07915983,
+    9.18, 0.16795532, 9.23, -0.012225342, 0.060981244, 9.18, -5.750133, -0.03706787,
+    -0.14926879, -5.750133, 9.23, -0.08319957, 0.013519287, 9.23, 0.08784485, -0.04279251,
+    -5.6420994, -5.682901, 9.18, -0.07222557, 0.09544242, 0.11116066, -0.081688695, -12.377764,
+    7.42, -12.655651, -12.962669, -13.614294, -14.294952, 7.3, 0.00063628884, -0.02479368,
+    6.53, -0.047414675, 0.05754595, 6.53, 4.53, 0.02167637, -0.9420123, 6.99,
+    0.004294449, 0.16941597, 2.01, 1.77, 1.66, -0.0036801149, 0.114489235, 1.85,
+    -0.085122176, -0.26979357, 6.53, 0.8158514, 6.95, -0.09610682, 0.109270476, 6.53,
+    4.57, 2.01, 1.88, 0.06644304, -0.1562472, 0.205513, -0.9996358, 6.95,
+    6.72, 0.050506677, 6.83, -0.03472837, 0.021211242, 0.16026816, -20.516748, -21.69312,
+    -22.12889, 7.46, -27.639406, 0.023201752, 0.11262455, 7.49, -0.05135376, 0.04355545,
+    -0.07834893, -20.981464, 0.101144865, 7.46, 0.07915764, 7.49, 0.0009063721, 0.011177445,
+    7.57, -13.286145, -14.294952, -14.672277, -0.043263067, 0.046100106, 7.53, -0.026559895,
+    -0.16462624, 7.53, -12.655651, 0.0007753812, 0.02574183, -12.655651, 0.024983216, -0.05293457,
+    -13.286145, 7.77, -13.614294, 0.016510101, 0.09982168, -13.614294, -0.111755826, -0.007712708,
+    7.69, 7.61, 0.027854836, -0.12439992, -12.655651, -0.028240627, 0.03604145, 1.66,
+    -12.062972, 1.62, 0.024471283, -0.013085938, -11.773308, 0.3188568, -10.396682, -11.018427,
+    -11.515594, 0.08801422, -0.030125936, 0.15070648, -10.025825, -0.08694458, 0.085279845, -11.773308,
+    6.53, -12.062972, 1.93, 1.77, 0.24952343, 0.08886196, 2.05, -0.21029866,
+    0.08729096, 2.01, 1.97, 0.13607362, -0.028067399, 0.3690511, 6.79, 6.57,
+    -0.16140458, -0.08681884, 7.49, 6.91, 0.0052851676, 0.20751731, 7.69, -0.018815476,
+    0.037945803, 1.77, -9.684118, -11.26825, -11.515594, -0.046378326, 0.06833611, -11.018427,
+    -0.2526993, -0.10262146, -9.50892, 0.14553986, -7.3987164, -0.06159092, 0.026415372, -11.515594,
+    6.45, 4.53, -0.066833876, 0.27083665, 6.53, -0.53819823, 0.0027489418, -11.26825,
+    7.57, 0.10595001, -0.08991757, 2.05, 0.013738923, -0.00006419117, -1.3340919, -1.4217949,
+    -1.4536674, -3.593756, -3.6424093, 4.57, 2.13, -0.00029030515, -0.048256, 5.08,
+    0.046814594, 0.000020419451, 4.69, 2.21, -0.08713589, -0.28200278, 4.93, 0.011273987,
+    -0.08510821, 2.33, 2.09, -2.9810855, 0.09666119, -0.023636593, -1.9079165, 0.04306778,
+    0.16625169, 2.44, 2.37, -0.06581116, -0.31902573, 2.63, 0.07879149, 0.00060561113,
+    4.14, 2.01, 1.88, 0.007856751, 1.93, -0.10906372, -0.030461121, 2.13,
+    0.12042656, 2.37, -0.07989858, -0.0041106916, 4.45, -0.076890185, -0.30937463, 4.49,
+    4.45, 2.44, 2.33, 2.17, -0.020503236, -0.0042377473, 2.37, -0.12432785,
+    -0.048306275, 2.48, -1.362035, 0.23133953, -0.019770814, 4.17, 0.019019697, -0.020480348,
+    -1.362035, -0.35686684, 0.72812957, -1.3970085, 0.07357865, -0.33797762, 1.93, -1.0684927,
+    1.88, 0.04571228, -1.2343782, 0.027540078, -0.045204163, -1.0267481, 0.09766922, -0.8777573,
+    -0.003927612, 0.05810669, 2.21, -0.54071695, 2.13, 1.97, -0.8777573, -0.10914993,
+    0.018454488, -0.82226276, 0.031584974, -0.05480299, -0.9247528, -1.0684927, 0.03949005, -0.079174235,
+    -0.7202588, -0.44536957, -0.1282789, -0.30146822, 2.17, -0.48152414, -0.24397698, 0.0602731,
+    -0.48152414, 0.7539372, -0.039401416, 2.17, 2.09, -0.014593437, 0.029574553, -0.18892978,
+    -0.13034408, -0.009622396, -1.2630312, 2.44, 2.29, -0.102264024, 0.58919144, 3.48,
+    3.24, -0.019457081, -0.1111749, 3.59, 0.0991224, -0.0019851841, 3.13, -0.9247528,
+    2.29, -0.37185237, -0.019819617, -0.771789, 0.043455914, -0.0022397633, -1.2343782, 4.06,
+    0.105895236, -0.013821888, 3.44, 0.021110427, -0.015419312, -5.784454, -6.1923833, -6.2222686,
+    -6.5924907, -6.618714, 8.2, -7.722872, 0.000040449602, 0.020101039, 8.83, -0.016095249,
+    0.001644565, 5.99, 1.88, 0.058158368, -0.22842382, 8.68, 0.08927928, 0.01027304,
+    5.79, -6.417596, 4.53, 0.13460703, -0.6201429, 4.53, -0.00012715659, 0.40550676,
+    6.18, 5.87, -0.01869833, -0.16579394, 8.4, 0.051885735, -0.0035737697, 9.3,
+    1.85, -0.18241781, 5.83, 1.93, 0.029558564, 0.17628251, 6.41, -0.08528465,
+    -0.010362126, 9.42, 9.34, -0.04885597, 9.38, -0.25541028, -0.124140166, 0.053581543,
+    6.18, -5.9075212, 4.53, 2.17, -6.131815, 0.15212981, -0.063175395, -0.4129818,
+    5.75, -6.1628103, 0.64373726, 0.09509964, -6.131815, -0.073068306, 0.09281815, 4.61,
+    -5.878716, -0.18383217, 1.93, -0.085696414, 0.05308075, 5.72, 0.13686028, 5.83,
+    -0.07604546, 0.010590483, -6.131815, 8.64, 6.37, 6.34, 0.024906414, -0.25237083,
+    -6.1628103, 0.19130193, 0.0349322, 9.14, -6.1628103, -0.050275546, 0.024724975, 9.3,
+    0.12190276, -0.014881501, -6.0520425, 9.38, -6.0905485, -0.09306702, -0.037809394, 9.42,
+    0.09250911, -0.03806839, 9.3, 8.8, 0.023810318, -0.0076786513, 9.38, 0.0629667,
+    -0.12622528, 5.63, -5.5490093, 2.17, 2.01, 1.85, -0.06809082, 1.97,
+    0.056951523, -0.076143265, -5.750133, 0.08533134, 2.05, -0.046588134, 0.052575685, 4.57,
+    -5.6420994, -5.682901, 0.35927278, -0.17503396, 0.85166705, -5.6420994, 0.18246816, 5.6,
+    0.09222946, 0.030130005, -5.254704, 4.57, 2.21, -5.4127874, -0.03287674, 0.04745836,
+    -5.4127874, -0.06551224, -1.2064601, 5.6, 5.55, 0.17461635, 0.104679875, -5.4127874,
+    0.071121216, -0.03223877, -5.004444, 4.49, 2.25, -0.003916386, -0.31185395, 4.57,
+    0.5775915, 0.038089283, 5.44, -4.0418863, 0.029624222, -0.0006233332, -4.2262564, -0.06830179,
+    0.006407205, 5.79, 5.75, -4.894484, -5.4127874, -5.5490093, -0.04284446, 0.10834097,
+    5.72, -0.14042322, 0.037881747, -3.4696734, -4.524055, 0.060821183, 0.0077864723, 5.72,
+    -0.06687518, -0.017063523, -3.8950949, -4.2262564, -0.102611296, -4.127986, 0.011329079, -0.10643959,
+    -3.5361924, -3.7527802, 0.045605723, -0.05550251, 0.047522735, -4.750224, -4.894484, 5.91,
+    -5.004444, -0.06930185, 0.054179724, -5.4127874, -0.009227639, 0.047913004, 5.95, 5.87,
+    -0.060317338, -0.025564957, 6.1, -0.16673326, -0.016819, 5.99, 5.83, -3.9679167,
+    -0.020725958, 0.042899553, -4.32814, 0.06222705, 0.03592105, 6.1, -4.2262564, -0.038091805,
+    0.054037858, 0.077631, 4.69, 4.45, 4.41, 4.29, 4.14, 3.48,
+    3.4, -0.00045512817, -0.018485628, -0.9800166, 0.006765148, -0.06431999, -2.357731, 4.17,
+    -0.0115737915, 0.044839226, -1.6862178, -0.037719622, 0.004078345, -2.068156, 4.36, -2.3197646,
+    0.13879338, 0.0066527883, -2.2551181, -0.015129852, 0.1384985, -2.040998, -0.26511765, -1.8541082,
+    0.0393532, -0.02081147, -3.0695794, 0.58651733, -1.9313097, -2.0923567, -2.1208782, 0.03151474,
+    -0.376888, -2.040998, 0.31371677, 0.13452423, -1.8803589, -1.9079165, -0.04105301, -0.30551013,
+    -1.8541082, 0.35116223, -0.004034228, -7.617456, -7.832062, -7.9547505, -8.328821, -10.19933,
+    -0.06651094, 0.17911142, 1.2069112, -1.4583759, 1.2690643, -6.4524984, -7.1032915, 4.53,
+    -7.5297284, 0.3454914, -1.0944034, -7.5758924, -0.60179025, 0.84049743, 4.53, 0.47939035,
+    -7.054926, -1.6663071, -0.65068895, -5.5490093, 4.53, -5.784454, -0.43656978, 0.09209557,
+    -6.1628103, 0.89766884, 0.1572545, -5.1183767, -5.4127874, -0.02056338, -0.5171593, -4.2262564,
+    0.099738635, -0.03223584, 4.85, -2.907736, -2.9810855, -3.1480272, -3.3498714, -3.4696734,
+    0.046378925, -0.028560722, 4.73, 0.004497746, 0.086668596, 4.73, -3.0695794, 0.005562846,
+    0.0325779, -3.0695794, -0.047743734, -0.016291428, 0.09522428, -2.8076367, 4.73, -0.078980066,
+    -0.020515595, -2.196643, -2.4040701, -2.7231896, 0.035730314, -0.024702374, 4.73, 0.00039978029,
+    0.06443999, -2.173437, -0.012036811, -0.032427106, -2.357731, 5.2, -4.127986, 5.16,
+    0.2781662, -4.2262564, 0.15123902, 0.057076007, -3.9679167, 5.12, 0.092413776, -0.012184429,
+    -2.8076367, -0.0052936864, 0.015481034, -4.524055, 5.55, -4.894484, 0.114663005, 0.011306278,
+    -5.784454, 0.0011623161, -0.009376138, -4.2262564, 5.28, 0.110363595, -0.05641055, 5.28,
+    -0.04497519, 0.004839591, -2.0923567, -2.2551181, 4.97, 4.93, 0.024937766, 0.0063333134,
+    5.0, -0.013372498, -0.046786148, 5.04, -2.1208782, -0.06801587, -0.029496575, 5.08,
+    0.0075384523, -0.038120523, -2.068156, 0.04902935, -0.03048617, -34.72578, -36.19027, -37.815678,
+    7.1, 7.06, 6.91, 1.54, -0.0063479613, 0.03294225, 6.95, -0.11658447,
+    0.012927766, -40.02452, -45.980717, 0.15628318, 0.011099498, 0.15354563, 7.18, -42.560875,
+    -45.980717, -0.022699585, -0.17508672, -40.02452, 0.023211671, -0.02805748, 7.22, -42.560875,
+    0.13255464, -0.031174278, -45.980717, -0.073301956, -0.00071735383, 6.99, 6.88, 1.42,
+    1.38, -0.014598553, 0.49856874, 1.46, -0.21297912, -0.01192894, 6.91, 0.32113954,
+    0.12936535, 7.03, -0.26334637, 7.06, 0.28065187, 7.1, -0.23973592, 0.071437076,
+    6.99, 6.91, 1.58, 1.46, 1.42, -0.0042503974, -0.17086335, 1.5,
+    0.015189171, 0.06091258, -0.1621157, 6.95, 0.35077363, -0.015418499, 7.06, 7.03,
+    -0.07342491, -0.30422744, 7.1, 0.25248298, 7.18, -0.27446112, 7.26, -0.068590164,
+    -0.0042846682, -33.599087, 1.54, 1.46, 1.42, 1.38, 1.34, -0.0042663575,
+    0.14022675, -0.28705293, 0.3045339, -0.15831871, 1.66, 1.58, 0.05015869, 1.62,
+    0.49742332, 0.13582967, 1.69, -0.3593773, 7.03, 6.95, 0.023816427, -0.12416871,
+    7.3, 0.16398361, -0.03094368, -24.11707, 1.5, 1.42, 1.38, 1.3,
+    0.0028673874, -0.04563982, -30.874868, 0.22068508, -0.24564262, -24.864492, -30.874868, -0.17064908,
+    0.10158451, -24.452414, 1.2027396, 0.22798248, 1.58, -24.864492, 1.54, 0.061957855,
+    -0.19319014, -24.452414, -0.5917066, -1.308554, 6.83, -30.058292, -0.17992905, 0.118153825,
+    7.1, -0.03806057, 0.018771676, 0.44, -0.16375612, -23.813517, 7.18, 7.14,
+    0.06451122, 0.6928978, 7.22, -0.9514996, 0.004946518, -23.477354, 7.1, -0.0037565585,
+    -0.18554662, 0.48, -0.10343514, 0.00021524406, -0.07408267, -3.593756, -3.6424093, -3.8215072,
+    -4.127986, -4.32814, -4.524055, -0.000020581736, 0.014243322, 4.65, -0.17067616, 0.004234441,
+    5.08, 4.57, -0.080306515, 0.11765583, 5.32, -0.06063376, 0.01715564, 4.65,
+    2.13, 1.93, -0.03814621, 0.090574645, 4.57, -0.3488875, -0.11051827, 4.97,
+    -3.7527802, 0.10044879, 0.0293995, -3.7061508, -0.05085686, 0.018938847, 4.69, 2.21,
+    1.93, 1.85, -0.13576356, -0.03545456, 0.023347093, 4.61, -0.410923, 4.65,
+    0.07352906, -0.2587026, 4.93, 4.77, 4.73, -0.0023059081, -0.008299256, 4.85,
+    0.024961472, -0.0054007634, 5.4, 5.24, -0.05412655, -0.21034108, 5.75, -0.010239029,
+    0.067164615, -3.2776601, -3.3498714, -3.4047515, 2.25, -3.4696734, 0.13395877, -0.037459563,
+    4.57, -0.24935596, 0.025759397, 4.49, 2.21, -0.049959566, 0.50201494, 4.69,
+    -0.13540024, -0.055925276, 4.57, 4.49, 1.85, -0.08401413, 0.15358353, -0.5802628,
+    4.65, 0.29580933, 5.52, 0.086654186, 0.02231474, -3.1480272, 4.61, 2.25,
+    2.13, 0.1348123, -0.07897835, -0.54753125, 4.85, -3.2152596, 0.12107203, -0.007082367,
+    -3.2152596, -0.056603987, -0.0025416904, 5.12, -2.9810855, 4.45, 0.09288115, -0.06763069,
+    5.0, 0.001230385, -0.026835347, -2.9810855, -3.0695794, 0.011806197, 0.122087955, 5.24,
+    0.03387834, -0.014981798, 2.63, 2.21, 2.09, 2.05, -0.058459997, 2.01,
+    0.003085327, -0.00046997072, 2.01, -0.00076675415, 0.060863238, -0.058459997, 0.008349228, -0.020436479,
+    -0.040638376, 2.29, -0.058459997, 2.25, 0.06070264, 0.015552848, 2.25, -0.045367625,
+    0.04952221, 2.33, -0.058459997, 0.001067543, -0.08393212, -0.058459997, 2.37, -0.06668454,
+    -0.002000286, 2.37, 0.06986339, -0.004056408, 2.78, 2.71, -0.032379862, -0.058459997,
+    2.74, 0.08056984, -0.033996966, 2.74, -0.05005595, -0.015096538, 0.009661865, -20.188913,
+    -20.28955, 1.34, 0.75, -20.652575, 0.71, -20.981464, 0.0016337365, -0.04265215,
+    -20.803585, 0.40873107, 0.06686263, 0.71, -0.22426502, -20.402336, -0.02087739, -0.1660817,
+    0.83, 0.79, -20.516748, 0.346031, -0.025156338, -20.516748, -0.21311139, 0.5161721,
+    0.99, 0.87, -0.2339531, -0.08263982, 1.06, 0.06046012, 0.011596489, -20.516748,
+    -20.652575, -20.803585, -20.981464, -0.001980687, -0.13518767, 6.99, 0.0202463, 0.27213314,
+    7.14, 7.1, -0.13885388, 0.73965836, 7.22, -1.450689, 0.20115243, 7.14,
+    7.1, 7.03, 0.04687978, 0.9935852, -1.7374886, 7.22, 0.6680799, -20.402336,
+    -0.044251863, 0.2788128, 0.83, 0.75, 0.06496709, -0.14148366, 0.99, 0.95,
+    0.30882618, 0.13155639, 1.42, 1.3, 1.18, -0.07990418, 0.034381103, -0.1210466,
+    7.18, 6.99, 0.18518417, 0.49659997, -0.08962136, 0.75, -0.20351449, 0.91,
+    -20.089907, 0.83, 0.79, 0.049208187, -0.07850384, 0.12168441, -19.76686, 0.87,
+    0.79, -0.060739137, -0.012171189, -19.982029, 0.083857425, 0.036307476, -19.428238, 0.87,
+    -0.023985604, -0.10387205, -19.330385, 0.02921987, -0.062082063, -20.089907, 7.1, 7.06,
+    6.91, -0.048309326, -0.43164825, 1.2417603, 7.18, -1.2772477, 0.06977031, -19.22157,
+    7.1, 7.06, 0.010760278, -0.79549867, 7.14, 0.7300443, -0.040255617, -19.09326,
+    6.91, -0.00254186, -0.37657472, 1.03, -0.03762562, 0.00010094537, 0.67, -21.12554,
+    0.63, -21.325644, -21.50634, 0.59, 0.56, 0.001250252, -0.046043497, -22.12889,
+    0.742363, -0.0048752422, -0.08321183, -0.3447052, -21.69312, 0.46768266, -21.50634, -0.27334657,
+    -21.325644, 0.092846684, 0.026363019, -0.11125187, 0.99, -21.325644, 0.6025154, -20.803585,
+    0.71, -20.981464, -21.12554, 0.02667961, 0.12953961, -0.013903255, -20.981464, 0.047069296,
+    0.52515465, 0.71, -20.652575, -0.025314493, -0.18439552, -20.516748, 0.79, 0.07792778,
+    -0.18469645, 0.79, -0.04562231, 0.010093492, 1.46, -19.76686, -20.28955, 1.38,
+    -40.02452, 0.1269928, 0.008405465, -25.69593, 0.0021795635, -0.06888083, 1.34, 1.1,
+    -0.089598686, -0.037104126, 1.38, -0.20378037, -0.031891253, -19.428238, 1.3, 1.03,
+    0.12376145, 0.04841801, 1.34, -0.13839817, -0.017506028, 1.26, 1.03, -0.028302392,
+    0.005936861, -0.12269638, 1.69, -25.265562, -26.084858, -26.572838, -0.0027522005, 0.2076532,
+    1.58, -0.38220438, 0.119913995, -24.452414, 1.5, 0.89911, -0.02255915, 1.5,
+    -0.09691642, 0.029842261, -42.560875, 6.88, -0.13531443, -51.15694, 0.067063905, -0.013272702,
+    -30.058292, 6.95, 0.08899876, -0.012177816, -23.178364, -0.015215327, 0.00016270882, -20.188913,
+    -20.28955, 6.99, 6.83, 1.88, 1.77, -22.377066, -0.0015798496, 0.0074620782,
+    -25.265562, 0.03330597, -0.15144628, -20.981464, -21.50634, 0.046982344, -0.2205433, 6.76,
+    0.075591125, 0.24171638, -26.572838, -27.161629, -27.639406, 0.015464176, -0.15653948, 6.95,
+    -0.021832785, 0.7081375, -21.325644, 6.91, -0.07854836, -0.21176377, -20.981464, -0.0017140199,
+    0.13762741, -20.981464, -21.50634, 7.06, -24.11707, -0.0021375427, 0.41038403, -22.377066,
+    0.0049437676, -0.08622125, 7.22, 7.06, -0.12337132, 0.4362639, 7.42, -0.005316162,
+    0.06834984, 7.14, 7.1, -20.402336, -0.22661705, 0.8942108, -1.2595764, -20.516748,
+    7.22, -0.34929302, 0.056260046, 7.22, 0.57898104, 0.05264003, 0.83, 0.75,
+    0.06174304, 0.79, -0.08446749, -0.1404833, 1.03, 0.95, 0.25212997, 0.114724986,
+    1.42, 1.3, 1.18, -0.0767022, 0.034848023, 1.34, -0.1055872, -0.028702164,
+    1.5, 0.4867874, 7.18, 0.14479469, -0.07620259, 0.75, -0.1786007, 0.91,
+    -19.76686, 0.87, -20.089907, 0.79, 0.04854619, -0.025422568, 0.79, -0.040586453,
+    -0.011763935, -19.982029, 0.09761103, -19.876776, 0.004005432, 0.04783039, -19.428238, 0.87,
+    -19.539429, -0.010767127, -0.047054913, -19.539429, -0.105741255, -0.012182872, -19.330385, 0.87,
+    -0.019524766, 0.033859763, -0.05272446, -20.089907, 7.1, 7.06, 6.91, -0.034067195,
+    -0.37411702, 1.1175683, 7.18, -1.1495392, 0.060445663, -19.22157, 7.1, 7.06,
+    0.008818156, -0.68945414, 7.14, 0.6048667, -0.0324877, -19.09326, 6.91, -0.002547849,
+    -0.31204703, -18.977423, 0.028353438, -0.00021288574, 7.14, 6.64, 6.57, 6.14,
+    5.6, 5.48, 5.4, -0.0002827339, 0.015076473, -5.1183767, 0.0883664, -0.029692797,
+    -8.577097, 0.28750893, -6.653369, 0.033793207, -0.0045189685, -10.19933, 6.37, -10.792877,
+    0.27215576, 0.093529694, -11.018427, 0.030969707, -0.05624286, -10.025825, 6.3, 0.058869716,
+    -0.17149986, -9.50892, 0.024273958, -0.02190091, -9.193894, 6.6, -16.183819, -18.367512,
+    0.07110574, 0.23778014, -14.294952, -0.008960655, 0.06904449, -11.773308, -13.286145, 0.012769426,
+    -0.08177929, -10.792877, 0.16441016, 0.014887943, -0.1544675, -18.7905, -19.09326, -24.864492,
+    -25.265562, -25.69593, -0.005282687, 0.061734837, 7.06, 0.04875956, -1.4826887, -24.452414,
+    6.99, 0.019170888, 0.71126544, 7.03, -0.023850923, 0.066114776, 7.1, 6.99,
+    6.72, 0.13937989, -0.07205211, -0.31815434, 1.6114234, 7.1, 7.06, 6.83,
+    -11.773308, -0.041029844, -0.0007415227, -16.991007, 0.16376525, -0.0010778474, -0.22219555, -18.367512,
+    -1.2783742, -17.897657, 0.6202856, -1.2549764, -5.7152433, -5.784454, -5.842078, -24.864492,
+    -25.265562, -25.69593, 0.014151444, -0.12535572, 7.22, 0.4351804, -0.02286789, -24.452414,
+    7.22, -0.87120545, 0.17262192, -24.11707, 0.271286, -0.00018545704, 8.87, 8.83,
+    8.8, 0.0609169, -0.0526268, 0.16186295, 9.14, 9.1, 0.0077770585, -0.08995446,
+    9.18, 0.13166021, 0.024677169, 8.68, 8.64, -0.0018783569, 0.09756673, 9.18,
+    8.8, 8.72, -0.06211446, 0.012657635, 8.91, -0.088798456, -0.035608027, -5.750133,
+    9.23, -0.06626613, 0.014300537, 9.23, 0.07569237, -0.036672976, 8.87, -5.682901,
+    8.8, 8.76, 8.72, 0.06883202, 0.029892579, -0.026690675, 0.17544499, -5.6420994,
+    8.76, 8.72, 0.08173523, 0.029461417, 8.8, -0.13836305, 0.0065374756, 8.83,
+    0.099378966, -5.5945034, -0.02025884, 0.024526723, 9.1, -5.5945034, 9.07, -5.682901,
+    -0.06726553, -0.024821144, -5.682901, 0.16187821, 0.0022386338, 9.07, 9.03, 0.018669637,
+    0.08531978, -0.061617024, -5.6420994, -5.682901, 9.14, 0.12495524, 0.034112245, 9.14,
+    -0.045999758, 0.09492798, 9.14, 0.033673927, -0.07167969, -10.792877, 7.57, -12.062972,
+    7.46, -12.377764, -12.655651, 7.38, 0.00045221925, -0.0188714, 6.53, -0.1531497,
+    0.044274554, 6.91, 4.53, 0.083511785, -0.06361132, 0.16260497, -12.377764, -19.22157,
+    7.49, -0.035947897, 0.03829183, -18.7905, -0.13786411, -0.017977461, 7.49, -0.12567545,
+    7.53, -0.0046562194, -0.11397362, 4.49, 2.05, -11.773308, 1.88, 0.21548569,
+    0.0021764121, 1.66, 0.025474548, -0.082175784, -1.00369, 6.49, 6.45, 6.37,
+    0.19756012, 0.061159592, 0.26196596, -11.018427, -11.515594, -0.009071014, 0.16052866, 6.53,
+    -0.95643616, 0.14349525, -11.515594, -14.294952, -15.410659, -16.605732, -17.897657, 0.046504974,
+    0.013392778, 7.65, -0.01269781, -0.061472606, 7.65, -14.672277, 0.192476, 0.052713316,
+    7.73, 0.04665112, -0.056382496, 7.69, -12.062972, 7.65, -0.03129058, -0.12510315,
+    7.61, -0.05415192, 0.039902437, 7.81, -13.937053, -0.046263125, 0.03497456, -12.962669,
+    -0.1072094, -0.00717796, 7.81, -11.018427, 7.73, 7.65, -0.25972492, -0.026832936,
+    -0.317772, 7.73, 7.69, -0.029559428, 0.2053767, -0.16234589, -11.26825, 7.93,
+    0.14253655, 0.05824188, 7.85, -0.10266053, -11.018427, -0.029757692, 0.08586951, -10.59073,
+    7.73, 1.85, 1.81, 1.69, -0.10521393, 0.0076466883, -0.13859025, 6.34,
+    2.05, 1.97, 0.0013629914, 0.058815002, 0.26090515, 6.45, 6.37, 0.0016743978,
+    -0.048981823, 6.6, 0.20234561, 0.05733275, 7.85, 7.77, -0.05981064, -0.17748247,
+    8.01, 7.97, 7.93, 0.0322995, -0.0014694214, 0.1134079, -0.057814028, -10.396682,
+    4.57, 1.73, 1.69, 0.1128245, -0.016323853, -0.7054367, 7.61, 6.49,
+    6.41, 0.034706116, -0.1780543, 6.53, 0.46769053, 0.123529874, 7.89, 7.65,
+    -0.16384034, -0.10178169, 8.01, 0.11620392, -0.060985565, -9.684118, 6.3, 4.53,
+    -9.847813, -0.033688005, 0.13788071, 4.57, 0.79063267, 0.10345445, 6.49, 6.45,
+    -0.13575101, -0.046266515, 6.53, 0.6394815, 0.011950134, -9.029197, 6.26, 4.57,
+    0.014966965, 0.20340393, 6.53, -0.12406057, -0.011023035, -8.718564, 6.64, -0.028193919,
+    0.065015815, 1.88, -0.014966244, 0.00016643046, 7.14, 7.03, -27.161629, -27.639406,
+    -28.209562, 6.99, 0.27, -0.0023872508, 0.008643243, -29.518152, -0.034574, 0.50127834,
+    6.99, 6.95, -0.036351103, 0.6523857, -0.64763796, 1.42, 0.31, 0.10113063,
+    0.35, -0.67279494, -0.23461437, 1.62, 1.46, 0.76478475, 0.33646744, 6.99,
+    -0.11730551, 0.54114306, 0.31, -0.69639874, 0.35, -26.572838, 0.13555932, -26.084858,
+    -0.00067675195, -0.22790642, -26.572838, 1.62, -0.32532212, 0.090661824, -26.084858, 0.065557525,
+    -0.00041435618, -18.7905, -18.977423, -23.178364, -25.265562, -25.69593, -0.0342976, 0.5536341,
+    -24.864492, -0.7212633, -0.018938482, -21.931791, 7.06, 1.013409, 0.16550659, -19.539429,
+    -0.133066, 0.22892904, 1.4841026, 7.1, 7.06, -16.183819, -16.605732, -0.035665132,
+    0.0712471, -0.11487179, -18.367512, -0.051822662, -0.19760577, -18.367512, -1.1079849, -17.897657,
+    0.53752035, -1.0877064, -18.7905, -18.977423, -20.188913, -20.516748, -20.652575, -21.325644,
+    -0.0044245776, 0.14153148, 7.22, -1.2707341, 0.16344224, 7.22, 0.59251976, 7.26,
+    0.13441977, -0.057058822, -20.089907, 7.18, -1.0346119, 0.04982834, -19.668941, 7.18,
+    0.32989687, -0.06275017, 7.18, -0.32009932, -0.006407992, 7.18, -1.7674481, 7.3,
+    7.22, 0.305291, 0.09339142, 7.53, -0.09321842, -0.02574412, 7.18, -18.367512,
+    0.5727234, -17.897657, 0.104824066, 0.39371988, 7.22, -17.44737, -0.04886551, 0.19110787,
+    -16.183819, 7.3, 7.26, -0.022867203, -0.22074378, -17.897657, 0.05960383, -0.015578518,
+    7.3, -15.410659, 0.029223887, 0.22175156, -14.672277, -0.025719497, 0.0015015075, 7.97,
+    7.49, 7.46, 7.18, 5.95, 5.79, 5.75, 0.00015834792, -0.013941976,
+    -6.7036514, 0.17990898, -0.0073875296, -8.21763, 6.14, 0.13255784, -0.00038317373, -7.3014965,
+    -0.04204884, -0.0073897275, -13.937053, 7.34, -22.656353, -0.036289524, 0.036465682, -15.789676,
+    -0.00498578, -0.06283514, 7.38, 0.18407333, -12.655651, 0.021195447, 0.15225665, -14.672277,
+    -24.864492, -25.69593, 0.0045974734, 0.01932831, -16.605732, -18.367512, -0.09618912, 0.030863,
+    -0.10040138, -11.773308, -12.062972, -14.294952, 0.12715098, -0.0143301105, 0.2405651, -0.16965103,
+    -8.21763, 7.89, -9.847813, 7.65, -10.396682, 0.0042282655, 0.30276352, -11.26825,
+    -0.0027072767, -0.06727125, -8.453863, 7.85, 0.10717338, -0.09856087, 0.29447007, -8.718564,
+    -8.85124, -9.193894, 0.008808984, -0.09282794, 7.93, 0.027316285, 0.23099855, -8.577097,
+    -0.25498447, 7.93, -0.05014057, -0.1392634, 7.93, 0.2939131, -8.018251, -0.07136841,
+    0.22814076, -8.328821, -8.718564, -8.85124, -9.684118, 8.01, -11.018427, -0.0016259765,
+    0.09866557, -10.19933, -0.055010017, 0.016695444, -9.349648, 8.01, -0.19346784, -0.056344416,
+    8.24, -0.025646377, -0.15204087, 8.05, 0.22474746, 8.24, 8.09, -0.0056447345,
+    0.057014164, 0.12543213, -8.577097, 8.13, -0.180288, 8.2, 8.17, 0.0034561157,
+    0.01975708, 8.32, -0.1289463, 0.023364259, -8.453863, 8.09, 8.05, 0.020082856,
+    0.06728821, 8.13, -0.12340444, 0.03605722, 8.17, -0.109810166, 8.28, -0.033099364,
+    0.04950695, -8.21763, 8.09, 8.01, -0.060816195, 0.19591741, 8.24, 8.17,
+    8.13, -0.0100183105, 0.0118296305, 8.2, -0.09108963, 0.012361908, 8.32, 0.1434873,
+    0.043995056, -7.832062, 8.05, -8.113236, -0.14637177, -8.018251, 0.023674883, -0.07267176,
+    -8.018251, 8.44, 0.04359786, -0.021925323, 8.44, -0.07858568, 0.0013362642, 8.01,
+    -7.667374, 0.0888731, 0.17257792, 8.17, -7.485508, -0.017809017, 0.062106322, -5.7152433,
+    -0.0019972904, 0.0141861355, 8.09, 7.18, 6.64, 6.57, 6.53, 6.45,
+    6.41, 0.00015680774, -0.049659826, -11.515594, -0.078596175, 0.06581451, -12.377764, -16.991007,
+    0.08524952, -0.0019229412, -9.193894, -0.0891865, -0.19951324, -9.193894, 6.6, -14.995561,
+    0.13865654, 0.023277229, -18.7905, 0.08270089, -0.0019667863, -0.12236195, -14.995561, -16.605732,
+    -16.991007, -18.367512, -0.0035703504, 0.04961604, 6.72, -0.3100522, -0.04885343, 6.72,
+    -15.789676, 0.022561476, 0.1855478, -15.789676, 0.064690255, -0.04490697, -14.294952, 6.88,
+    6.72, -0.10508354, -0.21899639, 6.99, 0.08274718, -0.18212992, -13.937053, 6.95,
+    0.14440727, -0.12357636, -12.655651, -0.07259517, -0.013946076, -8.113236, 7.89, -8.577097,
+    -9.847813, 7.65, 0.0060533485, -0.026440356, 7.81, 0.11429174, -0.036000006, -8.453863,
+    7.85, 0.16346802, -0.0014816284, 0.24146514, -10.025825, -10.19933, 8.05, 0.030656492,
+    -0.10892945, 7.93, -0.058243304, 0.14543037, -8.718564, -8.85124, -0.03886547, 0.15359138,
+    -8.577097, -0.21286023, -0.02529645, 7.97, -8.018251, 7.93, 0.14355774, -0.066234335,
+    0.18492858, -7.667374, -8.018251, 8.05, 0.019616483, 0.090561934, -7.9547505, -0.10318432,
+    -0.008587542, -7.3014965, 8.05, 0.11066424, 0.002149048, 0.18185526, -9.193894, -9.684118,
+    8.13, -9.847813, -10.025825, -10.19933, -0.006551361, -0.031158958, 0.019066239, -0.039273452,
+    -9.847813, 0.045298006, -0.0022750855, -9.349648, -0.08732628, 8.17, 8.13, -0.054244995,
+    0.014748764, -0.04968338, -7.1032915, 8.4, 8.32, 8.28, 8.2, -0.0069718244,
+    -0.033235062, -8.018251, 0.099556915, -0.006514564, -8.018251, -8.328821, -0.021623993, 0.04498647,
+    -7.2534256, -0.11384835, 0.0026075745, 8.6, -7.349471, 8.52, 0.026159903, -0.06708046,
+    8.48, 0.0042648315, 0.1369956, 8.72, -7.20367, -0.08073088, -0.15930468, -7.1555967,
+    -0.0006164485, -0.024763515, -7.054926, 8.6, 8.28, 8.24, 0.13535707, -0.085401535,
+    8.56, 0.3056411, 0.08486366, 9.73, 9.57, -0.110782556, -0.0036284446, 0.16798592,
+    8.36, -6.961682, 8.17, 0.07504164, -0.08985849, 8.28, 0.060094576, 0.018955419,
+    8.6, -6.4785495, -0.056999665, 0.012823087, 8.68, 0.023605373, -0.0001916256, -0.771789,
+    -3.593756, -3.6424093, -3.8215072, -4.127986, -4.32814, -4.524055, -0.000055951514, 0.012557174,
+    4.65, -0.1372402, 0.004631975, 5.04, 4.57, -0.06410912, 0.11529376, 5.4,
+    -0.032018576, 0.020172456, 4.65, 2.13, -3.7061508, 0.09760475, -0.018525695, 4.57,
+    -0.2930394, -0.09114895, 4.97, -3.7527802, 0.081570975, 0.023676738, -3.7061508, -0.04008059,
+    0.015740052, 4.69, 2.21, 1.93, 1.85, -0.12065735, -0.03189316, 0.0210289,
+    4.61, -0.3698143, 4.65, 0.06374614, -0.22418721, 4.93, 4.89, 4.77,
+    -0.005089264, 0.013318576, -0.01197052, 5.4, 5.24, -0.04394827, -0.17350245, 5.48,
+    0.06928584, -0.0040747905, 2.82, 2.78, -1.605014, -1.960713, 2.29, 0.01350399,
+    -0.09352311, 2.09, -0.00032043457, 0.072917365, 2.25, -0.8777573, 0.009965918, -0.3036743,
+    2.4, 0.08119625, -0.011576846, -1.5751029, -1.7140237, -1.8803589, 0.13858134, 0.029596288,
+    -0.13336849, -0.9800166, -1.2995658, 0.09017487, 0.19952099, -0.9247528, -0.04659004, 0.10835343,
+    3.13, -1.960713, -2.0137024, 3.1, 0.121553935, 0.062171634, 2.94, 0.116175845,
+    0.021839553, -1.6287112, 2.9, -0.00841724, -0.084611855, -1.3970085, 0.048857894, -0.031247467,
+    3.17, -1.362035, -1.98534, 0.061823685, -0.017665291, -1.2630312, 0.04075788, 0.0950377,
+    3.2, -1.8803589, 0.035771832, -0.06272941, -3.2776601, 0.013412617, 0.00030549912, 3.24,
+    2.4, -0.7202588, 2.33, 2.29, 2.25, 0.0029584884, -0.51192933, 0.48559532,
+    2.37, -0.26262018, -0.7891327, -0.6559018, 2.29, 2.25, 0.035662003, -0.037578125,
+    0.3139169, 2.29, -0.48152414, 0.053038914, -0.0006349268, -0.3603938, -0.13129936, 0.00015800672,
+    -0.7202588, 2.52, 2.44, -0.012889671, 2.48, 0.5085704, 0.16680501, 2.78,
+    2.55, 0.015790557, -0.12814233, 2.82, 0.16270141, 0.07612754, 2.44, -0.18892978,
+    -0.24307282, 0.026648149, 0.48621216, -0.07408267, -0.069740854, 0.014052327, 2.55, -0.30146822,
+    -0.11274302, 0.036941614, -0.24307282, 0.015759088, -0.015102091, -0.48152414, 4.49, -0.54071695,
+    3.44, -0.7202588, -0.093813136, -0.050748635, 0.047085572, -0.5094147, -0.6559018, -0.066142276,
+    0.0963617, -0.3603938, -0.4176023, 0.009454346, 0.16831799, -0.03269755, 9.5, 9.34,
+    9.27, 9.23, 9.18, 8.95, 8.76, -0.000062243394, 0.0109587135, -5.987348,
+    0.0041189906, -0.013298168, -6.2553506, -6.4785495, -0.1386404, -0.038958155, -5.9075212, 0.083956234,
+    0.003648497, -5.9075212, -5.949599, -6.3148303, -0.09104748, 0.0022689274, -0.15996008, -5.784454,
+    -5.878716, 0.078985594, 0.045747932, -5.750133, 0.012104492, -0.032948304, -5.878716, -6.1628103,
+    9.3, -6.511228, 0.01189928, 0.1093956, -6.2553506, -0.024017304, 0.110793464, 9.3,
+    -6.0203667, 0.0050271987, -0.2206184, -6.0203667, -0.13364248, 0.08794861, -5.813874, 9.3,
+    0.151656, -0.015447236, -0.035235595, -6.0905485, -6.910217, -7.054926, -7.1032915, 0.044898476,
+    -0.0799525, 9.46, 0.1341629, 0.053282674, 9.42, -6.5924907, 9.38, 0.18139434,
+    -0.048638977, -6.1923833, -0.091723695, -0.012584901, -6.7036514, 9.46, -0.028510818, -0.12328,
+    -6.389413, -0.001404063, 0.041236814, -6.0203667, -6.0520425, 9.38, 0.014831543, 0.10213379,
+    9.38, 0.22283447, -0.113666534, -5.987348, 0.016582234, -5.949599, -0.0051565985, -0.027671052,
+    -6.5924907, -6.653369, -7.01124, 9.57, -7.1032915, -7.20367, -0.053803254, 0.07694588,
+    9.53, -0.024411393, -0.11733911, -7.1032915, -7.1555967, -0.00032275534, -0.039263446, 9.61,
+    0.07085063, 0.0053863525, 9.61, 9.57, -6.961682, 0.05625696, 0.0011591002, -6.961682,
+    -0.08534012, -0.005616536, -6.7859416, 9.69, 0.005061324, 0.06300949, -6.7036514, 0.07862028,
+    0.019841766, 9.57, -6.618714, 9.53, -0.14908753, -0.05414937, 9.53, 0.0059936526,
+    -0.022663575, -6.618714, 0.12423096, -0.038827516, 9.57, -6.4785495, 9.53, -6.511228,
+    -6.5553975, 0.079689026, 0.0037319183, -0.098787844, -6.5553975, -0.017943382, -6.511228, 0.032332357,
+    0.07589966, -6.4524984, 0.031335667, 0.065359116, 0.11774063, -27.161629, -27.639406, 7.06,
+    7.03, -28.209562, 6.99, 6.95, 0.002962653, -0.022655725, -28.786161, -0.017817322,
+    0.50006616, 6.99, 6.95, -0.029229078, 0.58755416, -0.56074375, -33.599087, -34.72578,
+    -36.19027, 0.076957874, -0.26785395, 0.3062996, -28.786161, -0.25305957, -0.07202403, -28.209562,
+    -28.786161, 7.1, -29.518152, 0.024991645, 0.6068978, 7.14, -0.1239697, 0.01710818,
+    7.1, -0.3740696, 7.14, 0.2563362, -0.13659973, 7.22, 0.23611298, 7.3,
+    -0.34412652, 7.34, 0.15994416, 0.031030847, 7.06, 1.42, 0.31, 0.081518404,
+    0.35, -0.57190555, 1.38, -0.05026271, -0.41572365, 1.62, 1.54, 1.46,
+    0.6627859, -0.23865406, 0.7096555, 6.99, 6.91, -0.027528634, -0.17409706, 0.4275107,
+    7.1, -0.6605652, 7.14, 0.2797966, 7.18, -0.29136583, 0.24755363, 0.31,
+    -0.59196854, 0.35, -26.572838, 0.109493904, -26.084858, -0.00058446085, -0.19375038, -26.572838,
+    1.62, 1.54, 1.5, -0.119977154, 0.3097819, -1.1930295, 1.69, 1.66,
+    0.51694435, 0.17325644, 7.1, -0.12313538, 0.14914952, -26.084858, 0.4, 0.541526,
+    1.38, -0.18363546, 0.055473547, 0.44, -24.11707, -0.011707004, -0.1377533, 0.56,
+    0.011735032, -0.00005958443, 0.67, -21.12554, 0.63, -21.325644, -21.69312, 0.59,
+    -21.931791, -0.00029349778, -0.08347531, -22.12889, 0.66739047, 0.024241084, -21.50634, -0.02619703,
+    -0.06930504, -0.29972535, -21.69312, 0.42017823, -21.50634, -0.23078798, -21.325644, 0.07398538,
+    0.019860242, -0.09151142, 0.99, -21.325644, 0.54152757, -20.803585, 0.71, -20.981464,
+    -21.12554, 0.0207222, 0.104265414, -0.012652831, -20.981464, 0.03981222, 0.45415244, 0.75,
+    -20.652575, 0.71, -0.021911621, 0.039198443, 0.71, -0.15292172, -0.041000027, -20.516748,
+    0.79, 0.27054998, -0.16105144, -19.539429, 0.01439815, -0.024084663, 1.46, 1.34,
+    -21.325644, -24.864492, 1.3, 0.12901373, -0.004346346, -24.452414, -0.10020085, 0.02537143,
+    -19.76686, -20.28955, -0.0056299437, -0.045434635, -19.428238, 0.041305095, -0.006373855, -20.803585,
+    1.42, -24.452414, -0.05164503, 0.060116142, -25.69593, 0.048678756, -0.15256348, -20.188913,
+    1.38, -0.031726, -0.14326951, -19.76686, -0.17452012, -0.01662674, 1.62, -22.377066,
+    -22.656353, -30.874868, 0.034742653, -0.036144663, 1.5, 0.57856697, -1.0294607, -22.12889,
+    1.5, 1.4033257, 0.27677232, -21.931791, -0.6172244, 0.055355813, -51.15694, 7.03,
+    1.73, 0.040221255, 0.092579655, 0.017168427, -42.560875, 6.88, -0.12855665, -0.009521152,
+    -25.265562, 0.010762753, -0.00020173994, -34.72578, -36.19027, 6.88, 1.69, -42.560875,
+    1.5, 0.03, 0.0070426348, -0.00718496, 1.62, 0.10078621, -0.023583412, 1.42,
+    1.38, -0.00062898913, 0.132271, 1.5, -0.12328624, -0.01884984, 1.73, -0.0998127,
+    -42.560875, -0.0922493, -40.02452, 0.05775528, -0.03925209, 6.91, -40.02452, -45.980717,
+    -0.014572144, 0.058506012, 0.2449688, 6.95, -37.815678, -40.02452, -0.045365397, -0.30465242,
+    0.078517914, -40.02452, -51.15694, 0.065848544, -0.010126701, 7.06, 0.0647833, 0.0051234057,
+    1.58, 1.5, 0.16, 0.12, 0.014372199, -0.009444532, 1.46, 1.42,
+    -0.039364625, -0.1597023, 0.0068515777, 0.04740499, 6.91, -0.14659403, 6.95, 0.3041031,
+    7.1, 7.06, -0.1042245, 0.22890244, 7.18, -0.22847393, -0.043992806, -33.599087,
+    7.1, 1.66, 1.58, 1.46, 1.42, -0.012027181, 0.25602925, 1.54,
+    -0.13866477, 0.03808492, 1.62, 0.4257141, 0.11553091, 1.69, -0.32508048, 7.06,
+    7.03, -0.03831693, 0.27459335, -0.11713772, 7.3, 7.18, 0.086264804, 0.24820785,
+    7.34, 0.013801194, -0.046848807, 0.23, -30.874868, 0.2, -31.608435, -32.61234,
+    0.012790143, -0.008268969, -0.035327002, 0.06754201, -30.058292, -0.018741122, -0.045394327, -32.61234,
+    1.42, 0.31214294, 1.46, -0.50060004, 1.54, 0.5395512, -0.08579515, -29.518152,
+    0.27, 0.10381865, 1.42, -0.090474986, 0.021248166, 0.27, -28.786161, 0.0026552144,
+    -0.09409744, 0.31, 0.0197173, -0.000004977877, -0.07408267, -3.593756, -3.6424093, -3.8215072,
+    -4.127986, -4.32814, 4.53, -0.0018399656, 0.0009357973, 4.49, 0.14162938, -0.038627535,
+    4.61, -4.0418863, 0.3895733, -0.045970257, 5.55, -0.011694483, 0.028403921, 4.65,
+    2.13, 1.81, -0.088596344, 0.05732422, 4.49, -0.2703968, -0.08333775, 5.12,
+    -3.7061508, 0.00982774, 0.05549248, 5.2, -0.10633822, -0.006824644, 4.69, 2.21,
+    1.93, 1.85, -0.108558655, -0.028671265, 0.018958664, 4.61, -0.3327999, 4.65,
+    0.05529073, -0.19425151, 4.93, 4.85, 4.77, -0.0041142274, 0.018347168, 4.89,
+    -0.0008031209, -0.010125733, 5.4, 5.24, -0.035646915, -0.14308186, 5.75, -0.009522629,
+    0.05987053, -3.4047515, 2.25, -3.4696734, 1.81, 0.17695847, 2.01, 0.021024171,
+    0.1301302, -0.035014726, 4.57, 4.49, 2.29, -0.07437897, -0.008046723, -0.27371693,
+    5.12, 5.08, 0.030775769, 0.090245396, 5.55, -0.028698161, 0.056759264, -3.3498714,
+    4.49, 2.21, 2.05, 0.020306205, -0.14921951, 0.45052108, 4.61, -0.16563264,
+    4.81, -0.015765762, -0.061225552, -3.2776601, 4.57, 4.49, 0.08064283, -0.50461733,
+    4.65, 0.24641235, 0.061344285, 5.55, 5.48, 0.00015418897, 0.054464858, 5.6,
+    -0.11045408, -0.015736619, 2.05, -0.058459997, 2.01, 0.0028892518, -0.00021484376, 2.01,
+    -0.0005775452, 0.05289815, 2.21, 2.09, -0.058459997, 0.0072654723, -0.017202377, -0.058459997,
+    2.13, 0.004967117, -0.06130066, 2.13, -0.071682744, 2.17, 0.03251241, -0.0050201416,
+    2.29, -0.058459997, 2.25, 0.050772984, 0.013079616, 2.25, -0.038393594, 0.04226265,
+    2.33, -0.058459997, 0.00095767976, -0.07129212, 2.63, 2.48, -0.011304636, 0.008983954,
+    2.78, -0.019771958, 0.010255051, 5.87, 5.79, -5.4127874, 4.53, -5.5490093,
+    -7.444791, -7.7751694, -0.00031100275, 0.22704752, 4.49, 0.0033122122, -0.44900623, 2.17,
+    1.77, 0.14910583, -0.061550736, -0.69604796, -8.577097, -10.025825, -10.396682, -0.14176618,
+    0.7115227, -0.8367783, -7.9547505, 1.3658116, -7.5758924, -1.2361768, 0.07390475, -5.1183767,
+    4.57, 2.25, 2.13, -0.004149323, 0.10123291, -5.254704, -0.9767217, -0.08046494,
+    5.55, 5.52, 0.13560753, 0.07200699, -5.254704, -0.02590822, -0.10461693, 5.75,
+    5.72, 5.48, 0.0008557504, -0.017834578, -4.524055, 0.099618845, 0.026216447, -3.8950949,
+    -4.894484, -0.011768668, -0.08023196, -3.7527802, 0.043497723, -0.013197436, -6.4524984, 5.83,
+    0.32552448, -6.653369, -6.961682, 0.049328614, 0.22339097, 0.062114716, -6.1628103, -6.3485193,
+    -6.417596, -0.12193527, 5.83, 0.003040568, -0.012068558, -6.2222686, -6.286212, -0.1303711,
+    -0.29225922, -6.1923833, 0.048295595, -0.20345204, -6.0520425, -6.131815, 0.055961102, 5.83,
+    0.09935181, 0.22310792, -5.5945034, -5.987348, -0.0049972534, -0.08623075, -3.9679167, 0.0063846284,
+    0.06243477, -5.4127874, -5.5490093, 6.18, -8.577097, -8.718564, 0.23730378, 6.14,
+    0.12114807, 0.028493652, -6.131815, -6.961682, 0.0057150098, -0.09254386, -6.0203667, 0.16871579,
+    0.0035496168, -30.058292, 6.95, -32.61234, 0.0039823875, 0.16052541, -30.874868, 0.0022981109,
+    -0.06735253, -22.12889, -22.377066, -0.0003652273, -0.21987708, -21.931791, 0.16346118, -0.0004879979,
+    6.3, 5.95, 5.91, -0.015691375, 0.08502293, -0.17411987, 0.060307093, 6.1,
+    5.91, -5.004444, -0.11436196, -3.9679167, -4.6410313, -0.010647297, 0.05382767, -3.8950949,
+    -0.10407753, -0.031637065, 6.02, 5.95, -4.6410313, 0.026934355, 0.07857271, -5.004444,
+    0.04790853, -0.005686688, 6.06, -4.4179254, -0.08070762, 0.016196696, -4.894484, 0.053781636,
+    -0.0523868, -5.1183767, 6.18, 0.12280655, 6.22, -5.254704, 0.03678843, -0.03220291,
+    -5.254704, -0.014812089, 0.12539367, -4.750224, 6.18, -5.004444, 0.035143536, -0.020856693,
+    -5.004444, 0.025300598, 0.07245598, 0.06907425, -19.982029, 7.1, 7.06, 6.83,
+    1.88, 1.81, -22.377066, -0.0008166886, 0.0070193815, -21.69312, -0.19421482, -0.081357,
+    6.72, -20.516748, 0.08135099, 0.22193451, -27.639406, 0.14228287, -0.0009846635, -21.12554,
+    7.03, -23.178364, 0.0063226703, -0.22125815, -23.477354, -0.11206553, 1.0181192, 7.03,
+    -20.516748, 0.11941215, -0.011287096, -20.516748, -1.010461, -0.31484985, -20.516748, -22.377066,
+    -24.11707, -30.058292, 0.08122517, -0.15245216, 0.8273534, -22.12889, -1.6452118, -21.50634,
+    -0.2376468, 0.23252062, 1.2164515, -20.981464, -21.325644, -21.50634, -22.377066, -24.11707,
+    0.012413209, -0.109826624, 7.14, 0.56240517, -0.021606637, 7.14, -0.59882355, 7.3,
+    0.05348873, -0.086299896, 7.18, 0.98105586, -21.12554, 7.34, -0.09859772, 0.041801073,
+    7.34, 0.11216406, -0.0031768798, 7.14, -20.803585, -1.4880768, -20.516748, 0.7986717,
+    -1.4307603, -20.188913, -20.516748, -20.652575, 0.0263872, -0.35147813, 7.22, 0.50190085,
+    -0.0020285712, 7.18, -20.089907, -0.93076175, 0.17677537, -20.089907, 0.039656576, -0.089497074,
+    0.95, -19.428238, -19.539429, -19.876776, 0.91, 0.83, 0.053266417, -0.07262307,
+    0.15039572, 0.79, -0.29477426, 0.87, -0.0028147174, -0.041593328, 0.91, 0.87,
+    -0.033709023, -0.005760829, -0.13993835, -19.09326, 0.91, -19.330385, 0.87, -0.012644005,
+    0.03248272, -0.03849167, -19.330385, -0.075618364, -19.22157, 0.09280863, 0.018142423, -0.07705879,
+    0.99, -19.539429, -19.668941, -19.76686, -19.876776, -0.009191895, 0.21131745, -0.028997803,
+    0.34998474, -19.22157, -19.330385, -19.428238, 0.015369129, -0.038721405, -0.14783081, -19.09326,
+    0.059189536, -18.977423, -0.035985947, 0.009976807, -19.539429, 1.26, -19.76686, 1.1,
+    -0.06644348, 0.03090973, 1.18, 0.01991743, 0.095397495, -19.76686, 7.1, -0.102474175,
+    0.3328576, 6.99, -0.031696137, -0.25668204, -19.22157, 7.1, 7.03, 0.021885008,
+    -0.1984459, 7.18, 0.5904059, -0.04946254, -19.09326, 6.91, -0.020688344, -0.26006407,
+    -18.977423, 0.034628026, -0.00017447908, -34.72578, -36.19027, -37.815678, 1.54, 1.38,
+    -40.02452, 0.07, -0.0014376265, 0.07872184, 0.12, -0.00620005, -0.118903354, -42.560875,
+    -45.980717, -0.049160358, 0.087684825, -40.02452, -0.115859024, -0.04374042, 1.58, -40.02452,
+    -42.560875, 0.13576838, -0.07683563, 0.3369484, 6.95, -40.02452, 0.006176553, -0.1897946,
+    7.1, 0.034616854, -0.015549543, 6.99, 6.88, 1.42, 1.38, -0.010623345,
+    0.42032877, 1.46, -0.1709816, -0.011842686, 6.91, 0.25181124, 0.08495178, 7.03,
+    -0.22923382, 7.06, 0.25417063, 7.1, -0.21749166, 0.05336215, 7.1, 7.06,
+    7.03, 6.91, 1.58, -0.00517681, -0.12136089, 6.95, 0.27256852, -0.025102744,
+    -0.22083893, 0.19756661, 7.14, -0.23725586, 7.26, -0.06269237, 0.0002705892, -33.599087,
+    7.1, 1.66, 1.58, 1.46, 1.42, -0.009128113, 0.22228801, 1.54,
+    -0.11505941, 0.033402506, 1.62, 0.36934814, 0.10052236, 1.69, -0.29227564, 7.06,
+    7.03, -0.03299707, 0.25801736, -0.11223564, 7.3, 7.18, 0.07267685, 0.20863019,
+    7.34, 0.010856628, -0.042688243, -21.931791, 6.99, 6.88, -22.377066, 1.58,
+    -0.0030633316, 0.024318328, -22.12889, 0.06082825, -0.0110193845, -26.084858, 6.95, -0.10929725,
+    0.08578869, -25.69593, -0.8161675, -0.10054739, -22.12889, -22.377066, 7.1, 0.07489684,
+    -0.014520978, 7.1, -0.8319441, 0.31408247, 7.14, 0.7237235, 7.18, -1.4451027,
+    0.14637278, 0.59, -0.06906287, -21.50634, 1.58, 1.46, 0.0055936417, 0.4131846,
+    7.18, -0.17150421, 0.14154457, 0.63, -21.325644, -0.057490733, -0.26041058, -21.325644,
+    0.054466277, -0.00011845527, 5.95, 5.79, 5.75, 5.72, 4.73, 4.49,
+    4.41, -0.00017483106, 0.02301383, -16.183819, -0.25344968, -0.0076183653, -5.7152433, -5.842078,
+    0.1674616, 0.085280105, 5.67, 0.0023694218, -0.03883674, -5.254704, -5.842078, -6.2222686,
+    -0.016799165, 0.103957556, -5.5490093, -0.1523428, -0.0452417, -4.524055, -5.004444, 0.023292797,
+    0.10335328, -4.4179254, -0.042778015, 0.03136067, -6.3148303, -6.389413, 0.412455, 0.15535127,
+    -5.949599, -6.2222686, -6.286212, 0.036695864, -0.16906586, -6.131815, 0.16582082, 0.024713708,
+    -5.004444, -5.254704, -0.07395339, -0.12461809, -4.894484, 0.10786082, -0.046329346, -6.653369,
+    5.91, -6.7036514, 0.21800613, 5.87, 0.081127934, 0.009927369, -7.20367, 0.17926657,
+    -6.961682, -7.1032915, -0.023599243, 0.05013835, -6.7859416, -0.057989504, -0.16790847, -6.1628103,
+    -6.4524984, 5.91, 5.83, 0.23910192, 0.040238824, -6.5553975, -0.31989595, -0.045277406,
+    -6.2222686, 5.87, -0.12807705, -0.28285784, -6.1923833, 0.02741806, -0.17628531, -5.987348,
+    -6.131815, 5.91, 0.035868835, -0.105825804, -6.0520425, 0.21232691, 0.0781786, -5.5945034,
+    5.91, -0.07837408, 0.00043067933, 5.91, 0.0033148266, 0.04384308, 7.14, -8.453863,
+    6.26, -9.193894, 6.22, 6.18, 0.11388512, 0.28585777, 0.119797386, 6.14,
+    -8.718564, 0.27290496, 0.09963264, 6.18, 0.04246885, -0.043116394, -8.718564, -9.50892,
+    6.6, 0.015847722, -0.005961792, 6.34, -0.1733145, -0.04991334, 6.49, 6.3,
+    -0.024906414, 0.19386587, -0.15006256, -7.3014965, 6.06, -7.722872, -7.7751694, 0.14782041,
+    0.06768311, 5.99, 0.08854493, -0.030454217, 6.49, -7.3987164, -0.046330504, -0.1659122,
+    0.30585176, 6.06, -6.3148303, -6.961682, 0.00011691139, -0.08170603, 6.02, 0.0046434626,
+    -0.04432597, -7.20367, 6.49, 0.083459236, -0.01505394, -6.961682, -0.046606395, 0.011509846,
+    -18.7905, -18.977423, -20.188913, -20.516748, -20.652575, 0.0071593053, -0.2952226, 7.22,
+    0.42663422, -0.0016467624, -20.089907, 7.18, -0.8376736, 0.034384664, -19.09326, -0.046511203,
+    0.116270125, 7.18, -1.5902847, 7.3, 7.22, 0.270533, 0.0753011, 7.53,
+    -0.08189392, -0.023651123, 7.18, -18.367512, 0.49691772, -17.897657, 0.08174934, 0.32731095,
+    -17.44737, -17.897657, 7.3, -0.08457015, 0.048390172, 7.46, -0.15274517, -0.04782095,
+    7.26, 7.22, 0.14867179, 0.06092018, 7.77, 0.008521738, -0.0007804706, 9.53,
+    9.34, 9.27, 9.23, 9.14, 8.99, 8.76, -0.00009585398, 0.0067339065,
+    -6.0203667, -0.026158286, 0.0040896065, -6.0203667, -6.0905485, 0.0036930006, 0.15194373, -5.949599,
+    -0.15561505, -0.00003552437, -5.9075212, -6.653369, 0.090180054, -6.3148303, -0.13598524, -0.02560546,
+    -5.784454, -5.878716, 0.06649048, 0.037592802, -5.750133, 0.0103100585, -0.029563904, -5.878716,
+    -6.1628103, 9.3, -6.511228, 0.009974003, 0.08868242, -6.2553506, -0.019233856, 0.09320984,
+    9.3, -5.949599, -0.08271306, -0.26524475, -6.0203667, -0.108656965, 0.07145321, -5.813874,
+    9.3, 0.12424427, -0.013813019, -0.031623077, -6.0905485, 9.42, -6.5924907, 9.38,
+    0.14857684, -6.910217, 0.09918518, -0.039494265, -6.1923833, -6.417596, -0.02671784, -0.10783362,
+    -6.1628103, 0.05081886, -0.03597054, -6.4524984, -6.4785495, 9.46, 0.07177602, -0.037013903,
+    9.5, -0.2885957, 0.027536774, 9.46, -6.2553506, -0.08947782, 0.052635957, -6.417596,
+    0.14610042, 0.053369243, -6.0203667, -6.0520425, 9.38, 0.012508392, 0.085935056, 9.38,
+    0.18732421, -0.10221024, -5.987348, 0.013967896, -5.949599, -0.004119437, -0.024814606, -6.740236,
+    9.65, -7.444791, -0.057573702, -7.3987164, 9.61, 0.020914715, 0.15420838, -7.2534256,
+    9.61, 0.026653036, -0.09086566, -7.01124, -0.010377575, -0.00096655235, -6.8701315, -7.3987164,
+    9.69, -7.444791, 0.012597275, -0.20714162, 9.88, -0.0058052023, 0.002893172, 9.84,
+    -7.349471, -0.021774353, 0.009978189, -7.349471, 0.091144755, -0.010442543, -6.8298554, 0.04968628,
+    0.12547506, 9.61, -6.5924907, -6.7036514, 9.57, 0.36696014, -0.048623275, 9.57,
+    -6.618714, -0.04682329, -0.018894045, -6.618714, 0.06586075, -0.0335317, 9.57, -6.5553975,
+    -0.014646912, -6.4785495, 0.048204806, 0.020440063, 0.100214005, -6.7036514, 0.09798699, 0.017946625,
+    -10.792877, -11.26825, -12.062972, 6.95, -13.614294, 2.01, -14.995561, 0.000006794609,
+    -0.03772777, 4.49, 0.46617433, 0.010354792, 1.88, 1.66, -0.036346547, 0.08296822,
+    6.53, -0.11626444, -0.008157851, -22.907703, -23.178364, 7.03, 0.04442813, -0.013566754,
+    6.99, -0.22785226, 0.25148913, -22.656353, 7.03, -1.0166711, -0.04352078, 7.18,
+    -0.049721103, 0.0023871614, 7.53, 6.88, 6.53, 4.53, 0.0021062305, 0.13985145,
+    6.57, -0.11821403, -0.0021854092, -11.773308, 7.49, 0.24979492, 0.056219485, 7.49,
+    -0.14634056, 0.13670121, 7.65, -11.773308, 7.61, -0.015259829, 0.07691574, 7.57,
+    -0.05133006, -0.29878446, 7.77, 7.73, 0.017947493, -0.06389686, 7.93, 0.04750973,
+    0.0010373433, 4.49, 2.01, 1.88, 1.66, -0.032935586, -11.018427, -0.16340242,
+    -0.049037933, -11.018427, 0.00476532, 0.112932585, -0.90532, 6.49, 6.37, 0.16458297,
+    6.45, 6.41, 0.049957275, -0.110582285, 0.19531809, 6.53, -11.018427, 0.7929203,
+    -0.8162921, 7.57, 6.83, 0.010247668, 0.30442962, -11.018427, -0.105283976, -0.010978503,
+    -10.59073, 7.73, 1.85, 1.81, 1.69, -0.09437256, 0.0070536295, -0.12441101,
+    6.34, 2.05, 1.97, 0.0015468597, 0.053253558, 4.57, 0.3173874, 0.12049065,
+    6.45, 6.37, -0.0005330404, -0.036441874, 6.6, 0.15949544, 0.0506381, 7.85,
+    7.77, -0.038236808, -0.13234888, 8.01, 7.97, 7.93, 0.026081696, -0.0053081512,
+    0.07693958, -0.046910096, 2.05, 1.93, -2.6292815, -2.9810855, -8.85124, 0.03201888,
+    -0.019229455, -2.7231896, -0.20181885, -0.02369156, -2.2326505, 1.85, 0.16201375, 0.03712616,
+    -2.1466296, -0.07861557, 0.043374162, -3.0695794, -8.21763, 2.01, 0.054534405, -0.06457333,
+    -6.286212, 0.1400546, 0.051958423, -2.068156, -2.5247674, -0.0043260953, -0.14498396, -1.6287112,
+    0.06602534, -0.011065319, -10.396682, 4.57, -0.5914688, 7.61, 6.49, -0.036308557,
+    0.16440535, 7.89, -0.08411789, 0.057194013, 2.09, -8.718564, -0.23067056, -2.357731,
+    0.036194276, -0.041741736, -9.684118, 6.3, 0.09438973, -0.0015701695, -9.029197, -0.013373119,
+    0.00024179874, 9.5, 9.34, 8.52, 8.48, 8.32, 8.28, 8.24,
+    0.00013331392, -0.023595255, -6.511228, 0.01705728, 0.1229332, -6.417596, -6.910217, -0.0025997194,
+    -0.05120228, 8.44, 0.07048207, 0.020275516, -6.417596, -7.485508, -7.667374, -0.05911083,
+    -0.0061139422, -6.961682, 0.12826456, 0.06950104, -6.1923833, -6.389413, 0.015186501, -0.08610637,
+    -6.1628103, 0.123822026, -0.011924616, -7.5297284, -0.119926296, -5.7152433, -6.131815, -6.3485193,
+    -0.006134918, 0.017247817, -6.0520425, -0.060645193, -0.0023391505, 8.87, -5.682901, 0.08728142,
+    0.0131272245, 9.07, -0.013866099, 0.03331744, -6.0905485, -6.910217, -7.054926, -7.1032915,
+    0.043934632, -0.06426951, -7.01124, 0.13337962, -6.961682, -0.034597017, 0.08227753, -6.7859416,
+    9.38, -6.8298554, 0.12222462, -0.012089538, -6.8701315, -0.0026372275, -0.15140343, 9.42,
+    -6.4524984, 0.0082949465, -0.050021555, -6.389413, -0.009618781, 0.032211505, -6.0203667, -6.0520425,
+    9.38, 0.010383606, 0.072146, 9.38, 0.15731323, -0.09201355, -5.987348, 0.011598969,
+    -5.949599, -0.0034550258, -0.022357179, -6.5924907, -8.018251, 9.96, 9.92, 9.88,
+    -0.01490078, -0.006424141, -0.07878514, -8.113236, -0.018790564, 0.008737259, -6.653369, -6.910217,
+    9.53, -6.961682, -0.014046383, -0.092365526, 9.69, -0.005270878, 0.002475422, 9.69,
+    -6.8701315, -0.0061278604, 0.0120839095, 0.13717727, 9.57, -6.618714, 9.53, -0.13041191,
+    -0.03721339, 9.53, 0.010217286, -0.015910646, -6.618714, 0.09897258, -0.029093424, 9.57,
+    -6.4785495, -6.511228, 9.53, -6.5553975, 0.07338448, 0.0088211065, -6.5553975, -0.01212616,
+    0.019017791, 9.53, -0.076956786, 0.056147464, -6.417596, 0.023608018, -6.389413, 0.05645485,
+    0.025389481, 0.08514557, -10.792877, -11.26825, 6.72, -15.789676, -18.7905, 1.93,
+    1.77, 0.0011652028, -0.08148132, 4.57, 0.3690361, 0.09037029, 6.64, 6.53,
+    -0.055573393, 0.010386226, -16.605732, -0.13497548, 0.017804803, -14.672277, 1.97, -14.995561,
+    0.06650559, -0.10759368, 6.53, 0.3318983, 0.07267823, 6.49, 2.05, 0.0016876947,
+    0.1955211, -11.515594, -0.030996973, 0.13667527, 6.83, -15.789676, -27.639406, -30.874868,
+    -0.0677887, 0.16365083, -18.7905, -0.020345477, 0.04164179, -13.286145, -15.410659, -0.047280885,
+    -0.13384676, -11.773308, -0.036929082, 0.023858739, 6.91, -21.69312, -36.19027, 0.051041257,
+    -0.048105653, -16.991007, 0.11129025, 0.03210653, -11.773308, -12.062972, -0.0039056824, 0.042236514,
+    7.65, -0.07141634, 0.009390412, 4.49, 2.01, 1.88, 1.77, 1.66,
+    -0.028561402, -0.13967566, 1.81, 0.014118957, -0.058046218, -11.018427, 0.004275513, 0.0978569,
+    -0.8148014, 6.49, 6.45, 6.41, 6.37, 0.13463551, 0.04194336, -0.09291016,
+    0.16274314, 6.53, -11.018427, 0.71361506, -0.6857068, 7.57, 6.83, 0.008293825,
+    0.250286, 7.85, -0.076397784, 0.027760735, -10.59073, 7.73, 1.85, 1.81,
+    1.69, -0.084947966, 0.0060953777, -0.11198311, 6.34, 2.05, 1.97, 0.0013790131,
+    0.04791489, 4.57, 0.28563538, 0.10239754, 6.45, 6.37, -0.00047912597, -0.02983898,
+    6.6, 0.1321312, 0.04094606, 7.85, 7.77, -0.032521058, -0.11031329, 8.01,
+    7.97, 7.93, 0.02188736, -0.0047908784, 0.06537876, -0.04067332, -10.396682, 4.57,
+    1.73, 1.66, 0.11856613, 1.69, 0.022315217, -0.018007405, -0.51262414, 7.61,
+    6.79, 6.49, -0.029498471, 0.07102248, 0.2569202, 7.89, 7.65, -0.12738404,
+    -0.04977875, 7.97, 0.1281128, -0.024625396, 1.77, -4.750224, 1.73, -9.847813,
+    -0.085620776, 0.0255255, -6.3148303, -0.10000753, 0.01778164, 0.115352385, 1.81, -9.684118,
+    0.16958104, -4.0418863, -0.004739444, 0.08641612, -9.684118, 6.3, 0.059688915, -0.0012835584,
+    -9.50892, -0.023562986, 0.00016148791, 7.14, 7.03, -23.178364, 6.99, 6.79,
+    1.85, 1.81, 0.0023592345, -0.16038513, -26.084858, 0.042230226, 0.11616434, -26.084858,
+    -27.161629, -0.003480065, 0.07907914, -25.69593, -0.6488032, -0.07637937, -24.11707, -25.265562,
+    -25.69593, 0.012163968, -1.1275879, -24.452414, 0.5113299, -0.12221884, 1.142371, 6.99,
+    6.83, 6.72, -22.377066, -0.022725314, 0.0000023275502, -20.981464, -0.08543259, -0.015160451,
+    -21.69312, 6.95, 0.0016305288, -0.14079683, -16.183819, 0.07697185, 0.0041713715, -22.12889,
+    -0.95173085, -18.7905, -21.12554, -0.19910151, -0.07469203, -14.995561, 0.10082177, -0.16044788,
+    -18.7905, -18.977423, -23.178364, -25.265562, -25.69593, -0.018111996, 0.4808794, -24.864492,
+    -0.5901535, -0.024779802, -21.931791, 7.06, 0.67309976, 0.104164995, -21.69312, -0.45947215,
+    -0.000605444, 1.3420662, 7.1, 7.06, -16.183819, -17.897657, -0.07219086, 0.023888525,
+    -0.08736, -18.367512, -0.0402668, -0.16063601, -18.367512, -0.9517552, -17.897657, 0.46725717,
+    -0.94127244, -24.864492, -25.265562, -25.69593, -26.084858, -26.572838, -27.161629, 0.0006960671,
+    0.123233035, 7.26, -0.23427796, 0.13397713, 7.22, 0.46447426, 7.3, -0.19924876,
+    0.13429092, 7.26, 7.18, -0.6098103, 7.22, 0.12460581, -0.45971414, 7.3,
+    0.3008301, 0.038679507, 7.22, 0.37087372, 7.26, 0.07496643, 7.34, -0.12586784,
+    7.38, -0.001620102, 0.01800995, -24.452414, 7.22, -0.7506096, 7.26, 0.19128151,
+    0.03927765, -24.11707, 7.22, 0.3777485, 7.26, 0.06049309, -0.10757027, -18.7905,
+    -18.977423, -23.477354, -0.09935287, -0.0059923506, 7.18, -1.4258972, 0.038353305, 7.18,
+    -18.367512, 0.43780825, 0.20787464, -17.44737, -0.03104801, 0.0013330777, -21.12554, -21.50634,
+    6.79, 1.85, 1.69, 1.58, -22.377066, -0.0020925885, 0.018529644, -30.058292,
+    -0.05908081, 0.12134596, -25.265562, -25.69593, -0.003998368, 0.23805909, -24.452414, -0.2710335,
+    -0.10519915, 6.76, -25.265562, 0.00663147, 0.10681142, -22.907703, -27.639406, 0.13829957,
+    0.049435597, -22.656353, -0.11987229, 0.012025452, -21.931791, 6.99, -26.572838, -27.161629,
+    -0.0027908906, 0.29655534, 6.91, -0.027936114, -0.14023659, -26.572838, -27.161629, -0.0020701585,
+    -0.10497055, 7.06, 0.17313121, -0.00543254, 7.18, 6.95, 6.88, -0.112547114,
+    0.049638115, 7.1, -0.47025773, -0.070417665, 7.22, 0.4679624, 7.34, -0.123928264,
+    0.05061096, 7.03, 0.63, -21.325644, -0.047140885, -0.22582753, 0.71, -21.325644,
+    0.67, 0.048695285, 0.48133928, 0.0156088695, 1.18, 1.14, -0.029438952, -0.25534973,
+    1.58, 0.03311005, -0.07932297, 7.1, 1.0195974, 7.14, -0.51822156, 7.18,
+    0.52322185, 7.42, -0.06235339, 0.05846227, 0.67, -0.07522316, 1.1, -20.803585,
+    0.71, -20.981464, 0.08395198, -0.011341234, 0.75, -20.981464, 0.03373515, 0.3928294,
+    -20.981464, 0.1434925, 0.040681154, 0.75, -20.516748, 0.71, -0.048144713, 0.010683187,
+    -20.28955, -0.077752165, 0.0042315894, -20.089907, -20.652575, -0.085388355, 0.03261128, 0.91,
+    -0.015872946, 0.003394377, -20.803585, 7.03, -20.981464, 6.76, -0.06598764, -0.2767217,
+    6.76, 0.06064264, 0.19243151, 7.18, -20.981464, 0.017243957, -0.9899351, 7.34,
+    0.075691864, 0.022866568, 1.46, 1.34, -20.089907, -0.034310486, 0.0004284917, 1.38,
+    -0.060496032, -0.12127183, 1.5, 0.4320061, -19.76686, 0.040749487, -0.00015421092, -20.402336,
+    -20.516748, 1.34, 0.67, -21.69312, 0.63, 0.59, -0.00037859727, 0.06534513,
+    0.3751587, -21.50634, 0.63, -0.026937572, -0.19866517, 0.63, -0.07493787, -0.003385671,
+    0.79, -21.325644, 0.43320543, 0.75, 0.012035476, 0.22533703, 1.03, -0.22426556,
+    -26.572838, 0.06449225, 0.0075081247, -21.12554, -21.325644, 1.54, -23.178364, 0.0044012456,
+    -0.07890424, -21.50634, 0.00012614945, 0.087668516, 1.5, 1.46, -0.030558014, 0.7767693,
+    7.03, -0.103003316, 0.25181887, 7.03, 6.88, -20.981464, -0.07634576, -0.0039947773,
+    -20.652575, 0.073945746, 0.25853118, 7.06, -0.8715622, -20.981464, 0.20752144, -0.08456359,
+    0.75, 0.71, -0.0881368, -0.023714673, 7.18, 7.03, 0.83, 0.08466906,
+    0.99, -0.14304931, 0.043567304, 0.33415833, 7.3, -0.071096614, 0.0070331576, 0.79,
+    -20.28955, -0.11817228, -19.876776, -19.982029, -20.089907, -20.188913, -0.037888255, 0.0052060266,
+    -0.05957392, 0.0672966, -0.26380157, -20.188913, 7.1, 6.99, 0.87, -20.28955,
+    0.3748937, 0.034933, 1.06, 0.052619796, -0.017101957, 0.69213563, 7.14, -1.2857316,
+    7.26, 0.30826816, 7.42, -0.008640671, -0.0759257, -20.089907, 7.1, 7.06,
+    6.91, -0.015688604, -0.27026623, 0.8931572, 7.18, -0.7520229, 7.34, -0.0016853333,
+    0.039730072, -19.982029, 7.3, 1.38, 0.014862277, 0.16450249, 7.38, -0.14687018,
+    0.018290712, 0.95, -19.428238, -0.022823868, 0.0056460765, 0.99, 0.023388583, -0.00011162107,
+    5.87, 5.83, -5.4127874, 4.53, -5.5490093, -7.5297284, -7.7751694, -0.000120655495,
+    0.33646998, 4.49, -0.0025100447, -0.37070835, 2.17, 1.77, 0.1344101, -0.05012334,
+    -0.6256699, -7.9547505, -8.577097, -10.025825, 0.07152439, -0.7232679, 1.1621021, -7.5758924,
+    -1.0703224, -7.3987164, 1.2708381, 0.032321718, -5.1183767, 4.57, 2.25, 2.17,
+    -0.0018182235, 0.10084406, -5.254704, -0.845461, -0.06780777, 5.55, 5.52, 0.11148415,
+    0.059013367, 5.63, -0.006061835, -0.06546243, 5.44, -4.750224, 4.49, -0.030005092,
+    0.15384461, -3.9679167, 0.01663907, -0.0005833171, -4.2262564, -4.32814, -0.017486276, -0.11697737,
+    5.55, -0.011131773, 0.018078288, -6.5553975, -6.961682, 0.022607422, -6.740236, 0.16887309,
+    0.075191654, -6.1628103, -6.3485193, -6.4524984, 0.026342392, -6.417596, -0.09692154, 0.00897255,
+    -0.11042786, -6.0520425, -6.131815, 0.035419464, 0.16506754, -4.750224, -5.682901, -0.061441805,
+    -0.001542902, -3.9679167, 0.03338003, 0.085284315, 6.45, -11.515594, 0.15838954, 6.41,
+    -10.396682, 6.37, -11.018427, 0.19014405, 0.068769686, -10.792877, 0.019556046, -0.0135911945,
+    -9.684118, 6.3, 0.04010896, -0.09642466, -8.577097, 0.031108147, -0.007989543, -8.718564,
+    -9.349648, -9.847813, -0.1142437, 0.030706024, -9.029197, -0.24051018, -0.11394898, -8.453863,
+    0.08607616, -7.8932815, -0.100580275, 0.02569511, 6.6, -14.672277, -14.995561, -16.183819,
+    -16.605732, 0.03494818, 0.16905652, 6.53, -0.40183717, 0.02556097, 6.53, 0.8829514,
+    -0.14569436, -11.515594, -11.773308, -12.655651, 0.016228627, -0.1275122, -0.46300173, -11.018427,
+    6.53, 0.4540255, -0.08979691, -10.792877, -0.24836512, 0.018150916, 6.83, -19.982029,
+    -20.981464, -21.50634, 0.028870065, -0.15118217, -20.652575, 0.1443403, 0.06723971, -19.668941,
+    6.68, 0.099982195, -0.17863204, -19.539429, 0.10434214, -0.017039439, 6.91, -23.477354,
+    -36.19027, 0.042660113, -0.04432152, 6.88, 0.024385288, 0.067812, 7.1, -22.377066,
+    0.009755968, -0.04400183, -25.69593, 0.01651342, 0.00017395889, 8.09, 7.49, 7.46,
+    6.14, 5.6, 5.36, 5.08, -0.00012021508, 0.008096276, -4.750224, 0.04162304,
+    -0.02094552, -8.453863, -8.718564, 0.23234813, 0.07965622, -5.7152433, 0.013050954, -0.0059808395,
+    -10.19933, 6.34, 6.3, 0.17593776, 0.072099775, -14.294952, -0.0022546335, 0.009493144,
+    -10.025825, 6.57, -0.09655974, 0.0408034, -5.4127874, -0.011495503, 0.045361824, -14.672277,
+    -24.864492, -25.69593, -0.010894013, 0.016722107, -18.367512, -20.803585, -0.061003495, -0.11809448,
+    -16.605732, 0.02411728, -0.08486809, -11.773308, -12.062972, -13.286145, 0.04744096, -0.038224794,
+    0.15833358, -0.11388283, -8.113236, 7.89, -8.577097, -10.025825, 7.65, 0.008091993,
+    -0.020617722, 7.69, 0.2543782, 0.019147687, -8.453863, 7.85, 0.13720582, -0.0013603211,
+    0.19788101, -8.718564, -8.85124, -9.684118, 0.02002388, -0.039555226, 8.05, 0.1521319,
+    -0.0254598, -8.577097, -0.17368662, 8.05, -0.036894377, 0.06353353, 7.97, -8.018251,
+    7.93, 0.1243276, -0.057493087, 0.15045995, -7.722872, -8.018251, 8.05, 0.016138785,
+    0.075357184, -7.832062, -0.059549034, 0.002998939, 8.05, -7.444791, 0.10421156, 0.016593551,
+    -7.3014965, -0.003516388, 0.15751852, -9.193894, -9.684118, 8.13, -9.847813, -10.025825,
+    -10.19933, -0.005637741, -0.026659647, 0.01741829, -0.035087585, -9.847813, 0.04102669, -0.0016270956,
+    -9.349648, -0.067853704, 8.13, -0.045286052, 8.17, 0.0144786835, -0.040288925, -7.1032915,
+    8.4, -8.018251, 8.28, 8.13, -0.0413281, 0.001051939, 8.32, 0.07793004,
+    0.019962626, 8.2, -7.8932815, -0.09824126, 0.01575024, -7.7751694, -0.10676402, -0.034699354,
+    8.6, -7.5758924, -7.9547505, 0.11169555, -0.03304785, -7.485508, 0.09203186, 0.031659644,
+    8.72, -7.20367, -0.06593137, -0.13182043, 9.57, 0.024265926, -0.0018583968, -7.054926,
+    8.6, 8.28, 8.24, 0.113591924, -0.06913262, 0.23956008, 9.73, 9.57,
+    -0.075233996, -0.0076151527, 0.1400074, 8.24, -6.7859416, 8.2, 0.04397549, -0.034300536,
+    0.17088406, 9.61, -6.7036514, -0.014722081, 0.0009272558, -6.7859416, 0.011640363, 0.05496509,
+    0.56, -22.656353, 0.51, -22.907703, -23.178364, -28.209562, 0.27, -0.0011142887,
+    0.21034999, -27.639406, -0.06713794, -0.0013510815, 0.17166145, -0.5206487, -22.907703, -0.51019496,
+    0.12489494, 0.04102188, 0.59, -22.377066, -0.5227407, -22.12889, -0.07212048, -21.931791,
+    0.055552978, -0.05987466, -26.572838, 1.3, -28.209562, 0.043315887, 0.21285401, -27.161629,
+    -27.639406, -30.874868, 0.0015241603, -0.015171826, 1.42, -0.1654377, 0.10951992, 1.62,
+    1.54, -0.08420847, -1.0385468, 1.69, 0.33382812, -0.03148405, -23.813517, 1.5,
+    1.42, -24.452414, -0.06038272, 0.10729622, -24.864492, 0.06432247, 0.4629045, 1.58,
+    -24.11707, -0.30278993, 0.21904652, 1.69, 0.31240723, 0.0010786968, -23.477354, 7.06,
+    7.03, -0.01742777, -0.788384, 7.1, 0.61576843, -0.105223514, -22.907703, 7.18,
+    0.05039368, -0.09906679, -22.656353, -0.052543946, 0.00006787943, -2.8076367, -2.907736, -2.9810855,
+    -3.2152596, -3.3498714, -3.4047515, -3.4696734, -0.00023611584, 0.032554325, 4.49, 0.09783618,
+    -0.043453798, 4.57, 4.49, 0.07666118, -0.59788287, 4.65, 0.21933296, 0.018118747,
+    5.08, 4.45, 2.33, 0.00012987577, 0.5162491, 4.49, -0.6648796, -0.0560664,
+    5.55, -3.0695794, 0.03205963, 0.10077994, -3.1480272, -0.08993258, -0.0049209595, 4.61,
+    2.09, -0.16188966, 2.17, 0.047242485, -0.071415834, 5.0, 4.93, 4.89,
+    0.085332856, -0.032324728, 0.11628927, 5.44, 5.24, 0.015486145, 0.068010904, 5.48,
+    -0.053302, 0.014351043, 5.28, 4.69, 4.65, 2.29, 1.97, -0.08731079,
+    0.093436435, 4.53, -0.14060618, -0.023167726, 0.13004819, 5.08, 5.04, 5.0,
+    -0.04781429, -0.15410557, 0.11935852, 5.12, -0.14656739, 5.16, 0.027201844, -0.053845216,
+    5.32, 0.1498047, 5.48, 5.44, 5.4, -0.014303284, 0.014049785, -0.124455266,
+    0.062277604, -2.6292815, 4.53, 4.49, 2.01, 1.85, -2.7231896, 0.091458894,
+    -0.12635422, -2.7231896, -0.2390564, -0.015737534, -2.7231896, 0.21376725, 2.25, 0.040907037,
+    -0.10894165, -2.7231896, 0.14500046, 0.8570709, 4.57, -0.31459388, 4.65, -2.7231896,
+    0.043892212, 4.61, 0.07931977, 0.29823992, 5.04, -2.7231896, 0.008682505, -0.06107078,
+    5.24, 0.10979507, -0.026208892, 5.28, 1.88, -1.960713, 1.85, -2.2326505,
+    0.14049378, 0.036872864, -2.357731, 0.0030588785, 0.05288544, 1.85, -0.007801819, 0.05181061,
+    -2.29015, 4.02, 2.09, -0.025335757, 0.05839276, 4.53, 0.014530623, -0.00788714,
+    3.67, -2.173437, 0.048064534, 0.000473052, -0.82226276, -0.0062273215, 0.053043332, -2.5247674,
+    5.36, -0.14038758, -0.016509628, -0.00559082, 7.1, 7.03, 6.1, 4.73,
+    4.49, 4.29, 4.14, 0.00017006992, -0.014611448, -3.0695794, 0.20405965, 0.0032439143,
+    -16.183819, -17.44737, 0.10246598, -0.68029785, -14.294952, 0.766053, -0.0129184, -8.018251,
+    -8.21763, 0.1320195, -8.113236, -0.03930626, 0.13713074, -7.9547505, 6.02, 0.05373459,
+    -0.19396439, -6.4524984, 0.027312556, -0.00041545872, -5.4127874, -5.5945034, -14.672277, -17.897657,
+    -0.0040222914, 0.026821274, -14.294952, -0.086062916, -0.005458177, 6.3, -0.12683938, 0.013080979,
+    -5.1183767, 6.18, 0.0970877, 6.22, 0.0021312714, 0.05986913, -4.750224, 6.18,
+    -0.0073648244, 0.04176083, 0.059124757, -20.089907, -20.516748, -21.325644, -21.50634, -22.377066,
+    0.03162991, -0.3360432, 0.8781514, 7.06, -0.7491638, -0.01613795, 7.06, -0.22804058,
+    0.95736545, -18.977423, 7.06, -0.13680826, -0.59269106, 7.06, -16.183819, -17.897657,
+    -0.060303118, 0.027688598, -0.06725273, -16.183819, -18.367512, -0.0315712, -0.13978134, -0.028792191,
+    -25.69593, -27.161629, 7.26, -31.608435, 7.14, -37.815678, -0.018494306, -0.17471981,
+    7.18, 0.03721953, -0.014423489, 7.22, -27.639406, 0.03840059, -0.11552232, -29.518152,
+    0.34121907, -0.0114297485, -31.608435, 7.3, -34.72578, -0.01567154, 0.27807847, -32.61234,
+    -0.053982355, 0.008239174, 7.3, -0.29199207, -30.874868, -0.22176312, 0.096675985, 7.18,
+    0.42804122, 7.22, -26.084858, -26.572838, 0.14999594, -0.14876913, 0.25945815, 7.26,
+    -0.18183188, 7.34, 0.0424132, -0.005090768, -22.377066, 7.14, -22.907703, -23.178364,
+    -25.265562, 0.22956543, -0.31269073, 0.5164032, -0.67065835, 7.26, -25.265562, 7.18,
+    -0.54817504, -0.12489643, -24.864492, 0.28319207, -0.076771624, 7.3, -23.178364, 0.27233538,
+    0.05807063, -22.656353, 0.03547448, -0.1051569, -22.12889, 7.18, 0.76723737, 7.22,
+    -0.34288332, 0.18649699, 7.14, -18.7905, -19.09326, 0.09724579, 1.1993877, -18.367512,
+    -0.8245198, -0.24608643, -21.931791, 7.18, -1.294595, 0.124011554, 7.26, 0.03274719,
+    -0.00002709, -2.8076367, -2.907736, -2.9810855, -3.2776601, -3.3498714, -3.4047515, -3.4696734,
+    -0.00026672284, 0.026246319, 4.49, 0.074705124, -0.034581106, 4.57, 4.49, 0.04813932,
+    -0.3548935, 4.65, 0.17516175, 0.047008835, 2.13, 1.85, 1.81, -0.021360015,
+    0.001876831, -3.0695794, 0.16643614, 0.04209709, 4.61, -3.1480272, -0.4057233, 0.0034875234,
+    4.85, 0.02415598, -0.015831476, 4.61, 2.09, 1.88, -0.19239502, -0.07382088,
+    2.17, 0.040920768, -0.057360586, 5.0, 4.93, 4.89, 0.07011098, -0.027959188,
+    0.09697673, 5.44, 5.4, 0.021133944, 0.10652733, 5.48, -0.04470703, 0.01212143,
+    5.28, 4.89, 1.97, -0.07569173, 2.29, 2.05, 0.0023181916, 0.10431468,
+    4.53, -0.120136514, 0.002448854, 5.04, 5.0, 4.97, -0.0691342, -0.0041133882,
+    -0.13092728, 5.08, 0.10032775, 5.12, -0.12304993, -0.03561249, 5.32, 0.13486595,
+    5.48, 5.44, 5.4, -0.011947937, 0.012231954, -0.111968234, 0.052998163, -2.6292815,
+    4.53, 4.49, 2.01, 1.85, -2.7231896, 0.08229599, -0.11373597, -2.7231896,
+    -0.21516724, -0.013401985, -2.7231896, 0.17941406, 2.25, 0.035429638, -0.0980648, -2.7231896,
+    0.13179246, 0.7726555, 4.57, -0.2818428, 4.65, -2.7231896, 0.038936157, 0.22825801,
+    4.69, -2.7231896, 0.029104104, -0.14974925, 5.04, -0.010283911, 0.03453967, 5.28,
+    1.88, -1.6592834, 0.06679382, -1.4217949, -1.4832442, 0.019522859, -0.0019165039, 0.03215332,
+    -2.29015, 4.53, -2.5247674, 0.1852801, 0.015444311, 4.65, -0.08089801, 0.000021777976,
+    4.85, 3.67, 0.0011115441, -0.0031025542, -2.0923567, -0.031072978, 0.0020757888, -2.5247674,
+    5.36, -0.11785889, -0.014817047, -0.004789734
+};
+
+static const uint16_t xgb_node_link[31428] = {
+    32826, 32807, 32800, 32787, 12, 32777, 8, 65535, 65535, 11, 65535, 65535, 16, 32783, 65535, 65535,
+    32786, 65535, 65535, 27, 24, 32791, 65535, 65535, 26, 65535, 65535, 32799, 30, 65535, 65535, 65535,
+    38, 35, 65535, 32805, 65535, 65535, 65535, 57, 32814, 45, 44, 65535, 65535, 65535, 54, 51,
+    50, 65535, 65535, 53, 65535, 65535, 32824, 65535, 65535, 65535, 68, 61, 65535, 32831, 65535, 65,
+    65535, 32835, 65535, 65535, 32840, 71, 65535, 65535, 78, 77, 32844, 65535, 65535, 65535, 65535, 32939,
+    32902, 111, 32864, 91, 32856, 87, 65535, 65535, 90, 65535, 65535, 32861, 65535, 95, 65535, 65535,
+    104, 101, 100, 65535, 65535, 103, 65535, 65535, 108, 32875, 65535, 65535, 110, 65535, 65535, 123,
+    32886, 117, 32884, 65535, 65535, 65535, 120, 65535, 122, 65535, 65535, 32897, 126, 65535, 32896, 65535,
+    65535, 133, 32900, 65535, 65535, 65535, 148, 143, 140, 139, 65535, 65535, 142, 65535, 65535, 32913,
+    65535, 147, 65535, 65535, 32928, 153, 152, 65535, 65535, 32925, 156, 65535, 65535, 159, 65535, 65535,
+    166, 32931, 65535, 32933, 65535, 65535, 32938, 169, 65535, 65535, 65535, 179, 174, 65535, 32944, 65535,
+    178, 65535, 65535, 185, 32950, 65535, 32952, 65535, 65535, 191, 190, 32957, 65535, 65535, 65535, 32961,
+    65535, 65535, 33026, 33003, 32994, 32981, 206, 32971, 202, 65535, 65535, 205, 65535, 65535, 210, 32977,
+    65535, 65535, 32980, 65535, 65535, 221, 218, 32985, 65535, 65535, 220, 65535, 65535, 32993, 224, 65535,
+    65535, 65535, 234, 229, 65535, 33001, 232, 65535, 65535, 65535, 65535, 257, 33014, 241, 240, 65535,
+    65535, 245, 33012, 65535, 65535, 65535, 254, 251, 250, 65535, 65535, 253, 65535, 65535, 33024, 65535,
+    65535, 65535, 280, 33039, 268, 263, 65535, 33035, 266, 65535, 65535, 65535, 33038, 65535, 65535, 275,
+    274, 65535, 65535, 33045, 65535, 279, 65535, 65535, 33052, 283, 65535, 65535, 290, 289, 33056, 65535,
+    65535, 65535, 33060, 65535, 65535, 33167, 33114, 319, 33078, 305, 33070, 301, 65535, 65535, 304, 65535,
+    65535, 33075, 65535, 309, 65535, 65535, 312, 65535, 316, 315, 65535, 65535, 318, 65535, 65535, 333,
+    33094, 33091, 65535, 325, 65535, 65535, 330, 33097, 65535, 65535, 33100, 65535, 65535, 33107, 33104, 65535,
+    338, 65535, 65535, 343, 33110, 65535, 65535, 33113, 65535, 65535, 368, 359, 352, 351, 65535, 65535,
+    356, 33123, 65535, 65535, 33126, 65535, 65535, 33133, 33130, 65535, 364, 65535, 65535, 367, 65535, 65535,
+    33152, 377, 374, 33141, 65535, 65535, 33144, 65535, 65535, 33149, 380, 65535, 65535, 383, 65535, 65535,
+    392, 33157, 388, 65535, 65535, 33159, 65535, 65535, 33164, 395, 65535, 65535, 33166, 65535, 65535, 407,
+    402, 65535, 33172, 65535, 406, 65535, 65535, 417, 33180, 33179, 65535, 65535, 33184, 415, 65535, 65535,
+    65535, 425, 424, 33191, 422, 65535, 65535, 65535, 65535, 65535, 33264, 33241, 33228, 33213, 438, 435,
+    434, 65535, 65535, 437, 65535, 65535, 442, 441, 65535, 65535, 33212, 65535, 65535, 453, 450, 449,
+    65535, 65535, 33220, 65535, 65535, 33225, 456, 65535, 65535, 33227, 65535, 65535, 472, 469, 33234, 465,
+    65535, 65535, 468, 65535, 65535, 471, 65535, 65535, 65535, 495, 33254, 479, 478, 65535, 65535, 33251,
+    482, 65535, 65535, 485, 65535, 65535, 492, 491, 490, 65535, 65535, 65535, 33262, 65535, 65535, 65535,
+    512, 33271, 502, 501, 65535, 65535, 65535, 507, 506, 65535, 65535, 33277, 65535, 511, 65535, 65535,
+    33286, 515, 65535, 517, 65535, 65535, 528, 527, 33292, 523, 65535, 65535, 526, 65535, 65535, 65535,
+    33298, 65535, 65535, 33391, 33358, 559, 33318, 543, 540, 539, 65535, 65535, 542, 65535, 65535, 33315,
+    33314, 65535, 65535, 549, 65535, 65535, 552, 65535, 556, 555, 65535, 65535, 558, 65535, 65535, 575,
+    33336, 565, 33332, 65535, 65535, 33335, 65535, 65535, 572, 571, 65535, 65535, 33342, 65535, 65535, 33351,
+    580, 579, 65535, 65535, 33350, 65535, 65535, 587, 33354, 65535, 65535, 33357, 65535, 65535, 622, 607,
+    600, 597, 596, 65535, 65535, 599, 65535, 65535, 33372, 603, 65535, 65535, 606, 65535, 65535, 33383,
+    612, 611, 65535, 65535, 33382, 65535, 65535, 619, 33386, 65535, 65535, 621, 65535, 65535, 65535, 635,
+    626, 65535, 33398, 629, 65535, 65535, 632, 65535, 634, 65535, 65535, 645, 33408, 33407, 65535, 65535,
+    33412, 643, 65535, 65535, 65535, 655, 654, 33419, 650, 65535, 65535, 33421, 65535, 65535, 65535, 33425,
+    65535, 65535, 33508, 33477, 33458, 33445, 670, 33435, 666, 65535, 65535, 669, 65535, 65535, 674, 673,
+    65535, 65535, 33444, 65535, 65535, 685, 682, 681, 65535, 65535, 684, 65535, 65535, 33457, 688, 65535,
+    65535, 65535, 700, 693, 65535, 33465, 696, 65535, 65535, 699, 65535, 65535, 704, 33471, 65535, 65535,
+    706, 65535, 708, 65535, 65535, 735, 33490, 33487, 716, 715, 65535, 65535, 33486, 65535, 65535, 721,
+    65535, 65535, 730, 727, 726, 65535, 65535, 33497, 65535, 65535, 734, 733, 65535, 65535, 65535, 33507,
+    738, 65535, 65535, 65535, 766, 33525, 754, 33517, 746, 65535, 33516, 65535, 65535, 753, 752, 65535,
+    65535, 65535, 33524, 65535, 65535, 761, 760, 65535, 65535, 33531, 65535, 765, 65535, 65535, 776, 33539,
+    33538, 65535, 65535, 33543, 774, 65535, 65535, 65535, 788, 33549, 780, 65535, 65535, 33553, 784, 65535,
+    65535, 33555, 65535, 65535, 33558, 65535, 65535, 33651, 844, 817, 33578, 33571, 800, 799, 65535, 65535,
+    33570, 65535, 65535, 807, 33574, 65535, 65535, 809, 65535, 65535, 812, 65535, 33584, 815, 65535, 65535,
+    65535, 33599, 33592, 823, 33590, 65535, 65535, 65535, 828, 827, 65535, 65535, 33598, 65535, 65535, 837,
+    33604, 835, 65535, 65535, 65535, 33609, 840, 65535, 65535, 843, 65535, 65535, 852, 33615, 65535, 849,
+    65535, 33619, 65535, 65535, 33636, 861, 33626, 857, 65535, 65535, 860, 65535, 65535, 33633, 33632, 65535,
+    65535, 867, 65535, 65535, 876, 33641, 872, 65535, 65535, 875, 65535, 65535, 880, 879, 65535, 65535,
+    33650, 65535, 65535, 913, 890, 33657, 888, 65535, 65535, 65535, 33674, 33667, 896, 33663, 65535, 65535,
+    898, 65535, 65535, 903, 33670, 65535, 65535, 33673, 65535, 65535, 908, 65535, 912, 33679, 65535, 65535,
+    65535, 927, 33688, 33685, 65535, 919, 65535, 65535, 33694, 923, 65535, 33693, 65535, 65535, 65535, 941,
+    33702, 931, 65535, 933, 65535, 65535, 33706, 937, 65535, 65535, 33708, 65535, 65535, 33711, 65535, 65535,
+    33816, 33775, 978, 33731, 956, 953, 33720, 65535, 65535, 955, 65535, 65535, 33728, 959, 65535, 65535,
+    962, 65535, 65535, 971, 33736, 967, 65535, 65535, 33738, 65535, 65535, 975, 974, 65535, 65535, 33745,
+    65535, 65535, 992, 33753, 33750, 65535, 984, 65535, 65535, 33757, 988, 65535, 65535, 991, 65535, 65535,
+    33768, 997, 33764, 65535, 65535, 33767, 65535, 65535, 1004, 1003, 65535, 65535, 1006, 65535, 65535, 1037,
+    33790, 1017, 1014, 1013, 65535, 65535, 33784, 65535, 65535, 33789, 33788, 65535, 65535, 65535, 1030, 33795,
+    1026, 65535, 65535, 1029, 65535, 65535, 1034, 1033, 65535, 65535, 33804, 65535, 65535, 33809, 1040, 65535,
+    65535, 33815, 1046, 1045, 65535, 65535, 65535, 65535, 1086, 33835, 1060, 1053, 65535, 1057, 1056, 65535,
+    65535, 33827, 65535, 65535, 1064, 33831, 65535, 65535, 33834, 65535, 65535, 1077, 1074, 33841, 1072, 65535,
+    65535, 65535, 33844, 65535, 65535, 33847, 65535, 33851, 1082, 65535, 65535, 1085, 65535, 65535, 1108, 1097,
+    33860, 1091, 65535, 65535, 33864, 1095, 65535, 65535, 65535, 33869, 1100, 65535, 65535, 1105, 33872, 65535,
+    65535, 33875, 65535, 65535, 33878, 65535, 65535, 1219, 1172, 33913, 1130, 1123, 1120, 33887, 65535, 65535,
+    33890, 65535, 65535, 1127, 33894, 65535, 65535, 33897, 65535, 65535, 33906, 33903, 33902, 65535, 65535, 1137,
+    65535, 65535, 1142, 33909, 65535, 65535, 1144, 65535, 65535, 1159, 1154, 33919, 1150, 65535, 65535, 1153,
+    65535, 65535, 33926, 1157, 65535, 65535, 65535, 1165, 1162, 65535, 33932, 65535, 65535, 33937, 1168, 65535,
+    65535, 1171, 65535, 65535, 33964, 33953, 1180, 33945, 65535, 1179, 65535, 65535, 33950, 65535, 33952, 65535,
+    65535, 1191, 1190, 1189, 65535, 65535, 65535, 1195, 33962, 65535, 65535, 65535, 1212, 33973, 1202, 33969,
+    65535, 65535, 33972, 65535, 65535, 1209, 33976, 65535, 65535, 33979, 65535, 65535, 33986, 1217, 1216, 65535,
+    65535, 65535, 65535, 34031, 1248, 1233, 1226, 33993, 65535, 65535, 33998, 33997, 65535, 65535, 34000, 65535,
+    65535, 34009, 34006, 34005, 65535, 65535, 1240, 65535, 65535, 1245, 1244, 65535, 65535, 34015, 65535, 65535,
+    34026, 34023, 34020, 65535, 1254, 65535, 65535, 1257, 65535, 65535, 34030, 1261, 65535, 65535, 65535, 34045,
+    1270, 34037, 34036, 65535, 65535, 65535, 1276, 34043, 1274, 65535, 65535, 65535, 65535, 1281, 34048, 65535,
+    65535, 65535, 34154, 34111, 34082, 1301, 1294, 34059, 34058, 65535, 65535, 1293, 65535, 65535, 1298, 34065,
+    65535, 65535, 34068, 65535, 65535, 1307, 34072, 65535, 1306, 65535, 65535, 34079, 1310, 65535, 65535, 1313,
+    65535, 65535, 1328, 1323, 1320, 1319, 65535, 65535, 1322, 65535, 65535, 1325, 65535, 34095, 65535, 65535,
+    34104, 1333, 1332, 65535, 65535, 1335, 65535, 65535, 1340, 1339, 65535, 65535, 1342, 65535, 65535, 1373,
+    34126, 1353, 34118, 1349, 65535, 65535, 1352, 65535, 65535, 34125, 34124, 65535, 65535, 65535, 1366, 1363,
+    1362, 65535, 65535, 34133, 65535, 65535, 1370, 1369, 65535, 65535, 34140, 65535, 65535, 34147, 1378, 1377,
+    65535, 65535, 65535, 34153, 1384, 1383, 65535, 65535, 65535, 65535, 1432, 34177, 1398, 1393, 1392, 65535,
+    65535, 34163, 65535, 1397, 65535, 65535, 1406, 1403, 34170, 65535, 65535, 34173, 65535, 65535, 34176, 65535,
+    65535, 1419, 1412, 65535, 34184, 1415, 65535, 65535, 1418, 65535, 65535, 34195, 1424, 34191, 65535, 65535,
+    34194, 65535, 65535, 1429, 65535, 1431, 65535, 65535, 1462, 1449, 34210, 34207, 1438, 65535, 65535, 1441,
+    65535, 65535, 1446, 34213, 65535, 65535, 1448, 65535, 65535, 34223, 1452, 65535, 34222, 65535, 65535, 1459,
+    1458, 65535, 65535, 34229, 65535, 65535, 34232, 65535, 65535, 1577, 1528, 34267, 34252, 1477, 34242, 1473,
+    65535, 65535, 1476, 65535, 65535, 34249, 1480, 65535, 65535, 1483, 65535, 65535, 1492, 1489, 34256, 65535,
+    65535, 34259, 65535, 65535, 1496, 1495, 65535, 65535, 1498, 65535, 65535, 1515, 34276, 34273, 1504, 65535,
+    65535, 1507, 65535, 65535, 1512, 1511, 65535, 65535, 34282, 65535, 65535, 1523, 1520, 34287, 65535, 65535,
+    34290, 65535, 65535, 34293, 65535, 34295, 65535, 65535, 34322, 34309, 1536, 1533, 65535, 34303, 65535, 65535,
+    34306, 65535, 34308, 65535, 65535, 1549, 1546, 1545, 65535, 65535, 34316, 65535, 65535, 1553, 34320, 65535,
+    65535, 65535, 34338, 1563, 34328, 1559, 65535, 65535, 1562, 65535, 65535, 1567, 34334, 65535, 65535, 1569,
+    65535, 65535, 34344, 1575, 1574, 65535, 65535, 65535, 65535, 34385, 1602, 1589, 1582, 65535, 34354, 34353,
+    65535, 65535, 1588, 65535, 65535, 34363, 34360, 65535, 1594, 65535, 65535, 1599, 1598, 65535, 65535, 34369,
+    65535, 65535, 34380, 34377, 34374, 65535, 1608, 65535, 65535, 1611, 65535, 65535, 34384, 1615, 65535, 65535,
+    65535, 34401, 1624, 34391, 34390, 65535, 65535, 65535, 1632, 34397, 1628, 65535, 65535, 1631, 65535, 65535,
+    65535, 65535, 1730, 1687, 1656, 34419, 1644, 34411, 1642, 65535, 65535, 65535, 34416, 34415, 65535, 65535,
+    1650, 65535, 65535, 1653, 65535, 34423, 65535, 65535, 1672, 34433, 34430, 1661, 65535, 65535, 1664, 65535,
+    65535, 34437, 1668, 65535, 65535, 34439, 65535, 65535, 1680, 34445, 34444, 65535, 65535, 1679, 65535, 65535,
+    34452, 1683, 65535, 65535, 1686, 65535, 65535, 34483, 34468, 1695, 1692, 65535, 34462, 65535, 65535, 34465,
+    65535, 34467, 65535, 65535, 1708, 1705, 34472, 65535, 65535, 1707, 65535, 65535, 34480, 1711, 65535, 65535,
+    1714, 65535, 65535, 34497, 1724, 34489, 1720, 65535, 65535, 1723, 65535, 65535, 1728, 34495, 65535, 65535,
+    65535, 65535, 34542, 1757, 1744, 1737, 34504, 65535, 65535, 34509, 34508, 65535, 65535, 1743, 65535, 65535,
+    34518, 34515, 65535, 34517, 65535, 65535, 34522, 1753, 65535, 65535, 1756, 65535, 65535, 34535, 34532, 34529,
+    65535, 1763, 65535, 65535, 1766, 65535, 65535, 34541, 1770, 65535, 34540, 65535, 65535, 65535, 34552, 1781,
+    1780, 34547, 65535, 65535, 65535, 1783, 65535, 65535, 34558, 1789, 34556, 65535, 65535, 65535, 65535, 1899,
+    1852, 1821, 34578, 1803, 34568, 1799, 65535, 65535, 34570, 65535, 65535, 34575, 1806, 65535, 65535, 1809,
+    65535, 65535, 34584, 1813, 65535, 1815, 65535, 65535, 1818, 65535, 34588, 65535, 65535, 1837, 34598, 34595,
+    34594, 65535, 65535, 1829, 65535, 65535, 34602, 1833, 65535, 65535, 34604, 65535, 65535, 1845, 34610, 34609,
+    65535, 65535, 1844, 65535, 65535, 34617, 1848, 65535, 65535, 1851, 65535, 65535, 34642, 1865, 1860, 1857,
+    65535, 1859, 65535, 65535, 34630, 65535, 34632, 65535, 65535, 34639, 34636, 65535, 34638, 65535, 65535, 34641,
+    65535, 65535, 1890, 34651, 34648, 1879, 65535, 65535, 1882, 65535, 65535, 1887, 34654, 65535, 65535, 34657,
+    65535, 65535, 1898, 34663, 34662, 65535, 65535, 34665, 65535, 65535, 65535, 34715, 1928, 1915, 1908, 34675,
+    34674, 65535, 65535, 65535, 34680, 34679, 65535, 65535, 34682, 65535, 65535, 34689, 1918, 65535, 34688, 65535,
+    65535, 1925, 34692, 65535, 65535, 34695, 65535, 65535, 34710, 34705, 34702, 1933, 65535, 65535, 1936, 65535,
+    65535, 1939, 65535, 34709, 65535, 65535, 34714, 1945, 65535, 65535, 65535, 34731, 1954, 34721, 34720, 65535,
+    65535, 65535, 1962, 34727, 1958, 65535, 65535, 1961, 65535, 65535, 65535, 1967, 34734, 65535, 65535, 65535,
+    34834, 2031, 2002, 1987, 1980, 34745, 1976, 65535, 65535, 34747, 65535, 65535, 34752, 1983, 65535, 65535,
+    1986, 65535, 65535, 34763, 1992, 34759, 65535, 65535, 34762, 65535, 65535, 1999, 34766, 65535, 65535, 2001,
+    65535, 65535, 2016, 2009, 34774, 65535, 2008, 65535, 65535, 34781, 34780, 65535, 65535, 2015, 65535, 65535,
+    34792, 2021, 2020, 65535, 65535, 34791, 65535, 65535, 2028, 34795, 65535, 65535, 34798, 65535, 65535, 34809,
+    2036, 34803, 65535, 65535, 2040, 34807, 65535, 65535, 65535, 2057, 34818, 34815, 34814, 65535, 65535, 2049,
+    65535, 65535, 2054, 34821, 65535, 65535, 2056, 65535, 65535, 2061, 34828, 65535, 65535, 2065, 34832, 65535,
+    65535, 65535, 2096, 2095, 34850, 2077, 2074, 34841, 65535, 65535, 34844, 65535, 65535, 2081, 2080, 65535,
+    65535, 65535, 34858, 2087, 2086, 65535, 65535, 2089, 65535, 65535, 2094, 34861, 65535, 65535, 65535, 65535,
+    2102, 2099, 65535, 34869, 65535, 65535, 2118, 2111, 34876, 2107, 65535, 65535, 2110, 65535, 65535, 34883,
+    2114, 65535, 65535, 2117, 65535, 65535, 2126, 34891, 2122, 65535, 65535, 34893, 65535, 65535, 34898, 34897,
+    65535, 65535, 2132, 65535, 65535, 35017, 34960, 2167, 34920, 2145, 34910, 2141, 65535, 65535, 2144, 65535,
+    65535, 2149, 34916, 65535, 65535, 34919, 65535, 65535, 2160, 2157, 34924, 65535, 65535, 34927, 65535, 65535,
+    34932, 2163, 65535, 65535, 34934, 65535, 65535, 34945, 34938, 65535, 2174, 34941, 65535, 65535, 2176, 65535,
+    65535, 2185, 34950, 34949, 65535, 65535, 34952, 65535, 65535, 2189, 34956, 65535, 65535, 34959, 65535, 65535,
+    2222, 2209, 34970, 2199, 2198, 65535, 65535, 2201, 65535, 65535, 2206, 34973, 65535, 65535, 34976, 65535,
+    65535, 2217, 2214, 34981, 65535, 65535, 34984, 65535, 65535, 34987, 65535, 2221, 65535, 65535, 2234, 2229,
+    34996, 2227, 65535, 65535, 65535, 35001, 35000, 65535, 65535, 65535, 35010, 2239, 2238, 65535, 65535, 2241,
+    65535, 65535, 2246, 2245, 65535, 65535, 2248, 65535, 65535, 2283, 2254, 35021, 65535, 65535, 2270, 35031,
+    2260, 2259, 65535, 65535, 35030, 65535, 65535, 35035, 2266, 65535, 65535, 35037, 65535, 65535, 35044, 2275,
+    35042, 65535, 65535, 65535, 35048, 2279, 65535, 65535, 2282, 65535, 65535, 35079, 2298, 35059, 35056, 65535,
+    2290, 65535, 65535, 2295, 2294, 65535, 65535, 35065, 65535, 65535, 2306, 2303, 35070, 65535, 65535, 35073,
+    65535, 65535, 35076, 65535, 35078, 65535, 65535, 2327, 35088, 2317, 2316, 65535, 65535, 35087, 65535, 65535,
+    35092, 35091, 65535, 65535, 2326, 65535, 65535, 2333, 35098, 65535, 35100, 65535, 65535, 65535, 2412, 2365,
+    2340, 35107, 65535, 65535, 2350, 35117, 35114, 2345, 65535, 65535, 2348, 65535, 65535, 65535, 35126, 2355,
+    2354, 65535, 65535, 2357, 65535, 65535, 2362, 2361, 65535, 65535, 2364, 65535, 65535, 35155, 2374, 2369,
+    65535, 2371, 65535, 35141, 65535, 65535, 35148, 35145, 65535, 2379, 65535, 65535, 2384, 35151, 65535, 65535,
+    35154, 65535, 65535, 2403, 35164, 2393, 35160, 65535, 65535, 35163, 65535, 65535, 2400, 35167, 65535, 65535,
+    35170, 65535, 65535, 35179, 2408, 35175, 65535, 65535, 35178, 65535, 65535, 65535, 35228, 2435, 35192, 2417,
+    65535, 35189, 35188, 65535, 65535, 2423, 65535, 65535, 2428, 35195, 65535, 65535, 35200, 35199, 65535, 65535,
+    2434, 65535, 65535, 35219, 2444, 35209, 35208, 65535, 65535, 2443, 65535, 65535, 35216, 35215, 65535, 65535,
+    35218, 65535, 65535, 2459, 35224, 2455, 65535, 65535, 35226, 65535, 65535, 65535, 35240, 2471, 2468, 35235,
+    35234, 65535, 65535, 65535, 35238, 65535, 65535, 65535, 65535, 2579, 2534, 35273, 2492, 2485, 35250, 2481,
+    65535, 65535, 35252, 65535, 65535, 35257, 35256, 65535, 65535, 2491, 65535, 65535, 2498, 35263, 65535, 2497,
+    65535, 65535, 35270, 2501, 65535, 65535, 2504, 65535, 65535, 2519, 2512, 35279, 2510, 65535, 65535, 65535,
+    35284, 35283, 65535, 65535, 2518, 65535, 65535, 35295, 2524, 2523, 65535, 65535, 2526, 65535, 65535, 2531,
+    2530, 65535, 65535, 35301, 65535, 65535, 35324, 2543, 2538, 65535, 2540, 65535, 35310, 65535, 65535, 35317,
+    35314, 65535, 2548, 65535, 65535, 2553, 35320, 65535, 65535, 35323, 65535, 65535, 35340, 2565, 35330, 35329,
+    65535, 65535, 2564, 65535, 65535, 35337, 2568, 65535, 65535, 2571, 65535, 65535, 35346, 2577, 2576, 65535,
+    65535, 65535, 65535, 35395, 2602, 2589, 35354, 35353, 65535, 65535, 2588, 65535, 65535, 35363, 35360, 65535,
+    2594, 65535, 65535, 2599, 35366, 65535, 65535, 35369, 65535, 65535, 35386, 35379, 35376, 2607, 65535, 65535,
+    2610, 65535, 65535, 2615, 35382, 65535, 65535, 2617, 65535, 65535, 2624, 35391, 2622, 65535, 65535, 65535,
+    35394, 65535, 65535, 35425, 2644, 35405, 2634, 35401, 65535, 65535, 35404, 65535, 65535, 2641, 35408, 65535,
+    65535, 35411, 65535, 65535, 35420, 2649, 35416, 65535, 65535, 2651, 65535, 65535, 2656, 35423, 65535, 65535,
+    65535, 35429, 2660, 65535, 65535, 65535, 2666, 35433, 65535, 65535, 2690, 35457, 2680, 2675, 35442, 35441,
+    65535, 65535, 65535, 35447, 35446, 65535, 65535, 65535, 35450, 65535, 35454, 2685, 65535, 65535, 35456, 65535,
+    65535, 65535, 2720, 35475, 2700, 35465, 2696, 65535, 65535, 35467, 65535, 65535, 35472, 2703, 65535, 65535,
+    2706, 65535, 65535, 35483, 2712, 35479, 65535, 65535, 2714, 65535, 65535, 35487, 2718, 65535, 65535, 65535,
+    2736, 35497, 35494, 2725, 65535, 65535, 2728, 65535, 65535, 2733, 2732, 65535, 65535, 35503, 65535, 65535,
+    35512, 2741, 2740, 65535, 65535, 2743, 65535, 65535, 2748, 2747, 65535, 65535, 2750, 65535, 65535, 35625,
+    35582, 35553, 2770, 2763, 35528, 2759, 65535, 65535, 2762, 65535, 65535, 2767, 35534, 65535, 65535, 35537,
+    65535, 65535, 2778, 35543, 2774, 65535, 65535, 2777, 65535, 65535, 35550, 2781, 65535, 65535, 35552, 65535,
+    65535, 2799, 2794, 2791, 2790, 65535, 65535, 2793, 65535, 65535, 2796, 65535, 35566, 65535, 65535, 35575,
+    2804, 2803, 65535, 65535, 2806, 65535, 65535, 2811, 2810, 65535, 65535, 35581, 65535, 65535, 2842, 35595,
+    2822, 35587, 65535, 2821, 65535, 65535, 35592, 65535, 2826, 65535, 65535, 2835, 35600, 2831, 65535, 65535,
+    2834, 65535, 65535, 2839, 2838, 65535, 65535, 35609, 65535, 65535, 35624, 35619, 2848, 35615, 65535, 65535,
+    35618, 65535, 65535, 2853, 65535, 35623, 65535, 65535, 65535, 2917, 35656, 2873, 2868, 2865, 35632, 65535,
+    65535, 35635, 65535, 65535, 2870, 65535, 35640, 65535, 65535, 35649, 35646, 2877, 65535, 65535, 35648, 65535,
+    65535, 35653, 2884, 65535, 65535, 2887, 65535, 65535, 2902, 2895, 35662, 2893, 65535, 65535, 65535, 35667,
+    2898, 65535, 65535, 35669, 65535, 65535, 35678, 35675, 2906, 65535, 65535, 2909, 65535, 65535, 2914, 35681,
+    65535, 65535, 35684, 65535, 65535, 2949, 2934, 35695, 2924, 35691, 65535, 65535, 35694, 65535, 65535, 2931,
+    35698, 65535, 65535, 35701, 65535, 65535, 2942, 35707, 35706, 65535, 65535, 35709, 65535, 65535, 2946, 35713,
+    65535, 65535, 35716, 65535, 65535, 35723, 35722, 35721, 65535, 65535, 65535, 35729, 35728, 35727, 65535, 65535,
+    65535, 35733, 35732, 65535, 65535, 35735, 65535, 65535, 35854, 35799, 3002, 35755, 35748, 2977, 2976, 65535,
+    65535, 35747, 65535, 65535, 2984, 2983, 65535, 65535, 35754, 65535, 65535, 2995, 2992, 2991, 65535, 65535,
+    35762, 65535, 65535, 2999, 35766, 65535, 65535, 35769, 65535, 65535, 35784, 3011, 35776, 35775, 65535, 65535,
+    3010, 65535, 65535, 35781, 65535, 3015, 65535, 65535, 3024, 35789, 3020, 65535, 65535, 35791, 65535, 65535,
+    35796, 3027, 65535, 65535, 3030, 65535, 65535, 3059, 3046, 3039, 3036, 65535, 35806, 65535, 65535, 35811,
+    3042, 65535, 65535, 3045, 65535, 65535, 3054, 35819, 3050, 65535, 65535, 3053, 65535, 65535, 35824, 65535,
+    35826, 65535, 65535, 3071, 3068, 3065, 35832, 65535, 65535, 35835, 65535, 65535, 3070, 65535, 65535, 3079,
+    3076, 3075, 65535, 65535, 35846, 65535, 65535, 35851, 3082, 65535, 65535, 3085, 65535, 65535, 3146, 35883,
+    3102, 3095, 3092, 65535, 35862, 65535, 65535, 3099, 3098, 65535, 65535, 35869, 65535, 65535, 3110, 35875,
+    35874, 65535, 65535, 3109, 65535, 65535, 35880, 65535, 35882, 65535, 65535, 3131, 35892, 3121, 3120, 65535,
+    65535, 3123, 65535, 65535, 3128, 35895, 65535, 65535, 35898, 65535, 65535, 3139, 35904, 35903, 65535, 65535,
+    35906, 65535, 65535, 35911, 35910, 65535, 65535, 35913, 65535, 65535, 3168, 3163, 35924, 3153, 35920, 65535,
+    65535, 3155, 65535, 65535, 3160, 3159, 65535, 65535, 35930, 65535, 65535, 3167, 35934, 65535, 65535, 65535,
+    65535, 3281, 3230, 35971, 35956, 3181, 3178, 3177, 65535, 65535, 3180, 65535, 65535, 35953, 35952, 65535,
+    65535, 3187, 65535, 65535, 3196, 3193, 3192, 65535, 65535, 35963, 65535, 65535, 3200, 35967, 65535, 65535,
+    3202, 65535, 65535, 3219, 35980, 3209, 3208, 65535, 65535, 35979, 65535, 65535, 3216, 35983, 65535, 65535,
+    35986, 65535, 65535, 3227, 35992, 35991, 65535, 65535, 3226, 65535, 65535, 35997, 65535, 65535, 36020, 3245,
+    36006, 36005, 36004, 65535, 65535, 65535, 36010, 3241, 65535, 65535, 3244, 65535, 65535, 36015, 65535, 3251,
+    36018, 65535, 65535, 65535, 3266, 36029, 3258, 36025, 65535, 65535, 36028, 65535, 65535, 3263, 65535, 36033,
+    65535, 65535, 36042, 36039, 3270, 65535, 65535, 3273, 65535, 65535, 3278, 36045, 65535, 65535, 36048, 65535,
+    65535, 36099, 3302, 36061, 3286, 65535, 36058, 36057, 65535, 65535, 3292, 65535, 65535, 3295, 65535, 36067,
+    3298, 65535, 65535, 3301, 65535, 65535, 36086, 3311, 36076, 3307, 65535, 65535, 3310, 65535, 65535, 36083,
+    36082, 65535, 65535, 36085, 65535, 65535, 3326, 36091, 36090, 65535, 65535, 3325, 65535, 65535, 36098, 3329,
+    65535, 65535, 65535, 36117, 3344, 3339, 36106, 36105, 65535, 65535, 65535, 36111, 36110, 65535, 65535, 65535,
+    3348, 36115, 65535, 65535, 65535, 36121, 3352, 65535, 65535, 65535, 3470, 3411, 36156, 3373, 3366, 3363,
+    3362, 65535, 65535, 36133, 65535, 65535, 3370, 36137, 65535, 65535, 3372, 65535, 65535, 36149, 3378, 36145,
+    65535, 65535, 3380, 65535, 65535, 3385, 36152, 65535, 65535, 36155, 65535, 65535, 3396, 3391, 65535, 36161,
+    65535, 36163, 65535, 65535, 3404, 3401, 3400, 65535, 65535, 36171, 65535, 65535, 3408, 36175, 65535, 65535,
+    36178, 65535, 65535, 36207, 36192, 3419, 3416, 65535, 3418, 65535, 65535, 3421, 65535, 36191, 65535, 65535,
+    3432, 3429, 3428, 65535, 65535, 3431, 65535, 65535, 36204, 36203, 65535, 65535, 36206, 65535, 65535, 3455,
+    36216, 3445, 36212, 65535, 65535, 36215, 65535, 65535, 3452, 36219, 65535, 65535, 3454, 65535, 65535, 36231,
+    3460, 3459, 65535, 65535, 36230, 65535, 65535, 3467, 36234, 65535, 65535, 36237, 65535, 65535, 36294, 3497,
+    36254, 36247, 36244, 65535, 36246, 65535, 65535, 3483, 36250, 65535, 65535, 36253, 65535, 65535, 3494, 3491,
+    36258, 65535, 65535, 36261, 65535, 65535, 36264, 65535, 65535, 36281, 3506, 3503, 3502, 65535, 65535, 36273,
+    65535, 65535, 36278, 36277, 65535, 65535, 36280, 65535, 65535, 36289, 3518, 36285, 65535, 65535, 36288, 65535,
+    65535, 3525, 36292, 65535, 65535, 65535, 36304, 3531, 36298, 65535, 65535, 36303, 3534, 65535, 65535, 65535,
+    65535, 36319, 3544, 3541, 65535, 3543, 65535, 65535, 3546, 65535, 3548, 65535, 3550, 65535, 65535, 3615,
+    3584, 36337, 36330, 3559, 3558, 65535, 65535, 36329, 65535, 65535, 3566, 3565, 65535, 65535, 3568, 65535,
+    65535, 3577, 36342, 3573, 65535, 65535, 3576, 65535, 65535, 3581, 36348, 65535, 65535, 36351, 65535, 65535,
+    36368, 36361, 36358, 36357, 65535, 65535, 36360, 65535, 65535, 3597, 3596, 65535, 65535, 3599, 65535, 65535,
+    3608, 36373, 3604, 65535, 65535, 3607, 65535, 65535, 36380, 3611, 65535, 65535, 3614, 65535, 65535, 36415,
+    3632, 36393, 36390, 36389, 65535, 65535, 3624, 65535, 65535, 3629, 3628, 65535, 65535, 36399, 65535, 65535,
+    36408, 3637, 3636, 65535, 65535, 36407, 65535, 65535, 36412, 3643, 65535, 65535, 3646, 65535, 65535, 36425,
+    3652, 36419, 65535, 65535, 36424, 3655, 65535, 65535, 65535, 65535, 3738, 36473, 3682, 36441, 3670, 36435,
+    3666, 65535, 65535, 3669, 65535, 65535, 36440, 65535, 65535, 36449, 3678, 3677, 65535, 65535, 36448, 65535,
+    65535, 65535, 36458, 36453, 65535, 3687, 65535, 36457, 65535, 65535, 3698, 36463, 3694, 65535, 65535, 3697,
+    65535, 65535, 3702, 36469, 65535, 65535, 36472, 65535, 65535, 36499, 3720, 3713, 36480, 3711, 65535, 65535,
+    65535, 36485, 3716, 65535, 65535, 36487, 65535, 65535, 36496, 3725, 36492, 65535, 65535, 36495, 65535, 65535,
+    3730, 65535, 65535, 3737, 36504, 3735, 65535, 65535, 65535, 65535, 3784, 36523, 3742, 65535, 36516, 36515,
+    3746, 65535, 65535, 65535, 36520, 36519, 65535, 65535, 36522, 65535, 65535, 36539, 3764, 3761, 36528, 65535,
+    65535, 36531, 65535, 65535, 3768, 36535, 65535, 65535, 36538, 65535, 65535, 3779, 36544, 3775, 65535, 65535,
+    36546, 65535, 65535, 3783, 36550, 65535, 65535, 65535, 36584, 3801, 3794, 3791, 36558, 65535, 65535, 36561,
+    65535, 65535, 3798, 3797, 65535, 65535, 36568, 65535, 65535, 3809, 36574, 3805, 65535, 65535, 36576, 65535,
+    65535, 36581, 3812, 65535, 65535, 36583, 65535, 65535, 3832, 36593, 3822, 36589, 65535, 65535, 36592, 65535,
+    65535, 3829, 3828, 65535, 65535, 3831, 65535, 65535, 3840, 3837, 36604, 65535, 65535, 36607, 65535, 65535,
+    3844, 36611, 65535, 65535, 36614, 65535, 65535, 36631, 3854, 3851, 65535, 3853, 65535, 65535, 3856, 65535,
+    3860, 3859, 65535, 65535, 3862, 65535, 65535, 3887, 36654, 36647, 3874, 3871, 3870, 65535, 65535, 36641,
+    65535, 65535, 36644, 65535, 36646, 65535, 65535, 36653, 36650, 65535, 3884, 65535, 65535, 65535, 65535, 3919,
+    36672, 3897, 36662, 3893, 65535, 65535, 3896, 65535, 65535, 36669, 36668, 65535, 65535, 3903, 65535, 65535,
+    36680, 3909, 3908, 65535, 65535, 36679, 65535, 65535, 36684, 36683, 65535, 65535, 3918, 65535, 65535, 3935,
+    36696, 3925, 3924, 65535, 65535, 3927, 65535, 65535, 3932, 36699, 65535, 65535, 3934, 65535, 65535, 36711,
+    3940, 3939, 65535, 65535, 36710, 65535, 65535, 3947, 36714, 65535, 65535, 3949, 65535, 65535, 36834, 4013,
+    36750, 3969, 36730, 3959, 36726, 65535, 65535, 36729, 65535, 65535, 3966, 3965, 65535, 65535, 3968, 65535,
+    65535, 36743, 3974, 36741, 65535, 65535, 65535, 3979, 3978, 65535, 65535, 36749, 65535, 65535, 3998, 3991,
+    3988, 36755, 65535, 65535, 36758, 65535, 65535, 36763, 36762, 65535, 65535, 3997, 65535, 65535, 4006, 36771,
+    4002, 65535, 65535, 4005, 65535, 65535, 36778, 4009, 65535, 65535, 36780, 65535, 65535, 4037, 36790, 36785,
+    65535, 4021, 36788, 65535, 65535, 65535, 4030, 36795, 4026, 65535, 65535, 4029, 65535, 65535, 36802, 4033,
+    65535, 65535, 4036, 65535, 65535, 36821, 4046, 4043, 36810, 65535, 65535, 36813, 65535, 65535, 36818, 4049,
+    65535, 65535, 4052, 65535, 65535, 4061, 36826, 36825, 65535, 65535, 4060, 65535, 65535, 36833, 4064, 65535,
+    65535, 65535, 4116, 4099, 36852, 4077, 4074, 36841, 65535, 65535, 36844, 65535, 65535, 4081, 36848, 65535,
+    65535, 36851, 65535, 65535, 4092, 36857, 4088, 65535, 65535, 4091, 65535, 65535, 36864, 4095, 65535, 65535,
+    4098, 65535, 65535, 36871, 4102, 65535, 65535, 4111, 36876, 36875, 65535, 65535, 4110, 65535, 65535, 4115,
+    36882, 65535, 65535, 65535, 4136, 4123, 4120, 65535, 36890, 65535, 65535, 36899, 36896, 4127, 65535, 65535,
+    4130, 65535, 65535, 4133, 65535, 36903, 65535, 65535, 4152, 36913, 4142, 4141, 65535, 65535, 36912, 65535,
+    65535, 4149, 36916, 65535, 65535, 4151, 65535, 65535, 36928, 4157, 36924, 65535, 65535, 4159, 65535, 65535,
+    65535, 36965, 4192, 4185, 4178, 4171, 36936, 65535, 4170, 65535, 65535, 4175, 4174, 65535, 65535, 4177,
+    65535, 65535, 4184, 4183, 36950, 65535, 65535, 65535, 65535, 4187, 65535, 4189, 65535, 36959, 65535, 65535,
+    4196, 36963, 65535, 65535, 65535, 4205, 4202, 36969, 65535, 65535, 36972, 65535, 65535, 4237, 36990, 4215,
+    36980, 4211, 65535, 65535, 4214, 65535, 65535, 36987, 36986, 65535, 65535, 4221, 65535, 65535, 4230, 36995,
+    4226, 65535, 65535, 4229, 65535, 65535, 4234, 37001, 65535, 65535, 37004, 65535, 65535, 4253, 37014, 37011,
+    4242, 65535, 65535, 37013, 65535, 65535, 37018, 4249, 65535, 65535, 4252, 65535, 65535, 37029, 4258, 4257,
+    65535, 65535, 4260, 65535, 65535, 4265, 37032, 65535, 65535, 37035, 65535, 65535, 37154, 4331, 37068, 4287,
+    37048, 4277, 37044, 65535, 65535, 37047, 65535, 65535, 4284, 4283, 65535, 65535, 4286, 65535, 65535, 37061,
+    4292, 37059, 65535, 65535, 65535, 4297, 4296, 65535, 65535, 37067, 65535, 65535, 4316, 4309, 4306, 37073,
+    65535, 65535, 37076, 65535, 65535, 37081, 4312, 65535, 65535, 4315, 65535, 65535, 4324, 37089, 4320, 65535,
+    65535, 4323, 65535, 65535, 37096, 4327, 65535, 65535, 37098, 65535, 65535, 4361, 37114, 37107, 4338, 4337,
+    65535, 65535, 65535, 4343, 4342, 65535, 65535, 4345, 65535, 65535, 4354, 37119, 4350, 65535, 65535, 4353,
+    65535, 65535, 37126, 4357, 65535, 65535, 4360, 65535, 65535, 37145, 4370, 37135, 37134, 65535, 65535, 4369,
+    65535, 65535, 37142, 4373, 65535, 65535, 4376, 65535, 65535, 37153, 4382, 37149, 65535, 65535, 37152, 65535,
+    65535, 65535, 4414, 37167, 4390, 65535, 37160, 65535, 37164, 37163, 65535, 65535, 4398, 65535, 65535, 4405,
+    4404, 37171, 65535, 65535, 65535, 37181, 37178, 37177, 65535, 65535, 37180, 65535, 65535, 65535, 4442, 4431,
+    37192, 4421, 4420, 65535, 65535, 4423, 65535, 65535, 4428, 37195, 65535, 65535, 37198, 65535, 65535, 37203,
+    4434, 65535, 65535, 4439, 37206, 65535, 65535, 4441, 65535, 65535, 4452, 4445, 65535, 37217, 4448, 65535,
+    65535, 4451, 65535, 65535, 4460, 37225, 4456, 65535, 65535, 4459, 65535, 65535, 37232, 4463, 65535, 65535,
+    65535, 37335, 37294, 37267, 4484, 4477, 37242, 4473, 65535, 65535, 4476, 65535, 65535, 37249, 37248, 65535,
+    65535, 37251, 65535, 65535, 4492, 37257, 4488, 65535, 65535, 4491, 65535, 65535, 37264, 4495, 65535, 65535,
+    37266, 65535, 65535, 4513, 4508, 4505, 4504, 65535, 65535, 4507, 65535, 65535, 4510, 65535, 37280, 65535,
+    65535, 37289, 4518, 4517, 65535, 65535, 4520, 65535, 65535, 4525, 4524, 65535, 65535, 65535, 4552, 37305,
+    37298, 65535, 4534, 4533, 65535, 65535, 4536, 65535, 65535, 4545, 4542, 4541, 65535, 65535, 37312, 65535,
+    65535, 4549, 4548, 65535, 65535, 37319, 65535, 65535, 37334, 37329, 4558, 37325, 65535, 65535, 37328, 65535,
+    65535, 4563, 65535, 37333, 65535, 65535, 65535, 4627, 37364, 4583, 4578, 37343, 4574, 65535, 65535, 4577,
+    65535, 65535, 37350, 37349, 65535, 65535, 65535, 4589, 37354, 65535, 4588, 65535, 65535, 37361, 4592, 65535,
+    65535, 4595, 65535, 65535, 4612, 4605, 37370, 4601, 65535, 65535, 37372, 65535, 65535, 37377, 37376, 65535,
+    65535, 4611, 65535, 65535, 37388, 37385, 4616, 65535, 65535, 4619, 65535, 65535, 4624, 4623, 65535, 65535,
+    37394, 65535, 65535, 4659, 37412, 37405, 37402, 37401, 65535, 65535, 4636, 65535, 65535, 4641, 37408, 65535,
+    65535, 4643, 65535, 65535, 4652, 37417, 4648, 65535, 65535, 4651, 65535, 65535, 37424, 4655, 65535, 65535,
+    37426, 65535, 65535, 4675, 37436, 4665, 4664, 65535, 65535, 4667, 65535, 65535, 4672, 37439, 65535, 65535,
+    37442, 65535, 65535, 37451, 4680, 37447, 65535, 65535, 37450, 65535, 65535, 37455, 37454, 65535, 65535, 37457,
+    65535, 65535, 4802, 4747, 4724, 37477, 4702, 4699, 4698, 65535, 65535, 37469, 65535, 65535, 4706, 37473,
+    65535, 65535, 37476, 65535, 65535, 4717, 37482, 4713, 65535, 65535, 4716, 65535, 65535, 37489, 4720, 65535,
+    65535, 37491, 65535, 65535, 37508, 37501, 4730, 37497, 65535, 65535, 37500, 65535, 65535, 4737, 4736, 65535,
+    65535, 37507, 65535, 65535, 4746, 4745, 37512, 65535, 65535, 65535, 65535, 37545, 4762, 37523, 37522, 37521,
+    65535, 65535, 65535, 4759, 37526, 65535, 65535, 4761, 65535, 65535, 4770, 4767, 37534, 65535, 65535, 4769,
+    65535, 65535, 4774, 37541, 65535, 65535, 37544, 65535, 65535, 4787, 37554, 4783, 4782, 65535, 65535, 37553,
+    65535, 65535, 65535, 37563, 37560, 4791, 65535, 65535, 4794, 65535, 65535, 4799, 4798, 65535, 65535, 37569,
+    65535, 65535, 37614, 37589, 37578, 37577, 37576, 65535, 65535, 65535, 4816, 4815, 4814, 65535, 65535, 65535,
+    4818, 65535, 4820, 65535, 65535, 37599, 4826, 37593, 65535, 65535, 37596, 65535, 4830, 65535, 65535, 37607,
+    4836, 4835, 65535, 65535, 4838, 65535, 65535, 4843, 37610, 65535, 65535, 4845, 65535, 65535, 4868, 37625,
+    4852, 37619, 65535, 65535, 37622, 65535, 4856, 65535, 65535, 4863, 4860, 65535, 37630, 65535, 65535, 37635,
+    37634, 65535, 65535, 65535, 37650, 4877, 37642, 37641, 65535, 65535, 4876, 65535, 65535, 4881, 37648, 65535,
+    65535, 65535, 4890, 37655, 4886, 65535, 65535, 37657, 65535, 65535, 37662, 4893, 65535, 65535, 4896, 65535,
+    65535, 37705, 4930, 4923, 4912, 4907, 37672, 65535, 37674, 65535, 65535, 4909, 65535, 4911, 65535, 65535,
+    4920, 37685, 37684, 65535, 65535, 37687, 65535, 65535, 4922, 65535, 65535, 4925, 65535, 4927, 65535, 37697,
+    65535, 65535, 4936, 4935, 37702, 65535, 65535, 65535, 65535, 4967, 37716, 4947, 37714, 4945, 37712, 65535,
+    65535, 65535, 65535, 65535, 37724, 37723, 4954, 37721, 65535, 65535, 65535, 65535, 37730, 4961, 37728, 65535,
+    65535, 65535, 4964, 65535, 37734, 65535, 65535, 4995, 37748, 4975, 37742, 4973, 65535, 65535, 65535, 37745,
+    65535, 4979, 65535, 65535, 4988, 4985, 4984, 65535, 65535, 37755, 65535, 65535, 4992, 37759, 65535, 65535,
+    37762, 65535, 65535, 5011, 37772, 5001, 37768, 65535, 65535, 37771, 65535, 65535, 37776, 5007, 65535, 65535,
+    5010, 65535, 65535, 37787, 5016, 5015, 65535, 65535, 5018, 65535, 65535, 5023, 37790, 65535, 65535, 37793,
+    65535, 65535, 37902, 37855, 37828, 5045, 5038, 37803, 5034, 65535, 65535, 37805, 65535, 65535, 37810, 5041,
+    65535, 65535, 5044, 65535, 65535, 5053, 37818, 37817, 65535, 65535, 5052, 65535, 65535, 37825, 5056, 65535,
+    65535, 37827, 65535, 65535, 5074, 5069, 5066, 5065, 65535, 65535, 5068, 65535, 65535, 37839, 65535, 5073,
+    65535, 65535, 37850, 5079, 5078, 65535, 65535, 37849, 65535, 65535, 5086, 5085, 65535, 65535, 65535, 5119,
+    37872, 5097, 5094, 37861, 65535, 65535, 5096, 65535, 65535, 37869, 5100, 65535, 65535, 5103, 65535, 65535,
+    5112, 5109, 37876, 65535, 65535, 37879, 65535, 65535, 37884, 5115, 65535, 65535, 5118, 65535, 65535, 37901,
+    37896, 5125, 37892, 65535, 65535, 37895, 65535, 65535, 5130, 65535, 37900, 65535, 65535, 65535, 5196, 37933,
+    5152, 5145, 5142, 37909, 65535, 65535, 37912, 65535, 65535, 37917, 5148, 65535, 65535, 5151, 65535, 65535,
+    5158, 5155, 65535, 37925, 65535, 65535, 37930, 5161, 65535, 65535, 5164, 65535, 65535, 5181, 5174, 37939,
+    5170, 65535, 65535, 37941, 65535, 65535, 37946, 5177, 65535, 65535, 5180, 65535, 65535, 37957, 37954, 5185,
+    65535, 65535, 5188, 65535, 65535, 5193, 37960, 65535, 65535, 37963, 65535, 65535, 5228, 5213, 37974, 37971,
+    37970, 65535, 65535, 37973, 65535, 65535, 5210, 37977, 65535, 65535, 37980, 65535, 65535, 5221, 37986, 5217,
+    65535, 65535, 37988, 65535, 65535, 37993, 5224, 65535, 65535, 37995, 65535, 65535, 37998, 65535, 38006, 38003,
+    38002, 65535, 65535, 38005, 65535, 65535, 38008, 65535, 65535, 5357, 5296, 5273, 38028, 5253, 5250, 38017,
+    65535, 65535, 38020, 65535, 65535, 5257, 38024, 65535, 65535, 38027, 65535, 65535, 5268, 38033, 5264, 65535,
+    65535, 5267, 65535, 65535, 38040, 38039, 65535, 65535, 65535, 38057, 38050, 38047, 5278, 65535, 65535, 5281,
+    65535, 65535, 5286, 5285, 65535, 65535, 38056, 65535, 65535, 5295, 38062, 5293, 65535, 65535, 65535, 65535,
+    38096, 5313, 38074, 38071, 38070, 65535, 65535, 38073, 65535, 65535, 5310, 5309, 65535, 65535, 38080, 65535,
+    65535, 5321, 5318, 38085, 65535, 65535, 5320, 65535, 65535, 5325, 38092, 65535, 65535, 38095, 65535, 65535,
+    5342, 38105, 5334, 38101, 65535, 65535, 38104, 65535, 65535, 38109, 5340, 65535, 65535, 65535, 38118, 5347,
+    38114, 65535, 65535, 38117, 65535, 65535, 5354, 38121, 65535, 65535, 38124, 65535, 65535, 38175, 38152, 38143,
+    38136, 38133, 38132, 65535, 65535, 5367, 65535, 65535, 5372, 38139, 65535, 65535, 38142, 65535, 65535, 5377,
+    65535, 5381, 5380, 65535, 65535, 5383, 65535, 65535, 38164, 5393, 38158, 5389, 65535, 65535, 5392, 65535,
+    65535, 38163, 65535, 65535, 5400, 38167, 65535, 65535, 38172, 5403, 65535, 65535, 5406, 65535, 65535, 5425,
+    38186, 5411, 65535, 5415, 38182, 65535, 65535, 38185, 65535, 65535, 5420, 65535, 38192, 38191, 65535, 65535,
+    65535, 38209, 5434, 38199, 5430, 65535, 65535, 5433, 65535, 65535, 5438, 5437, 65535, 65535, 38208, 65535,
+    65535, 5449, 5446, 5445, 65535, 65535, 38216, 65535, 65535, 38221, 5452, 65535, 65535, 5455, 65535, 65535,
+    5476, 38243, 38242, 5471, 38236, 5465, 38232, 65535, 65535, 38235, 65535, 65535, 38238, 65535, 65535, 38241,
+    65535, 65535, 65535, 65535, 38300, 5501, 5488, 38255, 5484, 38251, 65535, 65535, 38254, 65535, 65535, 65535,
+    38262, 38259, 65535, 38261, 65535, 65535, 5498, 5497, 65535, 65535, 38268, 65535, 65535, 5517, 5510, 38275,
+    5506, 65535, 65535, 5509, 65535, 65535, 5514, 38281, 65535, 65535, 5516, 65535, 65535, 38293, 38290, 5521,
+    65535, 65535, 5524, 65535, 65535, 5529, 38296, 65535, 65535, 5531, 65535, 65535, 5540, 38307, 5536, 65535,
+    38306, 65535, 65535, 65535, 38324, 5549, 38314, 5545, 65535, 65535, 5548, 65535, 65535, 5553, 5552, 65535,
+    65535, 5555, 65535, 65535, 5560, 38327, 65535, 65535, 5564, 5563, 65535, 65535, 5566, 65535, 65535, 5693,
+    5632, 38369, 5586, 5579, 38344, 38343, 65535, 65535, 5578, 65535, 65535, 38351, 5582, 65535, 65535, 5585,
+    65535, 65535, 5594, 38359, 38358, 65535, 65535, 38361, 65535, 65535, 38366, 5597, 65535, 65535, 5600, 65535,
+    65535, 5617, 38378, 5607, 5606, 65535, 65535, 38377, 65535, 65535, 5614, 38381, 65535, 65535, 38384, 65535,
+    65535, 38393, 38390, 5621, 65535, 65535, 38392, 65535, 65535, 38397, 5628, 65535, 65535, 5631, 65535, 65535,
+    38432, 5649, 38410, 5639, 38406, 65535, 65535, 38409, 65535, 65535, 38414, 5645, 65535, 65535, 5648, 65535,
+    65535, 5657, 38422, 38421, 65535, 65535, 5656, 65535, 65535, 38429, 5660, 65535, 65535, 38431, 65535, 65535,
+    5678, 5671, 5668, 65535, 38438, 65535, 65535, 38443, 5674, 65535, 65535, 38445, 65535, 65535, 38454, 5683,
+    5682, 65535, 65535, 38453, 65535, 65535, 5690, 5689, 65535, 65535, 5692, 65535, 65535, 38481, 38468, 5697,
+    65535, 38467, 65535, 65535, 5702, 65535, 38474, 5705, 65535, 65535, 5710, 38477, 65535, 65535, 38480, 65535,
+    65535, 38499, 5726, 5721, 38486, 65535, 38488, 65535, 65535, 38491, 65535, 38493, 65535, 65535, 38498, 38497,
+    65535, 65535, 65535, 38505, 5736, 5735, 65535, 65535, 65535, 38511, 5742, 38509, 65535, 65535, 65535, 65535,
+    38636, 5809, 5778, 5763, 38524, 5753, 5752, 65535, 65535, 38523, 65535, 65535, 5760, 38527, 65535, 65535,
+    38530, 65535, 65535, 38539, 5768, 38535, 65535, 65535, 38538, 65535, 65535, 5775, 38542, 65535, 65535, 5777,
+    65535, 65535, 38562, 5787, 38552, 38551, 65535, 65535, 5786, 65535, 65535, 5791, 5790, 65535, 65535, 38561,
+    65535, 65535, 5802, 38567, 5798, 65535, 65535, 38569, 65535, 65535, 38574, 5805, 65535, 65535, 5808, 65535,
+    65535, 38607, 38592, 38587, 38584, 38583, 65535, 65535, 5818, 65535, 65535, 5821, 65535, 5823, 65535, 65535,
+    38600, 5829, 38596, 65535, 65535, 38599, 65535, 65535, 5836, 38603, 65535, 65535, 38606, 65535, 65535, 5853,
+    38614, 5845, 5844, 65535, 65535, 65535, 5850, 38617, 65535, 65535, 38620, 65535, 65535, 38629, 5858, 38625,
+    65535, 65535, 38628, 65535, 65535, 5865, 38632, 65535, 65535, 38635, 65535, 65535, 5918, 5889, 38654, 5879,
+    5876, 5875, 65535, 65535, 38646, 65535, 65535, 38651, 38650, 65535, 65535, 38653, 65535, 65535, 38656, 65535,
+    65535, 38673, 5898, 38663, 38662, 65535, 65535, 38665, 65535, 65535, 38670, 5901, 65535, 65535, 5904, 65535,
+    65535, 5911, 38676, 65535, 38678, 65535, 65535, 5915, 5914, 65535, 65535, 5917, 65535, 65535, 38714, 5935,
+    38696, 38693, 5924, 65535, 65535, 38695, 65535, 65535, 5932, 38699, 65535, 65535, 5934, 65535, 65535, 38711,
+    38708, 5939, 65535, 65535, 5942, 65535, 65535, 38713, 65535, 65535, 5956, 38723, 38720, 38719, 65535, 65535,
+    5954, 65535, 65535, 65535, 5962, 38729, 5960, 65535, 65535, 65535, 65535, 6063, 6012, 5995, 5980, 38743,
+    5972, 38739, 65535, 65535, 38742, 65535, 65535, 5977, 65535, 38747, 65535, 65535, 5988, 38753, 5984, 65535,
+    65535, 5987, 65535, 65535, 38760, 5991, 65535, 65535, 5994, 65535, 65535, 38773, 38766, 65535, 6002, 38769,
+    65535, 65535, 38772, 65535, 65535, 38779, 38776, 65535, 6010, 65535, 65535, 65535, 38804, 6027, 38788, 6017,
+    65535, 38787, 65535, 65535, 6024, 38791, 65535, 65535, 38794, 65535, 65535, 38803, 6032, 38799, 65535, 65535,
+    38802, 65535, 65535, 65535, 6050, 6043, 38810, 6041, 65535, 65535, 65535, 38815, 38814, 65535, 65535, 6049,
+    65535, 65535, 38826, 6055, 6054, 65535, 65535, 38825, 65535, 65535, 6060, 65535, 38830, 65535, 65535, 38863,
+    38838, 6067, 65535, 38837, 65535, 65535, 6084, 6077, 38842, 65535, 6076, 65535, 65535, 38849, 6080, 65535,
+    65535, 6083, 65535, 65535, 38856, 6087, 65535, 65535, 6092, 38859, 65535, 65535, 38862, 65535, 65535, 38891,
+    6110, 6103, 38868, 65535, 38870, 65535, 65535, 38875, 38874, 65535, 65535, 6109, 65535, 65535, 38886, 6115,
+    6114, 65535, 65535, 38885, 65535, 65535, 38890, 6121, 65535, 65535, 65535, 38903, 6130, 38895, 65535, 38897,
+    65535, 65535, 6134, 38901, 65535, 65535, 65535, 65535, 6238, 6179, 6150, 38917, 38916, 6145, 38912, 65535,
+    65535, 38915, 65535, 65535, 65535, 65535, 6164, 38927, 38924, 6155, 65535, 65535, 6158, 65535, 65535, 6161,
+    65535, 38931, 65535, 65535, 6172, 38937, 38936, 65535, 65535, 6171, 65535, 65535, 38944, 6175, 65535, 65535,
+    6178, 65535, 65535, 38975, 6192, 6187, 38954, 38953, 65535, 65535, 65535, 38959, 38958, 65535, 65535, 65535,
+    6200, 38965, 6196, 65535, 65535, 6199, 65535, 65535, 38972, 38971, 65535, 65535, 38974, 65535, 65535, 6223,
+    38984, 38981, 38980, 65535, 65535, 6215, 65535, 65535, 38988, 6219, 65535, 65535, 6222, 65535, 65535, 38999,
+    6228, 38995, 65535, 65535, 38998, 65535, 65535, 6235, 39002, 65535, 65535, 39005, 65535, 65535, 39062, 6269,
+    39022, 6247, 39012, 65535, 39014, 65535, 65535, 39019, 39018, 65535, 65535, 39021, 65535, 65535, 6262, 39027,
+    6258, 65535, 65535, 39029, 65535, 65535, 39034, 39033, 65535, 65535, 39036, 65535, 65535, 39053, 6278, 39043,
+    39042, 65535, 65535, 6277, 65535, 65535, 39050, 6281, 65535, 65535, 39052, 65535, 65535, 6293, 39058, 6289,
+    65535, 65535, 39060, 65535, 65535, 65535, 39074, 6301, 39068, 39067, 65535, 65535, 65535, 39073, 6304, 65535,
+    65535, 65535, 65535, 6417, 6360, 6341, 6326, 6319, 39084, 6315, 65535, 65535, 39086, 65535, 65535, 39091,
+    6322, 65535, 65535, 39093, 65535, 65535, 6334, 39099, 39098, 65535, 65535, 39101, 65535, 65535, 39106, 6337,
+    65535, 65535, 39108, 65535, 65535, 39121, 39114, 39113, 65535, 65535, 6350, 39117, 65535, 65535, 39120, 65535,
+    65535, 39127, 39124, 65535, 6358, 65535, 65535, 65535, 39158, 6375, 39136, 6367, 39134, 65535, 65535, 65535,
+    6372, 39139, 65535, 65535, 6374, 65535, 65535, 6383, 6380, 39147, 65535, 65535, 6382, 65535, 65535, 6387,
+    39154, 65535, 65535, 6389, 65535, 65535, 6406, 6399, 39164, 39163, 65535, 65535, 6398, 65535, 65535, 39171,
+    6402, 65535, 65535, 6405, 65535, 65535, 39182, 6411, 39178, 65535, 65535, 6413, 65535, 65535, 39184, 65535,
+    65535, 39237, 6444, 39197, 6422, 65535, 39194, 6425, 65535, 65535, 39196, 65535, 65535, 6437, 39202, 6433,
+    65535, 65535, 39204, 65535, 65535, 39209, 39208, 65535, 65535, 39211, 65535, 65535, 39228, 6453, 39218, 39217,
+    65535, 65535, 39220, 65535, 65535, 39225, 39224, 65535, 65535, 39227, 65535, 65535, 6468, 39233, 6464, 65535,
+    65535, 39235, 65535, 65535, 65535, 39249, 6476, 39243, 39242, 65535, 65535, 65535, 39248, 6479, 65535, 65535,
+    65535, 39251, 65535, 65535, 6608, 6549, 6518, 6503, 39264, 6493, 6492, 65535, 65535, 6495, 65535, 65535,
+    6500, 39267, 65535, 65535, 6502, 65535, 65535, 39279, 6508, 39275, 65535, 65535, 39278, 65535, 65535, 39283,
+    39282, 65535, 65535, 39285, 65535, 65535, 39302, 6527, 39292, 39291, 65535, 65535, 6526, 65535, 65535, 6531,
+    6530, 65535, 65535, 39301, 65535, 65535, 6542, 39307, 6538, 65535, 65535, 39309, 65535, 65535, 39314, 39313,
+    65535, 65535, 6548, 65535, 65535, 39347, 39332, 39327, 39324, 6555, 65535, 65535, 6558, 65535, 65535, 6561,
+    65535, 6563, 65535, 65535, 39340, 6569, 6568, 65535, 65535, 39339, 65535, 65535, 6576, 39343, 65535, 65535,
+    6578, 65535, 65535, 6593, 39356, 6585, 39352, 65535, 65535, 39355, 65535, 65535, 39360, 6591, 65535, 65535,
+    65535, 39369, 6598, 39365, 65535, 65535, 39368, 65535, 65535, 6605, 39372, 65535, 65535, 39375, 65535, 65535,
+    39406, 39387, 39384, 6613, 65535, 39383, 65535, 65535, 6618, 65535, 65535, 6627, 39394, 39393, 39392, 65535,
+    65535, 65535, 65535, 6633, 39400, 39399, 65535, 65535, 65535, 39405, 39404, 65535, 65535, 65535, 6660, 39423,
+    39416, 6645, 39412, 65535, 65535, 39415, 65535, 65535, 39420, 6651, 65535, 65535, 6654, 65535, 65535, 6659,
+    39426, 65535, 65535, 65535, 65535, 6777, 6718, 6687, 39446, 6673, 39438, 6669, 65535, 65535, 6672, 65535,
+    65535, 39443, 65535, 39445, 65535, 65535, 6682, 6681, 65535, 65535, 39452, 65535, 39454, 65535, 65535, 6703,
+    39464, 39461, 39460, 65535, 65535, 6695, 65535, 65535, 6700, 39467, 65535, 65535, 39470, 65535, 65535, 39479,
+    6708, 6707, 65535, 65535, 6710, 65535, 65535, 6715, 39482, 65535, 65535, 39485, 65535, 65535, 39518, 6735,
+    6728, 39493, 39492, 65535, 65535, 39495, 65535, 65535, 39500, 39499, 65535, 65535, 39502, 65535, 65535, 6743,
+    39508, 39507, 65535, 65535, 6742, 65535, 65535, 39515, 6746, 65535, 65535, 39517, 65535, 65535, 6764, 39527,
+    6756, 39523, 65535, 65535, 39526, 65535, 65535, 39531, 6762, 65535, 65535, 65535, 39540, 6769, 39536, 65535,
+    65535, 39539, 65535, 65535, 6776, 39543, 65535, 65535, 65535, 39605, 6806, 39559, 6784, 39551, 65535, 65535,
+    39556, 6787, 65535, 65535, 39558, 65535, 65535, 6799, 39564, 6795, 65535, 65535, 39566, 65535, 65535, 39571,
+    39570, 65535, 65535, 39573, 65535, 65535, 39590, 6815, 39580, 39579, 65535, 65535, 6814, 65535, 65535, 39587,
+    39586, 65535, 65535, 39589, 65535, 65535, 6830, 39595, 39594, 65535, 65535, 6829, 65535, 65535, 6834, 39601,
+    65535, 65535, 39604, 65535, 65535, 39619, 6844, 39611, 39610, 65535, 65535, 65535, 39618, 6849, 39616, 65535,
+    65535, 65535, 65535, 65535, 6932, 39669, 6878, 39637, 6864, 39629, 6860, 65535, 65535, 6863, 65535, 65535,
+    39634, 65535, 39636, 65535, 65535, 6873, 6872, 65535, 65535, 39643, 65535, 39645, 65535, 65535, 39654, 39649,
+    65535, 6883, 65535, 39653, 65535, 65535, 6894, 39659, 6890, 65535, 65535, 6893, 65535, 65535, 39666, 6897,
+    65535, 65535, 39668, 65535, 65535, 39689, 6916, 6909, 39676, 6907, 65535, 65535, 65535, 39681, 6912, 65535,
+    65535, 6915, 65535, 65535, 6920, 39687, 65535, 65535, 65535, 39699, 6926, 6925, 65535, 65535, 6930, 6929,
+    65535, 65535, 65535, 65535, 6980, 39725, 6942, 39705, 65535, 6939, 65535, 39709, 65535, 65535, 39718, 6947,
+    39714, 65535, 65535, 39717, 65535, 65535, 6954, 39721, 65535, 65535, 39724, 65535, 65535, 39741, 6966, 6963,
+    39730, 65535, 65535, 39733, 65535, 65535, 39738, 6969, 65535, 65535, 6972, 65535, 65535, 39747, 39746, 6977,
+    65535, 65535, 65535, 65535, 39780, 6997, 39758, 6987, 39754, 65535, 65535, 39757, 65535, 65535, 6994, 39761,
+    65535, 65535, 6996, 65535, 65535, 7005, 39770, 7001, 65535, 65535, 7004, 65535, 65535, 39777, 7008, 65535,
+    65535, 7011, 65535, 65535, 7028, 39789, 39786, 39785, 65535, 65535, 7020, 65535, 65535, 39793, 39792, 65535,
+    65535, 39795, 65535, 65535, 7036, 39801, 7032, 65535, 65535, 7035, 65535, 65535, 7040, 39807, 65535, 65535,
+    39810, 65535, 65535, 7161, 7106, 7077, 7062, 39823, 7052, 7051, 65535, 65535, 7054, 65535, 65535, 7059,
+    39826, 65535, 65535, 39829, 65535, 65535, 39838, 7067, 39834, 65535, 65535, 39837, 65535, 65535, 7074, 39841,
+    65535, 65535, 7076, 65535, 65535, 39861, 7086, 39851, 39850, 65535, 65535, 39853, 65535, 65535, 39858, 39857,
+    65535, 65535, 7092, 65535, 65535, 7099, 39866, 7097, 65535, 65535, 65535, 39871, 39870, 65535, 65535, 39873,
+    65535, 65535, 39904, 39891, 7116, 39881, 39880, 65535, 65535, 39883, 65535, 65535, 7120, 39887, 65535, 65535,
+    39890, 65535, 65535, 7131, 39896, 39895, 65535, 65535, 39898, 65535, 65535, 7135, 39902, 65535, 65535, 65535,
+    7146, 7139, 65535, 39911, 7142, 65535, 65535, 7145, 65535, 65535, 39922, 7151, 39918, 65535, 65535, 7153,
+    65535, 65535, 7158, 7157, 65535, 65535, 39928, 65535, 65535, 39987, 7190, 39945, 7170, 39937, 39936, 65535,
+    65535, 65535, 39942, 39941, 65535, 65535, 39944, 65535, 65535, 7185, 39950, 7181, 65535, 65535, 39952, 65535,
+    65535, 39957, 39956, 65535, 65535, 65535, 39974, 7199, 39964, 39963, 65535, 65535, 7198, 65535, 65535, 39971,
+    39970, 65535, 65535, 7205, 65535, 65535, 7214, 39979, 39978, 65535, 65535, 39981, 65535, 65535, 39986, 7217,
+    65535, 65535, 65535, 40003, 7228, 39993, 39992, 65535, 65535, 39995, 65535, 65535, 40002, 7233, 40000, 65535,
+    65535, 65535, 65535, 65535, 7320, 40057, 7266, 40021, 7248, 40013, 7244, 65535, 65535, 7247, 65535, 65535,
+    40018, 65535, 40020, 65535, 65535, 40029, 7258, 40025, 65535, 65535, 40028, 65535, 65535, 40033, 7264, 65535,
+    65535, 65535, 40042, 40037, 65535, 7271, 65535, 40041, 65535, 65535, 7282, 40047, 7278, 65535, 65535, 7281,
+    65535, 65535, 40054, 40053, 65535, 65535, 40056, 65535, 65535, 7315, 40072, 7297, 40064, 7295, 65535, 65535,
+    65535, 40069, 7300, 65535, 65535, 7303, 65535, 65535, 40080, 7309, 7308, 65535, 65535, 7311, 65535, 65535,
+    7314, 65535, 65535, 7319, 40086, 65535, 65535, 65535, 7368, 40113, 7330, 40093, 65535, 7327, 65535, 40097,
+    65535, 65535, 40106, 40103, 7334, 65535, 65535, 40105, 65535, 65535, 40110, 40109, 65535, 65535, 7344, 65535,
+    65535, 40129, 7354, 7351, 40118, 65535, 65535, 40121, 65535, 65535, 40126, 40125, 65535, 65535, 7360, 65535,
+    65535, 40135, 40134, 7365, 65535, 65535, 65535, 65535, 40168, 7385, 40146, 7375, 40142, 65535, 65535, 40145,
+    65535, 65535, 7382, 40149, 65535, 65535, 7384, 65535, 65535, 7393, 40158, 7389, 65535, 65535, 7392, 65535,
+    65535, 40165, 7396, 65535, 65535, 7399, 65535, 65535, 7416, 40177, 40174, 40173, 65535, 65535, 7408, 65535,
+    65535, 40181, 40180, 65535, 65535, 40183, 65535, 65535, 7424, 40189, 40188, 65535, 65535, 7423, 65535, 65535,
+    40196, 7427, 65535, 65535, 40198, 65535, 65535, 7537, 7494, 40231, 7450, 7443, 7440, 40207, 65535, 65535,
+    40210, 65535, 65535, 7447, 40214, 65535, 65535, 40217, 65535, 65535, 7456, 40221, 65535, 40223, 65535, 65535,
+    40228, 40227, 65535, 65535, 7462, 65535, 65535, 7479, 40240, 7469, 7468, 65535, 65535, 7471, 65535, 65535,
+    7476, 40243, 65535, 65535, 7478, 65535, 65535, 40255, 7484, 7483, 65535, 65535, 7486, 65535, 65535, 40259,
+    40258, 65535, 65535, 40261, 65535, 65535, 40292, 7509, 40272, 40269, 40268, 65535, 65535, 7503, 65535, 65535,
+    40276, 7507, 65535, 65535, 65535, 40285, 7514, 40281, 65535, 65535, 40284, 65535, 65535, 40289, 40288, 65535,
+    65535, 7523, 65535, 65535, 7534, 40301, 7530, 40297, 65535, 65535, 40300, 65535, 65535, 65535, 40304, 65535,
+    65535, 7585, 40334, 7553, 40314, 40313, 40312, 65535, 65535, 65535, 40318, 7549, 65535, 65535, 40320, 65535,
+    65535, 40329, 40326, 7557, 65535, 65535, 7560, 65535, 65535, 40331, 65535, 7565, 65535, 65535, 40348, 7573,
+    40340, 7571, 65535, 65535, 65535, 40345, 7576, 65535, 65535, 7579, 65535, 65535, 40352, 7583, 65535, 65535,
+    65535, 40379, 7598, 40361, 40358, 65535, 7592, 65535, 65535, 40365, 40364, 65535, 65535, 65535, 40372, 40371,
+    40370, 65535, 65535, 65535, 7608, 40375, 65535, 65535, 40378, 65535, 65535, 7627, 40388, 40385, 40384, 65535,
+    65535, 7619, 65535, 65535, 40392, 7623, 65535, 65535, 7626, 65535, 65535, 40403, 7632, 40399, 65535, 65535,
+    40402, 65535, 65535, 7639, 7638, 65535, 65535, 40409, 65535, 65535, 40502, 7685, 7672, 7659, 7652, 40419,
+    7650, 65535, 65535, 65535, 7656, 7655, 65535, 65535, 40426, 65535, 65535, 40435, 40432, 7663, 65535, 65535,
+    7666, 65535, 65535, 7671, 7670, 65535, 65535, 65535, 7678, 40443, 65535, 7677, 65535, 65535, 40452, 40451,
+    40450, 65535, 65535, 65535, 65535, 7707, 7700, 40463, 7692, 40459, 65535, 65535, 40462, 65535, 65535, 40465,
+    65535, 40467, 65535, 65535, 40474, 40473, 40472, 65535, 65535, 65535, 65535, 7721, 40484, 40481, 40480, 65535,
+    65535, 40483, 65535, 65535, 7720, 7719, 65535, 65535, 65535, 7727, 40494, 40493, 65535, 65535, 65535, 40499,
+    40498, 65535, 65535, 7733, 65535, 65535, 7752, 40519, 40518, 40513, 40510, 40509, 65535, 65535, 7744, 65535,
+    65535, 40515, 65535, 7749, 65535, 65535, 65535, 65535, 7760, 40527, 40524, 65535, 40526, 65535, 65535, 65535,
+    7768, 40535, 40532, 65535, 40534, 65535, 65535, 65535, 7776, 40541, 40540, 65535, 65535, 40543, 65535, 65535,
+    7780, 40547, 65535, 65535, 7782, 65535, 65535, 7827, 40576, 7799, 40564, 7793, 40560, 7791, 65535, 65535,
+    65535, 40563, 65535, 65535, 40566, 65535, 65535, 40569, 65535, 7805, 40572, 65535, 65535, 40575, 65535, 65535,
+    7818, 7811, 65535, 40583, 40582, 65535, 65535, 40585, 65535, 65535, 40588, 65535, 40594, 40593, 40592, 65535,
+    65535, 65535, 65535, 7887, 40626, 7845, 40606, 7835, 7834, 65535, 65535, 40605, 65535, 65535, 7842, 40609,
+    65535, 65535, 40612, 65535, 65535, 40621, 40618, 7849, 65535, 65535, 7852, 65535, 65535, 7857, 40624, 65535,
+    65535, 65535, 40642, 7867, 40632, 7863, 65535, 65535, 40634, 65535, 65535, 7871, 40638, 65535, 65535, 40641,
+    65535, 65535, 40648, 7879, 7878, 65535, 65535, 65535, 40652, 7883, 65535, 65535, 7886, 65535, 65535, 7917,
+    7902, 40665, 7894, 40661, 65535, 65535, 40664, 65535, 65535, 40669, 40668, 65535, 65535, 65535, 40678, 7907,
+    40674, 65535, 65535, 40677, 65535, 65535, 40682, 7913, 65535, 65535, 7916, 65535, 65535, 7933, 40694, 7923,
+    40690, 65535, 65535, 40693, 65535, 65535, 40698, 7929, 65535, 65535, 7932, 65535, 65535, 40709, 7938, 40705,
+    65535, 65535, 7940, 65535, 65535, 7945, 40712, 65535, 65535, 7947, 65535, 65535, 7952, 40719, 65535, 65535,
+    7956, 40723, 65535, 65535, 40742, 7959, 65535, 7967, 40732, 7963, 65535, 65535, 7966, 65535, 65535, 7971,
+    7970, 65535, 65535, 7973, 65535, 65535, 7982, 7979, 40746, 65535, 65535, 40749, 65535, 65535, 40758, 7987,
+    40754, 65535, 65535, 7989, 65535, 65535, 7994, 40761, 65535, 65535, 7996, 65535, 65535, 40881, 40828, 8031,
+    8016, 8009, 8006, 8005, 65535, 65535, 8008, 65535, 65535, 40781, 8012, 65535, 65535, 8015, 65535, 65535,
+    40792, 8021, 40788, 65535, 65535, 40791, 65535, 65535, 8028, 40795, 65535, 65535, 40798, 65535, 65535, 40813,
+    8038, 40805, 40804, 65535, 65535, 65535, 8042, 40809, 65535, 65535, 40812, 65535, 65535, 8053, 40818, 8049,
+    65535, 65535, 40820, 65535, 65535, 8057, 40824, 65535, 65535, 40827, 65535, 65535, 8086, 8075, 8070, 40835,
+    8066, 65535, 65535, 8069, 65535, 65535, 40842, 40841, 65535, 65535, 65535, 40847, 8078, 65535, 65535, 8083,
+    40850, 65535, 65535, 40853, 65535, 65535, 8100, 40863, 8092, 40859, 65535, 65535, 40862, 65535, 65535, 40867,
+    40866, 65535, 65535, 65535, 8108, 8105, 40872, 65535, 65535, 40875, 65535, 65535, 8112, 40879, 65535, 65535,
+    65535, 8169, 40906, 8127, 8122, 8121, 8120, 65535, 65535, 65535, 8124, 65535, 40894, 65535, 65535, 8133,
+    40898, 65535, 8132, 65535, 65535, 40903, 65535, 8137, 65535, 65535, 8154, 40915, 8144, 8143, 65535, 65535,
+    40914, 65535, 65535, 8151, 40918, 65535, 65535, 8153, 65535, 65535, 40930, 40927, 40926, 65535, 65535, 40929,
+    65535, 65535, 40934, 8165, 65535, 65535, 40936, 65535, 65535, 8195, 40954, 40947, 8176, 40943, 65535, 65535,
+    8178, 65535, 65535, 8183, 8182, 65535, 65535, 40953, 65535, 65535, 40962, 40959, 8190, 65535, 65535, 40961,
+    65535, 65535, 65535, 40977, 8204, 40969, 40968, 65535, 65535, 8203, 65535, 65535, 8208, 40975, 65535, 65535,
+    65535, 8217, 40982, 40981, 65535, 65535, 40984, 65535, 65535, 40989, 8220, 65535, 65535, 65535, 8344, 8285,
+    8256, 8241, 41002, 8231, 8230, 65535, 65535, 8233, 65535, 65535, 8238, 41005, 65535, 65535, 41008, 65535,
+    65535, 41017, 8246, 41013, 65535, 65535, 41016, 65535, 65535, 8253, 8252, 65535, 65535, 41023, 65535, 65535,
+    41040, 8265, 41030, 8261, 65535, 65535, 8264, 65535, 65535, 41037, 8268, 65535, 65535, 8271, 65535, 65535,
+    8278, 41045, 8276, 65535, 65535, 65535, 41050, 41049, 65535, 65535, 8284, 65535, 65535, 41085, 8302, 41063,
+    8292, 8291, 65535, 65535, 41062, 65535, 65535, 41067, 41066, 65535, 65535, 8301, 65535, 65535, 41078, 8307,
+    41074, 65535, 65535, 41077, 65535, 65535, 8314, 41081, 65535, 65535, 41084, 65535, 65535, 8329, 8322, 8321,
+    65535, 65535, 41094, 41093, 65535, 65535, 41096, 65535, 65535, 8337, 41102, 8333, 65535, 65535, 8336, 65535,
+    65535, 8341, 41108, 65535, 65535, 41111, 65535, 65535, 41146, 41121, 8350, 8349, 65535, 65535, 41120, 65535,
+    65535, 8369, 41130, 8359, 41126, 65535, 65535, 41129, 65535, 65535, 8366, 41133, 65535, 65535, 41136, 65535,
+    65535, 41145, 41142, 41141, 65535, 65535, 41144, 65535, 65535, 65535, 41158, 8385, 41152, 41151, 65535, 65535,
+    65535, 41157, 8388, 65535, 65535, 65535, 65535, 8395, 41162, 65535, 65535, 8401, 41168, 41167, 65535, 65535,
+    65535, 41187, 8404, 65535, 8412, 41177, 8408, 65535, 65535, 8411, 65535, 65535, 8416, 8415, 65535, 65535,
+    8418, 65535, 65535, 8429, 8424, 41191, 65535, 65535, 41196, 41195, 65535, 65535, 65535, 41205, 8434, 8433,
+    65535, 65535, 41204, 65535, 65535, 8441, 41208, 65535, 65535, 8443, 65535, 65535, 41336, 8507, 8478, 8463,
+    8456, 8453, 41220, 65535, 65535, 41223, 65535, 65535, 41228, 41227, 65535, 65535, 41230, 65535, 65535, 41239,
+    41236, 41235, 65535, 65535, 41238, 65535, 65535, 41243, 41242, 65535, 65535, 41245, 65535, 65535, 41260, 8485,
+    8482, 65535, 41252, 65535, 65535, 41257, 41256, 65535, 65535, 41259, 65535, 65535, 8500, 41265, 41264, 65535,
+    65535, 41267, 65535, 65535, 41272, 8503, 65535, 65535, 8506, 65535, 65535, 8539, 41292, 8517, 41282, 8513,
+    65535, 65535, 8516, 65535, 65535, 41289, 8520, 65535, 65535, 41291, 65535, 65535, 41300, 41297, 8528, 65535,
+    65535, 8531, 65535, 65535, 8536, 41303, 65535, 65535, 41306, 65535, 65535, 8553, 41316, 8545, 41312, 65535,
+    65535, 41315, 65535, 65535, 41320, 8551, 65535, 65535, 65535, 41329, 8558, 8557, 65535, 65535, 8560, 65535,
+    65535, 8565, 41332, 65535, 65535, 41335, 65535, 65535, 8570, 65535, 8574, 41341, 65535, 65535, 8588, 8581,
+    8580, 41347, 65535, 65535, 65535, 8585, 41352, 65535, 65535, 8587, 65535, 65535, 65535, 41459, 8640, 8621,
+    41374, 8601, 8598, 41365, 65535, 65535, 41368, 65535, 65535, 41371, 65535, 8605, 65535, 65535, 8614, 8611,
+    41378, 65535, 65535, 41381, 65535, 65535, 41386, 8617, 65535, 65535, 41388, 65535, 65535, 41395, 8626, 41393,
+    65535, 65535, 65535, 8633, 41398, 65535, 41400, 65535, 65535, 41405, 41404, 65535, 65535, 41407, 65535, 65535,
+    8660, 41415, 41412, 65535, 8646, 65535, 65535, 8653, 8650, 65535, 41420, 65535, 65535, 41425, 8656, 65535,
+    65535, 8659, 65535, 65535, 41444, 8669, 41434, 8665, 65535, 65535, 8668, 65535, 65535, 41441, 8672, 65535,
+    65535, 41443, 65535, 65535, 8684, 8681, 8680, 65535, 65535, 41451, 65535, 65535, 41456, 41455, 65535, 65535,
+    41458, 65535, 65535, 8745, 41492, 8709, 8702, 8699, 8698, 65535, 65535, 41469, 65535, 65535, 41474, 8705,
+    65535, 65535, 8708, 65535, 65535, 8717, 41482, 41481, 65535, 65535, 41484, 65535, 65535, 41489, 41488, 65535,
+    65535, 41491, 65535, 65535, 41498, 8727, 65535, 8729, 65535, 65535, 8738, 41503, 8734, 65535, 65535, 8737,
+    65535, 65535, 8742, 8741, 65535, 65535, 41512, 65535, 65535, 8775, 41528, 8753, 41520, 41519, 65535, 65535,
+    65535, 8757, 41524, 65535, 65535, 8759, 65535, 65535, 8768, 41533, 41532, 65535, 65535, 41535, 65535, 65535,
+    8772, 41539, 65535, 65535, 41542, 65535, 65535, 41551, 41550, 41549, 41548, 65535, 65535, 65535, 65535, 41553,
+    65535, 65535, 41636, 41601, 41586, 8805, 8798, 8795, 8794, 65535, 65535, 41565, 65535, 65535, 8802, 41569,
+    65535, 65535, 41572, 65535, 65535, 41581, 8810, 41577, 65535, 65535, 8812, 65535, 65535, 8815, 65535, 8817,
+    65535, 65535, 8826, 8825, 8824, 8823, 65535, 65535, 65535, 65535, 8828, 65535, 8830, 65535, 8832, 65535,
+    65535, 41619, 8844, 8843, 8840, 8839, 65535, 65535, 8842, 65535, 65535, 65535, 8846, 65535, 8848, 65535,
+    8850, 65535, 65535, 8853, 65535, 8861, 8858, 41625, 65535, 65535, 8860, 65535, 65535, 8865, 8864, 65535,
+    65535, 8867, 65535, 65535, 8870, 65535, 41666, 8885, 8880, 8877, 8876, 65535, 65535, 41647, 65535, 65535,
+    41650, 65535, 41652, 65535, 65535, 8891, 41656, 65535, 8890, 65535, 65535, 8895, 8894, 65535, 65535, 41665,
+    65535, 65535, 41678, 8905, 8904, 8903, 65535, 65535, 65535, 8907, 65535, 8909, 65535, 65535, 8916, 41683,
+    41682, 65535, 65535, 65535, 41688, 8919, 65535, 65535, 8922, 65535, 65535, 9033, 8980, 8953, 8942, 8935,
+    41700, 8931, 65535, 65535, 41702, 65535, 65535, 41707, 41706, 65535, 65535, 41709, 65535, 65535, 41716, 41715,
+    41714, 65535, 65535, 65535, 41718, 65535, 41720, 65535, 65535, 41735, 8962, 41727, 41726, 65535, 65535, 41729,
+    65535, 65535, 41732, 65535, 41734, 65535, 65535, 41741, 41740, 8971, 65535, 65535, 65535, 41745, 8976, 65535,
+    65535, 41747, 65535, 65535, 41770, 8989, 41752, 65535, 8986, 65535, 41756, 65535, 65535, 41763, 41760, 65535,
+    8994, 65535, 65535, 8999, 41766, 65535, 65535, 41769, 65535, 65535, 9018, 41779, 41776, 9007, 65535, 65535,
+    9010, 65535, 65535, 41783, 9014, 65535, 65535, 41785, 65535, 65535, 41794, 9023, 41790, 65535, 65535, 41793,
+    65535, 65535, 41798, 9029, 65535, 65535, 41800, 65535, 65535, 41855, 9056, 41811, 9038, 65535, 41808, 65535,
+    9042, 65535, 65535, 9051, 9048, 41815, 65535, 65535, 41818, 65535, 65535, 9055, 41822, 65535, 65535, 65535,
+    9072, 9065, 41830, 41829, 65535, 65535, 41832, 65535, 65535, 9069, 41836, 65535, 65535, 41839, 65535, 65535,
+    41848, 9077, 9076, 65535, 65535, 41847, 65535, 65535, 9084, 41851, 65535, 65535, 41854, 65535, 65535, 9119,
+    9104, 41865, 9094, 41861, 65535, 65535, 41864, 65535, 65535, 41869, 41868, 65535, 65535, 41871, 65535, 65535,
+    41880, 9109, 41876, 65535, 65535, 9111, 65535, 65535, 41884, 41883, 65535, 65535, 41886, 65535, 65535, 9133,
+    41896, 9125, 9124, 65535, 65535, 41895, 65535, 65535, 9130, 65535, 41900, 65535, 65535, 41909, 9138, 41905,
+    65535, 65535, 41908, 65535, 65535, 9145, 41912, 65535, 65535, 41915, 65535, 65535, 42036, 9209, 9182, 9167,
+    9160, 9157, 9156, 65535, 65535, 41927, 65535, 65535, 41932, 41931, 65535, 65535, 41934, 65535, 65535, 41943,
+    41940, 41939, 65535, 65535, 9174, 65535, 65535, 9179, 41946, 65535, 65535, 41949, 65535, 65535, 41962, 9189,
+    41954, 65535, 9188, 65535, 65535, 41959, 65535, 41961, 65535, 65535, 41970, 9199, 41966, 65535, 65535, 41969,
+    65535, 65535, 9206, 41973, 65535, 65535, 41976, 65535, 65535, 42005, 9222, 41985, 41982, 65535, 9216, 65535,
+    65535, 9219, 65535, 41989, 65535, 65535, 41998, 9227, 41994, 65535, 65535, 9229, 65535, 65535, 42002, 42001,
+    65535, 65535, 9236, 65535, 65535, 42021, 9246, 42011, 9242, 65535, 65535, 9245, 65535, 65535, 42018, 42017,
+    65535, 65535, 9252, 65535, 65535, 42029, 9258, 42025, 65535, 65535, 42028, 65535, 65535, 9265, 42032, 65535,
+    65535, 9267, 65535, 65535, 9324, 9297, 42052, 9277, 9274, 65535, 9276, 65535, 65535, 9281, 9280, 65535,
+    65535, 42051, 65535, 65535, 42058, 9289, 9288, 65535, 65535, 65535, 42062, 42061, 65535, 65535, 42064, 65535,
+    65535, 42079, 9304, 42071, 42070, 65535, 65535, 65535, 42076, 9307, 65535, 65535, 9310, 65535, 65535, 9319,
+    9316, 42083, 65535, 65535, 9318, 65535, 65535, 42091, 9322, 65535, 65535, 65535, 9348, 42107, 9334, 42099,
+    42098, 65535, 65535, 9333, 65535, 65535, 42106, 9337, 65535, 65535, 65535, 42113, 42110, 65535, 42112, 65535,
+    65535, 42115, 65535, 65535, 42124, 42123, 42122, 42121, 65535, 65535, 65535, 65535, 42126, 65535, 65535, 42213,
+    9416, 9393, 9378, 9371, 42136, 9367, 65535, 65535, 9370, 65535, 65535, 42143, 42142, 65535, 65535, 9377,
+    65535, 65535, 42154, 42151, 9382, 65535, 65535, 9385, 65535, 65535, 9390, 42157, 65535, 65535, 9392, 65535,
+    65535, 9401, 9396, 65535, 42166, 65535, 42168, 65535, 65535, 42177, 42174, 42173, 65535, 65535, 9408, 65535,
+    65535, 9413, 9412, 65535, 65535, 9415, 65535, 65535, 42208, 9429, 9426, 42191, 42190, 65535, 65535, 42193,
+    65535, 65535, 42196, 65535, 65535, 42203, 42202, 42201, 65535, 65535, 65535, 9439, 42206, 65535, 65535, 65535,
+    9442, 65535, 9444, 65535, 65535, 42241, 9466, 9459, 9454, 9453, 9452, 65535, 65535, 65535, 9456, 65535,
+    9458, 65535, 65535, 9461, 65535, 9463, 65535, 9465, 65535, 65535, 9468, 65535, 9472, 9471, 65535, 65535,
+    65535, 9497, 42254, 9479, 9478, 65535, 65535, 9483, 9482, 65535, 65535, 9485, 65535, 65535, 42262, 9491,
+    9490, 65535, 65535, 9493, 65535, 65535, 9496, 65535, 65535, 42277, 9504, 9503, 9502, 65535, 65535, 65535,
+    9506, 65535, 9508, 65535, 65535, 9517, 42282, 42281, 65535, 65535, 42284, 65535, 65535, 9521, 42288, 65535,
+    65535, 9523, 65535, 65535, 42402, 9585, 9558, 9543, 42304, 9533, 42300, 65535, 65535, 42303, 65535, 65535,
+    42308, 42307, 65535, 65535, 9542, 65535, 65535, 42319, 9548, 42315, 65535, 65535, 42318, 65535, 65535, 9555,
+    42322, 65535, 65535, 9557, 65535, 65535, 42338, 42333, 42332, 9563, 65535, 65535, 65535, 42335, 65535, 42337,
+    65535, 65535, 9578, 42343, 9574, 65535, 65535, 9577, 65535, 65535, 42350, 9581, 65535, 65535, 42352, 65535,
+    65535, 9603, 42358, 42357, 65535, 65535, 42364, 42361, 65535, 9595, 65535, 65535, 42368, 42367, 65535, 65535,
+    42370, 65535, 65535, 42387, 9612, 42377, 42376, 65535, 65535, 9611, 65535, 65535, 9616, 42383, 65535, 65535,
+    42386, 65535, 65535, 9627, 9624, 42391, 65535, 65535, 9626, 65535, 65535, 9631, 42398, 65535, 65535, 42401,
+    65535, 65535, 9694, 42433, 9652, 9645, 42410, 9641, 65535, 65535, 42412, 65535, 65535, 42417, 9648, 65535,
+    65535, 42419, 65535, 65535, 9658, 9655, 65535, 42425, 65535, 65535, 9662, 9661, 65535, 65535, 42432, 65535,
+    65535, 9681, 42442, 9671, 9670, 65535, 65535, 9673, 65535, 65535, 42446, 9677, 65535, 65535, 9680, 65535,
+    65535, 42455, 9684, 65535, 9686, 65535, 65535, 42459, 9690, 65535, 65535, 42461, 65535, 65535, 42488, 42475,
+    9702, 9701, 9700, 65535, 65535, 65535, 9704, 65535, 9706, 65535, 65535, 42483, 42480, 9711, 65535, 65535,
+    9714, 65535, 65535, 9719, 9718, 65535, 65535, 65535, 65535, 9845, 9784, 9755, 9740, 42501, 9730, 9729,
+    65535, 65535, 9732, 65535, 65535, 9737, 42504, 65535, 65535, 42507, 65535, 65535, 42516, 42513, 42512, 65535,
+    65535, 9747, 65535, 65535, 9752, 42519, 65535, 65535, 42522, 65535, 65535, 42539, 9764, 42529, 9760, 65535,
+    65535, 9763, 65535, 65535, 9768, 42535, 65535, 65535, 9770, 65535, 65535, 9777, 42544, 9775, 65535, 65535,
+    65535, 42549, 9780, 65535, 65535, 9783, 65535, 65535, 42584, 9801, 42562, 9791, 9790, 65535, 65535, 42561,
+    65535, 65535, 42566, 9797, 65535, 65535, 42568, 65535, 65535, 42577, 9806, 9805, 65535, 65535, 42576, 65535,
+    65535, 9813, 42580, 65535, 65535, 42583, 65535, 65535, 9830, 9823, 42588, 65535, 42590, 65535, 65535, 42595,
+    42594, 65535, 65535, 42597, 65535, 65535, 9838, 42603, 9834, 65535, 65535, 42605, 65535, 65535, 9842, 42609,
+    65535, 65535, 42612, 65535, 65535, 42645, 9866, 42619, 9850, 65535, 65535, 42627, 9856, 42623, 65535, 65535,
+    42626, 65535, 65535, 42631, 9862, 65535, 65535, 42633, 65535, 65535, 42644, 42637, 65535, 42641, 42640, 65535,
+    65535, 42643, 65535, 65535, 65535, 42657, 9884, 42651, 42650, 65535, 65535, 65535, 42656, 9887, 65535, 65535,
+    65535, 65535, 9894, 42661, 65535, 65535, 9900, 42667, 42666, 65535, 65535, 65535, 42688, 9905, 42672, 65535,
+    65535, 9913, 9910, 9909, 65535, 65535, 9912, 65535, 65535, 9917, 42684, 65535, 65535, 9919, 65535, 65535,
+    9932, 9927, 42694, 42693, 65535, 65535, 65535, 42699, 42698, 65535, 65535, 65535, 42708, 9937, 9936, 65535,
+    65535, 9939, 65535, 65535, 42712, 9943, 65535, 65535, 42714, 65535, 65535, 42819, 10012, 9981, 9966, 9959,
+    9956, 9955, 65535, 65535, 42726, 65535, 65535, 42731, 42730, 65535, 65535, 9965, 65535, 65535, 42742, 9971,
+    42738, 65535, 65535, 9973, 65535, 65535, 9978, 42745, 65535, 65535, 42748, 65535, 65535, 42765, 9990, 42755,
+    9986, 65535, 65535, 9989, 65535, 65535, 42762, 42761, 65535, 65535, 9996, 65535, 65535, 10005, 10002, 10001,
+    65535, 65535, 42772, 65535, 65535, 10009, 42776, 65535, 65535, 10011, 65535, 65535, 42810, 42795, 10020, 42787,
+    42786, 65535, 65535, 65535, 10024, 42791, 65535, 65535, 42794, 65535, 65535, 10035, 42800, 10031, 65535, 65535,
+    42802, 65535, 65535, 42807, 10038, 65535, 65535, 42809, 65535, 65535, 10048, 42813, 65535, 42815, 65535, 65535,
+    42818, 65535, 65535, 10057, 10054, 65535, 42824, 65535, 65535, 10087, 10072, 10065, 42830, 65535, 10064, 65535,
+    65535, 10069, 10068, 65535, 65535, 42839, 65535, 65535, 42848, 10077, 10076, 65535, 65535, 10079, 65535, 65535,
+    10084, 42851, 65535, 65535, 10086, 65535, 65535, 10091, 42858, 65535, 65535, 65535, 42978, 10153, 10126, 10111,
+    10104, 10101, 10100, 65535, 65535, 42871, 65535, 65535, 42876, 42875, 65535, 65535, 42878, 65535, 65535, 42887,
+    42884, 42883, 65535, 65535, 10118, 65535, 65535, 10123, 42890, 65535, 65535, 42893, 65535, 65535, 42906, 42901,
+    10130, 65535, 42900, 65535, 65535, 10135, 65535, 42905, 65535, 65535, 10146, 42911, 10142, 65535, 65535, 42913,
+    65535, 65535, 42918, 42917, 65535, 65535, 42920, 65535, 65535, 42949, 10168, 42929, 42926, 65535, 10160, 65535,
+    65535, 10165, 42932, 65535, 65535, 42935, 65535, 65535, 42944, 10173, 42940, 65535, 65535, 10175, 65535, 65535,
+    10180, 10179, 65535, 65535, 65535, 10197, 42958, 10187, 42954, 65535, 65535, 42957, 65535, 65535, 42962, 10193,
+    65535, 65535, 10196, 65535, 65535, 42971, 10200, 65535, 10202, 65535, 65535, 10207, 42974, 65535, 65535, 42977,
+    65535, 65535, 10270, 10241, 42994, 10219, 10216, 65535, 10218, 65535, 65535, 10223, 10222, 65535, 65535, 42993,
+    65535, 65535, 43002, 10231, 42998, 65535, 65535, 43001, 65535, 65535, 43006, 10237, 65535, 65535, 43008, 65535,
+    65535, 43025, 10250, 43015, 43014, 65535, 65535, 43017, 65535, 65535, 10254, 43021, 65535, 65535, 10256, 65535,
+    65535, 10265, 43030, 10261, 65535, 65535, 10264, 65535, 65535, 10267, 65535, 43037, 65535, 65535, 43056, 10283,
+    43046, 10277, 10276, 65535, 65535, 65535, 10282, 43049, 65535, 65535, 65535, 10285, 65535, 43055, 65535, 65535,
+    43066, 43061, 10292, 65535, 65535, 10295, 65535, 43065, 65535, 65535, 43074, 10303, 43070, 65535, 65535, 43073,
+    65535, 65535, 43076, 65535, 65535, 43195, 43136, 43111, 10328, 10321, 43086, 10317, 65535, 65535, 43088, 65535,
+    65535, 43093, 43092, 65535, 65535, 43095, 65535, 65535, 10336, 43101, 43100, 65535, 65535, 10335, 65535, 65535,
+    43108, 10339, 65535, 65535, 43110, 65535, 65535, 10355, 10352, 10349, 10348, 65535, 65535, 43119, 65535, 65535,
+    43122, 65535, 65535, 43131, 10360, 10359, 65535, 65535, 43130, 65535, 65535, 10365, 65535, 10367, 65535, 65535,
+    10396, 10383, 10376, 10373, 65535, 43143, 65535, 65535, 10380, 10379, 65535, 65535, 43150, 65535, 65535, 43159,
+    43156, 10387, 65535, 65535, 10390, 65535, 65535, 10393, 65535, 10395, 65535, 65535, 43180, 10405, 10402, 10401,
+    65535, 65535, 43172, 65535, 65535, 10409, 43176, 65535, 65535, 10411, 65535, 65535, 10420, 10417, 10416, 65535,
+    65535, 10419, 65535, 65535, 43192, 43191, 65535, 65535, 10426, 65535, 65535, 10491, 43228, 10445, 43206, 10435,
+    43202, 65535, 65535, 10437, 65535, 65535, 10442, 10441, 65535, 65535, 10444, 65535, 65535, 43221, 43218, 10449,
+    65535, 65535, 10452, 65535, 65535, 10457, 10456, 65535, 65535, 10459, 65535, 65535, 43244, 10469, 43234, 10465,
+    65535, 65535, 43236, 65535, 65535, 10473, 43240, 65535, 65535, 10475, 65535, 65535, 10484, 43249, 10480, 65535,
+    65535, 10483, 65535, 65535, 10488, 43255, 65535, 65535, 10490, 65535, 65535, 10521, 43274, 43269, 10498, 10497,
+    65535, 65535, 10500, 65535, 65535, 10505, 10504, 65535, 65535, 65535, 43282, 10511, 43278, 65535, 65535, 43281,
+    65535, 65535, 10518, 43285, 65535, 65535, 10520, 65535, 65535, 43295, 43294, 43293, 65535, 65535, 65535, 43303,
+    43300, 43299, 65535, 65535, 43302, 65535, 65535, 43305, 65535, 43307, 65535, 65535, 10544, 43311, 65535, 65535,
+    10560, 43327, 43326, 10553, 43320, 43319, 65535, 65535, 65535, 43323, 65535, 43325, 65535, 65535, 65535, 65535,
+    10582, 43341, 43334, 10565, 65535, 65535, 43338, 10569, 65535, 65535, 43340, 65535, 65535, 10575, 65535, 43347,
+    10578, 65535, 65535, 10581, 65535, 65535, 10598, 43359, 10588, 43355, 65535, 65535, 43358, 65535, 65535, 43363,
+    43362, 65535, 65535, 43365, 65535, 65535, 43374, 10603, 43370, 65535, 65535, 10605, 65535, 65535, 10610, 43377,
+    65535, 65535, 43380, 65535, 65535, 10725, 10676, 10647, 10632, 43393, 10622, 43389, 65535, 65535, 10624, 65535,
+    65535, 10629, 43396, 65535, 65535, 43399, 65535, 65535, 43408, 10637, 43404, 65535, 65535, 43407, 65535, 65535,
+    43412, 43411, 65535, 65535, 43414, 65535, 65535, 43431, 10656, 43421, 10652, 65535, 65535, 10655, 65535, 65535,
+    10660, 10659, 65535, 65535, 43430, 65535, 65535, 10669, 10666, 65535, 43436, 65535, 65535, 43441, 10672, 65535,
+    65535, 10675, 65535, 65535, 10702, 43461, 43454, 10683, 43450, 65535, 65535, 43453, 65535, 65535, 10690, 43457,
+    65535, 65535, 43460, 65535, 65535, 10699, 43466, 10697, 65535, 65535, 65535, 10701, 65535, 65535, 43484, 43477,
+    10706, 65535, 43476, 65535, 65535, 10713, 43480, 65535, 65535, 43483, 65535, 65535, 43486, 65535, 43490, 10721,
+    65535, 65535, 10724, 65535, 65535, 43527, 10750, 43509, 43504, 43501, 10732, 65535, 65535, 10735, 65535, 65535,
+    10738, 65535, 10740, 65535, 65535, 10743, 65535, 43515, 10746, 65535, 65535, 10749, 65535, 65535, 43526, 43521,
+    65535, 43525, 43524, 65535, 65535, 65535, 65535, 43545, 10772, 43537, 10766, 43533, 65535, 65535, 43536, 65535,
+    65535, 10771, 65535, 65535, 43544, 10775, 65535, 65535, 65535, 43551, 10782, 43549, 65535, 65535, 65535, 65535,
+    43654, 10839, 10808, 43569, 10796, 43561, 10792, 65535, 65535, 10795, 65535, 65535, 43566, 65535, 43568, 65535,
+    65535, 43575, 10804, 65535, 43574, 65535, 65535, 65535, 10824, 10817, 43582, 43581, 65535, 65535, 43584, 65535,
+    65535, 10821, 43588, 65535, 65535, 43591, 65535, 65535, 43600, 43597, 10828, 65535, 65535, 10831, 65535, 65535,
+    10836, 43603, 65535, 65535, 43606, 65535, 65535, 10859, 43618, 43615, 43614, 43613, 65535, 65535, 65535, 10849,
+    65535, 65535, 43626, 10855, 43622, 65535, 65535, 43625, 65535, 65535, 65535, 43643, 10868, 10865, 43632, 65535,
+    65535, 43635, 65535, 65535, 10872, 10871, 65535, 65535, 43642, 65535, 65535, 10879, 43646, 65535, 65535, 10883,
+    10882, 65535, 65535, 10885, 65535, 65535, 10902, 10889, 65535, 43669, 43666, 43663, 43662, 65535, 65535, 10897,
+    65535, 65535, 10900, 65535, 65535, 65535, 10928, 10919, 43680, 10909, 10908, 65535, 65535, 43679, 65535, 65535,
+    10916, 43683, 65535, 65535, 43686, 65535, 65535, 43689, 65535, 43693, 10924, 65535, 65535, 10927, 65535, 65535,
+    10932, 43699, 65535, 65535, 43708, 10937, 10936, 65535, 65535, 43707, 65535, 65535, 43712, 10943, 65535, 65535,
+    43714, 65535, 65535, 11067, 11010, 10981, 10966, 10959, 10956, 43723, 65535, 65535, 43726, 65535, 65535, 43731,
+    43730, 65535, 65535, 43733, 65535, 65535, 43742, 10971, 43738, 65535, 65535, 43741, 65535, 65535, 43746, 43745,
+    65535, 65535, 43748, 65535, 65535, 10995, 43758, 43755, 43754, 65535, 65535, 10989, 65535, 65535, 43762, 10993,
+    65535, 65535, 65535, 43771, 11000, 43767, 65535, 65535, 11002, 65535, 65535, 11007, 43774, 65535, 65535, 43777,
+    65535, 65535, 11036, 43795, 43788, 43785, 43784, 65535, 65535, 11019, 65535, 65535, 11024, 43791, 65535, 65535,
+    43794, 65535, 65535, 11033, 43800, 11031, 65535, 65535, 65535, 11035, 65535, 65535, 43820, 43813, 43810, 43809,
+    65535, 65535, 11044, 65535, 65535, 11049, 43816, 65535, 65535, 43819, 65535, 65535, 43828, 11057, 11056, 65535,
+    65535, 11059, 65535, 65535, 43832, 11063, 65535, 65535, 11066, 65535, 65535, 43881, 11088, 43849, 43844, 43843,
+    43842, 65535, 65535, 65535, 43846, 65535, 43848, 65535, 65535, 43853, 43852, 65535, 65535, 43855, 65535, 65535,
+    43870, 11097, 43862, 43861, 65535, 65535, 11096, 65535, 65535, 43869, 43868, 65535, 65535, 65535, 43878, 11107,
+    43874, 65535, 65535, 43877, 65535, 65535, 11112, 65535, 65535, 11119, 43884, 65535, 43886, 65535, 65535, 43889,
+    65535, 65535, 11244, 11185, 11156, 11141, 11134, 11131, 11130, 65535, 65535, 43901, 65535, 65535, 43906, 43905,
+    65535, 65535, 43908, 65535, 65535, 43917, 11146, 43913, 65535, 65535, 43916, 65535, 65535, 43921, 43920, 65535,
+    65535, 11155, 65535, 65535, 43940, 11165, 43930, 11161, 65535, 65535, 11164, 65535, 65535, 43937, 43936, 65535,
+    65535, 11171, 65535, 65535, 11178, 43945, 11176, 65535, 65535, 65535, 43950, 11181, 65535, 65535, 11184, 65535,
+    65535, 43985, 11202, 11195, 43960, 11191, 65535, 65535, 43962, 65535, 65535, 43967, 43966, 65535, 65535, 43969,
+    65535, 65535, 43978, 43975, 11206, 65535, 65535, 43977, 65535, 65535, 11214, 43981, 65535, 65535, 43984, 65535,
+    65535, 11229, 43992, 11221, 65535, 11223, 65535, 65535, 11226, 65535, 43996, 65535, 65535, 44005, 44002, 44001,
+    65535, 65535, 44004, 65535, 65535, 11241, 44008, 65535, 65535, 44011, 65535, 65535, 44060, 11269, 44024, 44017,
+    65535, 44021, 11252, 65535, 65535, 44023, 65535, 65535, 11264, 44029, 44028, 65535, 65535, 11263, 65535, 65535,
+    44036, 44035, 65535, 65535, 65535, 44051, 11278, 44043, 44042, 65535, 65535, 44045, 65535, 65535, 44050, 44049,
+    65535, 65535, 65535, 11289, 44056, 11287, 65535, 65535, 65535, 44059, 65535, 65535, 11306, 44071, 11300, 44065,
+    65535, 44067, 65535, 65535, 44070, 65535, 65535, 44073, 65535, 65535, 65535, 44173, 11356, 44109, 11326, 44087,
+    11316, 11315, 65535, 65535, 44086, 65535, 65535, 11323, 11322, 65535, 65535, 11325, 65535, 65535, 44102, 11331,
+    44098, 65535, 65535, 44101, 65535, 65535, 44106, 11337, 65535, 65535, 44108, 65535, 65535, 11351, 11346, 11345,
+    65535, 65535, 11350, 11349, 65535, 65535, 65535, 11353, 65535, 11355, 65535, 65535, 44146, 11365, 44132, 44131,
+    44130, 65535, 65535, 65535, 65535, 44139, 11370, 44137, 65535, 65535, 65535, 11375, 11374, 65535, 65535, 44145,
+    65535, 65535, 44160, 11387, 44152, 11383, 65535, 65535, 44154, 65535, 65535, 11391, 11390, 65535, 65535, 65535,
+    11398, 44165, 44164, 65535, 65535, 65535, 11402, 11401, 65535, 65535, 11404, 65535, 65535, 44223, 11430, 11419,
+    11414, 44179, 65535, 11413, 65535, 65535, 11418, 44185, 65535, 65535, 65535, 44195, 11424, 11423, 65535, 65535,
+    44194, 65535, 65535, 11429, 65535, 65535, 11440, 44203, 44202, 65535, 65535, 44205, 65535, 11439, 65535, 65535,
+    11448, 11445, 44212, 65535, 65535, 11447, 65535, 65535, 11452, 44219, 65535, 65535, 44222, 65535, 65535, 11473,
+    44232, 44227, 65535, 11463, 44230, 65535, 65535, 65535, 44240, 44237, 44236, 65535, 65535, 44239, 65535, 65535,
+    65535, 11487, 44248, 44245, 65535, 44247, 65535, 65535, 44252, 44251, 65535, 65535, 44254, 65535, 65535, 11495,
+    44260, 11491, 65535, 65535, 44262, 65535, 65535, 11499, 44266, 65535, 65535, 44269, 65535, 65535, 44366, 44329,
+    11534, 11521, 44282, 11511, 11510, 65535, 65535, 44281, 65535, 65535, 44286, 11517, 65535, 65535, 44288, 65535,
+    65535, 44295, 44292, 65535, 44294, 65535, 65535, 44299, 44298, 65535, 65535, 11533, 65535, 65535, 11546, 44311,
+    44308, 44307, 65535, 65535, 11542, 65535, 65535, 11545, 65535, 65535, 11554, 44319, 11550, 65535, 65535, 44321,
+    65535, 65535, 44326, 11557, 65535, 65535, 44328, 65535, 65535, 11581, 11570, 11567, 11566, 65535, 65535, 11569,
+    65535, 65535, 11574, 44341, 65535, 65535, 44346, 11577, 65535, 65535, 11580, 65535, 65535, 11585, 44352, 65535,
+    65535, 11591, 11588, 65535, 11590, 65535, 65535, 44363, 11594, 65535, 65535, 11597, 65535, 65535, 11638, 44375,
+    11606, 11605, 11604, 65535, 65535, 65535, 65535, 11623, 44384, 11613, 11612, 65535, 65535, 11615, 65535, 65535,
+    44388, 11619, 65535, 65535, 44390, 65535, 65535, 44399, 11628, 44395, 65535, 65535, 44398, 65535, 65535, 11635,
+    44402, 65535, 65535, 44405, 65535, 65535, 11664, 11655, 11648, 44413, 11644, 65535, 65535, 44415, 65535, 65535,
+    11652, 44419, 65535, 65535, 11654, 65535, 65535, 44429, 44426, 65535, 44428, 65535, 65535, 44431, 65535, 65535,
+    44434, 65535, 65535, 44551, 11722, 11695, 11686, 11679, 11676, 44443, 65535, 65535, 44446, 65535, 65535, 44451,
+    44450, 65535, 65535, 44453, 65535, 65535, 44462, 44459, 44458, 65535, 65535, 44461, 65535, 65535, 65535, 44477,
+    44470, 44467, 65535, 11701, 65535, 65535, 11706, 44473, 65535, 65535, 44476, 65535, 65535, 11715, 44482, 44481,
+    65535, 65535, 65535, 11719, 44486, 65535, 65535, 44489, 65535, 65535, 44520, 11737, 44498, 44495, 65535, 11729,
+    65535, 65535, 11734, 11733, 65535, 65535, 44504, 65535, 65535, 44513, 11742, 44509, 65535, 65535, 11744, 65535,
+    65535, 44517, 44516, 65535, 65535, 11751, 65535, 65535, 44536, 11761, 44526, 11757, 65535, 65535, 11760, 65535,
+    65535, 44533, 11764, 65535, 65535, 11767, 65535, 65535, 44544, 44541, 44540, 65535, 65535, 44543, 65535, 65535,
+    11780, 44547, 65535, 65535, 11782, 65535, 65535, 11825, 44566, 11791, 11790, 11789, 65535, 65535, 65535, 11793,
+    65535, 11795, 65535, 11797, 65535, 65535, 11812, 44573, 11804, 11803, 65535, 65535, 65535, 44577, 11808, 65535,
+    65535, 44579, 65535, 65535, 44588, 44585, 11816, 65535, 65535, 11819, 65535, 65535, 11824, 44591, 65535, 65535,
+    65535, 44621, 44610, 11835, 11832, 11831, 65535, 65535, 11834, 65535, 65535, 44607, 11838, 65535, 65535, 11841,
+    65535, 65535, 11848, 44615, 11846, 65535, 65535, 65535, 11850, 65535, 44620, 65535, 65535, 44625, 11856, 65535,
+    65535, 11865, 44630, 44629, 65535, 65535, 44632, 65535, 65535, 44635, 65535, 44637, 65535, 65535, 11874, 44641,
+    65535, 65535, 11880, 44647, 44646, 65535, 65535, 65535, 11888, 44651, 65535, 44655, 44654, 65535, 65535, 65535,
+    11894, 44661, 44660, 65535, 65535, 65535, 44670, 11899, 11898, 65535, 65535, 11901, 65535, 65535, 44674, 44673,
+    65535, 65535, 44676, 65535, 65535, 44777, 44736, 44709, 11926, 11919, 44686, 44685, 65535, 65535, 65535, 11923,
+    44690, 65535, 65535, 11925, 65535, 65535, 11934, 44699, 44698, 65535, 65535, 11933, 65535, 65535, 11938, 44705,
+    65535, 65535, 11940, 65535, 65535, 11957, 11950, 11947, 44714, 65535, 65535, 44717, 65535, 65535, 44722, 44721,
+    65535, 65535, 11956, 65535, 65535, 11961, 11960, 65535, 65535, 11965, 11964, 65535, 65535, 44735, 65535, 65535,
+    44754, 11977, 11976, 11975, 11974, 65535, 65535, 65535, 65535, 11979, 65535, 11983, 11982, 65535, 65535, 11985,
+    65535, 65535, 11994, 44761, 44760, 44759, 65535, 65535, 65535, 65535, 44770, 11999, 11998, 65535, 65535, 12001,
+    65535, 65535, 12006, 12005, 65535, 65535, 12008, 65535, 65535, 12015, 12012, 65535, 44782, 65535, 65535, 12021,
+    12020, 44787, 65535, 65535, 65535, 12033, 12026, 44793, 65535, 65535, 12030, 44797, 65535, 65535, 44800, 65535,
+    65535, 44807, 12036, 65535, 12038, 65535, 65535, 12041, 65535, 65535, 12130, 12083, 44834, 12061, 44822, 12051,
+    44818, 65535, 65535, 44821, 65535, 65535, 12058, 44825, 65535, 65535, 44828, 65535, 65535, 44831, 65535, 44833,
+    65535, 65535, 44844, 12075, 44840, 12071, 65535, 65535, 12074, 65535, 65535, 65535, 44850, 12079, 65535, 44849,
+    65535, 65535, 65535, 44875, 12092, 44855, 65535, 44857, 65535, 12091, 65535, 65535, 44868, 12097, 44864, 65535,
+    65535, 44867, 65535, 65535, 44872, 44871, 65535, 65535, 44874, 65535, 65535, 12117, 44880, 44879, 65535, 65535,
+    44884, 44883, 65535, 65535, 65535, 44891, 12120, 65535, 12122, 65535, 65535, 44895, 44894, 65535, 65535, 44897,
+    65535, 65535, 12184, 44931, 12148, 44909, 12138, 44905, 65535, 65535, 44908, 65535, 65535, 44913, 44912, 65535,
+    65535, 12147, 65535, 65535, 44924, 12153, 44920, 65535, 65535, 44923, 65535, 65535, 12160, 44927, 65535, 65535,
+    44930, 65535, 65535, 12179, 44940, 44937, 12168, 65535, 65535, 44939, 65535, 65535, 44944, 44943, 65535, 65535,
+    44946, 65535, 65535, 44951, 12182, 65535, 65535, 65535, 44984, 12201, 44962, 12191, 12190, 65535, 65535, 44961,
+    65535, 65535, 12198, 12197, 65535, 65535, 44968, 65535, 65535, 44977, 12206, 44973, 65535, 65535, 44976, 65535,
+    65535, 12213, 44980, 65535, 65535, 44983, 65535, 65535, 12224, 44987, 65535, 12221, 65535, 44991, 65535, 65535,
+    45000, 12229, 12228, 65535, 65535, 12231, 65535, 65535, 12236, 45003, 65535, 65535, 45006, 65535, 65535, 45087,
+    45068, 12273, 12258, 45019, 45016, 12247, 65535, 65535, 12250, 65535, 65535, 12255, 12254, 65535, 65535, 45025,
+    65535, 65535, 45034, 12263, 45030, 65535, 65535, 45033, 65535, 65535, 12270, 45037, 65535, 65535, 45040, 65535,
+    65535, 12285, 45046, 45045, 65535, 65535, 45050, 45049, 65535, 65535, 45052, 65535, 65535, 12293, 45058, 45057,
+    65535, 65535, 45060, 65535, 65535, 12297, 45064, 65535, 65535, 12299, 65535, 65535, 12302, 65535, 12312, 12305,
+    65535, 12309, 12308, 65535, 65535, 12311, 65535, 65535, 12314, 65535, 12316, 65535, 12318, 65535, 65535, 12371,
+    45108, 12333, 12328, 12327, 45094, 65535, 65535, 65535, 45098, 65535, 45100, 65535, 65535, 12339, 45106, 45105,
+    65535, 65535, 65535, 65535, 45124, 12349, 12346, 12345, 65535, 65535, 45116, 65535, 65535, 12353, 45120, 65535,
+    65535, 45123, 65535, 65535, 12364, 45129, 12360, 65535, 65535, 12363, 65535, 65535, 45136, 12367, 65535, 65535,
+    12370, 65535, 65535, 12403, 45156, 12381, 12378, 45145, 65535, 65535, 45148, 65535, 65535, 45153, 45152, 65535,
+    65535, 45155, 65535, 65535, 12396, 45161, 45160, 65535, 65535, 45163, 65535, 65535, 45168, 12399, 65535, 65535,
+    12402, 65535, 65535, 12419, 45180, 12409, 12408, 65535, 65535, 12411, 65535, 65535, 12416, 12415, 65535, 65535,
+    12418, 65535, 65535, 12427, 45192, 12423, 65535, 65535, 12426, 65535, 65535, 45199, 12430, 65535, 65535, 12433,
+    65535, 65535, 45268, 45253, 12462, 45219, 12444, 45211, 45210, 65535, 65535, 65535, 45216, 12447, 65535, 65535,
+    12450, 65535, 65535, 12457, 45224, 12455, 65535, 65535, 65535, 12459, 65535, 12461, 65535, 65535, 45244, 12469,
+    45236, 45235, 65535, 65535, 65535, 12473, 12472, 65535, 65535, 45243, 65535, 65535, 12478, 65535, 12482, 12481,
+    65535, 65535, 12484, 65535, 65535, 12487, 65535, 12497, 12496, 12493, 12492, 65535, 65535, 12495, 65535, 65535,
+    65535, 12499, 65535, 65535, 12504, 45271, 65535, 65535, 12512, 45275, 65535, 45279, 45278, 65535, 65535, 65535,
+    45292, 12519, 12518, 12517, 65535, 65535, 65535, 12521, 65535, 12523, 65535, 65535, 12526, 65535, 45298, 12529,
+    65535, 65535, 12532, 65535, 65535, 12627, 45362, 12563, 45320, 12545, 45310, 12541, 65535, 65535, 45312, 65535,
+    65535, 45317, 45316, 65535, 65535, 12551, 65535, 65535, 45326, 12557, 45324, 65535, 65535, 65535, 45330, 12561,
+    65535, 65535, 65535, 12579, 45340, 12569, 45336, 65535, 65535, 45339, 65535, 65535, 12576, 45343, 65535, 65535,
+    45346, 65535, 65535, 45355, 12584, 45351, 65535, 65535, 45354, 65535, 65535, 45359, 45358, 65535, 65535, 45361,
+    65535, 65535, 45392, 12609, 45372, 45369, 12600, 65535, 65535, 12603, 65535, 65535, 12608, 12607, 65535, 65535,
+    65535, 12617, 45382, 12613, 65535, 65535, 12616, 65535, 65535, 45389, 12620, 65535, 65535, 12623, 65535, 65535,
+    12626, 65535, 65535, 12681, 45426, 12643, 45404, 45403, 45402, 65535, 65535, 65535, 45408, 45407, 65535, 65535,
+    45410, 65535, 65535, 45419, 45416, 45415, 65535, 65535, 12650, 65535, 65535, 45423, 12654, 65535, 65535, 45425,
+    65535, 65535, 12672, 45435, 12664, 45431, 65535, 65535, 45434, 65535, 65535, 45437, 65535, 45439, 65535, 65535,
+    12680, 45445, 45444, 65535, 65535, 45447, 65535, 65535, 65535, 12711, 45464, 45459, 45456, 45455, 65535, 65535,
+    12690, 65535, 65535, 12693, 65535, 45463, 65535, 65535, 45472, 45469, 12700, 65535, 65535, 12703, 65535, 65535,
+    45476, 12707, 65535, 65535, 45478, 65535, 65535, 45495, 45488, 45485, 45484, 65535, 65535, 12719, 65535, 65535,
+    12724, 12723, 65535, 65535, 12726, 65535, 65535, 45503, 12732, 12731, 65535, 65535, 12734, 65535, 65535, 45507,
+    12738, 65535, 65535, 45509, 65535, 65535, 45614, 45575, 45544, 45529, 12754, 45519, 12750, 65535, 65535, 12753,
+    65535, 65535, 45526, 12757, 65535, 65535, 45528, 65535, 65535, 45537, 12766, 12765, 65535, 65535, 12768, 65535,
+    65535, 45541, 12772, 65535, 65535, 12775, 65535, 65535, 12792, 12785, 12782, 45549, 65535, 65535, 45552, 65535,
+    65535, 12789, 45556, 65535, 65535, 45559, 65535, 65535, 12800, 45565, 12796, 65535, 65535, 45567, 65535, 65535,
+    12804, 45571, 65535, 65535, 12806, 65535, 65535, 12827, 12816, 12815, 12812, 65535, 12814, 65535, 65535, 65535,
+    12820, 45587, 65535, 65535, 45592, 12823, 65535, 65535, 12826, 65535, 65535, 12831, 45598, 65535, 65535, 12839,
+    12836, 45603, 65535, 65535, 45606, 65535, 65535, 12843, 12842, 65535, 65535, 45613, 65535, 65535, 12886, 45623,
+    12854, 12853, 12852, 65535, 65535, 65535, 65535, 12871, 45632, 12861, 12860, 65535, 65535, 12863, 65535, 65535,
+    45636, 12867, 65535, 65535, 45638, 65535, 65535, 45647, 12876, 45643, 65535, 65535, 45646, 65535, 65535, 12883,
+    45650, 65535, 65535, 45653, 65535, 65535, 12906, 45661, 12892, 12891, 65535, 65535, 65535, 12901, 45666, 12897,
+    65535, 65535, 12900, 65535, 65535, 45671, 65535, 45673, 65535, 65535, 12922, 12915, 45680, 12911, 65535, 65535,
+    45682, 65535, 65535, 45687, 45686, 65535, 65535, 12921, 65535, 65535, 12930, 45695, 12926, 65535, 65535, 45697,
+    65535, 65535, 45700, 65535, 65535, 45783, 45754, 45735, 45720, 45713, 12942, 12941, 65535, 65535, 12944, 65535,
+    65535, 12949, 12948, 65535, 65535, 12951, 65535, 65535, 12960, 12957, 12956, 65535, 65535, 12959, 65535, 65535,
+    45732, 12963, 65535, 65535, 12966, 65535, 65535, 12979, 12974, 12973, 12972, 65535, 65535, 65535, 12976, 65535,
+    12978, 65535, 65535, 12985, 12984, 12983, 65535, 65535, 65535, 65535, 13010, 13001, 12994, 12993, 12992, 65535,
+    65535, 65535, 45766, 12997, 65535, 65535, 13000, 65535, 65535, 45773, 13004, 65535, 65535, 13009, 13008, 65535,
+    65535, 65535, 13012, 65535, 45782, 65535, 65535, 13073, 45810, 13031, 13026, 13023, 13022, 65535, 65535, 13025,
+    65535, 65535, 13028, 65535, 45798, 65535, 65535, 45805, 45802, 65535, 13036, 65535, 65535, 45809, 13040, 65535,
+    65535, 65535, 13058, 45819, 45816, 13047, 65535, 65535, 13050, 65535, 65535, 45823, 13054, 65535, 65535, 45825,
+    65535, 65535, 45834, 13063, 45830, 65535, 65535, 45833, 65535, 65535, 13070, 45837, 65535, 65535, 45840, 65535,
+    65535, 45861, 13088, 45851, 13080, 13079, 65535, 65535, 13082, 65535, 65535, 13087, 13086, 65535, 65535, 65535,
+    45858, 65535, 45860, 65535, 65535, 45875, 45868, 13099, 13098, 65535, 65535, 65535, 13104, 45871, 65535, 65535,
+    45874, 65535, 65535, 65535, 45984, 45939, 13140, 45895, 45888, 45885, 13116, 65535, 65535, 13119, 65535, 65535,
+    13124, 13123, 65535, 65535, 13126, 65535, 65535, 13135, 13132, 13131, 65535, 65535, 45902, 65535, 65535, 13139,
+    13138, 65535, 65535, 65535, 45924, 13149, 45914, 45913, 65535, 65535, 45916, 65535, 65535, 13153, 45920, 65535,
+    65535, 45923, 65535, 65535, 13164, 45929, 13160, 65535, 65535, 13163, 65535, 65535, 45936, 45935, 65535, 65535,
+    13170, 65535, 65535, 13203, 13188, 13181, 13178, 13177, 65535, 65535, 13180, 65535, 65535, 13185, 45952, 65535,
+    65535, 13187, 65535, 65535, 45964, 45961, 13192, 65535, 65535, 13195, 65535, 65535, 13200, 13199, 65535, 65535,
+    13202, 65535, 65535, 13211, 45978, 45975, 65535, 45977, 65535, 65535, 65535, 13215, 45982, 65535, 65535, 65535,
+    13276, 46013, 13230, 13227, 13224, 45991, 65535, 65535, 45994, 65535, 65535, 45997, 65535, 65535, 46006, 46003,
+    13234, 65535, 65535, 13237, 65535, 65535, 46010, 13241, 65535, 65535, 13244, 65535, 65535, 13261, 46022, 13251,
+    13250, 65535, 65535, 13253, 65535, 65535, 46026, 13257, 65535, 65535, 46028, 65535, 65535, 46037, 46034, 13265,
+    65535, 65535, 46036, 65535, 65535, 46041, 46040, 65535, 65535, 46043, 65535, 65535, 13306, 46061, 13286, 13283,
+    46050, 65535, 65535, 46053, 65535, 65535, 46058, 46057, 65535, 65535, 46060, 65535, 65535, 46069, 46066, 13297,
+    65535, 65535, 46068, 65535, 65535, 13305, 46072, 65535, 65535, 65535, 46084, 13309, 65535, 13313, 13312, 65535,
+    65535, 13315, 65535, 65535, 13318, 65535, 46090, 13321, 65535, 65535, 65535, 13443, 13386, 13357, 13342, 46103,
+    13332, 13331, 65535, 65535, 13334, 65535, 65535, 13339, 46106, 65535, 65535, 46109, 65535, 65535, 46118, 46115,
+    13346, 65535, 65535, 13349, 65535, 65535, 46122, 13353, 65535, 65535, 13356, 65535, 65535, 46141, 46134, 13363,
+    46130, 65535, 65535, 46133, 65535, 65535, 13370, 13369, 65535, 65535, 13372, 65535, 65535, 13379, 46146, 13377,
+    65535, 65535, 65535, 46151, 46150, 65535, 65535, 46153, 65535, 65535, 46182, 13399, 13394, 46161, 46160, 65535,
+    65535, 65535, 13398, 46165, 65535, 65535, 65535, 13407, 13404, 13403, 65535, 65535, 13406, 65535, 65535, 13411,
+    46178, 65535, 65535, 46181, 65535, 65535, 13430, 46191, 46188, 46187, 65535, 65535, 13422, 65535, 65535, 13427,
+    13426, 65535, 65535, 13429, 65535, 65535, 46206, 46203, 13434, 65535, 65535, 13437, 65535, 65535, 46210, 46209,
+    65535, 65535, 65535, 46263, 13468, 46223, 46216, 65535, 46220, 13451, 65535, 65535, 46222, 65535, 65535, 13463,
+    46228, 46227, 65535, 65535, 13462, 65535, 65535, 46235, 46234, 65535, 65535, 65535, 46252, 13477, 46242, 46241,
+    65535, 65535, 13476, 65535, 65535, 46249, 13480, 65535, 65535, 46251, 65535, 65535, 13492, 46257, 13488, 65535,
+    65535, 46259, 65535, 65535, 46262, 65535, 65535, 13511, 46276, 13503, 46268, 65535, 46270, 65535, 65535, 46273,
+    65535, 46275, 65535, 65535, 46278, 65535, 65535, 65535, 13616, 13571, 13546, 13531, 13524, 13521, 13520, 65535,
+    65535, 46291, 65535, 65535, 46296, 13527, 65535, 65535, 13530, 65535, 65535, 46307, 46304, 13535, 65535, 65535,
+    46306, 65535, 65535, 46311, 46310, 65535, 65535, 46313, 65535, 65535, 46324, 46323, 46320, 13551, 65535, 65535,
+    46322, 65535, 65535, 65535, 46332, 46329, 13560, 65535, 65535, 13563, 65535, 65535, 13568, 13567, 65535, 65535,
+    46338, 65535, 65535, 46361, 46354, 46347, 13576, 65535, 46346, 65535, 65535, 13583, 13582, 65535, 65535, 46353,
+    65535, 65535, 13592, 13591, 13590, 65535, 65535, 65535, 65535, 13609, 13602, 46367, 46366, 65535, 65535, 13601,
+    65535, 65535, 46374, 46373, 65535, 65535, 13608, 65535, 65535, 46383, 46382, 13613, 65535, 65535, 65535, 65535,
+    46436, 13639, 46396, 46395, 46392, 46391, 65535, 65535, 13626, 65535, 65535, 65535, 46400, 13631, 65535, 65535,
+    46404, 13635, 65535, 65535, 46406, 65535, 65535, 46423, 13648, 46413, 46412, 65535, 65535, 46415, 65535, 65535,
+    46420, 13651, 65535, 65535, 13654, 65535, 65535, 13663, 46428, 46427, 65535, 65535, 13662, 65535, 65535, 46435,
+    13666, 65535, 65535, 65535, 46452, 13677, 46442, 46441, 65535, 65535, 46444, 65535, 65535, 13683, 46448, 65535,
+    46450, 65535, 65535, 65535, 65535, 13743, 13702, 46469, 46468, 46463, 13694, 13693, 65535, 65535, 65535, 13697,
+    65535, 46467, 65535, 65535, 65535, 65535, 46492, 13711, 46478, 46475, 65535, 46477, 65535, 65535, 65535, 13719,
+    13716, 46483, 65535, 65535, 13718, 65535, 65535, 46489, 65535, 46491, 65535, 65535, 13728, 46495, 65535, 65535,
+    46504, 13733, 13732, 65535, 65535, 13735, 65535, 65535, 13740, 46507, 65535, 65535, 46510, 65535, 65535, 13799,
+    46544, 13761, 46522, 46519, 46518, 65535, 65535, 46521, 65535, 65535, 46526, 46525, 65535, 65535, 13760, 65535,
+    65535, 46537, 46534, 46533, 65535, 65535, 13768, 65535, 65535, 46541, 13772, 65535, 65535, 46543, 65535, 65535,
+    13790, 46553, 13782, 46549, 65535, 65535, 46552, 65535, 65535, 46555, 65535, 46557, 65535, 65535, 13798, 46563,
+    46562, 65535, 65535, 46565, 65535, 65535, 65535, 13829, 46582, 46577, 46574, 46573, 65535, 65535, 13808, 65535,
+    65535, 13811, 65535, 46581, 65535, 65535, 46590, 46587, 13818, 65535, 65535, 13821, 65535, 65535, 46594, 13825,
+    65535, 65535, 46596, 65535, 65535, 46613, 46606, 13835, 46602, 65535, 65535, 13837, 65535, 65535, 13842, 13841,
+    65535, 65535, 13844, 65535, 65535, 46621, 13850, 13849, 65535, 65535, 13852, 65535, 65535, 13857, 46624, 65535,
+    65535, 46627, 65535, 65535, 13864, 46631, 65535, 65535, 13870, 46637, 46636, 65535, 65535, 65535, 13878, 46641,
+    65535, 46645, 46644, 65535, 65535, 65535, 13884, 46651, 46650, 65535, 65535, 65535, 46660, 13889, 46656, 65535,
+    65535, 13891, 65535, 65535, 13896, 46663, 65535, 65535, 46666, 65535, 65535, 13947, 13918, 46685, 46684, 46679,
+    13908, 46675, 65535, 65535, 46678, 65535, 65535, 46681, 65535, 13915, 65535, 65535, 65535, 65535, 46690, 13921,
+    65535, 65535, 46704, 13929, 46696, 46695, 65535, 65535, 65535, 13933, 13932, 65535, 65535, 46703, 65535, 65535,
+    13940, 46707, 65535, 65535, 46712, 13943, 65535, 65535, 13946, 65535, 65535, 13995, 46746, 13963, 13956, 46723,
+    46722, 65535, 65535, 65535, 46728, 46727, 65535, 65535, 13962, 65535, 65535, 46739, 46736, 46735, 65535, 65535,
+    13970, 65535, 65535, 46743, 13974, 65535, 65535, 46745, 65535, 65535, 13994, 46755, 46752, 13983, 65535, 65535,
+    46754, 65535, 65535, 46759, 13990, 65535, 65535, 13993, 65535, 65535, 65535, 14021, 46778, 46773, 46770, 46769,
+    65535, 65535, 14004, 65535, 65535, 14009, 46776, 65535, 65535, 65535, 46782, 14013, 65535, 65535, 46786, 14017,
+    65535, 65535, 14020, 65535, 65535, 46803, 46798, 14027, 14026, 65535, 65535, 14029, 65535, 65535, 14032, 65535,
+    14034, 65535, 65535, 14043, 46808, 46807, 65535, 65535, 46810, 65535, 65535, 46815, 14046, 65535, 65535, 46817,
+    65535, 65535, 46928, 14113, 14084, 14069, 14062, 14059, 14058, 65535, 65535, 46829, 65535, 65535, 46834, 14065,
+    65535, 65535, 46836, 65535, 65535, 46845, 14074, 46841, 65535, 65535, 46844, 65535, 65535, 14081, 46848, 65535,
+    65535, 46851, 65535, 65535, 46866, 46861, 14090, 46857, 65535, 65535, 14092, 65535, 65535, 14097, 14096, 65535,
+    65535, 65535, 14106, 46871, 46870, 65535, 65535, 14105, 65535, 65535, 46878, 14109, 65535, 65535, 46880, 65535,
+    65535, 46913, 14130, 46891, 46888, 46887, 65535, 65535, 46890, 65535, 65535, 46895, 14126, 65535, 65535, 46897,
+    65535, 65535, 46906, 14135, 46902, 65535, 65535, 46905, 65535, 65535, 46910, 14141, 65535, 65535, 46912, 65535,
+    65535, 14157, 46922, 14151, 46918, 65535, 65535, 46921, 65535, 65535, 46924, 65535, 65535, 46927, 65535, 65535,
+    14170, 14167, 46932, 65535, 14166, 65535, 65535, 46937, 65535, 65535, 14198, 14187, 14180, 14177, 46944, 65535,
+    65535, 46947, 65535, 65535, 14184, 14183, 65535, 65535, 46954, 65535, 65535, 14193, 14192, 46959, 65535, 65535,
+    65535, 14197, 46964, 65535, 65535, 65535, 14208, 46973, 14202, 65535, 14204, 65535, 65535, 14207, 65535, 65535,
+    65535, 47081, 47040, 14243, 14228, 46989, 14218, 46985, 65535, 65535, 46988, 65535, 65535, 14225, 46992, 65535,
+    65535, 46995, 65535, 65535, 14236, 47001, 47000, 65535, 65535, 14235, 65535, 65535, 47008, 47007, 65535, 65535,
+    47010, 65535, 65535, 47027, 47020, 14249, 47016, 65535, 65535, 47019, 65535, 65535, 14256, 14255, 65535, 65535,
+    14258, 65535, 65535, 14265, 14262, 65535, 47032, 65535, 65535, 47037, 14268, 65535, 65535, 14271, 65535, 65535,
+    14296, 14289, 14282, 47047, 14278, 65535, 65535, 14281, 65535, 65535, 47054, 14285, 65535, 65535, 14288, 65535,
+    65535, 14293, 47060, 65535, 65535, 14295, 65535, 65535, 14308, 14305, 14302, 14301, 65535, 65535, 14304, 65535,
+    65535, 14307, 65535, 65535, 14310, 65535, 14312, 65535, 65535, 47111, 14336, 14325, 14322, 14321, 14320, 65535,
+    65535, 65535, 14324, 65535, 65535, 14331, 14330, 14329, 65535, 65535, 65535, 14333, 65535, 14335, 65535, 65535,
+    14338, 65535, 14342, 14341, 65535, 65535, 65535, 47127, 14354, 14353, 14350, 14349, 65535, 65535, 14352, 65535,
+    65535, 65535, 14356, 65535, 14358, 65535, 65535, 47143, 14368, 14365, 14364, 65535, 65535, 14367, 65535, 65535,
+    14372, 14371, 65535, 65535, 47142, 65535, 65535, 47151, 14380, 14379, 65535, 65535, 14382, 65535, 65535, 47155,
+    14386, 65535, 65535, 14389, 65535, 65535, 14412, 47179, 14408, 14403, 47170, 47167, 14398, 65535, 65535, 47169,
+    65535, 65535, 65535, 47175, 47174, 65535, 65535, 65535, 47178, 65535, 65535, 65535, 47224, 14425, 47188, 14417,
+    65535, 47187, 65535, 65535, 14422, 65535, 47192, 65535, 65535, 47209, 47202, 14431, 47198, 65535, 65535, 14433,
+    65535, 65535, 14438, 14437, 65535, 65535, 14440, 65535, 65535, 47217, 14446, 14445, 65535, 65535, 14448, 65535,
+    65535, 14453, 47220, 65535, 65535, 47223, 65535, 65535, 14460, 47227, 65535, 65535, 47240, 14465, 14464, 65535,
+    65535, 14469, 14468, 65535, 65535, 14471, 65535, 65535, 47248, 14477, 14476, 65535, 65535, 14479, 65535, 65535,
+    47252, 14483, 65535, 65535, 14486, 65535, 65535, 47351, 47320, 47289, 47274, 47267, 14496, 14495, 65535, 65535,
+    14498, 65535, 65535, 14503, 14502, 65535, 65535, 14505, 65535, 65535, 14514, 47279, 14510, 65535, 65535, 14513,
+    65535, 65535, 47286, 14517, 65535, 65535, 14520, 65535, 65535, 14537, 14530, 14527, 14526, 65535, 65535, 47297,
+    65535, 65535, 14534, 47301, 65535, 65535, 47304, 65535, 65535, 14545, 47310, 14541, 65535, 65535, 47312, 65535,
+    65535, 14549, 47316, 65535, 65535, 47319, 65535, 65535, 14578, 14567, 14560, 14559, 14558, 65535, 65535, 65535,
+    14564, 14563, 65535, 65535, 14566, 65535, 65535, 47341, 14572, 14571, 65535, 65535, 65535, 14577, 14576, 65535,
+    65535, 65535, 14580, 65535, 47350, 65535, 65535, 14631, 47376, 14597, 14594, 47359, 14590, 65535, 65535, 14593,
+    65535, 65535, 14596, 65535, 65535, 47369, 14600, 65535, 65535, 14605, 47372, 65535, 65535, 47375, 65535, 65535,
+    47384, 14611, 65535, 14613, 65535, 14615, 65535, 65535, 14624, 47389, 14620, 65535, 65535, 47391, 65535, 65535,
+    47396, 14627, 65535, 65535, 47398, 65535, 65535, 14661, 47414, 47409, 14638, 47405, 65535, 65535, 14640, 65535,
+    65535, 14645, 14644, 65535, 65535, 65535, 14654, 47419, 47418, 65535, 65535, 47421, 65535, 65535, 47426, 14657,
+    65535, 65535, 47428, 65535, 65535, 47431, 65535, 47433, 65535, 47435, 65535, 47437, 65535, 65535, 47538, 14721,
+    47466, 47457, 47450, 47447, 47446, 65535, 65535, 14681, 65535, 65535, 14686, 14685, 65535, 65535, 47456, 65535,
+    65535, 14697, 14694, 47461, 65535, 65535, 47464, 65535, 65535, 65535, 14712, 14705, 47470, 65535, 47472, 65535,
+    65535, 47477, 47476, 65535, 65535, 47479, 65535, 65535, 14716, 47483, 65535, 65535, 47488, 47487, 65535, 65535,
+    65535, 14739, 47500, 47499, 47496, 47495, 65535, 65535, 47498, 65535, 65535, 65535, 47502, 65535, 47504, 65535,
+    47506, 65535, 65535, 47523, 14748, 14745, 14744, 65535, 65535, 47515, 65535, 65535, 14752, 47519, 65535, 65535,
+    47522, 65535, 65535, 47531, 47528, 14759, 65535, 65535, 14762, 65535, 65535, 14767, 14766, 65535, 65535, 14769,
+    65535, 65535, 14824, 47563, 14782, 14779, 14778, 14777, 65535, 65535, 65535, 47549, 65535, 65535, 47556, 14787,
+    47554, 65535, 65535, 65535, 14792, 47559, 65535, 65535, 47562, 65535, 65535, 14809, 47572, 14801, 47568, 65535,
+    65535, 47571, 65535, 65535, 14806, 65535, 47576, 65535, 65535, 14817, 14814, 14813, 65535, 65535, 47584, 65535,
+    65535, 47589, 47588, 65535, 65535, 47591, 65535, 65535, 47620, 14839, 47600, 14831, 14830, 65535, 65535, 65535,
+    14836, 47603, 65535, 65535, 47606, 65535, 65535, 47613, 14844, 14843, 65535, 65535, 65535, 47617, 47616, 65535,
+    65535, 14851, 65535, 65535, 47636, 47629, 47626, 14857, 65535, 65535, 47628, 65535, 65535, 47633, 47632, 65535,
+    65535, 14867, 65535, 65535, 14874, 47641, 47640, 65535, 65535, 65535, 14878, 14877, 65535, 65535, 65535, 14983,
+    14944, 47681, 14898, 14891, 47656, 47655, 65535, 65535, 14890, 65535, 65535, 47663, 14894, 65535, 65535, 14897,
+    65535, 65535, 14906, 47671, 47670, 65535, 65535, 14905, 65535, 65535, 14910, 47677, 65535, 65535, 47680, 65535,
+    65535, 14929, 47690, 14919, 47686, 65535, 65535, 47689, 65535, 65535, 14926, 47693, 65535, 65535, 14928, 65535,
+    65535, 47705, 47702, 47701, 65535, 65535, 47704, 65535, 65535, 47709, 14940, 65535, 65535, 47711, 65535, 65535,
+    47732, 47729, 14954, 47719, 14950, 65535, 65535, 14953, 65535, 65535, 47726, 47725, 65535, 65535, 47728, 65535,
+    65535, 14963, 65535, 65535, 14976, 47741, 14970, 14969, 65535, 65535, 47740, 65535, 65535, 47743, 65535, 65535,
+    47746, 65535, 47748, 65535, 47750, 65535, 65535, 15037, 47784, 15001, 47762, 14991, 47758, 65535, 65535, 14993,
+    65535, 65535, 14998, 47765, 65535, 65535, 15000, 65535, 65535, 47777, 15006, 47773, 65535, 65535, 47776, 65535,
+    65535, 47781, 15012, 65535, 65535, 15015, 65535, 65535, 15022, 47789, 15020, 65535, 65535, 65535, 47798, 15027,
+    47794, 65535, 65535, 47797, 65535, 65535, 15034, 15033, 65535, 65535, 47804, 65535, 65535, 47831, 47816, 47809,
+    65535, 47813, 47812, 65535, 65535, 15047, 65535, 65535, 15056, 47821, 47820, 65535, 65535, 15055, 65535, 65535,
+    47828, 15059, 65535, 65535, 47830, 65535, 65535, 15075, 15070, 47837, 15068, 65535, 65535, 65535, 47842, 47841,
+    65535, 65535, 65535, 47851, 47848, 47847, 65535, 65535, 15082, 65535, 65535, 15087, 47854, 65535, 65535, 47857,
+    65535, 65535, 15208, 15149, 15124, 15109, 15102, 15099, 15098, 65535, 65535, 47869, 65535, 65535, 47874, 15105,
+    65535, 65535, 47876, 65535, 65535, 47885, 15114, 15113, 65535, 65535, 47884, 65535, 65535, 47889, 15120, 65535,
+    65535, 15123, 65535, 65535, 47908, 15133, 47898, 15129, 65535, 65535, 15132, 65535, 65535, 47905, 47904, 65535,
+    65535, 15139, 65535, 65535, 15144, 47911, 65535, 65535, 47916, 15147, 65535, 65535, 65535, 47947, 15164, 47925,
+    15156, 15155, 65535, 65535, 65535, 47929, 47928, 65535, 65535, 47931, 65535, 65535, 15172, 47937, 47936, 65535,
+    65535, 47939, 65535, 65535, 15176, 15175, 65535, 65535, 15178, 65535, 65535, 15193, 47956, 15185, 47952, 65535,
+    65535, 47955, 65535, 65535, 47958, 65535, 15192, 65535, 65535, 15201, 47966, 47965, 65535, 65535, 15200, 65535,
+    65535, 47973, 47972, 65535, 65535, 15207, 65535, 65535, 48032, 15235, 47990, 47985, 47982, 65535, 15216, 65535,
+    65535, 15221, 47988, 65535, 65535, 65535, 15228, 47993, 65535, 47995, 65535, 65535, 48000, 15231, 65535, 65535,
+    48002, 65535, 65535, 48019, 15244, 48009, 48008, 65535, 65535, 15243, 65535, 65535, 48016, 48015, 65535, 65535,
+    48018, 65535, 65535, 48027, 15256, 48023, 65535, 65535, 48026, 65535, 65535, 15263, 48030, 65535, 65535, 65535,
+    48046, 15271, 48038, 48037, 65535, 65535, 65535, 48043, 15274, 65535, 65535, 48045, 65535, 65535, 65535, 15377,
+    15334, 15309, 15298, 15291, 15288, 15287, 65535, 65535, 48058, 65535, 65535, 48063, 48062, 65535, 65535, 15297,
+    65535, 65535, 48072, 48071, 48070, 65535, 65535, 65535, 48076, 48075, 65535, 65535, 65535, 48089, 48086, 48083,
+    48082, 65535, 65535, 15317, 65535, 65535, 15320, 65535, 65535, 48095, 48094, 48093, 65535, 65535, 65535, 48099,
+    48098, 65535, 65535, 15333, 65535, 65535, 48122, 48117, 48112, 48109, 15340, 65535, 65535, 15343, 65535, 65535,
+    15348, 15347, 65535, 65535, 65535, 15353, 15352, 65535, 65535, 65535, 15368, 15363, 48128, 48127, 65535, 65535,
+    15362, 65535, 65535, 48133, 65535, 48135, 65535, 65535, 48140, 15371, 65535, 65535, 48144, 15375, 65535, 65535,
+    65535, 48199, 15406, 48161, 48154, 48151, 65535, 15385, 65535, 65535, 15390, 48157, 65535, 65535, 48160, 65535,
+    65535, 48167, 15398, 15397, 65535, 65535, 65535, 48171, 15402, 65535, 65535, 15405, 65535, 65535, 48190, 48183,
+    15412, 48179, 65535, 65535, 48182, 65535, 65535, 15419, 48186, 65535, 65535, 48189, 65535, 65535, 15430, 48195,
+    48194, 65535, 65535, 48197, 65535, 65535, 65535, 15451, 48212, 48205, 15436, 65535, 65535, 15441, 48208, 65535,
+    65535, 48211, 65535, 65535, 15450, 48215, 65535, 48217, 65535, 65535, 65535, 48221, 65535, 65535, 48302, 48271,
+    48254, 15473, 48234, 48231, 15462, 65535, 65535, 15465, 65535, 65535, 15470, 48237, 65535, 65535, 48240, 65535,
+    65535, 48249, 15478, 48245, 65535, 65535, 15480, 65535, 65535, 15483, 65535, 15485, 65535, 65535, 15496, 15493,
+    15492, 15491, 65535, 65535, 65535, 15495, 65535, 65535, 15498, 65535, 15500, 65535, 15502, 65535, 65535, 15523,
+    15518, 15511, 15510, 15509, 65535, 65535, 65535, 48283, 15514, 65535, 65535, 48285, 65535, 65535, 48290, 48289,
+    65535, 65535, 65535, 15525, 65535, 48297, 15528, 65535, 65535, 15531, 65535, 15533, 65535, 65535, 48314, 15545,
+    15544, 15543, 15542, 15541, 65535, 65535, 65535, 65535, 65535, 65535, 48336, 15555, 15554, 15553, 15552, 65535,
+    65535, 65535, 65535, 15561, 48328, 15559, 65535, 65535, 65535, 48333, 15564, 65535, 65535, 15567, 65535, 65535,
+    48350, 15575, 15574, 15573, 65535, 65535, 65535, 15579, 48346, 65535, 65535, 15581, 65535, 65535, 15588, 48355,
+    48354, 65535, 65535, 65535, 15592, 48359, 65535, 65535, 15594, 65535, 65535, 15599, 48366, 65535, 65535, 48405,
+    48388, 15607, 48374, 48373, 65535, 65535, 65535, 15615, 15612, 15611, 65535, 65535, 48382, 65535, 65535, 48385,
+    65535, 15619, 65535, 65535, 15628, 15623, 65535, 15627, 15626, 65535, 65535, 65535, 15630, 65535, 15634, 15633,
+    65535, 65535, 15636, 65535, 65535, 48419, 15642, 48409, 65535, 65535, 15644, 65535, 48416, 15647, 65535, 65535,
+    15650, 65535, 65535, 15655, 48422, 65535, 65535, 48429, 15658, 65535, 15660, 65535, 65535, 15665, 48432, 65535,
+    65535, 48435, 65535, 65535, 15764, 48493, 15694, 48453, 15680, 15677, 48444, 65535, 65535, 48447, 65535, 65535,
+    48450, 65535, 48452, 65535, 65535, 48457, 15688, 65535, 65535, 15691, 65535, 48461, 65535, 65535, 15710, 48471,
+    48468, 15699, 65535, 65535, 48470, 65535, 65535, 15707, 48474, 65535, 65535, 48477, 65535, 65535, 48486, 15715,
+    48482, 65535, 65535, 48485, 65535, 65535, 48490, 15721, 65535, 65535, 48492, 65535, 65535, 15745, 48510, 15735,
+    48500, 15731, 65535, 65535, 48502, 65535, 65535, 48507, 15738, 65535, 65535, 48509, 65535, 65535, 15744, 65535,
+    65535, 48529, 48522, 15751, 48518, 65535, 65535, 48521, 65535, 65535, 48526, 15757, 65535, 65535, 15760, 65535,
+    65535, 15763, 65535, 65535, 15812, 48557, 15774, 48537, 65535, 48539, 65535, 48541, 65535, 65535, 48550, 48547,
+    48546, 65535, 65535, 15781, 65535, 65535, 48554, 15785, 65535, 65535, 48556, 65535, 65535, 15803, 15798, 48563,
+    48562, 65535, 65535, 48565, 65535, 65535, 48570, 48569, 65535, 65535, 65535, 48577, 15808, 48575, 65535, 65535,
+    65535, 48579, 65535, 65535, 15840, 48597, 48590, 48587, 15818, 65535, 65535, 15821, 65535, 65535, 15826, 48593,
+    65535, 65535, 15828, 65535, 65535, 48601, 15832, 65535, 65535, 48605, 15836, 65535, 65535, 15839, 65535, 65535,
+    48624, 15849, 48614, 15845, 65535, 65535, 15848, 65535, 65535, 15853, 48620, 65535, 65535, 48623, 65535, 65535,
+    48632, 15861, 48628, 65535, 65535, 48631, 65535, 65535, 48636, 15867, 65535, 65535, 15870, 65535, 65535, 48737,
+    48700, 15905, 15890, 48651, 15880, 15879, 65535, 65535, 48650, 65535, 65535, 48655, 15886, 65535, 65535, 48657,
+    65535, 65535, 15898, 48663, 48662, 65535, 65535, 15897, 65535, 65535, 48670, 48669, 65535, 65535, 15904, 65535,
+    65535, 15917, 48682, 48679, 48678, 65535, 65535, 15913, 65535, 65535, 15916, 65535, 65535, 15925, 48690, 15921,
+    65535, 65535, 48692, 65535, 65535, 48697, 15928, 65535, 65535, 15931, 65535, 65535, 15952, 15941, 15940, 15937,
+    65535, 15939, 65535, 65535, 65535, 15945, 48712, 65535, 65535, 48717, 15948, 65535, 65535, 15951, 65535, 65535,
+    15956, 48723, 65535, 65535, 15962, 15959, 65535, 15961, 65535, 65535, 15966, 15965, 65535, 65535, 48736, 65535,
+    65535, 16009, 48746, 15977, 15976, 15975, 65535, 65535, 65535, 65535, 15994, 48755, 15984, 15983, 65535, 65535,
+    15986, 65535, 65535, 48759, 15990, 65535, 65535, 48761, 65535, 65535, 48770, 48767, 48766, 65535, 65535, 16001,
+    65535, 65535, 48774, 16005, 65535, 65535, 48776, 65535, 65535, 16031, 48784, 16015, 16014, 65535, 65535, 65535,
+    48792, 16021, 48788, 65535, 65535, 48791, 65535, 65535, 48796, 16027, 65535, 65535, 16030, 65535, 65535, 16047,
+    16040, 48805, 16036, 65535, 65535, 16039, 65535, 65535, 48812, 16043, 65535, 65535, 48814, 65535, 65535, 48817,
+    65535, 65535, 48892, 48865, 48850, 16067, 16062, 16059, 16058, 65535, 65535, 48829, 65535, 65535, 48832, 65535,
+    48834, 65535, 65535, 48843, 16072, 16071, 65535, 65535, 48842, 65535, 65535, 48847, 16078, 65535, 65535, 48849,
+    65535, 65535, 16096, 16089, 16088, 16087, 65535, 65535, 65535, 16093, 16092, 65535, 65535, 16095, 65535, 65535,
+    65535, 16121, 16114, 16107, 48872, 16103, 65535, 65535, 16106, 65535, 65535, 16111, 48878, 65535, 65535, 48881,
+    65535, 65535, 48884, 65535, 48886, 65535, 48888, 65535, 65535, 48891, 65535, 65535, 16166, 16135, 48900, 48899,
+    16130, 65535, 65535, 65535, 48902, 65535, 65535, 16151, 48912, 16141, 16140, 65535, 65535, 16143, 65535, 65535,
+    16148, 48915, 65535, 65535, 48918, 65535, 65535, 48927, 48924, 16155, 65535, 65535, 16158, 65535, 65535, 16163,
+    48930, 65535, 65535, 48933, 65535, 65535, 48952, 16179, 48942, 16173, 16172, 65535, 65535, 65535, 48946, 16177,
+    65535, 65535, 65535, 16181, 65535, 48951, 65535, 65535, 48962, 16189, 48956, 65535, 65535, 48961, 48960, 65535,
+    65535, 65535, 48966, 16197, 65535, 65535, 48970, 48969, 65535, 65535, 65535, 49079, 49026, 49003, 48990, 48983,
+    48980, 48979, 65535, 65535, 16214, 65535, 65535, 16219, 16218, 65535, 65535, 16221, 65535, 65535, 16228, 16227,
+    16226, 65535, 65535, 65535, 16232, 16231, 65535, 65535, 16234, 65535, 65535, 16243, 16242, 16241, 16240, 65535,
+    65535, 65535, 65535, 16251, 49016, 49015, 65535, 65535, 49018, 65535, 65535, 49023, 16254, 65535, 65535, 49025,
+    65535, 65535, 16284, 16271, 16266, 16263, 65535, 16265, 65535, 65535, 49036, 65535, 49038, 65535, 65535, 16279,
+    16276, 16275, 65535, 65535, 49046, 65535, 65535, 49049, 65535, 16283, 65535, 65535, 49066, 16291, 16288, 65535,
+    49058, 65535, 65535, 16295, 16294, 65535, 65535, 16297, 65535, 65535, 16304, 16303, 16302, 65535, 65535, 65535,
+    16308, 49075, 65535, 65535, 16310, 65535, 65535, 16355, 49104, 16327, 49088, 16319, 16318, 65535, 65535, 65535,
+    16324, 16323, 65535, 65535, 16326, 65535, 65535, 16329, 65535, 49101, 49100, 65535, 65535, 16335, 65535, 65535,
+    16340, 49107, 65535, 65535, 16348, 49113, 16344, 65535, 65535, 16347, 65535, 65535, 49120, 49119, 65535, 65535,
+    49122, 65535, 65535, 49153, 16372, 16365, 49130, 16361, 65535, 65535, 16364, 65535, 65535, 49137, 49136, 65535,
+    65535, 49139, 65535, 65535, 16380, 49145, 16376, 65535, 65535, 49147, 65535, 65535, 16382, 65535, 49152, 65535,
+    65535, 49165, 16394, 16391, 16390, 65535, 65535, 16393, 65535, 65535, 16396, 65535, 65535, 49173, 16402, 16401,
+    65535, 65535, 16404, 65535, 65535, 16409, 49176, 65535, 65535, 49179, 65535, 65535, 49300, 16469, 16444, 16431,
+    16424, 16421, 16420, 65535, 65535, 49191, 65535, 65535, 49196, 49195, 65535, 65535, 49198, 65535, 65535, 49205,
+    49204, 49203, 65535, 65535, 65535, 49209, 49208, 65535, 65535, 49211, 65535, 65535, 49222, 49215, 65535, 16451,
+    49218, 65535, 65535, 49221, 65535, 65535, 49230, 16459, 49226, 65535, 65535, 49229, 65535, 65535, 16466, 49233,
+    65535, 65535, 49236, 65535, 65535, 16501, 49254, 16479, 49244, 16475, 65535, 65535, 16478, 65535, 65535, 49251,
+    16482, 65535, 65535, 16485, 65535, 65535, 49262, 16491, 16490, 65535, 65535, 49261, 65535, 65535, 49266, 49265,
+    65535, 65535, 49268, 65535, 65535, 16517, 49278, 16507, 49274, 65535, 65535, 49277, 65535, 65535, 49282, 16513,
+    65535, 65535, 49284, 65535, 65535, 49293, 49290, 49289, 65535, 65535, 16524, 65535, 65535, 16529, 16528, 65535,
+    65535, 16531, 65535, 65535, 16538, 49303, 65535, 16537, 65535, 65535, 16560, 16549, 16548, 16545, 16544, 65535,
+    65535, 16547, 65535, 65535, 65535, 16555, 16554, 49321, 65535, 65535, 65535, 16559, 49326, 65535, 65535, 65535,
+    49336, 16563, 65535, 16565, 65535, 16567, 65535, 65535, 16570, 65535, 65535, 16681, 16626, 16603, 16588, 16583,
+    16580, 16579, 65535, 65535, 49350, 65535, 65535, 49355, 49354, 65535, 65535, 65535, 49364, 49361, 16592, 65535,
+    65535, 16595, 65535, 65535, 49368, 16599, 65535, 65535, 49370, 65535, 65535, 49383, 49378, 16609, 49376, 65535,
+    65535, 65535, 49380, 65535, 49382, 65535, 65535, 49391, 16620, 49387, 65535, 65535, 49390, 65535, 65535, 49393,
+    65535, 65535, 49418, 16635, 49402, 49399, 65535, 49401, 65535, 65535, 65535, 49411, 16640, 49407, 65535, 65535,
+    49410, 65535, 65535, 49415, 16646, 65535, 65535, 16649, 65535, 65535, 49434, 16659, 16656, 49423, 65535, 65535,
+    16658, 65535, 65535, 16663, 49430, 65535, 65535, 49433, 65535, 65535, 49442, 16671, 16670, 65535, 65535, 16673,
+    65535, 65535, 16678, 49445, 65535, 65535, 49448, 65535, 65535, 49507, 49480, 16697, 49458, 49455, 65535, 49457,
+    65535, 65535, 49462, 16693, 65535, 65535, 49464, 65535, 65535, 49473, 16702, 49469, 65535, 65535, 49472, 65535,
+    65535, 16709, 49476, 65535, 65535, 49479, 65535, 65535, 16724, 49489, 49486, 49485, 65535, 65535, 49488, 65535,
+    65535, 49491, 65535, 65535, 49500, 16729, 16728, 65535, 65535, 49499, 65535, 65535, 16736, 49503, 65535, 65535,
+    49506, 65535, 65535, 16741, 65535, 65535, 49586, 49559, 49542, 49529, 49522, 49519, 49518, 65535, 65535, 16753,
+    65535, 65535, 16758, 16757, 65535, 65535, 49528, 65535, 65535, 16769, 16766, 16765, 65535, 65535, 16768, 65535,
+    65535, 16771, 65535, 16773, 65535, 65535, 16784, 16783, 16780, 16779, 65535, 65535, 16782, 65535, 65535, 65535,
+    16786, 65535, 16788, 65535, 16790, 65535, 65535, 16795, 49562, 65535, 65535, 49577, 16804, 16801, 49568, 65535,
+    65535, 16803, 65535, 65535, 16806, 65535, 16808, 65535, 65535, 16811, 65535, 16815, 49582, 65535, 65535, 49585,
+    65535, 65535, 16836, 16821, 65535, 49601, 49598, 49595, 49594, 65535, 65535, 16829, 65535, 65535, 16832, 65535,
+    65535, 49603, 65535, 65535, 49636, 16853, 16846, 49611, 16842, 65535, 65535, 16845, 65535, 65535, 16850, 49617,
+    65535, 65535, 49620, 65535, 65535, 16861, 49626, 49625, 65535, 65535, 16860, 65535, 65535, 49633, 49632, 65535,
+    65535, 49635, 65535, 65535, 16884, 49645, 49642, 16873, 65535, 65535, 49644, 65535, 65535, 49649, 16880, 65535,
+    65535, 49651, 65535, 65535, 16892, 49657, 16888, 65535, 65535, 16891, 65535, 65535, 49664, 16895, 65535, 65535,
+    16898, 65535, 65535, 49769, 49728, 16929, 16914, 16911, 49676, 49675, 65535, 65535, 16910, 65535, 65535, 49681,
+    65535, 65535, 16922, 49687, 49686, 65535, 65535, 16921, 65535, 65535, 49694, 16925, 65535, 65535, 49696, 65535,
+    65535, 49713, 49706, 16935, 49702, 65535, 65535, 49705, 65535, 65535, 16942, 16941, 65535, 65535, 16944, 65535,
+    65535, 49721, 16950, 16949, 65535, 65535, 16952, 65535, 65535, 16957, 16956, 65535, 65535, 16959, 65535, 65535,
+    16986, 16977, 16970, 49735, 16966, 65535, 65535, 16969, 65535, 65535, 49742, 16973, 65535, 65535, 16976, 65535,
+    65535, 16981, 49748, 65535, 65535, 16983, 65535, 49753, 65535, 65535, 16996, 16993, 16990, 65535, 16992, 65535,
+    65535, 16995, 65535, 65535, 16998, 65535, 17000, 65535, 65535, 49803, 17028, 17013, 17010, 17009, 17008, 65535,
+    65535, 65535, 17012, 65535, 65535, 17021, 17018, 17017, 65535, 65535, 17020, 65535, 65535, 17025, 17024, 65535,
+    65535, 17027, 65535, 65535, 17030, 65535, 17034, 17033, 65535, 65535, 65535, 49819, 17046, 17045, 17042, 17041,
+    65535, 65535, 17044, 65535, 65535, 65535, 17048, 65535, 17050, 65535, 65535, 49835, 17060, 17057, 17056, 65535,
+    65535, 17059, 65535, 65535, 17064, 17063, 65535, 65535, 49834, 65535, 65535, 49843, 17072, 17071, 65535, 65535,
+    17074, 65535, 65535, 49847, 17078, 65535, 65535, 17081, 65535, 65535, 49912, 49889, 17108, 17101, 17094, 17091,
+    17090, 65535, 65535, 17093, 65535, 65535, 17098, 49865, 65535, 65535, 49868, 65535, 65535, 49875, 49872, 65535,
+    49874, 65535, 65535, 65535, 49878, 65535, 17116, 49883, 49882, 65535, 65535, 65535, 49886, 65535, 49888, 65535,
+    65535, 17131, 17124, 65535, 17130, 17129, 17128, 65535, 65535, 65535, 65535, 17133, 65535, 17139, 17138, 17137,
+    65535, 65535, 65535, 17141, 65535, 17143, 65535, 65535, 49932, 17149, 49916, 65535, 65535, 17151, 65535, 49925,
+    17154, 65535, 17156, 65535, 65535, 17161, 17160, 65535, 65535, 17163, 65535, 65535, 17168, 49935, 65535, 65535,
+    49946, 17171, 65535, 17175, 17174, 65535, 65535, 17177, 65535, 65535, 49954, 17183, 17182, 65535, 65535, 17185,
+    65535, 65535, 49958, 17189, 65535, 65535, 17192, 65535, 65535, 17299, 17256, 17227, 49980, 17205, 49970, 49969,
+    65535, 65535, 49972, 65535, 65535, 49977, 49976, 65535, 65535, 17211, 65535, 65535, 17220, 49985, 17216, 65535,
+    65535, 49987, 65535, 65535, 49992, 49991, 65535, 65535, 49994, 65535, 65535, 50009, 17234, 49999, 65535, 17233,
+    65535, 65535, 50006, 17237, 65535, 65535, 17240, 65535, 65535, 50017, 17246, 50013, 65535, 65535, 50016, 65535,
+    65535, 17253, 50020, 65535, 65535, 50023, 65535, 65535, 50054, 50041, 50034, 50031, 50030, 65535, 65535, 50033,
+    65535, 65535, 17270, 17269, 65535, 65535, 17272, 65535, 65535, 17279, 17276, 65535, 50046, 65535, 65535, 50051,
+    17282, 65535, 65535, 17285, 65535, 65535, 17290, 50057, 65535, 65535, 50066, 50063, 50062, 65535, 65535, 50065,
+    65535, 65535, 65535, 50081, 17302, 65535, 17312, 50079, 50076, 50075, 65535, 65535, 50078, 65535, 65535, 65535,
+    65535, 50111, 17330, 50091, 17320, 50087, 65535, 65535, 17322, 65535, 65535, 50095, 17326, 65535, 65535, 17329,
+    65535, 65535, 17336, 50101, 65535, 50103, 65535, 65535, 50108, 50107, 65535, 65535, 17342, 65535, 65535, 17353,
+    50116, 17347, 65535, 65535, 50120, 50119, 65535, 65535, 65535, 17361, 50126, 17357, 65535, 65535, 17360, 65535,
+    65535, 50133, 17364, 65535, 65535, 17367, 65535, 65535, 50216, 50171, 17396, 17387, 50148, 50145, 50144, 65535,
+    65535, 17379, 65535, 65535, 17384, 17383, 65535, 65535, 50154, 65535, 65535, 50163, 50160, 50159, 65535, 65535,
+    50162, 65535, 65535, 65535, 50168, 50167, 65535, 65535, 50170, 65535, 65535, 17431, 17420, 17413, 50178, 17409,
+    65535, 65535, 17412, 65535, 65535, 50185, 17416, 65535, 65535, 17419, 65535, 65535, 17424, 50191, 65535, 65535,
+    17428, 50195, 65535, 65535, 50198, 65535, 65535, 17443, 17440, 17437, 17436, 65535, 65535, 17439, 65535, 65535,
+    17442, 65535, 65535, 17445, 65535, 17447, 65535, 65535, 50250, 17475, 17460, 17457, 17456, 17455, 65535, 65535,
+    65535, 17459, 65535, 65535, 17468, 17465, 17464, 65535, 65535, 17467, 65535, 65535, 17472, 17471, 65535, 65535,
+    17474, 65535, 65535, 17477, 65535, 17481, 17480, 65535, 65535, 65535, 50270, 17493, 17492, 17489, 17488, 65535,
+    65535, 17491, 65535, 65535, 65535, 17497, 17496, 65535, 65535, 17501, 17500, 65535, 65535, 65535, 50286, 17511,
+    17508, 17507, 65535, 65535, 17510, 65535, 65535, 17515, 17514, 65535, 65535, 50285, 65535, 65535, 50294, 17523,
+    17522, 65535, 65535, 17525, 65535, 65535, 50298, 17529, 65535, 65535, 17532, 65535, 65535, 17537, 50304, 65535,
+    65535, 17543, 50310, 50309, 65535, 65535, 65535, 17557, 50322, 50315, 65535, 17551, 50318, 65535, 65535, 50321,
+    65535, 65535, 50324, 65535, 65535, 17565, 50328, 65535, 50332, 50331, 65535, 65535, 65535, 17571, 50336, 65535,
+    50338, 65535, 65535, 50343, 50342, 65535, 65535, 50345, 65535, 65535, 50454, 50397, 50380, 17597, 17590, 17587,
+    17586, 65535, 65535, 50357, 65535, 65535, 50362, 50361, 65535, 65535, 50364, 65535, 65535, 17605, 50370, 50369,
+    65535, 65535, 17604, 65535, 65535, 50377, 17608, 65535, 65535, 50379, 65535, 65535, 17620, 17619, 17616, 65535,
+    17618, 65535, 65535, 65535, 17622, 65535, 17626, 17625, 65535, 65535, 17628, 65535, 65535, 17657, 17642, 17639,
+    50404, 17635, 65535, 65535, 50406, 65535, 65535, 50409, 65535, 65535, 17650, 50415, 17646, 65535, 65535, 17649,
+    65535, 65535, 50422, 17653, 65535, 65535, 50424, 65535, 65535, 17671, 50432, 17661, 65535, 17663, 65535, 65535,
+    17668, 50435, 65535, 65535, 50438, 65535, 65535, 17679, 17676, 50443, 65535, 65535, 50446, 65535, 65535, 50451,
+    17682, 65535, 65535, 17685, 65535, 65535, 17694, 50457, 65535, 50461, 50460, 65535, 65535, 65535, 17726, 50479,
+    17704, 17701, 50468, 65535, 65535, 50471, 65535, 65535, 17708, 50475, 65535, 65535, 50478, 65535, 65535, 17719,
+    50484, 17715, 65535, 65535, 50486, 65535, 65535, 50491, 50490, 65535, 65535, 17725, 65535, 65535, 50510, 50503,
+    17732, 50499, 65535, 65535, 50502, 65535, 65535, 50507, 17738, 65535, 65535, 17741, 65535, 65535, 17750, 17747,
+    50514, 65535, 65535, 50517, 65535, 65535, 50520, 65535, 65535, 50585, 50560, 17779, 17770, 17765, 17762, 50529,
+    65535, 65535, 17764, 65535, 65535, 50535, 65535, 50537, 65535, 65535, 50546, 17775, 50542, 65535, 65535, 50545,
+    65535, 65535, 65535, 50551, 17782, 65535, 65535, 17787, 17786, 65535, 65535, 50557, 65535, 50559, 65535, 65535,
+    17802, 17795, 65535, 17801, 17800, 17799, 65535, 65535, 65535, 65535, 17804, 65535, 17810, 17809, 17808, 65535,
+    65535, 65535, 17814, 17813, 65535, 65535, 17816, 65535, 65535, 50609, 17822, 50589, 65535, 65535, 17830, 50597,
+    17828, 17827, 65535, 65535, 65535, 65535, 50604, 17833, 65535, 17835, 65535, 65535, 17838, 65535, 17840, 65535,
+    65535, 17845, 50612, 65535, 65535, 50623, 17848, 65535, 17852, 17851, 65535, 65535, 17854, 65535, 65535, 17859,
+    50626, 65535, 65535, 50631, 17862, 65535, 65535, 17865, 65535, 65535, 50744, 50691, 50666, 50653, 50646, 17875,
+    50642, 65535, 65535, 50645, 65535, 65535, 17882, 17881, 65535, 65535, 17884, 65535, 65535, 17893, 17890, 17889,
+    65535, 65535, 50660, 65535, 65535, 17895, 65535, 50665, 65535, 65535, 17910, 50673, 17904, 17903, 65535, 65535,
+    65535, 17909, 17908, 65535, 65535, 65535, 50684, 17913, 65535, 17915, 65535, 65535, 17920, 50687, 65535, 65535,
+    50690, 65535, 65535, 17951, 17938, 17931, 50698, 17929, 65535, 65535, 65535, 17935, 50702, 65535, 65535, 17937,
+    65535, 65535, 50712, 17941, 65535, 50711, 65535, 65535, 50716, 17947, 65535, 65535, 17950, 65535, 65535, 17965,
+    50726, 50725, 17956, 65535, 65535, 65535, 50730, 17961, 65535, 65535, 50732, 65535, 65535, 50737, 17968, 65535,
+    65535, 50741, 17972, 65535, 65535, 50743, 65535, 65535, 17998, 17979, 65535, 50753, 17984, 17983, 65535, 65535,
+    65535, 17991, 50758, 50757, 65535, 65535, 65535, 50763, 17994, 65535, 65535, 50765, 65535, 65535, 50778, 18007,
+    18006, 18003, 65535, 18005, 65535, 65535, 65535, 18009, 65535, 65535, 50792, 18017, 18016, 18015, 65535, 65535,
+    65535, 18021, 50788, 65535, 65535, 50791, 65535, 65535, 50800, 18029, 18028, 65535, 65535, 18031, 65535, 65535,
+    50804, 18035, 65535, 65535, 18038, 65535, 65535, 18145, 18094, 18071, 18056, 18051, 50816, 18047, 65535, 65535,
+    18050, 65535, 65535, 50821, 65535, 50823, 65535, 65535, 50832, 18061, 50828, 65535, 65535, 50831, 65535, 65535,
+    50836, 18067, 65535, 65535, 50838, 65535, 65535, 50853, 50848, 50845, 50844, 65535, 65535, 18079, 65535, 65535,
+    18082, 65535, 50852, 65535, 65535, 18087, 65535, 50859, 50858, 65535, 65535, 50861, 65535, 65535, 50886, 18109,
+    50872, 50869, 18100, 65535, 65535, 18103, 65535, 65535, 18106, 65535, 50876, 65535, 65535, 50879, 65535, 50883,
+    18114, 65535, 65535, 50885, 65535, 65535, 18130, 18123, 50890, 65535, 65535, 50895, 50894, 65535, 65535, 50897,
+    65535, 65535, 18138, 50903, 18134, 65535, 65535, 18137, 65535, 65535, 50910, 50909, 65535, 65535, 18144, 65535,
+    65535, 50929, 50916, 65535, 50924, 50923, 50920, 65535, 50922, 65535, 65535, 65535, 50926, 65535, 50928, 65535,
+    65535, 50935, 50932, 65535, 50934, 65535, 65535, 65535, 18188, 50953, 18182, 50949, 50948, 18177, 50944, 65535,
+    65535, 50947, 65535, 65535, 65535, 65535, 50952, 65535, 65535, 50955, 65535, 65535, 18196, 50959, 65535, 50963,
+    50962, 65535, 65535, 65535, 18226, 50981, 18206, 50971, 50970, 65535, 65535, 18205, 65535, 65535, 50978, 50977,
+    65535, 65535, 50980, 65535, 65535, 18219, 50986, 50985, 65535, 65535, 65535, 50991, 18222, 65535, 65535, 18225,
+    65535, 65535, 18242, 51003, 18232, 50999, 65535, 65535, 51002, 65535, 65535, 18239, 51006, 65535, 65535, 18241,
+    65535, 65535, 51018, 18247, 51014, 65535, 65535, 18249, 65535, 65535, 18254, 18253, 65535, 65535, 51024, 65535,
+    65535, 51133, 51076, 51059, 51044, 51037, 51034, 51033, 65535, 65535, 18268, 65535, 65535, 18273, 18272, 65535,
+    65535, 18275, 65535, 65535, 18284, 51049, 18280, 65535, 65535, 18283, 65535, 65535, 18288, 51055, 65535, 65535,
+    51058, 65535, 65535, 18299, 18298, 18295, 65535, 18297, 65535, 65535, 65535, 18301, 65535, 18305, 18304, 65535,
+    65535, 18307, 65535, 65535, 18336, 18323, 18318, 18315, 18314, 65535, 65535, 18317, 65535, 65535, 51090, 18321,
+    65535, 65535, 65535, 18329, 51094, 65535, 18328, 65535, 65535, 51101, 18332, 65535, 65535, 51103, 65535, 65535,
+    18350, 51111, 18340, 65535, 18342, 65535, 65535, 18347, 51114, 65535, 65535, 51117, 65535, 65535, 18358, 18355,
+    51122, 65535, 65535, 51125, 65535, 65535, 51130, 51129, 65535, 65535, 18364, 65535, 65535, 18373, 51136, 65535,
+    51140, 51139, 65535, 65535, 65535, 18403, 18390, 18383, 51148, 18379, 65535, 65535, 51150, 65535, 65535, 51155,
+    51154, 65535, 65535, 51157, 65535, 65535, 51164, 51161, 65535, 51163, 65535, 65535, 51168, 51167, 65535, 65535,
+    51170, 65535, 65535, 51175, 18406, 65535, 65535, 51179, 18410, 65535, 65535, 51183, 51182, 65535, 65535, 51185,
+    65535, 65535, 18516, 18479, 18452, 18437, 18430, 18427, 18426, 65535, 65535, 51197, 65535, 65535, 51202, 51201,
+    65535, 65535, 18436, 65535, 65535, 51213, 51210, 18441, 65535, 65535, 18444, 65535, 65535, 18449, 51216, 65535,
+    65535, 51219, 65535, 65535, 51234, 18459, 51226, 51225, 65535, 65535, 65535, 51231, 51230, 65535, 65535, 18465,
+    65535, 65535, 18472, 18469, 65535, 51239, 65535, 65535, 51244, 18475, 65535, 65535, 18478, 65535, 65535, 51275,
+    18494, 51255, 51252, 65535, 51254, 65535, 65535, 51259, 51258, 65535, 65535, 51261, 65535, 65535, 51270, 51267,
+    18498, 65535, 65535, 51269, 65535, 65535, 51274, 51273, 65535, 65535, 65535, 51283, 18512, 51279, 65535, 65535,
+    51282, 65535, 65535, 65535, 51332, 51315, 18532, 18525, 51292, 51291, 65535, 65535, 65535, 51297, 51296, 65535,
+    65535, 51299, 65535, 65535, 51308, 18537, 51304, 65535, 65535, 51307, 65535, 65535, 18544, 51311, 65535, 65535,
+    51314, 65535, 65535, 18563, 18556, 51321, 51320, 65535, 65535, 51323, 65535, 65535, 51328, 18559, 65535, 65535,
+    51330, 65535, 65535, 65535, 18566, 65535, 65535, 51431, 51380, 51367, 51354, 51347, 18576, 51343, 65535, 65535,
+    18578, 65535, 65535, 18583, 18582, 65535, 65535, 18585, 65535, 65535, 18594, 18591, 18590, 65535, 65535, 51361,
+    65535, 65535, 18596, 65535, 18598, 65535, 65535, 18601, 65535, 18607, 18606, 18605, 65535, 65535, 65535, 18609,
+    65535, 18611, 65535, 65535, 18640, 18625, 18620, 18617, 65535, 18619, 65535, 65535, 51390, 65535, 51392, 65535,
+    65535, 18633, 51398, 18629, 65535, 65535, 51400, 65535, 65535, 51405, 18636, 65535, 65535, 18639, 65535, 65535,
+    51416, 18647, 18644, 65535, 18646, 65535, 65535, 65535, 18656, 18653, 18652, 65535, 65535, 51423, 65535, 65535,
+    18660, 51427, 65535, 65535, 18662, 65535, 65535, 18713, 18696, 51449, 18674, 18671, 51438, 65535, 65535, 51441,
+    65535, 65535, 18678, 51445, 65535, 65535, 51448, 65535, 65535, 51457, 18686, 18685, 65535, 65535, 51456, 65535,
+    65535, 51461, 18692, 65535, 65535, 18695, 65535, 65535, 51470, 18701, 18700, 65535, 65535, 65535, 51476, 18707,
+    51474, 65535, 65535, 65535, 51478, 65535, 51480, 65535, 65535, 51485, 51484, 65535, 65535, 51489, 51488, 65535,
+    65535, 18723, 65535, 65535, 18812, 18769, 51518, 18743, 51504, 18733, 51500, 65535, 65535, 51503, 65535, 65535,
+    18740, 51507, 65535, 65535, 51510, 65535, 65535, 51513, 65535, 51515, 65535, 51517, 65535, 65535, 18762, 51523,
+    18754, 65535, 65535, 51527, 18758, 65535, 65535, 51529, 65535, 65535, 51532, 65535, 51536, 51535, 65535, 65535,
+    65535, 51557, 51552, 18777, 51542, 65535, 51544, 65535, 65535, 51549, 51548, 65535, 65535, 51551, 65535, 65535,
+    18786, 65535, 18788, 65535, 65535, 18797, 51560, 65535, 51564, 51563, 65535, 65535, 65535, 51573, 18802, 51569,
+    65535, 65535, 18804, 65535, 65535, 18809, 51576, 65535, 65535, 51579, 65535, 65535, 51634, 51609, 51598, 51591,
+    51588, 51587, 65535, 65535, 18822, 65535, 65535, 18827, 18826, 65535, 65535, 18829, 65535, 65535, 18836, 18835,
+    18834, 65535, 65535, 65535, 18838, 65535, 18840, 65535, 65535, 18853, 18848, 18847, 51614, 65535, 65535, 65535,
+    51620, 51619, 65535, 65535, 65535, 18859, 51624, 65535, 51626, 65535, 65535, 18863, 51630, 65535, 65535, 18865,
+    65535, 65535, 51658, 18879, 18876, 18873, 18872, 65535, 65535, 18875, 65535, 65535, 18878, 65535, 65535, 18883,
+    18882, 65535, 65535, 51655, 18886, 65535, 65535, 18889, 65535, 65535, 51670, 18897, 18894, 65535, 18896, 65535,
+    65535, 18899, 65535, 18901, 65535, 65535, 51678, 18907, 18906, 65535, 65535, 18909, 65535, 65535, 51682, 18913,
+    65535, 65535, 51684, 65535, 65535, 18943, 51710, 18939, 51698, 18929, 18926, 51693, 65535, 65535, 51696, 65535,
+    65535, 65535, 51702, 51701, 65535, 65535, 18936, 65535, 51706, 65535, 65535, 51709, 65535, 65535, 65535, 18957,
+    51714, 65535, 51724, 51721, 18952, 51719, 65535, 65535, 65535, 18955, 65535, 65535, 65535, 18973, 51728, 65535,
+    18968, 51733, 18964, 65535, 65535, 51735, 65535, 65535, 51738, 65535, 51740, 65535, 65535, 18981, 51744, 65535,
+    51746, 65535, 51748, 65535, 65535, 51757, 18986, 51753, 65535, 65535, 18988, 65535, 65535, 51761, 18992, 65535,
+    65535, 51763, 65535, 65535, 51852, 51821, 51798, 51783, 51776, 51773, 51772, 65535, 65535, 19007, 65535, 65535,
+    19012, 19011, 65535, 65535, 19014, 65535, 65535, 19023, 19020, 19019, 65535, 65535, 19022, 65535, 65535, 19027,
+    51794, 65535, 65535, 19029, 65535, 65535, 19040, 19039, 19036, 19035, 65535, 65535, 51806, 65535, 65535, 65535,
+    19046, 51811, 65535, 51813, 65535, 65535, 51818, 19049, 65535, 65535, 19052, 65535, 65535, 19083, 19068, 51829,
+    19060, 19059, 65535, 65535, 65535, 19065, 19064, 65535, 65535, 51835, 65535, 65535, 19076, 51841, 19072, 65535,
+    65535, 19075, 65535, 65535, 19080, 51847, 65535, 65535, 51850, 65535, 65535, 65535, 19090, 51855, 65535, 19089,
+    65535, 65535, 19114, 19103, 19096, 51863, 65535, 65535, 19100, 19099, 65535, 65535, 19102, 65535, 65535, 19109,
+    19108, 51875, 65535, 65535, 65535, 19113, 51880, 65535, 65535, 65535, 51890, 19117, 65535, 19119, 65535, 19121,
+    65535, 65535, 19124, 65535, 65535, 19233, 19190, 19159, 19144, 19137, 19134, 19133, 65535, 65535, 51904, 65535,
+    65535, 51909, 51908, 65535, 65535, 51911, 65535, 65535, 51920, 51917, 19148, 65535, 65535, 19151, 65535, 65535,
+    19156, 19155, 65535, 65535, 51926, 65535, 65535, 51943, 19168, 51933, 19164, 65535, 65535, 19167, 65535, 65535,
+    19172, 51939, 65535, 65535, 51942, 65535, 65535, 19183, 51948, 19179, 65535, 65535, 51950, 65535, 65535, 51955,
+    19186, 65535, 65535, 51957, 65535, 65535, 51972, 51965, 19194, 65535, 51964, 65535, 65535, 51967, 65535, 19201,
+    65535, 19203, 65535, 65535, 51986, 19211, 51978, 51977, 65535, 65535, 65535, 51983, 19214, 65535, 65535, 51985,
+    65535, 65535, 19226, 51991, 19222, 65535, 65535, 51993, 65535, 65535, 51998, 19229, 65535, 65535, 19232, 65535,
+    65535, 52017, 52004, 65535, 52012, 52011, 52008, 65535, 52010, 65535, 65535, 65535, 52014, 65535, 52016, 65535,
+    65535, 52023, 52020, 65535, 52022, 65535, 65535, 65535, 19352, 19307, 19288, 19275, 19268, 52033, 19264, 65535,
+    65535, 52035, 65535, 65535, 52040, 19271, 65535, 65535, 52042, 65535, 65535, 52051, 52048, 52047, 65535, 65535,
+    19282, 65535, 65535, 19285, 65535, 19287, 65535, 65535, 52060, 52059, 65535, 65535, 52068, 52065, 52064, 65535,
+    65535, 52067, 65535, 65535, 52072, 52071, 65535, 65535, 52074, 65535, 65535, 19325, 52086, 52079, 65535, 52083,
+    52082, 65535, 65535, 52085, 65535, 65535, 52088, 65535, 52092, 52091, 65535, 65535, 65535, 52109, 52102, 19331,
+    52098, 65535, 65535, 52101, 65535, 65535, 52106, 19337, 65535, 65535, 19340, 65535, 65535, 19347, 19344, 65535,
+    19346, 65535, 65535, 52119, 19350, 65535, 65535, 65535, 52164, 52149, 19368, 19361, 52128, 52127, 65535, 65535,
+    65535, 52133, 52132, 65535, 65535, 52135, 65535, 65535, 52144, 19373, 52140, 65535, 65535, 52143, 65535, 65535,
+    19380, 52147, 65535, 65535, 65535, 19395, 19388, 52153, 65535, 52155, 65535, 65535, 52160, 19391, 65535, 65535,
+    52162, 65535, 65535, 65535, 65535, 52235, 52208, 19427, 19416, 19409, 19406, 19405, 65535, 65535, 52176, 65535,
+    65535, 19413, 52180, 65535, 65535, 52183, 65535, 65535, 19422, 52189, 52188, 65535, 65535, 65535, 52192, 65535,
+    52194, 65535, 65535, 52199, 19430, 65535, 65535, 19435, 19434, 65535, 65535, 52205, 65535, 52207, 65535, 65535,
+    19452, 19449, 19448, 19445, 65535, 19447, 65535, 65535, 65535, 19451, 65535, 65535, 19454, 65535, 19460, 19459,
+    19458, 65535, 65535, 65535, 19464, 19463, 65535, 65535, 19466, 65535, 65535, 52267, 19480, 19477, 19476, 19475,
+    19474, 65535, 65535, 65535, 65535, 19479, 65535, 65535, 19484, 19483, 65535, 65535, 19492, 19489, 19488, 65535,
+    65535, 19491, 65535, 65535, 19496, 19495, 65535, 65535, 19498, 65535, 65535, 19507, 52274, 52273, 19504, 65535,
+    65535, 65535, 65535, 52289, 19514, 52279, 65535, 52281, 65535, 65535, 19518, 52285, 65535, 65535, 19520, 65535,
+    65535, 19525, 52292, 65535, 65535, 52297, 19528, 65535, 65535, 19531, 65535, 65535, 52366, 52349, 19560, 19551,
+    19544, 52309, 19540, 65535, 65535, 19543, 65535, 65535, 52316, 52315, 65535, 65535, 19550, 65535, 65535, 52327,
+    52324, 19555, 65535, 65535, 52326, 65535, 65535, 65535, 52344, 52337, 19566, 52333, 65535, 65535, 52336, 65535,
+    65535, 19573, 19572, 65535, 65535, 19575, 65535, 65535, 19578, 65535, 19580, 65535, 65535, 19595, 19590, 19589,
+    19586, 65535, 19588, 65535, 65535, 65535, 19594, 19593, 65535, 65535, 65535, 19597, 65535, 65535, 19600, 65535,
+    19610, 52377, 52376, 52373, 65535, 52375, 65535, 65535, 65535, 65535, 19616, 52381, 65535, 52383, 65535, 65535,
+    52390, 19619, 65535, 19621, 65535, 65535, 52394, 19625, 65535, 65535, 19628, 65535, 65535, 19693, 52458, 19661,
+    52416, 19641, 52406, 19637, 65535, 65535, 52408, 65535, 65535, 52413, 19644, 65535, 65535, 52415, 65535, 65535,
+    19656, 52421, 19652, 65535, 65535, 52423, 65535, 65535, 52426, 65535, 52428, 65535, 65535, 52443, 19668, 52433,
+    65535, 52435, 65535, 65535, 52440, 19671, 65535, 65535, 52442, 65535, 65535, 19683, 52448, 19679, 65535, 65535,
+    19682, 65535, 65535, 52455, 19686, 65535, 65535, 52457, 65535, 65535, 19692, 65535, 65535, 19719, 52470, 52465,
+    65535, 52467, 65535, 52469, 65535, 65535, 52472, 65535, 52480, 52477, 52476, 65535, 65535, 52479, 65535, 65535,
+    52484, 52483, 65535, 65535, 52486, 65535, 65535, 19737, 52496, 52495, 52494, 52493, 65535, 65535, 65535, 65535,
+    52500, 52499, 65535, 65535, 52504, 52503, 65535, 65535, 65535, 19753, 52514, 19743, 52510, 65535, 65535, 52513,
+    65535, 65535, 19750, 52517, 65535, 65535, 19752, 65535, 65535, 19759, 52526, 52525, 65535, 65535, 65535, 52531,
+    52530, 65535, 65535, 52533, 65535, 65535, 19786, 52551, 19780, 52547, 52546, 52543, 19774, 65535, 65535, 19777,
+    65535, 65535, 65535, 65535, 52550, 65535, 65535, 52553, 65535, 65535, 19794, 52557, 65535, 52559, 65535, 52561,
+    65535, 65535, 19806, 52565, 65535, 52567, 65535, 52571, 19802, 65535, 65535, 19805, 65535, 65535, 19822, 52583,
+    19812, 52579, 65535, 65535, 52582, 65535, 65535, 52587, 19818, 65535, 65535, 19821, 65535, 65535, 19830, 52595,
+    19826, 65535, 65535, 52597, 65535, 65535, 52602, 52601, 65535, 65535, 19836, 65535, 65535, 52693, 52668, 19871,
+    52624, 52617, 19846, 52613, 65535, 65535, 19848, 65535, 65535, 19853, 19852, 65535, 65535, 19855, 65535, 65535,
+    19864, 19861, 19860, 65535, 65535, 19863, 65535, 65535, 19868, 52635, 65535, 65535, 19870, 65535, 65535, 19885,
+    52648, 19877, 52644, 65535, 65535, 52647, 65535, 65535, 52650, 65535, 52652, 65535, 65535, 52661, 19890, 52657,
+    65535, 65535, 19892, 65535, 65535, 52665, 19896, 65535, 65535, 52667, 65535, 65535, 19910, 52671, 65535, 19909,
+    52674, 65535, 19908, 65535, 65535, 65535, 19912, 65535, 19918, 52683, 65535, 19917, 65535, 65535, 19922, 52689,
+    65535, 65535, 19924, 65535, 65535, 52717, 19938, 19937, 19930, 65535, 19934, 52701, 65535, 65535, 19936, 65535,
+    65535, 65535, 19940, 65535, 19942, 65535, 19946, 19945, 65535, 65535, 19948, 65535, 65535, 19967, 52726, 52721,
+    65535, 19955, 65535, 52725, 65535, 65535, 52734, 52731, 52730, 65535, 65535, 52733, 65535, 65535, 65535, 19981,
+    19974, 52739, 65535, 52741, 65535, 65535, 52746, 19977, 65535, 65535, 19980, 65535, 65535, 19989, 52754, 52753,
+    65535, 65535, 52756, 65535, 65535, 52761, 52760, 65535, 65535, 19995, 65535, 65535, 52840, 52823, 52792, 52783,
+    20008, 20005, 52772, 65535, 65535, 20007, 65535, 65535, 20012, 52779, 65535, 65535, 52782, 65535, 65535, 20017,
+    65535, 20021, 20020, 65535, 65535, 20023, 65535, 65535, 20040, 52801, 20030, 20029, 65535, 65535, 20032, 65535,
+    65535, 20037, 20036, 65535, 65535, 20039, 65535, 65535, 20048, 52813, 20044, 65535, 65535, 52815, 65535, 65535,
+    52820, 20051, 65535, 65535, 20054, 65535, 65535, 20057, 65535, 20065, 20064, 20061, 65535, 20063, 65535, 65535,
+    65535, 20067, 65535, 20069, 65535, 20071, 65535, 65535, 20122, 52865, 20086, 20081, 52846, 65535, 52848, 65535,
+    65535, 52851, 65535, 20085, 65535, 65535, 20092, 52859, 52858, 65535, 65535, 65535, 52862, 65535, 20096, 65535,
+    65535, 20107, 52874, 20103, 52870, 65535, 65535, 52873, 65535, 65535, 65535, 52883, 20112, 20111, 65535, 65535,
+    20114, 65535, 65535, 52887, 20118, 65535, 65535, 52889, 65535, 65535, 20146, 20139, 20132, 52897, 52896, 65535,
+    65535, 52899, 65535, 65535, 52904, 52903, 65535, 65535, 52906, 65535, 65535, 52909, 65535, 52913, 52912, 65535,
+    65535, 65535, 52930, 20155, 52920, 20151, 65535, 65535, 52922, 65535, 65535, 52927, 52926, 65535, 65535, 52929,
+    65535, 65535, 52938, 20167, 52934, 65535, 65535, 52937, 65535, 65535, 20174, 52941, 65535, 65535, 20176, 65535,
+    65535, 20203, 52970, 20199, 52958, 20189, 20186, 52953, 65535, 65535, 52956, 65535, 65535, 65535, 52962, 52961,
+    65535, 65535, 20196, 65535, 52966, 65535, 65535, 52969, 65535, 65535, 65535, 20215, 52982, 52981, 52976, 65535,
+    52980, 20211, 65535, 65535, 65535, 65535, 65535, 20223, 52986, 65535, 52990, 52989, 65535, 65535, 65535, 20229,
+    52994, 65535, 52996, 65535, 65535, 20235, 53000, 65535, 53002, 65535, 65535, 20239, 53006, 65535, 65535, 20241,
+    65535, 65535, 20316, 20293, 20274, 53029, 20254, 53019, 20250, 65535, 65535, 20253, 65535, 65535, 53026, 53025,
+    65535, 65535, 20260, 65535, 65535, 53035, 20264, 65535, 20266, 65535, 65535, 20271, 53038, 65535, 65535, 53041,
+    65535, 65535, 53052, 53051, 53048, 53047, 65535, 65535, 53050, 65535, 65535, 65535, 53054, 65535, 53058, 53057,
+    65535, 65535, 53060, 65535, 65535, 53071, 53070, 20301, 53066, 65535, 53068, 65535, 65535, 65535, 65535, 53073,
+    65535, 53077, 53076, 65535, 65535, 53081, 20312, 65535, 65535, 53083, 65535, 65535, 20344, 53101, 20326, 53091,
+    53090, 65535, 65535, 53093, 65535, 65535, 20330, 53097, 65535, 65535, 53100, 65535, 65535, 53111, 53110, 53107,
+    53106, 65535, 65535, 53109, 65535, 65535, 65535, 65535, 53138, 20355, 53116, 65535, 20352, 20351, 65535, 65535,
+    20354, 65535, 65535, 20363, 53128, 53127, 65535, 65535, 20362, 65535, 65535, 53135, 20366, 65535, 65535, 20369,
+    65535, 65535, 53154, 20379, 20376, 20375, 65535, 65535, 20378, 65535, 65535, 20383, 20382, 65535, 65535, 20385,
+    65535, 65535, 20394, 53159, 53158, 65535, 65535, 53161, 65535, 65535, 53166, 20397, 65535, 65535, 53168, 65535,
+    65535, 53249, 53230, 53199, 53188, 53181, 53178, 53177, 65535, 65535, 20412, 65535, 65535, 20417, 20416, 65535,
+    65535, 20419, 65535, 65535, 20426, 20423, 65535, 20425, 65535, 65535, 20428, 65535, 20430, 65535, 65535, 20447,
+    53208, 20437, 20436, 65535, 65535, 20439, 65535, 65535, 20444, 20443, 65535, 65535, 20446, 65535, 65535, 20455,
+    53220, 20451, 65535, 65535, 53222, 65535, 65535, 53227, 20458, 65535, 65535, 53229, 65535, 65535, 20464, 65535,
+    20474, 20471, 20468, 65535, 20470, 65535, 65535, 20473, 65535, 65535, 20476, 65535, 20478, 65535, 20480, 65535,
+    65535, 20529, 53268, 20495, 20490, 53255, 65535, 53257, 65535, 65535, 53260, 65535, 20494, 65535, 65535, 53267,
+    53266, 65535, 65535, 65535, 53282, 20509, 20506, 53273, 65535, 65535, 53276, 65535, 65535, 53281, 20512, 65535,
+    65535, 65535, 53290, 20519, 20518, 65535, 65535, 20521, 65535, 65535, 20526, 53293, 65535, 65535, 53296, 65535,
+    65535, 53327, 53312, 20537, 20534, 65535, 53304, 65535, 65535, 20541, 20540, 65535, 65535, 53311, 65535, 65535,
+    20552, 53317, 20548, 65535, 65535, 53319, 65535, 65535, 53324, 53323, 65535, 65535, 53326, 65535, 65535, 20573,
+    53336, 53333, 20564, 65535, 65535, 53335, 65535, 65535, 20570, 65535, 53340, 65535, 65535, 53349, 20578, 53345,
+    65535, 65535, 20580, 65535, 65535, 53353, 20584, 65535, 65535, 53355, 65535, 65535, 20662, 20639, 20620, 20607,
+    53368, 20597, 53364, 65535, 65535, 53367, 65535, 65535, 53372, 20603, 65535, 65535, 20606, 65535, 65535, 53381,
+    53380, 53379, 65535, 65535, 65535, 53385, 20616, 65535, 65535, 53387, 65535, 65535, 53398, 53397, 53394, 53393,
+    65535, 65535, 53396, 65535, 65535, 65535, 53400, 65535, 53404, 53403, 65535, 65535, 53406, 65535, 65535, 53417,
+    53416, 20647, 53412, 65535, 53414, 65535, 65535, 65535, 65535, 53421, 53420, 65535, 65535, 53425, 53424, 65535,
+    65535, 53427, 65535, 53429, 65535, 65535, 20704, 53453, 20674, 53437, 53436, 65535, 65535, 53439, 65535, 53441,
+    65535, 65535, 53448, 53447, 20678, 65535, 65535, 65535, 53452, 20683, 65535, 65535, 65535, 53469, 53462, 53459,
+    53458, 65535, 65535, 53461, 65535, 65535, 20698, 53465, 65535, 65535, 53468, 65535, 65535, 53471, 65535, 65535,
+    53496, 20715, 53476, 65535, 20712, 20711, 65535, 65535, 20714, 65535, 65535, 20721, 53486, 65535, 53488, 65535,
+    65535, 53493, 20724, 65535, 65535, 53495, 65535, 65535, 53512, 20737, 20734, 20733, 65535, 65535, 20736, 65535,
+    65535, 20741, 20740, 65535, 65535, 20743, 65535, 65535, 53520, 53517, 53516, 65535, 65535, 20751, 65535, 65535,
+    20756, 53523, 65535, 65535, 65535, 53641, 53586, 53555, 53544, 53537, 53534, 53533, 65535, 65535, 20768, 65535,
+    65535, 20773, 20772, 65535, 65535, 20775, 65535, 65535, 20782, 20781, 20780, 65535, 65535, 65535, 20784, 65535,
+    20786, 65535, 65535, 20803, 53564, 20793, 20792, 65535, 65535, 20795, 65535, 65535, 20800, 20799, 65535, 65535,
+    20802, 65535, 65535, 53579, 20808, 20807, 65535, 65535, 20810, 65535, 65535, 20815, 53582, 65535, 65535, 53585,
+    65535, 65535, 20844, 20831, 20826, 20823, 65535, 20825, 65535, 65535, 53596, 65535, 53598, 65535, 65535, 20837,
+    20834, 65535, 53604, 65535, 65535, 53609, 20840, 65535, 65535, 20843, 65535, 65535, 53626, 20851, 20848, 65535,
+    20850, 65535, 65535, 20855, 20854, 65535, 65535, 20857, 65535, 65535, 20866, 20863, 53630, 65535, 65535, 20865,
+    65535, 65535, 20870, 20869, 65535, 65535, 20872, 65535, 65535, 20885, 53646, 20877, 65535, 65535, 53648, 65535,
+    53652, 53651, 65535, 65535, 65535, 20911, 53668, 20893, 53658, 65535, 53660, 65535, 65535, 53665, 53664, 65535,
+    65535, 53667, 65535, 65535, 20904, 53671, 65535, 65535, 20908, 53675, 65535, 65535, 53678, 65535, 65535, 20925,
+    53686, 53683, 65535, 20917, 65535, 65535, 53690, 53689, 65535, 65535, 20924, 65535, 65535, 53701, 53698, 53697,
+    65535, 65535, 20932, 65535, 65535, 20937, 20936, 65535, 65535, 53707, 65535, 65535, 20966, 53733, 20962, 53721,
+    20952, 20949, 53716, 65535, 65535, 53719, 65535, 65535, 65535, 53725, 53724, 65535, 65535, 20959, 65535, 53729,
+    65535, 65535, 53732, 65535, 65535, 65535, 20978, 53745, 53744, 53739, 65535, 53743, 20974, 65535, 65535, 65535,
+    65535, 65535, 20986, 53749, 65535, 53753, 53752, 65535, 65535, 65535, 20994, 53757, 65535, 53761, 53760, 65535,
+    65535, 65535, 21000, 53765, 65535, 53767, 65535, 65535, 53772, 53771, 65535, 65535, 21006, 65535, 65535, 21093,
+    21058, 21039, 21026, 21019, 21016, 21015, 65535, 65535, 53786, 65535, 65535, 53791, 53790, 65535, 65535, 53793,
+    65535, 65535, 53802, 53799, 53798, 65535, 65535, 53801, 65535, 65535, 21038, 53805, 65535, 65535, 65535, 53811,
+    21042, 65535, 65535, 53819, 21048, 53815, 65535, 65535, 53818, 65535, 65535, 21055, 53822, 65535, 65535, 53825,
+    65535, 65535, 53852, 21069, 53830, 65535, 53834, 53833, 65535, 65535, 53836, 65535, 65535, 53845, 53842, 21073,
+    65535, 65535, 53844, 65535, 65535, 53849, 53848, 65535, 65535, 21083, 65535, 65535, 53860, 21089, 53856, 65535,
+    65535, 53859, 65535, 65535, 65535, 53899, 21108, 53875, 53870, 53869, 53868, 65535, 65535, 65535, 53874, 53873,
+    65535, 65535, 65535, 65535, 53890, 21115, 53880, 65535, 53882, 65535, 65535, 53887, 53886, 65535, 65535, 53889,
+    65535, 65535, 21128, 53895, 53894, 65535, 65535, 65535, 53898, 65535, 65535, 53901, 65535, 21135, 65535, 65535,
+    21212, 53957, 53934, 53923, 21148, 21145, 21144, 65535, 65535, 53915, 65535, 65535, 53920, 21151, 65535, 65535,
+    21154, 65535, 65535, 21161, 21160, 21159, 65535, 65535, 65535, 21163, 65535, 21165, 65535, 65535, 21176, 21175,
+    53940, 21171, 65535, 65535, 21174, 65535, 65535, 65535, 21182, 21181, 53948, 65535, 65535, 65535, 21186, 53953,
+    65535, 65535, 53956, 65535, 65535, 21191, 65535, 21199, 53966, 53965, 53964, 65535, 65535, 65535, 65535, 21205,
+    53970, 65535, 53972, 65535, 65535, 21209, 53976, 65535, 65535, 53979, 65535, 65535, 53996, 53983, 65535, 53991,
+    53990, 53987, 65535, 53989, 65535, 65535, 65535, 53993, 65535, 53995, 65535, 65535, 54002, 53999, 65535, 54001,
+    65535, 65535, 65535, 21261, 54028, 21257, 54016, 21247, 21244, 54011, 65535, 65535, 54014, 65535, 65535, 65535,
+    54020, 54019, 65535, 65535, 21254, 65535, 54024, 65535, 65535, 54027, 65535, 65535, 65535, 21277, 54044, 54043,
+    54038, 21269, 54036, 65535, 65535, 65535, 21272, 65535, 54042, 65535, 65535, 65535, 65535, 21283, 54048, 65535,
+    54050, 65535, 65535, 21291, 54054, 65535, 54056, 65535, 54058, 65535, 65535, 21297, 54062, 65535, 54064, 65535,
+    65535, 54069, 21300, 65535, 65535, 54071, 65535, 65535, 21372, 21339, 21328, 54085, 21316, 21313, 54080, 65535,
+    65535, 54083, 65535, 65535, 65535, 54089, 21320, 65535, 65535, 54093, 21324, 65535, 65535, 21327, 65535, 65535,
+    54098, 65535, 54100, 65535, 54104, 54103, 65535, 65535, 54106, 65535, 65535, 54117, 54116, 54115, 54114, 54113,
+    65535, 65535, 65535, 65535, 65535, 54127, 54124, 21353, 65535, 54123, 65535, 65535, 54126, 65535, 65535, 54135,
+    54132, 54131, 65535, 65535, 21366, 65535, 65535, 54137, 65535, 54139, 65535, 65535, 54200, 21401, 54156, 54149,
+    54146, 65535, 54148, 65535, 65535, 54153, 54152, 65535, 65535, 54155, 65535, 65535, 21394, 54159, 65535, 54161,
+    65535, 65535, 21398, 54165, 65535, 65535, 54168, 65535, 65535, 54185, 21410, 54175, 21406, 65535, 65535, 21409,
+    65535, 65535, 54182, 21413, 65535, 65535, 21416, 65535, 65535, 54193, 21422, 54189, 65535, 65535, 54192, 65535,
+    65535, 54197, 54196, 65535, 65535, 21431, 65535, 65535, 21446, 54205, 21436, 65535, 65535, 21441, 54208, 65535,
+    65535, 54211, 65535, 54213, 65535, 65535, 21462, 54223, 21452, 21451, 65535, 65535, 21454, 65535, 65535, 21459,
+    21458, 65535, 65535, 21461, 65535, 65535, 54234, 21465, 65535, 65535, 65535, 21487, 54252, 21483, 54250, 21479,
+    54244, 21475, 65535, 65535, 54246, 65535, 65535, 54249, 65535, 65535, 65535, 65535, 54254, 65535, 65535, 21501,
+    54268, 54259, 65535, 21495, 54262, 65535, 65535, 54265, 65535, 54267, 65535, 65535, 65535, 21507, 54272, 65535,
+    54274, 65535, 65535, 21513, 54278, 65535, 54280, 65535, 65535, 21519, 54286, 54285, 65535, 65535, 65535, 21523,
+    54290, 65535, 65535, 21525, 65535, 65535, 54368, 54335, 54320, 54313, 54306, 54303, 54302, 65535, 65535, 21537,
+    65535, 65535, 21542, 21541, 65535, 65535, 21544, 65535, 65535, 21551, 21548, 65535, 21550, 65535, 65535, 65535,
+    21566, 21559, 21558, 21557, 65535, 65535, 65535, 21563, 21562, 65535, 65535, 21565, 65535, 65535, 65535, 21597,
+    21582, 54345, 21574, 54341, 65535, 65535, 54344, 65535, 65535, 21581, 21580, 65535, 65535, 65535, 21590, 54355,
+    21586, 65535, 65535, 21589, 65535, 65535, 21594, 54361, 65535, 65535, 54364, 65535, 65535, 54367, 65535, 65535,
+    21658, 21629, 54382, 21609, 21608, 21607, 65535, 65535, 65535, 21611, 65535, 21613, 65535, 65535, 54390, 21619,
+    21618, 65535, 65535, 54389, 65535, 65535, 21626, 21625, 65535, 65535, 54396, 65535, 65535, 54413, 21638, 21635,
+    54402, 65535, 65535, 54405, 65535, 65535, 54410, 21641, 65535, 65535, 21644, 65535, 65535, 21653, 54418, 21649,
+    65535, 65535, 54420, 65535, 65535, 54425, 54424, 65535, 65535, 65535, 54448, 21675, 54436, 21665, 21664, 65535,
+    65535, 21667, 65535, 65535, 54440, 21671, 65535, 65535, 21674, 65535, 65535, 21677, 65535, 54447, 65535, 65535,
+    54452, 21683, 65535, 65535, 54460, 21689, 54456, 65535, 65535, 54459, 65535, 65535, 54462, 65535, 65535, 54543,
+    54518, 21721, 54482, 54475, 54472, 21703, 65535, 65535, 21706, 65535, 65535, 21711, 21710, 65535, 65535, 21713,
+    65535, 65535, 21718, 21717, 65535, 65535, 21720, 65535, 65535, 21735, 54498, 21727, 54494, 65535, 65535, 54497,
+    65535, 65535, 54500, 65535, 21734, 65535, 65535, 54511, 21740, 54507, 65535, 65535, 54510, 65535, 65535, 54515,
+    54514, 65535, 65535, 54517, 65535, 65535, 21760, 54521, 65535, 21759, 54524, 65535, 21758, 65535, 65535, 65535,
+    21762, 65535, 21768, 54533, 65535, 21767, 65535, 65535, 21772, 21771, 65535, 65535, 21774, 65535, 65535, 54569,
+    21786, 21785, 21784, 21783, 21782, 65535, 65535, 65535, 65535, 65535, 21796, 21793, 21790, 65535, 21792, 65535,
+    65535, 21795, 65535, 65535, 21798, 65535, 21800, 65535, 65535, 21819, 54586, 54579, 21808, 54575, 65535, 65535,
+    54578, 65535, 65535, 21815, 54582, 65535, 65535, 54585, 65535, 65535, 65535, 21833, 54596, 54593, 54592, 65535,
+    65535, 54595, 65535, 65535, 54598, 65535, 54600, 65535, 65535, 21841, 54606, 54605, 65535, 65535, 54608, 65535,
+    65535, 21845, 54612, 65535, 65535, 21847, 65535, 65535, 21952, 21899, 21882, 54635, 21860, 54625, 21856, 65535,
+    65535, 21859, 65535, 65535, 21864, 54631, 65535, 65535, 54634, 65535, 65535, 54643, 21872, 21871, 65535, 65535,
+    21874, 65535, 65535, 21879, 54646, 65535, 65535, 54649, 65535, 65535, 54654, 54653, 65535, 65535, 54660, 54657,
+    65535, 54659, 65535, 65535, 54664, 54663, 65535, 65535, 54666, 65535, 65535, 54691, 54678, 21903, 65535, 21907,
+    54674, 65535, 65535, 54677, 65535, 65535, 21916, 21915, 21914, 65535, 65535, 65535, 21920, 21919, 65535, 65535,
+    21922, 65535, 65535, 54705, 21930, 21929, 21928, 65535, 65535, 65535, 21934, 21933, 65535, 65535, 21936, 65535,
+    65535, 21945, 54710, 21941, 65535, 65535, 54712, 65535, 65535, 54717, 21948, 65535, 65535, 54719, 65535, 65535,
+    54758, 54747, 54736, 54731, 54728, 54727, 65535, 65535, 21962, 65535, 65535, 21965, 65535, 21967, 65535, 65535,
+    54740, 21971, 65535, 65535, 54744, 21975, 65535, 65535, 54746, 65535, 65535, 21981, 65535, 21985, 21984, 65535,
+    65535, 21989, 21988, 65535, 65535, 65535, 21996, 54761, 65535, 54763, 65535, 65535, 22000, 54767, 65535, 65535,
+    54776, 22005, 22004, 65535, 65535, 54775, 65535, 65535, 22012, 54779, 65535, 65535, 22014, 65535, 65535, 54857,
+    54824, 54809, 54802, 54795, 54792, 54791, 65535, 65535, 22026, 65535, 65535, 22031, 22030, 65535, 65535, 22033,
+    65535, 65535, 22040, 22037, 65535, 22039, 65535, 65535, 65535, 22055, 22048, 22047, 22046, 65535, 65535, 65535,
+    22052, 22051, 65535, 65535, 22054, 65535, 65535, 65535, 22086, 22071, 54834, 22063, 54830, 65535, 65535, 54833,
+    65535, 65535, 22070, 22069, 65535, 65535, 65535, 22079, 54844, 22075, 65535, 65535, 22078, 65535, 65535, 22083,
+    22082, 65535, 65535, 54853, 65535, 65535, 54856, 65535, 65535, 22151, 22122, 54875, 22100, 22097, 22096, 65535,
+    65535, 54867, 65535, 65535, 54872, 22103, 65535, 65535, 22106, 65535, 65535, 22115, 54880, 22111, 65535, 65535,
+    22114, 65535, 65535, 54887, 22118, 65535, 65535, 54889, 65535, 65535, 54904, 54897, 22126, 65535, 22128, 65535,
+    65535, 22133, 22132, 65535, 65535, 22135, 65535, 65535, 22144, 54909, 22140, 65535, 65535, 54911, 65535, 65535,
+    54916, 22147, 65535, 65535, 54918, 65535, 65535, 22179, 54936, 22161, 22158, 54925, 65535, 65535, 22160, 65535,
+    65535, 22165, 22164, 65535, 65535, 22167, 65535, 65535, 54944, 54941, 54940, 65535, 65535, 54943, 65535, 65535,
+    54946, 65535, 65535, 54951, 54950, 65535, 65535, 54959, 54956, 54955, 65535, 65535, 54958, 65535, 65535, 65535,
+    55022, 55001, 54986, 54979, 54972, 54969, 54968, 65535, 65535, 22203, 65535, 65535, 22208, 22207, 65535, 65535,
+    22210, 65535, 65535, 22217, 22214, 65535, 22216, 65535, 65535, 65535, 22232, 22225, 22224, 22223, 65535, 65535,
+    65535, 22229, 22228, 65535, 65535, 22231, 65535, 65535, 65535, 22251, 22248, 22241, 22240, 55007, 65535, 65535,
+    65535, 22245, 55012, 65535, 65535, 22247, 65535, 65535, 55018, 65535, 65535, 55021, 65535, 65535, 22266, 55029,
+    22258, 65535, 55028, 65535, 65535, 55031, 65535, 55033, 65535, 65535, 55054, 22271, 22270, 65535, 65535, 22279,
+    22276, 22275, 65535, 65535, 22278, 65535, 65535, 22283, 22282, 65535, 65535, 22285, 65535, 65535, 22302, 55063,
+    22292, 55059, 65535, 65535, 55062, 65535, 65535, 22299, 55066, 65535, 65535, 22301, 65535, 65535, 22310, 22307,
+    55074, 65535, 65535, 55077, 65535, 65535, 55082, 22313, 65535, 65535, 55084, 65535, 65535, 22421, 22368, 22351,
+    55104, 22329, 22326, 55093, 65535, 65535, 55096, 65535, 65535, 22333, 55100, 65535, 65535, 55103, 65535, 65535,
+    22344, 55109, 22340, 65535, 65535, 55111, 65535, 65535, 55116, 55115, 65535, 65535, 55118, 65535, 65535, 55123,
+    55122, 65535, 65535, 55129, 55126, 65535, 55128, 65535, 65535, 55133, 55132, 65535, 65535, 55135, 65535, 65535,
+    55160, 55147, 22372, 65535, 55144, 55143, 65535, 65535, 22378, 65535, 65535, 22385, 22384, 22383, 65535, 65535,
+    65535, 22389, 22388, 65535, 65535, 22391, 65535, 65535, 55174, 22399, 22398, 22397, 65535, 65535, 65535, 22403,
+    22402, 65535, 65535, 22405, 65535, 65535, 22414, 55179, 55178, 65535, 65535, 22413, 65535, 65535, 55186, 22417,
+    65535, 65535, 55188, 65535, 65535, 55229, 55216, 55205, 55200, 55197, 22428, 65535, 65535, 22431, 65535, 65535,
+    22434, 65535, 22436, 65535, 65535, 55209, 22440, 65535, 65535, 55213, 22444, 65535, 65535, 55215, 65535, 65535,
+    22450, 65535, 22454, 22453, 65535, 65535, 22458, 22457, 65535, 65535, 22460, 65535, 65535, 22467, 55232, 65535,
+    55234, 65535, 65535, 55249, 22474, 22471, 65535, 22473, 65535, 65535, 55246, 22477, 65535, 65535, 22480, 65535,
+    65535, 22487, 22484, 65535, 55254, 65535, 65535, 55259, 22490, 65535, 65535, 22493, 65535, 65535, 55322, 55303,
+    55288, 55281, 55274, 55271, 55270, 65535, 65535, 22505, 65535, 65535, 22510, 22509, 65535, 65535, 22512, 65535,
+    65535, 22519, 22516, 65535, 22518, 65535, 65535, 65535, 22534, 22527, 22526, 22525, 65535, 65535, 65535, 22531,
+    22530, 65535, 65535, 22533, 65535, 65535, 65535, 22551, 22548, 22541, 22540, 65535, 65535, 22545, 22544, 65535,
+    65535, 22547, 65535, 65535, 55318, 65535, 65535, 55321, 65535, 65535, 22566, 55329, 22558, 65535, 55328, 65535,
+    65535, 55331, 65535, 55333, 65535, 65535, 22592, 55349, 55344, 55341, 22572, 65535, 65535, 55343, 65535, 65535,
+    22580, 55347, 65535, 65535, 65535, 22585, 55352, 65535, 65535, 22589, 55356, 65535, 65535, 55359, 65535, 65535,
+    22608, 55369, 22598, 22597, 65535, 65535, 22600, 65535, 65535, 55373, 22604, 65535, 65535, 22607, 65535, 65535,
+    55384, 22613, 55380, 65535, 65535, 55383, 65535, 65535, 55388, 22619, 65535, 65535, 55390, 65535, 65535, 55503,
+    55448, 55425, 55410, 55403, 55400, 55399, 65535, 65535, 22634, 65535, 65535, 22639, 22638, 65535, 65535, 22641,
+    65535, 65535, 22650, 22647, 22646, 65535, 65535, 22649, 65535, 65535, 22654, 55421, 65535, 65535, 22656, 65535,
+    65535, 22667, 22666, 22663, 22662, 65535, 65535, 22665, 65535, 65535, 65535, 22673, 55438, 65535, 55440, 65535,
+    65535, 55445, 22676, 65535, 65535, 22679, 65535, 65535, 22708, 22697, 22690, 55455, 22686, 65535, 65535, 22689,
+    65535, 65535, 55462, 22693, 65535, 65535, 22696, 65535, 65535, 55469, 22700, 65535, 65535, 55473, 22704, 65535,
+    65535, 22707, 65535, 65535, 22720, 55481, 22712, 65535, 65535, 55485, 22716, 65535, 65535, 55487, 65535, 65535,
+    22728, 55493, 22724, 65535, 65535, 22727, 65535, 65535, 22732, 55499, 65535, 65535, 55502, 65535, 65535, 22785,
+    22762, 55515, 22746, 22743, 22742, 65535, 65535, 22745, 65535, 65535, 65535, 22755, 55520, 55519, 65535, 65535,
+    22754, 65535, 65535, 55527, 55526, 65535, 65535, 22761, 65535, 65535, 55538, 22765, 65535, 22767, 65535, 22769,
+    65535, 65535, 55546, 22775, 22774, 65535, 65535, 22777, 65535, 65535, 22782, 55549, 65535, 65535, 22784, 65535,
+    65535, 22799, 55560, 22791, 55558, 65535, 65535, 65535, 22796, 55563, 65535, 65535, 55566, 65535, 65535, 55579,
+    22806, 22803, 65535, 22805, 65535, 65535, 22808, 65535, 22810, 65535, 65535, 22819, 55584, 22815, 65535, 65535,
+    22818, 65535, 65535, 55591, 22822, 65535, 65535, 55593, 65535, 65535, 55694, 22879, 55628, 55613, 22838, 55603,
+    22834, 65535, 65535, 22837, 65535, 65535, 55610, 55609, 65535, 65535, 55612, 65535, 65535, 22853, 55618, 22849,
+    65535, 65535, 22852, 65535, 65535, 22857, 22856, 65535, 65535, 55627, 65535, 65535, 22870, 22869, 55634, 22865,
+    65535, 65535, 22868, 65535, 65535, 65535, 22878, 22875, 22874, 65535, 65535, 22877, 65535, 65535, 65535, 22903,
+    55656, 55651, 65535, 22887, 55654, 65535, 65535, 65535, 22896, 55661, 55660, 65535, 65535, 22895, 65535, 65535,
+    55668, 22899, 65535, 65535, 22902, 65535, 65535, 22919, 55680, 55677, 22908, 65535, 65535, 22911, 65535, 65535,
+    22916, 55683, 65535, 65535, 55686, 65535, 65535, 55689, 65535, 55691, 65535, 55693, 65535, 65535, 22944, 55705,
+    55702, 55701, 22932, 65535, 65535, 65535, 22936, 65535, 65535, 55707, 65535, 55711, 55710, 65535, 65535, 65535,
+    55730, 22947, 65535, 22955, 22952, 22951, 65535, 65535, 55722, 65535, 65535, 22959, 55726, 65535, 65535, 22961,
+    65535, 65535, 22976, 55739, 22968, 55735, 65535, 65535, 55738, 65535, 65535, 55743, 55742, 65535, 65535, 65535,
+    22984, 55749, 55748, 65535, 65535, 55751, 65535, 65535, 55756, 22987, 65535, 65535, 55758, 65535, 65535, 23099,
+    55820, 55793, 23010, 23003, 55768, 55767, 65535, 65535, 55770, 65535, 65535, 55775, 55774, 65535, 65535, 55777,
+    65535, 65535, 55786, 23015, 55782, 65535, 65535, 23017, 65535, 65535, 55790, 23021, 65535, 65535, 55792, 65535,
+    65535, 23041, 23034, 55799, 23030, 65535, 65535, 23033, 65535, 65535, 55806, 23037, 65535, 65535, 23040, 65535,
+    65535, 55813, 23044, 65535, 65535, 55817, 23048, 65535, 65535, 23051, 65535, 65535, 23078, 55831, 23062, 23059,
+    23058, 65535, 65535, 23061, 65535, 65535, 65535, 23071, 55836, 55835, 65535, 65535, 23070, 65535, 65535, 55843,
+    55842, 65535, 65535, 23077, 65535, 65535, 55854, 23083, 23082, 65535, 65535, 23085, 65535, 65535, 23092, 55857,
+    65535, 55859, 65535, 65535, 55864, 23095, 65535, 65535, 23098, 65535, 65535, 23131, 55872, 55871, 65535, 65535,
+    55886, 23111, 55878, 55877, 65535, 65535, 65535, 55883, 23114, 65535, 65535, 23117, 65535, 65535, 55892, 23121,
+    65535, 23123, 65535, 65535, 55896, 23127, 65535, 65535, 55898, 65535, 65535, 55927, 23148, 55909, 23138, 55905,
+    65535, 65535, 23140, 65535, 65535, 23145, 23144, 65535, 65535, 23147, 65535, 65535, 55924, 55921, 55920, 65535,
+    65535, 23155, 65535, 65535, 23158, 65535, 65535, 55939, 23164, 55931, 65535, 65535, 23168, 23167, 65535, 65535,
+    23170, 65535, 65535, 55947, 23176, 23175, 65535, 65535, 23178, 65535, 65535, 55951, 23182, 65535, 65535, 55953,
+    65535, 65535, 23280, 23243, 23218, 55971, 23198, 23195, 55962, 65535, 65535, 55965, 65535, 65535, 23200, 65535,
+    23202, 65535, 65535, 55979, 23208, 23207, 65535, 65535, 23210, 65535, 65535, 23215, 55982, 65535, 65535, 55985,
+    65535, 65535, 55998, 55993, 55992, 55991, 65535, 65535, 65535, 55995, 65535, 55997, 65535, 65535, 56006, 56003,
+    56002, 65535, 65535, 56005, 65535, 65535, 56008, 65535, 56010, 65535, 65535, 56029, 56024, 56021, 56018, 56017,
+    65535, 65535, 23252, 65535, 65535, 23255, 65535, 65535, 23260, 23259, 65535, 65535, 65535, 56035, 23266, 23265,
+    65535, 65535, 65535, 56041, 23272, 23271, 65535, 65535, 65535, 23277, 56044, 65535, 65535, 56047, 65535, 65535,
+    56084, 56069, 56064, 56059, 23288, 56055, 65535, 65535, 56058, 65535, 65535, 23293, 65535, 23295, 65535, 65535,
+    23300, 23299, 65535, 65535, 65535, 23303, 65535, 23309, 56076, 56075, 65535, 65535, 65535, 23313, 56080, 65535,
+    65535, 23315, 65535, 65535, 23336, 56093, 23324, 56091, 56090, 65535, 65535, 65535, 65535, 56097, 23328, 65535,
+    65535, 56101, 56100, 65535, 65535, 56103, 65535, 65535, 56120, 23345, 23342, 23341, 65535, 65535, 23344, 65535,
+    65535, 23349, 56116, 65535, 65535, 56119, 65535, 65535, 23360, 56125, 23356, 65535, 65535, 56127, 65535, 65535,
+    56132, 56131, 65535, 65535, 23366, 65535, 65535, 56229, 56198, 23399, 56154, 56147, 56144, 23375, 65535, 65535,
+    23378, 65535, 65535, 23383, 23382, 65535, 65535, 23385, 65535, 65535, 23392, 23391, 23390, 65535, 65535, 65535,
+    23396, 23395, 65535, 65535, 23398, 65535, 65535, 23415, 56176, 56173, 56172, 65535, 65535, 23407, 65535, 65535,
+    23412, 56179, 65535, 65535, 56182, 65535, 65535, 56191, 56188, 23419, 65535, 65535, 23422, 65535, 65535, 23427,
+    56194, 65535, 65535, 56197, 65535, 65535, 23440, 23439, 23438, 23437, 23436, 65535, 65535, 65535, 65535, 65535,
+    23452, 23447, 23444, 65535, 23446, 65535, 65535, 23451, 23450, 65535, 65535, 65535, 23456, 23455, 65535, 65535,
+    23458, 65535, 23460, 65535, 65535, 56265, 23478, 56245, 23472, 23469, 23468, 65535, 65535, 23471, 65535, 65535,
+    23474, 65535, 23476, 65535, 65535, 65535, 23482, 23481, 65535, 65535, 23490, 23487, 56254, 65535, 65535, 56257,
+    65535, 65535, 23494, 56261, 65535, 65535, 23496, 65535, 65535, 23523, 56282, 23507, 23504, 56271, 65535, 65535,
+    56274, 65535, 65535, 56279, 56278, 65535, 65535, 56281, 65535, 65535, 56284, 65535, 56288, 56287, 65535, 65535,
+    56290, 65535, 65535, 23535, 56300, 56297, 56296, 65535, 65535, 56299, 65535, 65535, 56302, 65535, 65535, 23543,
+    56308, 56307, 65535, 65535, 23542, 65535, 65535, 23547, 56314, 65535, 65535, 56317, 65535, 65535, 23626, 23599,
+    56348, 23569, 23562, 56327, 56326, 65535, 65535, 56329, 65535, 65535, 56334, 23565, 65535, 65535, 56336, 65535,
+    65535, 56343, 56340, 65535, 23574, 65535, 65535, 23579, 56346, 65535, 65535, 65535, 56352, 23583, 65535, 65535,
+    56360, 23589, 23588, 65535, 65535, 23591, 65535, 65535, 23596, 56363, 65535, 65535, 56366, 65535, 65535, 56383,
+    56382, 56375, 56374, 56373, 65535, 65535, 65535, 56379, 56378, 65535, 65535, 23613, 65535, 65535, 65535, 56393,
+    56386, 65535, 56390, 56389, 65535, 65535, 56392, 65535, 65535, 65535, 23668, 56417, 56410, 56403, 56400, 65535,
+    23634, 65535, 65535, 56407, 23638, 65535, 65535, 23641, 65535, 65535, 56412, 65535, 23646, 65535, 56416, 65535,
+    65535, 56433, 56426, 56423, 23654, 65535, 65535, 23657, 65535, 65535, 56430, 23661, 65535, 65535, 56432, 65535,
+    65535, 56435, 65535, 65535, 56462, 56451, 56446, 56443, 56442, 65535, 65535, 23677, 65535, 65535, 23682, 23681,
+    65535, 65535, 65535, 23691, 23688, 23687, 65535, 65535, 56458, 65535, 65535, 56461, 65535, 65535, 56478, 23703,
+    56468, 23699, 65535, 65535, 23702, 65535, 65535, 56475, 23706, 65535, 65535, 56477, 65535, 65535, 56486, 23715,
+    56482, 65535, 65535, 56485, 65535, 65535, 56490, 23721, 65535, 65535, 56492, 65535, 65535, 56561, 56538, 56525,
+    56510, 56505, 56502, 56501, 65535, 65535, 23736, 65535, 65535, 23741, 23740, 65535, 65535, 65535, 23750, 23747,
+    23746, 65535, 65535, 23749, 65535, 65535, 56522, 23753, 65535, 65535, 23756, 65535, 65535, 23769, 23764, 23761,
+    65535, 23763, 65535, 65535, 23766, 65535, 23768, 65535, 65535, 65535, 23790, 23787, 23780, 23777, 23776, 65535,
+    65535, 56547, 65535, 65535, 23784, 56551, 65535, 65535, 56554, 65535, 65535, 56557, 65535, 65535, 56560, 65535,
+    65535, 23805, 56572, 56571, 56570, 23799, 65535, 56569, 65535, 65535, 65535, 65535, 65535, 23837, 56590, 23815,
+    56580, 23811, 65535, 65535, 56582, 65535, 65535, 56587, 23818, 65535, 65535, 56589, 65535, 65535, 56598, 23827,
+    23826, 65535, 65535, 56597, 65535, 65535, 23834, 23833, 65535, 65535, 56604, 65535, 65535, 56617, 23842, 23841,
+    65535, 65535, 23846, 23845, 65535, 65535, 23848, 65535, 65535, 56625, 23854, 56621, 65535, 65535, 23856, 65535,
+    65535, 23861, 56628, 65535, 65535, 23863, 65535, 65535, 23966, 23925, 23894, 23883, 23876, 23873, 23872, 65535,
+    65535, 56643, 65535, 65535, 56648, 56647, 65535, 65535, 56650, 65535, 65535, 56657, 56656, 56655, 65535, 65535,
+    65535, 56661, 56660, 65535, 65535, 65535, 56678, 56671, 56668, 23899, 65535, 65535, 23902, 65535, 65535, 23907,
+    56674, 65535, 65535, 56677, 65535, 65535, 23918, 56683, 23914, 65535, 65535, 56685, 65535, 65535, 56690, 56689,
+    65535, 65535, 56692, 65535, 65535, 56715, 56702, 56699, 56698, 65535, 65535, 56701, 65535, 65535, 56708, 56707,
+    56706, 65535, 65535, 65535, 56712, 56711, 65535, 65535, 56714, 65535, 65535, 56725, 56722, 56721, 56720, 65535,
+    65535, 65535, 56724, 65535, 65535, 56727, 65535, 56731, 56730, 65535, 65535, 56733, 65535, 65535, 56784, 56761,
+    56752, 56745, 23974, 56741, 65535, 65535, 56744, 65535, 65535, 23981, 56748, 65535, 65535, 23983, 65535, 65535,
+    23990, 23987, 65535, 23989, 65535, 65535, 23992, 65535, 65535, 24007, 24000, 56767, 23998, 65535, 65535, 65535,
+    56772, 56771, 65535, 65535, 56774, 65535, 65535, 24015, 56780, 24011, 65535, 65535, 24014, 65535, 65535, 65535,
+    65535, 24037, 56802, 24033, 56800, 24029, 56794, 24025, 65535, 65535, 56796, 65535, 65535, 56799, 65535, 65535,
+    65535, 65535, 56804, 65535, 65535, 24049, 56816, 56815, 56814, 24045, 56812, 65535, 65535, 65535, 65535, 65535,
+    65535, 24059, 56820, 65535, 56822, 65535, 56826, 24057, 65535, 65535, 65535, 24075, 56836, 24065, 24064, 65535,
+    65535, 56835, 65535, 65535, 24072, 56839, 65535, 65535, 56842, 65535, 65535, 24083, 56848, 56847, 65535, 65535,
+    24082, 65535, 65535, 24087, 56854, 65535, 65535, 56857, 65535, 65535, 56932, 56907, 56890, 24109, 24102, 24099,
+    24098, 65535, 65535, 56869, 65535, 65535, 56874, 56873, 65535, 65535, 24108, 65535, 65535, 56885, 24114, 24113,
+    65535, 65535, 24116, 65535, 65535, 24119, 65535, 24121, 65535, 65535, 24132, 24129, 24128, 24127, 65535, 65535,
+    65535, 24131, 65535, 65535, 24134, 65535, 24136, 65535, 24138, 65535, 65535, 24147, 24142, 65535, 24144, 65535,
+    24146, 65535, 65535, 24153, 24150, 65535, 24152, 65535, 65535, 24159, 24158, 24157, 65535, 65535, 65535, 24161,
+    65535, 24163, 65535, 65535, 24166, 65535, 24172, 56937, 65535, 56939, 65535, 65535, 56954, 24179, 24178, 24177,
+    65535, 65535, 65535, 24183, 24182, 65535, 65535, 24185, 65535, 65535, 56960, 24189, 65535, 24191, 65535, 65535,
+    56964, 24195, 65535, 65535, 24198, 65535, 65535, 57073, 24256, 24227, 24214, 24211, 56976, 56975, 65535, 65535,
+    24210, 65535, 65535, 56981, 65535, 65535, 56990, 56987, 24218, 65535, 65535, 24221, 65535, 65535, 24224, 65535,
+    56994, 65535, 65535, 57009, 57004, 57001, 24232, 65535, 65535, 24235, 65535, 65535, 24240, 24239, 65535, 65535,
+    65535, 57017, 24246, 57013, 65535, 65535, 57016, 65535, 65535, 57021, 24252, 65535, 65535, 24255, 65535, 65535,
+    57054, 57039, 57034, 57031, 57030, 65535, 65535, 24265, 65535, 65535, 24268, 65535, 24270, 65535, 65535, 24279,
+    24276, 57043, 65535, 65535, 57046, 65535, 65535, 57051, 24282, 65535, 65535, 24285, 65535, 65535, 57062, 24291,
+    24290, 65535, 65535, 24293, 65535, 65535, 24298, 24297, 65535, 65535, 24302, 57069, 65535, 65535, 57072, 65535,
+    65535, 24307, 65535, 24327, 57082, 24311, 65535, 24313, 65535, 65535, 24320, 57087, 57086, 65535, 65535, 65535,
+    57092, 24323, 65535, 65535, 57094, 65535, 65535, 57105, 24334, 24333, 24332, 65535, 65535, 65535, 24336, 65535,
+    65535, 57111, 24340, 65535, 24342, 65535, 65535, 24347, 57114, 65535, 65535, 57117, 65535, 65535, 24458, 57177,
+    57150, 24369, 57130, 24359, 57126, 65535, 65535, 57129, 65535, 65535, 24366, 24365, 65535, 65535, 24368, 65535,
+    65535, 57143, 24374, 57141, 65535, 65535, 65535, 57147, 57146, 65535, 65535, 57149, 65535, 65535, 24398, 24391,
+    57156, 24387, 65535, 65535, 24390, 65535, 65535, 57163, 57162, 65535, 65535, 24397, 65535, 65535, 57170, 24401,
+    65535, 65535, 57174, 24405, 65535, 65535, 24408, 65535, 65535, 24433, 57188, 24419, 24416, 24415, 65535, 65535,
+    24418, 65535, 65535, 65535, 24428, 24425, 57192, 65535, 65535, 57195, 65535, 65535, 57200, 57199, 65535, 65535,
+    65535, 57211, 24440, 24439, 24438, 65535, 65535, 65535, 24442, 65535, 65535, 24451, 24448, 57215, 65535, 65535,
+    57218, 65535, 65535, 24455, 57222, 65535, 65535, 57225, 65535, 65535, 24500, 57239, 24462, 65535, 57232, 65535,
+    57236, 24467, 65535, 65535, 57238, 65535, 65535, 57255, 57248, 57245, 57244, 65535, 65535, 24479, 65535, 65535,
+    24484, 57251, 65535, 65535, 24486, 65535, 65535, 57261, 24490, 65535, 24492, 65535, 65535, 57265, 24496, 65535,
+    65535, 57267, 65535, 65535, 24524, 57277, 24508, 57275, 57274, 65535, 65535, 65535, 65535, 57285, 24514, 57281,
+    65535, 65535, 57284, 65535, 65535, 24521, 57288, 65535, 65535, 57291, 65535, 65535, 57308, 24533, 57298, 57297,
+    65535, 65535, 57300, 65535, 65535, 57305, 57304, 65535, 65535, 24539, 65535, 65535, 57310, 65535, 65535, 57423,
+    24600, 57341, 24560, 57323, 57320, 57319, 65535, 65535, 24554, 65535, 65535, 24559, 24558, 65535, 65535, 65535,
+    57336, 24565, 57332, 65535, 65535, 57335, 65535, 65535, 24572, 57339, 65535, 65535, 65535, 24587, 57348, 24577,
+    65535, 24579, 65535, 65535, 57352, 24583, 65535, 65535, 24586, 65535, 65535, 24593, 57358, 65535, 24592, 65535,
+    65535, 24597, 57364, 65535, 65535, 24599, 65535, 65535, 24630, 57383, 24608, 57375, 57374, 65535, 65535, 65535,
+    57380, 24611, 65535, 65535, 57382, 65535, 65535, 24623, 57388, 57387, 65535, 65535, 24622, 65535, 65535, 57395,
+    24626, 65535, 65535, 24629, 65535, 65535, 24644, 24639, 24636, 57403, 65535, 65535, 57406, 65535, 65535, 57411,
+    57410, 65535, 65535, 65535, 57420, 24649, 57416, 65535, 65535, 24651, 65535, 65535, 24654, 65535, 65535, 57459,
+    24670, 24663, 24662, 24661, 65535, 65535, 65535, 57437, 24668, 24667, 65535, 65535, 65535, 65535, 24682, 24679,
+    24676, 57443, 65535, 65535, 57446, 65535, 65535, 57449, 65535, 65535, 24684, 65535, 24688, 24687, 65535, 65535,
+    24690, 65535, 65535, 57481, 24706, 24699, 24698, 24697, 65535, 65535, 65535, 24703, 24702, 65535, 65535, 24705,
+    65535, 65535, 24710, 24709, 65535, 65535, 24712, 65535, 65535, 24727, 57490, 24719, 57486, 65535, 65535, 57489,
+    65535, 65535, 57492, 65535, 57494, 65535, 65535, 57503, 24732, 57499, 65535, 65535, 24734, 65535, 65535, 57507,
+    24738, 65535, 65535, 57509, 65535, 65535, 24856, 24807, 24776, 24761, 57522, 57519, 24750, 65535, 65535, 24753,
+    65535, 65535, 57526, 24757, 65535, 65535, 57528, 65535, 65535, 57537, 24766, 57533, 65535, 65535, 57536, 65535,
+    65535, 57541, 24772, 65535, 65535, 24775, 65535, 65535, 57560, 24785, 57550, 24781, 65535, 65535, 24784, 65535,
+    65535, 57557, 57556, 65535, 65535, 57559, 65535, 65535, 57568, 24797, 57564, 65535, 65535, 57567, 65535, 65535,
+    24804, 57571, 65535, 65535, 57574, 65535, 65535, 57607, 57592, 24817, 57582, 57581, 65535, 65535, 24816, 65535,
+    65535, 24821, 57588, 65535, 65535, 57591, 65535, 65535, 24832, 57597, 24828, 65535, 65535, 57599, 65535, 65535,
+    24836, 57603, 65535, 65535, 57606, 65535, 65535, 24841, 65535, 57617, 24846, 57613, 65535, 65535, 57616, 65535,
+    65535, 24853, 57620, 65535, 65535, 57623, 65535, 65535, 57664, 24877, 57642, 24867, 57632, 57631, 65535, 65535,
+    57634, 65535, 65535, 57639, 57638, 65535, 65535, 24873, 65535, 65535, 24876, 65535, 65535, 57649, 24880, 65535,
+    65535, 24889, 57654, 57653, 65535, 65535, 57656, 65535, 65535, 57661, 24892, 65535, 65535, 24895, 65535, 65535,
+    24904, 57667, 65535, 57669, 65535, 57671, 65535, 65535, 57688, 24913, 57678, 24909, 65535, 65535, 24912, 65535,
+    65535, 24917, 57684, 65535, 65535, 57687, 65535, 65535, 24926, 24923, 65535, 24925, 65535, 65535, 57698, 24929,
+    65535, 65535, 65535, 57805, 57756, 57733, 24950, 24943, 24940, 57707, 65535, 65535, 57710, 65535, 65535, 24947,
+    57714, 65535, 65535, 57717, 65535, 65535, 57726, 57723, 24954, 65535, 65535, 24957, 65535, 65535, 57730, 24961,
+    65535, 65535, 24964, 65535, 65535, 24981, 24974, 24971, 24970, 65535, 65535, 24973, 65535, 65535, 24978, 24977,
+    65535, 65535, 24980, 65535, 65535, 24983, 65535, 24985, 65535, 24987, 65535, 65535, 57776, 25001, 24996, 24995,
+    24994, 65535, 65535, 65535, 24998, 65535, 25000, 65535, 65535, 25003, 65535, 25007, 25006, 65535, 65535, 65535,
+    57790, 25015, 25014, 25013, 65535, 65535, 65535, 25019, 25018, 65535, 65535, 25021, 65535, 65535, 25030, 57795,
+    57794, 65535, 65535, 57797, 65535, 65535, 25034, 57801, 65535, 65535, 25036, 65535, 65535, 57841, 25054, 57821,
+    25048, 25045, 25044, 65535, 65535, 25047, 65535, 65535, 25050, 65535, 25052, 65535, 65535, 65535, 25058, 25057,
+    65535, 65535, 25066, 25063, 57830, 65535, 65535, 57833, 65535, 65535, 25070, 57837, 65535, 65535, 25072, 65535,
+    65535, 25097, 57856, 25081, 57846, 65535, 57848, 65535, 65535, 57853, 57852, 65535, 65535, 57855, 65535, 65535,
+    57858, 65535, 57862, 57861, 65535, 65535, 57864, 65535, 65535, 57877, 25104, 25103, 25102, 65535, 65535, 65535,
+    25106, 65535, 25108, 65535, 65535, 57885, 25114, 25113, 65535, 65535, 25116, 65535, 65535, 57889, 25120, 65535,
+    65535, 57891, 65535, 65535, 57964, 57941, 57924, 57909, 57904, 57901, 57900, 65535, 65535, 25135, 65535, 65535,
+    25140, 25139, 65535, 65535, 65535, 25149, 25146, 25145, 65535, 65535, 57916, 65535, 65535, 57921, 25152, 65535,
+    65535, 25155, 65535, 65535, 25170, 25165, 25162, 25161, 65535, 65535, 25164, 65535, 65535, 25169, 25168, 65535,
+    65535, 65535, 25172, 65535, 65535, 25193, 25190, 25183, 25180, 25179, 65535, 65535, 25182, 65535, 65535, 25187,
+    57954, 65535, 65535, 25189, 65535, 65535, 57960, 65535, 65535, 57963, 65535, 65535, 25208, 57971, 25200, 65535,
+    57970, 65535, 65535, 57973, 65535, 57975, 65535, 65535, 25240, 57993, 25218, 57983, 57982, 65535, 65535, 25217,
+    65535, 65535, 57990, 25221, 65535, 65535, 57992, 65535, 65535, 58001, 25230, 25229, 65535, 65535, 58000, 65535,
+    65535, 25237, 25236, 65535, 65535, 58007, 65535, 65535, 25256, 25249, 58014, 25245, 65535, 65535, 25248, 65535,
+    65535, 58021, 25252, 65535, 65535, 58023, 65535, 65535, 58030, 58027, 65535, 58029, 65535, 65535, 58032, 65535,
+    65535, 58137, 58088, 58067, 58052, 58045, 58042, 58041, 65535, 65535, 25276, 65535, 65535, 25281, 25280, 65535,
+    65535, 25283, 65535, 65535, 25292, 25289, 25288, 65535, 65535, 25291, 65535, 65535, 25296, 25295, 65535, 65535,
+    25298, 65535, 65535, 25309, 25302, 65535, 25306, 25305, 65535, 65535, 25308, 65535, 65535, 25313, 25312, 65535,
+    65535, 25317, 25316, 65535, 65535, 25319, 65535, 65535, 25342, 25329, 25328, 58093, 65535, 25327, 65535, 65535,
+    65535, 25335, 58100, 65535, 25334, 65535, 65535, 25339, 58106, 65535, 65535, 58109, 65535, 65535, 58126, 25351,
+    58116, 58115, 65535, 65535, 58118, 65535, 65535, 25355, 58122, 65535, 65535, 58125, 65535, 65535, 25364, 25363,
+    25362, 65535, 65535, 65535, 25368, 25367, 65535, 65535, 65535, 25417, 58156, 25383, 25378, 25377, 58144, 65535,
+    65535, 65535, 58148, 65535, 25382, 65535, 65535, 58155, 58154, 65535, 65535, 65535, 58170, 25397, 58162, 25393,
+    65535, 65535, 25396, 65535, 65535, 58169, 25400, 65535, 65535, 65535, 58178, 25407, 25406, 65535, 65535, 58177,
+    65535, 65535, 25414, 58181, 65535, 65535, 25416, 65535, 65535, 25449, 58202, 25427, 58192, 58191, 65535, 65535,
+    58194, 65535, 65535, 58199, 58198, 65535, 65535, 25433, 65535, 65535, 25442, 58207, 25438, 65535, 65535, 58209,
+    65535, 65535, 25446, 25445, 65535, 65535, 25448, 65535, 65535, 58221, 25452, 65535, 65535, 25455, 65535, 65535,
+    25566, 25515, 25490, 25475, 25468, 25465, 25464, 65535, 65535, 58235, 65535, 65535, 58240, 58239, 65535, 65535,
+    58242, 65535, 65535, 25483, 58248, 25479, 65535, 65535, 58250, 65535, 65535, 58255, 25486, 65535, 65535, 58257,
+    65535, 65535, 58268, 58261, 65535, 58265, 58264, 65535, 65535, 58267, 65535, 65535, 58276, 58273, 58272, 65535,
+    65535, 58275, 65535, 65535, 58280, 58279, 65535, 65535, 58282, 65535, 65535, 58315, 58300, 25525, 58290, 25521,
+    65535, 65535, 58292, 65535, 65535, 58297, 25528, 65535, 65535, 25531, 65535, 65535, 58308, 25537, 58304, 65535,
+    65535, 58307, 65535, 65535, 25544, 58311, 65535, 65535, 58314, 65535, 65535, 58321, 25552, 25551, 65535, 65535,
+    65535, 58329, 58326, 25557, 65535, 65535, 25560, 65535, 65535, 58331, 65535, 58333, 65535, 65535, 25606, 58355,
+    58352, 25577, 58342, 58341, 65535, 65535, 58344, 65535, 65535, 58349, 58348, 65535, 65535, 58351, 65535, 65535,
+    25586, 65535, 65535, 58361, 25590, 65535, 25592, 65535, 65535, 58369, 58366, 25597, 65535, 65535, 58368, 65535,
+    65535, 25605, 58372, 65535, 65535, 65535, 58400, 58389, 58384, 58381, 25612, 65535, 65535, 25615, 65535, 65535,
+    25618, 65535, 25620, 65535, 65535, 25625, 58392, 65535, 65535, 58397, 25628, 65535, 65535, 25631, 65535, 65535,
+    58406, 58405, 25636, 65535, 65535, 65535, 65535, 58503, 25686, 58439, 58426, 58419, 58416, 25647, 65535, 65535,
+    25650, 65535, 65535, 25655, 25654, 65535, 65535, 25657, 65535, 65535, 25666, 25663, 25662, 65535, 65535, 25665,
+    65535, 65535, 25668, 65535, 25670, 65535, 65535, 25679, 25678, 25677, 25676, 65535, 65535, 65535, 65535, 25685,
+    25682, 65535, 25684, 65535, 65535, 65535, 58472, 58465, 58464, 25693, 58460, 65535, 65535, 25695, 65535, 65535,
+    65535, 58467, 65535, 25701, 65535, 25703, 65535, 65535, 25720, 58481, 58478, 58477, 65535, 65535, 25712, 65535,
+    65535, 25717, 58484, 65535, 65535, 58487, 65535, 65535, 58496, 25725, 58492, 65535, 65535, 58495, 65535, 65535,
+    25732, 25731, 65535, 65535, 58502, 65535, 65535, 25751, 58508, 25739, 65535, 65535, 58510, 65535, 58516, 58515,
+    58514, 65535, 65535, 65535, 58518, 65535, 65535, 58545, 25766, 58529, 25758, 25757, 65535, 65535, 25760, 65535,
+    65535, 25765, 25764, 65535, 65535, 65535, 25770, 25769, 65535, 65535, 25774, 25773, 65535, 65535, 25776, 65535,
+    65535, 25791, 58554, 58551, 58550, 65535, 65535, 58553, 65535, 65535, 58556, 65535, 58558, 65535, 65535, 58567,
+    25796, 25795, 65535, 65535, 25798, 65535, 65535, 58571, 25802, 65535, 65535, 25805, 65535, 65535, 58646, 58623,
+    58608, 58593, 58586, 25815, 25814, 65535, 65535, 25817, 65535, 65535, 25822, 25821, 65535, 65535, 25824, 65535,
+    65535, 25833, 25830, 58597, 65535, 65535, 58600, 65535, 65535, 25837, 25836, 65535, 65535, 25839, 65535, 65535,
+    25852, 25847, 25844, 65535, 25846, 65535, 65535, 25849, 65535, 25851, 65535, 65535, 25854, 65535, 65535, 25875,
+    25872, 25865, 25862, 25861, 65535, 65535, 25864, 65535, 65535, 25869, 58636, 65535, 65535, 25871, 65535, 65535,
+    58642, 65535, 65535, 58645, 65535, 65535, 25890, 58653, 25882, 65535, 58652, 65535, 65535, 58655, 65535, 58657,
+    65535, 65535, 25922, 58675, 25900, 25897, 58664, 65535, 65535, 58667, 65535, 65535, 58672, 58671, 65535, 65535,
+    58674, 65535, 65535, 58683, 25912, 58679, 65535, 65535, 58682, 65535, 65535, 25919, 25918, 65535, 65535, 58689,
+    65535, 65535, 58702, 25927, 25926, 65535, 65535, 25931, 25930, 65535, 65535, 25933, 65535, 65535, 25942, 58707,
+    25938, 65535, 65535, 58709, 65535, 65535, 58714, 25945, 65535, 65535, 25948, 65535, 65535, 58825, 58768, 58751,
+    58736, 58729, 25958, 58725, 65535, 65535, 25960, 65535, 65535, 25965, 25964, 65535, 65535, 25967, 65535, 65535,
+    25976, 58741, 25972, 65535, 65535, 25975, 65535, 65535, 25980, 25979, 65535, 65535, 25982, 65535, 65535, 25993,
+    25986, 65535, 25990, 25989, 65535, 65535, 25992, 65535, 65535, 25999, 25996, 65535, 25998, 65535, 65535, 65535,
+    26026, 58783, 26008, 26007, 58774, 65535, 65535, 65535, 26012, 58779, 65535, 65535, 58782, 65535, 65535, 26021,
+    58786, 65535, 26020, 65535, 65535, 26023, 65535, 26025, 65535, 65535, 58810, 26035, 26032, 26031, 65535, 65535,
+    58802, 65535, 65535, 26039, 58806, 65535, 65535, 26041, 65535, 65535, 58818, 26047, 58814, 65535, 65535, 26049,
+    65535, 65535, 26054, 26053, 65535, 65535, 26056, 65535, 65535, 26113, 58850, 26071, 26066, 26063, 65535, 26065,
+    65535, 65535, 58836, 65535, 26070, 65535, 65535, 26077, 58844, 58843, 65535, 65535, 65535, 58847, 65535, 26081,
+    65535, 65535, 58866, 26091, 26088, 58855, 65535, 65535, 58858, 65535, 65535, 26095, 26094, 65535, 65535, 58865,
+    65535, 65535, 58874, 26103, 26102, 65535, 65535, 26105, 65535, 65535, 26110, 58877, 65535, 65535, 58880, 65535,
+    65535, 26141, 26130, 58891, 58888, 58887, 65535, 65535, 26122, 65535, 65535, 58895, 58894, 65535, 65535, 26129,
+    65535, 65535, 58904, 58901, 65535, 58903, 65535, 65535, 58908, 58907, 65535, 65535, 65535, 58925, 58918, 26147,
+    58914, 65535, 65535, 58917, 65535, 65535, 26154, 26153, 65535, 65535, 26156, 65535, 65535, 26165, 26162, 58929,
+    65535, 65535, 58932, 65535, 65535, 26169, 58936, 65535, 65535, 65535, 26258, 26219, 26202, 26189, 26182, 26179,
+    26178, 65535, 65535, 58949, 65535, 65535, 58954, 26185, 65535, 65535, 58956, 65535, 65535, 58965, 26194, 58961,
+    65535, 65535, 58964, 65535, 65535, 58967, 65535, 58969, 65535, 65535, 58972, 65535, 58980, 58977, 58976, 65535,
+    65535, 58979, 65535, 65535, 58984, 58983, 65535, 65535, 58986, 65535, 65535, 58997, 58996, 58995, 58994, 58993,
+    65535, 65535, 65535, 65535, 65535, 59011, 59006, 26235, 59002, 65535, 65535, 59005, 65535, 65535, 26240, 65535,
+    59010, 65535, 65535, 59019, 26248, 59015, 65535, 65535, 59018, 65535, 65535, 59023, 59022, 65535, 65535, 59025,
+    65535, 65535, 26292, 59045, 59044, 59037, 59034, 59033, 65535, 65535, 26268, 65535, 65535, 26273, 59040, 65535,
+    65535, 59043, 65535, 65535, 65535, 59049, 26280, 65535, 65535, 59057, 59054, 59053, 65535, 65535, 26288, 65535,
+    65535, 59059, 65535, 65535, 59090, 26307, 59068, 26297, 65535, 59067, 65535, 65535, 59072, 26303, 65535, 65535,
+    59074, 65535, 65535, 59083, 26312, 59079, 65535, 65535, 59082, 65535, 65535, 59087, 26318, 65535, 65535, 26321,
+    65535, 65535, 59106, 59099, 26328, 26327, 65535, 65535, 26330, 65535, 65535, 26335, 59102, 65535, 65535, 26337,
+    65535, 65535, 59108, 65535, 65535, 59185, 59160, 59141, 26358, 26353, 26350, 26349, 65535, 65535, 26352, 65535,
+    65535, 59125, 59124, 65535, 65535, 65535, 26366, 59131, 59130, 65535, 65535, 59133, 65535, 65535, 26370, 59137,
+    65535, 65535, 59140, 65535, 65535, 26385, 26382, 26379, 26378, 65535, 65535, 26381, 65535, 65535, 26384, 65535,
+    65535, 26387, 65535, 26389, 65535, 26391, 65535, 65535, 26406, 26403, 26402, 26399, 26398, 65535, 65535, 26401,
+    65535, 65535, 65535, 26405, 65535, 65535, 26410, 26409, 65535, 65535, 26412, 65535, 26414, 65535, 26416, 65535,
+    65535, 59211, 26428, 26427, 26426, 26425, 26424, 65535, 65535, 65535, 65535, 65535, 26434, 26431, 65535, 26433,
+    65535, 65535, 26436, 65535, 26440, 26439, 65535, 65535, 26442, 65535, 65535, 59243, 26460, 26453, 26450, 26449,
+    65535, 65535, 59220, 65535, 65535, 59225, 59224, 65535, 65535, 59227, 65535, 65535, 26468, 59233, 26464, 65535,
+    65535, 59235, 65535, 65535, 26472, 59239, 65535, 65535, 26474, 65535, 65535, 26477, 65535, 59253, 26482, 26481,
+    65535, 65535, 26484, 65535, 65535, 59257, 26488, 65535, 65535, 26491, 65535, 65535, 59378, 59321, 59294, 59279,
+    59272, 59269, 59268, 65535, 65535, 26503, 65535, 65535, 26508, 26507, 65535, 65535, 26510, 65535, 65535, 26519,
+    26516, 26515, 65535, 65535, 26518, 65535, 65535, 26523, 59290, 65535, 65535, 59293, 65535, 65535, 26538, 26533,
+    26532, 26531, 65535, 65535, 65535, 26535, 65535, 26537, 65535, 65535, 26546, 26543, 26542, 65535, 65535, 26545,
+    65535, 65535, 26550, 26549, 65535, 65535, 26552, 65535, 65535, 59349, 59338, 59331, 26560, 59327, 65535, 65535,
+    26562, 65535, 65535, 26567, 26566, 65535, 65535, 26569, 65535, 65535, 26576, 26575, 26574, 65535, 65535, 65535,
+    26578, 65535, 26580, 65535, 65535, 59363, 26588, 26587, 26586, 65535, 65535, 65535, 26592, 59359, 65535, 65535,
+    59362, 65535, 65535, 26603, 59368, 26599, 65535, 65535, 26602, 65535, 65535, 59375, 59374, 65535, 65535, 26609,
+    65535, 65535, 26644, 26625, 26624, 26621, 59386, 26617, 65535, 65535, 26620, 65535, 65535, 59391, 65535, 65535,
+    65535, 26633, 59398, 26629, 65535, 65535, 26632, 65535, 65535, 26637, 59404, 65535, 65535, 59409, 26640, 65535,
+    65535, 26643, 65535, 65535, 26654, 26647, 65535, 59419, 26650, 65535, 65535, 26653, 65535, 65535, 65535, 59501,
+    59482, 26687, 26672, 59435, 26664, 59431, 65535, 65535, 59434, 65535, 65535, 26669, 65535, 59439, 65535, 65535,
+    26680, 26677, 59444, 65535, 65535, 59447, 65535, 65535, 26684, 26683, 65535, 65535, 26686, 65535, 65535, 59471,
+    59464, 59461, 59460, 65535, 65535, 26695, 65535, 65535, 26700, 26699, 65535, 65535, 26702, 65535, 65535, 26709,
+    26708, 26707, 65535, 65535, 65535, 26711, 65535, 59481, 65535, 65535, 26718, 26717, 65535, 65535, 26722, 26721,
+    65535, 65535, 26728, 26727, 26726, 65535, 65535, 65535, 26732, 26731, 65535, 65535, 65535, 26735, 65535, 26757,
+    59510, 26741, 26740, 65535, 65535, 65535, 59518, 26747, 26746, 65535, 65535, 59517, 65535, 65535, 59522, 26753,
+    65535, 65535, 59524, 65535, 65535, 59535, 26764, 26763, 26762, 65535, 65535, 65535, 26766, 65535, 65535, 59543,
+    26772, 26771, 65535, 65535, 26774, 65535, 65535, 59547, 26778, 65535, 65535, 26781, 65535, 65535, 26804, 59571,
+    26796, 59563, 59562, 26791, 26790, 65535, 65535, 59561, 65535, 65535, 65535, 65535, 59566, 65535, 59568, 65535,
+    59570, 65535, 65535, 65535, 26828, 59575, 65535, 59585, 26814, 59581, 59580, 65535, 65535, 65535, 59584, 65535,
+    65535, 26821, 59588, 65535, 65535, 59593, 26824, 65535, 65535, 26827, 65535, 65535, 26858, 59613, 59606, 26835,
+    59602, 65535, 65535, 59605, 65535, 65535, 26842, 26841, 65535, 65535, 26844, 65535, 65535, 59621, 26850, 26849,
+    65535, 65535, 26852, 65535, 65535, 26857, 26856, 65535, 65535, 65535, 26874, 59635, 59632, 59631, 65535, 65535,
+    26866, 65535, 65535, 59639, 26870, 65535, 65535, 26873, 65535, 65535, 59648, 26877, 65535, 59647, 65535, 65535,
+    59652, 26883, 65535, 65535, 59654, 65535, 65535, 59741, 59718, 26921, 26906, 26899, 26896, 59663, 65535, 65535,
+    59666, 65535, 65535, 59671, 59670, 65535, 65535, 26905, 65535, 65535, 59682, 59679, 59678, 65535, 65535, 26913,
+    65535, 65535, 59686, 26917, 65535, 65535, 59688, 65535, 65535, 59705, 59698, 26927, 59694, 65535, 65535, 59697,
+    65535, 65535, 26934, 26933, 65535, 65535, 26936, 65535, 65535, 26943, 26942, 59709, 65535, 65535, 65535, 59715,
+    26946, 65535, 65535, 26949, 65535, 65535, 26956, 26953, 65535, 26955, 65535, 65535, 26960, 26959, 65535, 65535,
+    26968, 26965, 26964, 65535, 65535, 26967, 65535, 65535, 26970, 65535, 26972, 65535, 65535, 26975, 65535, 27003,
+    59758, 26985, 59750, 26981, 65535, 65535, 26984, 65535, 65535, 59755, 65535, 59757, 65535, 65535, 59766, 26995,
+    59762, 65535, 65535, 59765, 65535, 65535, 59770, 27001, 65535, 65535, 65535, 59781, 27010, 27009, 27008, 65535,
+    65535, 65535, 27012, 65535, 65535, 59789, 27018, 27017, 65535, 65535, 27020, 65535, 65535, 59793, 27024, 65535,
+    65535, 59795, 65535, 65535, 27116, 27077, 27060, 27045, 27040, 27037, 27036, 65535, 65535, 59807, 65535, 65535,
+    59810, 65535, 59812, 65535, 65535, 59821, 27050, 59817, 65535, 65535, 59820, 65535, 65535, 59825, 27056, 65535,
+    65535, 59827, 65535, 65535, 59844, 27069, 59834, 59833, 65535, 65535, 59836, 65535, 65535, 59841, 59840, 65535,
+    65535, 59843, 65535, 65535, 65535, 59869, 59862, 59855, 59852, 59851, 65535, 65535, 27086, 65535, 65535, 59859,
+    27090, 65535, 65535, 27093, 65535, 65535, 27100, 27099, 27098, 65535, 65535, 65535, 65535, 27111, 27110, 27107,
+    59874, 65535, 65535, 59877, 65535, 65535, 65535, 59881, 65535, 59883, 65535, 65535, 59934, 59915, 59902, 59895,
+    59892, 59891, 65535, 65535, 27126, 65535, 65535, 59899, 27130, 65535, 65535, 59901, 65535, 65535, 27140, 27139,
+    27138, 65535, 65535, 65535, 27144, 27143, 65535, 65535, 27146, 65535, 65535, 27151, 27150, 65535, 65535, 27159,
+    27156, 27155, 65535, 65535, 27158, 65535, 65535, 59931, 27162, 65535, 65535, 27165, 65535, 65535, 27188, 59943,
+    27174, 27173, 27172, 65535, 65535, 65535, 65535, 59951, 27180, 27179, 65535, 65535, 27182, 65535, 65535, 27185,
+    65535, 59955, 65535, 65535, 27202, 59965, 27194, 59961, 65535, 65535, 59964, 65535, 65535, 27201, 27200, 65535,
+    65535, 65535, 59978, 59975, 27206, 65535, 65535, 27209, 65535, 65535, 27212, 65535, 65535, 60087, 27266, 60011,
+    27230, 59993, 59990, 27221, 65535, 65535, 27224, 65535, 65535, 27229, 27228, 65535, 65535, 65535, 60006, 60003,
+    27234, 65535, 65535, 60005, 65535, 65535, 27240, 65535, 27242, 65535, 65535, 27253, 27252, 60017, 27248, 65535,
+    65535, 27251, 65535, 65535, 65535, 27259, 27258, 27257, 65535, 65535, 65535, 60031, 60030, 65535, 65535, 27265,
+    65535, 65535, 60066, 60051, 60044, 60041, 60040, 65535, 65535, 27275, 65535, 65535, 27280, 60047, 65535, 65535,
+    27282, 65535, 65535, 27291, 60056, 27287, 65535, 65535, 27290, 65535, 65535, 27295, 60062, 65535, 65535, 60065,
+    65535, 65535, 27310, 60073, 27304, 27303, 65535, 65535, 65535, 27309, 27308, 65535, 65535, 65535, 60082, 27313,
+    65535, 65535, 27316, 65535, 60086, 65535, 65535, 60119, 27340, 27327, 27326, 27325, 65535, 65535, 65535, 27333,
+    27332, 27331, 65535, 65535, 65535, 27337, 27336, 65535, 65535, 27339, 65535, 65535, 27344, 27343, 65535, 65535,
+    27350, 27349, 27348, 65535, 65535, 65535, 65535, 60141, 27358, 27357, 27356, 65535, 65535, 65535, 27366, 27363,
+    27362, 65535, 65535, 27365, 65535, 65535, 27370, 27369, 65535, 65535, 27372, 65535, 65535, 60157, 27382, 27379,
+    60146, 65535, 65535, 27381, 65535, 65535, 27386, 27385, 65535, 65535, 27388, 65535, 65535, 60165, 27394, 27393,
+    65535, 65535, 27396, 65535, 65535, 60169, 27400, 65535, 65535, 27403, 65535, 65535, 27482, 27449, 60202, 60189,
+    60184, 27413, 27412, 65535, 65535, 60183, 65535, 65535, 27420, 27419, 65535, 65535, 65535, 27427, 27424, 65535,
+    27426, 65535, 65535, 27431, 27430, 65535, 65535, 27433, 65535, 65535, 27436, 65535, 27442, 60207, 65535, 60209,
+    65535, 65535, 60214, 27445, 65535, 65535, 60216, 65535, 65535, 60235, 60234, 60227, 60224, 60223, 65535, 65535,
+    60226, 65535, 65535, 60231, 27462, 65535, 65535, 60233, 65535, 65535, 65535, 27477, 27474, 60241, 60240, 65535,
+    65535, 65535, 60244, 65535, 65535, 60247, 65535, 60249, 65535, 65535, 60286, 60277, 60266, 60261, 60258, 60257,
+    65535, 65535, 27492, 65535, 65535, 27495, 65535, 27497, 65535, 65535, 60270, 27501, 65535, 65535, 60274, 27505,
+    65535, 65535, 27508, 65535, 65535, 27511, 65535, 27515, 27514, 65535, 65535, 27517, 65535, 65535, 27524, 60289,
+    65535, 60291, 65535, 65535, 27528, 60295, 65535, 65535, 60304, 27533, 27532, 65535, 65535, 60303, 65535, 65535,
+    27540, 60307, 65535, 65535, 60310, 65535, 65535, 27625, 27592, 27575, 27562, 27555, 27552, 27551, 65535, 65535,
+    60322, 65535, 65535, 60327, 27558, 65535, 65535, 60329, 65535, 65535, 60338, 27567, 60334, 65535, 65535, 60337,
+    65535, 65535, 27572, 65535, 60342, 65535, 65535, 60353, 60348, 60347, 65535, 65535, 60352, 60351, 65535, 65535,
+    65535, 60359, 60358, 60357, 65535, 65535, 65535, 65535, 60388, 27607, 60370, 27599, 60366, 65535, 65535, 60369,
+    65535, 65535, 60374, 27605, 65535, 65535, 65535, 60383, 60380, 60379, 65535, 65535, 27614, 65535, 65535, 60385,
+    65535, 27619, 65535, 65535, 27622, 65535, 60392, 65535, 65535, 60441, 60418, 60411, 60404, 27633, 60400, 65535,
+    65535, 60403, 65535, 65535, 60408, 27639, 65535, 65535, 27642, 65535, 65535, 27645, 65535, 27649, 27648, 65535,
+    65535, 65535, 60428, 27653, 65535, 27657, 27656, 65535, 65535, 27659, 65535, 65535, 60436, 27665, 27664, 65535,
+    65535, 27667, 65535, 65535, 27670, 65535, 27672, 65535, 65535, 60457, 27678, 27677, 65535, 65535, 27686, 27683,
+    27682, 65535, 65535, 27685, 65535, 65535, 27688, 65535, 65535, 60471, 27696, 60461, 65535, 60463, 65535, 65535,
+    60468, 27699, 65535, 65535, 27702, 65535, 65535, 27707, 60474, 65535, 65535, 27711, 60478, 65535, 65535, 60481,
+    65535, 65535, 27822, 27773, 27742, 27733, 27726, 27723, 27722, 65535, 65535, 60493, 65535, 65535, 60498, 60497,
+    65535, 65535, 60500, 65535, 65535, 60509, 27738, 60505, 65535, 65535, 60508, 65535, 65535, 65535, 60526, 60519,
+    60516, 60515, 65535, 65535, 27750, 65535, 65535, 27755, 60522, 65535, 65535, 60525, 65535, 65535, 60534, 27763,
+    27762, 65535, 65535, 27765, 65535, 65535, 60538, 27769, 65535, 65535, 60540, 65535, 65535, 60571, 27788, 60551,
+    60548, 27779, 65535, 65535, 27782, 65535, 65535, 60555, 27786, 65535, 65535, 65535, 60564, 60561, 27792, 65535,
+    65535, 27795, 65535, 65535, 60568, 60567, 65535, 65535, 60570, 65535, 65535, 27809, 60576, 27807, 65535, 65535,
+    65535, 60585, 60582, 27813, 65535, 65535, 60584, 65535, 65535, 60589, 27820, 65535, 65535, 65535, 60610, 60603,
+    27832, 60599, 60598, 60597, 65535, 65535, 65535, 65535, 60602, 65535, 65535, 60605, 65535, 27841, 27840, 65535,
+    65535, 65535, 60642, 27859, 27852, 27849, 27848, 65535, 65535, 60619, 65535, 65535, 60624, 60623, 65535, 65535,
+    60626, 65535, 65535, 27867, 60632, 27863, 65535, 65535, 27866, 65535, 65535, 27871, 60638, 65535, 65535, 60641,
+    65535, 65535, 60656, 27883, 27880, 27879, 65535, 65535, 27882, 65535, 65535, 27887, 27886, 65535, 65535, 65535,
+    27896, 60661, 27892, 65535, 65535, 27895, 65535, 65535, 27900, 60667, 65535, 65535, 27902, 65535, 65535, 60791,
+    60730, 60705, 60690, 60683, 60680, 60679, 65535, 65535, 27914, 65535, 65535, 27919, 27918, 65535, 65535, 27921,
+    65535, 65535, 27930, 27927, 60694, 65535, 65535, 27929, 65535, 65535, 27934, 60701, 65535, 65535, 60704, 65535,
+    65535, 27949, 27944, 27943, 27942, 65535, 65535, 65535, 27946, 65535, 27948, 65535, 65535, 27955, 27954, 27953,
+    65535, 65535, 65535, 27959, 27958, 65535, 65535, 27961, 65535, 65535, 27992, 27979, 60740, 60737, 27968, 65535,
+    65535, 27971, 65535, 65535, 27976, 60743, 65535, 65535, 27978, 65535, 65535, 60753, 60752, 60751, 65535, 65535,
+    65535, 60757, 60756, 65535, 65535, 60759, 65535, 65535, 28008, 60769, 60766, 27997, 65535, 65535, 28000, 65535,
+    65535, 60773, 28004, 65535, 65535, 60775, 65535, 65535, 28016, 60781, 60780, 65535, 65535, 60783, 65535, 65535,
+    28020, 60787, 65535, 65535, 60790, 65535, 65535, 28077, 28048, 60803, 28032, 28031, 28030, 65535, 65535, 65535,
+    28034, 65535, 65535, 60809, 28040, 28039, 65535, 65535, 65535, 28045, 60812, 65535, 65535, 60815, 65535, 65535,
+    60830, 28055, 28052, 65535, 28054, 65535, 65535, 28059, 28058, 65535, 65535, 28061, 65535, 65535, 28070, 60835,
+    60834, 65535, 65535, 60837, 65535, 65535, 28074, 60841, 65535, 65535, 60844, 65535, 65535, 60857, 28086, 60853,
+    28084, 60851, 65535, 65535, 65535, 65535, 60856, 65535, 65535, 60861, 60860, 65535, 65535, 65535, 28184, 28147,
+    28126, 28113, 28106, 28103, 28102, 65535, 65535, 60873, 65535, 65535, 60878, 60877, 65535, 65535, 60880, 65535,
+    65535, 60887, 60886, 60885, 65535, 65535, 65535, 60891, 60890, 65535, 65535, 60893, 65535, 65535, 60910, 60903,
+    28132, 60899, 65535, 65535, 60902, 65535, 65535, 28139, 60906, 65535, 65535, 60909, 65535, 65535, 60914, 28145,
+    65535, 65535, 65535, 60939, 60924, 60921, 60920, 65535, 65535, 28155, 65535, 65535, 28164, 60929, 28160, 65535,
+    65535, 60931, 65535, 65535, 60936, 28167, 65535, 65535, 60938, 65535, 65535, 60947, 60944, 28175, 65535, 65535,
+    28178, 65535, 65535, 60949, 65535, 60951, 65535, 65535, 60996, 60985, 60970, 28195, 60960, 60959, 65535, 65535,
+    28194, 65535, 65535, 60967, 60966, 65535, 65535, 28201, 65535, 65535, 28210, 28207, 60974, 65535, 65535, 60977,
+    65535, 65535, 60982, 28213, 65535, 65535, 60984, 65535, 65535, 28225, 60990, 28221, 65535, 65535, 28224, 65535,
+    65535, 60995, 65535, 65535, 28244, 61009, 28236, 61003, 61002, 65535, 65535, 65535, 61006, 65535, 61008, 65535,
+    65535, 61011, 65535, 65535, 65535, 61087, 61060, 28271, 28262, 61025, 28254, 28253, 65535, 65535, 61024, 65535,
+    65535, 28261, 28260, 65535, 65535, 65535, 61036, 61035, 61034, 65535, 65535, 65535, 61038, 65535, 65535, 61053,
+    61048, 28277, 61044, 65535, 65535, 28279, 65535, 65535, 28282, 65535, 28284, 65535, 65535, 28287, 65535, 28289,
+    65535, 28291, 65535, 65535, 28312, 28301, 28296, 65535, 28298, 65535, 28300, 65535, 65535, 28307, 28306, 28305,
+    65535, 65535, 65535, 28311, 28310, 65535, 65535, 65535, 28314, 65535, 28316, 65535, 28318, 65535, 65535, 28321,
+    65535, 28327, 61092, 65535, 61094, 65535, 65535, 61109, 28334, 28333, 28332, 65535, 65535, 65535, 28338, 28337,
+    65535, 65535, 28340, 65535, 65535, 61115, 28344, 65535, 28346, 65535, 65535, 28351, 61118, 65535, 65535, 28353,
+    65535, 65535, 28378, 61145, 28370, 61137, 61134, 28363, 61130, 65535, 65535, 61133, 65535, 65535, 61136, 65535,
+    65535, 65535, 61140, 65535, 61142, 65535, 61144, 65535, 65535, 65535, 28406, 61149, 65535, 61159, 28388, 61155,
+    61154, 65535, 65535, 65535, 61158, 65535, 65535, 28399, 61164, 28395, 65535, 65535, 28398, 65535, 65535, 61171,
+    28402, 65535, 65535, 61173, 65535, 65535, 28438, 28423, 61184, 61181, 28412, 65535, 65535, 61183, 65535, 65535,
+    61188, 61187, 65535, 65535, 61190, 65535, 65535, 61199, 28428, 61195, 65535, 65535, 61198, 65535, 65535, 61203,
+    28434, 65535, 65535, 61205, 65535, 65535, 28454, 61215, 61212, 61211, 65535, 65535, 28446, 65535, 65535, 61219,
+    28450, 65535, 65535, 61221, 65535, 65535, 61228, 28459, 28458, 65535, 65535, 65535, 61232, 28463, 65535, 65535,
+    61234, 65535, 65535, 61303, 61280, 28493, 28486, 61247, 28476, 28475, 65535, 65535, 28478, 65535, 65535, 28483,
+    28482, 65535, 65535, 28485, 65535, 65535, 28488, 65535, 61258, 65535, 61260, 65535, 65535, 28499, 61266, 61265,
+    65535, 65535, 65535, 28505, 61272, 61271, 65535, 65535, 65535, 61277, 61276, 65535, 65535, 28511, 65535, 65535,
+    28524, 28523, 28518, 28517, 65535, 65535, 28522, 28521, 65535, 65535, 65535, 65535, 28526, 65535, 28528, 65535,
+    28532, 28531, 65535, 65535, 28534, 65535, 65535, 61331, 28556, 28549, 28546, 28543, 28542, 65535, 65535, 28545,
+    65535, 65535, 28548, 65535, 65535, 28551, 65535, 28555, 28554, 65535, 65535, 65535, 28560, 28559, 65535, 65535,
+    28562, 65535, 65535, 28575, 61340, 28571, 61338, 61337, 65535, 65535, 65535, 65535, 61342, 65535, 65535, 61351,
+    28578, 65535, 28580, 65535, 28582, 65535, 65535, 61357, 28586, 65535, 28588, 65535, 65535, 28593, 61360, 65535,
+    65535, 28595, 65535, 65535, 61474, 61425, 61398, 61383, 61376, 61373, 28604, 65535, 65535, 28607, 65535, 65535,
+    28612, 61379, 65535, 65535, 28614, 65535, 65535, 28623, 28620, 28619, 65535, 65535, 28622, 65535, 65535, 28627,
+    61394, 65535, 65535, 28629, 65535, 65535, 28642, 28637, 28636, 28635, 65535, 65535, 65535, 28639, 65535, 28641,
+    65535, 65535, 28650, 28647, 28646, 65535, 65535, 28649, 65535, 65535, 28654, 28653, 65535, 65535, 28656, 65535,
+    65535, 61447, 28666, 61433, 28662, 65535, 28664, 65535, 65535, 65535, 28672, 28671, 28670, 65535, 65535, 65535,
+    28676, 28675, 65535, 65535, 28678, 65535, 65535, 61459, 28686, 28685, 28684, 65535, 65535, 65535, 28688, 65535,
+    28690, 65535, 65535, 61467, 28696, 28695, 65535, 65535, 28698, 65535, 65535, 28703, 28702, 65535, 65535, 28705,
+    65535, 65535, 28714, 61479, 28710, 65535, 65535, 28713, 65535, 65535, 28728, 28719, 61486, 65535, 65535, 61491,
+    28722, 65535, 65535, 28725, 65535, 28727, 65535, 65535, 28736, 61501, 28732, 65535, 65535, 28735, 65535, 65535,
+    28740, 61507, 65535, 65535, 28744, 28743, 65535, 65535, 28746, 65535, 65535, 28841, 28806, 61543, 28764, 61527,
+    61524, 61523, 65535, 65535, 28758, 65535, 65535, 28763, 28762, 65535, 65535, 65535, 61538, 61537, 61536, 65535,
+    65535, 65535, 61540, 65535, 61542, 65535, 65535, 61559, 28784, 28781, 28780, 65535, 65535, 61551, 65535, 65535,
+    28788, 28787, 65535, 65535, 61558, 65535, 65535, 28799, 28796, 28795, 65535, 65535, 61566, 65535, 65535, 61571,
+    61570, 65535, 65535, 61573, 65535, 65535, 61582, 28809, 65535, 61581, 61580, 65535, 65535, 65535, 61596, 61589,
+    61586, 65535, 28820, 65535, 65535, 61593, 61592, 65535, 65535, 61595, 65535, 65535, 61602, 61599, 65535, 28833,
+    65535, 65535, 61606, 61605, 65535, 65535, 61608, 65535, 65535, 61647, 61640, 28857, 61618, 61615, 65535, 28849,
+    65535, 65535, 61622, 61621, 65535, 65535, 61624, 65535, 65535, 61633, 28862, 61629, 65535, 65535, 61632, 65535,
+    65535, 61637, 61636, 65535, 65535, 61639, 65535, 65535, 28878, 28877, 28876, 65535, 65535, 65535, 65535, 28905,
+    28890, 61651, 65535, 61655, 61654, 65535, 65535, 61657, 65535, 65535, 28898, 28895, 61662, 65535, 65535, 61665,
+    65535, 65535, 28902, 61669, 65535, 65535, 61672, 65535, 65535, 61683, 28908, 65535, 28912, 61679, 65535, 65535,
+    61682, 65535, 65535, 61691, 28920, 61687, 65535, 65535, 61690, 65535, 65535, 65535, 61784, 28971, 28958, 28943,
+    28936, 28933, 61700, 65535, 65535, 61703, 65535, 65535, 28940, 61707, 65535, 65535, 61710, 65535, 65535, 61719,
+    28948, 61715, 65535, 65535, 61718, 65535, 65535, 28955, 61722, 65535, 65535, 61725, 65535, 65535, 61738, 61733,
+    61732, 61731, 65535, 65535, 65535, 61735, 65535, 61737, 65535, 65535, 65535, 61763, 61754, 61749, 61746, 61745,
+    65535, 65535, 28980, 65535, 65535, 28983, 65535, 28985, 65535, 65535, 28988, 65535, 61760, 28991, 65535, 65535,
+    28994, 65535, 65535, 29001, 61766, 65535, 61768, 65535, 65535, 61777, 61774, 61773, 65535, 65535, 29008, 65535,
+    65535, 29013, 61780, 65535, 65535, 61783, 65535, 65535, 29048, 61803, 61798, 61793, 29024, 29023, 65535, 65535,
+    65535, 29027, 65535, 29029, 65535, 65535, 29034, 29033, 65535, 65535, 65535, 61815, 29042, 61809, 29040, 65535,
+    65535, 65535, 61812, 65535, 61814, 65535, 65535, 65535, 29068, 61825, 61824, 61823, 61822, 65535, 65535, 65535,
+    65535, 61831, 61830, 61829, 65535, 65535, 65535, 61833, 65535, 61835, 65535, 65535, 61852, 29077, 61842, 29073,
+    65535, 65535, 29076, 65535, 65535, 61849, 29080, 65535, 65535, 29083, 65535, 65535, 61860, 29089, 29088, 65535,
+    65535, 29091, 65535, 65535, 61864, 29095, 65535, 65535, 61866, 65535, 65535, 61935, 61918, 61899, 29118, 29111,
+    61876, 29107, 65535, 65535, 29110, 65535, 65535, 61883, 61882, 65535, 65535, 61885, 65535, 65535, 29124, 61891,
+    61890, 65535, 65535, 65535, 29128, 61895, 65535, 65535, 29130, 65535, 65535, 29143, 29140, 29137, 29136, 65535,
+    65535, 29139, 65535, 65535, 29142, 65535, 65535, 29145, 65535, 29147, 65535, 29149, 65535, 65535, 29162, 29161,
+    29160, 29157, 29156, 65535, 65535, 29159, 65535, 65535, 65535, 65535, 29164, 65535, 29166, 65535, 65535, 61963,
+    29188, 29181, 29178, 29175, 29174, 65535, 65535, 29177, 65535, 65535, 29180, 65535, 65535, 29183, 65535, 29187,
+    29186, 65535, 65535, 65535, 29192, 29191, 65535, 65535, 29194, 65535, 65535, 61993, 29212, 29205, 61970, 29201,
+    65535, 65535, 61972, 65535, 65535, 61977, 29208, 65535, 65535, 61979, 65535, 65535, 61988, 61985, 29216, 65535,
+    65535, 29219, 65535, 65535, 29222, 65535, 29224, 65535, 65535, 29227, 65535, 62003, 29232, 29231, 65535, 65535,
+    29234, 65535, 65535, 29239, 62006, 65535, 65535, 62009, 65535, 65535, 29342, 29295, 29276, 29261, 29254, 29251,
+    29250, 65535, 65535, 62021, 65535, 65535, 62026, 62025, 65535, 65535, 29260, 65535, 65535, 62037, 62034, 62033,
+    65535, 65535, 62036, 65535, 65535, 62041, 62040, 65535, 65535, 62043, 65535, 65535, 62048, 62047, 65535, 65535,
+    62056, 62053, 62052, 65535, 65535, 62055, 65535, 65535, 62060, 62059, 65535, 65535, 62062, 65535, 65535, 62079,
+    29302, 62067, 65535, 29301, 65535, 65535, 62072, 65535, 62076, 62075, 65535, 65535, 62078, 65535, 65535, 62095,
+    62088, 29317, 29316, 65535, 65535, 62087, 65535, 65535, 62092, 29323, 65535, 65535, 62094, 65535, 65535, 62103,
+    62100, 29331, 65535, 65535, 62102, 65535, 65535, 62107, 29338, 65535, 65535, 29341, 65535, 65535, 29400, 62139,
+    29358, 62119, 29350, 29349, 65535, 65535, 65535, 29355, 62122, 65535, 65535, 29357, 65535, 65535, 62134, 62131,
+    29362, 65535, 65535, 29365, 65535, 65535, 29370, 29369, 65535, 65535, 65535, 62153, 29380, 62145, 62144, 65535,
+    65535, 29379, 65535, 65535, 29384, 62151, 65535, 65535, 65535, 29393, 62158, 62157, 65535, 65535, 29392, 65535,
+    65535, 62165, 29396, 65535, 65535, 62167, 65535, 65535, 62194, 62185, 62178, 62175, 62174, 65535, 65535, 29409,
+    65535, 65535, 62182, 29413, 65535, 65535, 62184, 65535, 65535, 29419, 65535, 29423, 29422, 65535, 65535, 29425,
+    65535, 65535, 29432, 62197, 65535, 62199, 65535, 65535, 62208, 62205, 29436, 65535, 65535, 29439, 65535, 65535,
+    29444, 29443, 65535, 65535, 29446, 65535, 65535, 29543, 29500, 29479, 29466, 29459, 29456, 29455, 65535, 65535,
+    62226, 65535, 65535, 62231, 62230, 65535, 65535, 62233, 65535, 65535, 62240, 62237, 65535, 62239, 65535, 65535,
+    62244, 62243, 65535, 65535, 62246, 65535, 65535, 62263, 62256, 29485, 62252, 65535, 65535, 62255, 65535, 65535,
+    29492, 62259, 65535, 65535, 62262, 65535, 65535, 62267, 29498, 65535, 65535, 65535, 62298, 29515, 62276, 29505,
+    65535, 62275, 65535, 65535, 62280, 62279, 65535, 65535, 62282, 65535, 65535, 62291, 62288, 29519, 65535, 65535,
+    29522, 65535, 65535, 29527, 62294, 65535, 65535, 62297, 65535, 65535, 62306, 62303, 29534, 65535, 65535, 29537,
+    65535, 65535, 62308, 65535, 62310, 65535, 65535, 62345, 29558, 62315, 65535, 62319, 29550, 65535, 65535, 62323,
+    29554, 65535, 65535, 62325, 65535, 65535, 62342, 62335, 29564, 62331, 65535, 65535, 29566, 65535, 65535, 29571,
+    62338, 65535, 65535, 62341, 65535, 65535, 62344, 65535, 65535, 29597, 62358, 62351, 29582, 65535, 65535, 29587,
+    62354, 65535, 65535, 62357, 65535, 65535, 29596, 62361, 65535, 62363, 65535, 65535, 65535, 62367, 65535, 65535,
+    62464, 62433, 62402, 29619, 62380, 29609, 62376, 65535, 65535, 29611, 65535, 65535, 29616, 29615, 65535, 65535,
+    29618, 65535, 65535, 62395, 62392, 29623, 65535, 65535, 29626, 65535, 65535, 62399, 29630, 65535, 65535, 29633,
+    65535, 65535, 29650, 29643, 29640, 29639, 65535, 65535, 29642, 65535, 65535, 62415, 29646, 65535, 65535, 29649,
+    65535, 65535, 29658, 62423, 29654, 65535, 65535, 29657, 65535, 65535, 29662, 29661, 65535, 65535, 29664, 65535,
+    65535, 29677, 29676, 29673, 29670, 65535, 62440, 65535, 65535, 62443, 65535, 65535, 65535, 29685, 29680, 65535,
+    29684, 29683, 65535, 65535, 65535, 29689, 62456, 65535, 65535, 29693, 29692, 65535, 65535, 62463, 65535, 65535,
+    62498, 29719, 29704, 29703, 29702, 65535, 65535, 65535, 29712, 29709, 29708, 65535, 65535, 29711, 65535, 65535,
+    29716, 29715, 65535, 65535, 29718, 65535, 65535, 29723, 29722, 65535, 65535, 29729, 29728, 29727, 65535, 65535,
+    65535, 65535, 29762, 29747, 62508, 62505, 62504, 65535, 65535, 62507, 65535, 65535, 62512, 29743, 65535, 65535,
+    62514, 65535, 65535, 62523, 62520, 29751, 65535, 65535, 62522, 65535, 65535, 62527, 62526, 65535, 65535, 62529,
+    65535, 65535, 62540, 29765, 65535, 29769, 29768, 65535, 65535, 29771, 65535, 65535, 29778, 62543, 65535, 62545,
+    65535, 65535, 62550, 29781, 65535, 65535, 62552, 65535, 65535, 29875, 29836, 29819, 29804, 29797, 29794, 29793,
+    65535, 65535, 62564, 65535, 65535, 62569, 62568, 65535, 65535, 29803, 65535, 65535, 62580, 62577, 62576, 65535,
+    65535, 62579, 65535, 65535, 62584, 62583, 65535, 65535, 62586, 65535, 65535, 62589, 65535, 62597, 62594, 62593,
+    65535, 65535, 62596, 65535, 65535, 29833, 62600, 65535, 65535, 29835, 65535, 65535, 62630, 62615, 62610, 62609,
+    65535, 65535, 62612, 65535, 62614, 65535, 65535, 62623, 29852, 62619, 65535, 65535, 62622, 65535, 65535, 29859,
+    62626, 65535, 65535, 62629, 65535, 65535, 62638, 62635, 29866, 65535, 65535, 29869, 65535, 65535, 62640, 65535,
+    62642, 65535, 65535, 62679, 62654, 29883, 29882, 29881, 65535, 65535, 65535, 62653, 65535, 65535, 62668, 62663,
+    29892, 62659, 65535, 65535, 29894, 65535, 65535, 29899, 62666, 65535, 65535, 65535, 29908, 62673, 29904, 65535,
+    65535, 29907, 65535, 65535, 62678, 65535, 65535, 29929, 62692, 62689, 29918, 62685, 65535, 65535, 62688, 65535,
+    65535, 29923, 65535, 65535, 62694, 65535, 62696, 65535, 65535, 65535, 62796, 62763, 29964, 62717, 62710, 29939,
+    29938, 65535, 65535, 29941, 65535, 65535, 29946, 29945, 65535, 65535, 62716, 65535, 65535, 62725, 29954, 62721,
+    65535, 65535, 29956, 65535, 65535, 29961, 29960, 65535, 65535, 62731, 65535, 65535, 29980, 62741, 62738, 62737,
+    65535, 65535, 62740, 65535, 65535, 62745, 62744, 65535, 65535, 62747, 65535, 65535, 29988, 62753, 62752, 65535,
+    65535, 62755, 65535, 65535, 62760, 62759, 65535, 65535, 29994, 65535, 65535, 30009, 30008, 30005, 30002, 30001,
+    65535, 65535, 30004, 65535, 65535, 62775, 65535, 65535, 65535, 30017, 30016, 30015, 30014, 65535, 65535, 65535,
+    65535, 30021, 62788, 65535, 65535, 30025, 30024, 65535, 65535, 30027, 65535, 65535, 62830, 30051, 30036, 30035,
+    30034, 65535, 65535, 65535, 30044, 30041, 30040, 65535, 65535, 30043, 65535, 65535, 30048, 30047, 65535, 65535,
+    30050, 65535, 65535, 30055, 30054, 65535, 65535, 30061, 30060, 30059, 65535, 65535, 65535, 65535, 62852, 30071,
+    30070, 30067, 65535, 30069, 65535, 65535, 65535, 30077, 30076, 30075, 65535, 65535, 65535, 30081, 30080, 65535,
+    65535, 30083, 65535, 65535, 30094, 62861, 30090, 62857, 65535, 65535, 62860, 65535, 65535, 65535, 30100, 62865,
+    65535, 62867, 65535, 65535, 62872, 30103, 65535, 65535, 62874, 65535, 65535, 30193, 30160, 62903, 30126, 30119,
+    30116, 30115, 65535, 65535, 62886, 65535, 65535, 62891, 62890, 65535, 65535, 62893, 65535, 65535, 62902, 62899,
+    62898, 65535, 65535, 62901, 65535, 65535, 65535, 30151, 30144, 30141, 62908, 65535, 65535, 62911, 65535, 65535,
+    62916, 30147, 65535, 65535, 62918, 65535, 65535, 62921, 65535, 62925, 62924, 65535, 65535, 62927, 65535, 65535,
+    62946, 62945, 62938, 62935, 62934, 65535, 65535, 62937, 65535, 65535, 62942, 30173, 65535, 65535, 62944, 65535,
+    65535, 65535, 30188, 30185, 62952, 62951, 65535, 65535, 65535, 62955, 65535, 65535, 62958, 65535, 62960, 65535,
+    65535, 62995, 62986, 62977, 62972, 62969, 62968, 65535, 65535, 30203, 65535, 65535, 30206, 65535, 30208, 65535,
+    65535, 30215, 30212, 65535, 30214, 65535, 65535, 30217, 65535, 65535, 30220, 65535, 30222, 65535, 30224, 65535,
+    30226, 65535, 65535, 63001, 30230, 65535, 30232, 65535, 65535, 63007, 30236, 65535, 30238, 65535, 65535, 63015,
+    63012, 63011, 65535, 65535, 30246, 65535, 65535, 30251, 63018, 65535, 65535, 63021, 65535, 65535, 63108, 63081,
+    30284, 30273, 30266, 30263, 63030, 65535, 65535, 63033, 65535, 65535, 63038, 63037, 65535, 65535, 63040, 65535,
+    65535, 30277, 63044, 65535, 65535, 63049, 63048, 65535, 65535, 63051, 65535, 65535, 63068, 30293, 63058, 63057,
+    65535, 65535, 30292, 65535, 65535, 63065, 63064, 65535, 65535, 30299, 65535, 65535, 30308, 30305, 30304, 65535,
+    65535, 30307, 65535, 65535, 30310, 65535, 30312, 65535, 65535, 30331, 30318, 63085, 65535, 65535, 30324, 63091,
+    30322, 65535, 65535, 65535, 30328, 30327, 65535, 65535, 30330, 65535, 65535, 30333, 65535, 30335, 65535, 30337,
+    65535, 30339, 65535, 65535, 30342, 65535, 30370, 63123, 30348, 63115, 65535, 65535, 30352, 63119, 65535, 65535,
+    63122, 65535, 65535, 30363, 63128, 30359, 65535, 65535, 63130, 65535, 65535, 63135, 63134, 65535, 65535, 30369,
+    65535, 65535, 63154, 30379, 63144, 30375, 65535, 65535, 30378, 65535, 65535, 30383, 63150, 65535, 65535, 30385,
+    65535, 65535, 30394, 30391, 63158, 65535, 65535, 30393, 65535, 65535, 30396, 65535, 63166, 65535, 65535, 63239,
+    63224, 30427, 30416, 63177, 30408, 30407, 65535, 65535, 65535, 63181, 30412, 65535, 65535, 30415, 65535, 65535,
+    30422, 63187, 65535, 30421, 65535, 65535, 30424, 65535, 63194, 65535, 65535, 63211, 63204, 30433, 63200, 65535,
+    65535, 63203, 65535, 65535, 30440, 30439, 65535, 65535, 30442, 65535, 65535, 30451, 30448, 63215, 65535, 65535,
+    63218, 65535, 65535, 30453, 65535, 63223, 65535, 65535, 30460, 30459, 65535, 65535, 30468, 30467, 30464, 65535,
+    30466, 65535, 65535, 65535, 30470, 65535, 65535, 30483, 63242, 65535, 63250, 63249, 63248, 63247, 65535, 65535,
+    65535, 65535, 65535, 63269, 30494, 30493, 30490, 63257, 65535, 65535, 30492, 65535, 65535, 65535, 30496, 65535,
+    30498, 65535, 30500, 65535, 65535, 63281, 30508, 30507, 30506, 65535, 65535, 65535, 30510, 65535, 30512, 65535,
+    65535, 63289, 30518, 30517, 65535, 65535, 30520, 65535, 65535, 30525, 63292, 65535, 65535, 30527, 65535, 65535,
+    30612, 30587, 63324, 30545, 63308, 63305, 63304, 65535, 65535, 30539, 65535, 65535, 30544, 30543, 65535, 65535,
+    65535, 63319, 63318, 63317, 65535, 65535, 65535, 63321, 65535, 63323, 65535, 65535, 63340, 30565, 30562, 30561,
+    65535, 65535, 63332, 65535, 65535, 30569, 30568, 65535, 65535, 30571, 65535, 65535, 30580, 63345, 30576, 65535,
+    65535, 63347, 65535, 65535, 63352, 63351, 65535, 65535, 30586, 65535, 65535, 63361, 63358, 65535, 63360, 65535,
+    65535, 63369, 63368, 63365, 65535, 63367, 65535, 65535, 65535, 63373, 63372, 65535, 65535, 63377, 63376, 65535,
+    65535, 63379, 65535, 65535, 30644, 63383, 65535, 30631, 63392, 30621, 63388, 65535, 65535, 63391, 65535, 65535,
+    63396, 30627, 65535, 65535, 63398, 65535, 65535, 63407, 63404, 63403, 65535, 65535, 63406, 65535, 65535, 63409,
+    65535, 63411, 65535, 65535, 30670, 63425, 63422, 63419, 63418, 65535, 65535, 30653, 65535, 65535, 30656, 65535,
+    65535, 63431, 63430, 63429, 65535, 65535, 65535, 63435, 30666, 65535, 65535, 63437, 65535, 65535, 30686, 63447,
+    63444, 63443, 65535, 65535, 63446, 65535, 65535, 63451, 30682, 65535, 65535, 63453, 65535, 65535, 30694, 63459,
+    63458, 65535, 65535, 30693, 65535, 65535, 30698, 63465, 65535, 65535, 63468, 65535, 65535, 30803, 30754, 30735,
+    30720, 30713, 30710, 30709, 65535, 65535, 63480, 65535, 65535, 63485, 63484, 65535, 65535, 63487, 65535, 65535,
+    63496, 30725, 30724, 65535, 65535, 63495, 65535, 65535, 63500, 30731, 65535, 65535, 63502, 65535, 65535, 63515,
+    63508, 63507, 65535, 65535, 63512, 63511, 65535, 65535, 63514, 65535, 65535, 63521, 63520, 63519, 65535, 65535,
+    65535, 65535, 63550, 30769, 63532, 63529, 30760, 65535, 65535, 30763, 65535, 65535, 63536, 30767, 65535, 65535,
+    65535, 63545, 63542, 63541, 65535, 65535, 30776, 65535, 65535, 63547, 65535, 30781, 65535, 65535, 30788, 63555,
+    30786, 65535, 65535, 65535, 63564, 63561, 30792, 65535, 65535, 63563, 65535, 65535, 30800, 63567, 65535, 65535,
+    63570, 65535, 65535, 63591, 63584, 30813, 63580, 63579, 63578, 65535, 65535, 65535, 65535, 63583, 65535, 65535,
+    63586, 65535, 30820, 65535, 30822, 65535, 65535, 63623, 30840, 63601, 30830, 30829, 65535, 65535, 30832, 65535,
+    65535, 30837, 63604, 65535, 65535, 63607, 65535, 65535, 30848, 63613, 63612, 65535, 65535, 63615, 65535, 65535,
+    30852, 63619, 65535, 65535, 30854, 65535, 65535, 63635, 30862, 30861, 30860, 65535, 65535, 65535, 30866, 30865,
+    65535, 65535, 65535, 30873, 63640, 30871, 65535, 65535, 65535, 30877, 63644, 65535, 65535, 63647, 65535, 65535,
+    30898, 63665, 30894, 63661, 63660, 63657, 30888, 65535, 65535, 63659, 65535, 65535, 65535, 65535, 63664, 65535,
+    65535, 65535, 30906, 63669, 65535, 63671, 65535, 63673, 65535, 65535, 63694, 30911, 63678, 65535, 65535, 63687,
+    63684, 63683, 65535, 65535, 30918, 65535, 65535, 30923, 30922, 65535, 65535, 30925, 65535, 65535, 63710, 30935,
+    30932, 63699, 65535, 65535, 63702, 65535, 65535, 30939, 63706, 65535, 65535, 30941, 65535, 65535, 63718, 30947,
+    30946, 65535, 65535, 30949, 65535, 65535, 63722, 30953, 65535, 65535, 63724, 65535, 65535, 63809, 63778, 63759,
+    63744, 63737, 63734, 63733, 65535, 65535, 30968, 65535, 65535, 30973, 30972, 65535, 65535, 30975, 65535, 65535,
+    30984, 30981, 30980, 65535, 65535, 30983, 65535, 65535, 30988, 63755, 65535, 65535, 63758, 65535, 65535, 30997,
+    30994, 65535, 30996, 65535, 65535, 31003, 31002, 31001, 65535, 65535, 65535, 31007, 31006, 65535, 65535, 31009,
+    65535, 65535, 31032, 31021, 31020, 31017, 31016, 65535, 65535, 31019, 65535, 65535, 65535, 31027, 31026, 31025,
+    65535, 65535, 65535, 31029, 65535, 31031, 65535, 65535, 31034, 65535, 31040, 31039, 31038, 65535, 65535, 65535,
+    65535, 63843, 31060, 31057, 31052, 31049, 63816, 65535, 65535, 63819, 65535, 65535, 63822, 65535, 31056, 65535,
+    65535, 63827, 65535, 65535, 31062, 65535, 31068, 63833, 65535, 31067, 65535, 65535, 31072, 63839, 65535, 65535,
+    31074, 65535, 65535, 31103, 31088, 63853, 31082, 63849, 65535, 65535, 63852, 65535, 65535, 31087, 65535, 65535,
+    63864, 31093, 31092, 65535, 65535, 31095, 65535, 65535, 31100, 63867, 65535, 65535, 63870, 65535, 65535, 63875,
+    31106, 65535, 65535, 65535, 31192, 31163, 31140, 31127, 31120, 31117, 31116, 65535, 65535, 63887, 65535, 65535,
+    63892, 63891, 65535, 65535, 63894, 65535, 65535, 63901, 63898, 65535, 63900, 65535, 65535, 63905, 31136, 65535,
+    65535, 63907, 65535, 65535, 63920, 63917, 63914, 63913, 65535, 65535, 63916, 65535, 65535, 31151, 65535, 65535,
+    63926, 31155, 65535, 31157, 65535, 65535, 63930, 31161, 65535, 65535, 65535, 63945, 63942, 63939, 63938, 63937,
+    65535, 65535, 65535, 31173, 65535, 65535, 31176, 65535, 65535, 63949, 31180, 65535, 65535, 31187, 63954, 63953,
+    65535, 65535, 65535, 63959, 63958, 65535, 65535, 65535, 64004, 63991, 31210, 63971, 31200, 63967, 65535, 65535,
+    31202, 65535, 65535, 31207, 63974, 65535, 65535, 63977, 65535, 65535, 63986, 31215, 63982, 65535, 65535, 63985,
+    65535, 65535, 31220, 65535, 63990, 65535, 65535, 31225, 65535, 31231, 63998, 63997, 65535, 65535, 65535, 31233,
+    65535, 31235, 65535, 65535, 64028, 31245, 64012, 64011, 64010, 65535, 65535, 65535, 65535, 31253, 64018, 31249,
+    65535, 65535, 64020, 65535, 65535, 31257, 64024, 65535, 65535, 64027, 65535, 65535, 64034, 31263, 65535, 31265,
+    65535, 65535, 31274, 64039, 64038, 65535, 65535, 64041, 65535, 65535, 64046, 31277, 65535, 65535, 31280, 65535,
+    65535, 64135, 64104, 64083, 64068, 64061, 64058, 64057, 65535, 65535, 31292, 65535, 65535, 31297, 31296, 65535,
+    65535, 31299, 65535, 65535, 31308, 31305, 31304, 65535, 65535, 64075, 65535, 65535, 31312, 64079, 65535, 65535,
+    31314, 65535, 65535, 31323, 31320, 31319, 65535, 65535, 31322, 65535, 65535, 31329, 31328, 31327, 65535, 65535,
+    65535, 31333, 31332, 65535, 65535, 31335, 65535, 65535, 31358, 31347, 31340, 65535, 31344, 31343, 65535, 65535,
+    31346, 65535, 65535, 31353, 31352, 31351, 65535, 65535, 65535, 31355, 65535, 31357, 65535, 65535, 31360, 65535,
+    31366, 31365, 31364, 65535, 65535, 65535, 65535, 64167, 31386, 31383, 31378, 31375, 64142, 65535, 65535, 64145,
+    65535, 65535, 64148, 65535, 31382, 65535, 65535, 64153, 65535, 65535, 31388, 65535, 31392, 64159, 65535, 65535,
+    31396, 64163, 65535, 65535, 31398, 65535, 65535, 31423, 31408, 64171, 65535, 64175, 64174, 65535, 65535, 65535,
+    64184, 31413, 64180, 65535, 65535, 31415, 65535, 65535, 31420, 31419, 65535, 65535, 64190, 65535, 65535, 64195,
+    31426, 65535, 65535, 65535
+};
+
+double xgb_table_score(const double input[XGB_MODEL_NUM_FEATURES])
+{
+    double sum = 0.0;
+    for (uint16_t t = 0; t < xgb_model_table_num_trees; ++t) {
+        uint16_t node = xgb_tree_root[t];
+        uint16_t link;
+        while ((link = xgb_node_link[node]) != XGB_LEAF_LINK) {
+            // Compare in double against the same literals as xgb_model.c; NaN takes the ">=" branch there too
+            const double x = input[(link & XGB_FEATURE_BIT) ? 1 : 0];
+            node = (x < xgb_node_value[node]) ? (uint16_t)(node + 1) : (uint16_t)(link & ~XGB_FEATURE_BIT);
+        }
+        sum += xgb_node_value[node];
+    }
+    return sum;
+}
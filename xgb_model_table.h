@@ -0,0 +1,32 @@
+// xgb_model_table.h
+// Table-driven evaluation of the tree ensemble in xgb_model.c.
+// xgb_model_table.c is generated by xgb_model_table.py; regenerate it whenever
+// xgb_model.c changes.
+#ifndef XGB_MODEL_TABLE_H
+#define XGB_MODEL_TABLE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define XGB_MODEL_NUM_FEATURES (2)      // input[0] = resonance in GHz, input[1] = S11 in dB
+#define XGB_LEAF_LINK          (0xFFFFu)
+#define XGB_FEATURE_BIT        (0x8000u)
+
+extern const uint32_t xgb_model_table_id;        // CRC32 of the xgb_model.c the table came from
+extern const uint16_t xgb_model_table_num_trees;
+extern const uint16_t xgb_model_table_num_nodes;
+
+/**
+ * @brief Same result as score() in xgb_model.c, evaluated from the node table: thresholds and
+ * leaves are the same double literals, compared and summed in the same order.
+ */
+double xgb_table_score(const double input[XGB_MODEL_NUM_FEATURES]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // XGB_MODEL_TABLE_H
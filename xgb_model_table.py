@@ -0,0 +1,128 @@
+"""
+Converts the generated if/else tree ensemble in xgb_model.c into a compact,
+flash-friendly node table (xgb_model_table.c) for the ESP32 firmware.
+
+Usage: python xgb_model_table.py [xgb_model.c] [xgb_model_table.c]
+
+Table layout (trees stored back to back in pre-order):
+  xgb_node_value[i]  double split threshold, or leaf value, as written in xgb_model.c
+  xgb_node_link[i]   uint16 0xFFFF for a leaf; otherwise bit 15 = feature index
+                            and bits 0-14 = index of the ">= threshold" child.
+                            The "< threshold" child is always node i + 1.
+  xgb_tree_root[t]   uint16 index of tree t's root node
+"""
+import re
+import sys
+import zlib
+
+# --- Configuration ---
+SOURCE_PATH = 'xgb_model.c'
+OUTPUT_PATH = 'xgb_model_table.c'
+LEAF_LINK = 0xFFFF
+FEATURE_BIT = 0x8000
+
+SPLIT_RE = re.compile(r'^\s*if \(input\[(\d+)\] < (\S+)\) \{$')
+LEAF_RE = re.compile(r'^\s*var\d+ = (\S+);$')
+TREE_RE = re.compile(r'^\s*double var\d+;$')
+ELSE_RE = re.compile(r'^\s*\} else \{$')
+CLOSE_RE = re.compile(r'^\s*\}$')
+
+
+def parse_trees(source):
+    """Returns the node list and tree roots. Nodes are [feature, value, right_child]."""
+    nodes = []
+    roots = []
+    stack = []  # Split node indices whose "else" child is not yet placed
+
+    for line in source.splitlines():
+        if TREE_RE.match(line):
+            assert not stack, "Unbalanced tree before new tree"
+            roots.append(len(nodes))
+        elif m := SPLIT_RE.match(line):
+            feature = int(m.group(1))
+            assert feature < 2, "Link encoding holds a single feature bit"
+            stack.append(len(nodes))
+            nodes.append([feature, m.group(2), None])
+        elif m := LEAF_RE.match(line):
+            nodes.append([None, m.group(1), None])
+        elif ELSE_RE.match(line):
+            # The next node emitted is the ">= threshold" child of the innermost open split
+            open_splits = [i for i in stack if nodes[i][2] is None]
+            nodes[open_splits[-1]][2] = len(nodes)
+        elif CLOSE_RE.match(line):
+            if stack and nodes[stack[-1]][2] is not None:
+                stack.pop()
+
+    assert not stack, "Unbalanced braces at end of file"
+    assert len(nodes) < FEATURE_BIT, "Too many nodes for 15-bit child links"
+    return nodes, roots
+
+
+def emit_table(nodes, roots, model_id):
+    values = []
+    links = []
+    for feature, value, right in nodes:
+        values.append(value)
+        if feature is None:
+            links.append(LEAF_LINK)
+        else:
+            links.append((FEATURE_BIT if feature else 0) | right)
+
+    def rows(items, per_row):
+        return ',\n'.join('    ' + ', '.join(str(x) for x in items[i:i + per_row])
+                          for i in range(0, len(items), per_row))
+
+    return f"""// xgb_model_table.c
+// GENERATED by xgb_model_table.py from xgb_model.c - do not edit by hand.
+#include "xgb_model_table.h"
+
+const uint32_t xgb_model_table_id = 0x{model_id:08X}u;
+const uint16_t xgb_model_table_num_trees = {len(roots)};
+const uint16_t xgb_model_table_num_nodes = {len(nodes)};
+
+static const uint16_t xgb_tree_root[{len(roots)}] = {{
+{rows(roots, 16)}
+}};
+
+static const double xgb_node_value[{len(nodes)}] = {{
+{rows(values, 8)}
+}};
+
+static const uint16_t xgb_node_link[{len(nodes)}] = {{
+{rows(links, 16)}
+}};
+
+double xgb_table_score(const double input[XGB_MODEL_NUM_FEATURES])
+{{
+    double sum = 0.0;
+    for (uint16_t t = 0; t < xgb_model_table_num_trees; ++t) {{
+        uint16_t node = xgb_tree_root[t];
+        uint16_t link;
+        while ((link = xgb_node_link[node]) != XGB_LEAF_LINK) {{
+            // Compare in double against the same literals as xgb_model.c; NaN takes the ">=" branch there too
+            const double x = input[(link & XGB_FEATURE_BIT) ? 1 : 0];
+            node = (x < xgb_node_value[node]) ? (uint16_t)(node + 1) : (uint16_t)(link & ~XGB_FEATURE_BIT);
+        }}
+        sum += xgb_node_value[node];
+    }}
+    return sum;
+}}
+"""
+
+
+def main():
+    source_path = sys.argv[1] if len(sys.argv) > 1 else SOURCE_PATH
+    output_path = sys.argv[2] if len(sys.argv) > 2 else OUTPUT_PATH
+
+    with open(source_path) as f:
+        source = f.read()
+    nodes, roots = parse_trees(source)
+    model_id = zlib.crc32(source.encode())  # Model version: CRC32 of the generated source
+
+    with open(output_path, 'w') as f:
+        f.write(emit_table(nodes, roots, model_id))
+    print(f"Wrote {output_path}: {len(roots)} trees, {len(nodes)} nodes, model id 0x{model_id:08X}")
+
+
+if __name__ == '__main__':
+    main()